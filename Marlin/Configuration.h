@@ -506,6 +506,38 @@
 
 #endif // PIDTEMP
 
+/**
+ * Model Predictive Control for hotend
+ *
+ * Use a thermal model of the hotend to plan heater power from the target
+ * temperature, heat loss to ambient, part cooling fan speed and the extrusion
+ * rate of the move being executed. Holds temperature at high flow rates with
+ * far less droop and overshoot than PID. Disable PIDTEMP to use this option.
+ *
+ * Use 'M306 T' to tune the model (a single heat-up, a few minutes) and M500
+ * to save the result. Each setting below takes one value per hotend.
+ */
+//#define MPCTEMP
+#if ENABLED(MPCTEMP)
+  #define MPC_AUTOTUNE                                // Include M306 T auto-tuning (~4K bytes of flash)
+  #define MPC_MAX BANG_MAX                            // (0..255) Limits current to nozzle while MPC is active
+
+  #define MPC_HEATER_POWER { 40.0f }                  // (W) Heater cartridge power
+
+  // Measured physical constants from 'M306 T'
+  #define MPC_BLOCK_HEAT_CAPACITY { 16.7f }           // (J/K) Heat capacity of the heater block
+  #define MPC_SENSOR_RESPONSIVENESS { 0.22f }         // (K/s per K) Rate the sensor follows the block temperature
+  #define MPC_AMBIENT_XFER_COEFF { 0.068f }           // (W/K) Heat loss to room air with the fan off
+  #define MPC_AMBIENT_XFER_COEFF_FAN255 { 0.097f }    // (W/K) Heat loss to room air with the fan at full speed
+
+  // Filament heat capacity per mm: 0.0056 for 1.75mm PLA, 0.0142 for 2.85mm PLA
+  #define FILAMENT_HEAT_CAPACITY_PERMM { 5.6e-3f }    // (J/K/mm)
+
+  #define MPC_SMOOTHING_FACTOR 0.5f                   // (0.0...1.0) Pull of the measured temperature on the model
+  #define MPC_MIN_AMBIENT_CHANGE 1.0f                 // (K/s) Modeled ambient temperature rate of change, when correcting
+  #define MPC_STEADYSTATE 0.5f                        // (K/s) Temperature change rate for steady state logic to be enforced
+#endif
+
 //===========================================================================
 //====================== PID > Bed Temperature Control ======================
 //===========================================================================
@@ -1041,6 +1073,20 @@
 
 #define Z_PROBE_LOW_POINT          -2 // Farthest distance below the trigger-point to go before stopping
 
+/**
+ * Overlap the raise and travel between probe points with result processing.
+ * The raise after each point is queued without waiting, so G29 stores the
+ * result and updates the display while Z is moving, and the travel to the
+ * next point follows the raise in the planner without a full stop and wait.
+ *
+ * With a probe that stays deployed between points (e.g., BLTOUCH_HS_MODE or
+ * a fixed probe) the raise between points can be cut to Z_CLEARANCE_MULTI_PROBE.
+ */
+//#define PROBE_TRAVEL_OVERLAP
+#if ENABLED(PROBE_TRAVEL_OVERLAP)
+  //#define PROBE_TRAVEL_SHORT_RAISE  // Raise only Z_CLEARANCE_MULTI_PROBE between probe points
+#endif
+
 // For M851 give a range for adjusting the Z probe offset
 #define Z_PROBE_OFFSET_RANGE_MIN -20
 #define Z_PROBE_OFFSET_RANGE_MAX 20
@@ -1484,6 +1530,7 @@
 #define EEPROM_BOOT_SILENT    // Keep M503 quiet and only give errors during first load
 #if ENABLED(EEPROM_SETTINGS)
   //#define EEPROM_AUTO_INIT  // Init EEPROM automatically on any errors.
+  //#define FLASH_EEPROM_LEVELING // For flash-emulated EEPROM (STM32F1, STM32F4) rotate saves through several slots. Changing this resets settings.
 #endif
 
 //
@@ -52,6 +52,31 @@
  */
 #define THERMOCOUPLE_MAX_ERRORS 15
 
+/**
+ * Sample analog inputs with a continuous scan-mode ADC and DMA.
+ * Conversions run in the background into a circular buffer of several
+ * scans which is averaged when read, so the temperature ISR never waits
+ * for a conversion. STM32F1 and SAMD51 always sample this way.
+ * Currently supported on STM32F4 and STM32F7 with all inputs on ADC1.
+ */
+//#define ADC_DMA_SAMPLING
+#if ENABLED(ADC_DMA_SAMPLING)
+  //#define ADC_DMA_SCANS 8   // Number of scans averaged per reading
+#endif
+
+/**
+ * Convert thermistor readings through uniform-step lookup tables.
+ * Each thermistor table and user thermistor is sampled at evenly spaced raw
+ * ADC values when Marlin starts (and when M305 changes a user thermistor),
+ * so every reading is a single index and interpolation instead of a table
+ * search or a log(). Matches the thermistor tables to within 0.1°C.
+ * Uses about 2K of RAM per thermistor. 32-bit only.
+ */
+//#define THERMISTOR_LUT
+#if ENABLED(THERMISTOR_LUT)
+  //#define THERMISTOR_LUT_BITS 8  // Fewer entries to save RAM, at a cost in accuracy near the top of the range
+#endif
+
 //
 // Custom Thermistor 1000 parameters
 //
@@ -1125,6 +1150,10 @@
   #endif
 #endif
 
+#if HAS_CHARACTER_LCD
+  //#define LCD_SKIP_UNCHANGED            // Keep a copy of the screen in RAM and only send characters that changed
+#endif
+
 #if ENABLED(SDSUPPORT)
 
   // The standard SD detect circuit reads LOW when media is inserted and HIGH when empty.
@@ -1174,6 +1203,19 @@
     // Without a POWER_LOSS_PIN the following option helps reduce wear on the SD card,
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE 0.05 // (mm) Minimum Z change before saving power-loss data
+
+    /**
+     * Keep the recovery file at a fixed size and append small checkpoint
+     * records (position, SD position, temperatures, fans, feedrate) to a
+     * ring in it, instead of truncating and rewriting the whole file. Each
+     * save then updates a single block with no FAT or directory writes.
+     * The full state is only rewritten when something else has changed.
+     */
+    //#define POWER_LOSS_JOURNAL
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      #define POWER_LOSS_JOURNAL_SLOTS 32 // (8-255) Records in the ring. Each takes 64 bytes of the file.
+      //#define SAVE_INFO_INTERVAL_MS 10000 // (ms) Also save on this interval while printing
+    #endif
   #endif
 
   /**
@@ -1214,9 +1256,26 @@
                                       // Note: Only affects SCROLL_LONG_FILENAMES with SDSORT_CACHE_NAMES but not SDSORT_DYNAMIC_RAM.
   #endif
 
-  // This allows hosts to request long names for files and folders with M33
+  /**
+   * Index the working directory after it is entered, noting where each listed
+   * item starts. Menu rows and sorting then go straight to an item instead of
+   * rescanning the directory from the top for each one. The index is built a
+   * few items at a time from the idle loop and the media menu shows a loading
+   * row until it's done. Host commands and sorting finish it at once.
+   * Costs 2 bytes of SRAM per item. Items past the limit are found by scanning.
+   */
+  //#define SD_DIR_INDEX
+  #if ENABLED(SD_DIR_INDEX)
+    #define SD_DIR_INDEX_LIMIT 512          // Maximum number of indexed items
+    #define SD_DIR_INDEX_BATCH   8          // Items read per idle loop while indexing
+  #endif
+
+  // This allows hosts to request long names for files and folders with M33, or all at once with M20 L
   //#define LONG_FILENAME_HOST_SUPPORT
 
+  // Allow hosts to request file modification times with M20 T
+  //#define M20_TIMESTAMP_SUPPORT
+
   // Enable this option to scroll long filenames in the SD card menu
   //#define SCROLL_LONG_FILENAMES
 
@@ -1230,6 +1289,55 @@
    */
   //#define SD_ABORT_ON_ENDSTOP_HIT
 
+  /**
+   * Read the file being printed ahead in whole blocks, using multi-block
+   * transfers where the card allows, instead of one byte at a time through
+   * the shared block cache. Helps keep the planner fed with dense G-code.
+   * Uses SD_READAHEAD_BLOCKS * 512 bytes of SRAM.
+   */
+  //#define SD_READAHEAD
+  #if ENABLED(SD_READAHEAD)
+    #define SD_READAHEAD_BLOCKS 4           // Blocks read per refill (1-16)
+  #endif
+
+  /**
+   * Keep several blocks in the SD block cache instead of just one, with
+   * slots reserved for the FAT so streaming a file or walking a directory
+   * doesn't keep evicting the FAT block it needs next. Least recently used
+   * slots are replaced first and dirty blocks are written back on eviction.
+   * Each slot uses 512 bytes of SRAM. Defaults depend on the platform.
+   */
+  //#define SD_BLOCK_CACHE
+  #if ENABLED(SD_BLOCK_CACHE)
+    //#define SD_CACHE_SLOTS      4         // Slots for data and directory blocks
+    //#define SD_FAT_CACHE_SLOTS  2         // Slots for FAT blocks
+    //#define SD_CACHE_STATS                // Count hits, misses and writes. Report with 'M27 B'.
+  #endif
+
+  /**
+   * Map the cluster chain of a file into runs of consecutive clusters when
+   * it is opened for printing. Reading and seeking (e.g., to resume after a
+   * power loss) then find clusters without going through the FAT.
+   * Each run uses 8 bytes of SRAM.
+   */
+  //#define SD_FILE_EXTENTS
+  #if ENABLED(SD_FILE_EXTENTS)
+    #define SD_FILE_EXTENTS_MAX 16          // Runs mapped per file (1-64). The start of a file with more runs is mapped.
+  #endif
+
+  /**
+   * Collect lines saved with M28 or logged with M928 in RAM and write them
+   * out as whole blocks, using multi-block transfers where the card allows,
+   * instead of a small write per line. Data is flushed on M29 and when the
+   * file is closed, so an unsaved tail is lost on power failure.
+   * Uses SD_WRITE_BEHIND_BLOCKS * 512 bytes of SRAM.
+   */
+  //#define SD_WRITE_BEHIND
+  #if ENABLED(SD_WRITE_BEHIND)
+    #define SD_WRITE_BEHIND_BLOCKS 2        // Blocks written per flush (1-16)
+    //#define SD_WRITE_PREALLOCATE 8        // Clusters reserved in one run when a file is opened for writing (1-255)
+  #endif
+
   /**
    * This option makes it easier to print the same SD Card file again.
    * On print completion the LCD Menu will open with the file selected.
@@ -1293,6 +1401,21 @@
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
   //#define BINARY_FILE_TRANSFER
 
+  #if ENABLED(BINARY_FILE_TRANSFER)
+    /**
+     * Pipelined binary transfer. The host may send several packets per 'ok'
+     * and received data is staged into whole 512-byte blocks so the card gets
+     * aligned multiple-block writes. Hosts that wait for every 'ok' still work.
+     * The SYNC reply ('ss') gains the window size as an extra field.
+     */
+    //#define BINARY_STREAM_PIPELINE
+    #if ENABLED(BINARY_STREAM_PIPELINE)
+      #define BINARY_STREAM_ACK_WINDOW     4  // (1-16) Packets in flight per acknowledgement
+      #define BINARY_STREAM_BUFFER_BLOCKS  2  // (1-8) Blocks of data staged per card write
+      #define BINARY_STREAM_WINDOW_BITS   10  // (8-12) Heatshrink window. Uses 2^n bytes of RAM.
+    #endif
+  #endif
+
   /**
    * Set this option to one of the following (or the board's defaults apply):
    *
@@ -1346,6 +1469,19 @@
   // Swap the CW/CCW indicators in the graphics overlay
   //#define OVERLAY_GFX_REVERSE
 
+  /**
+   * Draw screen pages within a time budget instead of one page per idle().
+   * Pages are held back while only a few moves are planned so that busy
+   * screens can't starve the planner at high feedrates.
+   * With M111 S2 (INFO) the page count and slowest page of each screen are reported.
+   */
+  //#define DOGM_PAGE_BUDGET
+  #if ENABLED(DOGM_PAGE_BUDGET)
+    #define DOGM_PAGE_BUDGET_US   2000  // (µs) Keep drawing pages in one idle() while the next should fit in this time
+    #define DOGM_PAGE_MIN_PLANNED    4  // Hold back pages while fewer moves than this are planned
+    #define DOGM_PAGE_MAX_DEFER    500  // (ms) Longest time to hold back a page
+  #endif
+
   /**
    * ST7920-based LCDs can emulate a 16 x 4 character display using
    * the ST7920 character-generator for very fast screen updates.
@@ -1409,6 +1545,12 @@
 
   #define DGUS_UPDATE_INTERVAL_MS  500    // (ms) Interval between automatic screen updates
 
+  //#define DGUS_WRITE_CACHE                // Send only changed VPs in screen updates, merging writes to adjacent VPs
+  #if ENABLED(DGUS_WRITE_CACHE)
+    #define DGUS_WRITE_CACHE_SIZE   32      // Number of VPs whose last sent value is remembered (6 bytes each)
+    #define DGUS_WRITE_BATCH_SIZE   32      // (bytes) Largest payload of a merged write
+  #endif
+
   #if EITHER(DGUS_LCD_UI_FYSETC, DGUS_LCD_UI_HIPRECY)
     #define DGUS_PRINT_FILENAME           // Display the filename during printing
     #define DGUS_PREHEAT_UI               // Display a preheat screen during heatup
@@ -1433,6 +1575,18 @@
   #endif
 #endif // HAS_DGUS_LCD
 
+//
+// Creality DWIN display (Ender-3 V2)
+//
+#if ENABLED(DWIN_CREALITY_LCD)
+  //#define DWIN_BATCH_SIZE 256           // (bytes) Collect draw commands and send them together when the screen is updated
+  //#define DWIN_SKIP_UNCHANGED           // Don't resend text or numbers the screen already shows. An icon makes
+                                          // the text below and right of its corner be sent again.
+  #if ENABLED(DWIN_SKIP_UNCHANGED)
+    #define DWIN_SKIP_UNCHANGED_SIZE 16   // Number of drawn items to remember (12 bytes each)
+  #endif
+#endif
+
 //
 // Touch UI for the FTDI Embedded Video Engine (EVE)
 //
@@ -1516,6 +1670,10 @@
   // (recommended for smaller displays)
   //#define TOUCH_UI_PASSCODE
 
+  // Collect display commands in RAM and send them in one SPI transfer
+  // per screen update. Uses this much RAM (bytes, a multiple of 4).
+  //#define TOUCH_UI_CMD_BUFFER_SIZE 256
+
   // Output extra debug info for Touch UI events
   //#define TOUCH_UI_DEBUG
 
@@ -1523,6 +1681,17 @@
   //#define TOUCH_UI_DEVELOPER_MENU
 #endif
 
+//
+// Extensible UI event queue
+//
+#if ENABLED(EXTENSIBLE_UI)
+  //#define EXTUI_EVENT_QUEUE             // Queue mesh, status and print timer events and handle them in idle()
+  #if ENABLED(EXTUI_EVENT_QUEUE)
+    #define EXTUI_EVENT_QUEUE_SIZE  16    // Number of pending events (8 bytes each). Repeated events are merged.
+    #define EXTUI_EVENT_BUDGET_MS    5    // (ms) Time allowed for event handling per idle() call
+  #endif
+#endif
+
 //
 // FSMC / SPI Graphical TFT
 //
@@ -1536,6 +1705,36 @@
   //#define TFT_BTOKMENU_COLOR 0x145F // 00010 100010 11111 Cyan
 #endif
 
+//
+// Color UI (TFT_320x240 / TFT_480x320)
+//
+#if HAS_GRAPHICAL_TFT
+  /**
+   * Remember the content of each canvas region drawn on screen and skip
+   * redrawing regions that haven't changed. Saves rasterizing and FSMC/SPI
+   * transfers, mainly on the status screen while printing.
+   */
+  //#define TFT_CANVAS_CACHE
+  #if ENABLED(TFT_CANVAS_CACHE)
+    #define TFT_CANVAS_CACHE_SIZE 32  // Number of regions to remember
+  #endif
+
+  //#define TFT_PIXEL_STATS           // Report pixels sent to the display each second (with M111 S2)
+
+  //#define TFT_GLYPH_CACHE           // Keep recently drawn glyphs as runs of pixels for faster text. (~3K of RAM)
+  #if ENABLED(TFT_GLYPH_CACHE)
+    #define TFT_GLYPH_CACHE_SIZE 32   // Number of glyphs to keep
+    #define TFT_GLYPH_CACHE_RUNS 40   // Maximum runs per glyph. More complex glyphs are drawn directly.
+  #endif
+
+  /**
+   * Split the TFT buffer in two and render the next stripe of a canvas
+   * while DMA sends the previous one. Requires a TFT with DMA transfers
+   * (HAL/STM32 FSMC or SPI). HAL/LINUX emulates it for testing.
+   */
+  //#define TFT_DOUBLE_BUFFER
+#endif
+
 //
 // ADC Button Debounce
 //
@@ -3524,3 +3723,13 @@
 
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
+
+// Report the time taken by each stage of startup, in microseconds
+//#define BOOT_PROFILER
+
+// Run startup stages that aren't needed to accept commands (e.g., TMC connection test)
+// from the idle loop after setup(), so the host and heaters are served sooner.
+// The bootscreen is drawn without blocking and cleared from the idle loop when it
+// times out. Animated bootscreens still play their frames in one go. Character LCDs
+// show the logo and one splash line without scrolling.
+//#define DEFERRED_INIT
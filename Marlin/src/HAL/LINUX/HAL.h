@@ -46,8 +46,7 @@ uint8_t _getc();
 #define OCT  8
 #define BIN  2
 //arduino: binary.h (weird defines)
-#define B01 1
-#define B10 2
+#include "include/binary.h"
 
 #include "hardware/Clock.h"
 
@@ -23,34 +23,62 @@
 
 #include "Clock.h"
 #include <stdio.h>
+#include <math.h>
 #include "../../../inc/MarlinConfig.h"
 
 #include "Heater.h"
 
-Heater::Heater(pin_t heater, pin_t adc) {
-  heater_state = 0;
-  room_temp_raw = 150;
-  last = Clock::micros();
-  heater_pin = heater;
-  adc_pin = adc;
-  heat = 0.0;
+Heater::Heater(pin_t heater, pin_t adc, const heater_data_t &data, pin_t fan/*=-1*/, LinearAxis *extruder/*=nullptr*/, double e_steps_per_mm/*=1*/)
+  : heater_pin(heater), adc_pin(adc), fan_pin(fan), data(data), extruder(extruder), e_steps_per_mm(e_steps_per_mm) {
+  last_e_position = extruder ? extruder->position : 0;
+  ambient_temp = block_temp = sensor_temp = 25.0;
+  last = last_poll = Clock::micros();
+  on_time = 0;
 }
 
 Heater::~Heater() {
 }
 
+// ADC reading of a 100K NTC (beta 4092) with a 4.7K pullup, as for thermistor table 1
+static uint16_t celsius_to_adc(const double celsius) {
+  const double r = 100000.0 * exp(4092.0 * (1.0 / (celsius + 273.15) - 1.0 / 298.15));
+  return (uint16_t)lround(1023.0 * r / (r + 4700.0));
+}
+
 void Heater::update() {
-  // crude pwm read and cruder heat simulation
-  auto now = Clock::micros();
-  double delta = (now - last);
-  if (delta > 1000 ) {
-    heater_state = pwmcap.update(0xFFFF * Gpio::pin_map[heater_pin].value);
-    last = now;
-    heat += (heater_state - heat) * (delta / 1000000000.0);
-
-    NOLESS(heat, room_temp_raw);
-    Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = 0xFFFF - (uint16_t)heat;
+  // Integrate the heater on-time between model steps
+  const uint64_t now = Clock::micros();
+  if (Gpio::get(heater_pin)) on_time += now - last_poll;
+  last_poll = now;
+
+  const double delta = now - last;
+  if (delta < 1000) return;
+  const double dt = delta / 1000000.0;
+  last = now;
+
+  // Fan speed as a fraction. PWM values above 1, digital 0 or 1.
+  const uint16_t fan_value = Gpio::get(fan_pin);
+  const double fan = fan_value > 1 ? fan_value / 255.0 : fan_value;
+
+  // Filament pushed through the block since the last step
+  double e_mm = 0;
+  if (extruder) {
+    const int32_t e_position = extruder->position;
+    if (e_position > last_e_position) e_mm = (e_position - last_e_position) / e_steps_per_mm;
+    last_e_position = e_position;
   }
+
+  const double energy_in = data.heater_power * (on_time / 1000000.0),
+               dT = block_temp - ambient_temp,
+               energy_out = (data.ambient_xfer_coeff + fan * data.fan_xfer_coeff) * dT * dt
+                          + data.filament_heat_capacity_permm * e_mm * dT;
+  on_time = 0;
+
+  block_temp += (energy_in - energy_out) / data.heat_capacity;
+  sensor_temp += (block_temp - sensor_temp) * _MIN(1.0, data.sensor_responsiveness * dt);
+
+  // The ADC reads the upper 10 bits of a 12-bit value
+  Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = celsius_to_adc(sensor_temp) << 2;
 }
 
 void Heater::interrupt(GpioEvent ev) {
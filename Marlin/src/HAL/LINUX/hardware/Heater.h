@@ -22,26 +22,33 @@
 #pragma once
 
 #include "Gpio.h"
+#include "LinearAxis.h"
 
-struct LowpassFilter {
-  uint64_t data_delay = 0;
-  uint16_t update(uint16_t value) {
-    data_delay = data_delay - (data_delay >> 6) + value;
-    return (uint16_t)(data_delay >> 6);
-  }
+/**
+ * Lumped thermal model of a heater block and its temperature sensor
+ */
+struct heater_data_t {
+  double heater_power,                  // (W) Power with the heater pin high
+         heat_capacity,                 // (J/K) Heat capacity of the heated block
+         ambient_xfer_coeff,            // (W/K) Heat loss to room air
+         fan_xfer_coeff,                // (W/K) Additional loss with the fan at full speed
+         sensor_responsiveness,         // (1/s) Rate the sensor follows the block temperature
+         filament_heat_capacity_permm;  // (J/K/mm) Heat taken up by each mm of extruded filament
 };
 
 class Heater: public Peripheral {
 public:
-  Heater(pin_t heater, pin_t adc);
+  Heater(pin_t heater, pin_t adc, const heater_data_t &data, pin_t fan=-1, LinearAxis *extruder=nullptr, double e_steps_per_mm=1);
   virtual ~Heater();
   void interrupt(GpioEvent ev);
   void update();
 
-  pin_t heater_pin, adc_pin;
-  uint16_t room_temp_raw;
-  uint16_t heater_state;
-  LowpassFilter pwmcap;
-  double heat;
-  uint64_t last;
+  pin_t heater_pin, adc_pin, fan_pin;
+  heater_data_t data;
+  LinearAxis *extruder;
+  double e_steps_per_mm;
+  int32_t last_e_position;
+
+  double ambient_temp, block_temp, sensor_temp;
+  uint64_t last, last_poll, on_time;
 };
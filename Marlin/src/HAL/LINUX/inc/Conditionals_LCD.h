@@ -21,6 +21,13 @@
  */
 #pragma once
 
-#if HAS_SPI_TFT || HAS_FSMC_TFT
-  #error "Sorry! TFT displays are not available for HAL/LINUX."
+// The Color UI draws into an emulated framebuffer (tft/tft_framebuffer.h)
+#if (HAS_SPI_TFT || HAS_FSMC_TFT) && !HAS_GRAPHICAL_TFT
+  #error "Sorry! Only the Color UI TFT is available for HAL/LINUX."
+#elif ENABLED(TOUCH_SCREEN)
+  #error "Sorry! TOUCH_SCREEN is not available for HAL/LINUX."
+#endif
+
+#if HAS_GRAPHICAL_TFT
+  #define HAS_TFT_FRAMEBUFFER 1   // M996 reports and saves the emulated display
 #endif
@@ -57,13 +57,18 @@ void read_serial_thread() {
 }
 
 void simulation_loop() {
-  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
-  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
   LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
   LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
   LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
   LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
 
+  // A 40W cartridge hotend with part cooling fan, and a 200W bed
+  constexpr float steps_per_mm[] = DEFAULT_AXIS_STEPS_PER_UNIT;
+  constexpr heater_data_t hotend_data = { 40.0, 14.0, 0.08, 0.05, 0.30, 5.6e-3 },
+                          bed_data = { 200.0, 900.0, 1.6, 0.0, 0.05, 0.0 };
+  Heater hotend(HEATER_0_PIN, TEMP_0_PIN, hotend_data, TERN(HAS_FAN0, FAN_PIN, -1), &extruder0, steps_per_mm[E_AXIS]);
+  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN, bed_data);
+
   //#define GPIO_LOGGING // Full GPIO and Positional Logging
 
   #ifdef GPIO_LOGGING
@@ -0,0 +1,125 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../../inc/MarlinConfig.h"
+
+#if HAS_GRAPHICAL_TFT
+
+#include "tft_framebuffer.h"
+#include "../../../lcd/tft/tft.h"
+#include "../../../lcd/tft/ili9341.h"
+
+#include <stdio.h>
+
+uint16_t TFT_Framebuffer::framebuffer[TFT_WIDTH * TFT_HEIGHT];
+uint32_t TFT_Framebuffer::pixels, TFT_Framebuffer::transfers;
+
+uint16_t TFT_Framebuffer::reg, TFT_Framebuffer::args[4];
+uint8_t TFT_Framebuffer::arg_count;
+uint16_t TFT_Framebuffer::xmin, TFT_Framebuffer::xmax, TFT_Framebuffer::ymin, TFT_Framebuffer::ymax, TFT_Framebuffer::x, TFT_Framebuffer::y;
+
+uint16_t *TFT_Framebuffer::dma_data;
+uint16_t TFT_Framebuffer::dma_count;
+bool TFT_Framebuffer::dma_increment, TFT_Framebuffer::dma_polled;
+
+void TFT_Framebuffer::Init() {
+  xmin = ymin = x = y = 0;
+  xmax = TFT_WIDTH - 1;
+  ymax = TFT_HEIGHT - 1;
+  dma_count = 0;
+}
+
+uint32_t TFT_Framebuffer::GetID() {
+  return TERN(HAS_UI_480x320, ST7796, ILI9341);
+}
+
+// A block transfer stays busy for one poll, then completes on the next
+bool TFT_Framebuffer::isBusy() {
+  if (!dma_count) return false;
+  if (!dma_polled) return (dma_polled = true);
+  FinishDMA();
+  return false;
+}
+
+void TFT_Framebuffer::WriteReg(uint16_t Reg) {
+  FinishDMA();
+  reg = Reg;
+  arg_count = 0;
+  if (reg == ILI9341_RAMWR) { x = xmin; y = ymin; }
+}
+
+void TFT_Framebuffer::Transmit(uint16_t Data) {
+  switch (reg) {
+    case ILI9341_CASET:
+    case ILI9341_PASET:
+      // Start and end, each sent as two bytes
+      if (arg_count < 4) args[arg_count++] = Data & 0xFF;
+      if (arg_count == 4) {
+        const uint16_t start = (args[0] << 8) | args[1], end = (args[2] << 8) | args[3];
+        if (reg == ILI9341_CASET) { xmin = start; xmax = end; }
+        else { ymin = start; ymax = end; }
+      }
+      break;
+
+    case ILI9341_RAMWR:
+      if (x < TFT_WIDTH && y < TFT_HEIGHT) framebuffer[y * TFT_WIDTH + x] = Data;
+      pixels++;
+      if (++x > xmax) { x = xmin; if (++y > ymax) y = ymin; }
+      break;
+
+    default: break;
+  }
+}
+
+void TFT_Framebuffer::TransmitDMA(bool MemoryIncrease, uint16_t *Data, uint16_t Count) {
+  FinishDMA();
+  dma_increment = MemoryIncrease;
+  dma_data = Data;
+  dma_count = Count;
+  dma_polled = false;
+  transfers++;
+}
+
+// Copy the pending block now, reading the source buffer as it is at this moment
+void TFT_Framebuffer::FinishDMA() {
+  for (; dma_count; dma_count--) {
+    Transmit(*dma_data);
+    if (dma_increment) dma_data++;
+  }
+}
+
+bool TFT_Framebuffer::save(const char * const path) {
+  FinishDMA();
+  FILE *f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", TFT_WIDTH, TFT_HEIGHT);
+  for (const uint16_t color : framebuffer) {
+    const uint8_t rgb[3] = { uint8_t(RED(color)), uint8_t(GREEN(color)), uint8_t(BLUE(color)) };
+    fwrite(rgb, 1, 3, f);
+  }
+  fclose(f);
+  return true;
+}
+
+#endif // HAS_GRAPHICAL_TFT
+#endif // __PLAT_LINUX__
@@ -0,0 +1,75 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Color UI display emulated in RAM
+ *
+ * Accepts the ILI9341 / ST7796 window and memory-write commands sent by
+ * lcd/tft/tft.cpp and keeps the resulting image in a framebuffer, so the
+ * Color UI can be benchmarked and compared with reference images without
+ * hardware. Block transfers complete later, like DMA, so code that reuses
+ * a buffer too early draws the wrong pixels here as well.
+ *
+ * M996 reports the counters and saves the image (gcode/lcd/M996.cpp).
+ */
+
+#include <stdint.h>
+
+#define DATASIZE_8BIT    8
+#define DATASIZE_16BIT   16
+#define TFT_IO TFT_Framebuffer
+
+class TFT_Framebuffer {
+private:
+  static uint16_t reg, args[4];
+  static uint8_t arg_count;
+  static uint16_t xmin, xmax, ymin, ymax, x, y;
+
+  static uint16_t *dma_data;                  // Pending block transfer
+  static uint16_t dma_count;
+  static bool dma_increment, dma_polled;
+
+  static void Transmit(uint16_t Data);
+  static void TransmitDMA(bool MemoryIncrease, uint16_t *Data, uint16_t Count);
+  static void FinishDMA();
+
+public:
+  static uint16_t framebuffer[];              // RGB565, TFT_WIDTH x TFT_HEIGHT
+  static uint32_t pixels, transfers;          // Counters for benchmarks
+
+  static void Init();
+  static uint32_t GetID();
+  static bool isBusy();
+  static void Abort() { dma_count = 0; }
+
+  static void DataTransferBegin(uint16_t DataWidth = DATASIZE_16BIT) { FinishDMA(); }
+  static void DataTransferEnd() {};
+
+  static void WriteData(uint16_t Data) { FinishDMA(); Transmit(Data); }
+  static void WriteReg(uint16_t Reg);
+
+  static void WriteSequence(uint16_t *Data, uint16_t Count) { TransmitDMA(true, Data, Count); }
+  static void WriteMultiple(uint16_t Color, uint16_t Count) { static uint16_t Data; Data = Color; TransmitDMA(false, &Data, Count); }
+
+  static bool save(const char * const path);  // Write the framebuffer to a PPM image
+};
@@ -261,3 +261,7 @@ static_assert(DISABLED(BAUD_RATE_GCODE), "BAUD_RATE_GCODE is not yet supported o
 #elif ENABLED(SERIAL_STATS_DROPPED_RX)
   #error "SERIAL_STATS_DROPPED_RX is not supported on this platform."
 #endif
+
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  #error "TFT_DOUBLE_BUFFER requires DMA transfers to the TFT, not available for HAL/LPC1768."
+#endif
@@ -120,8 +120,147 @@ extern "C" {
 // ADC
 // ------------------------
 
-// TODO: Make sure this doesn't cause any delay
-void HAL_adc_start_conversion(const uint8_t adc_pin) { HAL_adc_result = analogRead(adc_pin); }
+#if ENABLED(ADC_DMA_SAMPLING)
+
+  /**
+   * ADC1 runs a continuous scan over all analog inputs and DMA2 Stream 4
+   * copies each scan into a circular buffer of ADC_DMA_SCANS scans.
+   * Reading a pin averages its column, so the temperature ISR neither waits
+   * on a conversion nor reinitializes the ADC as analogRead() does.
+   */
+  #ifndef ADC_DMA_SCANS
+    #define ADC_DMA_SCANS 8
+  #endif
+
+  static const pin_t adc_pins[] = {
+    #if HAS_TEMP_ADC_0
+      TEMP_0_PIN,
+    #endif
+    #if HAS_TEMP_ADC_1
+      TEMP_1_PIN,
+    #endif
+    #if HAS_TEMP_ADC_2
+      TEMP_2_PIN,
+    #endif
+    #if HAS_TEMP_ADC_3
+      TEMP_3_PIN,
+    #endif
+    #if HAS_TEMP_ADC_4
+      TEMP_4_PIN,
+    #endif
+    #if HAS_TEMP_ADC_5
+      TEMP_5_PIN,
+    #endif
+    #if HAS_TEMP_ADC_6
+      TEMP_6_PIN,
+    #endif
+    #if HAS_TEMP_ADC_7
+      TEMP_7_PIN,
+    #endif
+    #if HAS_JOY_ADC_X
+      JOY_X_PIN,
+    #endif
+    #if HAS_JOY_ADC_Y
+      JOY_Y_PIN,
+    #endif
+    #if HAS_JOY_ADC_Z
+      JOY_Z_PIN,
+    #endif
+    #if HAS_HEATED_BED
+      TEMP_BED_PIN,
+    #endif
+    #if HAS_TEMP_CHAMBER
+      TEMP_CHAMBER_PIN,
+    #endif
+    #if HAS_TEMP_PROBE
+      TEMP_PROBE_PIN,
+    #endif
+    #if ENABLED(FILAMENT_WIDTH_SENSOR)
+      FILWIDTH_PIN,
+    #endif
+    #if HAS_ADC_BUTTONS
+      ADC_KEYPAD_PIN,
+    #endif
+    #if ENABLED(POWER_MONITOR_CURRENT)
+      POWER_MONITOR_CURRENT_PIN,
+    #endif
+    #if ENABLED(POWER_MONITOR_VOLTAGE)
+      POWER_MONITOR_VOLTAGE_PIN,
+    #endif
+  };
+
+  #define ADC_PIN_COUNT COUNT(adc_pins)
+
+  static volatile uint16_t adc_dma_buffer[ADC_DMA_SCANS][ADC_PIN_COUNT];
+  static ADC_HandleTypeDef adc_handle;
+  static DMA_HandleTypeDef adc_dma;
+  static bool adc_dma_running; // false: fall back to analogRead()
+
+  void HAL_adc_init() {
+    // A single scan sequence needs every input on ADC1
+    for (const pin_t pin : adc_pins)
+      if (pinmap_peripheral(digitalPinToPinName(pin), PinMap_ADC) != ADC1) return;
+
+    __HAL_RCC_ADC1_CLK_ENABLE();
+    __HAL_RCC_DMA2_CLK_ENABLE();
+
+    adc_handle.Instance                   = ADC1;
+    adc_handle.Init.ClockPrescaler        = ADC_CLOCK_SYNC_PCLK_DIV8;
+    adc_handle.Init.Resolution            = ADC_RESOLUTION_12B;
+    adc_handle.Init.ScanConvMode          = ENABLE;
+    adc_handle.Init.ContinuousConvMode    = ENABLE;
+    adc_handle.Init.DiscontinuousConvMode = DISABLE;
+    adc_handle.Init.ExternalTrigConvEdge  = ADC_EXTERNALTRIGCONVEDGE_NONE;
+    adc_handle.Init.ExternalTrigConv      = ADC_SOFTWARE_START;
+    adc_handle.Init.DataAlign             = ADC_DATAALIGN_RIGHT;
+    adc_handle.Init.NbrOfConversion       = ADC_PIN_COUNT;
+    adc_handle.Init.DMAContinuousRequests = ENABLE;
+    adc_handle.Init.EOCSelection          = ADC_EOC_SEQ_CONV;
+    if (HAL_ADC_Init(&adc_handle) != HAL_OK) return;
+
+    ADC_ChannelConfTypeDef channel = {};
+    channel.SamplingTime = ADC_SAMPLETIME_480CYCLES;  // High impedance thermistor dividers
+    LOOP_L_N(i, ADC_PIN_COUNT) {
+      channel.Channel = STM_PIN_CHANNEL(pinmap_function(digitalPinToPinName(adc_pins[i]), PinMap_ADC));
+      channel.Rank = i + 1;
+      if (HAL_ADC_ConfigChannel(&adc_handle, &channel) != HAL_OK) return;
+    }
+
+    // DMA2 Stream 0 is taken by the FSMC TFT, so use the ADC1 alternate on Stream 4
+    adc_dma.Instance                 = DMA2_Stream4;
+    adc_dma.Init.Channel             = DMA_CHANNEL_0;
+    adc_dma.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+    adc_dma.Init.PeriphInc           = DMA_PINC_DISABLE;
+    adc_dma.Init.MemInc              = DMA_MINC_ENABLE;
+    adc_dma.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    adc_dma.Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;
+    adc_dma.Init.Mode                = DMA_CIRCULAR;
+    adc_dma.Init.Priority            = DMA_PRIORITY_LOW;
+    adc_dma.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&adc_dma) != HAL_OK) return;
+    __HAL_LINKDMA(&adc_handle, DMA_Handle, adc_dma);
+
+    // The DMA stream IRQ is left disabled in the NVIC. The transfer just wraps around.
+    adc_dma_running = HAL_ADC_Start_DMA(&adc_handle, (uint32_t*)adc_dma_buffer, ADC_DMA_SCANS * ADC_PIN_COUNT) == HAL_OK;
+  }
+
+  void HAL_adc_start_conversion(const uint8_t adc_pin) {
+    if (adc_dma_running) LOOP_L_N(i, ADC_PIN_COUNT) {
+      if (adc_pins[i] != adc_pin) continue;
+      uint32_t sum = 0;
+      LOOP_L_N(s, ADC_DMA_SCANS) sum += adc_dma_buffer[s][i];
+      HAL_adc_result = (sum / (ADC_DMA_SCANS)) >> 2; // 12 to 10 bits
+      return;
+    }
+    HAL_adc_result = analogRead(adc_pin);
+  }
+
+#else
+
+  // TODO: Make sure this doesn't cause any delay
+  void HAL_adc_start_conversion(const uint8_t adc_pin) { HAL_adc_result = analogRead(adc_pin); }
+
+#endif
 
 uint16_t HAL_adc_get_result() { return HAL_adc_result; }
 
@@ -195,9 +195,13 @@ static inline int freeMemory() {
 // ADC
 //
 
-#define HAL_ANALOG_SELECT(pin) pinMode(pin, INPUT)
-
-inline void HAL_adc_init() {}
+#if ENABLED(ADC_DMA_SAMPLING)
+  #define HAL_ANALOG_SELECT(pin) pinMode(pin, INPUT_ANALOG)
+  void HAL_adc_init();
+#else
+  #define HAL_ANALOG_SELECT(pin) pinMode(pin, INPUT)
+  inline void HAL_adc_init() {}
+#endif
 
 #define HAL_ADC_VREF         3.3
 #define HAL_ADC_RESOLUTION  10
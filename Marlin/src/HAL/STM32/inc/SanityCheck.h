@@ -45,6 +45,10 @@
   #error "Disable PRINTCOUNTER or choose another EEPROM emulation."
 #endif
 
+#if ENABLED(ADC_DMA_SAMPLING) && NONE(STM32F4xx, STM32F7xx)
+  #error "ADC_DMA_SAMPLING is currently only supported on STM32F4 and STM32F7 hardware."
+#endif
+
 #if !defined(STM32F4xx) && ENABLED(FLASH_EEPROM_LEVELING)
   #error "FLASH_EEPROM_LEVELING is currently only supported on STM32F4 hardware."
 #endif
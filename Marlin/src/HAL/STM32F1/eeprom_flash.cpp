@@ -38,24 +38,84 @@
 #include <flash_stm32.h>
 #include <EEPROM.h>
 
-// Store settings in the last two pages
+// Store settings in the last two pages, or one page per slot with FLASH_EEPROM_LEVELING
 #ifndef MARLIN_EEPROM_SIZE
-  #define MARLIN_EEPROM_SIZE ((EEPROM_PAGE_SIZE) * 2)
+  #define MARLIN_EEPROM_SIZE ((EEPROM_PAGE_SIZE) * TERN(FLASH_EEPROM_LEVELING, 1, 2))
 #endif
-size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
 
 static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4))) = {0};
 static bool eeprom_dirty = false;
 
+#if ENABLED(FLASH_EEPROM_LEVELING)
+
+  /**
+   * Rotate saves through several slots, each MARLIN_EEPROM_SIZE bytes of whole pages,
+   * starting at EEPROM_PAGE0_BASE. By default each of the two reserved pages is one
+   * slot. Move EEPROM_START_ADDRESS down to make room for more, or for larger slots.
+   *
+   * Each slot starts with a sequence number and its complement, programmed only
+   * after the data, so a save interrupted by power loss leaves the previous slot
+   * in use. Only the slot being written is erased.
+   */
+  #ifndef FLASH_EEPROM_SLOTS
+    #define FLASH_EEPROM_SLOTS ((EEPROM_PAGE_SIZE) * 2 / (MARLIN_EEPROM_SIZE))
+  #endif
+  #define SLOT_HEADER_SIZE 4
+  #define SLOT_ADDRESS(slot) (EEPROM_PAGE0_BASE + (slot) * (MARLIN_EEPROM_SIZE))
+
+  static_assert(0 == (MARLIN_EEPROM_SIZE) % (EEPROM_PAGE_SIZE), "MARLIN_EEPROM_SIZE must be a multiple of EEPROM_PAGE_SIZE for FLASH_EEPROM_LEVELING.");
+  static_assert(FLASH_EEPROM_SLOTS >= 2, "FLASH_EEPROM_LEVELING needs room for two slots, i.e., MARLIN_EEPROM_SIZE of at most one EEPROM_PAGE_SIZE in the two reserved pages. Reduce MARLIN_EEPROM_SIZE or set FLASH_EEPROM_SLOTS and lower EEPROM_START_ADDRESS.");
+
+  static int8_t current_slot = -1;
+  static uint16_t current_seq;
+
+  // A slot is committed when its header holds a sequence number and its complement
+  static bool slot_seq(const uint8_t slot, uint16_t &seq) {
+    const uint16_t * const header = reinterpret_cast<const uint16_t*>(SLOT_ADDRESS(slot));
+    seq = header[0];
+    return uint16_t(~header[1]) == seq;
+  }
+
+  size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE - SLOT_HEADER_SIZE; }
+
+#else
+
+  size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
+
+#endif
+
 bool PersistentStore::access_start() {
-  const uint32_t* source = reinterpret_cast<const uint32_t*>(EEPROM_PAGE0_BASE);
-  uint32_t* destination = reinterpret_cast<uint32_t*>(ram_eeprom);
 
-  static_assert(0 == (MARLIN_EEPROM_SIZE) % 4, "MARLIN_EEPROM_SIZE is corrupted. (Must be a multiple of 4.)"); // Ensure copying as uint32_t is safe
-  constexpr size_t eeprom_size_u32 = (MARLIN_EEPROM_SIZE) / 4;
+  #if ENABLED(FLASH_EEPROM_LEVELING)
+
+    // Find the newest committed slot. Sequence numbers wrap, so compare by difference.
+    current_slot = -1;
+    for (uint8_t i = 0; i < FLASH_EEPROM_SLOTS; ++i) {
+      uint16_t seq;
+      if (slot_seq(i, seq) && (current_slot < 0 || int16_t(seq - current_seq) > 0)) {
+        current_slot = i;
+        current_seq = seq;
+      }
+    }
+    if (current_slot < 0) {
+      memset(ram_eeprom, 0xFF, sizeof(ram_eeprom));
+      current_seq = 0;
+    }
+    else
+      memcpy(ram_eeprom, reinterpret_cast<const uint8_t*>(SLOT_ADDRESS(current_slot) + SLOT_HEADER_SIZE), capacity());
+
+  #else
+
+    const uint32_t* source = reinterpret_cast<const uint32_t*>(EEPROM_PAGE0_BASE);
+    uint32_t* destination = reinterpret_cast<uint32_t*>(ram_eeprom);
+
+    static_assert(0 == (MARLIN_EEPROM_SIZE) % 4, "MARLIN_EEPROM_SIZE is corrupted. (Must be a multiple of 4.)"); // Ensure copying as uint32_t is safe
+    constexpr size_t eeprom_size_u32 = (MARLIN_EEPROM_SIZE) / 4;
 
-  for (size_t i = 0; i < eeprom_size_u32; ++i, ++destination, ++source)
-    *destination = *source;
+    for (size_t i = 0; i < eeprom_size_u32; ++i, ++destination, ++source)
+      *destination = *source;
+
+  #endif
 
   eeprom_dirty = false;
   return true;
@@ -66,26 +126,54 @@ bool PersistentStore::access_finish() {
   if (eeprom_dirty) {
     FLASH_Status status;
 
-    // Instead of erasing all (both) pages, maybe in the loop we check what page we are in, and if the
-    // data has changed in that page. We then erase the first time we "detect" a change. In theory, if
-    // nothing changed in a page, we wouldn't need to erase/write it.
-    // Or, instead of checking at this point, turn eeprom_dirty into an array of bool the size of number
-    // of pages. Inside write_data, we set the flag to true at that time if something in that
-    // page changes...either way, something to look at later.
     FLASH_Unlock();
 
     #define ACCESS_FINISHED(TF) { FLASH_Lock(); eeprom_dirty = false; return TF; }
 
-    status = FLASH_ErasePage(EEPROM_PAGE0_BASE);
-    if (status != FLASH_COMPLETE) ACCESS_FINISHED(true);
-    status = FLASH_ErasePage(EEPROM_PAGE1_BASE);
-    if (status != FLASH_COMPLETE) ACCESS_FINISHED(true);
+    #if ENABLED(FLASH_EEPROM_LEVELING)
+
+      // Erase and fill the next slot, then commit it by writing its header
+      const uint8_t slot = current_slot < 0 ? 0 : (current_slot + 1) % (FLASH_EEPROM_SLOTS);
+      const uint32_t base = SLOT_ADDRESS(slot);
+      for (uint32_t page = 0; page < MARLIN_EEPROM_SIZE; page += EEPROM_PAGE_SIZE) {
+        status = FLASH_ErasePage(base + page);
+        if (status != FLASH_COMPLETE) ACCESS_FINISHED(false);
+      }
+
+      const uint16_t *source = reinterpret_cast<const uint16_t*>(ram_eeprom);
+      for (size_t i = 0; i < capacity(); i += 2, ++source) {
+        if (FLASH_ProgramHalfWord(base + SLOT_HEADER_SIZE + i, *source) != FLASH_COMPLETE)
+          ACCESS_FINISHED(false);
+      }
 
-    const uint16_t *source = reinterpret_cast<const uint16_t*>(ram_eeprom);
-    for (size_t i = 0; i < MARLIN_EEPROM_SIZE; i += 2, ++source) {
-      if (FLASH_ProgramHalfWord(EEPROM_PAGE0_BASE + i, *source) != FLASH_COMPLETE)
+      const uint16_t seq = current_seq + 1;
+      if (FLASH_ProgramHalfWord(base, seq) != FLASH_COMPLETE || FLASH_ProgramHalfWord(base + 2, ~seq) != FLASH_COMPLETE)
         ACCESS_FINISHED(false);
-    }
+
+      current_slot = slot;
+      current_seq = seq;
+
+    #else
+
+      // Instead of erasing all (both) pages, maybe in the loop we check what page we are in, and if the
+      // data has changed in that page. We then erase the first time we "detect" a change. In theory, if
+      // nothing changed in a page, we wouldn't need to erase/write it.
+      // Or, instead of checking at this point, turn eeprom_dirty into an array of bool the size of number
+      // of pages. Inside write_data, we set the flag to true at that time if something in that
+      // page changes...either way, something to look at later.
+
+      status = FLASH_ErasePage(EEPROM_PAGE0_BASE);
+      if (status != FLASH_COMPLETE) ACCESS_FINISHED(true);
+      status = FLASH_ErasePage(EEPROM_PAGE1_BASE);
+      if (status != FLASH_COMPLETE) ACCESS_FINISHED(true);
+
+      const uint16_t *source = reinterpret_cast<const uint16_t*>(ram_eeprom);
+      for (size_t i = 0; i < MARLIN_EEPROM_SIZE; i += 2, ++source) {
+        if (FLASH_ProgramHalfWord(EEPROM_PAGE0_BASE + i, *source) != FLASH_COMPLETE)
+          ACCESS_FINISHED(false);
+      }
+
+    #endif
 
     ACCESS_FINISHED(true);
   }
@@ -93,9 +181,14 @@ bool PersistentStore::access_finish() {
   return true;
 }
 
+// Only flag changed data, so saving unchanged settings doesn't erase flash
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
-  for (size_t i = 0; i < size; ++i) ram_eeprom[pos + i] = value[i];
-  eeprom_dirty = true;
+  for (size_t i = 0; i < size; ++i) {
+    if (ram_eeprom[pos + i] != value[i]) {
+      ram_eeprom[pos + i] = value[i];
+      eeprom_dirty = true;
+    }
+  }
   crc16(crc, value, size);
   pos += size;
   return false;  // return true for any error
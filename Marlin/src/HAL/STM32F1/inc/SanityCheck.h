@@ -55,3 +55,7 @@
 #if ENABLED(NEOPIXEL_LED)
   #error "NEOPIXEL_LED (Adafruit NeoPixel) is not supported for HAL/STM32F1. Comment out this line to proceed at your own risk!"
 #endif
+
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  #error "TFT_DOUBLE_BUFFER requires DMA transfers to the TFT, not available for HAL/STM32F1."
+#endif
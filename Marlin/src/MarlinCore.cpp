@@ -669,6 +669,58 @@ inline void manage_inactivity(const bool ignore_stepper_queue=false) {
   #endif
 }
 
+#if ENABLED(MARLIN_DEV_MODE)
+  static void log_current_ms(PGM_P const msg) {
+    SERIAL_ECHO_START();
+    SERIAL_CHAR('['); SERIAL_ECHO(millis()); SERIAL_ECHOPGM("] ");
+    serialprintPGM(msg);
+    SERIAL_EOL();
+  }
+  #define SETUP_LOG(M) log_current_ms(PSTR(M))
+#else
+  #define SETUP_LOG(...) NOOP
+#endif
+
+#if ENABLED(BOOT_PROFILER)
+  // Report the time taken by one startup stage
+  static void log_setup_us(PGM_P const msg, const uint32_t us) {
+    SERIAL_ECHO_START();
+    serialprintPGM(msg);
+    SERIAL_ECHOLNPAIR(" : ", us, "us");
+  }
+  #define SETUP_RUN(C) do{ SETUP_LOG(STRINGIFY(C)); const uint32_t _us = micros(); C; log_setup_us(PSTR(STRINGIFY(C)), micros() - _us); }while(0)
+#else
+  #define SETUP_RUN(C) do{ SETUP_LOG(STRINGIFY(C)); C; }while(0)
+#endif
+
+#if ENABLED(DEFERRED_INIT)
+
+  /**
+   * Startup stages that aren't needed to take commands or run the heaters.
+   * Run from idle() one at a time. The bootscreen comes first so the
+   * others run while it's up. Slow stages wait until no commands are waiting.
+   */
+  static void deferred_setup() {
+    static uint8_t stage; // = 0
+    switch (stage) {
+      case 0:
+        #if HAS_SPI_LCD && ENABLED(SHOW_BOOTSCREEN)
+          SETUP_RUN(ui.show_bootscreen()); // Drawn without waiting. ui.update() clears it when it times out.
+        #endif
+        break;
+      case 1:
+        if (queue.has_commands_queued()) return;
+        #if HAS_TRINAMIC_CONFIG && DISABLED(PSU_DEFAULT_OFF)
+          SETUP_RUN(test_tmc_connection(true, true, true, true));
+        #endif
+        break;
+      default: return;
+    }
+    stage++;
+  }
+
+#endif
+
 /**
  * Standard idle routine keeps the machine alive:
  *  - Core Marlin activities
@@ -705,6 +757,9 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   // Return if setup() isn't completed
   if (marlin_state == MF_INITIALIZING) return;
 
+  // Finish startup stages that were left out of setup()
+  TERN_(DEFERRED_INIT, deferred_setup());
+
   // Handle filament runout sensors
   TERN_(HAS_FILAMENT_SENSOR, runout.run());
 
@@ -729,6 +784,9 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   // Handle SD Card insert / remove
   TERN_(SDSUPPORT, card.manage_media());
 
+  // Index the SD working directory for the menus
+  TERN_(SD_DIR_INDEX, card.index_task());
+
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, Sd2Card::idle());
 
@@ -884,18 +942,7 @@ void stop() {
  */
 void setup() {
 
-  #if ENABLED(MARLIN_DEV_MODE)
-    auto log_current_ms = [&](PGM_P const msg) {
-      SERIAL_ECHO_START();
-      SERIAL_CHAR('['); SERIAL_ECHO(millis()); SERIAL_ECHOPGM("] ");
-      serialprintPGM(msg);
-      SERIAL_EOL();
-    };
-    #define SETUP_LOG(M) log_current_ms(PSTR(M))
-  #else
-    #define SETUP_LOG(...) NOOP
-  #endif
-  #define SETUP_RUN(C) do{ SETUP_LOG(STRINGIFY(C)); C; }while(0)
+  TERN_(BOOT_PROFILER, const millis_t setup_ms = millis());
 
   #if EITHER(DISABLE_DEBUG, DISABLE_JTAG)
     // Disable any hardware debug to free up pins for IO
@@ -1014,7 +1061,7 @@ void setup() {
     DWIN_UpdateLCD();     // Show bootscreen (first image)
   #else
     SETUP_RUN(ui.init());
-    #if HAS_SPI_LCD && ENABLED(SHOW_BOOTSCREEN)
+    #if HAS_SPI_LCD && ENABLED(SHOW_BOOTSCREEN) && DISABLED(DEFERRED_INIT)
       SETUP_RUN(ui.show_bootscreen());
     #endif
     SETUP_RUN(ui.reset_status());     // Load welcome message early. (Retained if no errors exist.)
@@ -1182,7 +1229,7 @@ void setup() {
     SETUP_RUN(host_action_prompt_end());
   #endif
 
-  #if HAS_TRINAMIC_CONFIG && DISABLED(PSU_DEFAULT_OFF)
+  #if HAS_TRINAMIC_CONFIG && DISABLED(PSU_DEFAULT_OFF) && DISABLED(DEFERRED_INIT)
     SETUP_RUN(test_tmc_connection(true, true, true, true));
   #endif
 
@@ -1228,6 +1275,7 @@ void setup() {
   marlin_state = MF_RUNNING;
 
   SETUP_LOG("setup() completed.");
+  TERN_(BOOT_PROFILER, SERIAL_ECHO_MSG("setup() completed in ", millis() - setup_ms, "ms"));
 }
 
 /**
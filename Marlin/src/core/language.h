@@ -235,6 +235,14 @@
 #define STR_KI                              " Ki: "
 #define STR_KD                              " Kd: "
 #define STR_PID_AUTOTUNE_FINISHED           "PID Autotune finished! Put the last Kp, Ki and Kd constants from below into Configuration.h"
+#define STR_MPC_AUTOTUNE_START              "MPC Autotune start"
+#define STR_MPC_COOLING_TO_AMBIENT          "Cooling to ambient"
+#define STR_MPC_HEATING_PAST_200            "Heating to over 200C"
+#define STR_MPC_MEASURING_AMBIENT           "Measuring ambient heat loss at "
+#define STR_MPC_TEMP_TOO_HIGH               "MPC Autotune failed! Temperature too high"
+#define STR_MPC_TIMEOUT                     "MPC Autotune failed! timeout"
+#define STR_MPC_AUTOTUNE_INTERRUPTED        "MPC Autotune interrupted!"
+#define STR_MPC_AUTOTUNE_FINISHED           "MPC Autotune finished! Put the constants below into Configuration.h"
 #define STR_PID_DEBUG                       " PID_DEBUG "
 #define STR_PID_DEBUG_INPUT                 ": Input "
 #define STR_PID_DEBUG_OUTPUT                " Output "
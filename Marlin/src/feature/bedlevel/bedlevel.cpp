@@ -133,7 +133,7 @@ void reset_bed_level() {
       bilinear_grid_spacing.reset();
       GRID_LOOP(x, y) {
         z_values[x][y] = NAN;
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, 0));
+        TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(x, y, 0));
       }
     #elif ABL_PLANAR
       planner.bed_level_matrix.set_to_identity();
@@ -51,7 +51,7 @@
     z_offset = 0;
     ZERO(z_values);
     #if ENABLED(EXTENSIBLE_UI)
-      GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, 0);
+      GRID_LOOP(x, y) ExtUI::postMeshUpdate(x, y, 0);
     #endif
   }
 
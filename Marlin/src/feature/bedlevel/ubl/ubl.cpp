@@ -96,7 +96,7 @@
     storage_slot = -1;
     ZERO(z_values);
     #if ENABLED(EXTENSIBLE_UI)
-      GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, 0);
+      GRID_LOOP(x, y) ExtUI::postMeshUpdate(x, y, 0);
     #endif
     if (was_enabled) report_current_position();
   }
@@ -109,7 +109,7 @@
   void unified_bed_leveling::set_all_mesh_points_to_value(const float value) {
     GRID_LOOP(x, y) {
       z_values[x][y] = value;
-      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, value));
+      TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(x, y, value));
     }
   }
 
@@ -347,7 +347,7 @@
             break;            // No more invalid Mesh Points to populate
           }
           z_values[cpos.x][cpos.y] = NAN;
-          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(cpos, 0.0f));
+          TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(cpos, 0.0f));
           cnt++;
         }
       }
@@ -374,7 +374,7 @@
             const float p1 = 0.5f * (GRID_MAX_POINTS_X) - x,
                         p2 = 0.5f * (GRID_MAX_POINTS_Y) - y;
             z_values[x][y] += 2.0f * HYPOT(p1, p2);
-            TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+            TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(x, y, z_values[x][y]));
           }
           break;
 
@@ -383,8 +383,8 @@
             z_values[x][x] += 9.999f;
             z_values[x][x + (x < (GRID_MAX_POINTS_Y) - 1) ? 1 : -1] += 9.999f; // We want the altered line several mesh points thick
             #if ENABLED(EXTENSIBLE_UI)
-              ExtUI::onMeshUpdate(x, x, z_values[x][x]);
-              ExtUI::onMeshUpdate(x, (x + (x < (GRID_MAX_POINTS_Y) - 1) ? 1 : -1), z_values[x][x + (x < (GRID_MAX_POINTS_Y) - 1) ? 1 : -1]);
+              ExtUI::postMeshUpdate(x, x, z_values[x][x]);
+              ExtUI::postMeshUpdate(x, (x + (x < (GRID_MAX_POINTS_Y) - 1) ? 1 : -1), z_values[x][x + (x < (GRID_MAX_POINTS_Y) - 1) ? 1 : -1]);
             #endif
 
           }
@@ -395,7 +395,7 @@
           for (uint8_t x = (GRID_MAX_POINTS_X) / 3; x < 2 * (GRID_MAX_POINTS_X) / 3; x++)     // Create a rectangular raised area in
             for (uint8_t y = (GRID_MAX_POINTS_Y) / 3; y < 2 * (GRID_MAX_POINTS_Y) / 3; y++) { // the center of the bed
               z_values[x][y] += parser.seen('C') ? g29_constant : 9.99f;
-              TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+              TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(x, y, z_values[x][y]));
             }
           break;
       }
@@ -536,7 +536,7 @@
                 }
                 else {
                   z_values[cpos.x][cpos.y] = g29_constant;
-                  TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(cpos, g29_constant));
+                  TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(cpos, g29_constant));
                 }
               }
             }
@@ -710,7 +710,7 @@
       GRID_LOOP(x, y)
         if (!isnan(z_values[x][y])) {
           z_values[x][y] -= mean + value;
-          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+          TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(x, y, z_values[x][y]));
         }
   }
 
@@ -718,7 +718,7 @@
     GRID_LOOP(x, y)
       if (!isnan(z_values[x][y])) {
         z_values[x][y] += g29_constant;
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+        TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(x, y, z_values[x][y]));
       }
   }
 
@@ -760,15 +760,15 @@
           : find_closest_mesh_point_of_type(INVALID, near, true);
 
         if (best.pos.x >= 0) {    // mesh point found and is reachable by probe
-          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::PROBE_START));
+          TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(best.pos, ExtUI::PROBE_START));
           const float measured_z = probe.probe_at_point(
                         best.meshpos(),
                         stow_probe ? PROBE_PT_STOW : PROBE_PT_RAISE, g29_verbose_level
                       );
           z_values[best.pos.x][best.pos.y] = measured_z;
           #if ENABLED(EXTENSIBLE_UI)
-            ExtUI::onMeshUpdate(best.pos, ExtUI::PROBE_FINISH);
-            ExtUI::onMeshUpdate(best.pos, measured_z);
+            ExtUI::postMeshUpdate(best.pos, ExtUI::PROBE_FINISH);
+            ExtUI::postMeshUpdate(best.pos, measured_z);
           #endif
         }
         SERIAL_FLUSH(); // Prevent host M105 buffer overrun.
@@ -917,7 +917,7 @@
         }
 
         z_values[lpos.x][lpos.y] = current_position.z - thick;
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(location, z_values[lpos.x][lpos.y]));
+        TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(location, z_values[lpos.x][lpos.y]));
 
         if (g29_verbose_level > 2)
           SERIAL_ECHOLNPAIR_F("Mesh Point Measured at: ", z_values[lpos.x][lpos.y], 6);
@@ -1014,7 +1014,7 @@
         if (click_and_hold(abort_fine_tune)) break;         // Button held down? Abort editing
 
         z_values[lpos.x][lpos.y] = new_z;                   // Save the updated Z value
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(location, new_z));
+        TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(location, new_z));
 
         serial_delay(20);                                   // No switch noise
         ui.refresh();
@@ -1290,7 +1290,7 @@
         const float v2 = z_values[dx + xdir][dy + ydir];
         if (!isnan(v2)) {
           z_values[x][y] = v1 < v2 ? v1 : v1 + v1 - v2;
-          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+          TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(x, y, z_values[x][y]));
           return true;
         }
       }
@@ -1521,7 +1521,7 @@
         }
 
         z_values[i][j] = mz - lsf_results.D;
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(i, j, z_values[i][j]));
+        TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(i, j, z_values[i][j]));
       }
 
       if (DEBUGGING(LEVELING)) {
@@ -1617,7 +1617,7 @@
             }
             const float ez = -lsf_results.D - lsf_results.A * ppos.x - lsf_results.B * ppos.y;
             z_values[ix][iy] = ez;
-            TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ix, iy, z_values[ix][iy]));
+            TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(ix, iy, z_values[ix][iy]));
             idle(); // housekeeping
           }
         }
@@ -1758,7 +1758,7 @@
 
       GRID_LOOP(x, y) {
         z_values[x][y] -= tmp_z_values[x][y];
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+        TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(x, y, z_values[x][y]));
       }
     }
 
@@ -49,9 +49,18 @@ inline int bs_read_serial(const uint8_t index) {
   return -1;
 }
 
+#define BS_ACK_WINDOW    TERN(BINARY_STREAM_PIPELINE, BINARY_STREAM_ACK_WINDOW, 1)
+
 #if ENABLED(BINARY_STREAM_COMPRESSION)
   static heatshrink_decoder hsd;
-  static uint8_t decode_buffer[512] = {};
+#endif
+
+#if ENABLED(BINARY_STREAM_PIPELINE)
+  // Incoming (decoded) data is staged here so the card only gets whole-block writes
+  static uint8_t write_buffer[BINARY_STREAM_BUFFER_BLOCKS * 512] = {};
+#elif ENABLED(BINARY_STREAM_COMPRESSION)
+  // Decoded data only, uncompressed packets go straight to the card
+  static uint8_t write_buffer[512] = {};
 #endif
 
 class SDFileTransferProtocol  {
@@ -86,6 +95,16 @@ private:
     return true;
   }
 
+  #if EITHER(BINARY_STREAM_PIPELINE, BINARY_STREAM_COMPRESSION)
+    // Write out the staged data. Since the file starts empty every full buffer lands
+    // on a block boundary, so the card sees a single multiple-block write.
+    static bool flush_buffer() {
+      if (data_waiting && !dummy_transfer && card.write(write_buffer, data_waiting) < 0) return false;
+      data_waiting = 0;
+      return true;
+    }
+  #endif
+
   static bool file_write(char* buffer, const size_t length) {
     #if ENABLED(BINARY_STREAM_COMPRESSION)
       if (compression) {
@@ -96,31 +115,33 @@ private:
           heatshrink_decoder_sink(&hsd, reinterpret_cast<uint8_t*>(&buffer[total_processed]), length - total_processed, &processed_count);
           total_processed += processed_count;
           do {
-            presult = heatshrink_decoder_poll(&hsd, &decode_buffer[data_waiting], sizeof(decode_buffer) - data_waiting, &processed_count);
+            presult = heatshrink_decoder_poll(&hsd, &write_buffer[data_waiting], sizeof(write_buffer) - data_waiting, &processed_count);
             data_waiting += processed_count;
-            if (data_waiting == sizeof(decode_buffer)) {
-              if (!dummy_transfer)
-                if (card.write(decode_buffer, data_waiting) < 0) {
-                  return false;
-                }
-              data_waiting = 0;
-            }
+            if (data_waiting == sizeof(write_buffer) && !flush_buffer()) return false;
           } while (presult == HSDR_POLL_MORE);
         }
         return true;
       }
     #endif
-    return (dummy_transfer || card.write(buffer, length) >= 0);
+    #if ENABLED(BINARY_STREAM_PIPELINE)
+      size_t total_processed = 0, processed_count;
+      while (total_processed < length) {
+        processed_count = _MIN(length - total_processed, sizeof(write_buffer) - data_waiting);
+        memcpy(&write_buffer[data_waiting], &buffer[total_processed], processed_count);
+        total_processed += processed_count;
+        data_waiting += processed_count;
+        if (data_waiting == sizeof(write_buffer) && !flush_buffer()) return false;
+      }
+      return true;
+    #else
+      return (dummy_transfer || card.write(buffer, length) >= 0);
+    #endif
   }
 
   static bool file_close() {
     if (!dummy_transfer) {
-      #if ENABLED(BINARY_STREAM_COMPRESSION)
-        // flush any buffered data
-        if (data_waiting) {
-          if (card.write(decode_buffer, data_waiting) < 0) return false;
-          data_waiting = 0;
-        }
+      #if EITHER(BINARY_STREAM_PIPELINE, BINARY_STREAM_COMPRESSION)
+        if (!flush_buffer()) return false; // flush any buffered data
       #endif
       card.closefile();
       card.release();
@@ -131,6 +152,7 @@ private:
   }
 
   static void transfer_abort() {
+    data_waiting = 0;
     if (!dummy_transfer) {
       card.closefile();
       card.removeFile(card.filename);
@@ -148,6 +170,8 @@ private:
 
 public:
 
+  static bool is_data(const uint8_t packet_type) { return static_cast<FileTransfer>(packet_type) == FileTransfer::WRITE; }
+
   static void idle() {
     // If a transfer is interrupted and a file is left open, abort it after TIMEOUT ms
     const millis_t ms = millis();
@@ -269,6 +293,14 @@ public:
     sync = 0;
     packet_retries = 0;
     buffer_next_index = 0;
+    unacked = 0;
+  }
+
+  // Acknowledge every packet processed so far with one 'ok' for the last of them
+  void ack_pending() {
+    if (!unacked) return;
+    SERIAL_ECHOLNPAIR("ok", uint8_t(sync - 1));
+    unacked = 0;
   }
 
   // fletchers 16 checksum
@@ -312,7 +344,7 @@ public:
           packet.reset();
           stream_state = StreamState::PACKET_WAIT;
         case StreamState::PACKET_WAIT:
-          if (!stream_read(data)) { idle(); return; }  // no active packet so don't wait
+          if (!stream_read(data)) { ack_pending(); idle(); return; }  // no active packet so don't wait
           packet.header.data[1] = data;
           if (packet.header.token == packet.header.HEADER_TOKEN) {
             packet.bytes_received = 2;
@@ -337,7 +369,11 @@ public:
             if (packet.header.checksum == packet.header_checksum) {
               // The SYNC control packet is a special case in that it doesn't require the stream sync to be correct
               if (static_cast<Protocol>(packet.header.protocol()) == Protocol::CONTROL && static_cast<ProtocolControl>(packet.header.type()) == ProtocolControl::SYNC) {
-                  SERIAL_ECHOLNPAIR("ss", sync, ",", buffer_size, ",", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH);
+                  SERIAL_ECHOPAIR("ss", sync, ",", buffer_size, ",", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH);
+                  #if BS_ACK_WINDOW > 1
+                    SERIAL_ECHOPAIR(",", BS_ACK_WINDOW);
+                  #endif
+                  SERIAL_EOL();
                   stream_state = StreamState::PACKET_RESET;
                   break;
               }
@@ -351,8 +387,9 @@ public:
                 else
                   stream_state = StreamState::PACKET_PROCESS;
               }
-              else if (packet.header.sync == sync - 1) {           // ok response must have been lost
-                SERIAL_ECHOLNPAIR("ok", packet.header.sync);  // transmit valid packet received and drop the payload
+              else if (uint8_t(sync - packet.header.sync) <= BS_ACK_WINDOW) { // ok response must have been lost
+                unacked = 1;
+                ack_pending();                                // re-acknowledge what was received and drop the payload
                 stream_state = StreamState::PACKET_RESET;
               }
               else if (packet_retries) {
@@ -410,7 +447,12 @@ public:
           packet_retries = 0;
           bytes_received += packet.header.size;
 
-          SERIAL_ECHOLNPAIR("ok", packet.header.sync); // transmit valid packet received
+          // transmit valid packet received, holding back acks for file data until the window fills
+          ++unacked;
+          if (unacked >= BS_ACK_WINDOW
+            || static_cast<Protocol>(packet.header.protocol()) != Protocol::FILE_TRANSFER
+            || !SDFileTransferProtocol::is_data(packet.header.type())
+          ) ack_pending();
           dispatch();
           stream_state = StreamState::PACKET_RESET;
           break;
@@ -465,7 +507,7 @@ public:
   }
 
   static const uint16_t PACKET_MAX_WAIT = 500, RX_TIMESLICE = 20, MAX_RETRIES = 0, VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0;
-  uint8_t  packet_retries, sync;
+  uint8_t  packet_retries, sync, unacked;
   uint16_t buffer_next_index;
   uint32_t bytes_received;
   StreamState stream_state = StreamState::PACKET_RESET;
@@ -44,6 +44,13 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::dwin_flag; // = false
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  bool PrintJobRecovery::journal_base_valid; // = false
+  uint32_t PrintJobRecovery::journal_seq; // = 0
+  uint16_t PrintJobRecovery::journal_crc;
+  #include "../libs/crc16.h"
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/ultralcd.h"
 #include "../gcode/queue.h"
@@ -80,7 +87,10 @@ PrintJobRecovery recovery;
 /**
  * Clear the recovery info
  */
-void PrintJobRecovery::init() { memset(&info, 0, sizeof(info)); }
+void PrintJobRecovery::init() {
+  memset(&info, 0, sizeof(info));
+  TERN_(POWER_LOSS_JOURNAL, journal_base_valid = false); // Write the whole info next time
+}
 
 /**
  * Enable or disable then call changed()
@@ -132,6 +142,7 @@ void PrintJobRecovery::load() {
   if (exists()) {
     open(true);
     (void)file.read(&info, sizeof(info));
+    TERN_(POWER_LOSS_JOURNAL, if (valid()) replay());
     close();
   }
   debug(PSTR("Load"));
@@ -143,6 +154,7 @@ void PrintJobRecovery::load() {
 void PrintJobRecovery::prepare() {
   card.getAbsFilename(info.sd_filename);  // SD filename
   cmd_sdpos = 0;
+  TERN_(POWER_LOSS_JOURNAL, journal_base_valid = false);
 }
 
 /**
@@ -311,12 +323,144 @@ void PrintJobRecovery::write() {
   debug(PSTR("Write"));
 
   open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    // Append a record unless the file is new or more than the journaled fields changed
+    const uint16_t crc = base_checksum();
+    if (journal_base_valid && crc == journal_crc && file.fileSize() >= PLR_JOURNAL_END)
+      append_record();
+    else
+      write_base(crc);
+  #else
+    file.seekSet(0);
+    const int16_t ret = file.write(&info, sizeof(info));
+    if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+  #endif
+
   if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
 }
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  /**
+   * Checksum the info with the journaled fields cleared,
+   * to tell when the whole info has to be written again
+   */
+  uint16_t PrintJobRecovery::base_checksum() {
+    job_recovery_info_t base = info;
+    base.valid_head = base.valid_foot = 0;
+    base.sdpos = 0;
+    base.print_job_elapsed = 0;
+    base.current_position.reset();
+    base.zraise = 0;
+    base.feedrate = 0;
+    base.axis_relative = 0;
+    #if EXTRUDERS > 1
+      base.active_extruder = 0;
+    #endif
+    #if HAS_HOTEND
+      ZERO(base.target_temperature);
+    #endif
+    TERN_(HAS_HEATED_BED, base.target_temperature_bed = 0);
+    #if HAS_FAN
+      ZERO(base.fan_speed);
+    #endif
+    uint16_t crc = 0;
+    crc16(&crc, &base, sizeof(base));
+    return crc;
+  }
+
+  /**
+   * Write the whole info and clear the ring after it. The ring is cleared
+   * first so a power loss in between can't pair old records with new info.
+   * Once the file has its full size this rewrites blocks in place.
+   */
+  void PrintJobRecovery::write_base(const uint16_t crc) {
+    const job_journal_record_t blank{0};
+    file.writeError = false;
+    const bool sized = file.fileSize() >= PLR_JOURNAL_END;
+    if (sized) file.seekSet(PLR_JOURNAL_START);
+    else { file.seekSet(0); file.write(&info, sizeof(info)); }
+    while (file.curPosition() < PLR_JOURNAL_END)
+      file.write(&blank, _MIN(uint32_t(sizeof(blank)), PLR_JOURNAL_END - file.curPosition()));
+    if (sized) {
+      file.sync();
+      file.seekSet(0);
+      file.write(&info, sizeof(info));
+    }
+    journal_base_valid = !file.writeError;
+    if (!journal_base_valid) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+    journal_crc = crc;
+    journal_seq = 0;  // The first record gets seq 1
+  }
+
+  /**
+   * Write the fields that change during a print into the next ring slot
+   */
+  void PrintJobRecovery::append_record() {
+    job_journal_record_t rec{0};
+    rec.seq = ++journal_seq;
+    rec.sdpos = info.sdpos;
+    rec.print_job_elapsed = info.print_job_elapsed;
+    rec.current_position = info.current_position;
+    rec.zraise = info.zraise;
+    rec.feedrate = info.feedrate;
+    rec.axis_relative = info.axis_relative;
+    #if EXTRUDERS > 1
+      rec.active_extruder = info.active_extruder;
+    #endif
+    #if HAS_HOTEND
+      COPY(rec.target_temperature, info.target_temperature);
+    #endif
+    TERN_(HAS_HEATED_BED, rec.target_temperature_bed = info.target_temperature_bed);
+    #if HAS_FAN
+      COPY(rec.fan_speed, info.fan_speed);
+    #endif
+    crc16(&rec.crc, &rec, offsetof(job_journal_record_t, crc));
+
+    const uint32_t slot = (journal_seq - 1) % (POWER_LOSS_JOURNAL_SLOTS);
+    if (!file.seekSet(PLR_JOURNAL_START + slot * PLR_RECORD_SIZE) || file.write(&rec, sizeof(rec)) < 0)
+      DEBUG_ECHOLNPGM("Power-loss file write failed.");
+  }
+
+  /**
+   * Apply the newest intact record to the loaded info.
+   * The next save after this writes the whole info again.
+   */
+  void PrintJobRecovery::replay() {
+    journal_base_valid = false;
+    if (file.fileSize() < PLR_JOURNAL_END || !file.seekSet(PLR_JOURNAL_START)) return;
+    job_journal_record_t rec, best{0};
+    LOOP_L_N(i, POWER_LOSS_JOURNAL_SLOTS) {
+      if (file.read(&rec, sizeof(rec)) != sizeof(rec)) break;
+      if (sizeof(rec) < PLR_RECORD_SIZE) file.seekCur(PLR_RECORD_SIZE - sizeof(rec));
+      uint16_t crc = 0;
+      crc16(&crc, &rec, offsetof(job_journal_record_t, crc));
+      if (rec.seq > best.seq && crc == rec.crc) best = rec;
+    }
+    if (!best.seq) return;
+
+    info.sdpos = best.sdpos;
+    info.print_job_elapsed = best.print_job_elapsed;
+    info.current_position = best.current_position;
+    info.zraise = best.zraise;
+    info.feedrate = best.feedrate;
+    info.axis_relative = best.axis_relative;
+    #if EXTRUDERS > 1
+      info.active_extruder = best.active_extruder;
+    #endif
+    #if HAS_HOTEND
+      COPY(info.target_temperature, best.target_temperature);
+    #endif
+    TERN_(HAS_HEATED_BED, info.target_temperature_bed = best.target_temperature_bed);
+    #if HAS_FAN
+      COPY(info.fan_speed, best.fan_speed);
+    #endif
+    DEBUG_ECHOLNPAIR("Power-loss journal record ", best.seq);
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
 /**
  * Resume the saved print job
  */
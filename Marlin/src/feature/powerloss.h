@@ -113,6 +113,40 @@ typedef struct {
 
 } job_recovery_info_t;
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  // The parts of job_recovery_info_t that change as the print goes on
+  typedef struct {
+    uint32_t seq;             // Newest record wins. Zero is never written.
+    uint32_t sdpos;
+    millis_t print_job_elapsed;
+    xyze_pos_t current_position;
+    float zraise;
+    uint16_t feedrate;
+    uint8_t axis_relative;
+    #if EXTRUDERS > 1
+      uint8_t active_extruder;
+    #endif
+    #if HAS_HOTEND
+      int16_t target_temperature[HOTENDS];
+    #endif
+    #if HAS_HEATED_BED
+      int16_t target_temperature_bed;
+    #endif
+    #if HAS_FAN
+      uint8_t fan_speed[FAN_COUNT];
+    #endif
+    uint16_t crc;             // Of everything above
+  } job_journal_record_t;
+
+  #define PLR_RECORD_SIZE   64
+  #define PLR_JOURNAL_START ((sizeof(job_recovery_info_t) + 511) & ~511UL)  // The ring starts in the block after the info
+  #define PLR_JOURNAL_END   (PLR_JOURNAL_START + (POWER_LOSS_JOURNAL_SLOTS) * PLR_RECORD_SIZE)
+
+  static_assert(sizeof(job_journal_record_t) <= PLR_RECORD_SIZE, "job_journal_record_t must fit in PLR_RECORD_SIZE.");
+
+#endif
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -184,6 +218,16 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static bool journal_base_valid; //!< The whole info has been written and records may follow it
+      static uint32_t journal_seq;    //!< Sequence number of the last record written since the info
+      static uint16_t journal_crc;    //!< Checksum of the unjournaled part of the info last written
+      static uint16_t base_checksum();
+      static void write_base(const uint16_t crc);
+      static void append_record();
+      static void replay();
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const float &zraise);
     #endif
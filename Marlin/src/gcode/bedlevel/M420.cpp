@@ -73,7 +73,7 @@ void GcodeSuite::M420() {
       #endif
       GRID_LOOP(x, y) {
         Z_VALUES(x, y) = 0.001 * random(-200, 200);
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, Z_VALUES(x, y)));
+        TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(x, y, Z_VALUES(x, y)));
       }
       SERIAL_ECHOPGM("Simulated " STRINGIFY(GRID_MAX_POINTS_X) "x" STRINGIFY(GRID_MAX_POINTS_Y) " mesh ");
       SERIAL_ECHOPAIR(" (", x_min);
@@ -176,7 +176,7 @@ void GcodeSuite::M420() {
             // Subtract the mean from all values
             GRID_LOOP(x, y) {
               Z_VALUES(x, y) -= zmean;
-              TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, Z_VALUES(x, y)));
+              TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(x, y, Z_VALUES(x, y)));
             }
             TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
           }
@@ -59,7 +59,7 @@ void GcodeSuite::M421() {
       LOOP_S_LE_N(x, sx, ex) {
         LOOP_S_LE_N(y, sy, ey) {
           z_values[x][y] = zval + (hasQ ? z_values[x][y] : 0);
-          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+          TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(x, y, z_values[x][y]));
         }
       }
       TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
@@ -63,7 +63,7 @@ void GcodeSuite::M421() {
   else {
     float &zval = ubl.z_values[ij.x][ij.y];
     zval = hasN ? NAN : parser.value_linear_units() + (hasQ ? zval : 0);
-    TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ij.x, ij.y, zval));
+    TERN_(EXTENSIBLE_UI, ExtUI::postMeshUpdate(ij.x, ij.y, zval));
   }
 }
 
@@ -30,6 +30,7 @@
 #include "../../lcd/ultralcd.h"
 
 #include "../../feature/bedlevel/bedlevel.h"
+#include "../../libs/stats.h"
 
 #if HAS_LEVELING
   #include "../../module/planner.h"
@@ -40,7 +41,7 @@
  *
  * Usage:
  *   M48 <P#> <X#> <Y#> <V#> <E> <L#> <S>
- *     P = Number of sampled points (4-50, default 10)
+ *     P = Number of sampled points (4 or more, default 10)
  *     X = Sample X position
  *     Y = Sample Y position
  *     V = Verbose level (0-4, default=1)
@@ -66,9 +67,9 @@ void GcodeSuite::M48() {
   if (verbose_level > 0)
     SERIAL_ECHOLNPGM("M48 Z-Probe Repeatability Test");
 
-  const int8_t n_samples = parser.byteval('P', 10);
-  if (!WITHIN(n_samples, 4, 50)) {
-    SERIAL_ECHOLNPGM("?Sample size not plausible (4-50).");
+  const uint16_t n_samples = parser.ushortval('P', 10);
+  if (n_samples < 4) {
+    SERIAL_ECHOLNPGM("?Sample size not plausible (4 or more).");
     return;
   }
 
@@ -112,24 +113,20 @@ void GcodeSuite::M48() {
   // Work with reasonable feedrates
   remember_feedrate_scaling_off();
 
-  // Working variables
-  float mean = 0.0,     // The average of all points so far, used to calculate deviation
-        sigma = 0.0,    // Standard deviation of all points so far
-        min = 99999.9,  // Smallest value sampled so far
-        max = -99999.9, // Largest value sampled so far
-        sample_set[n_samples];  // Storage for sampled values
+  // Mean, sigma, min and max of all samples so far, updated as each sample arrives
+  RunningStats stats;
 
-  auto dev_report = [](const bool verbose, const float &mean, const float &sigma, const float &min, const float &max, const bool final=false) {
+  auto dev_report = [](const bool verbose, const RunningStats &stats, const bool final=false) {
     if (verbose) {
-      SERIAL_ECHOPAIR_F("Mean: ", mean, 6);
-      if (!final) SERIAL_ECHOPAIR_F(" Sigma: ", sigma, 6);
-      SERIAL_ECHOPAIR_F(" Min: ", min, 3);
-      SERIAL_ECHOPAIR_F(" Max: ", max, 3);
-      SERIAL_ECHOPAIR_F(" Range: ", max-min, 3);
+      SERIAL_ECHOPAIR_F("Mean: ", stats.mean(), 6);
+      if (!final) SERIAL_ECHOPAIR_F(" Sigma: ", stats.sigma(), 6);
+      SERIAL_ECHOPAIR_F(" Min: ", stats.lowest(), 3);
+      SERIAL_ECHOPAIR_F(" Max: ", stats.highest(), 3);
+      SERIAL_ECHOPAIR_F(" Range: ", stats.range(), 3);
       if (final) SERIAL_EOL();
     }
     if (final) {
-      SERIAL_ECHOLNPAIR_F("Standard Deviation: ", sigma, 6);
+      SERIAL_ECHOLNPAIR_F("Standard Deviation: ", stats.sigma(), 6);
       SERIAL_EOL();
     }
   };
@@ -141,9 +138,7 @@ void GcodeSuite::M48() {
   if (probing_good) {
     randomSeed(millis());
 
-    float sample_sum = 0.0;
-
-    LOOP_L_N(n, n_samples) {
+    for (uint16_t n = 0; n < n_samples; n++) {
       #if HAS_SPI_LCD
         // Display M48 progress in the status bar
         ui.status_printf_P(0, PSTR(S_FMT ": %d/%d"), GET_TEXT(MSG_M48_POINT), int(n + 1), int(n_samples));
@@ -224,28 +219,15 @@ void GcodeSuite::M48() {
       probing_good = !isnan(pz);
       if (!probing_good) break;
 
-      // Store the new sample
-      sample_set[n] = pz;
-
-      // Keep track of the largest and smallest samples
-      NOMORE(min, pz);
-      NOLESS(max, pz);
-
-      // Get the mean value of all samples thus far
-      sample_sum += pz;
-      mean = sample_sum / (n + 1);
-
-      // Calculate the standard deviation so far.
-      // The value after the last sample will be the final output.
-      float dev_sum = 0.0;
-      LOOP_LE_N(j, n) dev_sum += sq(sample_set[j] - mean);
-      sigma = SQRT(dev_sum / (n + 1));
+      // Update the mean, standard deviation, min and max.
+      // The values after the last sample will be the final output.
+      stats.add(pz);
 
       if (verbose_level > 1) {
         SERIAL_ECHO(n + 1);
         SERIAL_ECHOPAIR(" of ", int(n_samples));
         SERIAL_ECHOPAIR_F(": z: ", pz, 3);
-        dev_report(verbose_level > 2, mean, sigma, min, max);
+        dev_report(verbose_level > 2, stats);
         SERIAL_EOL();
       }
 
@@ -256,12 +238,12 @@ void GcodeSuite::M48() {
 
   if (probing_good) {
     SERIAL_ECHOLNPGM("Finished!");
-    dev_report(verbose_level > 0, mean, sigma, min, max, true);
+    dev_report(verbose_level > 0, stats, true);
 
     #if HAS_SPI_LCD
       // Display M48 results in the status bar
       char sigma_str[8];
-      ui.status_printf_P(0, PSTR(S_FMT ": %s"), GET_TEXT(MSG_M48_DEVIATION), dtostrf(sigma, 2, 6, sigma_str));
+      ui.status_printf_P(0, PSTR(S_FMT ": %s"), GET_TEXT(MSG_M48_DEVIATION), dtostrf(stats.sigma(), 2, 6, sigma_str));
     #endif
   }
 
@@ -74,7 +74,7 @@ void GcodeSuite::M1000() {
       #else
         recovery.cancel();
       #endif
-      TERN_(EXTENSIBLE_UI, ExtUI::onPrintTimerStopped());
+      TERN_(EXTENSIBLE_UI, ExtUI::postPrintTimerStopped());
     }
     else
       recovery.resume();
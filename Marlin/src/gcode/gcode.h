@@ -90,7 +90,7 @@
  * M16  - Expected printer check. (Requires EXPECTED_PRINTER_CHECK)
  * M17  - Enable/Power all stepper motors
  * M18  - Disable all stepper motors; same as M84
- * M20  - List SD card. (Requires SDSUPPORT)
+ * M20  - List SD card. "M20 L" adds long paths, "M20 T" adds timestamps. (Requires SDSUPPORT)
  * M21  - Init SD card. (Requires SDSUPPORT)
  * M22  - Release SD card. (Requires SDSUPPORT)
  * M23  - Select SD file: "M23 /path/file.gco". (Requires SDSUPPORT)
@@ -197,6 +197,7 @@
  * M303 - PID relay autotune S<temperature> sets the target temperature. Default 150C. (Requires PIDTEMP)
  * M304 - Set bed PID parameters P I and D. (Requires PIDTEMPBED)
  * M305 - Set user thermistor parameters R T and P. (Requires TEMP_SENSOR_x 1000)
+ * M306 - Set or tune the hotend Model Predictive Control constants. T to autotune. (Requires MPCTEMP)
  * M350 - Set microstepping mode. (Requires digital microstepping pins.)
  * M351 - Toggle MS1 MS2 pins directly. (Requires digital microstepping pins.)
  * M355 - Set Case Light on/off and set brightness. (Requires CASE_LIGHT_PIN)
@@ -282,6 +283,7 @@
  * M993 - Backup SPI Flash to SD
  * M994 - Load a Backup from SD to SPI Flash
  * M995 - Touch screen calibration for TFT display
+ * M996 - Report the emulated TFT counters and save the framebuffer. (HAL/LINUX with a Color UI display)
  * M997 - Perform in-application firmware update
  * M999 - Restart after being stopped by error
  *
@@ -702,6 +704,8 @@ private:
 
   TERN_(HAS_USER_THERMISTORS, static void M305());
 
+  TERN_(MPCTEMP, static void M306());
+
   #if HAS_MICROSTEPS
     static void M350();
     static void M351();
@@ -861,6 +865,8 @@ private:
 
   TERN_(TOUCH_SCREEN_CALIBRATION, static void M995());
 
+  TERN_(HAS_TFT_FRAMEBUFFER, static void M996());
+
   #if BOTH(HAS_SPI_FLASH, SDSUPPORT)
     static void M993();
     static void M994();
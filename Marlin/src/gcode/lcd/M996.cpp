@@ -0,0 +1,66 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if HAS_TFT_FRAMEBUFFER
+
+#include "../gcode.h"
+#include "../../lcd/ultralcd.h"
+#include "../../lcd/tft/tft.h"
+
+/**
+ * M996: Report and reset the emulated TFT counters (HAL/LINUX)
+ *
+ *  S<count> - Benchmark: Redraw the current screen this many times, then
+ *             report the time taken and the counters for the redraws only
+ *  filename - Also save the framebuffer as a PPM image, e.g. for comparison
+ *             with a reference image. Example: M996 /tmp/screen.ppm
+ */
+void GcodeSuite::M996() {
+
+  tft.queue.sync();
+
+  if (parser.seenval('S')) {
+    const uint16_t count = parser.value_ushort();
+    TFT_Framebuffer::pixels = TFT_Framebuffer::transfers = 0;
+    const uint32_t start_us = micros();
+    LOOP_L_N(i, count) {
+      ui.refresh(LCDVIEW_CALL_REDRAW_NEXT);
+      ui.run_current_screen();
+      tft.queue.sync();
+    }
+    const uint32_t elapsed_us = micros() - start_us;
+    SERIAL_ECHO_START();
+    SERIAL_ECHOLNPAIR("TFT redraws:", count, " us:", elapsed_us, " us/redraw:", count ? elapsed_us / count : 0);
+  }
+
+  SERIAL_ECHO_START();
+  SERIAL_ECHOLNPAIR("TFT pixels:", TFT_Framebuffer::pixels, " transfers:", TFT_Framebuffer::transfers);
+  TFT_Framebuffer::pixels = TFT_Framebuffer::transfers = 0;
+
+  if (parser.string_arg && !TFT_Framebuffer::save(parser.string_arg))
+    SERIAL_ERROR_MSG("Can't write ", parser.string_arg);
+
+}
+
+#endif // HAS_TFT_FRAMEBUFFER
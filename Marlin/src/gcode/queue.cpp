@@ -562,31 +562,72 @@ void GCodeQueue::get_serial_commands() {
     if (!IS_SD_PRINTING()) return;
 
     int sd_count = 0;
-    bool card_eof = card.eof();
-    while (length < BUFSIZE && !card_eof) {
-      const int16_t n = card.get();
-      card_eof = card.eof();
-      if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
-
-      const char sd_char = (char)n;
-      const bool is_eol = ISEOL(sd_char);
-      if (is_eol || card_eof) {
-
-        // Reset stream state, terminate the buffer, and commit a non-empty command
-        if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
+
+    #if ENABLED(SD_READAHEAD)
+
+      while (length < BUFSIZE) {
+        const char *buf;
+        const uint16_t avail = card.peekBuffer(buf);
+        if (!avail) {
+          if (!card.eof()) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+
+          // Commit a final line with no newline
+          if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
+            _commit_command(false);
+            TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+          }
+          card.fileHasFinished();                       // Handle end of file reached
+          return;
+        }
+
+        // Find the end of the line within the buffered data
+        const char *eol = (const char*)memchr(buf, '\n', avail);
+        const uint16_t span = eol ? eol - buf : avail;
+        const char * const cr = (const char*)memchr(buf, '\r', span);
+        const uint16_t len = cr ? cr - buf : span;
+        if (cr) eol = cr;
+
+        for (uint16_t i = 0; i < len && sd_input_state != PS_EOL; ++i)
+          process_stream_char(buf[i], sd_input_state, command_buffer[index_w], sd_count);
+
+        if (!eol) { card.consume(len); continue; }      // Line continues in the next block
+
+        card.consume(len + 1);
         if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
           _commit_command(false);
-          #if ENABLED(POWER_LOSS_RECOVERY)
-            recovery.cmd_sdpos = card.getIndex();     // Prime for the NEXT _commit_command
-          #endif
+          TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex()); // Prime for the NEXT _commit_command
         }
+      }
+
+    #else
+
+      bool card_eof = card.eof();
+      while (length < BUFSIZE && !card_eof) {
+        const int16_t n = card.get();
+        card_eof = card.eof();
+        if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+
+        const char sd_char = (char)n;
+        const bool is_eol = ISEOL(sd_char);
+        if (is_eol || card_eof) {
+
+          // Reset stream state, terminate the buffer, and commit a non-empty command
+          if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
+          if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
+            _commit_command(false);
+            #if ENABLED(POWER_LOSS_RECOVERY)
+              recovery.cmd_sdpos = card.getIndex();     // Prime for the NEXT _commit_command
+            #endif
+          }
+
+          if (card_eof) card.fileHasFinished();         // Handle end of file reached
+        }
+        else
+          process_stream_char(sd_char, sd_input_state, command_buffer[index_w], sd_count);
 
-        if (card_eof) card.fileHasFinished();         // Handle end of file reached
       }
-      else
-        process_stream_char(sd_char, sd_input_state, command_buffer[index_w], sd_count);
 
-    }
+    #endif // !SD_READAHEAD
   }
 
 #endif // SDSUPPORT
@@ -29,10 +29,20 @@
 
 /**
  * M20: List SD card to serial output
+ *
+ * Parameters:
+ *   L  Append the long path of each file (Requires LONG_FILENAME_HOST_SUPPORT)
+ *   T  Append the FAT modification date and time as hex (Requires M20_TIMESTAMP_SUPPORT)
+ *
+ * Output:
+ *   /MISCEL~1/ARMCHA~1.GCO 12345 0x52A16B40 /Miscellaneous/Armchair.gcode
  */
 void GcodeSuite::M20() {
   SERIAL_ECHOLNPGM(STR_BEGIN_FILE_LIST);
-  card.ls();
+  card.ls(
+    TERN0(LONG_FILENAME_HOST_SUPPORT, parser.seen('L')) * LS_LONG_FILENAME
+    | TERN0(M20_TIMESTAMP_SUPPORT, parser.seen('T')) * LS_TIMESTAMP
+  );
   SERIAL_ECHOLNPGM(STR_END_FILE_LIST);
 }
 
@@ -31,6 +31,7 @@
  * M27: Get SD Card status
  *      OR, with 'S<seconds>' set the SD status auto-report interval. (Requires AUTO_REPORT_SD_STATUS)
  *      OR, with 'C' get the current filename.
+ *      OR, with 'B' get the block cache statistics. (Requires SD_CACHE_STATS)
  */
 void GcodeSuite::M27() {
   if (parser.seen('C')) {
@@ -38,6 +39,11 @@ void GcodeSuite::M27() {
     card.printFilename();
   }
 
+  #if ENABLED(SD_CACHE_STATS)
+    else if (parser.seen('B'))
+      card.report_cache_stats();
+  #endif
+
   #if ENABLED(AUTO_REPORT_SD_STATUS)
     else if (parser.seenval('S'))
       card.set_auto_report_interval(parser.value_byte());
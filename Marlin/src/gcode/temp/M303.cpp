@@ -65,7 +65,7 @@ void GcodeSuite::M303() {
   const heater_ind_t e = (heater_ind_t)parser.intval('E');
   if (!WITHIN(e, SI, EI)) {
     SERIAL_ECHOLNPGM(STR_PID_BAD_EXTRUDER_NUM);
-    TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_BAD_EXTRUDER_NUM));
+    TERN_(EXTENSIBLE_UI, ExtUI::postPidTuning(ExtUI::result_t::PID_BAD_EXTRUDER_NUM));
     return;
   }
 
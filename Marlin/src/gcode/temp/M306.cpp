@@ -0,0 +1,86 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MPCTEMP)
+
+#include "../gcode.h"
+#include "../../lcd/ultralcd.h"
+#include "../../module/temperature.h"
+#include "../../module/planner.h"
+
+/**
+ * M306: Set or tune the hotend Model Predictive Control constants
+ *
+ *  E<extruder>  Extruder to set or tune. (Default: E0)
+ *
+ *  P<watts>     Heater power
+ *  C<J/K>       Heater block heat capacity
+ *  R<K/s/K>     Sensor responsiveness
+ *  A<W/K>       Heat loss to ambient with the fan off
+ *  F<W/K>       Heat loss to ambient with the fan at full speed
+ *  H<J/K/mm>    Filament heat capacity per mm
+ *
+ * With MPC_AUTOTUNE:
+ *  T            Autotune the model for the given extruder.
+ *               Cools the hotend to ambient first, so it takes a few minutes.
+ */
+void GcodeSuite::M306() {
+  const uint8_t e = parser.byteval('E');
+  if (e >= HOTENDS) {
+    SERIAL_ERROR_MSG(STR_INVALID_EXTRUDER);
+    return;
+  }
+
+  #if ENABLED(MPC_AUTOTUNE)
+    if (parser.seen('T')) {
+      planner.synchronize();
+      #if DISABLED(BUSY_WHILE_HEATING)
+        KEEPALIVE_STATE(NOT_BUSY);
+      #endif
+      ui.set_status(GET_TEXT(MSG_MPC_AUTOTUNE));
+      thermalManager.MPC_autotune(e);
+      ui.reset_status();
+      return;
+    }
+  #endif
+
+  MPC_t &constants = thermalManager.temp_hotend[e].constants;
+  if (parser.seenval('P')) constants.heater_power = parser.value_float();
+  if (parser.seenval('C')) constants.block_heat_capacity = parser.value_float();
+  if (parser.seenval('R')) constants.sensor_responsiveness = parser.value_float();
+  if (parser.seenval('A')) constants.ambient_xfer_coeff_fan0 = parser.value_float();
+  if (parser.seenval('F')) constants.ambient_xfer_coeff_fan255 = parser.value_float();
+  if (parser.seenval('H')) constants.filament_heat_capacity_permm = parser.value_float();
+
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPAIR(" e:", e);
+  SERIAL_ECHOPAIR_F(" p:", constants.heater_power, 2);
+  SERIAL_ECHOPAIR_F(" c:", constants.block_heat_capacity, 2);
+  SERIAL_ECHOPAIR_F(" r:", constants.sensor_responsiveness, 4);
+  SERIAL_ECHOPAIR_F(" a:", constants.ambient_xfer_coeff_fan0, 4);
+  SERIAL_ECHOPAIR_F(" f:", constants.ambient_xfer_coeff_fan255, 4);
+  SERIAL_ECHOLNPAIR_F(" h:", constants.filament_heat_capacity_permm, 4);
+}
+
+#endif // MPCTEMP
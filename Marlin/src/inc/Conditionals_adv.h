@@ -38,6 +38,7 @@
   #undef TEMP_SENSOR_7
   #undef FWRETRACT
   #undef PIDTEMP
+  #undef MPCTEMP
   #undef AUTOTEMP
   #undef PID_EXTRUSION_SCALING
   #undef LIN_ADVANCE
@@ -385,6 +386,28 @@
   #define SD_CONNECTION_IS(...) 0
 #endif
 
+// SD block cache size by available RAM
+#if BOTH(SDSUPPORT, SD_BLOCK_CACHE)
+  #ifndef SD_CACHE_SLOTS
+    #ifdef __AVR__
+      #define SD_CACHE_SLOTS 2
+    #else
+      #define SD_CACHE_SLOTS 6
+    #endif
+  #endif
+  #ifndef SD_FAT_CACHE_SLOTS
+    #ifdef __AVR__
+      #define SD_FAT_CACHE_SLOTS 1
+    #else
+      #define SD_FAT_CACHE_SLOTS 2
+    #endif
+  #endif
+#else
+  #undef SD_CACHE_SLOTS
+  #undef SD_FAT_CACHE_SLOTS
+  #undef SD_CACHE_STATS
+#endif
+
 // Power Monitor sensors
 #if EITHER(POWER_MONITOR_CURRENT, POWER_MONITOR_VOLTAGE)
   #define HAS_POWER_MONITOR 1
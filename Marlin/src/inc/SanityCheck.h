@@ -716,6 +716,59 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "LIGHTWEIGHT_UI requires a U8GLIB_ST7920-based display."
 #endif
 
+/**
+ * Graphical LCD page budget
+ */
+#if ENABLED(DOGM_PAGE_BUDGET)
+  #if !HAS_GRAPHICAL_LCD
+    #error "DOGM_PAGE_BUDGET requires a graphical (DOGM) LCD."
+  #elif !WITHIN(DOGM_PAGE_MIN_PLANNED, 1, BLOCK_BUFFER_SIZE - 1)
+    #error "DOGM_PAGE_MIN_PLANNED must be between 1 and BLOCK_BUFFER_SIZE - 1."
+  #endif
+#endif
+
+/**
+ * DWIN draw command options
+ */
+#if ENABLED(DWIN_SKIP_UNCHANGED) && !WITHIN(DWIN_SKIP_UNCHANGED_SIZE, 1, 255)
+  #error "DWIN_SKIP_UNCHANGED_SIZE must be between 1 and 255."
+#endif
+
+/**
+ * DGUS write cache
+ */
+#if ENABLED(DGUS_WRITE_CACHE)
+  #if !HAS_DGUS_LCD
+    #error "DGUS_WRITE_CACHE requires a DGUS LCD."
+  #elif !WITHIN(DGUS_WRITE_CACHE_SIZE, 1, 255)
+    #error "DGUS_WRITE_CACHE_SIZE must be between 1 and 255."
+  #elif !WITHIN(DGUS_WRITE_BATCH_SIZE, 2, 248)
+    #error "DGUS_WRITE_BATCH_SIZE must be between 2 and 248."
+  #endif
+#endif
+
+/**
+ * Extensible UI event queue
+ */
+#if ENABLED(EXTUI_EVENT_QUEUE)
+  #if !WITHIN(EXTUI_EVENT_QUEUE_SIZE, 2, 255)
+    #error "EXTUI_EVENT_QUEUE_SIZE must be between 2 and 255."
+  #elif !WITHIN(EXTUI_EVENT_BUDGET_MS, 1, 100)
+    #error "EXTUI_EVENT_BUDGET_MS must be between 1 and 100."
+  #endif
+#endif
+
+/**
+ * Touch UI command buffer
+ */
+#ifdef TOUCH_UI_CMD_BUFFER_SIZE
+  #if DISABLED(TOUCH_UI_FTDI_EVE)
+    #error "TOUCH_UI_CMD_BUFFER_SIZE requires TOUCH_UI_FTDI_EVE."
+  #elif !WITHIN(TOUCH_UI_CMD_BUFFER_SIZE, 16, 4092) || TOUCH_UI_CMD_BUFFER_SIZE % 4
+    #error "TOUCH_UI_CMD_BUFFER_SIZE must be a multiple of 4 between 16 and 4092."
+  #endif
+#endif
+
 /**
  * SD File Sorting
  */
@@ -743,6 +796,64 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+#if ENABLED(SD_READAHEAD) && !WITHIN(SD_READAHEAD_BLOCKS, 1, 16)
+  #error "SD_READAHEAD_BLOCKS must be between 1 and 16."
+#endif
+
+#if ENABLED(SD_DIR_INDEX)
+  #if !WITHIN(SD_DIR_INDEX_LIMIT, 1, 4096)
+    #error "SD_DIR_INDEX_LIMIT must be between 1 and 4096."
+  #elif !WITHIN(SD_DIR_INDEX_BATCH, 1, 255)
+    #error "SD_DIR_INDEX_BATCH must be between 1 and 255."
+  #endif
+#endif
+
+#if ENABLED(POWER_LOSS_JOURNAL) && !WITHIN(POWER_LOSS_JOURNAL_SLOTS, 8, 255)
+  #error "POWER_LOSS_JOURNAL_SLOTS must be between 8 and 255."
+#endif
+
+#if ENABLED(TFT_CANVAS_CACHE) && !WITHIN(TFT_CANVAS_CACHE_SIZE, 1, 255)
+  #error "TFT_CANVAS_CACHE_SIZE must be from 1 to 255."
+#endif
+
+#if ENABLED(TFT_GLYPH_CACHE)
+  #if !WITHIN(TFT_GLYPH_CACHE_SIZE, 1, 255)
+    #error "TFT_GLYPH_CACHE_SIZE must be from 1 to 255."
+  #elif !WITHIN(TFT_GLYPH_CACHE_RUNS, 1, 255)
+    #error "TFT_GLYPH_CACHE_RUNS must be from 1 to 255."
+  #endif
+#endif
+
+#if ENABLED(SD_WRITE_BEHIND)
+  #if !WITHIN(SD_WRITE_BEHIND_BLOCKS, 1, 16)
+    #error "SD_WRITE_BEHIND_BLOCKS must be between 1 and 16."
+  #elif defined(SD_WRITE_PREALLOCATE) && !WITHIN(SD_WRITE_PREALLOCATE, 1, 255)
+    #error "SD_WRITE_PREALLOCATE must be between 1 and 255."
+  #endif
+#endif
+
+#if ENABLED(SD_FILE_EXTENTS) && !WITHIN(SD_FILE_EXTENTS_MAX, 1, 64)
+  #error "SD_FILE_EXTENTS_MAX must be between 1 and 64."
+#endif
+
+#if ENABLED(BINARY_STREAM_PIPELINE)
+  #if !WITHIN(BINARY_STREAM_ACK_WINDOW, 1, 16)
+    #error "BINARY_STREAM_ACK_WINDOW must be between 1 and 16."
+  #elif !WITHIN(BINARY_STREAM_BUFFER_BLOCKS, 1, 8)
+    #error "BINARY_STREAM_BUFFER_BLOCKS must be between 1 and 8."
+  #elif !WITHIN(BINARY_STREAM_WINDOW_BITS, 8, 12)
+    #error "BINARY_STREAM_WINDOW_BITS must be between 8 and 12."
+  #endif
+#endif
+
+#if ENABLED(SD_BLOCK_CACHE)
+  #if !WITHIN(SD_CACHE_SLOTS, 1, 16)
+    #error "SD_CACHE_SLOTS must be between 1 and 16."
+  #elif !WITHIN(SD_FAT_CACHE_SLOTS, 0, 8)
+    #error "SD_FAT_CACHE_SLOTS must be between 0 and 8."
+  #endif
+#endif
+
 #if defined(EVENT_GCODE_SD_ABORT) && DISABLED(NOZZLE_PARK_FEATURE)
   static_assert(nullptr == strstr(EVENT_GCODE_SD_ABORT, "G27"), "NOZZLE_PARK_FEATURE is required to use G27 in EVENT_GCODE_SD_ABORT.");
 #endif
@@ -1140,6 +1251,20 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "To use BED_LIMIT_SWITCHING you must disable PIDTEMPBED."
 #endif
 
+/**
+ * Hotend Heating Options - PID vs Model Predictive Control
+ */
+#if ENABLED(MPCTEMP)
+  #if ENABLED(PIDTEMP)
+    #error "To use MPCTEMP you must disable PIDTEMP."
+  #elif ENABLED(PID_OPENLOOP)
+    #error "MPCTEMP is incompatible with PID_OPENLOOP."
+  #elif !WITHIN(MPC_MAX, 1, 255)
+    #error "MPC_MAX must be from 1 to 255."
+  #endif
+  static_assert(WITHIN(MPC_SMOOTHING_FACTOR, 0, 1), "MPC_SMOOTHING_FACTOR must be from 0.0 to 1.0.");
+#endif
+
 /**
  * Kinematics
  */
@@ -1354,6 +1479,12 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "Z_PROBE_LOW_POINT must be less than or equal to 0."
   #endif
 
+  #if ENABLED(PROBE_TRAVEL_SHORT_RAISE) && ENABLED(BLTOUCH) && DISABLED(BLTOUCH_HS_MODE)
+    #error "PROBE_TRAVEL_SHORT_RAISE requires BLTOUCH_HS_MODE with BLTOUCH."
+  #elif ENABLED(PROBE_TRAVEL_SHORT_RAISE) && HAS_Z_SERVO_PROBE && DISABLED(BLTOUCH)
+    #error "PROBE_TRAVEL_SHORT_RAISE is not compatible with a Z Servo probe."
+  #endif
+
   #if HOMING_Z_WITH_PROBE && IS_CARTESIAN && DISABLED(Z_SAFE_HOMING)
     #error "Z_SAFE_HOMING is recommended when homing with a probe. Enable it or comment out this line to continue."
   #endif
@@ -1367,6 +1498,10 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "Auto Bed Leveling requires one of these: PROBE_MANUALLY, SENSORLESS_PROBING, BLTOUCH, FIX_MOUNTED_PROBE, NOZZLE_AS_PROBE, TOUCH_MI_PROBE, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, or a Z Servo."
   #endif
 
+  #if ENABLED(PROBE_TRAVEL_OVERLAP)
+    #error "PROBE_TRAVEL_OVERLAP requires a bed probe."
+  #endif
+
   #if ENABLED(Z_MIN_PROBE_REPEATABILITY_TEST)
     #error "Z_MIN_PROBE_REPEATABILITY_TEST requires a probe: FIX_MOUNTED_PROBE, NOZZLE_AS_PROBE, BLTOUCH, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, or Z Servo."
   #endif
@@ -3096,6 +3231,20 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "ESP3D_WIFISUPPORT or WIFISUPPORT requires an ESP32 controller."
 #endif
 
+/**
+ * Thermistor lookup tables use too much RAM for AVR
+ */
+#if ENABLED(THERMISTOR_LUT) && defined(__AVR__)
+  #error "THERMISTOR_LUT requires a 32-bit board."
+#endif
+
+/**
+ * Sanity check for ADC DMA sampling
+ */
+#if ENABLED(ADC_DMA_SAMPLING) && (DISABLED(ARDUINO_ARCH_STM32) || defined(STM32GENERIC))
+  #error "ADC_DMA_SAMPLING requires an STM32F4 or STM32F7 controller (STM32 HAL)."
+#endif
+
 /**
  * Sanity Check for Password Feature
  */
@@ -964,9 +964,63 @@ static int pf_bsearch_cb_comp_hd4map_pgm(void *userdata, size_t idx, void * data
   return hd44780_charmap_compare(&localval, (hd44780_charmap_t *)data_pin);
 }
 
-void lcd_moveto(const lcd_uint_t col, const lcd_uint_t row) { lcd.setCursor(col, row); }
+#if ENABLED(LCD_SKIP_UNCHANGED)
+
+  /**
+   * Each character costs a slow bus transfer, but most of a redraw is the
+   * same as what's already shown. Keep a copy of the screen and only send
+   * characters that changed, moving the cursor first if any were skipped.
+   */
+  static uint8_t lcd_shadow[LCD_HEIGHT][LCD_WIDTH];
+  static lcd_uint_t shadow_col, shadow_row;
+  static bool shadow_valid,   // Set when the display is cleared
+              cursor_moved;   // The display cursor isn't at shadow_col/row
+
+  void lcd_shadow_clear() {
+    memset(lcd_shadow, ' ', sizeof(lcd_shadow));
+    shadow_col = shadow_row = 0;
+    shadow_valid = true;
+    cursor_moved = false;
+  }
+
+  void lcd_moveto(const lcd_uint_t col, const lcd_uint_t row) {
+    shadow_col = col;
+    shadow_row = row;
+    cursor_moved = true;
+  }
+
+  static void lcd_write(const uint8_t c) {
+    const lcd_uint_t col = shadow_col++;
+    if (shadow_row < LCD_HEIGHT && col < LCD_WIDTH) {
+      uint8_t &s = lcd_shadow[shadow_row][col];
+      if (shadow_valid && s == c) { cursor_moved = true; return; }
+      s = c;
+    }
+    else
+      shadow_valid = false;   // Off the edge, where the display may wrap. Resume after the next clear.
+
+    if (cursor_moved) {
+      lcd.setCursor(col, shadow_row);
+      cursor_moved = false;
+    }
+    lcd.write(c);
+  }
 
-void lcd_put_int(const int i) { lcd.print(i); }
+  void lcd_put_int(const int i) {
+    char buf[12];  // "-2147483648"
+    sprintf_P(buf, PSTR("%d"), i);
+    for (const char *p = buf; *p; ++p) lcd_write(*p);
+  }
+
+#else
+
+  void lcd_moveto(const lcd_uint_t col, const lcd_uint_t row) { lcd.setCursor(col, row); }
+
+  void lcd_put_int(const int i) { lcd.print(i); }
+
+  #define lcd_write(C) lcd.write(C)
+
+#endif
 
 // return < 0 on error
 // return the advanced cols
@@ -984,7 +1038,7 @@ int lcd_put_wchar_max(wchar_t c, pixel_len_t max_length) {
 
   // TODO: fix the '\\' that doesnt exist in the HD44870
   if (c < 128) {
-    lcd.write((uint8_t)c);
+    lcd_write((uint8_t)c);
     return 1;
   }
   copy_address = nullptr;
@@ -1001,16 +1055,16 @@ int lcd_put_wchar_max(wchar_t c, pixel_len_t max_length) {
     hd44780_charmap_t localval;
     // found
     memcpy_P(&localval, copy_address, sizeof(localval));
-    lcd.write(localval.idx);
+    lcd_write(localval.idx);
     if (max_length >= 2 && localval.idx2 > 0) {
-      lcd.write(localval.idx2);
+      lcd_write(localval.idx2);
       return 2;
     }
     return 1;
   }
 
   // Not found, print '?' instead
-  lcd.write((uint8_t)'?');
+  lcd_write((uint8_t)'?');
   return 1;
 }
 
@@ -363,7 +363,7 @@ void MarlinUI::init_lcd() {
 
   set_custom_characters(on_status_screen() ? CHARSET_INFO : CHARSET_MENU);
 
-  lcd.clear();
+  clear_lcd();
 }
 
 bool MarlinUI::detected() {
@@ -393,7 +393,10 @@ bool MarlinUI::detected() {
   }
 #endif
 
-void MarlinUI::clear_lcd() { lcd.clear(); }
+void MarlinUI::clear_lcd() {
+  lcd.clear();
+  TERN_(LCD_SKIP_UNCHANGED, lcd_shadow_clear());
+}
 
 #if ENABLED(SHOW_BOOTSCREEN)
 
@@ -440,11 +443,43 @@ void MarlinUI::clear_lcd() { lcd.clear(); }
   }
 
   void MarlinUI::show_bootscreen() {
+    #if ENABLED(DEFERRED_INIT)
+      // Called again when the bootscreen times out
+      static bool shown; // = false
+      if (shown) {
+        set_custom_characters(CHARSET_INFO);
+        return clear_lcd();
+      }
+      shown = true;
+    #endif
+
     set_custom_characters(CHARSET_BOOT);
-    lcd.clear();
+    clear_lcd();
 
     #define LCD_EXTRA_SPACE (LCD_WIDTH-8)
 
+    #if ENABLED(DEFERRED_INIT)
+
+      //
+      // Show the Marlin logo and one splash line, without scrolling,
+      // and leave them up until the bootscreen times out
+      //
+      #define CENTER_OR_CUT(STRING) \
+        lcd_put_u8str_max_P(_MAX(LCD_WIDTH - utf8_strlen_P(PSTR(STRING)), 0) / 2, 3, PSTR(STRING), LCD_WIDTH)
+
+      if (LCD_EXTRA_SPACE >= utf8_strlen(SHORT_BUILD_VERSION) + 1) {
+        logo_lines(PSTR(" " SHORT_BUILD_VERSION));
+        CENTER_OR_CUT(MARLIN_WEBSITE_URL);
+      }
+      else {
+        extern const char NUL_STR[];
+        logo_lines(NUL_STR);
+        CENTER_OR_CUT(SHORT_BUILD_VERSION);
+      }
+      return bootscreen_completion(BOOTSCREEN_TIMEOUT);
+
+    #endif
+
     #define CENTER_OR_SCROLL(STRING,DELAY) \
       lcd_erase_line(3); \
       if (utf8_strlen(STRING) <= LCD_WIDTH) { \
@@ -479,10 +514,10 @@ void MarlinUI::clear_lcd() { lcd.clear(); }
       #endif
     }
 
-    lcd.clear();
+    clear_lcd();
     safe_delay(100);
     set_custom_characters(CHARSET_INFO);
-    lcd.clear();
+    clear_lcd();
   }
 
 #endif // SHOW_BOOTSCREEN
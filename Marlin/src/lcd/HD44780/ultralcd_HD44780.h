@@ -100,3 +100,7 @@
 
 #include "../fontutils.h"
 #include "../lcdprint.h"
+
+#if ENABLED(LCD_SKIP_UNCHANGED)
+  void lcd_shadow_clear();
+#endif
@@ -156,7 +156,7 @@ bool MarlinUI::detected() { return true; }
       #ifndef CUSTOM_BOOTSCREEN_TIMEOUT
         #define CUSTOM_BOOTSCREEN_TIMEOUT 2500
       #endif
-      safe_delay(CUSTOM_BOOTSCREEN_TIMEOUT);
+      bootscreen_completion(CUSTOM_BOOTSCREEN_TIMEOUT);
     }
   #endif // SHOW_CUSTOM_BOOTSCREEN
 
@@ -228,8 +228,22 @@ bool MarlinUI::detected() { return true; }
   }
 
   void MarlinUI::show_bootscreen() {
-    TERN_(SHOW_CUSTOM_BOOTSCREEN, show_custom_bootscreen());
-    show_marlin_bootscreen();
+    #if ENABLED(DEFERRED_INIT)
+      // Draw one part per call. Called again each time a part times out.
+      static uint8_t part; // = 0
+      uint8_t p = part++;
+      #if ENABLED(SHOW_CUSTOM_BOOTSCREEN)
+        if (p-- == 0) return show_custom_bootscreen();
+      #endif
+      constexpr uint8_t pages = two_part ? 2 : 1;
+      if (p < pages) {
+        draw_marlin_bootscreen(p == pages - 1);
+        bootscreen_completion((BOOTSCREEN_TIMEOUT) / pages);
+      }
+    #else
+      TERN_(SHOW_CUSTOM_BOOTSCREEN, show_custom_bootscreen());
+      show_marlin_bootscreen();
+    #endif
   }
 
 #endif // SHOW_BOOTSCREEN
@@ -3347,6 +3347,9 @@ void DWIN_Update(void) {
   EachMomentUpdate();   // Status update
   HMI_SDCardUpdate();   // SD card update
   DWIN_HandleScreen();  // Rotary encoder update
+  #ifdef DWIN_BATCH_SIZE
+    DWIN_Flush();       // Send anything drawn without a screen update
+  #endif
 }
 
 void EachMomentUpdate(void) {
@@ -37,6 +37,10 @@
 #include "dwin_lcd.h"
 #include <string.h> // for memset
 
+#if ENABLED(DWIN_SKIP_UNCHANGED)
+  #include "../../libs/hash.h"
+#endif
+
 // Make sure DWIN_SendBuf is large enough to hold the largest
 // printed string plus the draw command and tail.
 uint8_t DWIN_SendBuf[11 + 24] = { 0xAA };
@@ -76,13 +80,122 @@ inline void DWIN_String(size_t &i, const __FlashStringHelper * string) {
   i += len;
 }
 
+#ifdef DWIN_BATCH_SIZE
+
+  static_assert(DWIN_BATCH_SIZE >= sizeof(DWIN_SendBuf) + sizeof(DWIN_BufTail), "DWIN_BATCH_SIZE is too small for the largest command.");
+
+  // Commands waiting for the next screen update
+  uint8_t DWIN_Batch[DWIN_BATCH_SIZE];
+  size_t DWIN_BatchLen = 0;
+
+  // Send the collected commands
+  void DWIN_Flush(void) {
+    for (size_t n = 0; n < DWIN_BatchLen; n++) MYSERIAL1.write(DWIN_Batch[n]);
+    DWIN_BatchLen = 0;
+  }
+
+#endif
+
+#if ENABLED(DWIN_SKIP_UNCHANGED)
+
+  // Text and numbers known to be on the screen
+  typedef struct { uint16_t x, y, w, h; uint32_t hash; } dwinDrawn_t;
+  dwinDrawn_t DWIN_Drawn[DWIN_SKIP_UNCHANGED_SIZE];
+  uint8_t DWIN_DrawnNext = 0;
+
+  // Forget the items in the area from (x1, y1) to (x2, y2)
+  void DWIN_Forget(const uint16_t x1, const uint16_t y1, const uint16_t x2, const uint16_t y2) {
+    LOOP_L_N(n, DWIN_SKIP_UNCHANGED_SIZE) {
+      dwinDrawn_t &d = DWIN_Drawn[n];
+      if (d.w && x1 < d.x + d.w && d.x <= x2 && y1 < d.y + d.h && d.y <= y2) d.w = 0;
+    }
+  }
+
+  // Check whether the command in the buffer draws text or a number exactly
+  // as it is already shown. Other drawing may cover text, so it's forgotten.
+  bool DWIN_Unchanged(const size_t len) {
+    static const uint8_t fontWidth[] PROGMEM = { 6, 8, 10, 12, 14, 16, 20, 24, 28, 32 };
+
+    #define SENT_WORD(N) uint16_t(DWIN_SendBuf[N] << 8 | DWIN_SendBuf[(N) + 1])
+
+    uint16_t x, y, chars;
+    switch (DWIN_SendBuf[1]) {
+      case 0x00: case 0x30: case 0x3D:    // Handshake, backlight, update don't draw
+        return false;
+      case 0x03:                          // Line
+        DWIN_Forget(_MIN(SENT_WORD(4), SENT_WORD(8)), _MIN(SENT_WORD(6), SENT_WORD(10)),
+                    _MAX(SENT_WORD(4), SENT_WORD(8)), _MAX(SENT_WORD(6), SENT_WORD(10)));
+        return false;
+      case 0x05:                          // Rectangle
+        DWIN_Forget(SENT_WORD(5), SENT_WORD(7), SENT_WORD(9), SENT_WORD(11));
+        return false;
+      case 0x09:                          // Area move
+        DWIN_Forget(SENT_WORD(7), SENT_WORD(9), SENT_WORD(11), SENT_WORD(13));
+        return false;
+      case 0x23:                          // Icon. The size is in the icon library, so assume it reaches the lower right corner.
+        DWIN_Forget(SENT_WORD(2), SENT_WORD(4), DWIN_WIDTH - 1, DWIN_HEIGHT - 1);
+        return false;
+      case 0x27:                          // Area copy
+        x = SENT_WORD(11);
+        y = SENT_WORD(13);
+        DWIN_Forget(x, y, x + SENT_WORD(7) - SENT_WORD(3), y + SENT_WORD(9) - SENT_WORD(5));
+        return false;
+      case 0x11:                          // String
+        x = SENT_WORD(7);
+        y = SENT_WORD(9);
+        chars = len - 11;
+        break;
+      case 0x14:                          // Number, with room for the point and a sign
+        x = SENT_WORD(9);
+        y = SENT_WORD(11);
+        chars = DWIN_SendBuf[7] + DWIN_SendBuf[8] + 2;
+        break;
+      default:                            // Clear, pictures, rotation may change the whole screen
+        ZERO(DWIN_Drawn);
+        return false;
+    }
+
+    #undef SENT_WORD
+
+    const uint8_t size = DWIN_SendBuf[2] & 0x0F;
+    if (size >= COUNT(fontWidth) || !chars) { ZERO(DWIN_Drawn); return false; }
+    const uint16_t w = chars * pgm_read_byte(&fontWidth[size]), h = pgm_read_byte(&fontWidth[size]) * 2;
+
+    const uint32_t hash = fnv1a(&DWIN_SendBuf[1], len - 1);
+
+    // The same item at the same place? Then the screen already shows it.
+    LOOP_L_N(n, DWIN_SKIP_UNCHANGED_SIZE) {
+      const dwinDrawn_t &d = DWIN_Drawn[n];
+      if (d.w && d.x == x && d.y == y && d.hash == hash) return true;
+    }
+
+    // Forget items this one draws over and remember it
+    DWIN_Forget(x, y, x + w - 1, y + h - 1);
+    DWIN_Drawn[DWIN_DrawnNext] = { x, y, w, h, hash };
+    if (++DWIN_DrawnNext == DWIN_SKIP_UNCHANGED_SIZE) DWIN_DrawnNext = 0;
+    return false;
+  }
+
+#endif
+
 // Send the data in the buffer and the packet end
 inline void DWIN_Send(size_t &i) {
   ++i;
-  LOOP_L_N(n, i) {  MYSERIAL1.write(DWIN_SendBuf[n]);
-                    delayMicroseconds(1); }
-  LOOP_L_N(n, 4) {  MYSERIAL1.write(DWIN_BufTail[n]);
-                    delayMicroseconds(1); }
+  #if ENABLED(DWIN_SKIP_UNCHANGED)
+    if (DWIN_Unchanged(i)) return;
+  #endif
+  #ifdef DWIN_BATCH_SIZE
+    if (DWIN_BatchLen + i + sizeof(DWIN_BufTail) > DWIN_BATCH_SIZE) DWIN_Flush();
+    memcpy(&DWIN_Batch[DWIN_BatchLen], DWIN_SendBuf, i);
+    DWIN_BatchLen += i;
+    memcpy(&DWIN_Batch[DWIN_BatchLen], DWIN_BufTail, sizeof(DWIN_BufTail));
+    DWIN_BatchLen += sizeof(DWIN_BufTail);
+  #else
+    LOOP_L_N(n, i) {  MYSERIAL1.write(DWIN_SendBuf[n]);
+                      delayMicroseconds(1); }
+    LOOP_L_N(n, 4) {  MYSERIAL1.write(DWIN_BufTail[n]);
+                      delayMicroseconds(1); }
+  #endif
 }
 
 /*-------------------------------------- System variable function --------------------------------------*/
@@ -92,6 +205,9 @@ bool DWIN_Handshake(void) {
   size_t i = 0;
   DWIN_Byte(i, 0x00);
   DWIN_Send(i);
+  #ifdef DWIN_BATCH_SIZE
+    DWIN_Flush();
+  #endif
 
   while (MYSERIAL1.available() > 0 && recnum < (signed)sizeof(databuf)) {
     databuf[recnum] = MYSERIAL1.read();
@@ -139,6 +255,9 @@ void DWIN_UpdateLCD(void) {
   size_t i = 0;
   DWIN_Byte(i, 0x3D);
   DWIN_Send(i);
+  #ifdef DWIN_BATCH_SIZE
+    DWIN_Flush();
+  #endif
 }
 
 /*---------------------------------------- Drawing functions ----------------------------------------*/
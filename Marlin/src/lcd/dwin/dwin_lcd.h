@@ -61,6 +61,11 @@ void DWIN_Frame_SetDir(uint8_t dir);
 /*更新显示*/
 void DWIN_UpdateLCD(void);
 
+#ifdef DWIN_BATCH_SIZE
+  // Send draw commands still waiting for a screen update
+  void DWIN_Flush(void);
+#endif
+
 /*----------------------------------------------绘图相关函数----------------------------------------------*/
 /*画面清屏 color:清屏颜色*/
 void DWIN_Frame_Clear(const uint16_t color);
@@ -48,6 +48,10 @@
 #include "DGUSVPVariable.h"
 #include "DGUSDisplayDef.h"
 
+#if ENABLED(DGUS_WRITE_CACHE)
+  #include "../../../../libs/hash.h"
+#endif
+
 // Preamble... 2 Bytes, usually 0x5A 0xA5, but configurable
 constexpr uint8_t DGUS_HEADER1 = 0x5A;
 constexpr uint8_t DGUS_HEADER2 = 0xA5;
@@ -55,6 +59,12 @@ constexpr uint8_t DGUS_HEADER2 = 0xA5;
 constexpr uint8_t DGUS_CMD_WRITEVAR = 0x82;
 constexpr uint8_t DGUS_CMD_READVAR = 0x83;
 
+#if ENABLED(DGUS_WRITE_CACHE)
+  // The frame length byte also counts the command and the VP address
+  constexpr uint8_t DGUS_MAX_PAYLOAD = 0xFF - 3;
+  static char payload[DGUS_MAX_PAYLOAD];
+#endif
+
 #if ENABLED(DEBUG_DGUSLCD)
   bool dguslcd_local_debug; // = false;
 #endif
@@ -81,16 +91,27 @@ void DGUSDisplay::InitDisplay() {
 void DGUSDisplay::WriteVariable(uint16_t adr, const void* values, uint8_t valueslen, bool isstr) {
   const char* myvalues = static_cast<const char*>(values);
   bool strend = !myvalues;
-  WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
-  while (valueslen--) {
+  #if ENABLED(DGUS_WRITE_CACHE)
+    NOMORE(valueslen, DGUS_MAX_PAYLOAD);
+  #else
+    WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
+  #endif
+  LOOP_L_N(i, valueslen) {
     char x;
     if (!strend) x = *myvalues++;
     if ((isstr && !x) || strend) {
       strend = true;
       x = ' ';
     }
-    dgusserial.write(x);
+    #if ENABLED(DGUS_WRITE_CACHE)
+      payload[i] = x;
+    #else
+      dgusserial.write(x);
+    #endif
   }
+  #if ENABLED(DGUS_WRITE_CACHE)
+    WriteCached(adr, payload, valueslen);
+  #endif
 }
 
 void DGUSDisplay::WriteVariable(uint16_t adr, uint16_t value) {
@@ -125,18 +146,100 @@ void DGUSDisplay::WriteVariable(uint16_t adr, long value) {
 void DGUSDisplay::WriteVariablePGM(uint16_t adr, const void* values, uint8_t valueslen, bool isstr) {
   const char* myvalues = static_cast<const char*>(values);
   bool strend = !myvalues;
-  WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
-  while (valueslen--) {
+  #if ENABLED(DGUS_WRITE_CACHE)
+    NOMORE(valueslen, DGUS_MAX_PAYLOAD);
+  #else
+    WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
+  #endif
+  LOOP_L_N(i, valueslen) {
     char x;
     if (!strend) x = pgm_read_byte(myvalues++);
     if ((isstr && !x) || strend) {
       strend = true;
       x = ' ';
     }
-    dgusserial.write(x);
+    #if ENABLED(DGUS_WRITE_CACHE)
+      payload[i] = x;
+    #else
+      dgusserial.write(x);
+    #endif
   }
+  #if ENABLED(DGUS_WRITE_CACHE)
+    WriteCached(adr, payload, valueslen);
+  #endif
 }
 
+#if ENABLED(DGUS_WRITE_CACHE)
+
+  DGUSDisplay::sentVP_t DGUSDisplay::sent[DGUS_WRITE_CACHE_SIZE];
+  uint8_t DGUSDisplay::sent_next = 0;
+  bool DGUSDisplay::batching = false;
+  uint16_t DGUSDisplay::batch_adr;
+  uint8_t DGUSDisplay::batch_len = 0, DGUSDisplay::batch[DGUS_WRITE_BATCH_SIZE];
+
+  void DGUSDisplay::WriteCached(uint16_t adr, const char *values, uint8_t valueslen) {
+    // System variables (below 0x1000) are commands, so they always go out in order
+    if (!batching || adr < 0x1000) {
+      FlushWrites();
+      WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
+      LOOP_L_N(i, valueslen) dgusserial.write(values[i]);
+      return;
+    }
+
+    // Skip a value identical to the last one sent to this VP
+    const uint32_t hash = fnv1a(values, valueslen, FNV1A_INIT ^ valueslen);
+
+    sentVP_t *slot = nullptr;
+    LOOP_L_N(i, DGUS_WRITE_CACHE_SIZE) if (sent[i].VP == adr) { slot = &sent[i]; break; }
+    if (slot) {
+      if (slot->hash == hash) return;
+    }
+    else {
+      slot = &sent[sent_next];
+      if (++sent_next == DGUS_WRITE_CACHE_SIZE) sent_next = 0;
+      slot->VP = adr;
+    }
+    slot->hash = hash;
+
+    // VPs are word addresses, so a write continues the pending one if it starts at the next word
+    if (!batch_len || TEST(batch_len, 0) || adr != batch_adr + batch_len / 2 || batch_len + valueslen > DGUS_WRITE_BATCH_SIZE) {
+      FlushWrites();
+      if (valueslen > DGUS_WRITE_BATCH_SIZE) {
+        WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
+        LOOP_L_N(i, valueslen) dgusserial.write(values[i]);
+        return;
+      }
+      batch_adr = adr;
+    }
+    memcpy(&batch[batch_len], values, valueslen);
+    batch_len += valueslen;
+  }
+
+  void DGUSDisplay::FlushWrites() {
+    if (!batch_len) return;
+    WriteHeader(batch_adr, DGUS_CMD_WRITEVAR, batch_len);
+    LOOP_L_N(i, batch_len) dgusserial.write(batch[i]);
+    batch_len = 0;
+  }
+
+  void DGUSDisplay::BeginWrites() { batching = true; }
+
+  void DGUSDisplay::EndWrites() {
+    FlushWrites();
+    batching = false;
+  }
+
+  void DGUSDisplay::ForgetWrites() {
+    LOOP_L_N(i, DGUS_WRITE_CACHE_SIZE) sent[i].VP = 0;
+  }
+
+  // The display changed a VP itself, so its value must be sent again
+  void DGUSDisplay::ForgetWrite(const uint16_t adr) {
+    LOOP_L_N(i, DGUS_WRITE_CACHE_SIZE) if (sent[i].VP == adr) sent[i].VP = 0;
+  }
+
+#endif // DGUS_WRITE_CACHE
+
 void DGUSDisplay::ProcessRx() {
 
   #if ENABLED(DGUS_SERIAL_STATS_RX_BUFFER_OVERRUNS)
@@ -207,6 +310,7 @@ void DGUSDisplay::ProcessRx() {
         |           Command          DataLen (in Words) */
         if (command == DGUS_CMD_READVAR) {
           const uint16_t vp = tmp[0] << 8 | tmp[1];
+          TERN_(DGUS_WRITE_CACHE, ForgetWrite(vp));
           //const uint8_t dlen = tmp[2] << 1;  // Convert to Bytes. (Display works with words)
           //DEBUG_ECHOPAIR(" vp=", vp, " dlen=", dlen);
           DGUS_VP_Variable ramcopy;
@@ -229,7 +333,14 @@ void DGUSDisplay::ProcessRx() {
   }
 }
 
-size_t DGUSDisplay::GetFreeTxBuffer() { return DGUS_SERIAL_GET_TX_BUFFER_FREE(); }
+size_t DGUSDisplay::GetFreeTxBuffer() {
+  const size_t tx_free = DGUS_SERIAL_GET_TX_BUFFER_FREE();
+  #if ENABLED(DGUS_WRITE_CACHE)
+    // Count a pending merged write as already in the buffer
+    if (batch_len) return tx_free > batch_len + 6U ? tx_free - (batch_len + 6U) : 0;
+  #endif
+  return tx_free;
+}
 
 void DGUSDisplay::WriteHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen) {
   dgusserial.write(DGUS_HEADER1);
@@ -83,6 +83,15 @@ public:
   // Periodic tasks, eg. Rx-Queue handling.
   static void loop();
 
+  #if ENABLED(DGUS_WRITE_CACHE)
+    // Between BeginWrites and EndWrites, VPs the display already shows are skipped
+    // and writes to adjacent VPs are merged into one telegram.
+    static void BeginWrites();
+    static void EndWrites();
+    // Forget the sent values, so the next update sends all VPs again.
+    static void ForgetWrites();
+  #endif
+
 public:
   // Helper for users of this class to estimate if an interaction would be blocking.
   static size_t GetFreeTxBuffer();
@@ -96,6 +105,18 @@ private:
   static void WritePGM(const char str[], uint8_t len);
   static void ProcessRx();
 
+  #if ENABLED(DGUS_WRITE_CACHE)
+    typedef struct { uint16_t VP; uint32_t hash; } sentVP_t;
+    static sentVP_t sent[DGUS_WRITE_CACHE_SIZE];
+    static uint8_t sent_next;
+    static bool batching;
+    static uint16_t batch_adr;
+    static uint8_t batch_len, batch[DGUS_WRITE_BATCH_SIZE];
+    static void WriteCached(uint16_t adr, const char *values, uint8_t valueslen);
+    static void FlushWrites();
+    static void ForgetWrite(const uint16_t adr);
+  #endif
+
   static inline uint16_t swap16(const uint16_t value) { return (value & 0xffU) << 8U | (value >> 8U); }
   static rx_datagram_state_t rx_datagram_state;
   static uint8_t rx_datagram_len;
@@ -1116,7 +1116,9 @@ bool DGUSScreenHandler::loop() {
 
   if (!IsScreenComplete() || ELAPSED(ms, next_event_ms)) {
     next_event_ms = ms + DGUS_UPDATE_INTERVAL_MS;
+    TERN_(DGUS_WRITE_CACHE, dgusdisplay.BeginWrites());
     UpdateScreenVPData();
+    TERN_(DGUS_WRITE_CACHE, dgusdisplay.EndWrites());
   }
 
   #if ENABLED(SHOW_BOOTSCREEN)
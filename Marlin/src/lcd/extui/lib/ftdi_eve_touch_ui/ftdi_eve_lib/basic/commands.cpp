@@ -885,6 +885,7 @@ void CLCD::CommandFifo::romfont(uint8_t font, uint8_t romslot) {
 /**************************** FT800/810 Co-Processor Command FIFO ****************************/
 
 bool CLCD::CommandFifo::is_processing() {
+  flush();
   return (mem_read_32(REG::CMD_READ) & 0x0FFF) != (mem_read_32(REG::CMD_WRITE) & 0x0FFF);
 }
 
@@ -902,6 +903,7 @@ void CLCD::CommandFifo::start() {
 
 void CLCD::CommandFifo::execute() {
   if (command_write_ptr != 0xFFFFFFFFul) {
+    flush();
     mem_write_32(REG::CMD_WRITE, command_write_ptr);
   }
 }
@@ -914,6 +916,9 @@ void CLCD::CommandFifo::reset() {
   mem_write_32(REG::CPURESET,  0x00000000);
   safe_delay(300);
   command_write_ptr = 0xFFFFFFFFul;
+  #ifdef TOUCH_UI_CMD_BUFFER_SIZE
+    cmd_buffer_len = 0;
+  #endif
 };
 
 template <class T> bool CLCD::CommandFifo::_write_unaligned(T data, uint16_t len) {
@@ -969,7 +974,7 @@ template <class T> bool CLCD::CommandFifo::_write_unaligned(T data, uint16_t len
 // divisible by four, zero bytes will be written
 // to align to the boundary.
 
-template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
+template <class T> bool CLCD::CommandFifo::send(T data, uint16_t len) {
   const uint8_t padding = MULTIPLE_OF_4(len) - len;
 
   uint8_t pad_bytes[] = {0, 0, 0, 0};
@@ -981,6 +986,7 @@ void CLCD::CommandFifo::start() {
 }
 
 void CLCD::CommandFifo::execute() {
+  flush();
 }
 
 void CLCD::CommandFifo::reset() {
@@ -993,13 +999,16 @@ void CLCD::CommandFifo::reset() {
   mem_write_32(REG::CMD_READ,  0x00000000);
   mem_write_32(REG::CPURESET,  0x00000000);
   safe_delay(300);
+  #ifdef TOUCH_UI_CMD_BUFFER_SIZE
+    cmd_buffer_len = 0;
+  #endif
 };
 
 // Writes len bytes into the FIFO, if len is not
 // divisible by four, zero bytes will be written
 // to align to the boundary.
 
-template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
+template <class T> bool CLCD::CommandFifo::send(T data, uint16_t len) {
   const uint8_t padding = MULTIPLE_OF_4(len) - len;
 
   if (has_fault()) {
@@ -1036,6 +1045,43 @@ template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
 }
 #endif
 
+#ifdef TOUCH_UI_CMD_BUFFER_SIZE
+  /**
+   * Commands are collected in RAM and sent to the FIFO in a single SPI
+   * transaction on execute(), rather than one transaction (and one wait
+   * for FIFO space) per command.
+   */
+  uint8_t  CLCD::CommandFifo::cmd_buffer[TOUCH_UI_CMD_BUFFER_SIZE];
+  uint16_t CLCD::CommandFifo::cmd_buffer_len = 0;
+
+  static inline void copy_bytes(uint8_t *dst, const void *src, uint16_t len) {::memcpy(dst, src, len);}
+  static inline void copy_bytes(uint8_t *dst, progmem_str src, uint16_t len) {memcpy_P(dst, (const char*)src, len);}
+
+  bool CLCD::CommandFifo::flush() {
+    if (!cmd_buffer_len) return true;
+    const uint16_t len = cmd_buffer_len;
+    cmd_buffer_len = 0;
+    return send((const void*)cmd_buffer, len);
+  }
+
+  template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
+    const uint16_t total = MULTIPLE_OF_4(len);
+    if (cmd_buffer_len + total > TOUCH_UI_CMD_BUFFER_SIZE && !flush()) return false;
+    if (total > TOUCH_UI_CMD_BUFFER_SIZE) return send(data, len); // Too big to buffer
+    uint8_t * const p = &cmd_buffer[cmd_buffer_len];
+    copy_bytes(p, data, len);
+    ::memset(p + len, 0, total - len);
+    cmd_buffer_len += total;
+    return true;
+  }
+#else
+  bool CLCD::CommandFifo::flush() { return true; }
+
+  template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
+    return send(data, len);
+  }
+#endif
+
 template bool CLCD::CommandFifo::write(const void*, uint16_t);
 template bool CLCD::CommandFifo::write(progmem_str, uint16_t);
 
@@ -66,6 +66,7 @@
 
   * CommandFifo::start()               Wait for CP finish - Set FIFO Ptr      *
   * CommandFifo::execute()             Set REG_CMD_WRITE and start CP         *
+  * CommandFifo::flush()               Send buffered commands to the FIFO     *
   * CommandFifo::reset()               Set Cmd Buffer Pointers to 0           *
   *
   * CommandFifo::fgcolor               Set Graphic Item Foreground Color      *
@@ -177,8 +178,13 @@ class CLCD::CommandFifo {
       uint32_t getRegCmdBSpace();
     #else
       static uint32_t command_write_ptr;
-      template <class T> bool _write_unaligned(T data, uint16_t len);
+      template <class T> static bool _write_unaligned(T data, uint16_t len);
     #endif
+    #ifdef TOUCH_UI_CMD_BUFFER_SIZE
+      static uint8_t  cmd_buffer[TOUCH_UI_CMD_BUFFER_SIZE];
+      static uint16_t cmd_buffer_len;
+    #endif
+    template <class T> static bool send(T data, uint16_t len);
     void start();
 
   public:
@@ -190,6 +196,7 @@ class CLCD::CommandFifo {
     static void reset();
     static bool is_processing();
     static bool has_fault();
+    static bool flush();
 
     void execute();
 
@@ -61,7 +61,7 @@ namespace ExtUI {
     if (AT_SCREEN(StatusScreen) || isPrintingFromMedia())
       StatusScreen::setStatusMessage(GET_TEXT_F(MSG_MEDIA_REMOVED));
 
-    if (AT_SCREEN(FilesScreen)) GOTO_SCREEN(StatusScreen)
+    if (AT_SCREEN(FilesScreen)) GOTO_SCREEN(StatusScreen);
   }
 
   void onMediaError() {
@@ -996,6 +996,106 @@ namespace ExtUI {
     onStatusChanged(msg);
   }
 
+  #if ENABLED(EXTUI_EVENT_QUEUE)
+
+    enum event_type_t : uint8_t {
+      EV_STATUS, EV_TIMER_STARTED, EV_TIMER_PAUSED, EV_TIMER_STOPPED,
+      EV_RUNOUT, EV_MESH_VALUE, EV_MESH_STATE, EV_PID_TUNING
+    };
+
+    typedef struct {
+      event_type_t type;
+      xy_int8_t pos;                                  // Mesh point
+      union { float zval; const char *msg; uint8_t arg; };
+    } extui_event_t;
+
+    static extui_event_t events[EXTUI_EVENT_QUEUE_SIZE];
+    static uint8_t event_head, event_count;
+
+    static void dispatch(const extui_event_t &ev) {
+      switch (ev.type) {
+        case EV_STATUS:        onStatusChanged(ev.msg); break;
+        case EV_TIMER_STARTED: onPrintTimerStarted(); break;
+        case EV_TIMER_PAUSED:  onPrintTimerPaused(); break;
+        case EV_TIMER_STOPPED: onPrintTimerStopped(); break;
+        case EV_RUNOUT:        onFilamentRunout((extruder_t)ev.arg); break;
+        #if HAS_MESH
+          case EV_MESH_VALUE:  onMeshUpdate(ev.pos.x, ev.pos.y, ev.zval); break;
+          case EV_MESH_STATE:  onMeshUpdate(ev.pos.x, ev.pos.y, (probe_state_t)ev.arg); break;
+        #endif
+        #if HAS_PID_HEATING
+          case EV_PID_TUNING:  onPidTuning((result_t)ev.arg); break;
+        #endif
+        default: break;
+      }
+    }
+
+    // Call the handler for the oldest event and remove it from the queue
+    static void dispatch_next() {
+      const extui_event_t ev = events[event_head];
+      if (++event_head == EXTUI_EVENT_QUEUE_SIZE) event_head = 0;
+      event_count--;
+      dispatch(ev);
+    }
+
+    /**
+     * Get a queue slot for an event. If 'merge' is set and an event of the same
+     * type (and mesh point) is waiting, return that one so only the latest is sent.
+     * If the queue is full the oldest event is handled now to make room.
+     */
+    static extui_event_t& queue_event(const event_type_t type, const bool merge, const int8_t x=0, const int8_t y=0) {
+      if (merge) {
+        for (uint8_t i = 0, n = event_head; i < event_count; i++) {
+          extui_event_t &ev = events[n];
+          if (ev.type == type && ev.pos.x == x && ev.pos.y == y) return ev;
+          if (++n == EXTUI_EVENT_QUEUE_SIZE) n = 0;
+        }
+      }
+      while (event_count >= EXTUI_EVENT_QUEUE_SIZE) dispatch_next(); // Handlers may post more events
+      uint8_t n = event_head + event_count;
+      if (n >= EXTUI_EVENT_QUEUE_SIZE) n -= EXTUI_EVENT_QUEUE_SIZE;
+      event_count++;
+      extui_event_t &ev = events[n];
+      ev.type = type;
+      ev.pos.set(x, y);
+      return ev;
+    }
+
+    void postStatusChanged(const char * const msg) { queue_event(EV_STATUS, true).msg = msg; }
+    void postPrintTimerStarted() { queue_event(EV_TIMER_STARTED, false); }
+    void postPrintTimerPaused()  { queue_event(EV_TIMER_PAUSED, false); }
+    void postPrintTimerStopped() { queue_event(EV_TIMER_STOPPED, false); }
+    void postFilamentRunout(const extruder_t extruder) { queue_event(EV_RUNOUT, false).arg = extruder; }
+
+    #if HAS_MESH
+      void postMeshUpdate(const int8_t xpos, const int8_t ypos, const float zval) {
+        queue_event(EV_MESH_VALUE, true, xpos, ypos).zval = zval;
+      }
+      void postMeshUpdate(const int8_t xpos, const int8_t ypos, probe_state_t state) {
+        queue_event(EV_MESH_STATE, true, xpos, ypos).arg = state;
+      }
+    #endif
+
+    #if HAS_PID_HEATING
+      void postPidTuning(const result_t rst) { queue_event(EV_PID_TUNING, false).arg = rst; }
+    #endif
+
+    /**
+     * Handle queued events, called from idle() before onIdle().
+     * Stop when the time budget is used up, but always handle at
+     * least one event so the queue keeps moving.
+     */
+    void processEvents() {
+      static bool processing; // Handlers may call idle()
+      if (processing || !event_count) return;
+      processing = true;
+      const millis_t end_ms = millis() + EXTUI_EVENT_BUDGET_MS;
+      do dispatch_next(); while (event_count && PENDING(millis(), end_ms));
+      processing = false;
+    }
+
+  #endif // EXTUI_EVENT_QUEUE
+
   FileList::FileList() { refresh(); }
 
   void FileList::refresh() { num_files = 0xFFFF; }
@@ -1060,7 +1160,10 @@ void MarlinUI::init() {
   ExtUI::onStartup();
 }
 
-void MarlinUI::update() { ExtUI::onIdle(); }
+void MarlinUI::update() {
+  TERN_(EXTUI_EVENT_QUEUE, ExtUI::processEvents());
+  ExtUI::onIdle();
+}
 
 void MarlinUI::kill_screen(PGM_P const error, PGM_P const component) {
   using namespace ExtUI;
@@ -354,6 +354,47 @@ namespace ExtUI {
   #if HAS_PID_HEATING
     void onPidTuning(const result_t rst);
   #endif
+
+  /**
+   * Event posting routines
+   *
+   * Called by Marlin for events raised from G-code handlers and
+   * probing loops. With EXTUI_EVENT_QUEUE the events are queued
+   * (merging repeats) and the callbacks above are called later
+   * from idle() by processEvents(). Otherwise they're called now.
+   */
+  #if ENABLED(EXTUI_EVENT_QUEUE)
+    void processEvents();
+    void postStatusChanged(const char * const msg); // msg must stay valid, e.g. ui.status_message
+    void postPrintTimerStarted();
+    void postPrintTimerPaused();
+    void postPrintTimerStopped();
+    void postFilamentRunout(const extruder_t extruder);
+    #if HAS_MESH
+      void postMeshUpdate(const int8_t xpos, const int8_t ypos, const float zval);
+      void postMeshUpdate(const int8_t xpos, const int8_t ypos, probe_state_t state);
+    #endif
+    #if HAS_PID_HEATING
+      void postPidTuning(const result_t rst);
+    #endif
+  #else
+    inline void postStatusChanged(const char * const msg) { onStatusChanged(msg); }
+    inline void postPrintTimerStarted() { onPrintTimerStarted(); }
+    inline void postPrintTimerPaused()  { onPrintTimerPaused(); }
+    inline void postPrintTimerStopped() { onPrintTimerStopped(); }
+    inline void postFilamentRunout(const extruder_t extruder) { onFilamentRunout(extruder); }
+    #if HAS_MESH
+      inline void postMeshUpdate(const int8_t xpos, const int8_t ypos, const float zval) { onMeshUpdate(xpos, ypos, zval); }
+      inline void postMeshUpdate(const int8_t xpos, const int8_t ypos, probe_state_t state) { onMeshUpdate(xpos, ypos, state); }
+    #endif
+    #if HAS_PID_HEATING
+      inline void postPidTuning(const result_t rst) { onPidTuning(rst); }
+    #endif
+  #endif
+  #if HAS_MESH
+    inline void postMeshUpdate(const xy_int8_t &pos, const float zval) { postMeshUpdate(pos.x, pos.y, zval); }
+    inline void postMeshUpdate(const xy_int8_t &pos, probe_state_t state) { postMeshUpdate(pos.x, pos.y, state); }
+  #endif
 };
 
 /**
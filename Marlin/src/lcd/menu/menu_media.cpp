@@ -107,11 +107,19 @@ class MenuItem_sdfolder : public MenuItem_sdbase {
 void menu_media() {
   ui.encoder_direction_menus();
 
+  #if ENABLED(SD_DIR_INDEX)
+    // List nothing until idle() finishes indexing the folder
+    const bool loading = card.isMounted() && !card.flag.dirIndexed;
+    if (loading) ui.refresh(LCDVIEW_CALL_REDRAW_NEXT);
+  #else
+    constexpr bool loading = false;
+  #endif
+
   #if HAS_GRAPHICAL_LCD
     static uint16_t fileCnt;
-    if (ui.first_page) fileCnt = card.get_num_Files();
+    if (ui.first_page) fileCnt = loading ? 0 : card.get_num_Files();
   #else
-    const uint16_t fileCnt = card.get_num_Files();
+    const uint16_t fileCnt = loading ? 0 : card.get_num_Files();
   #endif
 
   START_MENU();
@@ -124,6 +132,8 @@ void menu_media() {
   else if (card.isMounted())
     ACTION_ITEM_P(PSTR(LCD_STR_FOLDER ".."), lcd_sd_updir);
 
+  if (loading) STATIC_ITEM(MSG_MEDIA_LOADING, SS_LEFT);
+
   if (ui.should_draw()) for (uint16_t i = 0; i < fileCnt; i++) {
     if (_menuLineNr == _thisItemNr) {
       card.getfilename_sorted(SD_ORDER(i, fileCnt));
@@ -30,6 +30,21 @@ uint16_t CANVAS::width, CANVAS::height;
 uint16_t CANVAS::startLine, CANVAS::endLine;
 uint16_t *CANVAS::buffer = TFT::buffer;
 
+#if ENABLED(TFT_GLYPH_CACHE)
+  glyphRuns_t CANVAS::glyphCache[TFT_GLYPH_CACHE_SIZE];
+  glyph_t *CANVAS::glyphRejected[GLYPH_REJECT_SIZE];
+  uint16_t CANVAS::glyphClock;
+  uint8_t CANVAS::glyphRejectIndex;
+#endif
+
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  // Each stripe uses one half of TFT::buffer, alternately
+  #define CANVAS_BUFFER_SIZE (TFT_BUFFER_SIZE / 2)
+  static_assert(!(TFT_BUFFER_SIZE & 3), "TFT_BUFFER_SIZE must be a multiple of 4 with TFT_DOUBLE_BUFFER.");
+#else
+  #define CANVAS_BUFFER_SIZE TFT_BUFFER_SIZE
+#endif
+
 void CANVAS::New(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
   CANVAS::width = width;
   CANVAS::height = height;
@@ -41,7 +56,8 @@ void CANVAS::New(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
 
 void CANVAS::Continue() {
   startLine = endLine;
-  endLine = TFT_BUFFER_SIZE < width * (height - startLine) ? startLine + TFT_BUFFER_SIZE / width : height;
+  endLine = CANVAS_BUFFER_SIZE < width * (height - startLine) ? startLine + CANVAS_BUFFER_SIZE / width : height;
+  TERN_(TFT_DOUBLE_BUFFER, buffer = (buffer == TFT::buffer) ? TFT::buffer + CANVAS_BUFFER_SIZE : TFT::buffer);
 }
 
 bool CANVAS::ToScreen() {
@@ -72,11 +88,94 @@ void CANVAS::AddText(uint16_t x, uint16_t y, uint16_t color, uint8_t *string, ui
   for (uint16_t i = 0 ; *(string + i) ; i++) {
     glyph_t *glyph = Glyph(string + i);
     if (stringWidth + glyph->BBXWidth > maxWidth) break;
-    AddImage(x + stringWidth + glyph->BBXOffsetX, y + Font()->FontAscent - glyph->BBXHeight - glyph->BBXOffsetY, glyph->BBXWidth, glyph->BBXHeight, GREYSCALE1, ((uint8_t *)glyph) + sizeof(glyph_t), &color);
+    const int16_t glyphX = x + stringWidth + glyph->BBXOffsetX,
+                  glyphY = y + Font()->FontAscent - glyph->BBXHeight - glyph->BBXOffsetY;
+    #if ENABLED(TFT_GLYPH_CACHE)
+      glyphRuns_t *runs = GlyphRuns(glyph);
+      if (runs)
+        AddRuns(glyphX, glyphY, runs, color);
+      else
+    #endif
+        AddImage(glyphX, glyphY, glyph->BBXWidth, glyph->BBXHeight, GREYSCALE1, ((uint8_t *)glyph) + sizeof(glyph_t), &color);
     stringWidth += glyph->DWidth;
   }
 }
 
+#if ENABLED(TFT_GLYPH_CACHE)
+
+  /**
+   * Get a glyph as runs of set pixels, either from the cache or expanded
+   * from its 1-bit font bitmap into the least recently used entry.
+   * Return nullptr for a glyph too large or complex to cache. Those glyphs
+   * are remembered, so they aren't expanded again (evicting another entry)
+   * every time they are drawn.
+   */
+  glyphRuns_t *CANVAS::GlyphRuns(glyph_t *glyph) {
+    LOOP_L_N(i, GLYPH_REJECT_SIZE) if (glyphRejected[i] == glyph) return nullptr;
+
+    glyphClock++;
+
+    glyphRuns_t *entry = &glyphCache[0];
+    LOOP_L_N(i, TFT_GLYPH_CACHE_SIZE) {
+      glyphRuns_t &cached = glyphCache[i];
+      if (cached.glyph == glyph) {
+        cached.used = glyphClock;
+        return &cached;
+      }
+      if (uint16_t(glyphClock - cached.used) > uint16_t(glyphClock - entry->used)) entry = &cached;
+    }
+
+    if (glyph->BBXWidth > 32 || glyph->BBXHeight > 32) return RejectGlyph(glyph);
+
+    // Rows of the bitmap start on a byte boundary, most significant bit first
+    const uint8_t glyphWidth = glyph->BBXWidth, bytesPerLine = (glyphWidth + 7) >> 3;
+    const uint8_t *data = ((uint8_t *)glyph) + sizeof(glyph_t);
+    #define GLYPH_PIXEL(X) TEST(data[(X) >> 3], 7 - ((X) & 7))
+
+    entry->glyph = nullptr;
+    entry->count = 0;
+    for (uint8_t line = 0; line < glyph->BBXHeight; line++, data += bytesPerLine) {
+      for (uint8_t j = 0; j < glyphWidth; j++) {
+        if (!GLYPH_PIXEL(j)) continue;
+        if (entry->count == TFT_GLYPH_CACHE_RUNS) return RejectGlyph(glyph);
+        glyphRun_t &run = entry->runs[entry->count++];
+        run.line = line;
+        run.x = j;
+        while (j < glyphWidth && GLYPH_PIXEL(j)) j++;
+        run.length = j - run.x;
+      }
+    }
+
+    #undef GLYPH_PIXEL
+
+    entry->glyph = glyph;
+    entry->used = glyphClock;
+    return entry;
+  }
+
+  glyphRuns_t *CANVAS::RejectGlyph(glyph_t *glyph) {
+    glyphRejected[glyphRejectIndex] = glyph;
+    if (++glyphRejectIndex == GLYPH_REJECT_SIZE) glyphRejectIndex = 0;
+    return nullptr;
+  }
+
+  void CANVAS::AddRuns(int16_t x, int16_t y, glyphRuns_t *glyph, uint16_t color) {
+    for (uint8_t i = 0; i < glyph->count; i++) {
+      const glyphRun_t &run = glyph->runs[i];
+      const int16_t line = y + run.line;
+      if (line < startLine) continue;
+      if (line >= endLine) break;     // Runs are in line order
+
+      int16_t start = x + run.x, end = start + run.length;
+      NOLESS(start, 0);
+      NOMORE(end, width);
+      uint16_t *pixel = buffer + start + (line - startLine) * width;
+      for (; start < end; start++) *pixel++ = color;
+    }
+  }
+
+#endif // TFT_GLYPH_CACHE
+
 void CANVAS::AddImage(int16_t x, int16_t y, MarlinImage image, uint16_t *colors) {
   uint16_t *data = (uint16_t *)Images[image].data;
   if (data == NULL) return;
@@ -85,6 +184,9 @@ void CANVAS::AddImage(int16_t x, int16_t y, MarlinImage image, uint16_t *colors)
            image_height = Images[image].height;
   colorMode_t color_mode = Images[image].colorMode;
 
+  if (color_mode == RLE16)
+    return AddImageRLE16(x, y, image_width, image_height, (uint8_t *)data);
+
   if (color_mode != HIGHCOLOR)
     return AddImage(x, y, image_width, image_height, color_mode, (uint8_t *)data, colors);
 
@@ -105,6 +207,62 @@ void CANVAS::AddImage(int16_t x, int16_t y, MarlinImage image, uint16_t *colors)
   }
 }
 
+/**
+ * RLE16 - 16 bits per pixel, run-length encoded one image line at a time.
+ * Each run starts with a count byte: 0x80 | (n - 1) is followed by n colors,
+ * (n - 1) by a single color repeated n times. Colors are stored big-endian.
+ *
+ * Canvas stripes are drawn top to bottom, so the position reached by one stripe
+ * is kept and the next stripe resumes from there instead of decoding again from
+ * the start of the image.
+ */
+void CANVAS::AddImageRLE16(int16_t x, int16_t y, uint16_t image_width, uint16_t image_height, const uint8_t *data) {
+  static const uint8_t *resumeImage, *resumeData;
+  static int16_t resumeY, resumeLine;
+
+  const uint8_t *image = data;
+  int16_t i = 0;
+  if (image == resumeImage && y == resumeY && y + resumeLine <= startLine) {
+    i = resumeLine;
+    data = resumeData;
+  }
+
+  for (; i < image_height; i++) {
+    int16_t line = y + i;
+    if (line >= endLine) break;
+    if (line >= startLine) {
+      uint16_t *pixel = buffer + x + (line - startLine) * width;
+      for (int16_t j = 0; j < image_width;) {
+        const bool literal = TEST(*data, 7);
+        uint8_t count = (*data++ & 0x7F) + 1;
+        if (literal) {
+          for (; count; count--, j++, pixel++, data += 2)
+            if ((x + j >= 0) && (x + j < width)) *pixel = (data[0] << 8) | data[1];
+        }
+        else {
+          const uint16_t color = (data[0] << 8) | data[1];
+          data += 2;
+          for (; count; count--, j++, pixel++)
+            if ((x + j >= 0) && (x + j < width)) *pixel = color;
+        }
+      }
+    }
+    else {
+      // Skip a line above the stripe
+      for (int16_t j = 0; j < image_width;) {
+        const uint8_t count = (*data & 0x7F) + 1;
+        data += TEST(*data, 7) ? 1 + count * 2 : 3;
+        j += count;
+      }
+    }
+  }
+
+  resumeImage = image;
+  resumeY = y;
+  resumeLine = i;
+  resumeData = data;
+}
+
 void CANVAS::AddImage(int16_t x, int16_t y, uint8_t image_width, uint8_t image_height, colorMode_t color_mode, uint8_t *data, uint16_t *colors) {
   uint8_t bitsPerPixel;
   switch (color_mode) {
@@ -28,6 +28,23 @@
 
 #include "../../inc/MarlinConfig.h"
 
+#if ENABLED(TFT_GLYPH_CACHE)
+  // A horizontal run of set pixels within a glyph
+  typedef struct {
+    uint16_t line:5, x:5, length:6;
+  } glyphRun_t;
+
+  // A glyph expanded to runs, stamped with its last use
+  typedef struct {
+    glyph_t *glyph;
+    uint16_t used;
+    uint8_t count;
+    glyphRun_t runs[TFT_GLYPH_CACHE_RUNS];
+  } glyphRuns_t;
+
+  #define GLYPH_REJECT_SIZE 4   // Uncacheable glyphs remembered
+#endif
+
 class CANVAS {
   private:
     static uint16_t width, height;
@@ -40,6 +57,17 @@ class CANVAS {
 
     static void AddImage(int16_t x, int16_t y, uint8_t image_width, uint8_t image_height, colorMode_t color_mode, uint8_t *data, uint16_t *colors);
     static void AddImage(uint16_t x, uint16_t y, uint16_t imageWidth, uint16_t imageHeight, uint16_t color, uint16_t bgColor, uint8_t *image);
+    static void AddImageRLE16(int16_t x, int16_t y, uint16_t image_width, uint16_t image_height, const uint8_t *data);
+
+    #if ENABLED(TFT_GLYPH_CACHE)
+      static glyphRuns_t glyphCache[TFT_GLYPH_CACHE_SIZE];
+      static glyph_t *glyphRejected[GLYPH_REJECT_SIZE];
+      static uint16_t glyphClock;
+      static uint8_t glyphRejectIndex;
+      static glyphRuns_t *GlyphRuns(glyph_t *glyph);
+      static glyphRuns_t *RejectGlyph(glyph_t *glyph);
+      static void AddRuns(int16_t x, int16_t y, glyphRuns_t *glyph, uint16_t color);
+    #endif
 
   public:
     static void New(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
@@ -24,66 +24,67 @@
 
 #if HAS_GRAPHICAL_TFT
 
-extern const uint16_t marlin_logo_195x59x16[11505] = {
-  0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x310e, 0x7a32, 0xaad3, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395,
-  0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x20ad, 0x18ad, 0x496f, 0xaad3, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395,
-  0x18ad, 0x20ab, 0x18ad, 0x18ad, 0x18ad, 0x20ee, 0x8252, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd3b5, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdb95, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395,
-  0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x28ee, 0xb314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd4f8, 0xd65c, 0xd6dd, 0xd6fd, 0xd7ff, 0xd7ff, 0xdfff, 0xd7ff, 0xd7ff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xd539, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdb95, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395,
-  0x18ad, 0x20ad, 0x18ae, 0x28ee, 0xcb55, 0xd375, 0xd395, 0xd395, 0xd3d6, 0xd5db, 0xd7bf, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xdfff, 0xdfff, 0xd7ff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xd539, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395,
-  0x18ad, 0x18ad, 0x28ee, 0xb314, 0xd395, 0xd395, 0xd395, 0xd477, 0xd77e, 0xd7ff, 0xd7ff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xd7ff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd539, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395,
-  0x18ad, 0x18cd, 0x8252, 0xd395, 0xd395, 0xd396, 0xd4b8, 0xd7bf, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xdfff, 0xd7ff, 0xd7ff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xd7ff, 0xdfff, 0xd539, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395,
-  0x18ad, 0x496f, 0xd395, 0xd395, 0xd395, 0xd457, 0xd7bf, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7df, 0xd7ff, 0xcf3e, 0xc67c, 0xc53a, 0xacb8, 0xacb8, 0xacb8, 0xacb8, 0xacb8, 0xacb8, 0xc53a, 0xc67c, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd65b, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd396, 0xd395,
-  0x20ae, 0xa2d3, 0xd395, 0xd395, 0xd3d6, 0xd75e, 0xcfff, 0xcfff, 0xd7ff, 0xd7ff, 0xcfff, 0xcfff, 0xd7ff, 0xd7ff, 0xd7df, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7df, 0xd7ff, 0xd7ff, 0xcfdf, 0xcfff, 0xd7ff, 0xd7df, 0xd7ff, 0xcfff, 0xd7ff, 0xd7df, 0xd7ff, 0xcfff, 0xd7df, 0xcfff, 0xcfff, 0xd7ff, 0xd7ff, 0xcfff, 0xd7ff, 0xcfff, 0xd7ff, 0xd7df, 0xd7df, 0xcfff, 0xd7df, 0xcfff, 0xd7ff, 0xd7ff, 0xcfff, 0xd7ff, 0xcfff, 0xd7ff, 0xd7df, 0xd7ff, 0xd7ff, 0xcfff, 0xcfff, 0xd7ff, 0xcfff, 0xd7df, 0xcfff, 0xd7ff, 0xd7df, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xcfff, 0xd7ff, 0xcfdf, 0xd7df, 0xcfdf, 0xcfff, 0xd7df, 0xacd8, 0x8191, 0x9151, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0xbe3b, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7df, 0xd7df, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7df, 0xcfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7df, 0xd7df, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7df, 0xd7ff, 0xd7df, 0xd7ff, 0xd7df, 0xd65c, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395,
-  0x310e, 0xd395, 0xd375, 0xd375, 0xd5ba, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xc77e, 0xbe5b, 0xbe3c, 0xb57a, 0xacb8, 0xbdbb, 0xc63c, 0xbe3b, 0xc71e, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xc77e, 0xbe5c, 0xb5db, 0xacb8, 0xac98, 0xbd5a, 0xbe3c, 0xc61c, 0xc69d, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xacb9, 0x8191, 0x9151, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0xa111, 0xbe3b, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xd7df, 0xcfdf, 0xcf5e, 0xbe5c, 0xbe5c, 0xc63c, 0xc61c, 0xcefd, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfff, 0xcfdf, 0xd63b, 0xd375, 0xd395, 0xd375, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd395, 0xd375, 0xd375, 0xd375, 0xd395,
-  0x79f1, 0xd355, 0xd355, 0xd355, 0xcf7e, 0xc7df, 0xcfbf, 0xcfdf, 0xc7df, 0xc7df, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfbf, 0xcfdf, 0xcfdf, 0xcfbf, 0xbefd, 0xacb8, 0x8a52, 0x9151, 0x9131, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0xa192, 0xab96, 0xbe7d, 0xcfdf, 0xc7df, 0xcfbf, 0xc7df, 0xcfdf, 0xcfbf, 0xc75e, 0xad19, 0x92b4, 0x8971, 0x9151, 0x9931, 0x9931, 0x9911, 0x9911, 0xa111, 0x9931, 0xa111, 0x9911, 0xab36, 0xbd5a, 0xc75e, 0xcfdf, 0xc7bf, 0xc7bf, 0xcfdf, 0xc7df, 0xc7bf, 0xc7df, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xc7df, 0xcfbf, 0xc7df, 0xc7bf, 0xcfbf, 0xc7df, 0xa4b8, 0x8191, 0x9151, 0x9931, 0x9911, 0x9931, 0x9931, 0x9911, 0x9931, 0x9912, 0xbe3b, 0xcfbf, 0xcfdf, 0xcfbf, 0xcfdf, 0xcfdf, 0xb5da, 0x8a12, 0x8971, 0x9931, 0x9931, 0xa111, 0x9931, 0xab35, 0xc75e, 0xcfbf, 0xcfdf, 0xc7df, 0xc7df, 0xcfdf, 0xcfdf, 0xcfbf, 0xc7df, 0xc7df, 0xcfdf, 0xcfdf, 0xcfdf, 0xc7df, 0xcfdf, 0xcfdf, 0xcfdf, 0xce1b, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355,
-  0xa293, 0xd335, 0xd335, 0xcc98, 0xc7bf, 0xc7be, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc75e, 0xa4b8, 0x8191, 0x9151, 0x9911, 0xa131, 0xa111, 0xa111, 0x9931, 0xa111, 0xa112, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xab35, 0xbefe, 0xc7bf, 0xc7be, 0xc7bf, 0xb5db, 0x89f1, 0x8971, 0x9931, 0x9911, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa132, 0x9911, 0xa111, 0xa111, 0xa111, 0xa111, 0xa172, 0xbd3a, 0xc7be, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7be, 0xc79f, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc79f, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xac98, 0x8191, 0x9151, 0x9931, 0xa111, 0xa131, 0xa111, 0xa131, 0xa111, 0x9931, 0xbe1b, 0xc79f, 0xc7bf, 0xc7bf, 0xc7bf, 0xbefd, 0x89f2, 0x8991, 0x9931, 0xa112, 0xa131, 0xa111, 0xa111, 0xa111, 0xab97, 0xc7bf, 0xc7bf, 0xc7be, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc6dd, 0xd375, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd334, 0xd335, 0xd335,
-  0xd315, 0xd315, 0xd314, 0xc5fb, 0xc79f, 0xc79e, 0xc7bf, 0xc7bf, 0xc79e, 0xc79e, 0xc7bf, 0xc79f, 0xbf9e, 0xbfbf, 0xbfbe, 0xb67c, 0x8a53, 0x8971, 0xa131, 0xa112, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa112, 0xa111, 0xa111, 0xa172, 0xb539, 0xbf9f, 0x9bf6, 0x8191, 0x9151, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa112, 0xa111, 0xa111, 0xab15, 0xbf3d, 0xc79f, 0xc7be, 0xc79f, 0xc79f, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79f, 0xc79e, 0xc79f, 0xc79e, 0xc79e, 0xc7bf, 0xc79f, 0xa4b8, 0x8191, 0x9151, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa112, 0xa111, 0xbdfb, 0xc79f, 0xc79e, 0xc7be, 0xc79f, 0xacf9, 0x8191, 0x9171, 0xa111, 0xa111, 0xa111, 0xa112, 0xa111, 0xa131, 0xa111, 0xbf3e, 0xbfbf, 0xc79e, 0xc79e, 0xc79e, 0xc7bf, 0xc79e, 0xc79e, 0xc79e, 0xbfbf, 0xc79e, 0xc79e, 0xc79e, 0xbf9e, 0xc79f, 0xc79e, 0xbfbe, 0xc79e, 0xc6bd, 0xd355, 0xd2f5, 0xd315, 0xcb14, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd315, 0xd315, 0xd315, 0xd314,
-  0xd2f4, 0xcaf4, 0xd2f4, 0xc65c, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf7f, 0xb67c, 0x8a12, 0x8971, 0xa111, 0xa111, 0xa911, 0xa111, 0xa911, 0xa111, 0xa111, 0xa111, 0xa911, 0xa911, 0xa111, 0xa111, 0xa111, 0xa911, 0xa111, 0xa111, 0xa111, 0xa912, 0xa911, 0xa1f3, 0x8191, 0x9931, 0xa111, 0xa111, 0xa912, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa911, 0xa911, 0xa911, 0xa911, 0xa911, 0xa111, 0xa111, 0xa111, 0xa112, 0xa911, 0xaa54, 0xbf1d, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xb79e, 0xbf9f, 0xa498, 0x8191, 0x9951, 0xa911, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa911, 0xb5fb, 0xbf9e, 0xbf9f, 0xbf9e, 0xbf9f, 0xa498, 0x8191, 0x9951, 0xa111, 0xa111, 0xa111, 0xa111, 0xa112, 0xa111, 0xa911, 0xb5fb, 0xbf7e, 0xbf9e, 0xbf9e, 0xbf9f, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbebd, 0xd335, 0xcaf4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xcaf4, 0xd2f4, 0xd2f5, 0xcaf4,
-  0xd2d4, 0xd2d4, 0xd2d4, 0xbe5c, 0xb77e, 0xb79e, 0xb77e, 0xbf7e, 0xb77e, 0xb77e, 0xb77e, 0xb79e, 0xbf7e, 0xae7b, 0x89f2, 0x8971, 0xa111, 0xa8f1, 0xa911, 0xa8f1, 0xa911, 0xa911, 0xa911, 0xa911, 0xa911, 0xa8f1, 0xa911, 0xa911, 0xa911, 0xa8f1, 0xa911, 0xa8f1, 0xa911, 0xa911, 0xa912, 0xa911, 0xa911, 0xa111, 0xa911, 0xa8f1, 0xa911, 0xa8f1, 0xa111, 0xa911, 0xa8f1, 0xa8f1, 0xa911, 0xa911, 0xa8f1, 0xa911, 0xa8f1, 0xa8f1, 0xa912, 0xa911, 0xa911, 0xa911, 0xa8f1, 0xa111, 0xaa34, 0xb71e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xb77e, 0xb77e, 0xbf7e, 0xb77e, 0xb77e, 0xbf7f, 0xb77e, 0x9c97, 0x8191, 0x9951, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa911, 0xa8f1, 0xb5db, 0xbf7e, 0xb77e, 0xbf7e, 0xbf7e, 0xa478, 0x8191, 0x9951, 0xa911, 0xa8f1, 0xa8f1, 0xa911, 0xa911, 0xa8f1, 0xa911, 0xb5db, 0xb77f, 0xb77e, 0xbf7e, 0xbf7e, 0xb77e, 0xbf7e, 0xbf7e, 0xbf7e, 0xb77e, 0xb77e, 0xbf7e, 0xb77e, 0xbf7e, 0xb77e, 0xbf7e, 0xbf7e, 0xb77e, 0xb77e, 0xbf7e, 0xbe9d, 0xcb75, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d5,
-  0xd2b4, 0xd2b4, 0xd2b4, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb71d, 0x8a53, 0x8191, 0xa111, 0xa8f1, 0xb0f1, 0xa911, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f2, 0xa8f1, 0xb0f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xb2f5, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb75e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb75e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb75e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0x9c78, 0x8191, 0x9951, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xb5db, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0x9c77, 0x8191, 0x9151, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xb5db, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb71d, 0xcb96, 0xd2b4, 0xd2b4, 0xcab4, 0xd2b4, 0xcab4, 0xd2b4, 0xcab4, 0xd2b4, 0xcab4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xca94, 0xd2b4, 0xd2b4, 0xd2b4, 0xcab4,
-  0xd294, 0xd294, 0xca94, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xb75e, 0x9416, 0x8991, 0x9951, 0xb0f1, 0xa8f1, 0xb0f1, 0xa8f1, 0xb0f1, 0xa8f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xa8f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xa8f1, 0xa8f1, 0xb0f1, 0xa8f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0f2, 0xa8f1, 0xb0f1, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0f2, 0xa8f1, 0xb0f2, 0xb0f1, 0xb0f1, 0xb0f1, 0xa8f1, 0xb0f1, 0xb0f1, 0xacf9, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf7e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xb75e, 0xb75e, 0xaf5e, 0xb75e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xb75e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5d, 0xb75e, 0xaf5e, 0xaf5e, 0x9c77, 0x8191, 0x9951, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xadbb, 0xb75e, 0xb75e, 0xb75e, 0xb75e, 0x9c78, 0x8991, 0x9951, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb5bb, 0xb75e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xb75e, 0xb75e, 0xb75e, 0xaf5e, 0xb75e, 0xb75e, 0xb75e, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf1d, 0xcb75, 0xca93, 0xd294, 0xca74, 0xca94, 0xca74, 0xd274, 0xca74, 0xd294, 0xca94, 0xca94, 0xca94, 0xca94, 0xca94, 0xca94, 0xca94, 0xca94, 0xd294, 0xca93, 0xca94, 0xd293, 0xca74,
-  0xd274, 0xd274, 0xca53, 0xaf5e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3d, 0xaf5d, 0xaf3d, 0xaf3e, 0xa69c, 0x8191, 0x8191, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0d1, 0xb0f2, 0xb0d1, 0xb0d1, 0xb0f2, 0xb0f1, 0xb0f1, 0xaa13, 0xb418, 0xa438, 0x9ab4, 0x9931, 0xa8f1, 0xb0f1, 0xb0f2, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xaa74, 0xac78, 0xacf9, 0x9b35, 0x9931, 0xa8f1, 0xb0f1, 0xb0f2, 0xb0f1, 0xb0d1, 0xb0d1, 0xb0f1, 0xb0f2, 0xb0d1, 0xb0f1, 0xa9b3, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3d, 0xaf3d, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3d, 0xaf3d, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3d, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0x9c77, 0x8191, 0x9931, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xadbb, 0xaf3e, 0xaf3e, 0xaf5d, 0xaf3e, 0x9477, 0x8191, 0x9951, 0xb0d1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xadba, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3d, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf3d, 0xaf3d, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaefd, 0xcb56, 0xca53, 0xca74, 0xd253, 0xd274, 0xd274, 0xd273, 0xca73, 0xd274, 0xd274, 0xd274, 0xd274, 0xd274, 0xd274, 0xd274, 0xd274, 0xd254, 0xca74, 0xca54, 0xca54, 0xca74,
-  0xca53, 0xca53, 0xca53, 0xa73e, 0xa73e, 0xa73e, 0xa73e, 0xa73d, 0xa73d, 0xa73d, 0xa73d, 0x9457, 0x8191, 0x9931, 0xb8d1, 0xb0d1, 0xb8d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb1b3, 0xad9a, 0xaf3d, 0xaf3d, 0xa73d, 0xa73d, 0x9dda, 0x89d1, 0x9951, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0f1, 0xb213, 0xad9b, 0xa73e, 0xa73d, 0xaf3e, 0xaf3e, 0x9dda, 0x81f2, 0x9171, 0xb0f1, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0d1, 0xb8d1, 0xb8d2, 0xb0f1, 0xad39, 0xa73d, 0xa73e, 0xa73d, 0xa73d, 0xa73d, 0xa73d, 0xa73d, 0xa73e, 0xa73d, 0xa73d, 0xa73d, 0xaf3d, 0xa73d, 0xa73d, 0xa73d, 0xa73e, 0xa73e, 0xa73d, 0xaf3d, 0xa73d, 0xa73d, 0xa73e, 0xaf3d, 0xa73e, 0xa73e, 0xa73d, 0xaf3d, 0xa73d, 0xa73d, 0xa73e, 0xaf3e, 0xaf1e, 0xa73e, 0xa73e, 0xa73e, 0xa73e, 0xa73e, 0xa73e, 0xa73e, 0xa73e, 0xaf3e, 0xa73e, 0xa73d, 0xaf3e, 0xa73e, 0xa73d, 0xa73d, 0xa73d, 0xaf3d, 0xa73e, 0xa73e, 0xa73e, 0xa73d, 0xaf3d, 0xa73d, 0xaf3d, 0xa73e, 0xa73e, 0xaf3d, 0xa73e, 0xa73d, 0xa73d, 0xa73e, 0x9478, 0x8191, 0x9931, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb8d1, 0xad9a, 0xa73e, 0xa73d, 0xa73e, 0xa73d, 0xa73d, 0xa73d, 0xaf3d, 0xa73d, 0xa73d, 0xa73d, 0xa73d, 0xa73d, 0xaf3d, 0xa73d, 0xa73d, 0xa73d, 0xaf3e, 0xa73e, 0xa73d, 0xa73d, 0xa73d, 0xaf3d, 0xaf3e, 0xa73d, 0xaf3d, 0xaf3e, 0xa73d, 0xa73d, 0xaf3d, 0xa73e, 0xaf3d, 0xaf3d, 0xaf3d, 0xa73e, 0xa73d, 0xa73d, 0xaf3d, 0xa73d, 0xaedd, 0xc376, 0xca53, 0xca53, 0xca53, 0xca53, 0xca33, 0xca53, 0xca53, 0xca53, 0xca53, 0xca53, 0xca53, 0xca53, 0xca53, 0xca53, 0xd233, 0xca53, 0xd253, 0xca53, 0xca53,
-  0xca13, 0xca33, 0xca13, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa73d, 0xa73d, 0x8a53, 0x8191, 0xa8f1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb213, 0xa6bd, 0xa71d, 0xa73e, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0x9e1b, 0x81f1, 0x9171, 0xb0f1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb1f3, 0xa6bd, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa71d, 0x9e1b, 0x89f2, 0x8991, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb8d1, 0xb336, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa73d, 0xa73d, 0xa71d, 0xa71d, 0xa73d, 0xa71d, 0xa71e, 0xa71d, 0xa71d, 0xa73d, 0xa73e, 0xa71d, 0xa71d, 0xa71d, 0xa73e, 0xa71d, 0xa73e, 0xa73d, 0xa71d, 0xa71d, 0xa73d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa73d, 0xa73d, 0xa73e, 0xa71d, 0xa73d, 0xa73d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa71d, 0xa71d, 0xa73e, 0xa73d, 0xa73d, 0xa71d, 0xa71d, 0x9477, 0x8191, 0x9931, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xa59a, 0xa71d, 0xa73d, 0xa73e, 0xa71d, 0xa71d, 0xa71e, 0xa73d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa73d, 0xa71e, 0xa71d, 0xa73d, 0xa71d, 0xa73d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa73d, 0xa71d, 0xa73d, 0xa73d, 0xa71d, 0xa73e, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xbbf7, 0xca13, 0xca33, 0xca13, 0xca33, 0xca33, 0xca33, 0xca33, 0xca33, 0xca33, 0xca33, 0xca33, 0xca33, 0xca33, 0xca13, 0xca13, 0xca14, 0xd233, 0xca33,
-  0xca13, 0xca13, 0xca13, 0x9f1d, 0x9f1d, 0xa71d, 0x9f1d, 0x9f1d, 0xa71d, 0x9f1d, 0x9f1d, 0x8191, 0x8191, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xa5db, 0x9f1d, 0x9f1d, 0x9efd, 0x9f1d, 0x9f1d, 0x9f1d, 0xa6fd, 0x9f1d, 0x94f9, 0x8191, 0x9931, 0xb8d1, 0xb8d1, 0xb8b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8b1, 0xa5db, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0xa6fd, 0x9f1d, 0x9f1d, 0x9f1d, 0x94f9, 0x8191, 0x9931, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb932, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1e, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9e1b, 0x9457, 0x92d4, 0xa1f3, 0xa911, 0xb0f1, 0xb0f1, 0xa911, 0xb274, 0xb254, 0xb254, 0xabf7, 0xa5db, 0xa6fd, 0xa6fd, 0xa71d, 0xa71d, 0x9f1d, 0x9f1d, 0xa6fd, 0x9f1d, 0x9f1d, 0xa71d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9e7c, 0x9498, 0x8b14, 0x9a13, 0xa131, 0xa912, 0xb0f1, 0xa8f1, 0xb255, 0xb274, 0xb254, 0xab97, 0xad1a, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0xa71d, 0x9f1d, 0xa71d, 0x9457, 0x8191, 0xa131, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xa57a, 0x9f1d, 0xa71d, 0x9f1d, 0xa71d, 0x9e7c, 0x9dba, 0xa59a, 0xa57a, 0xa57a, 0xa57a, 0xa57a, 0xa57a, 0xa57a, 0xa57a, 0xa69c, 0x9f1d, 0x9f1d, 0x9f1d, 0xa71d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9e5c, 0x94b8, 0x8af4, 0x9a13, 0xa131, 0xa8f1, 0xb0f1, 0xb0f1, 0xb932, 0xb274, 0xb254, 0xb336, 0xacb9, 0xa63c, 0x9f1d, 0xbbf7, 0xc9f3, 0xca13, 0xca13, 0xca13, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xca13, 0xca13, 0xca13, 0xca13, 0xca13,
-  0xc9d3, 0xc9d3, 0xc9d3, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x959a, 0x8191, 0x9151, 0xc0b1, 0xb8d1, 0xc0b1, 0xb8d1, 0xc0d1, 0xb8d1, 0xb8d1, 0xb2b5, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x8252, 0x8191, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xc0b1, 0xc0d1, 0xb8d1, 0xc0d1, 0xb1f3, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9f1d, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x8a93, 0x8191, 0xb8d1, 0xb8d1, 0xc0d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xc0b1, 0xa63c, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x94f8, 0x8a53, 0x9171, 0xb0f1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8b1, 0xb8b1, 0xc0b1, 0xc0d1, 0xc0d1, 0xb8d1, 0xc0d1, 0xb8b1, 0xb992, 0xacb9, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9e5c, 0x8b96, 0x8991, 0xa131, 0xb8d1, 0xb8d1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xc0b1, 0xb8d1, 0xb932, 0xabf7, 0x9e9c, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9437, 0x8191, 0xa131, 0xb8d1, 0xc0b1, 0xb8d1, 0xc0b1, 0xc0b1, 0xb8d1, 0xb8d1, 0xa57a, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9437, 0x8191, 0xa131, 0xb8d1, 0xc0b1, 0xb8d1, 0xb8d1, 0xc0b1, 0xb8d1, 0xb8d1, 0xa57a, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9e9c, 0x8b96, 0x8971, 0xa131, 0xb8d1, 0xb8d1, 0xc0b1, 0xb8d1, 0xc0b1, 0xc0d1, 0xb8d1, 0xb8d1, 0xc0d1, 0xb8d1, 0xb8d1, 0xc0d1, 0xb335, 0xa63c, 0xbbd7, 0xc9d3, 0xc9f3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9f3, 0xc9d3, 0xc9d3, 0xc9f3, 0xc9d3,
-  0xc9b3, 0xc9b3, 0xc9b3, 0x9edd, 0x96fd, 0x9edd, 0x96fd, 0x9efc, 0x96fd, 0x96fd, 0x9599, 0x8991, 0x9171, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xabd7, 0x9efc, 0x96fd, 0x96fd, 0x96dd, 0x96fd, 0x9efd, 0x9edd, 0x96fd, 0x9edd, 0x9efd, 0x8c37, 0x8191, 0xa111, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xab76, 0x9edd, 0x9efd, 0x9efd, 0x9edd, 0x9edd, 0x96dd, 0x9efd, 0x9edd, 0x96fd, 0x9edd, 0x8c37, 0x8191, 0xa131, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0d1, 0xa55a, 0x96fd, 0x9edd, 0x9efd, 0x96fd, 0x963b, 0x8af4, 0x8991, 0xa911, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xb992, 0xa55a, 0x9edd, 0x9efc, 0x96fd, 0x9edd, 0x96fd, 0x9efd, 0x96fd, 0x96fd, 0x96fd, 0x96fd, 0x96fd, 0x96fd, 0x96fd, 0x96fd, 0x94f9, 0x81f1, 0x9171, 0xb8d2, 0xc0b1, 0xc0d1, 0xc0d1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xb992, 0x9dbb, 0x96fd, 0x9edd, 0x96fd, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xa55a, 0x9edd, 0x96fd, 0x96fd, 0x9efd, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xa55a, 0x96fd, 0x9efd, 0x96fd, 0x9efd, 0x9efd, 0x96fd, 0x9efd, 0x96fd, 0x9539, 0x81f1, 0x9171, 0xb0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xb8d1, 0xb911, 0xacfa, 0xb458, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9d2, 0xc9d3, 0xc9d3, 0xc9b3,
-  0xc993, 0xc993, 0xc992, 0x96dc, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x8d79, 0x8191, 0x9151, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xabd7, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xabd7, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x9d5a, 0x96dd, 0x96dd, 0x96dd, 0x95da, 0x89f2, 0x8971, 0xb8d1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xa499, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dc, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x8c37, 0x8191, 0x9931, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xa499, 0x96dc, 0x96dd, 0x8c37, 0x8191, 0xa111, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x9d5a, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x9d5a, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x8cd8, 0x8191, 0x9951, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xac79, 0xacf9, 0xc992, 0xc993, 0xc9b2, 0xc992, 0xc992, 0xc993, 0xc993, 0xc993, 0xc992, 0xc992, 0xc992, 0xc993, 0xc993, 0xc993,
-  0xc972, 0xc972, 0xc972, 0x8ebc, 0x8ebd, 0x8ebd, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebd, 0x8d7a, 0x8191, 0x9151, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xabb7, 0x8ebd, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebd, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xabb7, 0x8ebc, 0x8ebc, 0x8ebc, 0x8edc, 0x8ebc, 0x8edd, 0x8ebc, 0x8ebc, 0x8ebd, 0x8ebc, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x9d39, 0x8ebd, 0x8edd, 0x8dba, 0x81f2, 0x9171, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc8b1, 0xc8b2, 0xc0b1, 0xc8b2, 0xc8b1, 0xc8b1, 0xc0d1, 0xc0b1, 0xc0d1, 0xc0d1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xa437, 0x8ebc, 0x8edd, 0x8ebc, 0x8ebd, 0x8ebc, 0x8ebc, 0x8ebd, 0x8ebc, 0x8ebd, 0x8ebd, 0x8cd8, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc8b2, 0xc8b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc8b1, 0xa4d9, 0x8ebc, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc8b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0x9d3a, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x9d5a, 0x8ebc, 0x8ebc, 0x8edc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8cd8, 0x8191, 0x9951, 0xc8b1, 0xc0b1, 0xc8b1, 0xc8b2, 0xc8b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc8b1, 0xc8b1, 0xc8d1, 0xa478, 0xa4d9, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972,
-  0xc952, 0xc952, 0xc952, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8d59, 0x8191, 0x9171, 0xc8f2, 0xc8f1, 0xc8f2, 0xc8f2, 0xc8f2, 0xc8f1, 0xc8f2, 0xabd7, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8c36, 0x8191, 0xa931, 0xc8f2, 0xc8f1, 0xc8f2, 0xc8f2, 0xc8f2, 0xc8f2, 0xc0f2, 0xabb7, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8437, 0x8191, 0xa951, 0xc8f1, 0xc8f1, 0xc8f2, 0xc8f1, 0xc8f1, 0xc8f2, 0xc8f1, 0x9d3a, 0x8ebc, 0x8e1b, 0x81f2, 0x8971, 0xb912, 0xc8f1, 0xc8f1, 0xc8f2, 0xc8f1, 0xc8f1, 0xc8f1, 0xc8f2, 0xc8d1, 0xc112, 0xc8f2, 0xc8f2, 0xc8f2, 0xc8d1, 0xc8f2, 0xc8d1, 0xc8f2, 0xc0f1, 0xc8f1, 0xc8f2, 0xc8f1, 0xc8f2, 0xc0f1, 0xa498, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8dba, 0x8991, 0x8991, 0xc0f1, 0xc8f2, 0xc0f2, 0xc8f1, 0xc8f2, 0xc8f1, 0xc0f1, 0xc8f2, 0xc8f1, 0xc8f2, 0xc0f2, 0xc8f1, 0xc0f1, 0xc8f2, 0xc8f1, 0xc8f2, 0xc8f2, 0xc8f2, 0xc8f1, 0xc8f1, 0xc0f2, 0xc132, 0x8e5c, 0x8c17, 0x8191, 0xa931, 0xc8f2, 0xc8f2, 0xc8f2, 0xc8f2, 0xc8f1, 0xc8f2, 0xc8f2, 0x9d59, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8c17, 0x8191, 0xa951, 0xc8f1, 0xc8f1, 0xc8f2, 0xc8f1, 0xc8f1, 0xc8f2, 0xc8f1, 0x9d5a, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebd, 0x8dba, 0x81f2, 0x8991, 0xc111, 0xc8f1, 0xc8f1, 0xc8f1, 0xc0f2, 0xc8f1, 0xc8f1, 0xc0f2, 0xc8d2, 0xc8f1, 0xc8f2, 0xc0f1, 0xc0f1, 0xc8f2, 0xc0f1, 0xc8f1, 0xc8f2, 0xc8f2, 0xc8f1, 0xc8f1, 0xc8f2, 0xc152, 0x95fb, 0xa4b8, 0xc152, 0xc952, 0xc952, 0xc952, 0xc972, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952,
-  0xc932, 0xc932, 0xc932, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8d79, 0x8191, 0x9171, 0xc132, 0xc131, 0xc912, 0xc912, 0xc132, 0xc911, 0xc912, 0xabf7, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x96bc, 0x8c36, 0x8191, 0xa951, 0xc912, 0xc911, 0xc912, 0xc912, 0xc112, 0xc912, 0xc912, 0xabf7, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8c36, 0x8191, 0xa951, 0xc912, 0xc912, 0xc912, 0xc911, 0xc911, 0xc912, 0xc912, 0x9d59, 0x8ebc, 0x8ad4, 0x8191, 0xb152, 0xc912, 0xc131, 0xc912, 0xc912, 0xc912, 0xc912, 0xc912, 0xc912, 0xc932, 0xc912, 0xc912, 0xc912, 0xc912, 0xc911, 0xc112, 0xc932, 0xc912, 0xc912, 0xc932, 0xc911, 0xc912, 0xc912, 0xc932, 0xc131, 0x9dba, 0x8ebc, 0x96bc, 0x8ebc, 0x8edc, 0x96bb, 0x8ebc, 0x8edc, 0x82d4, 0x8191, 0xb932, 0xc912, 0xc112, 0xc912, 0xc112, 0xc912, 0xc112, 0xc912, 0xc911, 0xc911, 0xc932, 0xc911, 0xc131, 0xc912, 0xc132, 0xc131, 0xc912, 0xc912, 0xc911, 0xc911, 0xc131, 0xc912, 0xc912, 0xb356, 0x8c36, 0x8191, 0xa151, 0xc912, 0xc912, 0xc912, 0xc912, 0xc912, 0xc912, 0xc112, 0x9d59, 0x8ebc, 0x96bc, 0x8ebc, 0x8ebc, 0x8c37, 0x8191, 0xa951, 0xc912, 0xc912, 0xc912, 0xc911, 0xc911, 0xc912, 0xc912, 0x9d59, 0x8ebc, 0x8ebc, 0x8ebc, 0x96bc, 0x8ebc, 0x82f4, 0x8991, 0xb151, 0xc912, 0xc912, 0xc932, 0xc912, 0xc912, 0xc131, 0xc932, 0xc912, 0xc911, 0xc911, 0xc932, 0xc911, 0xc912, 0xc911, 0xc932, 0xc932, 0xc112, 0xc911, 0xc132, 0xc912, 0xc912, 0xc932, 0xb336, 0x96bc, 0xa4f9, 0xc192, 0xc932, 0xc932, 0xc932, 0xc932, 0xc932, 0xc932, 0xc932, 0xc932, 0xc932, 0xc932,
-  0xc912, 0xc912, 0xc912, 0x9edb, 0x9edb, 0x9edb, 0x9edc, 0x9edb, 0x9edb, 0x9edb, 0x9578, 0x8191, 0x9991, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xb417, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9436, 0x8191, 0xa972, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xa518, 0x9edb, 0x96db, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9436, 0x8191, 0xa171, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xa579, 0x94d8, 0x8191, 0x9991, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc152, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc253, 0xc2b4, 0xb952, 0xc152, 0xc952, 0xc152, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xbab5, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9599, 0x8191, 0x91b1, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc1f3, 0xc2b5, 0xb952, 0xc152, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc972, 0xc952, 0xc952, 0xc972, 0xc1b2, 0x9436, 0x8191, 0xa972, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xa579, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x8c36, 0x8991, 0xa171, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xa579, 0x9edb, 0x9edc, 0x9edb, 0x9edb, 0x9598, 0x8191, 0x9191, 0xc952, 0xc952, 0xc952, 0xc952, 0xc152, 0xc952, 0xc172, 0xc952, 0xc952, 0xc952, 0xc1f3, 0xc2b4, 0xb952, 0xc152, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xa61a, 0x9edc, 0xa5da, 0xc172, 0xc912, 0xc911, 0xc911, 0xc912, 0xc912, 0xc111, 0xc912, 0xc912, 0xc912,
-  0xc8f1, 0xc8f1, 0xc8f2, 0xa6fb, 0xa6fa, 0xa6fa, 0xa6fb, 0xa6fa, 0xa6da, 0xa6fa, 0x9d98, 0x8191, 0x9191, 0xc972, 0xc992, 0xc992, 0xc972, 0xc992, 0xc992, 0xc992, 0xb436, 0xa6fb, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0x9436, 0x8191, 0xa992, 0xc992, 0xc992, 0xc972, 0xc972, 0xc972, 0xc992, 0xc992, 0xad98, 0xa6da, 0xa6da, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0x9436, 0x8191, 0xa992, 0xc993, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xad99, 0x8a32, 0x8991, 0xc192, 0xc992, 0xc992, 0xc972, 0xc992, 0xc992, 0xc973, 0xc992, 0xc992, 0xc992, 0xbc36, 0xa69a, 0xa6fa, 0xa6fa, 0xa69a, 0x9395, 0x8991, 0xb992, 0xc993, 0xc972, 0xc972, 0xc992, 0xc992, 0xc972, 0xc992, 0xc972, 0xc972, 0xad98, 0xa6db, 0xa6da, 0xa6fa, 0xa6fb, 0xa6fa, 0x9395, 0x8191, 0xb192, 0xc992, 0xc992, 0xc992, 0xc993, 0xc972, 0xc972, 0xc992, 0xc972, 0xc233, 0xad98, 0xa6fa, 0xa6fb, 0xa639, 0x8a93, 0x9992, 0xc192, 0xc972, 0xc992, 0xc992, 0xc992, 0xc972, 0xc992, 0xc972, 0xc972, 0x9a93, 0x8191, 0xa992, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xad98, 0xa6fa, 0xa6fb, 0xa6fa, 0xa6fa, 0x9436, 0x8191, 0xa992, 0xc993, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xad98, 0xa6da, 0xa6da, 0xa6fa, 0xa6da, 0x8b95, 0x8191, 0xb192, 0xc972, 0xc992, 0xc972, 0xc992, 0xc992, 0xc972, 0xc992, 0xc972, 0xc294, 0xadf9, 0xa6fa, 0xa6da, 0xa69a, 0x9334, 0x9191, 0xb992, 0xc992, 0xc993, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xb497, 0xaefb, 0xaefb, 0xb5d9, 0xc952, 0xc8f1, 0xc8f2, 0xc0f1, 0xc8f1, 0xc8f1, 0xc8f1, 0xc8f1, 0xc8f1,
-  0xc0d1, 0xc0d1, 0xc8d2, 0xb71a, 0xb71a, 0xb71a, 0xaefa, 0xb71a, 0xaf1a, 0xaefa, 0xa598, 0x8191, 0x9191, 0xc9b3, 0xc9b3, 0xc9d3, 0xc9d3, 0xc9b2, 0xc9b3, 0xc9d3, 0xbc76, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0x9c55, 0x8191, 0xa9b2, 0xc9d3, 0xc9d3, 0xc9b3, 0xc9b2, 0xc9b3, 0xc9d3, 0xc9d3, 0xb5b8, 0xb71a, 0xaf1a, 0xb71a, 0xb6fa, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb6fa, 0xaf1a, 0x9c56, 0x8191, 0xa992, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xa3b5, 0x8191, 0x9992, 0xc9b2, 0xc9b3, 0xc9d2, 0xc9b2, 0xc9b3, 0xc9b2, 0xc9b3, 0xc9d3, 0xca13, 0xbdb8, 0xaefa, 0xaf1a, 0xb71a, 0xb6fa, 0xaefa, 0xaf19, 0xa4f7, 0x8991, 0xb1b2, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9d2, 0xc9b3, 0xc9b3, 0xc314, 0xaf1a, 0xaf1a, 0xaef9, 0xaf1a, 0xaf1a, 0x89f1, 0x8191, 0xc1b2, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b2, 0xc9b2, 0xc9d3, 0xc9b3, 0xcab4, 0xb6b9, 0xaf1a, 0xb71a, 0xaefa, 0xb71a, 0xb6b9, 0x8a93, 0x8991, 0xc1d2, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b2, 0xc9d3, 0xc9b2, 0xa992, 0x8191, 0xa9b2, 0xc9d3, 0xc9b3, 0xc9d3, 0xc9b2, 0xc9b2, 0xc9b2, 0xc9b3, 0xb5b8, 0xaf1a, 0xaefa, 0xaf1a, 0xb71a, 0x9c56, 0x8191, 0xa992, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xb5b8, 0xb6fa, 0xaf1a, 0xaf1a, 0xb6fa, 0x89f2, 0x8191, 0xc1b2, 0xc9b3, 0xc9b2, 0xc9d3, 0xc9b3, 0xc9b3, 0xc9b2, 0xc9d3, 0xcab4, 0xb6b9, 0xaf1a, 0xb71a, 0xb71a, 0xb6fa, 0xb71a, 0x92f3, 0x89b1, 0xc1b2, 0xc9d3, 0xc9b3, 0xc9b3, 0xc9d3, 0xc9d3, 0xc9b3, 0xc9d3, 0xc315, 0xb71a, 0xb71a, 0xb71a, 0xbdd9, 0xc132, 0xc0d1, 0xc8d1, 0xc8d1, 0xc8d1, 0xc8d1, 0xc0d1, 0xc0d1,
-  0xc0b1, 0xc8b1, 0xc0b1, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xa4b5, 0x8191, 0xa1b2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xd1f3, 0xc496, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xa455, 0x8191, 0xa9d2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xbdd8, 0xbf19, 0xbf19, 0xbf19, 0xbf39, 0xbf19, 0xbf19, 0xbf39, 0xbf19, 0xbf39, 0xbf39, 0xa455, 0x8191, 0xa9d2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0x99f2, 0x8991, 0xb1d2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f2, 0xc577, 0xbf19, 0xbf39, 0xbf39, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0x9bf5, 0x8191, 0xb1d2, 0xc9f3, 0xc9f3, 0xd1f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xbe78, 0xbf19, 0xbf19, 0xbf19, 0xb6b9, 0x8191, 0x8991, 0xc9f3, 0xc9f3, 0xc9f2, 0xc9f3, 0xc9f3, 0xc9d3, 0xc9f3, 0xc9f3, 0xbed8, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf39, 0xad57, 0x8191, 0x99b2, 0xc9f3, 0xc9f2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xb9d3, 0x8191, 0xa9b2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xbdd8, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0x9c75, 0x8191, 0xa9d2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xbdd8, 0xbf19, 0xbf19, 0xbf19, 0xb6b8, 0x8191, 0x8191, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xbe78, 0xbf19, 0xbf39, 0xbf19, 0xbf39, 0xbf19, 0xbf19, 0xadb7, 0x8191, 0x91b1, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc71a, 0xbf1a, 0xc73a, 0xbf3a, 0xc659, 0xc9d3, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1,
-  0xc0b1, 0xc0b1, 0xc0b1, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xa475, 0x8991, 0xa9d2, 0xca13, 0xca33, 0xca33, 0xca34, 0xca13, 0xca33, 0xca33, 0xccb6, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xa455, 0x8191, 0xa9d2, 0xca33, 0xca33, 0xca13, 0xca33, 0xca33, 0xca33, 0xd213, 0xc5f7, 0xc738, 0xc738, 0xc738, 0xc738, 0xc739, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xa475, 0x8191, 0xa9d2, 0xca13, 0xca33, 0xca33, 0xca33, 0xca33, 0xca13, 0xca33, 0x91b1, 0x8191, 0xca13, 0xca33, 0xca33, 0xca33, 0xca33, 0xca13, 0xca33, 0xca13, 0xc455, 0xc738, 0xc739, 0xc738, 0xc738, 0xc738, 0xc738, 0xc739, 0xc738, 0xc738, 0xc738, 0x8a52, 0x8991, 0xc213, 0xca13, 0xca13, 0xca13, 0xca13, 0xca33, 0xca13, 0xca33, 0xcd56, 0xc738, 0xc738, 0xc739, 0xb5d7, 0x8191, 0x91b1, 0xca13, 0xca13, 0xca13, 0xd233, 0xca33, 0xca33, 0xca33, 0xcb55, 0xcf38, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc739, 0xc738, 0x8191, 0x8191, 0xca13, 0xca13, 0xca13, 0xca33, 0xca13, 0xca33, 0xd233, 0xca13, 0x8191, 0xa9d2, 0xca33, 0xca33, 0xca13, 0xca13, 0xca33, 0xca13, 0xca33, 0xcdf7, 0xc738, 0xc738, 0xc738, 0xc739, 0xa475, 0x8191, 0xa9d2, 0xca13, 0xca33, 0xca33, 0xca33, 0xca33, 0xca13, 0xca33, 0xc5f7, 0xc738, 0xc738, 0xc738, 0xb5d6, 0x8191, 0x99b2, 0xca33, 0xca33, 0xd213, 0xca33, 0xca33, 0xca33, 0xca33, 0xcb74, 0xc739, 0xc738, 0xc738, 0xc738, 0xc738, 0xc739, 0xc738, 0xc738, 0x8ab2, 0x8191, 0xba13, 0xca13, 0xca13, 0xca33, 0xca13, 0xca33, 0xca33, 0xca13, 0xcf39, 0xc739, 0xc759, 0xcf3a, 0xcf39, 0xced9, 0xc9f3, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1,
-  0xc0b1, 0xc0b1, 0xc0b1, 0xcf57, 0xd758, 0xd758, 0xcf58, 0xd758, 0xcf58, 0xd758, 0xac74, 0x8191, 0xa9f2, 0xca53, 0xd253, 0xca54, 0xca53, 0xca53, 0xca53, 0xca54, 0xccd6, 0xcf58, 0xd758, 0xd758, 0xd758, 0xd758, 0xd758, 0xd758, 0xd758, 0xd758, 0xcf58, 0xac75, 0x8191, 0xa9f2, 0xca53, 0xca53, 0xd253, 0xca53, 0xca53, 0xca53, 0xd254, 0xce17, 0xcf57, 0xd758, 0xcf58, 0xd758, 0xcf58, 0xd758, 0xd758, 0xcf58, 0xd758, 0xcf58, 0xac74, 0x8191, 0xa9f2, 0xca53, 0xca54, 0xd253, 0xca53, 0xca53, 0xca54, 0xca53, 0x99d2, 0x89b1, 0xca53, 0xca53, 0xca53, 0xca53, 0xd253, 0xca53, 0xca53, 0xca54, 0xd6b7, 0xd758, 0xcf58, 0xcf57, 0xcf58, 0xd758, 0xd757, 0xd758, 0xd757, 0xd758, 0xcf58, 0xb535, 0x8191, 0xa1d2, 0xca53, 0xca53, 0xca53, 0xd254, 0xca73, 0xca53, 0xca53, 0xcc95, 0xd758, 0xd758, 0xcf58, 0xbdd6, 0x8191, 0x99d2, 0xca53, 0xca53, 0xca54, 0xca53, 0xca53, 0xd254, 0xca54, 0xd435, 0xd758, 0xd758, 0xcf58, 0xd758, 0xd758, 0xcf57, 0xd738, 0xcf58, 0x9af3, 0x8991, 0xc213, 0xca54, 0xca53, 0xca53, 0xd253, 0xca53, 0xca54, 0xca73, 0x8191, 0xa9f2, 0xca53, 0xd253, 0xd253, 0xca54, 0xd253, 0xca53, 0xca54, 0xce17, 0xcf58, 0xd758, 0xd758, 0xcf58, 0xac74, 0x8191, 0xa9f2, 0xca53, 0xca54, 0xd253, 0xca53, 0xca53, 0xca54, 0xca53, 0xd617, 0xd758, 0xcf58, 0xcf58, 0xbdd6, 0x8191, 0x91b2, 0xca53, 0xd254, 0xca53, 0xca53, 0xca54, 0xd253, 0xd253, 0xccd6, 0xd758, 0xd758, 0xd758, 0xd758, 0xcf57, 0xd757, 0xcf58, 0xd758, 0x9af3, 0x8191, 0xba33, 0xca54, 0xca53, 0xd253, 0xca54, 0xca53, 0xd253, 0xca53, 0xd758, 0xd758, 0xdf59, 0xd779, 0xd759, 0xd759, 0xd6f9, 0xc1f2, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1,
-  0xc0b1, 0xc0b1, 0xc0b1, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xb494, 0x8191, 0xaa12, 0xca94, 0xca74, 0xca94, 0xca94, 0xca94, 0xca94, 0xd294, 0xd4f5, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xb474, 0x8191, 0xaa12, 0xca94, 0xca94, 0xd294, 0xca94, 0xd294, 0xca94, 0xd294, 0xde36, 0xdf77, 0xdf77, 0xdf57, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xb494, 0x8191, 0xaa12, 0xca94, 0xd294, 0xd294, 0xd294, 0xd294, 0xd294, 0xd294, 0x99d2, 0x91d2, 0xd294, 0xca94, 0xd294, 0xca94, 0xd294, 0xca94, 0xca94, 0xd3d4, 0xdf77, 0xdf77, 0xdf77, 0xdf76, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf57, 0xdf77, 0xdf77, 0x8191, 0x8992, 0xca94, 0xca94, 0xca94, 0xd294, 0xca94, 0xca93, 0xca94, 0xd3d5, 0xdf77, 0xdf77, 0xdf77, 0xc5f5, 0x8191, 0x99d2, 0xca94, 0xca94, 0xd273, 0xca94, 0xd294, 0xca94, 0xd294, 0xd515, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0x9b12, 0x8191, 0xba53, 0xca94, 0xca94, 0xd294, 0xca94, 0xca93, 0xd294, 0xca94, 0x8191, 0xaa12, 0xd294, 0xd294, 0xd294, 0xca94, 0xca94, 0xd294, 0xd294, 0xde36, 0xdf77, 0xdf77, 0xdf57, 0xdf77, 0xb474, 0x8191, 0xaa12, 0xca94, 0xd294, 0xd294, 0xd294, 0xd294, 0xd294, 0xd294, 0xde36, 0xdf77, 0xdf77, 0xdf77, 0xc5f5, 0x8191, 0x99d2, 0xd294, 0xca94, 0xca94, 0xd294, 0xca94, 0xca94, 0xca93, 0xd4f5, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0x9b12, 0x8191, 0xba53, 0xd294, 0xca94, 0xca94, 0xd294, 0xca94, 0xd294, 0xca94, 0xdf78, 0xdf78, 0xdf78, 0xdf78, 0xdf78, 0xdf78, 0xe779, 0xdf19, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1,
-  0xb8d1, 0xb8d1, 0xc0d1, 0xe776, 0xe796, 0xe797, 0xe797, 0xe796, 0xe796, 0xe796, 0xb494, 0x8191, 0xaa33, 0xd2b4, 0xd2b4, 0xd2b4, 0xcab4, 0xd2d4, 0xd2b4, 0xd2b4, 0xdd35, 0xe776, 0xe796, 0xe796, 0xe796, 0xe796, 0xe796, 0xe796, 0xe796, 0xe796, 0xe796, 0xb474, 0x8191, 0xaa33, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2b4, 0xd2b4, 0xcad4, 0xd2d4, 0xe656, 0xef96, 0xe776, 0xe797, 0xe796, 0xe796, 0xe776, 0xe777, 0xe796, 0xe796, 0xe796, 0xb494, 0x8191, 0xaa33, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0x99d2, 0x99f2, 0xcab4, 0xd2b4, 0xd2d4, 0xd2b4, 0xd2b4, 0xcad4, 0xd2b4, 0xd3f5, 0xe777, 0xe797, 0xef97, 0xe796, 0xe796, 0xe776, 0xe777, 0xe796, 0xe796, 0xe796, 0xe777, 0xef97, 0x8191, 0x8191, 0xd2b4, 0xd2b4, 0xd2d4, 0xd2d4, 0xd2b4, 0xd2b4, 0xcad4, 0xd3d5, 0xe796, 0xe796, 0xe796, 0xce15, 0x8191, 0x99f2, 0xcad4, 0xd2b4, 0xd2d4, 0xd2b4, 0xd2b4, 0xcab4, 0xd2b4, 0xdd35, 0xe777, 0xef76, 0xe796, 0xe797, 0xe797, 0xe776, 0xe796, 0xe776, 0xc534, 0xb494, 0xcc15, 0xd3f5, 0xdbf4, 0xdbf4, 0xdbf5, 0xd3f5, 0xd3f4, 0xcb34, 0x8191, 0xaa32, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2d4, 0xd2b4, 0xcab4, 0xe656, 0xe776, 0xe796, 0xe796, 0xe776, 0xb494, 0x8191, 0xaa33, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xde56, 0xe796, 0xe796, 0xe796, 0xce15, 0x8191, 0x99f2, 0xd2b4, 0xd2b4, 0xd2d4, 0xd2b4, 0xd2d4, 0xcad4, 0xcad4, 0xdd15, 0xe796, 0xe796, 0xe776, 0xe796, 0xef96, 0xe796, 0xe796, 0xe796, 0x9b13, 0x8191, 0xba73, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xe797, 0xef97, 0xef77, 0xef97, 0xef78, 0xef98, 0xef98, 0xef98, 0xc992, 0xb8d1, 0xc0d1, 0xc0b1,
-  0xb8d1, 0xb8d1, 0xb8d1, 0xf796, 0xf7b6, 0xf796, 0xf795, 0xf795, 0xf796, 0xefb6, 0xbc93, 0x8191, 0xaa52, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2f5, 0xd2f5, 0xd2f4, 0xdd55, 0xf7b6, 0xf7b6, 0xf7b6, 0xf7b6, 0xf7b6, 0xf7b6, 0xf7b6, 0xf7b6, 0xf7b6, 0xefb6, 0xbc93, 0x8191, 0xaa53, 0xd2f5, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xe675, 0xf796, 0xf795, 0xf796, 0xf796, 0xf796, 0xf7b6, 0xf7b5, 0xf7b5, 0xef96, 0xf796, 0xbc93, 0x8191, 0xaa33, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0x99f2, 0x99f2, 0xd2f5, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2d4, 0xd2f4, 0xd2f4, 0xdc75, 0xf795, 0xf795, 0xf795, 0xf796, 0xf7b5, 0xf796, 0xf796, 0xf796, 0xf796, 0xefb6, 0xf7b5, 0xf796, 0x8191, 0x8991, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xdc15, 0xf796, 0xf796, 0xf796, 0xd615, 0x8191, 0x99f2, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2f4, 0xd2f5, 0xe535, 0xf7b6, 0xf7b5, 0xf796, 0xefb6, 0xf796, 0xf795, 0xf7b6, 0xf796, 0xf7b6, 0xf795, 0xf796, 0xf796, 0xf795, 0xf7b6, 0xf795, 0xf7b6, 0xf796, 0xbc93, 0x8191, 0xaa53, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xee75, 0xf796, 0xf796, 0xf7b5, 0xf796, 0xbc93, 0x8191, 0xaa33, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xee75, 0xf796, 0xf7b5, 0xf795, 0xd634, 0x8191, 0x99f2, 0xd2f4, 0xd2f5, 0xd2f4, 0xd2f5, 0xd2f5, 0xd2f5, 0xd2d4, 0xe555, 0xf796, 0xf7b5, 0xf7b6, 0xf7b6, 0xf795, 0xf7b6, 0xf796, 0xf7b6, 0xa311, 0x8191, 0xba94, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xf796, 0xf796, 0xf797, 0xf797, 0xf797, 0xf7b7, 0xf798, 0xf798, 0xd273, 0xb8d1, 0xb8d1, 0xb8d1,
-  0xb8d1, 0xb8d1, 0xb8d1, 0xff94, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb4, 0xffb5, 0xc493, 0x8191, 0xaa53, 0xd315, 0xd335, 0xd335, 0xd335, 0xd334, 0xd315, 0xd335, 0xe575, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xc493, 0x8191, 0xaa53, 0xd335, 0xd335, 0xd314, 0xd315, 0xd335, 0xd335, 0xd335, 0xf675, 0xffb5, 0xffb4, 0xffb5, 0xffb5, 0xffb4, 0xffb4, 0xffb4, 0xffb5, 0xffb5, 0xff95, 0xc493, 0x8191, 0xaa53, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xd315, 0xd335, 0x99f2, 0x99f2, 0xd335, 0xd314, 0xd315, 0xd335, 0xd335, 0xd315, 0xd335, 0xdc54, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb4, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb4, 0xffb5, 0x8191, 0x8191, 0xd334, 0xd315, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xdc34, 0xffb4, 0xffb5, 0xffb5, 0xde34, 0x8191, 0x99f2, 0xd314, 0xd335, 0xd315, 0xd334, 0xd334, 0xd335, 0xd335, 0xe574, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb4, 0xffb4, 0xffb5, 0xffb4, 0xffb5, 0xffb5, 0xffb5, 0xffb4, 0xffb5, 0xffb5, 0xc4b3, 0x8191, 0xaa53, 0xd335, 0xd335, 0xd314, 0xd315, 0xd335, 0xd335, 0xd335, 0xedf5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xc493, 0x8191, 0xaa53, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xd315, 0xd335, 0xf694, 0xffb5, 0xffb5, 0xffb5, 0xde14, 0x8191, 0x99f2, 0xd335, 0xd335, 0xd314, 0xd334, 0xd314, 0xd334, 0xd315, 0xe555, 0xffb5, 0xffb5, 0xffb5, 0xffb4, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xa332, 0x8191, 0xbab4, 0xd335, 0xd335, 0xd335, 0xd315, 0xd334, 0xd335, 0xd335, 0xffb5, 0xffb6, 0xffb6, 0xffb6, 0xffb6, 0xffb6, 0xffb7, 0xffb8, 0xdbd4, 0xb8d2, 0xb8d1, 0xb8d1,
-  0xb8d1, 0xb8d1, 0xb8d1, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe4e, 0xfe4e, 0xc3f0, 0x8191, 0xaa73, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xecd1, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xc3ef, 0x8191, 0xaa73, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd354, 0xf590, 0xfe4e, 0xfe4e, 0xfe2e, 0xfe2e, 0xfe4e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xc3ef, 0x8191, 0xaa73, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0x9a12, 0x91f2, 0xd355, 0xd354, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xdbd4, 0xfe4e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe4e, 0xfe2e, 0xfe4e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe4e, 0x8191, 0x8191, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xdc13, 0xfe4e, 0xfe2e, 0xfe2e, 0xe50f, 0x8191, 0x99f2, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd354, 0xecd1, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe4e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe4e, 0xfe4e, 0xfe2e, 0xfe2e, 0xc3cf, 0x8191, 0xaa73, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xe4d1, 0xfe4e, 0xfe2e, 0xfe2e, 0xfe4e, 0xc3d0, 0x8191, 0xaa73, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xf590, 0xfe4e, 0xfe2e, 0xfe2e, 0xe50f, 0x8191, 0x9a12, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xecd2, 0xfe2e, 0xfe4e, 0xfe2e, 0xfe4e, 0xfe4e, 0xfe4e, 0xfe4d, 0xfe2f, 0xa2b0, 0x8191, 0xc2f4, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xfe2f, 0xfe50, 0xfe50, 0xfe50, 0xfe51, 0xfe51, 0xfe52, 0xfe52, 0xe3d2, 0xb8d2, 0xb8d1, 0xb8d1,
-  0xb8d1, 0xb0d1, 0xb0d2, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc6d, 0xc30f, 0x81b1, 0xaa73, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd375, 0xec11, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd375, 0xd375, 0xd395, 0xd395, 0xd375, 0xd395, 0xd396, 0xf42f, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd395, 0x9a12, 0x8191, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xf44f, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc8d, 0xfc6d, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd396, 0xdbd3, 0xfc8d, 0xfc6d, 0xfc6d, 0xe3ce, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd376, 0xd395, 0xd395, 0xd395, 0xec11, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc6d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xebf1, 0xfc8d, 0xfc6d, 0xfc8d, 0xfc6d, 0xc30f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd395, 0xf42f, 0xfc6d, 0xfc6d, 0xfc8d, 0xe3ce, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd375, 0xd395, 0xd376, 0xd395, 0xd395, 0xebf1, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc8d, 0xa250, 0x8191, 0xc314, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xfc8e, 0xfc8f, 0xfc8f, 0xfc8f, 0xfcb0, 0xfcb0, 0xfcb1, 0xfcb1, 0xf3b2, 0xb8d1, 0xb0f1, 0xb8d1,
-  0xb0f1, 0xb0f1, 0xb0d1, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec11, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf44f, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0x9a12, 0x8191, 0xc334, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdbb4, 0xfc8e, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xdbd3, 0xfc8d, 0xfc8d, 0xfc8d, 0xe3ce, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec11, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xcb2f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xec11, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf44f, 0xfc8d, 0xfc8d, 0xfc8d, 0xcb6f, 0x8191, 0x9a32, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec11, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xa250, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfc8e, 0xfc8f, 0xfcaf, 0xfcaf, 0xfcb0, 0xfcb0, 0xfcb0, 0xfcb2, 0xf451, 0xb0d1, 0xb0d1, 0xb0d1,
-  0xb0f1, 0xb0f1, 0xb0d1, 0xfcad, 0xfccd, 0xfcad, 0xfcad, 0xfccd, 0xfccd, 0xfccd, 0xcb4e, 0x8191, 0xaa73, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec31, 0xfcad, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xc32f, 0x8991, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf46f, 0xfccd, 0xfccd, 0xfccd, 0xfcad, 0xfccd, 0xfccd, 0xfccd, 0xfcad, 0xfcad, 0xfcad, 0xc32f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xbb11, 0x8191, 0xaa73, 0xd396, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xdbb4, 0xfcae, 0xfcad, 0xfccd, 0xfcad, 0xfccd, 0xfcad, 0xfccd, 0xfccd, 0xfcad, 0xfcad, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xdbd3, 0xfcad, 0xfccd, 0xfccd, 0xdbee, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec31, 0xfccd, 0xfcad, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfcad, 0xfccd, 0xfcad, 0xfccd, 0xdbee, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdbd3, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xc32f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf46f, 0xfcad, 0xfccd, 0xfccd, 0xc32f, 0x8991, 0xaa94, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec31, 0xfccd, 0xfccd, 0xfcad, 0xfccd, 0xfcad, 0xfcad, 0xfcad, 0xfcad, 0xa270, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfcce, 0xfccf, 0xfccf, 0xfcef, 0xfcd0, 0xfcf0, 0xfcf1, 0xfcf1, 0xfcf2, 0xb0f1, 0xb0f1, 0xb0f2,
-  0xb0f1, 0xa8f1, 0xb0f1, 0xfd0d, 0xfced, 0xfced, 0xfced, 0xfd0d, 0xfced, 0xfd0d, 0xe42e, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec51, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xc34f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf48f, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xc32f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec6f, 0x91d1, 0x89d1, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xdbb4, 0xec70, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfd0d, 0xfced, 0xfced, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdbf3, 0xfced, 0xfced, 0xfced, 0xe42e, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec51, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfd0d, 0xfced, 0xec6e, 0x8191, 0x91f2, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd376, 0xd395, 0xd395, 0xf4af, 0xfd0d, 0xfced, 0xfd0d, 0xc34f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf48f, 0xfced, 0xfced, 0xfced, 0xc34f, 0x8191, 0xaa93, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec51, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xa270, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfd0e, 0xfd0f, 0xfd0f, 0xfd0f, 0xfd10, 0xfd10, 0xfd31, 0xfd31, 0xfd32, 0xb0f1, 0xb0f1, 0xb0f1,
-  0xb0f1, 0xa8f1, 0xb0f1, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xe44e, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xc34f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf4cf, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xc34f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf4cf, 0xc34f, 0x8191, 0xb2d4, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdbd4, 0xe431, 0xec71, 0xec71, 0xdbf0, 0xe450, 0xf4cf, 0xfd0e, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdbd4, 0xf4af, 0xf4cf, 0xf4af, 0xdc10, 0x9a12, 0xaa73, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2c, 0xfd2c, 0x9211, 0x8191, 0xd375, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfcee, 0xfd2d, 0xc36f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdc10, 0xe44e, 0xdc2e, 0xe44e, 0xb2f0, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xa270, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfd2e, 0xfd2f, 0xfd2f, 0xfd4f, 0xfd50, 0xfd50, 0xfd51, 0xfd51, 0xfd71, 0xa8f1, 0xb0f1, 0xb0f2,
-  0xa8f1, 0xa8f1, 0xa8f2, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd4d, 0xfd6d, 0xfd6d, 0xe46e, 0x8191, 0x9212, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xc36f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf4ef, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xc36f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf4ef, 0xfd2d, 0x9211, 0x89b2, 0xcb75, 0xd396, 0xd375, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec91, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xcb95, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd4d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xbb2f, 0x8191, 0xb2d4, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xc314, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xa290, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfd6e, 0xfd6f, 0xfd6f, 0xfd8f, 0xfd90, 0xfd90, 0xfd91, 0xfd91, 0xfd92, 0xa8f1, 0xa8f1, 0xa8f1,
-  0xa8f1, 0xa8f1, 0xa8f1, 0xec6f, 0xfd8d, 0xfdad, 0xfd8d, 0xfdad, 0xfdad, 0xfdad, 0xe48e, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec91, 0xfdad, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xc38f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf52f, 0xfdad, 0xfd8d, 0xfdad, 0xfd8d, 0xfd8d, 0xfdad, 0xfd8d, 0xfd8d, 0xfdad, 0xfdad, 0xc38f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf52f, 0xfd8d, 0xe4ae, 0x8991, 0x9a32, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xe491, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec91, 0xfdad, 0xfdad, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfdad, 0xfdad, 0xfd8d, 0xfd8d, 0xfdad, 0xfdad, 0xfd8d, 0xfdad, 0xf52d, 0x8191, 0x91f2, 0xd395, 0xd395, 0xd395, 0xd395, 0xd376, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xc314, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec91, 0xfd8d, 0xfd8d, 0xfdad, 0xfdad, 0xfdad, 0xfdad, 0xfdad, 0xfd8d, 0xa290, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfdaf, 0xfdaf, 0xfdad, 0xfdad, 0xfdad, 0xfd8d, 0xfdad, 0xfd8d, 0xec6f, 0xa8f1, 0xa8f1, 0xa8f1,
-  0xa911, 0xa911, 0xa911, 0xec8e, 0xfded, 0xfded, 0xfdcd, 0xfdcd, 0xfdcd, 0xfded, 0xe4ce, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecb1, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xc3af, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf54f, 0xfdcd, 0xfdcd, 0xfded, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfded, 0xfdcd, 0xc3af, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf54f, 0xfded, 0xfdcd, 0xd44f, 0x8191, 0xb2b3, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xecb1, 0x8991, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecb1, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xbb6f, 0x8191, 0xbaf4, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xc314, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecb1, 0xfded, 0xfded, 0xfdcd, 0xfdcd, 0xfded, 0xfded, 0xfded, 0xfded, 0xa2b0, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xfdee, 0xfdef, 0xfded, 0xfdcd, 0xfdcd, 0xfdcd, 0xfded, 0xfded, 0xec8e, 0xa911, 0xa911, 0xa911,
-  0xa911, 0xa911, 0xa111, 0xe42e, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xe4ee, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecd1, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xc3cf, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf56f, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xc3cf, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf56f, 0xfe0d, 0xfe0d, 0xfe0d, 0xd44f, 0x8191, 0xbad3, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd376, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xecd1, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecd1, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xf5ad, 0x9a70, 0x89b1, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xc314, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecd1, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0e, 0xfe0d, 0xfe0e, 0xfe0e, 0xfe0e, 0xa2b0, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfe0f, 0xfe0f, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xe42e, 0xa111, 0xa911, 0xa911,
-  0x80f0, 0xa111, 0xa111, 0xc2b0, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xe50e, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecf1, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xc3ef, 0x8991, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xf58f, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xc3ef, 0x8191, 0xaa93, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf58f, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xe50e, 0x89d1, 0xa253, 0xcb75, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd376, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecf1, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecf1, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xf60e, 0x9a70, 0x91f2, 0xcb75, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xc314, 0x8191, 0xaa93, 0xd395, 0xd396, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecf2, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4e, 0xfe4d, 0xfe4e, 0xfe4d, 0xfe4e, 0xa2d0, 0x8191, 0xc314, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfe4e, 0xfe4f, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xc2b0, 0xa111, 0xa111, 0x80f0,
-  0x60ef, 0xa111, 0xa111, 0xa112, 0xfe2d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xe54e, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xed11, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe8d, 0xc40f, 0x8191, 0xaa93, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xf5cf, 0xfe6d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe6d, 0xc40f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf5ce, 0xfe6d, 0xfe6d, 0xfe8d, 0xfe6c, 0xfe8d, 0xf62d, 0xc40f, 0x9a12, 0xb2d4, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecf1, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xed11, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe8d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6c, 0xfe8d, 0xfe6d, 0xfe2d, 0xbbcf, 0x89b1, 0xbaf4, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd396, 0xc314, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xed12, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xa2d0, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfe8f, 0xfe8f, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe2d, 0xa112, 0xa111, 0xa111, 0x60ef,
-  0x28cd, 0xa111, 0xa111, 0xa111, 0xcbcf, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xf5ed, 0x89d1, 0x91d2, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xed11, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xc42f, 0x81b1, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf5ef, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfecc, 0xfead, 0xc42f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xf5ef, 0xfead, 0xfeac, 0xfead, 0xfead, 0xfeac, 0xfead, 0xfead, 0xf64d, 0xd4ce, 0xbbd0, 0xc3b2, 0xc314, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xed12, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xed31, 0xfeac, 0xfeac, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xee0d, 0xcc6f, 0xbb51, 0xbad4, 0xcb55, 0xd395, 0xd395, 0xd395, 0xd395, 0xc334, 0x8191, 0xb294, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xed11, 0xfeae, 0xfece, 0xfead, 0xfeae, 0xfead, 0xfece, 0xfeae, 0xfeae, 0xa2f0, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdc34, 0xfeaf, 0xfed0, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xcbcf, 0xa111, 0xa111, 0xa111, 0x28cd,
-  0x18ad, 0x8110, 0x9911, 0xa111, 0xa171, 0xf5ed, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfe6d, 0xf5cf, 0xf5ef, 0xf5cf, 0xf5cf, 0xf5ef, 0xf5cf, 0xfe4d, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfe4e, 0xf5ef, 0xf5ef, 0xf5cf, 0xf5ee, 0xf5ef, 0xf5ef, 0xf5ef, 0xfe8d, 0xfeac, 0xfeac, 0xfeac, 0xfeac, 0xfead, 0xfe8d, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfeac, 0xfead, 0xf64d, 0xf5ef, 0xf5cf, 0xf5ef, 0xf5cf, 0xf5ef, 0xf5ef, 0xf5ef, 0xfe6e, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfeac, 0xfead, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfead, 0xfead, 0xf60e, 0xf5ef, 0xf5cf, 0xf5ef, 0xf5ef, 0xf5cf, 0xf64e, 0xfeac, 0xfead, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5cf, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5cf, 0xfe4d, 0xfeac, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfe6d, 0xf5ef, 0xf5ef, 0xf5cf, 0xf5cf, 0xfead, 0xf62e, 0xf5ef, 0xf5d0, 0xf5ef, 0xf5cf, 0xf5f0, 0xf5f0, 0xf5ef, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5ef, 0xf5f0, 0xfe4f, 0xfece, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeaf, 0xf610, 0xf5d0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf610, 0xfeaf, 0xfeaf, 0xfeaf, 0xfead, 0xfead, 0xfead, 0xfead, 0xf5ed, 0xa171, 0xa111, 0x9911, 0x8110, 0x18ad,
-  0x20ac, 0x38ce, 0x9931, 0x9931, 0x9931, 0xaa31, 0xfe2d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfead, 0xfe8c, 0xfeac, 0xfeac, 0xfe8c, 0xfe8c, 0xfeac, 0xfead, 0xfe8d, 0xfe8c, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfe8c, 0xfe8c, 0xfeac, 0xfeac, 0xfead, 0xfe8c, 0xfead, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8c, 0xfead, 0xfe8c, 0xfe8c, 0xfead, 0xfead, 0xfeac, 0xfeac, 0xfe8c, 0xfe8c, 0xfeac, 0xfe8c, 0xfeac, 0xfead, 0xfead, 0xfe8d, 0xfe8c, 0xfead, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8d, 0xfeac, 0xfe8c, 0xfeac, 0xfe8d, 0xfead, 0xfead, 0xfe8c, 0xfeac, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8c, 0xfeac, 0xfe8d, 0xfe8c, 0xfead, 0xfead, 0xfe8c, 0xfe8c, 0xfe8c, 0xfead, 0xfe8c, 0xfeac, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfe8c, 0xfeac, 0xfe8d, 0xfeac, 0xfead, 0xfead, 0xfe8c, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfe8c, 0xfead, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfead, 0xfead, 0xfead, 0xfe8d, 0xfead, 0xfead, 0xfead, 0xfead, 0xfe8d, 0xfe8e, 0xfead, 0xfeae, 0xfeae, 0xfead, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfe8e, 0xfe8e, 0xfeae, 0xfeae, 0xfeae, 0xfe8e, 0xfeae, 0xfeae, 0xfeae, 0xfe8e, 0xfe8e, 0xfeae, 0xfeaf, 0xfeae, 0xfeae, 0xfeaf, 0xfe8e, 0xfeaf, 0xfeaf, 0xfeaf, 0xfeaf, 0xfeaf, 0xfe8f, 0xfeb0, 0xfeaf, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe2d, 0xaa31, 0x9931, 0x9931, 0x9931, 0x38ce, 0x20ac,
-  0x20ad, 0x20ac, 0x60ef, 0x9912, 0x9931, 0x9931, 0xb270, 0xf62d, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe6d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8e, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8f, 0xfe8e, 0xfe8e, 0xfe8f, 0xfe8f, 0xfe8e, 0xfe8f, 0xfe8f, 0xfe8e, 0xfe8f, 0xfe8e, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe90, 0xfe90, 0xfeb0, 0xfe8c, 0xfe8c, 0xf62d, 0xb270, 0x9931, 0x9931, 0x9912, 0x60ef, 0x20ac, 0x20ad,
-  0x18ac, 0x20ac, 0x28ad, 0x8110, 0x9931, 0x9931, 0x9911, 0xaa31, 0xf5cd, 0xfe8c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe8c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe8c, 0xfe6d, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe8e, 0xfe8d, 0xfe8d, 0xfe6e, 0xfe8d, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe8f, 0xfe8f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe8f, 0xfe6f, 0xfe6f, 0xfe8f, 0xfe8f, 0xfe6f, 0xfe6f, 0xfe8f, 0xfe6f, 0xfe6f, 0xfe8f, 0xfe8f, 0xfe6f, 0xfe8f, 0xfe8f, 0xfe6f, 0xfe90, 0xfe8f, 0xfe8f, 0xfe90, 0xfe90, 0xfe8c, 0xf5cd, 0xaa31, 0x9911, 0x9931, 0x9931, 0x8110, 0x28ad, 0x20ac, 0x18ac,
-  0x20ac, 0x20ac, 0x18ac, 0x28ad, 0x9111, 0x9931, 0x9931, 0x9931, 0xa171, 0xcbcf, 0xf60d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6e, 0xfe6e, 0xfe4e, 0xfe6d, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6f, 0xfe6e, 0xfe6e, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe70, 0xfe70, 0xfe6f, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe90, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe71, 0xfe71, 0xfe71, 0xe471, 0xcbcf, 0xa171, 0x9931, 0x9931, 0x9931, 0x9111, 0x28ad, 0x18ac, 0x20ac, 0x20ac,
-  0x18ac, 0x18ac, 0x18ac, 0x20ac, 0x28cd, 0x8111, 0x9931, 0x9912, 0x9931, 0x9931, 0x9911, 0xbab0, 0xdc6f, 0xe50f, 0xe50e, 0xfe4e, 0xfe6e, 0xfe4e, 0xfe6d, 0xfe4e, 0xfe4e, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4e, 0xfe4e, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4e, 0xfe4e, 0xfe4e, 0xfe4e, 0xfe6e, 0xfe6e, 0xfe4e, 0xfe4e, 0xfe4e, 0xfe6e, 0xfe6e, 0xfe4e, 0xfe6f, 0xfe6e, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe4f, 0xfe6f, 0xfe70, 0xfe50, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xf612, 0xe531, 0xe512, 0xd472, 0xb271, 0x9931, 0x9931, 0x9931, 0x9912, 0x9931, 0x8111, 0x28cd, 0x20ac, 0x18ac, 0x18ac, 0x18ac,
-  0x20ac, 0x20ac, 0x18ac, 0x20ac, 0x20ac, 0x28cc, 0x610f, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9932, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9912, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9911, 0x9931, 0x9931, 0x9911, 0x9911, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9911, 0x9931, 0x9932, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9912, 0x9931, 0x9931, 0x9931, 0x9911, 0x610f, 0x28cc, 0x20ac, 0x20ac, 0x18ac, 0x20ac, 0x20ac,
-  0x18ac, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x40ce, 0x7910, 0x9931, 0x9931, 0x9932, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x7910, 0x40ce, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x18ac,
-  0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18ab, 0x30cc, 0x58cf, 0x7910, 0x9931, 0x9931, 0x9912, 0x9931, 0x9931, 0x9911, 0x9931, 0x9911, 0x9932, 0x9931, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9931, 0x9932, 0x9911, 0x9931, 0x9911, 0x9931, 0x9931, 0x9912, 0x9931, 0x9931, 0x7910, 0x58cf, 0x30cc, 0x18ab, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac
+// RLE16, generated by buildroot/share/scripts/rle16_compress_cpp_image_data.py
+extern const uint8_t marlin_logo_195x59x16[11787] = {
+  0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x84, 0x20, 0xad, 0x18, 0xad, 0x31, 0x0e, 0x7a, 0x32, 0xaa, 0xd3, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x03, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x7f, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x0b, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0xd3, 0x96, 0x12, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x0a, 0xd3, 0x95,
+  0x02, 0x18, 0xad, 0x85, 0x20, 0xad, 0x18, 0xae, 0x20, 0xad, 0x18, 0xad, 0x49, 0x6f, 0xaa, 0xd3, 0x06, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x7f, 0xd3, 0x95, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x08, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x03, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x1e, 0xd3, 0x95,
+  0x81, 0x18, 0xad, 0x20, 0xab, 0x02, 0x18, 0xad, 0x82, 0x20, 0xee, 0x82, 0x52, 0xd3, 0x96, 0x0a, 0xd3, 0x95, 0x80, 0xd3, 0xb5, 0x7f, 0xd3, 0x95, 0x0d, 0xd3, 0x95, 0x80, 0xdb, 0x95, 0x15, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x08, 0xd3, 0x95,
+  0x81, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x81, 0x28, 0xee, 0xb3, 0x14, 0x04, 0xd3, 0x95, 0x83, 0xd4, 0xf8, 0xd6, 0x5c, 0xd6, 0xdd, 0xd6, 0xfd, 0x01, 0xd7, 0xff, 0x80, 0xdf, 0xff, 0x01, 0xd7, 0xff, 0x80, 0xdf, 0xff, 0x7a, 0xd7, 0xff, 0x06, 0xdf, 0xff, 0x06, 0xd7, 0xff, 0x81, 0xdf, 0xff, 0xd5, 0x39, 0x19, 0xd3, 0x95, 0x80, 0xdb, 0x95, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95,
+  0x85, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x28, 0xee, 0xcb, 0x55, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x82, 0xd3, 0xd6, 0xd5, 0xdb, 0xd7, 0xbf, 0x7f, 0xd7, 0xff, 0x04, 0xd7, 0xff, 0x02, 0xdf, 0xff, 0x80, 0xd7, 0xff, 0x04, 0xdf, 0xff, 0x05, 0xd7, 0xff, 0x81, 0xdf, 0xff, 0xd5, 0x39, 0x21, 0xd3, 0x95,
+  0x01, 0x18, 0xad, 0x81, 0x28, 0xee, 0xb3, 0x14, 0x02, 0xd3, 0x95, 0x81, 0xd4, 0x77, 0xd7, 0x7e, 0x01, 0xd7, 0xff, 0x80, 0xdf, 0xff, 0x03, 0xd7, 0xff, 0x80, 0xdf, 0xff, 0x7e, 0xd7, 0xff, 0x03, 0xdf, 0xff, 0x81, 0xd7, 0xff, 0xdf, 0xff, 0x0a, 0xd7, 0xff, 0x80, 0xd5, 0x39, 0x20, 0xd3, 0x95,
+  0x82, 0x18, 0xad, 0x18, 0xcd, 0x82, 0x52, 0x01, 0xd3, 0x95, 0x82, 0xd3, 0x96, 0xd4, 0xb8, 0xd7, 0xbf, 0x7f, 0xd7, 0xff, 0x08, 0xd7, 0xff, 0x01, 0xdf, 0xff, 0x01, 0xd7, 0xff, 0x80, 0xdf, 0xff, 0x08, 0xd7, 0xff, 0x83, 0xdf, 0xff, 0xd7, 0xff, 0xdf, 0xff, 0xd5, 0x39, 0x14, 0xd3, 0x95, 0x01, 0xd3, 0x96, 0x08, 0xd3, 0x95,
+  0x81, 0x18, 0xad, 0x49, 0x6f, 0x02, 0xd3, 0x95, 0x81, 0xd4, 0x57, 0xd7, 0xbf, 0x73, 0xd7, 0xff, 0x84, 0xd7, 0xdf, 0xd7, 0xff, 0xcf, 0x3e, 0xc6, 0x7c, 0xc5, 0x3a, 0x05, 0xac, 0xb8, 0x81, 0xc5, 0x3a, 0xc6, 0x7c, 0x1a, 0xd7, 0xff, 0x82, 0xd6, 0x5b, 0xd3, 0x95, 0xd3, 0x96, 0x17, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x81, 0xd3, 0x96, 0xd3, 0x95,
+  0x81, 0x20, 0xae, 0xa2, 0xd3, 0x01, 0xd3, 0x95, 0x81, 0xd3, 0xd6, 0xd7, 0x5e, 0x01, 0xcf, 0xff, 0x01, 0xd7, 0xff, 0x01, 0xcf, 0xff, 0x01, 0xd7, 0xff, 0x80, 0xd7, 0xdf, 0x02, 0xd7, 0xff, 0x80, 0xd7, 0xdf, 0x01, 0xd7, 0xff, 0x8a, 0xcf, 0xdf, 0xcf, 0xff, 0xd7, 0xff, 0xd7, 0xdf, 0xd7, 0xff, 0xcf, 0xff, 0xd7, 0xff, 0xd7, 0xdf, 0xd7, 0xff, 0xcf, 0xff, 0xd7, 0xdf, 0x01, 0xcf, 0xff, 0x01, 0xd7, 0xff, 0x83, 0xcf, 0xff, 0xd7, 0xff, 0xcf, 0xff, 0xd7, 0xff, 0x01, 0xd7, 0xdf, 0x82, 0xcf, 0xff, 0xd7, 0xdf, 0xcf, 0xff, 0x01, 0xd7, 0xff, 0x84, 0xcf, 0xff, 0xd7, 0xff, 0xcf, 0xff, 0xd7, 0xff, 0xd7, 0xdf, 0x01, 0xd7, 0xff, 0x01, 0xcf, 0xff, 0x85, 0xd7, 0xff, 0xcf, 0xff, 0xd7, 0xdf, 0xcf, 0xff, 0xd7, 0xff, 0xd7, 0xdf, 0x37, 0xd7, 0xff, 0x89, 0xcf, 0xff, 0xd7, 0xff, 0xcf, 0xdf, 0xd7, 0xdf, 0xcf, 0xdf, 0xcf, 0xff, 0xd7, 0xdf, 0xac, 0xd8, 0x81, 0x91, 0x91, 0x51, 0x02, 0x99, 0x31, 0x80, 0x99, 0x11, 0x02, 0x99, 0x31, 0x80, 0xbe, 0x3b, 0x03, 0xd7, 0xff, 0x01, 0xd7, 0xdf, 0x02, 0xd7, 0xff, 0x81, 0xd7, 0xdf, 0xcf, 0xff, 0x05, 0xd7, 0xff, 0x01, 0xd7, 0xdf, 0x03, 0xd7, 0xff, 0x85, 0xd7, 0xdf, 0xd7, 0xff, 0xd7, 0xdf, 0xd7, 0xff, 0xd7, 0xdf, 0xd6, 0x5c, 0x1d, 0xd3, 0x95,
+  0x81, 0x31, 0x0e, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x80, 0xd5, 0xba, 0x0f, 0xcf, 0xdf, 0x88, 0xc7, 0x7e, 0xbe, 0x5b, 0xbe, 0x3c, 0xb5, 0x7a, 0xac, 0xb8, 0xbd, 0xbb, 0xc6, 0x3c, 0xbe, 0x3b, 0xc7, 0x1e, 0x0b, 0xcf, 0xdf, 0x88, 0xc7, 0x7e, 0xbe, 0x5c, 0xb5, 0xdb, 0xac, 0xb8, 0xac, 0x98, 0xbd, 0x5a, 0xbe, 0x3c, 0xc6, 0x1c, 0xc6, 0x9d, 0x49, 0xcf, 0xdf, 0x83, 0xac, 0xb9, 0x81, 0x91, 0x91, 0x51, 0x99, 0x11, 0x03, 0x99, 0x31, 0x82, 0x99, 0x11, 0xa1, 0x11, 0xbe, 0x3b, 0x03, 0xcf, 0xdf, 0x82, 0xd7, 0xdf, 0xcf, 0xdf, 0xcf, 0x5e, 0x01, 0xbe, 0x5c, 0x82, 0xc6, 0x3c, 0xc6, 0x1c, 0xce, 0xfd, 0x0e, 0xcf, 0xdf, 0x86, 0xcf, 0xff, 0xcf, 0xdf, 0xd6, 0x3b, 0xd3, 0x75, 0xd3, 0x95, 0xd3, 0x75, 0xd3, 0x95, 0x13, 0xd3, 0x75, 0x80, 0xd3, 0x95, 0x02, 0xd3, 0x75, 0x80, 0xd3, 0x95,
+  0x80, 0x79, 0xf1, 0x02, 0xd3, 0x55, 0x83, 0xcf, 0x7e, 0xc7, 0xdf, 0xcf, 0xbf, 0xcf, 0xdf, 0x01, 0xc7, 0xdf, 0x03, 0xcf, 0xdf, 0x80, 0xcf, 0xbf, 0x01, 0xcf, 0xdf, 0x85, 0xcf, 0xbf, 0xbe, 0xfd, 0xac, 0xb8, 0x8a, 0x52, 0x91, 0x51, 0x91, 0x31, 0x05, 0x99, 0x31, 0x8e, 0x99, 0x11, 0xa1, 0x92, 0xab, 0x96, 0xbe, 0x7d, 0xcf, 0xdf, 0xc7, 0xdf, 0xcf, 0xbf, 0xc7, 0xdf, 0xcf, 0xdf, 0xcf, 0xbf, 0xc7, 0x5e, 0xad, 0x19, 0x92, 0xb4, 0x89, 0x71, 0x91, 0x51, 0x01, 0x99, 0x31, 0x01, 0x99, 0x11, 0x87, 0xa1, 0x11, 0x99, 0x31, 0xa1, 0x11, 0x99, 0x11, 0xab, 0x36, 0xbd, 0x5a, 0xc7, 0x5e, 0xcf, 0xdf, 0x01, 0xc7, 0xbf, 0x83, 0xcf, 0xdf, 0xc7, 0xdf, 0xc7, 0xbf, 0xc7, 0xdf, 0x38, 0xcf, 0xdf, 0x8a, 0xc7, 0xdf, 0xcf, 0xbf, 0xc7, 0xdf, 0xc7, 0xbf, 0xcf, 0xbf, 0xc7, 0xdf, 0xa4, 0xb8, 0x81, 0x91, 0x91, 0x51, 0x99, 0x31, 0x99, 0x11, 0x01, 0x99, 0x31, 0x86, 0x99, 0x11, 0x99, 0x31, 0x99, 0x12, 0xbe, 0x3b, 0xcf, 0xbf, 0xcf, 0xdf, 0xcf, 0xbf, 0x01, 0xcf, 0xdf, 0x82, 0xb5, 0xda, 0x8a, 0x12, 0x89, 0x71, 0x01, 0x99, 0x31, 0x85, 0xa1, 0x11, 0x99, 0x31, 0xab, 0x35, 0xc7, 0x5e, 0xcf, 0xbf, 0xcf, 0xdf, 0x01, 0xc7, 0xdf, 0x01, 0xcf, 0xdf, 0x80, 0xcf, 0xbf, 0x01, 0xc7, 0xdf, 0x02, 0xcf, 0xdf, 0x80, 0xc7, 0xdf, 0x02, 0xcf, 0xdf, 0x80, 0xce, 0x1b, 0x1b, 0xd3, 0x55,
+  0x80, 0xa2, 0x93, 0x01, 0xd3, 0x35, 0x82, 0xcc, 0x98, 0xc7, 0xbf, 0xc7, 0xbe, 0x09, 0xc7, 0xbf, 0x85, 0xc7, 0x5e, 0xa4, 0xb8, 0x81, 0x91, 0x91, 0x51, 0x99, 0x11, 0xa1, 0x31, 0x01, 0xa1, 0x11, 0x82, 0x99, 0x31, 0xa1, 0x11, 0xa1, 0x12, 0x05, 0xa1, 0x11, 0x89, 0xab, 0x35, 0xbe, 0xfe, 0xc7, 0xbf, 0xc7, 0xbe, 0xc7, 0xbf, 0xb5, 0xdb, 0x89, 0xf1, 0x89, 0x71, 0x99, 0x31, 0x99, 0x11, 0x04, 0xa1, 0x11, 0x81, 0xa1, 0x32, 0x99, 0x11, 0x03, 0xa1, 0x11, 0x82, 0xa1, 0x72, 0xbd, 0x3a, 0xc7, 0xbe, 0x02, 0xc7, 0xbf, 0x81, 0xc7, 0xbe, 0xc7, 0x9f, 0x37, 0xc7, 0xbf, 0x80, 0xc7, 0x9f, 0x05, 0xc7, 0xbf, 0x8b, 0xac, 0x98, 0x81, 0x91, 0x91, 0x51, 0x99, 0x31, 0xa1, 0x11, 0xa1, 0x31, 0xa1, 0x11, 0xa1, 0x31, 0xa1, 0x11, 0x99, 0x31, 0xbe, 0x1b, 0xc7, 0x9f, 0x02, 0xc7, 0xbf, 0x85, 0xbe, 0xfd, 0x89, 0xf2, 0x89, 0x91, 0x99, 0x31, 0xa1, 0x12, 0xa1, 0x31, 0x02, 0xa1, 0x11, 0x80, 0xab, 0x97, 0x01, 0xc7, 0xbf, 0x80, 0xc7, 0xbe, 0x0d, 0xc7, 0xbf, 0x81, 0xc6, 0xdd, 0xd3, 0x75, 0x16, 0xd3, 0x35, 0x80, 0xd3, 0x34, 0x01, 0xd3, 0x35,
+  0x01, 0xd3, 0x15, 0x83, 0xd3, 0x14, 0xc5, 0xfb, 0xc7, 0x9f, 0xc7, 0x9e, 0x01, 0xc7, 0xbf, 0x01, 0xc7, 0x9e, 0x89, 0xc7, 0xbf, 0xc7, 0x9f, 0xbf, 0x9e, 0xbf, 0xbf, 0xbf, 0xbe, 0xb6, 0x7c, 0x8a, 0x53, 0x89, 0x71, 0xa1, 0x31, 0xa1, 0x12, 0x0a, 0xa1, 0x11, 0x80, 0xa1, 0x12, 0x01, 0xa1, 0x11, 0x85, 0xa1, 0x72, 0xb5, 0x39, 0xbf, 0x9f, 0x9b, 0xf6, 0x81, 0x91, 0x91, 0x51, 0x0c, 0xa1, 0x11, 0x80, 0xa1, 0x12, 0x01, 0xa1, 0x11, 0x83, 0xab, 0x15, 0xbf, 0x3d, 0xc7, 0x9f, 0xc7, 0xbe, 0x01, 0xc7, 0x9f, 0x37, 0xc7, 0x9e, 0x82, 0xc7, 0x9f, 0xc7, 0x9e, 0xc7, 0x9f, 0x01, 0xc7, 0x9e, 0x84, 0xc7, 0xbf, 0xc7, 0x9f, 0xa4, 0xb8, 0x81, 0x91, 0x91, 0x51, 0x04, 0xa1, 0x11, 0x89, 0xa1, 0x12, 0xa1, 0x11, 0xbd, 0xfb, 0xc7, 0x9f, 0xc7, 0x9e, 0xc7, 0xbe, 0xc7, 0x9f, 0xac, 0xf9, 0x81, 0x91, 0x91, 0x71, 0x02, 0xa1, 0x11, 0x85, 0xa1, 0x12, 0xa1, 0x11, 0xa1, 0x31, 0xa1, 0x11, 0xbf, 0x3e, 0xbf, 0xbf, 0x02, 0xc7, 0x9e, 0x80, 0xc7, 0xbf, 0x02, 0xc7, 0x9e, 0x80, 0xbf, 0xbf, 0x02, 0xc7, 0x9e, 0x89, 0xbf, 0x9e, 0xc7, 0x9f, 0xc7, 0x9e, 0xbf, 0xbe, 0xc7, 0x9e, 0xc6, 0xbd, 0xd3, 0x55, 0xd2, 0xf5, 0xd3, 0x15, 0xcb, 0x14, 0x11, 0xd3, 0x14, 0x02, 0xd3, 0x15, 0x80, 0xd3, 0x14,
+  0x83, 0xd2, 0xf4, 0xca, 0xf4, 0xd2, 0xf4, 0xc6, 0x5c, 0x08, 0xbf, 0x9e, 0x83, 0xbf, 0x7f, 0xb6, 0x7c, 0x8a, 0x12, 0x89, 0x71, 0x01, 0xa1, 0x11, 0x82, 0xa9, 0x11, 0xa1, 0x11, 0xa9, 0x11, 0x02, 0xa1, 0x11, 0x01, 0xa9, 0x11, 0x02, 0xa1, 0x11, 0x80, 0xa9, 0x11, 0x02, 0xa1, 0x11, 0x84, 0xa9, 0x12, 0xa9, 0x11, 0xa1, 0xf3, 0x81, 0x91, 0x99, 0x31, 0x01, 0xa1, 0x11, 0x80, 0xa9, 0x12, 0x04, 0xa1, 0x11, 0x04, 0xa9, 0x11, 0x02, 0xa1, 0x11, 0x83, 0xa1, 0x12, 0xa9, 0x11, 0xaa, 0x54, 0xbf, 0x1d, 0x3f, 0xbf, 0x9e, 0x85, 0xb7, 0x9e, 0xbf, 0x9f, 0xa4, 0x98, 0x81, 0x91, 0x99, 0x51, 0xa9, 0x11, 0x04, 0xa1, 0x11, 0x88, 0xa9, 0x11, 0xb5, 0xfb, 0xbf, 0x9e, 0xbf, 0x9f, 0xbf, 0x9e, 0xbf, 0x9f, 0xa4, 0x98, 0x81, 0x91, 0x99, 0x51, 0x03, 0xa1, 0x11, 0x84, 0xa1, 0x12, 0xa1, 0x11, 0xa9, 0x11, 0xb5, 0xfb, 0xbf, 0x7e, 0x01, 0xbf, 0x9e, 0x80, 0xbf, 0x9f, 0x0d, 0xbf, 0x9e, 0x82, 0xbe, 0xbd, 0xd3, 0x35, 0xca, 0xf4, 0x12, 0xd2, 0xf4, 0x83, 0xca, 0xf4, 0xd2, 0xf4, 0xd2, 0xf5, 0xca, 0xf4,
+  0x02, 0xd2, 0xd4, 0x84, 0xbe, 0x5c, 0xb7, 0x7e, 0xb7, 0x9e, 0xb7, 0x7e, 0xbf, 0x7e, 0x02, 0xb7, 0x7e, 0x88, 0xb7, 0x9e, 0xbf, 0x7e, 0xae, 0x7b, 0x89, 0xf2, 0x89, 0x71, 0xa1, 0x11, 0xa8, 0xf1, 0xa9, 0x11, 0xa8, 0xf1, 0x04, 0xa9, 0x11, 0x80, 0xa8, 0xf1, 0x02, 0xa9, 0x11, 0x82, 0xa8, 0xf1, 0xa9, 0x11, 0xa8, 0xf1, 0x01, 0xa9, 0x11, 0x80, 0xa9, 0x12, 0x01, 0xa9, 0x11, 0x86, 0xa1, 0x11, 0xa9, 0x11, 0xa8, 0xf1, 0xa9, 0x11, 0xa8, 0xf1, 0xa1, 0x11, 0xa9, 0x11, 0x01, 0xa8, 0xf1, 0x01, 0xa9, 0x11, 0x81, 0xa8, 0xf1, 0xa9, 0x11, 0x01, 0xa8, 0xf1, 0x80, 0xa9, 0x12, 0x02, 0xa9, 0x11, 0x83, 0xa8, 0xf1, 0xa1, 0x11, 0xaa, 0x34, 0xb7, 0x1e, 0x39, 0xbf, 0x7e, 0x01, 0xb7, 0x7e, 0x80, 0xbf, 0x7e, 0x01, 0xb7, 0x7e, 0x84, 0xbf, 0x7f, 0xb7, 0x7e, 0x9c, 0x97, 0x81, 0x91, 0x99, 0x51, 0x04, 0xa8, 0xf1, 0x84, 0xa9, 0x11, 0xa8, 0xf1, 0xb5, 0xdb, 0xbf, 0x7e, 0xb7, 0x7e, 0x01, 0xbf, 0x7e, 0x83, 0xa4, 0x78, 0x81, 0x91, 0x99, 0x51, 0xa9, 0x11, 0x01, 0xa8, 0xf1, 0x01, 0xa9, 0x11, 0x84, 0xa8, 0xf1, 0xa9, 0x11, 0xb5, 0xdb, 0xb7, 0x7f, 0xb7, 0x7e, 0x01, 0xbf, 0x7e, 0x80, 0xb7, 0x7e, 0x02, 0xbf, 0x7e, 0x01, 0xb7, 0x7e, 0x83, 0xbf, 0x7e, 0xb7, 0x7e, 0xbf, 0x7e, 0xb7, 0x7e, 0x01, 0xbf, 0x7e, 0x01, 0xb7, 0x7e, 0x82, 0xbf, 0x7e, 0xbe, 0x9d, 0xcb, 0x75, 0x15, 0xd2, 0xd4, 0x80, 0xd2, 0xd5,
+  0x02, 0xd2, 0xb4, 0x08, 0xb7, 0x7e, 0x86, 0xb7, 0x1d, 0x8a, 0x53, 0x81, 0x91, 0xa1, 0x11, 0xa8, 0xf1, 0xb0, 0xf1, 0xa9, 0x11, 0x16, 0xa8, 0xf1, 0x82, 0xa8, 0xf2, 0xa8, 0xf1, 0xb0, 0xf1, 0x0d, 0xa8, 0xf1, 0x80, 0xb2, 0xf5, 0x04, 0xb7, 0x7e, 0x80, 0xb7, 0x5e, 0x02, 0xb7, 0x7e, 0x01, 0xb7, 0x5e, 0x81, 0xb7, 0x7e, 0xb7, 0x5e, 0x01, 0xb7, 0x7e, 0x80, 0xb7, 0x5e, 0x0c, 0xb7, 0x7e, 0x01, 0xb7, 0x5e, 0x14, 0xb7, 0x7e, 0x80, 0xb7, 0x5e, 0x01, 0xb7, 0x7e, 0x82, 0xb7, 0x5e, 0xb7, 0x7e, 0xb7, 0x5e, 0x06, 0xb7, 0x7e, 0x82, 0x9c, 0x78, 0x81, 0x91, 0x99, 0x51, 0x06, 0xa8, 0xf1, 0x80, 0xb5, 0xdb, 0x03, 0xb7, 0x7e, 0x82, 0x9c, 0x77, 0x81, 0x91, 0x91, 0x51, 0x06, 0xa8, 0xf1, 0x80, 0xb5, 0xdb, 0x02, 0xb7, 0x7e, 0x82, 0xb7, 0x5e, 0xb7, 0x7e, 0xb7, 0x5e, 0x06, 0xb7, 0x7e, 0x80, 0xb7, 0x5e, 0x04, 0xb7, 0x7e, 0x82, 0xb7, 0x5e, 0xb7, 0x1d, 0xcb, 0x96, 0x01, 0xd2, 0xb4, 0x86, 0xca, 0xb4, 0xd2, 0xb4, 0xca, 0xb4, 0xd2, 0xb4, 0xca, 0xb4, 0xd2, 0xb4, 0xca, 0xb4, 0x07, 0xd2, 0xb4, 0x80, 0xca, 0x94, 0x02, 0xd2, 0xb4, 0x80, 0xca, 0xb4,
+  0x01, 0xd2, 0x94, 0x80, 0xca, 0x94, 0x04, 0xaf, 0x5e, 0x80, 0xb7, 0x5e, 0x01, 0xaf, 0x5e, 0x89, 0xb7, 0x5e, 0x94, 0x16, 0x89, 0x91, 0x99, 0x51, 0xb0, 0xf1, 0xa8, 0xf1, 0xb0, 0xf1, 0xa8, 0xf1, 0xb0, 0xf1, 0xa8, 0xf1, 0x02, 0xb0, 0xf1, 0x80, 0xa8, 0xf1, 0x09, 0xb0, 0xf1, 0x01, 0xa8, 0xf1, 0x81, 0xb0, 0xf1, 0xa8, 0xf1, 0x02, 0xb0, 0xf1, 0x80, 0xb0, 0xd1, 0x01, 0xb0, 0xf1, 0x81, 0xb0, 0xf2, 0xa8, 0xf1, 0x01, 0xb0, 0xf1, 0x84, 0xb0, 0xd1, 0xb0, 0xf1, 0xb0, 0xf2, 0xa8, 0xf1, 0xb0, 0xf2, 0x02, 0xb0, 0xf1, 0x80, 0xa8, 0xf1, 0x01, 0xb0, 0xf1, 0x80, 0xac, 0xf9, 0x01, 0xaf, 0x5e, 0x80, 0xb7, 0x5e, 0x05, 0xaf, 0x5e, 0x80, 0xaf, 0x7e, 0x02, 0xaf, 0x5e, 0x02, 0xb7, 0x5e, 0x83, 0xaf, 0x5e, 0xb7, 0x5e, 0xaf, 0x5e, 0xb7, 0x5e, 0x03, 0xaf, 0x5e, 0x02, 0xb7, 0x5e, 0x02, 0xaf, 0x5e, 0x01, 0xb7, 0x5e, 0x0a, 0xaf, 0x5e, 0x80, 0xb7, 0x5e, 0x01, 0xaf, 0x5e, 0x80, 0xb7, 0x5e, 0x02, 0xaf, 0x5e, 0x01, 0xb7, 0x5e, 0x02, 0xaf, 0x5e, 0x80, 0xb7, 0x5e, 0x03, 0xaf, 0x5e, 0x81, 0xaf, 0x5d, 0xb7, 0x5e, 0x01, 0xaf, 0x5e, 0x82, 0x9c, 0x77, 0x81, 0x91, 0x99, 0x51, 0x06, 0xb0, 0xf1, 0x80, 0xad, 0xbb, 0x03, 0xb7, 0x5e, 0x82, 0x9c, 0x78, 0x89, 0x91, 0x99, 0x51, 0x06, 0xb0, 0xf1, 0x80, 0xb5, 0xbb, 0x01, 0xb7, 0x5e, 0x04, 0xaf, 0x5e, 0x80, 0xb7, 0x5e, 0x01, 0xaf, 0x5e, 0x02, 0xb7, 0x5e, 0x80, 0xaf, 0x5e, 0x02, 0xb7, 0x5e, 0x01, 0xaf, 0x5e, 0x8b, 0xb7, 0x5e, 0xaf, 0x5e, 0xaf, 0x1d, 0xcb, 0x75, 0xca, 0x93, 0xd2, 0x94, 0xca, 0x74, 0xca, 0x94, 0xca, 0x74, 0xd2, 0x74, 0xca, 0x74, 0xd2, 0x94, 0x07, 0xca, 0x94, 0x84, 0xd2, 0x94, 0xca, 0x93, 0xca, 0x94, 0xd2, 0x93, 0xca, 0x74,
+  0x01, 0xd2, 0x74, 0x89, 0xca, 0x53, 0xaf, 0x5e, 0xaf, 0x3e, 0xaf, 0x5e, 0xaf, 0x3e, 0xaf, 0x3d, 0xaf, 0x5d, 0xaf, 0x3d, 0xaf, 0x3e, 0xa6, 0x9c, 0x01, 0x81, 0x91, 0x02, 0xb0, 0xf1, 0x81, 0xb0, 0xd1, 0xb0, 0xf2, 0x01, 0xb0, 0xd1, 0x80, 0xb0, 0xf2, 0x01, 0xb0, 0xf1, 0x8c, 0xaa, 0x13, 0xb4, 0x18, 0xa4, 0x38, 0x9a, 0xb4, 0x99, 0x31, 0xa8, 0xf1, 0xb0, 0xf1, 0xb0, 0xf2, 0xb0, 0xf1, 0xb0, 0xd1, 0xb0, 0xf1, 0xb0, 0xd1, 0xb0, 0xf1, 0x01, 0xb0, 0xd1, 0x81, 0xb0, 0xf1, 0xb0, 0xd1, 0x03, 0xb0, 0xf1, 0x88, 0xaa, 0x74, 0xac, 0x78, 0xac, 0xf9, 0x9b, 0x35, 0x99, 0x31, 0xa8, 0xf1, 0xb0, 0xf1, 0xb0, 0xf2, 0xb0, 0xf1, 0x01, 0xb0, 0xd1, 0x84, 0xb0, 0xf1, 0xb0, 0xf2, 0xb0, 0xd1, 0xb0, 0xf1, 0xa9, 0xb3, 0x03, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x01, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x02, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x01, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x01, 0xaf, 0x3e, 0x01, 0xaf, 0x3d, 0x01, 0xaf, 0x3e, 0x81, 0xaf, 0x5e, 0xaf, 0x3e, 0x01, 0xaf, 0x3d, 0x03, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x01, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x07, 0xaf, 0x3e, 0x81, 0xaf, 0x3d, 0xaf, 0x5e, 0x03, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x02, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x04, 0xaf, 0x3e, 0x82, 0xaf, 0x5e, 0xaf, 0x3e, 0xaf, 0x5e, 0x03, 0xaf, 0x3e, 0x84, 0x9c, 0x77, 0x81, 0x91, 0x99, 0x31, 0xb0, 0xf1, 0xb0, 0xd1, 0x04, 0xb0, 0xf1, 0x80, 0xad, 0xbb, 0x01, 0xaf, 0x3e, 0x84, 0xaf, 0x5d, 0xaf, 0x3e, 0x94, 0x77, 0x81, 0x91, 0x99, 0x51, 0x01, 0xb0, 0xd1, 0x80, 0xb0, 0xf1, 0x03, 0xb0, 0xd1, 0x84, 0xad, 0xba, 0xaf, 0x3e, 0xaf, 0x5e, 0xaf, 0x3e, 0xaf, 0x5e, 0x02, 0xaf, 0x3e, 0x80, 0xaf, 0x3d, 0x02, 0xaf, 0x5e, 0x01, 0xaf, 0x3d, 0x03, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x03, 0xaf, 0x3e, 0x84, 0xae, 0xfd, 0xcb, 0x56, 0xca, 0x53, 0xca, 0x74, 0xd2, 0x53, 0x01, 0xd2, 0x74, 0x81, 0xd2, 0x73, 0xca, 0x73, 0x07, 0xd2, 0x74, 0x81, 0xd2, 0x54, 0xca, 0x74, 0x01, 0xca, 0x54, 0x80, 0xca, 0x74,
+  0x02, 0xca, 0x53, 0x03, 0xa7, 0x3e, 0x03, 0xa7, 0x3d, 0x85, 0x94, 0x57, 0x81, 0x91, 0x99, 0x31, 0xb8, 0xd1, 0xb0, 0xd1, 0xb8, 0xd1, 0x02, 0xb0, 0xd1, 0x83, 0xb0, 0xf1, 0xb0, 0xd1, 0xb1, 0xb3, 0xad, 0x9a, 0x01, 0xaf, 0x3d, 0x01, 0xa7, 0x3d, 0x85, 0x9d, 0xda, 0x89, 0xd1, 0x99, 0x51, 0xb0, 0xf1, 0xb0, 0xd1, 0xb0, 0xf1, 0x02, 0xb0, 0xd1, 0x01, 0xb8, 0xd1, 0x02, 0xb0, 0xd1, 0x84, 0xb0, 0xf1, 0xb2, 0x13, 0xad, 0x9b, 0xa7, 0x3e, 0xa7, 0x3d, 0x01, 0xaf, 0x3e, 0x82, 0x9d, 0xda, 0x81, 0xf2, 0x91, 0x71, 0x01, 0xb0, 0xf1, 0x81, 0xb0, 0xd1, 0xb0, 0xf1, 0x01, 0xb0, 0xd1, 0x85, 0xb8, 0xd1, 0xb8, 0xd2, 0xb0, 0xf1, 0xad, 0x39, 0xa7, 0x3d, 0xa7, 0x3e, 0x04, 0xa7, 0x3d, 0x80, 0xa7, 0x3e, 0x02, 0xa7, 0x3d, 0x80, 0xaf, 0x3d, 0x02, 0xa7, 0x3d, 0x01, 0xa7, 0x3e, 0x81, 0xa7, 0x3d, 0xaf, 0x3d, 0x01, 0xa7, 0x3d, 0x81, 0xa7, 0x3e, 0xaf, 0x3d, 0x01, 0xa7, 0x3e, 0x81, 0xa7, 0x3d, 0xaf, 0x3d, 0x01, 0xa7, 0x3d, 0x82, 0xa7, 0x3e, 0xaf, 0x3e, 0xaf, 0x1e, 0x07, 0xa7, 0x3e, 0x84, 0xaf, 0x3e, 0xa7, 0x3e, 0xa7, 0x3d, 0xaf, 0x3e, 0xa7, 0x3e, 0x02, 0xa7, 0x3d, 0x80, 0xaf, 0x3d, 0x02, 0xa7, 0x3e, 0x83, 0xa7, 0x3d, 0xaf, 0x3d, 0xa7, 0x3d, 0xaf, 0x3d, 0x01, 0xa7, 0x3e, 0x81, 0xaf, 0x3d, 0xa7, 0x3e, 0x01, 0xa7, 0x3d, 0x83, 0xa7, 0x3e, 0x94, 0x78, 0x81, 0x91, 0x99, 0x31, 0x05, 0xb0, 0xd1, 0x84, 0xb8, 0xd1, 0xad, 0x9a, 0xa7, 0x3e, 0xa7, 0x3d, 0xa7, 0x3e, 0x02, 0xa7, 0x3d, 0x80, 0xaf, 0x3d, 0x04, 0xa7, 0x3d, 0x80, 0xaf, 0x3d, 0x02, 0xa7, 0x3d, 0x81, 0xaf, 0x3e, 0xa7, 0x3e, 0x02, 0xa7, 0x3d, 0x84, 0xaf, 0x3d, 0xaf, 0x3e, 0xa7, 0x3d, 0xaf, 0x3d, 0xaf, 0x3e, 0x01, 0xa7, 0x3d, 0x81, 0xaf, 0x3d, 0xa7, 0x3e, 0x02, 0xaf, 0x3d, 0x80, 0xa7, 0x3e, 0x01, 0xa7, 0x3d, 0x83, 0xaf, 0x3d, 0xa7, 0x3d, 0xae, 0xdd, 0xc3, 0x76, 0x03, 0xca, 0x53, 0x80, 0xca, 0x33, 0x08, 0xca, 0x53, 0x82, 0xd2, 0x33, 0xca, 0x53, 0xd2, 0x53, 0x01, 0xca, 0x53,
+  0x82, 0xca, 0x13, 0xca, 0x33, 0xca, 0x13, 0x04, 0xa7, 0x1d, 0x02, 0xa7, 0x3d, 0x82, 0x8a, 0x53, 0x81, 0x91, 0xa8, 0xf1, 0x02, 0xb8, 0xd1, 0x80, 0xb0, 0xd1, 0x02, 0xb8, 0xd1, 0x83, 0xb2, 0x13, 0xa6, 0xbd, 0xa7, 0x1d, 0xa7, 0x3e, 0x03, 0xa7, 0x1d, 0x83, 0x9e, 0x1b, 0x81, 0xf1, 0x91, 0x71, 0xb0, 0xf1, 0x08, 0xb8, 0xd1, 0x81, 0xb1, 0xf3, 0xa6, 0xbd, 0x03, 0xa7, 0x1d, 0x84, 0xa7, 0x3d, 0xa7, 0x1d, 0x9e, 0x1b, 0x89, 0xf2, 0x89, 0x91, 0x05, 0xb8, 0xd1, 0x82, 0xb0, 0xd1, 0xb8, 0xd1, 0xb3, 0x36, 0x09, 0xa7, 0x1d, 0x02, 0xa7, 0x3d, 0x01, 0xa7, 0x1d, 0x82, 0xa7, 0x3d, 0xa7, 0x1d, 0xa7, 0x1e, 0x01, 0xa7, 0x1d, 0x81, 0xa7, 0x3d, 0xa7, 0x3e, 0x02, 0xa7, 0x1d, 0x83, 0xa7, 0x3e, 0xa7, 0x1d, 0xa7, 0x3e, 0xa7, 0x3d, 0x01, 0xa7, 0x1d, 0x80, 0xa7, 0x3d, 0x09, 0xa7, 0x1d, 0x02, 0xa7, 0x3d, 0x81, 0xa7, 0x3e, 0xa7, 0x1d, 0x01, 0xa7, 0x3d, 0x05, 0xa7, 0x1d, 0x80, 0xa7, 0x3d, 0x01, 0xa7, 0x1d, 0x80, 0xa7, 0x3e, 0x01, 0xa7, 0x3d, 0x01, 0xa7, 0x1d, 0x82, 0x94, 0x77, 0x81, 0x91, 0x99, 0x31, 0x06, 0xb8, 0xd1, 0x83, 0xa5, 0x9a, 0xa7, 0x1d, 0xa7, 0x3d, 0xa7, 0x3e, 0x01, 0xa7, 0x1d, 0x81, 0xa7, 0x1e, 0xa7, 0x3d, 0x07, 0xa7, 0x1d, 0x01, 0xa7, 0x3d, 0x84, 0xa7, 0x1e, 0xa7, 0x1d, 0xa7, 0x3d, 0xa7, 0x1d, 0xa7, 0x3d, 0x05, 0xa7, 0x1d, 0x01, 0xa7, 0x3d, 0x80, 0xa7, 0x1d, 0x01, 0xa7, 0x3d, 0x81, 0xa7, 0x1d, 0xa7, 0x3e, 0x04, 0xa7, 0x1d, 0x83, 0xbb, 0xf7, 0xca, 0x13, 0xca, 0x33, 0xca, 0x13, 0x09, 0xca, 0x33, 0x01, 0xca, 0x13, 0x82, 0xca, 0x14, 0xd2, 0x33, 0xca, 0x33,
+  0x02, 0xca, 0x13, 0x01, 0x9f, 0x1d, 0x80, 0xa7, 0x1d, 0x01, 0x9f, 0x1d, 0x80, 0xa7, 0x1d, 0x01, 0x9f, 0x1d, 0x01, 0x81, 0x91, 0x07, 0xb8, 0xd1, 0x80, 0xa5, 0xdb, 0x01, 0x9f, 0x1d, 0x80, 0x9e, 0xfd, 0x02, 0x9f, 0x1d, 0x84, 0xa6, 0xfd, 0x9f, 0x1d, 0x94, 0xf9, 0x81, 0x91, 0x99, 0x31, 0x01, 0xb8, 0xd1, 0x80, 0xb8, 0xb1, 0x04, 0xb8, 0xd1, 0x81, 0xb8, 0xb1, 0xa5, 0xdb, 0x03, 0x9f, 0x1d, 0x80, 0xa6, 0xfd, 0x02, 0x9f, 0x1d, 0x82, 0x94, 0xf9, 0x81, 0x91, 0x99, 0x31, 0x06, 0xb8, 0xd1, 0x80, 0xb9, 0x32, 0x02, 0x9f, 0x1d, 0x80, 0x9f, 0x1e, 0x04, 0x9f, 0x1d, 0x84, 0x9e, 0x1b, 0x94, 0x57, 0x92, 0xd4, 0xa1, 0xf3, 0xa9, 0x11, 0x01, 0xb0, 0xf1, 0x81, 0xa9, 0x11, 0xb2, 0x74, 0x01, 0xb2, 0x54, 0x81, 0xab, 0xf7, 0xa5, 0xdb, 0x01, 0xa6, 0xfd, 0x01, 0xa7, 0x1d, 0x01, 0x9f, 0x1d, 0x80, 0xa6, 0xfd, 0x01, 0x9f, 0x1d, 0x80, 0xa7, 0x1d, 0x0a, 0x9f, 0x1d, 0x8c, 0x9e, 0x7c, 0x94, 0x98, 0x8b, 0x14, 0x9a, 0x13, 0xa1, 0x31, 0xa9, 0x12, 0xb0, 0xf1, 0xa8, 0xf1, 0xb2, 0x55, 0xb2, 0x74, 0xb2, 0x54, 0xab, 0x97, 0xad, 0x1a, 0x03, 0x9f, 0x1d, 0x85, 0xa7, 0x1d, 0x9f, 0x1d, 0xa7, 0x1d, 0x94, 0x57, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xb8, 0xd1, 0x87, 0xa5, 0x7a, 0x9f, 0x1d, 0xa7, 0x1d, 0x9f, 0x1d, 0xa7, 0x1d, 0x9e, 0x7c, 0x9d, 0xba, 0xa5, 0x9a, 0x06, 0xa5, 0x7a, 0x80, 0xa6, 0x9c, 0x02, 0x9f, 0x1d, 0x80, 0xa7, 0x1d, 0x06, 0x9f, 0x1d, 0x85, 0x9e, 0x5c, 0x94, 0xb8, 0x8a, 0xf4, 0x9a, 0x13, 0xa1, 0x31, 0xa8, 0xf1, 0x01, 0xb0, 0xf1, 0x88, 0xb9, 0x32, 0xb2, 0x74, 0xb2, 0x54, 0xb3, 0x36, 0xac, 0xb9, 0xa6, 0x3c, 0x9f, 0x1d, 0xbb, 0xf7, 0xc9, 0xf3, 0x02, 0xca, 0x13, 0x07, 0xc9, 0xf3, 0x04, 0xca, 0x13,
+  0x02, 0xc9, 0xd3, 0x06, 0x9e, 0xfd, 0x87, 0x95, 0x9a, 0x81, 0x91, 0x91, 0x51, 0xc0, 0xb1, 0xb8, 0xd1, 0xc0, 0xb1, 0xb8, 0xd1, 0xc0, 0xd1, 0x01, 0xb8, 0xd1, 0x80, 0xb2, 0xb5, 0x09, 0x9e, 0xfd, 0x81, 0x82, 0x52, 0x81, 0x91, 0x03, 0xb8, 0xd1, 0x84, 0xc0, 0xb1, 0xc0, 0xd1, 0xb8, 0xd1, 0xc0, 0xd1, 0xb1, 0xf3, 0x04, 0x9e, 0xfd, 0x80, 0x9f, 0x1d, 0x03, 0x9e, 0xfd, 0x81, 0x8a, 0x93, 0x81, 0x91, 0x01, 0xb8, 0xd1, 0x80, 0xc0, 0xd1, 0x03, 0xb8, 0xd1, 0x81, 0xc0, 0xb1, 0xa6, 0x3c, 0x05, 0x9e, 0xfd, 0x83, 0x94, 0xf8, 0x8a, 0x53, 0x91, 0x71, 0xb0, 0xf1, 0x02, 0xb8, 0xd1, 0x01, 0xb8, 0xb1, 0x80, 0xc0, 0xb1, 0x01, 0xc0, 0xd1, 0x84, 0xb8, 0xd1, 0xc0, 0xd1, 0xb8, 0xb1, 0xb9, 0x92, 0xac, 0xb9, 0x10, 0x9e, 0xfd, 0x83, 0x9e, 0x5c, 0x8b, 0x96, 0x89, 0x91, 0xa1, 0x31, 0x01, 0xb8, 0xd1, 0x80, 0xc0, 0xb1, 0x05, 0xb8, 0xd1, 0x84, 0xc0, 0xb1, 0xb8, 0xd1, 0xb9, 0x32, 0xab, 0xf7, 0x9e, 0x9c, 0x03, 0x9e, 0xfd, 0x85, 0x94, 0x37, 0x81, 0x91, 0xa1, 0x31, 0xb8, 0xd1, 0xc0, 0xb1, 0xb8, 0xd1, 0x01, 0xc0, 0xb1, 0x01, 0xb8, 0xd1, 0x80, 0xa5, 0x7a, 0x03, 0x9e, 0xfd, 0x84, 0x94, 0x37, 0x81, 0x91, 0xa1, 0x31, 0xb8, 0xd1, 0xc0, 0xb1, 0x01, 0xb8, 0xd1, 0x80, 0xc0, 0xb1, 0x01, 0xb8, 0xd1, 0x80, 0xa5, 0x7a, 0x08, 0x9e, 0xfd, 0x83, 0x9e, 0x9c, 0x8b, 0x96, 0x89, 0x71, 0xa1, 0x31, 0x01, 0xb8, 0xd1, 0x83, 0xc0, 0xb1, 0xb8, 0xd1, 0xc0, 0xb1, 0xc0, 0xd1, 0x01, 0xb8, 0xd1, 0x80, 0xc0, 0xd1, 0x01, 0xb8, 0xd1, 0x85, 0xc0, 0xd1, 0xb3, 0x35, 0xa6, 0x3c, 0xbb, 0xd7, 0xc9, 0xd3, 0xc9, 0xf3, 0x08, 0xc9, 0xd3, 0x80, 0xc9, 0xf3, 0x01, 0xc9, 0xd3, 0x81, 0xc9, 0xf3, 0xc9, 0xd3,
+  0x02, 0xc9, 0xb3, 0x84, 0x9e, 0xdd, 0x96, 0xfd, 0x9e, 0xdd, 0x96, 0xfd, 0x9e, 0xfc, 0x01, 0x96, 0xfd, 0x84, 0x95, 0x99, 0x89, 0x91, 0x91, 0x71, 0xc0, 0xb1, 0xc0, 0xd1, 0x03, 0xc0, 0xb1, 0x82, 0xc0, 0xd1, 0xab, 0xd7, 0x9e, 0xfc, 0x01, 0x96, 0xfd, 0x89, 0x96, 0xdd, 0x96, 0xfd, 0x9e, 0xfd, 0x9e, 0xdd, 0x96, 0xfd, 0x9e, 0xdd, 0x9e, 0xfd, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x11, 0x01, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x83, 0xc0, 0xd1, 0xc0, 0xb1, 0xab, 0x76, 0x9e, 0xdd, 0x01, 0x9e, 0xfd, 0x01, 0x9e, 0xdd, 0x88, 0x96, 0xdd, 0x9e, 0xfd, 0x9e, 0xdd, 0x96, 0xfd, 0x9e, 0xdd, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x89, 0xc0, 0xd1, 0xa5, 0x5a, 0x96, 0xfd, 0x9e, 0xdd, 0x9e, 0xfd, 0x96, 0xfd, 0x96, 0x3b, 0x8a, 0xf4, 0x89, 0x91, 0xa9, 0x11, 0x01, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x03, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x03, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x87, 0xb9, 0x92, 0xa5, 0x5a, 0x9e, 0xdd, 0x9e, 0xfc, 0x96, 0xfd, 0x9e, 0xdd, 0x96, 0xfd, 0x9e, 0xfd, 0x07, 0x96, 0xfd, 0x84, 0x94, 0xf9, 0x81, 0xf1, 0x91, 0x71, 0xb8, 0xd2, 0xc0, 0xb1, 0x01, 0xc0, 0xd1, 0x83, 0xc0, 0xb1, 0xc0, 0xd1, 0xc0, 0xb1, 0xc0, 0xd1, 0x06, 0xc0, 0xb1, 0x87, 0xb9, 0x92, 0x9d, 0xbb, 0x96, 0xfd, 0x9e, 0xdd, 0x96, 0xfd, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x81, 0xa5, 0x5a, 0x9e, 0xdd, 0x01, 0x96, 0xfd, 0x83, 0x9e, 0xfd, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x83, 0xa5, 0x5a, 0x96, 0xfd, 0x9e, 0xfd, 0x96, 0xfd, 0x01, 0x9e, 0xfd, 0x86, 0x96, 0xfd, 0x9e, 0xfd, 0x96, 0xfd, 0x95, 0x39, 0x81, 0xf1, 0x91, 0x71, 0xb0, 0xd1, 0x02, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x05, 0xc0, 0xb1, 0x83, 0xb8, 0xd1, 0xb9, 0x11, 0xac, 0xfa, 0xb4, 0x58, 0x0a, 0xc9, 0xb3, 0x80, 0xc9, 0xd2, 0x01, 0xc9, 0xd3, 0x80, 0xc9, 0xb3,
+  0x01, 0xc9, 0x93, 0x81, 0xc9, 0x92, 0x96, 0xdc, 0x05, 0x96, 0xdd, 0x82, 0x8d, 0x79, 0x81, 0x91, 0x91, 0x51, 0x06, 0xc0, 0xb1, 0x80, 0xab, 0xd7, 0x09, 0x96, 0xdd, 0x82, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x80, 0xab, 0xd7, 0x09, 0x96, 0xdd, 0x82, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x80, 0x9d, 0x5a, 0x02, 0x96, 0xdd, 0x83, 0x95, 0xda, 0x89, 0xf2, 0x89, 0x71, 0xb8, 0xd1, 0x01, 0xc0, 0xb1, 0x80, 0xc8, 0xb1, 0x0e, 0xc0, 0xb1, 0x80, 0xa4, 0x99, 0x04, 0x96, 0xdd, 0x80, 0x96, 0xdc, 0x05, 0x96, 0xdd, 0x82, 0x8c, 0x37, 0x81, 0x91, 0x99, 0x31, 0x0b, 0xc0, 0xb1, 0x80, 0xc8, 0xb1, 0x04, 0xc0, 0xb1, 0x85, 0xa4, 0x99, 0x96, 0xdc, 0x96, 0xdd, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x11, 0x06, 0xc0, 0xb1, 0x80, 0x9d, 0x5a, 0x03, 0x96, 0xdd, 0x82, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x80, 0x9d, 0x5a, 0x06, 0x96, 0xdd, 0x82, 0x8c, 0xd8, 0x81, 0x91, 0x99, 0x51, 0x05, 0xc0, 0xb1, 0x80, 0xc8, 0xb1, 0x02, 0xc0, 0xb1, 0x80, 0xc8, 0xb1, 0x06, 0xc0, 0xb1, 0x84, 0xac, 0x79, 0xac, 0xf9, 0xc9, 0x92, 0xc9, 0x93, 0xc9, 0xb2, 0x01, 0xc9, 0x92, 0x02, 0xc9, 0x93, 0x02, 0xc9, 0x92, 0x02, 0xc9, 0x93,
+  0x02, 0xc9, 0x72, 0x80, 0x8e, 0xbc, 0x01, 0x8e, 0xbd, 0x02, 0x8e, 0xbc, 0x83, 0x8e, 0xbd, 0x8d, 0x7a, 0x81, 0x91, 0x91, 0x51, 0x04, 0xc0, 0xb1, 0x83, 0xc8, 0xb1, 0xc0, 0xb1, 0xab, 0xb7, 0x8e, 0xbd, 0x07, 0x8e, 0xbc, 0x85, 0x8e, 0xbd, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0xc0, 0xb1, 0xc8, 0xb1, 0x02, 0xc0, 0xb1, 0x82, 0xc8, 0xb1, 0xc0, 0xb1, 0xab, 0xb7, 0x02, 0x8e, 0xbc, 0x82, 0x8e, 0xdc, 0x8e, 0xbc, 0x8e, 0xdd, 0x01, 0x8e, 0xbc, 0x84, 0x8e, 0xbd, 0x8e, 0xbc, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x85, 0x9d, 0x39, 0x8e, 0xbd, 0x8e, 0xdd, 0x8d, 0xba, 0x81, 0xf2, 0x91, 0x71, 0x01, 0xc0, 0xb1, 0x87, 0xc8, 0xb1, 0xc0, 0xb1, 0xc0, 0xd1, 0xc0, 0xb1, 0xc8, 0xb1, 0xc8, 0xb2, 0xc0, 0xb1, 0xc8, 0xb2, 0x01, 0xc8, 0xb1, 0x81, 0xc0, 0xd1, 0xc0, 0xb1, 0x01, 0xc0, 0xd1, 0x80, 0xc8, 0xb1, 0x01, 0xc0, 0xb1, 0x86, 0xc8, 0xb1, 0xc0, 0xb1, 0xa4, 0x37, 0x8e, 0xbc, 0x8e, 0xdd, 0x8e, 0xbc, 0x8e, 0xbd, 0x01, 0x8e, 0xbc, 0x81, 0x8e, 0xbd, 0x8e, 0xbc, 0x01, 0x8e, 0xbd, 0x82, 0x8c, 0xd8, 0x81, 0x91, 0xa1, 0x31, 0x01, 0xc0, 0xb1, 0x80, 0xc8, 0xb1, 0x01, 0xc0, 0xb1, 0x83, 0xc8, 0xb2, 0xc8, 0xb1, 0xc0, 0xb1, 0xc8, 0xb1, 0x02, 0xc0, 0xb1, 0x01, 0xc8, 0xb1, 0x02, 0xc0, 0xb1, 0x8a, 0xc8, 0xb1, 0xc0, 0xb1, 0xc8, 0xb1, 0xa4, 0xd9, 0x8e, 0xbc, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0xc0, 0xb1, 0xc8, 0xb1, 0xc0, 0xd1, 0x02, 0xc0, 0xb1, 0x81, 0xc8, 0xb1, 0x9d, 0x3a, 0x03, 0x8e, 0xbc, 0x82, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x80, 0x9d, 0x5a, 0x01, 0x8e, 0xbc, 0x80, 0x8e, 0xdc, 0x02, 0x8e, 0xbc, 0x89, 0x8c, 0xd8, 0x81, 0x91, 0x99, 0x51, 0xc8, 0xb1, 0xc0, 0xb1, 0xc8, 0xb1, 0xc8, 0xb2, 0xc8, 0xb1, 0xc0, 0xb1, 0xc8, 0xb1, 0x02, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x04, 0xc0, 0xb1, 0x02, 0xc8, 0xb1, 0x82, 0xc8, 0xd1, 0xa4, 0x78, 0xa4, 0xd9, 0x0c, 0xc9, 0x72,
+  0x02, 0xc9, 0x52, 0x06, 0x8e, 0xbc, 0x84, 0x8d, 0x59, 0x81, 0x91, 0x91, 0x71, 0xc8, 0xf2, 0xc8, 0xf1, 0x02, 0xc8, 0xf2, 0x82, 0xc8, 0xf1, 0xc8, 0xf2, 0xab, 0xd7, 0x09, 0x8e, 0xbc, 0x84, 0x8c, 0x36, 0x81, 0x91, 0xa9, 0x31, 0xc8, 0xf2, 0xc8, 0xf1, 0x03, 0xc8, 0xf2, 0x81, 0xc0, 0xf2, 0xab, 0xb7, 0x09, 0x8e, 0xbc, 0x82, 0x84, 0x37, 0x81, 0x91, 0xa9, 0x51, 0x01, 0xc8, 0xf1, 0x80, 0xc8, 0xf2, 0x01, 0xc8, 0xf1, 0x87, 0xc8, 0xf2, 0xc8, 0xf1, 0x9d, 0x3a, 0x8e, 0xbc, 0x8e, 0x1b, 0x81, 0xf2, 0x89, 0x71, 0xb9, 0x12, 0x01, 0xc8, 0xf1, 0x80, 0xc8, 0xf2, 0x02, 0xc8, 0xf1, 0x82, 0xc8, 0xf2, 0xc8, 0xd1, 0xc1, 0x12, 0x02, 0xc8, 0xf2, 0x8a, 0xc8, 0xd1, 0xc8, 0xf2, 0xc8, 0xd1, 0xc8, 0xf2, 0xc0, 0xf1, 0xc8, 0xf1, 0xc8, 0xf2, 0xc8, 0xf1, 0xc8, 0xf2, 0xc0, 0xf1, 0xa4, 0x98, 0x07, 0x8e, 0xbc, 0x80, 0x8d, 0xba, 0x01, 0x89, 0x91, 0x8e, 0xc0, 0xf1, 0xc8, 0xf2, 0xc0, 0xf2, 0xc8, 0xf1, 0xc8, 0xf2, 0xc8, 0xf1, 0xc0, 0xf1, 0xc8, 0xf2, 0xc8, 0xf1, 0xc8, 0xf2, 0xc0, 0xf2, 0xc8, 0xf1, 0xc0, 0xf1, 0xc8, 0xf2, 0xc8, 0xf1, 0x02, 0xc8, 0xf2, 0x01, 0xc8, 0xf1, 0x85, 0xc0, 0xf2, 0xc1, 0x32, 0x8e, 0x5c, 0x8c, 0x17, 0x81, 0x91, 0xa9, 0x31, 0x03, 0xc8, 0xf2, 0x80, 0xc8, 0xf1, 0x01, 0xc8, 0xf2, 0x80, 0x9d, 0x59, 0x03, 0x8e, 0xbc, 0x82, 0x8c, 0x17, 0x81, 0x91, 0xa9, 0x51, 0x01, 0xc8, 0xf1, 0x80, 0xc8, 0xf2, 0x01, 0xc8, 0xf1, 0x82, 0xc8, 0xf2, 0xc8, 0xf1, 0x9d, 0x5a, 0x03, 0x8e, 0xbc, 0x84, 0x8e, 0xbd, 0x8d, 0xba, 0x81, 0xf2, 0x89, 0x91, 0xc1, 0x11, 0x02, 0xc8, 0xf1, 0x80, 0xc0, 0xf2, 0x01, 0xc8, 0xf1, 0x83, 0xc0, 0xf2, 0xc8, 0xd2, 0xc8, 0xf1, 0xc8, 0xf2, 0x01, 0xc0, 0xf1, 0x82, 0xc8, 0xf2, 0xc0, 0xf1, 0xc8, 0xf1, 0x01, 0xc8, 0xf2, 0x01, 0xc8, 0xf1, 0x84, 0xc8, 0xf2, 0xc1, 0x52, 0x95, 0xfb, 0xa4, 0xb8, 0xc1, 0x52, 0x02, 0xc9, 0x52, 0x80, 0xc9, 0x72, 0x06, 0xc9, 0x52,
+  0x02, 0xc9, 0x32, 0x06, 0x8e, 0xbc, 0x84, 0x8d, 0x79, 0x81, 0x91, 0x91, 0x71, 0xc1, 0x32, 0xc1, 0x31, 0x01, 0xc9, 0x12, 0x83, 0xc1, 0x32, 0xc9, 0x11, 0xc9, 0x12, 0xab, 0xf7, 0x08, 0x8e, 0xbc, 0x85, 0x96, 0xbc, 0x8c, 0x36, 0x81, 0x91, 0xa9, 0x51, 0xc9, 0x12, 0xc9, 0x11, 0x01, 0xc9, 0x12, 0x80, 0xc1, 0x12, 0x01, 0xc9, 0x12, 0x80, 0xab, 0xf7, 0x09, 0x8e, 0xbc, 0x82, 0x8c, 0x36, 0x81, 0x91, 0xa9, 0x51, 0x02, 0xc9, 0x12, 0x01, 0xc9, 0x11, 0x01, 0xc9, 0x12, 0x86, 0x9d, 0x59, 0x8e, 0xbc, 0x8a, 0xd4, 0x81, 0x91, 0xb1, 0x52, 0xc9, 0x12, 0xc1, 0x31, 0x05, 0xc9, 0x12, 0x80, 0xc9, 0x32, 0x03, 0xc9, 0x12, 0x82, 0xc9, 0x11, 0xc1, 0x12, 0xc9, 0x32, 0x01, 0xc9, 0x12, 0x81, 0xc9, 0x32, 0xc9, 0x11, 0x01, 0xc9, 0x12, 0x93, 0xc9, 0x32, 0xc1, 0x31, 0x9d, 0xba, 0x8e, 0xbc, 0x96, 0xbc, 0x8e, 0xbc, 0x8e, 0xdc, 0x96, 0xbb, 0x8e, 0xbc, 0x8e, 0xdc, 0x82, 0xd4, 0x81, 0x91, 0xb9, 0x32, 0xc9, 0x12, 0xc1, 0x12, 0xc9, 0x12, 0xc1, 0x12, 0xc9, 0x12, 0xc1, 0x12, 0xc9, 0x12, 0x01, 0xc9, 0x11, 0x85, 0xc9, 0x32, 0xc9, 0x11, 0xc1, 0x31, 0xc9, 0x12, 0xc1, 0x32, 0xc1, 0x31, 0x01, 0xc9, 0x12, 0x01, 0xc9, 0x11, 0x80, 0xc1, 0x31, 0x01, 0xc9, 0x12, 0x83, 0xb3, 0x56, 0x8c, 0x36, 0x81, 0x91, 0xa1, 0x51, 0x05, 0xc9, 0x12, 0x83, 0xc1, 0x12, 0x9d, 0x59, 0x8e, 0xbc, 0x96, 0xbc, 0x01, 0x8e, 0xbc, 0x82, 0x8c, 0x37, 0x81, 0x91, 0xa9, 0x51, 0x02, 0xc9, 0x12, 0x01, 0xc9, 0x11, 0x01, 0xc9, 0x12, 0x80, 0x9d, 0x59, 0x02, 0x8e, 0xbc, 0x84, 0x96, 0xbc, 0x8e, 0xbc, 0x82, 0xf4, 0x89, 0x91, 0xb1, 0x51, 0x01, 0xc9, 0x12, 0x80, 0xc9, 0x32, 0x01, 0xc9, 0x12, 0x82, 0xc1, 0x31, 0xc9, 0x32, 0xc9, 0x12, 0x01, 0xc9, 0x11, 0x83, 0xc9, 0x32, 0xc9, 0x11, 0xc9, 0x12, 0xc9, 0x11, 0x01, 0xc9, 0x32, 0x82, 0xc1, 0x12, 0xc9, 0x11, 0xc1, 0x32, 0x01, 0xc9, 0x12, 0x84, 0xc9, 0x32, 0xb3, 0x36, 0x96, 0xbc, 0xa4, 0xf9, 0xc1, 0x92, 0x09, 0xc9, 0x32,
+  0x02, 0xc9, 0x12, 0x02, 0x9e, 0xdb, 0x80, 0x9e, 0xdc, 0x02, 0x9e, 0xdb, 0x82, 0x95, 0x78, 0x81, 0x91, 0x99, 0x91, 0x06, 0xc9, 0x52, 0x80, 0xb4, 0x17, 0x09, 0x9e, 0xdb, 0x82, 0x94, 0x36, 0x81, 0x91, 0xa9, 0x72, 0x06, 0xc9, 0x52, 0x82, 0xa5, 0x18, 0x9e, 0xdb, 0x96, 0xdb, 0x07, 0x9e, 0xdb, 0x82, 0x94, 0x36, 0x81, 0x91, 0xa1, 0x71, 0x06, 0xc9, 0x52, 0x83, 0xa5, 0x79, 0x94, 0xd8, 0x81, 0x91, 0x99, 0x91, 0x04, 0xc9, 0x52, 0x80, 0xc1, 0x52, 0x04, 0xc9, 0x52, 0x85, 0xc2, 0x53, 0xc2, 0xb4, 0xb9, 0x52, 0xc1, 0x52, 0xc9, 0x52, 0xc1, 0x52, 0x07, 0xc9, 0x52, 0x80, 0xba, 0xb5, 0x05, 0x9e, 0xdb, 0x82, 0x95, 0x99, 0x81, 0x91, 0x91, 0xb1, 0x09, 0xc9, 0x52, 0x83, 0xc1, 0xf3, 0xc2, 0xb5, 0xb9, 0x52, 0xc1, 0x52, 0x04, 0xc9, 0x52, 0x80, 0xc9, 0x72, 0x01, 0xc9, 0x52, 0x84, 0xc9, 0x72, 0xc1, 0xb2, 0x94, 0x36, 0x81, 0x91, 0xa9, 0x72, 0x06, 0xc9, 0x52, 0x80, 0xa5, 0x79, 0x03, 0x9e, 0xdb, 0x82, 0x8c, 0x36, 0x89, 0x91, 0xa1, 0x71, 0x06, 0xc9, 0x52, 0x82, 0xa5, 0x79, 0x9e, 0xdb, 0x9e, 0xdc, 0x01, 0x9e, 0xdb, 0x82, 0x95, 0x98, 0x81, 0x91, 0x91, 0x91, 0x03, 0xc9, 0x52, 0x82, 0xc1, 0x52, 0xc9, 0x52, 0xc1, 0x72, 0x02, 0xc9, 0x52, 0x83, 0xc1, 0xf3, 0xc2, 0xb4, 0xb9, 0x52, 0xc1, 0x52, 0x09, 0xc9, 0x52, 0x84, 0xa6, 0x1a, 0x9e, 0xdc, 0xa5, 0xda, 0xc1, 0x72, 0xc9, 0x12, 0x01, 0xc9, 0x11, 0x01, 0xc9, 0x12, 0x80, 0xc1, 0x11, 0x02, 0xc9, 0x12,
+  0x01, 0xc8, 0xf1, 0x81, 0xc8, 0xf2, 0xa6, 0xfb, 0x01, 0xa6, 0xfa, 0x87, 0xa6, 0xfb, 0xa6, 0xfa, 0xa6, 0xda, 0xa6, 0xfa, 0x9d, 0x98, 0x81, 0x91, 0x91, 0x91, 0xc9, 0x72, 0x01, 0xc9, 0x92, 0x80, 0xc9, 0x72, 0x02, 0xc9, 0x92, 0x81, 0xb4, 0x36, 0xa6, 0xfb, 0x08, 0xa6, 0xfa, 0x82, 0x94, 0x36, 0x81, 0x91, 0xa9, 0x92, 0x01, 0xc9, 0x92, 0x02, 0xc9, 0x72, 0x01, 0xc9, 0x92, 0x80, 0xad, 0x98, 0x01, 0xa6, 0xda, 0x07, 0xa6, 0xfa, 0x83, 0x94, 0x36, 0x81, 0x91, 0xa9, 0x92, 0xc9, 0x93, 0x05, 0xc9, 0x92, 0x83, 0xad, 0x99, 0x8a, 0x32, 0x89, 0x91, 0xc1, 0x92, 0x01, 0xc9, 0x92, 0x80, 0xc9, 0x72, 0x01, 0xc9, 0x92, 0x80, 0xc9, 0x73, 0x02, 0xc9, 0x92, 0x81, 0xbc, 0x36, 0xa6, 0x9a, 0x01, 0xa6, 0xfa, 0x84, 0xa6, 0x9a, 0x93, 0x95, 0x89, 0x91, 0xb9, 0x92, 0xc9, 0x93, 0x01, 0xc9, 0x72, 0x01, 0xc9, 0x92, 0x81, 0xc9, 0x72, 0xc9, 0x92, 0x01, 0xc9, 0x72, 0x88, 0xad, 0x98, 0xa6, 0xdb, 0xa6, 0xda, 0xa6, 0xfa, 0xa6, 0xfb, 0xa6, 0xfa, 0x93, 0x95, 0x81, 0x91, 0xb1, 0x92, 0x02, 0xc9, 0x92, 0x80, 0xc9, 0x93, 0x01, 0xc9, 0x72, 0x8a, 0xc9, 0x92, 0xc9, 0x72, 0xc2, 0x33, 0xad, 0x98, 0xa6, 0xfa, 0xa6, 0xfb, 0xa6, 0x39, 0x8a, 0x93, 0x99, 0x92, 0xc1, 0x92, 0xc9, 0x72, 0x02, 0xc9, 0x92, 0x81, 0xc9, 0x72, 0xc9, 0x92, 0x01, 0xc9, 0x72, 0x82, 0x9a, 0x93, 0x81, 0x91, 0xa9, 0x92, 0x06, 0xc9, 0x92, 0x82, 0xad, 0x98, 0xa6, 0xfa, 0xa6, 0xfb, 0x01, 0xa6, 0xfa, 0x83, 0x94, 0x36, 0x81, 0x91, 0xa9, 0x92, 0xc9, 0x93, 0x05, 0xc9, 0x92, 0x80, 0xad, 0x98, 0x01, 0xa6, 0xda, 0x87, 0xa6, 0xfa, 0xa6, 0xda, 0x8b, 0x95, 0x81, 0x91, 0xb1, 0x92, 0xc9, 0x72, 0xc9, 0x92, 0xc9, 0x72, 0x01, 0xc9, 0x92, 0x8c, 0xc9, 0x72, 0xc9, 0x92, 0xc9, 0x72, 0xc2, 0x94, 0xad, 0xf9, 0xa6, 0xfa, 0xa6, 0xda, 0xa6, 0x9a, 0x93, 0x34, 0x91, 0x91, 0xb9, 0x92, 0xc9, 0x92, 0xc9, 0x93, 0x05, 0xc9, 0x92, 0x80, 0xb4, 0x97, 0x01, 0xae, 0xfb, 0x84, 0xb5, 0xd9, 0xc9, 0x52, 0xc8, 0xf1, 0xc8, 0xf2, 0xc0, 0xf1, 0x04, 0xc8, 0xf1,
+  0x01, 0xc0, 0xd1, 0x80, 0xc8, 0xd2, 0x02, 0xb7, 0x1a, 0x86, 0xae, 0xfa, 0xb7, 0x1a, 0xaf, 0x1a, 0xae, 0xfa, 0xa5, 0x98, 0x81, 0x91, 0x91, 0x91, 0x01, 0xc9, 0xb3, 0x01, 0xc9, 0xd3, 0x83, 0xc9, 0xb2, 0xc9, 0xb3, 0xc9, 0xd3, 0xbc, 0x76, 0x09, 0xb7, 0x1a, 0x82, 0x9c, 0x55, 0x81, 0x91, 0xa9, 0xb2, 0x01, 0xc9, 0xd3, 0x82, 0xc9, 0xb3, 0xc9, 0xb2, 0xc9, 0xb3, 0x01, 0xc9, 0xd3, 0x84, 0xb5, 0xb8, 0xb7, 0x1a, 0xaf, 0x1a, 0xb7, 0x1a, 0xb6, 0xfa, 0x03, 0xb7, 0x1a, 0x84, 0xb6, 0xfa, 0xaf, 0x1a, 0x9c, 0x56, 0x81, 0x91, 0xa9, 0x92, 0x06, 0xc9, 0xb3, 0x95, 0xa3, 0xb5, 0x81, 0x91, 0x99, 0x92, 0xc9, 0xb2, 0xc9, 0xb3, 0xc9, 0xd2, 0xc9, 0xb2, 0xc9, 0xb3, 0xc9, 0xb2, 0xc9, 0xb3, 0xc9, 0xd3, 0xca, 0x13, 0xbd, 0xb8, 0xae, 0xfa, 0xaf, 0x1a, 0xb7, 0x1a, 0xb6, 0xfa, 0xae, 0xfa, 0xaf, 0x19, 0xa4, 0xf7, 0x89, 0x91, 0xb1, 0xb2, 0x04, 0xc9, 0xb3, 0x80, 0xc9, 0xd2, 0x01, 0xc9, 0xb3, 0x80, 0xc3, 0x14, 0x01, 0xaf, 0x1a, 0x80, 0xae, 0xf9, 0x01, 0xaf, 0x1a, 0x82, 0x89, 0xf1, 0x81, 0x91, 0xc1, 0xb2, 0x02, 0xc9, 0xb3, 0x01, 0xc9, 0xb2, 0x8b, 0xc9, 0xd3, 0xc9, 0xb3, 0xca, 0xb4, 0xb6, 0xb9, 0xaf, 0x1a, 0xb7, 0x1a, 0xae, 0xfa, 0xb7, 0x1a, 0xb6, 0xb9, 0x8a, 0x93, 0x89, 0x91, 0xc1, 0xd2, 0x03, 0xc9, 0xb3, 0x88, 0xc9, 0xb2, 0xc9, 0xd3, 0xc9, 0xb2, 0xa9, 0x92, 0x81, 0x91, 0xa9, 0xb2, 0xc9, 0xd3, 0xc9, 0xb3, 0xc9, 0xd3, 0x02, 0xc9, 0xb2, 0x88, 0xc9, 0xb3, 0xb5, 0xb8, 0xaf, 0x1a, 0xae, 0xfa, 0xaf, 0x1a, 0xb7, 0x1a, 0x9c, 0x56, 0x81, 0x91, 0xa9, 0x92, 0x06, 0xc9, 0xb3, 0x81, 0xb5, 0xb8, 0xb6, 0xfa, 0x01, 0xaf, 0x1a, 0x86, 0xb6, 0xfa, 0x89, 0xf2, 0x81, 0x91, 0xc1, 0xb2, 0xc9, 0xb3, 0xc9, 0xb2, 0xc9, 0xd3, 0x01, 0xc9, 0xb3, 0x84, 0xc9, 0xb2, 0xc9, 0xd3, 0xca, 0xb4, 0xb6, 0xb9, 0xaf, 0x1a, 0x01, 0xb7, 0x1a, 0x85, 0xb6, 0xfa, 0xb7, 0x1a, 0x92, 0xf3, 0x89, 0xb1, 0xc1, 0xb2, 0xc9, 0xd3, 0x01, 0xc9, 0xb3, 0x01, 0xc9, 0xd3, 0x82, 0xc9, 0xb3, 0xc9, 0xd3, 0xc3, 0x15, 0x02, 0xb7, 0x1a, 0x82, 0xbd, 0xd9, 0xc1, 0x32, 0xc0, 0xd1, 0x03, 0xc8, 0xd1, 0x01, 0xc0, 0xd1,
+  0x82, 0xc0, 0xb1, 0xc8, 0xb1, 0xc0, 0xb1, 0x06, 0xbf, 0x19, 0x82, 0xa4, 0xb5, 0x81, 0x91, 0xa1, 0xb2, 0x05, 0xc9, 0xf3, 0x81, 0xd1, 0xf3, 0xc4, 0x96, 0x09, 0xbf, 0x19, 0x82, 0xa4, 0x55, 0x81, 0x91, 0xa9, 0xd2, 0x06, 0xc9, 0xf3, 0x80, 0xbd, 0xd8, 0x02, 0xbf, 0x19, 0x80, 0xbf, 0x39, 0x01, 0xbf, 0x19, 0x81, 0xbf, 0x39, 0xbf, 0x19, 0x01, 0xbf, 0x39, 0x82, 0xa4, 0x55, 0x81, 0x91, 0xa9, 0xd2, 0x06, 0xc9, 0xf3, 0x82, 0x99, 0xf2, 0x89, 0x91, 0xb1, 0xd2, 0x06, 0xc9, 0xf3, 0x82, 0xc9, 0xf2, 0xc5, 0x77, 0xbf, 0x19, 0x01, 0xbf, 0x39, 0x04, 0xbf, 0x19, 0x82, 0x9b, 0xf5, 0x81, 0x91, 0xb1, 0xd2, 0x01, 0xc9, 0xf3, 0x80, 0xd1, 0xf3, 0x04, 0xc9, 0xf3, 0x80, 0xbe, 0x78, 0x02, 0xbf, 0x19, 0x82, 0xb6, 0xb9, 0x81, 0x91, 0x89, 0x91, 0x01, 0xc9, 0xf3, 0x80, 0xc9, 0xf2, 0x01, 0xc9, 0xf3, 0x80, 0xc9, 0xd3, 0x01, 0xc9, 0xf3, 0x80, 0xbe, 0xd8, 0x04, 0xbf, 0x19, 0x85, 0xbf, 0x39, 0xad, 0x57, 0x81, 0x91, 0x99, 0xb2, 0xc9, 0xf3, 0xc9, 0xf2, 0x04, 0xc9, 0xf3, 0x82, 0xb9, 0xd3, 0x81, 0x91, 0xa9, 0xb2, 0x06, 0xc9, 0xf3, 0x80, 0xbd, 0xd8, 0x03, 0xbf, 0x19, 0x82, 0x9c, 0x75, 0x81, 0x91, 0xa9, 0xd2, 0x06, 0xc9, 0xf3, 0x80, 0xbd, 0xd8, 0x02, 0xbf, 0x19, 0x80, 0xb6, 0xb8, 0x01, 0x81, 0x91, 0x07, 0xc9, 0xf3, 0x84, 0xbe, 0x78, 0xbf, 0x19, 0xbf, 0x39, 0xbf, 0x19, 0xbf, 0x39, 0x01, 0xbf, 0x19, 0x82, 0xad, 0xb7, 0x81, 0x91, 0x91, 0xb1, 0x02, 0xc9, 0xf3, 0x80, 0xc9, 0xf2, 0x03, 0xc9, 0xf3, 0x87, 0xc7, 0x1a, 0xbf, 0x1a, 0xc7, 0x3a, 0xbf, 0x3a, 0xc6, 0x59, 0xc9, 0xd3, 0xc0, 0xb1, 0xc8, 0xb1, 0x01, 0xc0, 0xb1, 0x81, 0xc8, 0xb1, 0xc0, 0xb1,
+  0x02, 0xc0, 0xb1, 0x06, 0xc7, 0x38, 0x83, 0xa4, 0x75, 0x89, 0x91, 0xa9, 0xd2, 0xca, 0x13, 0x01, 0xca, 0x33, 0x81, 0xca, 0x34, 0xca, 0x13, 0x01, 0xca, 0x33, 0x80, 0xcc, 0xb6, 0x09, 0xc7, 0x38, 0x82, 0xa4, 0x55, 0x81, 0x91, 0xa9, 0xd2, 0x01, 0xca, 0x33, 0x80, 0xca, 0x13, 0x02, 0xca, 0x33, 0x81, 0xd2, 0x13, 0xc5, 0xf7, 0x03, 0xc7, 0x38, 0x80, 0xc7, 0x39, 0x04, 0xc7, 0x38, 0x83, 0xa4, 0x75, 0x81, 0x91, 0xa9, 0xd2, 0xca, 0x13, 0x03, 0xca, 0x33, 0x84, 0xca, 0x13, 0xca, 0x33, 0x91, 0xb1, 0x81, 0x91, 0xca, 0x13, 0x03, 0xca, 0x33, 0x85, 0xca, 0x13, 0xca, 0x33, 0xca, 0x13, 0xc4, 0x55, 0xc7, 0x38, 0xc7, 0x39, 0x03, 0xc7, 0x38, 0x80, 0xc7, 0x39, 0x02, 0xc7, 0x38, 0x82, 0x8a, 0x52, 0x89, 0x91, 0xc2, 0x13, 0x03, 0xca, 0x13, 0x83, 0xca, 0x33, 0xca, 0x13, 0xca, 0x33, 0xcd, 0x56, 0x01, 0xc7, 0x38, 0x83, 0xc7, 0x39, 0xb5, 0xd7, 0x81, 0x91, 0x91, 0xb1, 0x02, 0xca, 0x13, 0x80, 0xd2, 0x33, 0x02, 0xca, 0x33, 0x81, 0xcb, 0x55, 0xcf, 0x38, 0x04, 0xc7, 0x38, 0x81, 0xc7, 0x39, 0xc7, 0x38, 0x01, 0x81, 0x91, 0x02, 0xca, 0x13, 0x86, 0xca, 0x33, 0xca, 0x13, 0xca, 0x33, 0xd2, 0x33, 0xca, 0x13, 0x81, 0x91, 0xa9, 0xd2, 0x01, 0xca, 0x33, 0x01, 0xca, 0x13, 0x83, 0xca, 0x33, 0xca, 0x13, 0xca, 0x33, 0xcd, 0xf7, 0x02, 0xc7, 0x38, 0x84, 0xc7, 0x39, 0xa4, 0x75, 0x81, 0x91, 0xa9, 0xd2, 0xca, 0x13, 0x03, 0xca, 0x33, 0x82, 0xca, 0x13, 0xca, 0x33, 0xc5, 0xf7, 0x02, 0xc7, 0x38, 0x82, 0xb5, 0xd6, 0x81, 0x91, 0x99, 0xb2, 0x01, 0xca, 0x33, 0x80, 0xd2, 0x13, 0x03, 0xca, 0x33, 0x81, 0xcb, 0x74, 0xc7, 0x39, 0x03, 0xc7, 0x38, 0x80, 0xc7, 0x39, 0x01, 0xc7, 0x38, 0x82, 0x8a, 0xb2, 0x81, 0x91, 0xba, 0x13, 0x01, 0xca, 0x13, 0x81, 0xca, 0x33, 0xca, 0x13, 0x01, 0xca, 0x33, 0x87, 0xca, 0x13, 0xcf, 0x39, 0xc7, 0x39, 0xc7, 0x59, 0xcf, 0x3a, 0xcf, 0x39, 0xce, 0xd9, 0xc9, 0xf3, 0x04, 0xc0, 0xb1,
+  0x02, 0xc0, 0xb1, 0x80, 0xcf, 0x57, 0x01, 0xd7, 0x58, 0x89, 0xcf, 0x58, 0xd7, 0x58, 0xcf, 0x58, 0xd7, 0x58, 0xac, 0x74, 0x81, 0x91, 0xa9, 0xf2, 0xca, 0x53, 0xd2, 0x53, 0xca, 0x54, 0x02, 0xca, 0x53, 0x82, 0xca, 0x54, 0xcc, 0xd6, 0xcf, 0x58, 0x07, 0xd7, 0x58, 0x83, 0xcf, 0x58, 0xac, 0x75, 0x81, 0x91, 0xa9, 0xf2, 0x01, 0xca, 0x53, 0x80, 0xd2, 0x53, 0x02, 0xca, 0x53, 0x86, 0xd2, 0x54, 0xce, 0x17, 0xcf, 0x57, 0xd7, 0x58, 0xcf, 0x58, 0xd7, 0x58, 0xcf, 0x58, 0x01, 0xd7, 0x58, 0x88, 0xcf, 0x58, 0xd7, 0x58, 0xcf, 0x58, 0xac, 0x74, 0x81, 0x91, 0xa9, 0xf2, 0xca, 0x53, 0xca, 0x54, 0xd2, 0x53, 0x01, 0xca, 0x53, 0x83, 0xca, 0x54, 0xca, 0x53, 0x99, 0xd2, 0x89, 0xb1, 0x03, 0xca, 0x53, 0x80, 0xd2, 0x53, 0x01, 0xca, 0x53, 0x8e, 0xca, 0x54, 0xd6, 0xb7, 0xd7, 0x58, 0xcf, 0x58, 0xcf, 0x57, 0xcf, 0x58, 0xd7, 0x58, 0xd7, 0x57, 0xd7, 0x58, 0xd7, 0x57, 0xd7, 0x58, 0xcf, 0x58, 0xb5, 0x35, 0x81, 0x91, 0xa1, 0xd2, 0x02, 0xca, 0x53, 0x81, 0xd2, 0x54, 0xca, 0x73, 0x01, 0xca, 0x53, 0x80, 0xcc, 0x95, 0x01, 0xd7, 0x58, 0x83, 0xcf, 0x58, 0xbd, 0xd6, 0x81, 0x91, 0x99, 0xd2, 0x01, 0xca, 0x53, 0x80, 0xca, 0x54, 0x01, 0xca, 0x53, 0x82, 0xd2, 0x54, 0xca, 0x54, 0xd4, 0x35, 0x01, 0xd7, 0x58, 0x80, 0xcf, 0x58, 0x01, 0xd7, 0x58, 0x86, 0xcf, 0x57, 0xd7, 0x38, 0xcf, 0x58, 0x9a, 0xf3, 0x89, 0x91, 0xc2, 0x13, 0xca, 0x54, 0x01, 0xca, 0x53, 0x86, 0xd2, 0x53, 0xca, 0x53, 0xca, 0x54, 0xca, 0x73, 0x81, 0x91, 0xa9, 0xf2, 0xca, 0x53, 0x01, 0xd2, 0x53, 0x85, 0xca, 0x54, 0xd2, 0x53, 0xca, 0x53, 0xca, 0x54, 0xce, 0x17, 0xcf, 0x58, 0x01, 0xd7, 0x58, 0x86, 0xcf, 0x58, 0xac, 0x74, 0x81, 0x91, 0xa9, 0xf2, 0xca, 0x53, 0xca, 0x54, 0xd2, 0x53, 0x01, 0xca, 0x53, 0x83, 0xca, 0x54, 0xca, 0x53, 0xd6, 0x17, 0xd7, 0x58, 0x01, 0xcf, 0x58, 0x84, 0xbd, 0xd6, 0x81, 0x91, 0x91, 0xb2, 0xca, 0x53, 0xd2, 0x54, 0x01, 0xca, 0x53, 0x80, 0xca, 0x54, 0x01, 0xd2, 0x53, 0x80, 0xcc, 0xd6, 0x03, 0xd7, 0x58, 0x8d, 0xcf, 0x57, 0xd7, 0x57, 0xcf, 0x58, 0xd7, 0x58, 0x9a, 0xf3, 0x81, 0x91, 0xba, 0x33, 0xca, 0x54, 0xca, 0x53, 0xd2, 0x53, 0xca, 0x54, 0xca, 0x53, 0xd2, 0x53, 0xca, 0x53, 0x01, 0xd7, 0x58, 0x81, 0xdf, 0x59, 0xd7, 0x79, 0x01, 0xd7, 0x59, 0x81, 0xd6, 0xf9, 0xc1, 0xf2, 0x03, 0xc0, 0xb1,
+  0x02, 0xc0, 0xb1, 0x06, 0xdf, 0x77, 0x84, 0xb4, 0x94, 0x81, 0x91, 0xaa, 0x12, 0xca, 0x94, 0xca, 0x74, 0x03, 0xca, 0x94, 0x81, 0xd2, 0x94, 0xd4, 0xf5, 0x09, 0xdf, 0x77, 0x82, 0xb4, 0x74, 0x81, 0x91, 0xaa, 0x12, 0x01, 0xca, 0x94, 0x85, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0xde, 0x36, 0x01, 0xdf, 0x77, 0x80, 0xdf, 0x57, 0x06, 0xdf, 0x77, 0x83, 0xb4, 0x94, 0x81, 0x91, 0xaa, 0x12, 0xca, 0x94, 0x05, 0xd2, 0x94, 0x86, 0x99, 0xd2, 0x91, 0xd2, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x80, 0xd3, 0xd4, 0x02, 0xdf, 0x77, 0x80, 0xdf, 0x76, 0x04, 0xdf, 0x77, 0x80, 0xdf, 0x57, 0x01, 0xdf, 0x77, 0x81, 0x81, 0x91, 0x89, 0x92, 0x02, 0xca, 0x94, 0x84, 0xd2, 0x94, 0xca, 0x94, 0xca, 0x93, 0xca, 0x94, 0xd3, 0xd5, 0x02, 0xdf, 0x77, 0x82, 0xc5, 0xf5, 0x81, 0x91, 0x99, 0xd2, 0x01, 0xca, 0x94, 0x85, 0xd2, 0x73, 0xca, 0x94, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0xd5, 0x15, 0x07, 0xdf, 0x77, 0x82, 0x9b, 0x12, 0x81, 0x91, 0xba, 0x53, 0x01, 0xca, 0x94, 0x86, 0xd2, 0x94, 0xca, 0x94, 0xca, 0x93, 0xd2, 0x94, 0xca, 0x94, 0x81, 0x91, 0xaa, 0x12, 0x02, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x01, 0xd2, 0x94, 0x80, 0xde, 0x36, 0x01, 0xdf, 0x77, 0x85, 0xdf, 0x57, 0xdf, 0x77, 0xb4, 0x74, 0x81, 0x91, 0xaa, 0x12, 0xca, 0x94, 0x05, 0xd2, 0x94, 0x80, 0xde, 0x36, 0x02, 0xdf, 0x77, 0x83, 0xc5, 0xf5, 0x81, 0x91, 0x99, 0xd2, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x80, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x81, 0xca, 0x93, 0xd4, 0xf5, 0x07, 0xdf, 0x77, 0x83, 0x9b, 0x12, 0x81, 0x91, 0xba, 0x53, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x83, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0xca, 0x94, 0x05, 0xdf, 0x78, 0x81, 0xe7, 0x79, 0xdf, 0x19, 0x03, 0xc0, 0xb1,
+  0x01, 0xb8, 0xd1, 0x82, 0xc0, 0xd1, 0xe7, 0x76, 0xe7, 0x96, 0x01, 0xe7, 0x97, 0x02, 0xe7, 0x96, 0x82, 0xb4, 0x94, 0x81, 0x91, 0xaa, 0x33, 0x02, 0xd2, 0xb4, 0x81, 0xca, 0xb4, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x81, 0xdd, 0x35, 0xe7, 0x76, 0x08, 0xe7, 0x96, 0x82, 0xb4, 0x74, 0x81, 0x91, 0xaa, 0x33, 0x02, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x85, 0xca, 0xd4, 0xd2, 0xd4, 0xe6, 0x56, 0xef, 0x96, 0xe7, 0x76, 0xe7, 0x97, 0x01, 0xe7, 0x96, 0x81, 0xe7, 0x76, 0xe7, 0x77, 0x02, 0xe7, 0x96, 0x82, 0xb4, 0x94, 0x81, 0x91, 0xaa, 0x33, 0x06, 0xd2, 0xb4, 0x84, 0x99, 0xd2, 0x99, 0xf2, 0xca, 0xb4, 0xd2, 0xb4, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x85, 0xca, 0xd4, 0xd2, 0xb4, 0xd3, 0xf5, 0xe7, 0x77, 0xe7, 0x97, 0xef, 0x97, 0x01, 0xe7, 0x96, 0x81, 0xe7, 0x76, 0xe7, 0x77, 0x02, 0xe7, 0x96, 0x81, 0xe7, 0x77, 0xef, 0x97, 0x01, 0x81, 0x91, 0x01, 0xd2, 0xb4, 0x01, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x81, 0xca, 0xd4, 0xd3, 0xd5, 0x02, 0xe7, 0x96, 0x85, 0xce, 0x15, 0x81, 0x91, 0x99, 0xf2, 0xca, 0xd4, 0xd2, 0xb4, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x85, 0xca, 0xb4, 0xd2, 0xb4, 0xdd, 0x35, 0xe7, 0x77, 0xef, 0x76, 0xe7, 0x96, 0x01, 0xe7, 0x97, 0x86, 0xe7, 0x76, 0xe7, 0x96, 0xe7, 0x76, 0xc5, 0x34, 0xb4, 0x94, 0xcc, 0x15, 0xd3, 0xf5, 0x01, 0xdb, 0xf4, 0x85, 0xdb, 0xf5, 0xd3, 0xf5, 0xd3, 0xf4, 0xcb, 0x34, 0x81, 0x91, 0xaa, 0x32, 0x03, 0xd2, 0xb4, 0x84, 0xd2, 0xd4, 0xd2, 0xb4, 0xca, 0xb4, 0xe6, 0x56, 0xe7, 0x76, 0x01, 0xe7, 0x96, 0x83, 0xe7, 0x76, 0xb4, 0x94, 0x81, 0x91, 0xaa, 0x33, 0x06, 0xd2, 0xb4, 0x80, 0xde, 0x56, 0x02, 0xe7, 0x96, 0x82, 0xce, 0x15, 0x81, 0x91, 0x99, 0xf2, 0x01, 0xd2, 0xb4, 0x82, 0xd2, 0xd4, 0xd2, 0xb4, 0xd2, 0xd4, 0x01, 0xca, 0xd4, 0x80, 0xdd, 0x15, 0x01, 0xe7, 0x96, 0x82, 0xe7, 0x76, 0xe7, 0x96, 0xef, 0x96, 0x02, 0xe7, 0x96, 0x82, 0x9b, 0x13, 0x81, 0x91, 0xba, 0x73, 0x06, 0xd2, 0xb4, 0x84, 0xe7, 0x97, 0xef, 0x97, 0xef, 0x77, 0xef, 0x97, 0xef, 0x78, 0x02, 0xef, 0x98, 0x83, 0xc9, 0x92, 0xb8, 0xd1, 0xc0, 0xd1, 0xc0, 0xb1,
+  0x02, 0xb8, 0xd1, 0x82, 0xf7, 0x96, 0xf7, 0xb6, 0xf7, 0x96, 0x01, 0xf7, 0x95, 0x84, 0xf7, 0x96, 0xef, 0xb6, 0xbc, 0x93, 0x81, 0x91, 0xaa, 0x52, 0x02, 0xd2, 0xf4, 0x02, 0xd2, 0xf5, 0x81, 0xd2, 0xf4, 0xdd, 0x55, 0x08, 0xf7, 0xb6, 0x84, 0xef, 0xb6, 0xbc, 0x93, 0x81, 0x91, 0xaa, 0x53, 0xd2, 0xf5, 0x05, 0xd2, 0xf4, 0x82, 0xe6, 0x75, 0xf7, 0x96, 0xf7, 0x95, 0x02, 0xf7, 0x96, 0x80, 0xf7, 0xb6, 0x01, 0xf7, 0xb5, 0x84, 0xef, 0x96, 0xf7, 0x96, 0xbc, 0x93, 0x81, 0x91, 0xaa, 0x33, 0x06, 0xd2, 0xf4, 0x01, 0x99, 0xf2, 0x80, 0xd2, 0xf5, 0x01, 0xd2, 0xf4, 0x81, 0xd2, 0xf5, 0xd2, 0xd4, 0x01, 0xd2, 0xf4, 0x80, 0xdc, 0x75, 0x02, 0xf7, 0x95, 0x81, 0xf7, 0x96, 0xf7, 0xb5, 0x03, 0xf7, 0x96, 0x84, 0xef, 0xb6, 0xf7, 0xb5, 0xf7, 0x96, 0x81, 0x91, 0x89, 0x91, 0x06, 0xd2, 0xf4, 0x80, 0xdc, 0x15, 0x02, 0xf7, 0x96, 0x82, 0xd6, 0x15, 0x81, 0x91, 0x99, 0xf2, 0x03, 0xd2, 0xf4, 0x8d, 0xd2, 0xf5, 0xd2, 0xf4, 0xd2, 0xf5, 0xe5, 0x35, 0xf7, 0xb6, 0xf7, 0xb5, 0xf7, 0x96, 0xef, 0xb6, 0xf7, 0x96, 0xf7, 0x95, 0xf7, 0xb6, 0xf7, 0x96, 0xf7, 0xb6, 0xf7, 0x95, 0x01, 0xf7, 0x96, 0x87, 0xf7, 0x95, 0xf7, 0xb6, 0xf7, 0x95, 0xf7, 0xb6, 0xf7, 0x96, 0xbc, 0x93, 0x81, 0x91, 0xaa, 0x53, 0x06, 0xd2, 0xf4, 0x80, 0xee, 0x75, 0x01, 0xf7, 0x96, 0x84, 0xf7, 0xb5, 0xf7, 0x96, 0xbc, 0x93, 0x81, 0x91, 0xaa, 0x33, 0x06, 0xd2, 0xf4, 0x89, 0xee, 0x75, 0xf7, 0x96, 0xf7, 0xb5, 0xf7, 0x95, 0xd6, 0x34, 0x81, 0x91, 0x99, 0xf2, 0xd2, 0xf4, 0xd2, 0xf5, 0xd2, 0xf4, 0x02, 0xd2, 0xf5, 0x83, 0xd2, 0xd4, 0xe5, 0x55, 0xf7, 0x96, 0xf7, 0xb5, 0x01, 0xf7, 0xb6, 0x86, 0xf7, 0x95, 0xf7, 0xb6, 0xf7, 0x96, 0xf7, 0xb6, 0xa3, 0x11, 0x81, 0x91, 0xba, 0x94, 0x06, 0xd2, 0xf4, 0x01, 0xf7, 0x96, 0x02, 0xf7, 0x97, 0x80, 0xf7, 0xb7, 0x01, 0xf7, 0x98, 0x80, 0xd2, 0x73, 0x02, 0xb8, 0xd1,
+  0x02, 0xb8, 0xd1, 0x80, 0xff, 0x94, 0x03, 0xff, 0xb5, 0x85, 0xff, 0xb4, 0xff, 0xb5, 0xc4, 0x93, 0x81, 0x91, 0xaa, 0x53, 0xd3, 0x15, 0x02, 0xd3, 0x35, 0x83, 0xd3, 0x34, 0xd3, 0x15, 0xd3, 0x35, 0xe5, 0x75, 0x09, 0xff, 0xb5, 0x82, 0xc4, 0x93, 0x81, 0x91, 0xaa, 0x53, 0x01, 0xd3, 0x35, 0x81, 0xd3, 0x14, 0xd3, 0x15, 0x02, 0xd3, 0x35, 0x82, 0xf6, 0x75, 0xff, 0xb5, 0xff, 0xb4, 0x01, 0xff, 0xb5, 0x02, 0xff, 0xb4, 0x01, 0xff, 0xb5, 0x83, 0xff, 0x95, 0xc4, 0x93, 0x81, 0x91, 0xaa, 0x53, 0x03, 0xd3, 0x35, 0x01, 0xd3, 0x15, 0x80, 0xd3, 0x35, 0x01, 0x99, 0xf2, 0x82, 0xd3, 0x35, 0xd3, 0x14, 0xd3, 0x15, 0x01, 0xd3, 0x35, 0x82, 0xd3, 0x15, 0xd3, 0x35, 0xdc, 0x54, 0x03, 0xff, 0xb5, 0x80, 0xff, 0xb4, 0x04, 0xff, 0xb5, 0x81, 0xff, 0xb4, 0xff, 0xb5, 0x01, 0x81, 0x91, 0x81, 0xd3, 0x34, 0xd3, 0x15, 0x03, 0xd3, 0x35, 0x82, 0xd3, 0x15, 0xdc, 0x34, 0xff, 0xb4, 0x01, 0xff, 0xb5, 0x85, 0xde, 0x34, 0x81, 0x91, 0x99, 0xf2, 0xd3, 0x14, 0xd3, 0x35, 0xd3, 0x15, 0x01, 0xd3, 0x34, 0x01, 0xd3, 0x35, 0x80, 0xe5, 0x74, 0x06, 0xff, 0xb5, 0x01, 0xff, 0xb4, 0x81, 0xff, 0xb5, 0xff, 0xb4, 0x02, 0xff, 0xb5, 0x80, 0xff, 0xb4, 0x01, 0xff, 0xb5, 0x82, 0xc4, 0xb3, 0x81, 0x91, 0xaa, 0x53, 0x01, 0xd3, 0x35, 0x81, 0xd3, 0x14, 0xd3, 0x15, 0x02, 0xd3, 0x35, 0x80, 0xed, 0xf5, 0x03, 0xff, 0xb5, 0x82, 0xc4, 0x93, 0x81, 0x91, 0xaa, 0x53, 0x03, 0xd3, 0x35, 0x01, 0xd3, 0x15, 0x81, 0xd3, 0x35, 0xf6, 0x94, 0x02, 0xff, 0xb5, 0x82, 0xde, 0x14, 0x81, 0x91, 0x99, 0xf2, 0x01, 0xd3, 0x35, 0x85, 0xd3, 0x14, 0xd3, 0x34, 0xd3, 0x14, 0xd3, 0x34, 0xd3, 0x15, 0xe5, 0x55, 0x02, 0xff, 0xb5, 0x80, 0xff, 0xb4, 0x03, 0xff, 0xb5, 0x82, 0xa3, 0x32, 0x81, 0x91, 0xba, 0xb4, 0x02, 0xd3, 0x35, 0x81, 0xd3, 0x15, 0xd3, 0x34, 0x01, 0xd3, 0x35, 0x80, 0xff, 0xb5, 0x04, 0xff, 0xb6, 0x83, 0xff, 0xb7, 0xff, 0xb8, 0xdb, 0xd4, 0xb8, 0xd2, 0x01, 0xb8, 0xd1,
+  0x02, 0xb8, 0xd1, 0x04, 0xfe, 0x2e, 0x01, 0xfe, 0x4e, 0x82, 0xc3, 0xf0, 0x81, 0x91, 0xaa, 0x73, 0x06, 0xd3, 0x55, 0x80, 0xec, 0xd1, 0x09, 0xfe, 0x2e, 0x82, 0xc3, 0xef, 0x81, 0x91, 0xaa, 0x73, 0x05, 0xd3, 0x55, 0x81, 0xd3, 0x54, 0xf5, 0x90, 0x01, 0xfe, 0x4e, 0x01, 0xfe, 0x2e, 0x80, 0xfe, 0x4e, 0x04, 0xfe, 0x2e, 0x82, 0xc3, 0xef, 0x81, 0x91, 0xaa, 0x73, 0x06, 0xd3, 0x55, 0x83, 0x9a, 0x12, 0x91, 0xf2, 0xd3, 0x55, 0xd3, 0x54, 0x04, 0xd3, 0x55, 0x81, 0xdb, 0xd4, 0xfe, 0x4e, 0x03, 0xfe, 0x2e, 0x82, 0xfe, 0x4e, 0xfe, 0x2e, 0xfe, 0x4e, 0x02, 0xfe, 0x2e, 0x80, 0xfe, 0x4e, 0x01, 0x81, 0x91, 0x06, 0xd3, 0x55, 0x81, 0xdc, 0x13, 0xfe, 0x4e, 0x01, 0xfe, 0x2e, 0x82, 0xe5, 0x0f, 0x81, 0x91, 0x99, 0xf2, 0x05, 0xd3, 0x55, 0x81, 0xd3, 0x54, 0xec, 0xd1, 0x07, 0xfe, 0x2e, 0x80, 0xfe, 0x4e, 0x03, 0xfe, 0x2e, 0x01, 0xfe, 0x4e, 0x01, 0xfe, 0x2e, 0x82, 0xc3, 0xcf, 0x81, 0x91, 0xaa, 0x73, 0x06, 0xd3, 0x55, 0x81, 0xe4, 0xd1, 0xfe, 0x4e, 0x01, 0xfe, 0x2e, 0x83, 0xfe, 0x4e, 0xc3, 0xd0, 0x81, 0x91, 0xaa, 0x73, 0x06, 0xd3, 0x55, 0x81, 0xf5, 0x90, 0xfe, 0x4e, 0x01, 0xfe, 0x2e, 0x82, 0xe5, 0x0f, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x55, 0x83, 0xec, 0xd2, 0xfe, 0x2e, 0xfe, 0x4e, 0xfe, 0x2e, 0x02, 0xfe, 0x4e, 0x84, 0xfe, 0x4d, 0xfe, 0x2f, 0xa2, 0xb0, 0x81, 0x91, 0xc2, 0xf4, 0x06, 0xd3, 0x55, 0x80, 0xfe, 0x2f, 0x02, 0xfe, 0x50, 0x01, 0xfe, 0x51, 0x01, 0xfe, 0x52, 0x81, 0xe3, 0xd2, 0xb8, 0xd2, 0x01, 0xb8, 0xd1,
+  0x83, 0xb8, 0xd1, 0xb0, 0xd1, 0xb0, 0xd2, 0xfc, 0x8d, 0x01, 0xfc, 0x6d, 0x80, 0xfc, 0x8d, 0x02, 0xfc, 0x6d, 0x82, 0xc3, 0x0f, 0x81, 0xb1, 0xaa, 0x73, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0xec, 0x11, 0x08, 0xfc, 0x6d, 0x83, 0xfc, 0x8d, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x01, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x83, 0xd3, 0x75, 0xd3, 0x95, 0xd3, 0x96, 0xf4, 0x2f, 0x01, 0xfc, 0x6d, 0x80, 0xfc, 0x8d, 0x01, 0xfc, 0x6d, 0x01, 0xfc, 0x8d, 0x01, 0xfc, 0x6d, 0x83, 0xfc, 0x8d, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x03, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x82, 0xd3, 0x95, 0x9a, 0x12, 0x81, 0x91, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x81, 0xf4, 0x4f, 0xfc, 0x8d, 0x01, 0xfc, 0x6d, 0x80, 0xfc, 0x8d, 0x03, 0xfc, 0x6d, 0x01, 0xfc, 0x8d, 0x80, 0xfc, 0x6d, 0x01, 0x81, 0x91, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x82, 0xd3, 0x96, 0xdb, 0xd3, 0xfc, 0x8d, 0x01, 0xfc, 0x6d, 0x82, 0xe3, 0xce, 0x81, 0x91, 0x9a, 0x12, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x76, 0x02, 0xd3, 0x95, 0x80, 0xec, 0x11, 0x03, 0xfc, 0x6d, 0x01, 0xfc, 0x8d, 0x07, 0xfc, 0x6d, 0x86, 0xfc, 0x8d, 0xfc, 0x6d, 0xfc, 0x8d, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0xd3, 0x75, 0x05, 0xd3, 0x95, 0x87, 0xeb, 0xf1, 0xfc, 0x8d, 0xfc, 0x6d, 0xfc, 0x8d, 0xfc, 0x6d, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x03, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x81, 0xd3, 0x95, 0xf4, 0x2f, 0x01, 0xfc, 0x6d, 0x83, 0xfc, 0x8d, 0xe3, 0xce, 0x81, 0x91, 0x9a, 0x12, 0x01, 0xd3, 0x95, 0x82, 0xd3, 0x75, 0xd3, 0x95, 0xd3, 0x76, 0x01, 0xd3, 0x95, 0x81, 0xeb, 0xf1, 0xfc, 0x8d, 0x01, 0xfc, 0x6d, 0x80, 0xfc, 0x8d, 0x02, 0xfc, 0x6d, 0x84, 0xfc, 0x8d, 0xa2, 0x50, 0x81, 0x91, 0xc3, 0x14, 0xd3, 0x75, 0x04, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0xfc, 0x8e, 0x02, 0xfc, 0x8f, 0x01, 0xfc, 0xb0, 0x01, 0xfc, 0xb1, 0x83, 0xf3, 0xb2, 0xb8, 0xd1, 0xb0, 0xf1, 0xb8, 0xd1,
+  0x01, 0xb0, 0xf1, 0x80, 0xb0, 0xd1, 0x06, 0xfc, 0x8d, 0x82, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x11, 0x09, 0xfc, 0x8d, 0x82, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0x4f, 0x09, 0xfc, 0x8d, 0x82, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x82, 0x9a, 0x12, 0x81, 0x91, 0xc3, 0x34, 0x06, 0xd3, 0x95, 0x81, 0xdb, 0xb4, 0xfc, 0x8e, 0x09, 0xfc, 0x8d, 0x01, 0x81, 0x91, 0x05, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0xdb, 0xd3, 0x02, 0xfc, 0x8d, 0x82, 0xe3, 0xce, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x11, 0x10, 0xfc, 0x8d, 0x82, 0xcb, 0x2f, 0x81, 0x91, 0xaa, 0x93, 0x03, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x80, 0xec, 0x11, 0x03, 0xfc, 0x8d, 0x82, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0x4f, 0x02, 0xfc, 0x8d, 0x82, 0xcb, 0x6f, 0x81, 0x91, 0x9a, 0x32, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x11, 0x07, 0xfc, 0x8d, 0x82, 0xa2, 0x50, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x81, 0xfc, 0x8e, 0xfc, 0x8f, 0x01, 0xfc, 0xaf, 0x02, 0xfc, 0xb0, 0x81, 0xfc, 0xb2, 0xf4, 0x51, 0x02, 0xb0, 0xd1,
+  0x01, 0xb0, 0xf1, 0x82, 0xb0, 0xd1, 0xfc, 0xad, 0xfc, 0xcd, 0x01, 0xfc, 0xad, 0x02, 0xfc, 0xcd, 0x82, 0xcb, 0x4e, 0x81, 0x91, 0xaa, 0x73, 0x06, 0xd3, 0x95, 0x81, 0xec, 0x31, 0xfc, 0xad, 0x08, 0xfc, 0xcd, 0x82, 0xc3, 0x2f, 0x89, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0x6f, 0x02, 0xfc, 0xcd, 0x80, 0xfc, 0xad, 0x02, 0xfc, 0xcd, 0x02, 0xfc, 0xad, 0x82, 0xc3, 0x2f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x83, 0xbb, 0x11, 0x81, 0x91, 0xaa, 0x73, 0xd3, 0x96, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x02, 0xd3, 0x95, 0x86, 0xdb, 0xb4, 0xfc, 0xae, 0xfc, 0xad, 0xfc, 0xcd, 0xfc, 0xad, 0xfc, 0xcd, 0xfc, 0xad, 0x01, 0xfc, 0xcd, 0x01, 0xfc, 0xad, 0x01, 0x81, 0x91, 0x05, 0xd3, 0x95, 0x82, 0xd3, 0x75, 0xdb, 0xd3, 0xfc, 0xad, 0x01, 0xfc, 0xcd, 0x82, 0xdb, 0xee, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x82, 0xec, 0x31, 0xfc, 0xcd, 0xfc, 0xad, 0x0a, 0xfc, 0xcd, 0x86, 0xfc, 0xad, 0xfc, 0xcd, 0xfc, 0xad, 0xfc, 0xcd, 0xdb, 0xee, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xdb, 0xd3, 0x03, 0xfc, 0xcd, 0x82, 0xc3, 0x2f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x81, 0xf4, 0x6f, 0xfc, 0xad, 0x01, 0xfc, 0xcd, 0x82, 0xc3, 0x2f, 0x89, 0x91, 0xaa, 0x94, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x31, 0x01, 0xfc, 0xcd, 0x81, 0xfc, 0xad, 0xfc, 0xcd, 0x03, 0xfc, 0xad, 0x82, 0xa2, 0x70, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x80, 0xfc, 0xce, 0x01, 0xfc, 0xcf, 0x82, 0xfc, 0xef, 0xfc, 0xd0, 0xfc, 0xf0, 0x01, 0xfc, 0xf1, 0x80, 0xfc, 0xf2, 0x01, 0xb0, 0xf1, 0x80, 0xb0, 0xf2,
+  0x83, 0xb0, 0xf1, 0xa8, 0xf1, 0xb0, 0xf1, 0xfd, 0x0d, 0x02, 0xfc, 0xed, 0x85, 0xfd, 0x0d, 0xfc, 0xed, 0xfd, 0x0d, 0xe4, 0x2e, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x51, 0x09, 0xfc, 0xed, 0x82, 0xc3, 0x4f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0x8f, 0x09, 0xfc, 0xed, 0x82, 0xc3, 0x2f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x82, 0xec, 0x6f, 0x91, 0xd1, 0x89, 0xd1, 0x05, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x81, 0xdb, 0xb4, 0xec, 0x70, 0x04, 0xfc, 0xed, 0x80, 0xfd, 0x0d, 0x01, 0xfc, 0xed, 0x01, 0x81, 0x91, 0x06, 0xd3, 0x95, 0x80, 0xdb, 0xf3, 0x02, 0xfc, 0xed, 0x82, 0xe4, 0x2e, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x51, 0x0e, 0xfc, 0xed, 0x84, 0xfd, 0x0d, 0xfc, 0xed, 0xec, 0x6e, 0x81, 0x91, 0x91, 0xf2, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x76, 0x01, 0xd3, 0x95, 0x86, 0xf4, 0xaf, 0xfd, 0x0d, 0xfc, 0xed, 0xfd, 0x0d, 0xc3, 0x4f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0x8f, 0x02, 0xfc, 0xed, 0x83, 0xc3, 0x4f, 0x81, 0x91, 0xaa, 0x93, 0xd3, 0x75, 0x05, 0xd3, 0x95, 0x80, 0xec, 0x51, 0x07, 0xfc, 0xed, 0x82, 0xa2, 0x70, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x80, 0xfd, 0x0e, 0x02, 0xfd, 0x0f, 0x01, 0xfd, 0x10, 0x01, 0xfd, 0x31, 0x80, 0xfd, 0x32, 0x02, 0xb0, 0xf1,
+  0x82, 0xb0, 0xf1, 0xa8, 0xf1, 0xb0, 0xf1, 0x06, 0xfd, 0x2d, 0x82, 0xe4, 0x4e, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x71, 0x09, 0xfd, 0x2d, 0x82, 0xc3, 0x4f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0xcf, 0x09, 0xfd, 0x2d, 0x82, 0xc3, 0x4f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x83, 0xf4, 0xcf, 0xc3, 0x4f, 0x81, 0x91, 0xb2, 0xd4, 0x09, 0xd3, 0x95, 0x81, 0xdb, 0xd4, 0xe4, 0x31, 0x01, 0xec, 0x71, 0x83, 0xdb, 0xf0, 0xe4, 0x50, 0xf4, 0xcf, 0xfd, 0x0e, 0x01, 0x81, 0x91, 0x06, 0xd3, 0x95, 0x88, 0xdb, 0xd4, 0xf4, 0xaf, 0xf4, 0xcf, 0xf4, 0xaf, 0xdc, 0x10, 0x9a, 0x12, 0xaa, 0x73, 0xd3, 0x95, 0xd3, 0x96, 0x04, 0xd3, 0x95, 0x80, 0xec, 0x71, 0x0f, 0xfd, 0x2d, 0x01, 0xfd, 0x2c, 0x84, 0x92, 0x11, 0x81, 0x91, 0xd3, 0x75, 0xd3, 0x95, 0xd3, 0x96, 0x05, 0xd3, 0x95, 0x85, 0xec, 0x71, 0xfc, 0xee, 0xfd, 0x2d, 0xc3, 0x6f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x86, 0xdc, 0x10, 0xe4, 0x4e, 0xdc, 0x2e, 0xe4, 0x4e, 0xb2, 0xf0, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x71, 0x07, 0xfd, 0x2d, 0x82, 0xa2, 0x70, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x80, 0xfd, 0x2e, 0x01, 0xfd, 0x2f, 0x80, 0xfd, 0x4f, 0x01, 0xfd, 0x50, 0x01, 0xfd, 0x51, 0x83, 0xfd, 0x71, 0xa8, 0xf1, 0xb0, 0xf1, 0xb0, 0xf2,
+  0x01, 0xa8, 0xf1, 0x80, 0xa8, 0xf2, 0x03, 0xfd, 0x6d, 0x80, 0xfd, 0x4d, 0x01, 0xfd, 0x6d, 0x82, 0xe4, 0x6e, 0x81, 0x91, 0x92, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x71, 0x09, 0xfd, 0x6d, 0x82, 0xc3, 0x6f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0xef, 0x09, 0xfd, 0x6d, 0x82, 0xc3, 0x6f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x88, 0xf4, 0xef, 0xfd, 0x2d, 0x92, 0x11, 0x89, 0xb2, 0xcb, 0x75, 0xd3, 0x96, 0xd3, 0x75, 0xd3, 0x95, 0xd3, 0x96, 0x0b, 0xd3, 0x95, 0x80, 0xec, 0x91, 0x01, 0x81, 0x91, 0x0b, 0xd3, 0x95, 0x80, 0xcb, 0x95, 0x07, 0xd3, 0x95, 0x80, 0xec, 0x71, 0x0c, 0xfd, 0x6d, 0x80, 0xfd, 0x4d, 0x03, 0xfd, 0x6d, 0x82, 0xbb, 0x2f, 0x81, 0x91, 0xb2, 0xd4, 0x0a, 0xd3, 0x95, 0x82, 0xc3, 0x14, 0x81, 0x91, 0xaa, 0x93, 0x09, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x09, 0xd3, 0x95, 0x80, 0xec, 0x71, 0x07, 0xfd, 0x6d, 0x82, 0xa2, 0x90, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x80, 0xfd, 0x6e, 0x01, 0xfd, 0x6f, 0x80, 0xfd, 0x8f, 0x01, 0xfd, 0x90, 0x01, 0xfd, 0x91, 0x80, 0xfd, 0x92, 0x02, 0xa8, 0xf1,
+  0x02, 0xa8, 0xf1, 0x83, 0xec, 0x6f, 0xfd, 0x8d, 0xfd, 0xad, 0xfd, 0x8d, 0x02, 0xfd, 0xad, 0x82, 0xe4, 0x8e, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x81, 0xec, 0x91, 0xfd, 0xad, 0x08, 0xfd, 0x8d, 0x82, 0xc3, 0x8f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x83, 0xf5, 0x2f, 0xfd, 0xad, 0xfd, 0x8d, 0xfd, 0xad, 0x01, 0xfd, 0x8d, 0x80, 0xfd, 0xad, 0x01, 0xfd, 0x8d, 0x01, 0xfd, 0xad, 0x82, 0xc3, 0x8f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x84, 0xf5, 0x2f, 0xfd, 0x8d, 0xe4, 0xae, 0x89, 0x91, 0x9a, 0x32, 0x0f, 0xd3, 0x95, 0x80, 0xe4, 0x91, 0x01, 0x81, 0x91, 0x06, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x0c, 0xd3, 0x95, 0x80, 0xec, 0x91, 0x01, 0xfd, 0xad, 0x07, 0xfd, 0x8d, 0x01, 0xfd, 0xad, 0x01, 0xfd, 0x8d, 0x01, 0xfd, 0xad, 0x84, 0xfd, 0x8d, 0xfd, 0xad, 0xf5, 0x2d, 0x81, 0x91, 0x91, 0xf2, 0x03, 0xd3, 0x95, 0x80, 0xd3, 0x76, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x02, 0xd3, 0x95, 0x82, 0xc3, 0x14, 0x81, 0x91, 0xaa, 0x93, 0x14, 0xd3, 0x95, 0x80, 0xec, 0x91, 0x01, 0xfd, 0x8d, 0x04, 0xfd, 0xad, 0x83, 0xfd, 0x8d, 0xa2, 0x90, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x01, 0xfd, 0xaf, 0x02, 0xfd, 0xad, 0x83, 0xfd, 0x8d, 0xfd, 0xad, 0xfd, 0x8d, 0xec, 0x6f, 0x02, 0xa8, 0xf1,
+  0x02, 0xa9, 0x11, 0x80, 0xec, 0x8e, 0x01, 0xfd, 0xed, 0x02, 0xfd, 0xcd, 0x83, 0xfd, 0xed, 0xe4, 0xce, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0xb1, 0x09, 0xfd, 0xcd, 0x82, 0xc3, 0xaf, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf5, 0x4f, 0x01, 0xfd, 0xcd, 0x80, 0xfd, 0xed, 0x04, 0xfd, 0xcd, 0x84, 0xfd, 0xed, 0xfd, 0xcd, 0xc3, 0xaf, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x85, 0xf5, 0x4f, 0xfd, 0xed, 0xfd, 0xcd, 0xd4, 0x4f, 0x81, 0x91, 0xb2, 0xb3, 0x09, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x03, 0xd3, 0x95, 0x82, 0xec, 0xb1, 0x89, 0x91, 0x81, 0x91, 0x0b, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x07, 0xd3, 0x95, 0x80, 0xec, 0xb1, 0x12, 0xfd, 0xcd, 0x82, 0xbb, 0x6f, 0x81, 0x91, 0xba, 0xf4, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x03, 0xd3, 0x95, 0x82, 0xc3, 0x14, 0x81, 0x91, 0xaa, 0x93, 0x14, 0xd3, 0x95, 0x80, 0xec, 0xb1, 0x01, 0xfd, 0xed, 0x01, 0xfd, 0xcd, 0x03, 0xfd, 0xed, 0x82, 0xa2, 0xb0, 0x81, 0x91, 0xc3, 0x14, 0x05, 0xd3, 0x95, 0x83, 0xd3, 0x75, 0xfd, 0xee, 0xfd, 0xef, 0xfd, 0xed, 0x02, 0xfd, 0xcd, 0x01, 0xfd, 0xed, 0x80, 0xec, 0x8e, 0x02, 0xa9, 0x11,
+  0x01, 0xa9, 0x11, 0x81, 0xa1, 0x11, 0xe4, 0x2e, 0x05, 0xfe, 0x0d, 0x82, 0xe4, 0xee, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0xd1, 0x09, 0xfe, 0x0d, 0x82, 0xc3, 0xcf, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf5, 0x6f, 0x09, 0xfe, 0x0d, 0x82, 0xc3, 0xcf, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf5, 0x6f, 0x02, 0xfe, 0x0d, 0x82, 0xd4, 0x4f, 0x81, 0x91, 0xba, 0xd3, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x76, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x80, 0xec, 0xd1, 0x01, 0x81, 0x91, 0x0e, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x04, 0xd3, 0x95, 0x80, 0xec, 0xd1, 0x12, 0xfe, 0x0d, 0x83, 0xf5, 0xad, 0x9a, 0x70, 0x89, 0xb1, 0xd3, 0x75, 0x08, 0xd3, 0x95, 0x82, 0xc3, 0x14, 0x81, 0x91, 0xaa, 0x93, 0x0c, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x06, 0xd3, 0x95, 0x80, 0xec, 0xd1, 0x02, 0xfe, 0x0d, 0x81, 0xfe, 0x0e, 0xfe, 0x0d, 0x02, 0xfe, 0x0e, 0x82, 0xa2, 0xb0, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x01, 0xfe, 0x0f, 0x05, 0xfe, 0x0d, 0x81, 0xe4, 0x2e, 0xa1, 0x11, 0x01, 0xa9, 0x11,
+  0x80, 0x80, 0xf0, 0x01, 0xa1, 0x11, 0x80, 0xc2, 0xb0, 0x05, 0xfe, 0x4d, 0x82, 0xe5, 0x0e, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0xf1, 0x09, 0xfe, 0x4d, 0x82, 0xc3, 0xef, 0x89, 0x91, 0xaa, 0x93, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x02, 0xd3, 0x95, 0x80, 0xf5, 0x8f, 0x09, 0xfe, 0x4d, 0x84, 0xc3, 0xef, 0x81, 0x91, 0xaa, 0x93, 0xd3, 0x95, 0xd3, 0x96, 0x04, 0xd3, 0x95, 0x80, 0xf5, 0x8f, 0x03, 0xfe, 0x4d, 0x83, 0xe5, 0x0e, 0x89, 0xd1, 0xa2, 0x53, 0xcb, 0x75, 0x05, 0xd3, 0x95, 0x80, 0xd3, 0x76, 0x04, 0xd3, 0x95, 0x80, 0xec, 0xf1, 0x01, 0x81, 0x91, 0x14, 0xd3, 0x95, 0x80, 0xec, 0xf1, 0x13, 0xfe, 0x4d, 0x83, 0xf6, 0x0e, 0x9a, 0x70, 0x91, 0xf2, 0xcb, 0x75, 0x05, 0xd3, 0x95, 0x86, 0xd3, 0x96, 0xd3, 0x95, 0xc3, 0x14, 0x81, 0x91, 0xaa, 0x93, 0xd3, 0x95, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x0f, 0xd3, 0x95, 0x80, 0xec, 0xf2, 0x02, 0xfe, 0x4d, 0x89, 0xfe, 0x4e, 0xfe, 0x4d, 0xfe, 0x4e, 0xfe, 0x4d, 0xfe, 0x4e, 0xa2, 0xd0, 0x81, 0x91, 0xc3, 0x14, 0xd3, 0x95, 0xd3, 0x96, 0x04, 0xd3, 0x95, 0x81, 0xfe, 0x4e, 0xfe, 0x4f, 0x05, 0xfe, 0x4d, 0x80, 0xc2, 0xb0, 0x01, 0xa1, 0x11, 0x80, 0x80, 0xf0,
+  0x80, 0x60, 0xef, 0x01, 0xa1, 0x11, 0x81, 0xa1, 0x12, 0xfe, 0x2d, 0x04, 0xfe, 0x8d, 0x82, 0xe5, 0x4e, 0x81, 0x91, 0x9a, 0x12, 0x04, 0xd3, 0x95, 0x82, 0xd3, 0x75, 0xd3, 0x95, 0xed, 0x11, 0x08, 0xfe, 0x6d, 0x85, 0xfe, 0x8d, 0xc4, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0xd3, 0x95, 0xd3, 0x96, 0x03, 0xd3, 0x95, 0x82, 0xd3, 0x75, 0xf5, 0xcf, 0xfe, 0x6d, 0x07, 0xfe, 0x8d, 0x83, 0xfe, 0x6d, 0xc4, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf5, 0xce, 0x01, 0xfe, 0x6d, 0x86, 0xfe, 0x8d, 0xfe, 0x6c, 0xfe, 0x8d, 0xf6, 0x2d, 0xc4, 0x0f, 0x9a, 0x12, 0xb2, 0xd4, 0x0a, 0xd3, 0x95, 0x80, 0xec, 0xf1, 0x01, 0x81, 0x91, 0x14, 0xd3, 0x95, 0x80, 0xed, 0x11, 0x09, 0xfe, 0x6d, 0x80, 0xfe, 0x8d, 0x06, 0xfe, 0x6d, 0x86, 0xfe, 0x6c, 0xfe, 0x8d, 0xfe, 0x6d, 0xfe, 0x2d, 0xbb, 0xcf, 0x89, 0xb1, 0xba, 0xf4, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x83, 0xd3, 0x96, 0xc3, 0x14, 0x81, 0x91, 0xaa, 0x93, 0x14, 0xd3, 0x95, 0x80, 0xed, 0x12, 0x07, 0xfe, 0x8e, 0x82, 0xa2, 0xd0, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x01, 0xfe, 0x8f, 0x04, 0xfe, 0x8d, 0x81, 0xfe, 0x2d, 0xa1, 0x12, 0x01, 0xa1, 0x11, 0x80, 0x60, 0xef,
+  0x80, 0x28, 0xcd, 0x02, 0xa1, 0x11, 0x80, 0xcb, 0xcf, 0x04, 0xfe, 0xad, 0x82, 0xf5, 0xed, 0x89, 0xd1, 0x91, 0xd2, 0x04, 0xd3, 0x95, 0x82, 0xd3, 0x96, 0xd3, 0x95, 0xed, 0x11, 0x09, 0xfe, 0xad, 0x82, 0xc4, 0x2f, 0x81, 0xb1, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf5, 0xef, 0x07, 0xfe, 0xad, 0x84, 0xfe, 0xcc, 0xfe, 0xad, 0xc4, 0x2f, 0x81, 0x91, 0xaa, 0x93, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x03, 0xd3, 0x95, 0x82, 0xf5, 0xef, 0xfe, 0xad, 0xfe, 0xac, 0x01, 0xfe, 0xad, 0x80, 0xfe, 0xac, 0x01, 0xfe, 0xad, 0x86, 0xf6, 0x4d, 0xd4, 0xce, 0xbb, 0xd0, 0xc3, 0xb2, 0xc3, 0x14, 0xd3, 0x95, 0xd3, 0x75, 0x05, 0xd3, 0x95, 0x80, 0xed, 0x12, 0x01, 0x81, 0x91, 0x10, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x02, 0xd3, 0x95, 0x80, 0xed, 0x31, 0x01, 0xfe, 0xac, 0x14, 0xfe, 0xad, 0x84, 0xee, 0x0d, 0xcc, 0x6f, 0xbb, 0x51, 0xba, 0xd4, 0xcb, 0x55, 0x03, 0xd3, 0x95, 0x82, 0xc3, 0x34, 0x81, 0x91, 0xb2, 0x94, 0x12, 0xd3, 0x95, 0x88, 0xd3, 0x75, 0xd3, 0x95, 0xed, 0x11, 0xfe, 0xae, 0xfe, 0xce, 0xfe, 0xad, 0xfe, 0xae, 0xfe, 0xad, 0xfe, 0xce, 0x01, 0xfe, 0xae, 0x82, 0xa2, 0xf0, 0x81, 0x91, 0xc3, 0x14, 0x05, 0xd3, 0x95, 0x82, 0xdc, 0x34, 0xfe, 0xaf, 0xfe, 0xd0, 0x04, 0xfe, 0xad, 0x80, 0xcb, 0xcf, 0x02, 0xa1, 0x11, 0x80, 0x28, 0xcd,
+  0x85, 0x18, 0xad, 0x81, 0x10, 0x99, 0x11, 0xa1, 0x11, 0xa1, 0x71, 0xf5, 0xed, 0x05, 0xfe, 0xad, 0x83, 0xfe, 0xac, 0xfe, 0x6d, 0xf5, 0xcf, 0xf5, 0xef, 0x01, 0xf5, 0xcf, 0x82, 0xf5, 0xef, 0xf5, 0xcf, 0xfe, 0x4d, 0x0b, 0xfe, 0xad, 0x80, 0xfe, 0x4e, 0x01, 0xf5, 0xef, 0x81, 0xf5, 0xcf, 0xf5, 0xee, 0x02, 0xf5, 0xef, 0x80, 0xfe, 0x8d, 0x03, 0xfe, 0xac, 0x81, 0xfe, 0xad, 0xfe, 0x8d, 0x02, 0xfe, 0xad, 0x01, 0xfe, 0xac, 0x85, 0xfe, 0xad, 0xf6, 0x4d, 0xf5, 0xef, 0xf5, 0xcf, 0xf5, 0xef, 0xf5, 0xcf, 0x02, 0xf5, 0xef, 0x80, 0xfe, 0x6e, 0x04, 0xfe, 0xad, 0x01, 0xfe, 0xac, 0x03, 0xfe, 0xad, 0x80, 0xfe, 0xac, 0x01, 0xfe, 0xad, 0x82, 0xf6, 0x0e, 0xf5, 0xef, 0xf5, 0xcf, 0x01, 0xf5, 0xef, 0x83, 0xf5, 0xcf, 0xf6, 0x4e, 0xfe, 0xac, 0xfe, 0xad, 0x0f, 0xf5, 0xef, 0x80, 0xf5, 0xcf, 0x02, 0xf5, 0xef, 0x82, 0xf5, 0xcf, 0xfe, 0x4d, 0xfe, 0xac, 0x08, 0xfe, 0xad, 0x80, 0xfe, 0xac, 0x08, 0xfe, 0xad, 0x80, 0xfe, 0xac, 0x06, 0xfe, 0xad, 0x80, 0xfe, 0x6d, 0x01, 0xf5, 0xef, 0x01, 0xf5, 0xcf, 0x85, 0xfe, 0xad, 0xf6, 0x2e, 0xf5, 0xef, 0xf5, 0xd0, 0xf5, 0xef, 0xf5, 0xcf, 0x01, 0xf5, 0xf0, 0x80, 0xf5, 0xef, 0x0b, 0xf5, 0xf0, 0x83, 0xf5, 0xef, 0xf5, 0xf0, 0xfe, 0x4f, 0xfe, 0xce, 0x07, 0xfe, 0xae, 0x82, 0xfe, 0xaf, 0xf6, 0x10, 0xf5, 0xd0, 0x03, 0xf5, 0xf0, 0x80, 0xf6, 0x10, 0x02, 0xfe, 0xaf, 0x03, 0xfe, 0xad, 0x85, 0xf5, 0xed, 0xa1, 0x71, 0xa1, 0x11, 0x99, 0x11, 0x81, 0x10, 0x18, 0xad,
+  0x81, 0x20, 0xac, 0x38, 0xce, 0x02, 0x99, 0x31, 0x83, 0xaa, 0x31, 0xfe, 0x2d, 0xfe, 0x8c, 0xfe, 0x8d, 0x02, 0xfe, 0x8c, 0x81, 0xfe, 0xad, 0xfe, 0x8c, 0x01, 0xfe, 0xac, 0x01, 0xfe, 0x8c, 0x83, 0xfe, 0xac, 0xfe, 0xad, 0xfe, 0x8d, 0xfe, 0x8c, 0x07, 0xfe, 0xad, 0x01, 0xfe, 0x8c, 0x01, 0xfe, 0xac, 0x83, 0xfe, 0xad, 0xfe, 0x8c, 0xfe, 0xad, 0xfe, 0x8c, 0x01, 0xfe, 0x8d, 0x81, 0xfe, 0x8c, 0xfe, 0xad, 0x01, 0xfe, 0x8c, 0x01, 0xfe, 0xad, 0x01, 0xfe, 0xac, 0x01, 0xfe, 0x8c, 0x82, 0xfe, 0xac, 0xfe, 0x8c, 0xfe, 0xac, 0x01, 0xfe, 0xad, 0x8b, 0xfe, 0x8d, 0xfe, 0x8c, 0xfe, 0xad, 0xfe, 0x8d, 0xfe, 0x8c, 0xfe, 0x8d, 0xfe, 0x8c, 0xfe, 0x8d, 0xfe, 0xac, 0xfe, 0x8c, 0xfe, 0xac, 0xfe, 0x8d, 0x01, 0xfe, 0xad, 0x81, 0xfe, 0x8c, 0xfe, 0xac, 0x01, 0xfe, 0x8c, 0x84, 0xfe, 0x8d, 0xfe, 0x8c, 0xfe, 0xac, 0xfe, 0x8d, 0xfe, 0x8c, 0x01, 0xfe, 0xad, 0x02, 0xfe, 0x8c, 0x82, 0xfe, 0xad, 0xfe, 0x8c, 0xfe, 0xac, 0x0f, 0xfe, 0xad, 0x83, 0xfe, 0x8c, 0xfe, 0xac, 0xfe, 0x8d, 0xfe, 0xac, 0x01, 0xfe, 0xad, 0x80, 0xfe, 0x8c, 0x10, 0xfe, 0xad, 0x83, 0xfe, 0xac, 0xfe, 0x8c, 0xfe, 0xad, 0xfe, 0x8c, 0x03, 0xfe, 0x8d, 0x02, 0xfe, 0xad, 0x80, 0xfe, 0x8d, 0x03, 0xfe, 0xad, 0x82, 0xfe, 0x8d, 0xfe, 0x8e, 0xfe, 0xad, 0x01, 0xfe, 0xae, 0x80, 0xfe, 0xad, 0x0b, 0xfe, 0xae, 0x01, 0xfe, 0x8e, 0x02, 0xfe, 0xae, 0x80, 0xfe, 0x8e, 0x02, 0xfe, 0xae, 0x01, 0xfe, 0x8e, 0x81, 0xfe, 0xae, 0xfe, 0xaf, 0x01, 0xfe, 0xae, 0x81, 0xfe, 0xaf, 0xfe, 0x8e, 0x04, 0xfe, 0xaf, 0x87, 0xfe, 0x8f, 0xfe, 0xb0, 0xfe, 0xaf, 0xfe, 0x8c, 0xfe, 0x8d, 0xfe, 0x8c, 0xfe, 0x2d, 0xaa, 0x31, 0x02, 0x99, 0x31, 0x81, 0x38, 0xce, 0x20, 0xac,
+  0x83, 0x20, 0xad, 0x20, 0xac, 0x60, 0xef, 0x99, 0x12, 0x01, 0x99, 0x31, 0x81, 0xb2, 0x70, 0xf6, 0x2d, 0x01, 0xfe, 0x8c, 0x02, 0xfe, 0x8d, 0x81, 0xfe, 0x8c, 0xfe, 0x8d, 0x03, 0xfe, 0x8c, 0x02, 0xfe, 0x8d, 0x08, 0xfe, 0x8c, 0x80, 0xfe, 0x8d, 0x01, 0xfe, 0x8c, 0x02, 0xfe, 0x8d, 0x82, 0xfe, 0x8c, 0xfe, 0x8d, 0xfe, 0x8c, 0x03, 0xfe, 0x8d, 0x80, 0xfe, 0x8c, 0x08, 0xfe, 0x8d, 0x81, 0xfe, 0x8c, 0xfe, 0x8d, 0x03, 0xfe, 0x8c, 0x80, 0xfe, 0x8d, 0x02, 0xfe, 0x8c, 0x01, 0xfe, 0x8d, 0x02, 0xfe, 0x8c, 0x01, 0xfe, 0x8d, 0x01, 0xfe, 0x8c, 0x80, 0xfe, 0x8d, 0x03, 0xfe, 0x8c, 0x01, 0xfe, 0x8d, 0x81, 0xfe, 0x8c, 0xfe, 0x8d, 0x02, 0xfe, 0x8c, 0x12, 0xfe, 0x8d, 0x01, 0xfe, 0x8c, 0x83, 0xfe, 0x6d, 0xfe, 0x8d, 0xfe, 0x8c, 0xfe, 0x8d, 0x0a, 0xfe, 0x8c, 0x04, 0xfe, 0x8d, 0x80, 0xfe, 0x8c, 0x09, 0xfe, 0x8d, 0x80, 0xfe, 0x8e, 0x04, 0xfe, 0x8d, 0x10, 0xfe, 0x8e, 0x80, 0xfe, 0x8f, 0x01, 0xfe, 0x8e, 0x01, 0xfe, 0x8f, 0x80, 0xfe, 0x8e, 0x01, 0xfe, 0x8f, 0x82, 0xfe, 0x8e, 0xfe, 0x8f, 0xfe, 0x8e, 0x0a, 0xfe, 0x8f, 0x01, 0xfe, 0x90, 0x80, 0xfe, 0xb0, 0x01, 0xfe, 0x8c, 0x81, 0xf6, 0x2d, 0xb2, 0x70, 0x01, 0x99, 0x31, 0x83, 0x99, 0x12, 0x60, 0xef, 0x20, 0xac, 0x20, 0xad,
+  0x83, 0x18, 0xac, 0x20, 0xac, 0x28, 0xad, 0x81, 0x10, 0x01, 0x99, 0x31, 0x83, 0x99, 0x11, 0xaa, 0x31, 0xf5, 0xcd, 0xfe, 0x8c, 0x15, 0xfe, 0x6c, 0x80, 0xfe, 0x6d, 0x01, 0xfe, 0x6c, 0x80, 0xfe, 0x6d, 0x0e, 0xfe, 0x6c, 0x80, 0xfe, 0x8c, 0x04, 0xfe, 0x6c, 0x80, 0xfe, 0x6d, 0x01, 0xfe, 0x6c, 0x82, 0xfe, 0x6d, 0xfe, 0x6c, 0xfe, 0x6d, 0x03, 0xfe, 0x6c, 0x80, 0xfe, 0x6d, 0x0a, 0xfe, 0x6c, 0x80, 0xfe, 0x6d, 0x19, 0xfe, 0x6c, 0x80, 0xfe, 0x8c, 0x01, 0xfe, 0x6d, 0x11, 0xfe, 0x6c, 0x83, 0xfe, 0x6d, 0xfe, 0x6c, 0xfe, 0x6d, 0xfe, 0x6c, 0x03, 0xfe, 0x6d, 0x80, 0xfe, 0x6c, 0x02, 0xfe, 0x6d, 0x80, 0xfe, 0x8e, 0x01, 0xfe, 0x8d, 0x81, 0xfe, 0x6e, 0xfe, 0x8d, 0x0a, 0xfe, 0x6e, 0x03, 0xfe, 0x6f, 0x01, 0xfe, 0x8f, 0x02, 0xfe, 0x6f, 0x80, 0xfe, 0x8f, 0x01, 0xfe, 0x6f, 0x01, 0xfe, 0x8f, 0x01, 0xfe, 0x6f, 0x80, 0xfe, 0x8f, 0x01, 0xfe, 0x6f, 0x01, 0xfe, 0x8f, 0x80, 0xfe, 0x6f, 0x01, 0xfe, 0x8f, 0x81, 0xfe, 0x6f, 0xfe, 0x90, 0x01, 0xfe, 0x8f, 0x01, 0xfe, 0x90, 0x83, 0xfe, 0x8c, 0xf5, 0xcd, 0xaa, 0x31, 0x99, 0x11, 0x01, 0x99, 0x31, 0x83, 0x81, 0x10, 0x28, 0xad, 0x20, 0xac, 0x18, 0xac,
+  0x01, 0x20, 0xac, 0x82, 0x18, 0xac, 0x28, 0xad, 0x91, 0x11, 0x02, 0x99, 0x31, 0x83, 0xa1, 0x71, 0xcb, 0xcf, 0xf6, 0x0d, 0xfe, 0x4d, 0x08, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x0c, 0xfe, 0x6d, 0x82, 0xfe, 0x6c, 0xfe, 0x6d, 0xfe, 0x4d, 0x04, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x04, 0xfe, 0x6d, 0x82, 0xfe, 0x4d, 0xfe, 0x6d, 0xfe, 0x6c, 0x07, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x02, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x05, 0xfe, 0x6d, 0x82, 0xfe, 0x6c, 0xfe, 0x6d, 0xfe, 0x4d, 0x08, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x2c, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x02, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x01, 0xfe, 0x6e, 0x81, 0xfe, 0x4e, 0xfe, 0x6d, 0x04, 0xfe, 0x6e, 0x80, 0xfe, 0x6f, 0x01, 0xfe, 0x6e, 0x11, 0xfe, 0x6f, 0x01, 0xfe, 0x70, 0x80, 0xfe, 0x6f, 0x08, 0xfe, 0x70, 0x80, 0xfe, 0x90, 0x03, 0xfe, 0x70, 0x02, 0xfe, 0x71, 0x82, 0xe4, 0x71, 0xcb, 0xcf, 0xa1, 0x71, 0x02, 0x99, 0x31, 0x82, 0x91, 0x11, 0x28, 0xad, 0x18, 0xac, 0x01, 0x20, 0xac,
+  0x02, 0x18, 0xac, 0x84, 0x20, 0xac, 0x28, 0xcd, 0x81, 0x11, 0x99, 0x31, 0x99, 0x12, 0x01, 0x99, 0x31, 0x88, 0x99, 0x11, 0xba, 0xb0, 0xdc, 0x6f, 0xe5, 0x0f, 0xe5, 0x0e, 0xfe, 0x4e, 0xfe, 0x6e, 0xfe, 0x4e, 0xfe, 0x6d, 0x01, 0xfe, 0x4e, 0x60, 0xfe, 0x4d, 0x01, 0xfe, 0x4e, 0x05, 0xfe, 0x4d, 0x03, 0xfe, 0x4e, 0x01, 0xfe, 0x6e, 0x02, 0xfe, 0x4e, 0x01, 0xfe, 0x6e, 0x82, 0xfe, 0x4e, 0xfe, 0x6f, 0xfe, 0x6e, 0x05, 0xfe, 0x6f, 0x83, 0xfe, 0x4f, 0xfe, 0x6f, 0xfe, 0x70, 0xfe, 0x50, 0x0f, 0xfe, 0x70, 0x0c, 0xfe, 0x71, 0x84, 0xf6, 0x12, 0xe5, 0x31, 0xe5, 0x12, 0xd4, 0x72, 0xb2, 0x71, 0x02, 0x99, 0x31, 0x84, 0x99, 0x12, 0x99, 0x31, 0x81, 0x11, 0x28, 0xcd, 0x20, 0xac, 0x02, 0x18, 0xac,
+  0x01, 0x20, 0xac, 0x80, 0x18, 0xac, 0x01, 0x20, 0xac, 0x82, 0x28, 0xcc, 0x61, 0x0f, 0x99, 0x11, 0x07, 0x99, 0x31, 0x80, 0x99, 0x32, 0x75, 0x99, 0x31, 0x80, 0x99, 0x12, 0x03, 0x99, 0x31, 0x82, 0x99, 0x11, 0x99, 0x31, 0x99, 0x11, 0x01, 0x99, 0x31, 0x01, 0x99, 0x11, 0x01, 0x99, 0x31, 0x80, 0x99, 0x11, 0x17, 0x99, 0x31, 0x01, 0x99, 0x11, 0x81, 0x99, 0x31, 0x99, 0x32, 0x01, 0x99, 0x31, 0x80, 0x99, 0x11, 0x01, 0x99, 0x31, 0x80, 0x99, 0x12, 0x02, 0x99, 0x31, 0x82, 0x99, 0x11, 0x61, 0x0f, 0x28, 0xcc, 0x01, 0x20, 0xac, 0x80, 0x18, 0xac, 0x01, 0x20, 0xac,
+  0x01, 0x18, 0xac, 0x03, 0x20, 0xac, 0x82, 0x18, 0xac, 0x40, 0xce, 0x79, 0x10, 0x01, 0x99, 0x31, 0x80, 0x99, 0x32, 0x02, 0x99, 0x31, 0x80, 0x99, 0x11, 0x7f, 0x99, 0x31, 0x29, 0x99, 0x31, 0x82, 0x79, 0x10, 0x40, 0xce, 0x18, 0xac, 0x03, 0x20, 0xac, 0x01, 0x18, 0xac,
+  0x07, 0x20, 0xac, 0x83, 0x18, 0xab, 0x30, 0xcc, 0x58, 0xcf, 0x79, 0x10, 0x01, 0x99, 0x31, 0x80, 0x99, 0x12, 0x01, 0x99, 0x31, 0x84, 0x99, 0x11, 0x99, 0x31, 0x99, 0x11, 0x99, 0x32, 0x99, 0x31, 0x7f, 0x99, 0x11, 0x16, 0x99, 0x11, 0x84, 0x99, 0x31, 0x99, 0x32, 0x99, 0x11, 0x99, 0x31, 0x99, 0x11, 0x01, 0x99, 0x31, 0x80, 0x99, 0x12, 0x01, 0x99, 0x31, 0x83, 0x79, 0x10, 0x58, 0xcf, 0x30, 0xcc, 0x18, 0xab, 0x07, 0x20, 0xac,
 };
 
 #endif // HAS_GRAPHICAL_TFT
@@ -24,247 +24,248 @@
 
 #if HAS_GRAPHICAL_TFT
 
-extern const uint16_t marlin_logo_320x240x16[76800] = {
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x011a, 0x0119, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ce, 0x00f8, 0x0119, 0x0119, 0x0119, 0x0119, 0x08f7, 0x18ce, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08d5, 0x011a, 0x0119, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x28ee, 0x8252, 0xcb54, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x10d2, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18cd, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x00f9, 0x0119, 0x00f7, 0x00f7, 0x0119, 0x0119, 0x08f5, 0x18ae, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ae, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x394f, 0xb313, 0xd395, 0x7211, 0x18ad, 0x18ad, 0x20cd, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x00f9, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x011a, 0x0119, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x011a, 0x18cd, 0x20ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x0119, 0x011a, 0x08f3, 0x18ad, 0x18ad, 0x08f4, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x08f5, 0x0119, 0x00f9, 0x10d2, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x496f, 0xcb55, 0xd395, 0xbb54, 0x28ce, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x011a, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x10d2, 0x011a, 0x0119, 0x10d2, 0x18ad, 0x208d, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x00fa, 0x0119, 0x10d2, 0x20ad, 0x18ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18af, 0x0119, 0x0119, 0x18d0, 0x18ad, 0x18ad, 0x10d0, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x61d0, 0xd395, 0xd395, 0xd395, 0x69f1, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x00f9, 0x011a, 0x011a, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x08f3, 0x18ad, 0x18ad, 0x10d3, 0x011a, 0x011a, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x08f5, 0x0119, 0x00f9, 0x10d2, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x61d0, 0xd395, 0xd395, 0xd396, 0xd375, 0x310e, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x20ad, 0x18cd, 0x011a, 0x00f9, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ce,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08d4, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08d5, 0x0119, 0x0119, 0x00f7, 0x0117, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x20ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x392f, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0x28ce, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x0119, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f9, 0x0119, 0x18ae, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x20ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x10d2, 0x0119, 0x00f9, 0x10f2, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x011a, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x310e, 0xcb55, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0x8252, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x10d2, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18cd, 0x18ad, 0x20ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x10d2, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x0119,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x0119, 0x10f2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x08f5, 0x0119, 0x00f9, 0x10d2, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x10d2, 0x10d3, 0x08f3, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x011a, 0x00f9, 0x10d2, 0x18ae, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0xb314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0x5190, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x0119, 0x011a, 0x011a, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x011a, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x00f9, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18af, 0x0119,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ee, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x011a, 0x011a, 0x0119, 0x0119, 0x00f9, 0x0119, 0x011a, 0x00f9, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x10f2, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x08d5, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x08f5, 0x011a, 0x0119, 0x10d2, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x8252, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0x412f, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x08d5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f4, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x20ae, 0x20ad, 0x18ae, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x011a,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18cd, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0355, 0x190f, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x08f4, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ae, 0x10d2, 0x0119, 0x011a, 0x08f5, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x0119, 0x00f9, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x208e, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x08f5, 0x0119, 0x00f9, 0x10d2, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x496f, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0x496f, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x00f9, 0x0119, 0x011a, 0x011a, 0x011a, 0x0119, 0x0119, 0x0119, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ae, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x20ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x08f5,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x11d1, 0x03b7, 0x0a93, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x0119, 0x00f9, 0x011a, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ae, 0x10d2, 0x011a, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ae, 0x08f5, 0x0119, 0x00f9, 0x10d2, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x28ee, 0xbb34, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0x9ab3, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x0119, 0x00f9, 0x00f9, 0x0119, 0x0119, 0x0119, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x10af, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x011a, 0x011a, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x208d, 0x18ad, 0x10d2, 0x08f3, 0x10d3, 0x10d2, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0356, 0x03b7, 0x03b7, 0x190f, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x08f3, 0x08d4, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x00f9, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x011a, 0x0119, 0x10d2, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x0119, 0x0119, 0x00fa, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x7a31, 0xd395, 0xd395, 0xd375, 0xdb95, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd396, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f9, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x00f7, 0x0119, 0x00f9, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x11d1, 0x03b8, 0x03b7, 0x03b8, 0x0a94, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x10d2, 0x00f9, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x011a, 0x00f9, 0x10d2, 0x18ae, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x08f5, 0x00f9, 0x011a, 0x0119, 0x011a, 0x0119, 0x011a, 0x08f5, 0x20ae, 0x18ad, 0x18cd, 0x18ad, 0x18cd, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08d5, 0x0119, 0x0119, 0x10d2, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ae, 0x18ad, 0x18cd, 0x18ad, 0x20ad, 0x18ad, 0x310e, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd396, 0xd395, 0xd395, 0xb313, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x011a, 0x0119, 0x011a, 0x011a, 0x011a, 0x0119, 0x08f5, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f9, 0x08f5, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x08f5, 0x0119, 0x00f9, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x0119, 0x011a, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x011a, 0x0119, 0x011a, 0x011a, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x0356, 0x03b7, 0x03b7, 0x03b8, 0x03b7, 0x190e, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x20ad, 0x10d2, 0x011a, 0x011a, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x0119, 0x011a, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x08f5, 0x0119, 0x00f9, 0x10d2, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ae, 0xa2d3, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xa2d3, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x0119, 0x0119, 0x0119, 0x0119, 0x0117, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x00f9, 0x0119, 0x011a, 0x0119, 0x0117, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ce, 0x00f7, 0x011a, 0x011a, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x18cd, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x11d1, 0x03b8, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x0a94, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x20ae, 0x10d2, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x08d4, 0x08f3, 0x10d2, 0x18cd, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18b0, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x496f, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xaad3, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18cd, 0x10d1, 0x08f3, 0x08f3, 0x10d2, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18cd, 0x10d2, 0x08f3, 0x08d4, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f4, 0x0119, 0x0119, 0x10d1, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x00f9, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x011a, 0x0119, 0x0119, 0x011a, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0356, 0x03b8, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x190f, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x00f9, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x08f5, 0x0119, 0x00f9, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x011a, 0x0119, 0x18ce, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0xb314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0x61d0, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18cd, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x011a, 0x0119, 0x10d2, 0x18ae, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f9, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x00f9, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x0397, 0x03b8, 0x03b7, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x10d2, 0x00f9, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x011a, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x59d0, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd396, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f4, 0x011a, 0x0119, 0x10d2, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x011a, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x03b7, 0x03b7, 0x03b7, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x03b7, 0x03b7, 0x0397, 0x03b7, 0x03b8, 0x03b7, 0x03b7, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x10d2, 0x0119, 0x011a, 0x08f5, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x08f5, 0x0119, 0x011a, 0x10d1, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0xbb34, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xaad3, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x00f9, 0x10d2, 0x18cd, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x0119, 0x011a, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x03b7, 0x03b7, 0x03b7, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x0397, 0x03b7, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x011a, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ae, 0x08f5, 0x011a, 0x0119, 0x10d2, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x011a, 0x0119, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x61b1, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0x8a92, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x08f5, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x08f4, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x188d, 0x18ad, 0x10d2, 0x08f3, 0x08f3, 0x10d2, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x03b7, 0x03b7, 0x03b7, 0x18ad, 0x18ad, 0x18cd, 0x20ad, 0x03b8, 0x03b7, 0x03b8, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x10d2, 0x00f9, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18cd, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0xaad3, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0x310e, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x0119, 0x0119, 0x10d1, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x03d7, 0x0397, 0x03b7, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x03b7, 0x03b8, 0x0397, 0x03b7, 0x03b8, 0x03b7, 0x03b7, 0x18ad, 0x18ae, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x20ad, 0x10d2, 0x00f9, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x08f5, 0x0119, 0x0119, 0x10d0, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x496f, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0x7231, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18cd, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x10d1, 0x10d3, 0x08d3, 0x10d2, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x03b7, 0x03b7, 0x03b8, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x20ad, 0x10d2, 0x011a, 0x011a, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x08f5, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x011a, 0x0119, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20cd, 0x20ae, 0x8a92, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0x7a31, 0x20ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x03b7, 0x03b7, 0x03b7, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x03b7, 0x03b7, 0x03b8, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x20ae, 0x10d2, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x28ee, 0xc374, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xa2d3, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x011a, 0x0119, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ce, 0x194f, 0x18ae, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x03b7, 0x0397, 0x03b8, 0x18ad, 0x20ae, 0x20ad, 0x18ad, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b8, 0x03b7, 0x03b7, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x00f9, 0x0119, 0x08f5, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x20ad, 0x20ae, 0x20ae, 0x61d1, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0x69f1, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x10d2, 0x011a, 0x0119, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x1930, 0x02f5, 0x03b7, 0x03b8, 0x0356, 0x114f, 0x18ad, 0x18ad, 0x18ad, 0x03b8, 0x03b7, 0x03b7, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x03b7, 0x03b8, 0x03b7, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x10d2, 0x00f9, 0x0119, 0x08f4, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ae, 0x20ae, 0x9ab3, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0x412f, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ce, 0x00f8, 0x0119, 0x0119, 0x0119, 0x0119, 0x08f7, 0x18ce, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x0397, 0x03b7,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x190f, 0x0377, 0x0397, 0x03b8, 0x0398, 0x0397, 0x0b77, 0x18ce, 0x18ad, 0x18ad, 0x03b7, 0x0397, 0x03b8, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x03b7, 0x0bb7, 0x0398, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x10d2, 0x0119, 0x0119, 0x08f5, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0xc355, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0x4970, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x00f9, 0x0119, 0x00f7, 0x00f7, 0x0119, 0x0119, 0x08f5, 0x18ae, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b8, 0x03b7,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x1253, 0x0b78, 0x0b98, 0x0b78, 0x0b98, 0x0b98, 0x1378, 0x11f2, 0x18ad, 0x18ad, 0x0b98, 0x0b78, 0x0b78, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0b98, 0x1378, 0x0b78, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x0119, 0x011a, 0x08f5, 0x18ad, 0x20ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x4970, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0x8252, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x0119, 0x011a, 0x08f3, 0x18ad, 0x18ad, 0x08f4, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x18ad, 0x18ad, 0x03b8, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x1ab5, 0x1b78, 0x1b58, 0x1358, 0x1b78, 0x1378, 0x1358, 0x1a13, 0x18ae, 0x18ae, 0x1358, 0x1358, 0x1378, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x1358, 0x1358, 0x1358, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x10d2, 0x0119, 0x0119, 0x08f5, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x20ae, 0x20ae, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x7a32, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd375, 0xd395, 0xc354, 0x5990, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18af, 0x0119, 0x0119, 0x18d0, 0x18ad, 0x18ad, 0x10d0, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x1a54, 0x1b38, 0x1b38, 0x2338, 0x1b38, 0x1b58, 0x2338, 0x21d2, 0x18ad, 0x18ad, 0x2338, 0x2338, 0x2358, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x1930, 0x2339, 0x2358, 0x2338, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x10d2, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0xa2b3, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0x4970, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x08f3, 0x18ad, 0x18ad, 0x10d3, 0x011a, 0x011a, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x18ae, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x2150, 0x2b18, 0x2b39, 0x2b18, 0x2b19, 0x2b19, 0x2af8, 0x18ce, 0x18ad, 0x18ad, 0x2b19, 0x2b18, 0x2b19, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x2192, 0x2b19, 0x2b19, 0x2b18, 0x2338, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10cf, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0xbb34, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0x4970, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08d5, 0x0119, 0x0119, 0x00f7, 0x0117, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b8,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x08f3, 0x10d3, 0x10d2, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x2192, 0x2b19, 0x3319, 0x32f9, 0x2a15, 0x18ef, 0x20ad, 0x18ad, 0x18ad, 0x32f9, 0x3319, 0x32f9, 0x18ad, 0x18ad, 0x18ad, 0x2191, 0x3319, 0x2af9, 0x3319, 0x2af9, 0x2a97, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x0119, 0x0119, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x20cf, 0x20cf, 0x28cf, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0x71d1, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x20cd, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x011a, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18cd, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b8,
-  0x18ad, 0x18ae, 0x18ce, 0x00f7, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x3ad9, 0x3ad9, 0x3ad9, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x3af9, 0x3ad9, 0x3ad9, 0x18ad, 0x20ad, 0x3215, 0x3ad9, 0x3af9, 0x3ada, 0x3ad9, 0x3277, 0x18ce, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x011a, 0x011a, 0x20cd, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x28cf, 0x28cf, 0x4950, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd374, 0xd375, 0xd355, 0xd355, 0xaab3, 0x20ce, 0x18ce, 0x20ce, 0x20ae, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x10d2, 0x10d3, 0x08f3, 0x10d2, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x0398, 0x0398, 0x0398, 0x0398, 0x03b7, 0x0397,
-  0x18ad, 0x18ad, 0x08f5, 0x0139, 0x011a, 0x0117, 0x00f7, 0x011a, 0x011a, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x42d9, 0x42b9, 0x42b9, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x42b9, 0x42b9, 0x42ba, 0x18ae, 0x31f5, 0x42da, 0x42d9, 0x42b9, 0x42d9, 0x3a77, 0x18ce, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x20ad, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x0119, 0x0119, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x5991, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd374, 0xd375, 0xd355, 0xd355, 0xd355, 0x9252, 0x30ef, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x2338, 0x2338, 0x2318, 0x2319, 0x2338, 0x2338,
-  0x18ad, 0x18ad, 0x00f9, 0x0119, 0x10d3, 0x18ad, 0x18ad, 0x10f3, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x18b0, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x4a99, 0x4ab9, 0x4a9a, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x4aba, 0x4aba, 0x4a9a, 0x4257, 0x4a99, 0x4a9a, 0x4a9a, 0x4aba, 0x4237, 0x20ce, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18cd, 0x011a, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ae, 0x20ae, 0x0119, 0x0119, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28ce, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x69f1, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd375, 0xd355, 0xd355, 0xd355, 0xd335, 0xd355, 0xcb14, 0x4130, 0x20af, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x18ad, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x20ad, 0x18ad, 0x208e, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x42b9, 0x4a99, 0x42b9, 0x42ba, 0x18ad, 0x18ad,
-  0x18ad, 0x18af, 0x011a, 0x00f9, 0x10d0, 0x18ad, 0x20ad, 0x10d0, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0118, 0x10d0, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x527a, 0x527a, 0x527a, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x527a, 0x527a, 0x529a, 0x527a, 0x527a, 0x527a, 0x527a, 0x4a18, 0x20ce, 0x18ad, 0x18ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x00f9, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x10d1, 0x0117, 0x0119, 0x0119, 0x0917, 0x18d2, 0x20ce, 0x20cf, 0x28ce, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x8253, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd354, 0xd355, 0x7a11, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x6a3b, 0x6a3b, 0x6a3b, 0x621a, 0x6a3b, 0x6a3b,
-  0x18ad, 0x18ad, 0x0119, 0x0119, 0x10d3, 0x18ad, 0x20ae, 0x08f3, 0x0119, 0x0119, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x00f9, 0x18d0, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x20ad, 0x5a5b, 0x5a5a, 0x5a7a, 0x2910, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x5a5a, 0x5a7b, 0x5a5a, 0x5a5a, 0x5a5a, 0x5a5a, 0x4a18, 0x20ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d1, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x091a, 0x18f2, 0x28cf, 0x28ce, 0x28cf, 0x28cf, 0x28ef, 0x28f0, 0x30f0, 0x8232, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xa293, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x20ae, 0x20ae, 0x20ad, 0x20ad, 0x20ae, 0x20ad, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x89bc, 0x89bc, 0x89bc, 0x91bc, 0x89bc, 0x899c,
-  0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x00f7, 0x0117, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x00f9, 0x18d0, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x623a, 0x623b, 0x625a, 0x621a, 0x2910, 0x18cd, 0x18ad, 0x18ad, 0x623b, 0x623a, 0x625a, 0x623b, 0x623b, 0x51f8, 0x20ce, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x0119, 0x0119, 0x20ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0118, 0x0119, 0x0917, 0x18d2, 0x18d2, 0x0918, 0x091a, 0x0918, 0x28cf, 0x28cf, 0x28ef, 0x28ef, 0x30d0, 0x30f0, 0x30f0, 0x8252, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xd335, 0x9253, 0x30ef, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xa93d, 0xa93d, 0xa93d, 0xb13d, 0xa93d, 0xa93d,
-  0x18ad, 0x20ad, 0x18ae, 0x0117, 0x011a, 0x011a, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x00f7, 0x0119, 0x00f8, 0x18d0, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18cd, 0x59d8, 0x6a1b, 0x6a1b, 0x6a1b, 0x6a1b, 0x4133, 0x18ad, 0x18ad, 0x6a3b, 0x6a1b, 0x6a1b, 0x6a1b, 0x51b6, 0x20cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x0119, 0x00f9, 0x10d3, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x18d1, 0x20ce, 0x20ce, 0x18d1, 0x093a, 0x093a, 0x28ef, 0x28cf, 0x28cf, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x9273, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd334, 0xd335, 0xd334, 0xd334, 0xd314, 0xd315, 0xaa93, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0xd0be, 0xd0be, 0xd0be, 0xd0be, 0xd0be, 0xd0be,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x08d4, 0x08f3, 0x10d2, 0x18cd, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x0119, 0x18d0, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ce, 0x61b8, 0x721b, 0x71fb, 0x721b, 0x721b, 0x4133, 0x20ad, 0x71fb, 0x721b, 0x71fb, 0x4174, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x011a, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x0119, 0x011a, 0x18d1, 0x20ae, 0x20ce, 0x20f1, 0x093a, 0x093a, 0x28cf, 0x28cf, 0x30ef, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0xaaf4, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd314, 0xd314, 0xd315, 0x28ef, 0x28ef, 0x28cf, 0x28cf, 0x28cf, 0x28ce, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x18ae, 0x20ad, 0x20ad, 0x20ae, 0x30ee, 0x6150, 0x81b1, 0xa1f2, 0xc233, 0xca53, 0xca54, 0xca53, 0xc233, 0xa1f2, 0x8191, 0x512f, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0xf03f, 0xf03f, 0xf03f, 0xf03f, 0xf03f, 0xf03f,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x0119, 0x0119, 0x18d0, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x20ce, 0x69b9, 0x81fb, 0x79db, 0x79dc, 0x81fc, 0x5976, 0x79db, 0x79dc, 0x81dc, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x10d2, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x0918, 0x0119, 0x0917, 0x18d0, 0x20d0, 0x0917, 0x093a, 0x1138, 0x28cf, 0x30cf, 0x30ef, 0x30f0, 0x30f0, 0x3911, 0x3911, 0xaad4, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xd314, 0xd315, 0xd315, 0xd314, 0x69b2, 0x28ef, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ce, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x410f, 0x6990, 0x99f2, 0xc253, 0xca74, 0xd274, 0xca74, 0xd253, 0xca53, 0xca53, 0xca53, 0xd233, 0xd253, 0xca53, 0xd233, 0xca33, 0xc213, 0x8991, 0x410f, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x0917, 0x0119, 0x0119, 0x10cf, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x20ae, 0x7199, 0x89db, 0x89bc, 0x81bc, 0x89bc, 0x89bc, 0x89bc, 0x89bc, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x08f5, 0x011a, 0x0119, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18d2, 0x0119, 0x0119, 0x093a, 0x093a, 0x093a, 0x093a, 0x20f2, 0x28cf, 0x28f0, 0x30f0, 0x30f0, 0x3111, 0x3911, 0x3911, 0xb2f5, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xd315, 0xd314, 0xd314, 0xd2f4, 0xd2f5, 0xcad4, 0x5971, 0x30f0, 0x30d0, 0x28ef, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28ce, 0x38ef, 0x79b1, 0xba53, 0xca94, 0xca94, 0xca74, 0xd273, 0xd273, 0xca73, 0xca54, 0xca53, 0xca54, 0xca53, 0xca33, 0xca53, 0xca53, 0xca33, 0xca33, 0xca33, 0xd213, 0xca13, 0xca13, 0xa1b2, 0x490f, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20cd,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x0119, 0x00f9, 0x18b0, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ce, 0x7979, 0x919c, 0x919c, 0x91bc, 0x919c, 0x899c, 0x89bc, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x10d2, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x08f5, 0x011a, 0x0119, 0x10f2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ae, 0x20ae, 0x20ce, 0x18f2, 0x0919, 0x091a, 0x091a, 0x0919, 0x20f3, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x3110, 0x3911, 0x3911, 0x4112, 0xb2f5, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xd314, 0xd314, 0xd314, 0xd2f4, 0xd314, 0xd2f5, 0xd2f4, 0xd2f4, 0x4930, 0x30f0, 0x30ef, 0x28f0, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28ce, 0x28cf, 0x28cf, 0x28cf, 0x4130, 0x89f1, 0xd294, 0xd294, 0xca93, 0xca74, 0xd274, 0xca74, 0xca74, 0xca53, 0xca73, 0xd253, 0xd254, 0xca53, 0xca53, 0xca54, 0xc274, 0x9b36, 0x83b8, 0x6419, 0x6c39, 0x6439, 0x6c1a, 0x8b57, 0xb295, 0xca13, 0x9191, 0x28ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x00f7, 0x0119, 0x0119, 0x18af, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x28ae, 0x8159, 0x917c, 0x997c, 0x997c, 0x999c, 0x999c, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x0119, 0x0119, 0x08d5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x08f4, 0x0119, 0x00f9, 0x10d2, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ad, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20d0, 0x20d1, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x3110, 0x3910, 0x4111, 0x4112, 0x4112, 0x9294, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xd315, 0xd314, 0xd2f4, 0xd2f4, 0xd315, 0xd2f4, 0xd2f5, 0xd2f4, 0xd2d5, 0x79d2, 0x3110, 0x30f0, 0x30f0, 0x30f0, 0x28f0, 0x30d0, 0x28ef, 0x28f0, 0x28cf, 0x5150, 0xaa32, 0xd293, 0xd294, 0xd294, 0xca93, 0xca74, 0xca74, 0xca74, 0xca74, 0xd274, 0xd254, 0xca53, 0xca54, 0xb2d5, 0x83b8, 0x44fc, 0x1dbe, 0x063f, 0x0cdb, 0x0b76, 0x1377, 0x1377, 0x0b76, 0x1356, 0x0b76, 0x0b77, 0x23f8, 0x6991, 0x510f, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x00f9, 0x18af, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x20ad, 0x20ae, 0x8939, 0xa17c, 0xa17c, 0xa15d, 0xa15d, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x10d2, 0x0119, 0x011a, 0x08f5, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x28ce, 0x28cf, 0x28cf, 0x28ef, 0x28f0, 0x30f0, 0x3110, 0x3911, 0x3911, 0x3911, 0x4112, 0x4132, 0x8a54, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd315, 0xd315, 0xd315, 0xd314, 0xd314, 0xd314, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2f4, 0xd2f4, 0xd2d4, 0xcad4, 0x5951, 0x38f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x4130, 0x91f2, 0xd294, 0xd294, 0xca94, 0xca74, 0xca94, 0xca94, 0xca74, 0xd274, 0xd274, 0xd274, 0xd253, 0xb2d5, 0x7419, 0x257d, 0x063f, 0x061f, 0x057d, 0x12b5, 0x190f, 0x18ce, 0x20ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x0117, 0x0119, 0x0119, 0x18b0, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ce, 0x913a, 0xa93d, 0xa95d, 0xa95c, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x0119, 0x0119, 0x08f5, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18ad, 0x20ae, 0x18ae, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x28ce, 0x28cf, 0x28ef, 0x28f0, 0x30f0, 0x30f0, 0x3911, 0x3911, 0x3911, 0x4132, 0x4132, 0x4932, 0x9255, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xd315, 0xd315, 0xd314, 0xd314, 0xd314, 0xd2f4, 0xd2f5, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2d4, 0xd2d4, 0xcab4, 0x5172, 0x3911, 0x38f1, 0x38f0, 0x30f0, 0x81d2, 0xc294, 0xd294, 0xd293, 0xd294, 0xd294, 0xca93, 0xca93, 0xd274, 0xd274, 0xca73, 0xd274, 0x83d8, 0x353d, 0x061f, 0x063f, 0x063f, 0x063f, 0x4c5a, 0x4970, 0x20ae, 0x20ae, 0x20ad, 0x18cd, 0x20ad, 0x20ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18cd, 0x10d2, 0x08f3, 0x08d4, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18cd, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x00f9, 0x10cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0xb11d, 0xb11d, 0xb11d, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x0119, 0x0119, 0x08d5, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x20cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x4112, 0x4132, 0x4932, 0x4953, 0x6b36, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2d4, 0xd2d4, 0xd2d5, 0xd2d4, 0xcad4, 0xcab4, 0x5972, 0x3911, 0x5151, 0xb253, 0xcab4, 0xd294, 0xca94, 0xd294, 0xca94, 0xd294, 0xca94, 0xca74, 0xd274, 0xc294, 0x645a, 0x1dbe, 0x063f, 0x063f, 0x063f, 0x1dbe, 0x6459, 0xc274, 0x99d2, 0x28ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ce, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18af, 0x0117, 0x0119, 0x0119, 0x0119, 0x0119, 0x0117, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x0119, 0x18d0, 0x18cd, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0xb8fe, 0xb8fd, 0xb8fe, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d0, 0x00f9, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28f0, 0x30f0, 0x30f0, 0x3911, 0x3911, 0x4111, 0x4132, 0x4132, 0x4933, 0x4953, 0x253b, 0x465c, 0x6d7b, 0x6d9a, 0x6d9a, 0x6d7a, 0x84f9, 0x9c78, 0x9c77, 0x9c78, 0x9c78, 0x9c57, 0x9c78, 0x9c58, 0x9c58, 0xbbb6, 0xd334, 0xd315, 0xd334, 0xd315, 0xd314, 0xd315, 0xd2f4, 0xcaf4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2d4, 0xcad4, 0xd2d4, 0xd2d4, 0xcad4, 0xcab4, 0xd2d4, 0x91f3, 0x5972, 0xca74, 0xd2b4, 0xd2b4, 0xd294, 0xca94, 0xd294, 0xd294, 0xca94, 0xca74, 0xc2b4, 0x6c5a, 0x0dff, 0x063f, 0x063f, 0x063f, 0x353d, 0x83b8, 0xca53, 0xca33, 0x89b1, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x011a, 0x0119, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x00f9, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f9, 0x08f5, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x0119, 0x0119, 0x18d0, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ae, 0xc0de, 0xc0fe, 0xc0dd, 0x18ae, 0x18cd, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x00f9, 0x00fa, 0x08f4, 0x18ad, 0x18ae, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x30ef, 0x30f0, 0x30f0, 0x3911, 0x38f1, 0x3911, 0x4112, 0x4132, 0x4932, 0x4953, 0x5153, 0x4d1a, 0x6d9a, 0x94b9, 0x9c98, 0x9c77, 0x9c78, 0x9c78, 0x9c78, 0x94b8, 0x6d7a, 0x6d7a, 0x6d7b, 0x367c, 0x367d, 0x1efe, 0x077f, 0x075f, 0x1ede, 0x363d, 0x6d3a, 0x9c17, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xcad4, 0xd2b4, 0xcad4, 0xd2b3, 0xcab4, 0xc294, 0xcab4, 0xca94, 0xca94, 0xd294, 0xca94, 0xca74, 0xca74, 0xca74, 0x7bd8, 0x0dff, 0x063f, 0x061f, 0x063f, 0x4cbb, 0x9b57, 0xd233, 0xca33, 0xca53, 0x6150, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x0119, 0x0119, 0x011a, 0x011a, 0x011a, 0x0119, 0x0119, 0x0119, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x0917, 0x0119, 0x0119, 0x18cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xc8be, 0xc8de, 0xc8be, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x20ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x3912, 0x4132, 0x4132, 0x4933, 0x5153, 0xa2b5, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd355, 0xd334, 0xd335, 0xd335, 0xd335, 0xd335, 0xbb96, 0xa437, 0x74f9, 0x4dbc, 0x2e7e, 0x0edf, 0x559b, 0x8498, 0xc335, 0xd2f4, 0xd2d4, 0xd2f5, 0xd2d4, 0xd2d4, 0xd2b5, 0xcab4, 0xd2b4, 0xd2b4, 0xcab4, 0xd2b4, 0xd2b4, 0xbab4, 0xbaf6, 0xca94, 0xd294, 0xca94, 0xd273, 0x9b76, 0x1dbe, 0x061f, 0x063f, 0x0ddf, 0x643a, 0xb2d5, 0xca54, 0xd253, 0xca53, 0xc294, 0x59b1, 0x28ce, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ae, 0x18ad, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x0119, 0x00f9, 0x18af, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18cd, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x40b0, 0xa09a, 0xd0be, 0xd09e, 0xd0be, 0xb89c, 0x78b5, 0x28ae, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x011a, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x30ef, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x4112, 0x4112, 0x4932, 0x4933, 0x5173, 0xbb15, 0xd395, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd355, 0xd335, 0xd335, 0xd314, 0xd314, 0xd335, 0xd315, 0xd314, 0xd315, 0xd2f5, 0xd2f5, 0xd2f4, 0x9bf7, 0x6d1a, 0x2e3d, 0x45bc, 0x9418, 0xd2d4, 0xcad4, 0xd2d4, 0xd2b4, 0xd2b4, 0xd2b4, 0xcab4, 0xd2b4, 0xd294, 0xd294, 0xd294, 0xc2d4, 0x4cdb, 0x7bd8, 0x9b57, 0x44fc, 0x063f, 0x063f, 0x1dbe, 0x83d8, 0xc294, 0xca53, 0xca54, 0xca33, 0xca53, 0xb2b5, 0x33b8, 0x28f0, 0x28cf, 0x28cf, 0x28cf, 0x20cf, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x188e, 0x20cd, 0x10d1, 0x0119, 0x011a, 0x10d1, 0x20ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x00f7, 0x0119, 0x0118, 0x10d0, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x40b0, 0xd07d, 0xd87e, 0xd89f, 0xd89f, 0xe07f, 0xd89e, 0xd89f, 0xb87b, 0x28ae, 0x20ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x011a, 0x0119, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ad, 0x20ad, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28ef, 0x28ef, 0x28ef, 0x30f0, 0x30f0, 0x3110, 0x3911, 0x3911, 0x3911, 0x4132, 0x4132, 0x4933, 0x5174, 0xbb14, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd334, 0xd335, 0xd335, 0xd335, 0xd314, 0xd335, 0xd315, 0xd314, 0xd314, 0xd315, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2d4, 0xc335, 0x8478, 0x4d7b, 0x4d5b, 0xab96, 0xd2b4, 0xcab4, 0xd2b4, 0xd2b4, 0xca94, 0xcab4, 0xd294, 0xd294, 0xd273, 0xc2b4, 0x5c9a, 0x061f, 0x061f, 0x063f, 0x7419, 0xd273, 0xd273, 0xca53, 0xca53, 0xd233, 0xca53, 0xaaf6, 0x153c, 0x2951, 0x30f0, 0x30f0, 0x28ef, 0x28ef, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x0119, 0x0119, 0x0119, 0x0119, 0x0117, 0x18ce, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f6, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x0119, 0x10b0, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x208d, 0x18ad, 0x10d2, 0x08f3, 0x10d3, 0x10d2, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xb07a, 0xe85f, 0xe85f, 0xe07f, 0xe85f, 0xe87f, 0xe07f, 0xe85f, 0xe07f, 0x9898, 0x20ad, 0x18ad, 0x18cd, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x011a, 0x0119, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x3110, 0x3910, 0x3911, 0x3911, 0x4112, 0x4132, 0x4932, 0x5153, 0xbb15, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd354, 0xd355, 0xd335, 0xd355, 0xd335, 0xd335, 0xd315, 0xcb34, 0xd315, 0xd314, 0xd314, 0xd315, 0xd314, 0xd2f4, 0xd2f5, 0xd2f4, 0xcaf4, 0xd2f4, 0xd2d4, 0xd2d4, 0xd2d5, 0xd2d4, 0xd2d4, 0xbb55, 0x7499, 0x35dc, 0x8439, 0xc2f4, 0xd2b4, 0xd294, 0xd294, 0xd294, 0xca93, 0xd294, 0xd274, 0xca74, 0x9b76, 0x061f, 0x061f, 0x83d8, 0xc295, 0xca53, 0xca53, 0xca53, 0xca53, 0x7bb8, 0x063f, 0x2a34, 0x30f0, 0x30f0, 0x30ef, 0x30f0, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x011a, 0x0119, 0x011a, 0x00f9, 0x08d5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x0118, 0x18d0, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x00f7, 0x0119, 0x00f9, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x38b0, 0xf05f, 0xe83f, 0xf03f, 0xf05f, 0xf05f, 0xf03f, 0xf03f, 0xf03f, 0xf05f, 0xe83f, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x30ef, 0x30f0, 0x30f0, 0x30f0, 0x3911, 0x3911, 0x3911, 0x4112, 0x4132, 0x4933, 0x5173, 0xbb35, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xcb35, 0xd315, 0xd314, 0xd314, 0xd314, 0xd314, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2f5, 0xcad4, 0xd2f4, 0xcad4, 0xd2d4, 0xd2d4, 0xcab4, 0xd2b4, 0xcab4, 0xcab4, 0x8bf8, 0x3d5c, 0x6499, 0xc2d4, 0xd294, 0xd294, 0xca74, 0xca74, 0xd274, 0xca74, 0xca74, 0x54bb, 0x5c9a, 0x353d, 0x1dbe, 0x4cbb, 0x9377, 0x9b36, 0x44fc, 0x061f, 0x1bf9, 0x3911, 0x3910, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x0119, 0x011a, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x0119, 0x0119, 0x0119, 0x0119, 0x08f4, 0x10f3, 0x10d2, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18cd, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x00f7, 0x0119, 0x0118, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x011a, 0x0119, 0x011a, 0x011a, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x5092, 0xf83f, 0xf83f, 0xf03f, 0xf83f, 0xf83f, 0xf83f, 0xf83f, 0xf81f, 0xf03f, 0xf83f, 0x5092, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x011a, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x3911, 0x3911, 0x3911, 0x4112, 0x4132, 0x4932, 0x69b3, 0xc355, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xd335, 0xd335, 0xd314, 0xd314, 0xd314, 0xd2f5, 0xd2f5, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xcad4, 0xcab4, 0xd2b4, 0xd2b4, 0xcab4, 0xd294, 0x9b97, 0x453c, 0x6c59, 0xc2b4, 0xca74, 0xd274, 0xd273, 0xca73, 0xd273, 0xc294, 0x6c39, 0xc294, 0xca53, 0x8b98, 0x4cbb, 0x0dff, 0x063f, 0x0d7e, 0x3972, 0x3911, 0x3911, 0x3911, 0x38f0, 0x30f0, 0x30f0, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x011a, 0x0119, 0x011a, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x20ae, 0x18ad, 0x18ad, 0x10d2, 0x0119, 0x0119, 0x0119, 0x00f9, 0x10cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x18cd, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x5092, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x5092, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x011a, 0x0119, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x4111, 0x4112, 0x4132, 0x4933, 0x9254, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd375, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd314, 0xd314, 0xd314, 0xd314, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2f4, 0xd2d4, 0xd2d4, 0xcad4, 0xd2d4, 0xcad4, 0xd2d4, 0xd2b4, 0xcab4, 0xd2b4, 0xd2b4, 0xcab4, 0xd294, 0xd294, 0xd294, 0xca94, 0x9b77, 0x44dc, 0x73f9, 0xca73, 0xca74, 0xd254, 0xca73, 0xca53, 0xc294, 0x351c, 0x6c3a, 0xc294, 0xd253, 0xca34, 0x83b8, 0x5a55, 0x4132, 0x4132, 0x3912, 0x3911, 0x3911, 0x3910, 0x30f0, 0x30f0, 0x30f0, 0x28f0, 0x28ef, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x18ad, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18b0, 0x0119, 0x011a, 0x0119, 0x00f8, 0x18d0, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ce, 0x0117, 0x0119, 0x0119, 0x00f9, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x4090, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x28af, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18cd, 0x20ad, 0x0119, 0x0119, 0x18ae, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28ef, 0x28f0, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x4112, 0x4132, 0x4132, 0x69d3, 0xc355, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xcb55, 0xd335, 0xd335, 0xd335, 0xd315, 0xd314, 0xd314, 0xd314, 0xd314, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xcad4, 0xd2f4, 0xd2d4, 0xd2d4, 0xd2b4, 0xd2b4, 0xd2b4, 0xcab4, 0xcab4, 0xcab4, 0xd2b4, 0xcab4, 0xd294, 0xd294, 0xd294, 0xca94, 0xd274, 0xca74, 0x8b78, 0x447c, 0xa316, 0xd253, 0xd253, 0xca54, 0xca53, 0xc294, 0x257d, 0x0ddf, 0x83b8, 0xd233, 0xca33, 0xca33, 0xba13, 0x7993, 0x4112, 0x4112, 0x4111, 0x3911, 0x3911, 0x38f0, 0x30f0, 0x28f0, 0x30d0, 0x30d0, 0x28ef, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x08f5, 0x0119, 0x011a, 0x011a, 0x0119, 0x011a, 0x00f9, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10cf, 0x0119, 0x00f9, 0x0119, 0x00f8, 0x18cf, 0x18ad, 0x18ae, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x00f9, 0x011a, 0x0119, 0x011a, 0x00f9, 0x0119, 0x0119, 0x00f9, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x20ad, 0xd03c, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xd03c, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x00f9, 0x0119, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ad, 0x20ad, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x3911, 0x3911, 0x3911, 0x4111, 0x4112, 0x5193, 0xaad4, 0xd375, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd314, 0xd314, 0xd315, 0xd314, 0xd314, 0xd314, 0xd314, 0xd315, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2d4, 0xd2d4, 0xd2d4, 0xcad4, 0xd2b4, 0xd2b4, 0xd2d4, 0xd2b4, 0xcab4, 0xd2b4, 0xd2b4, 0xd294, 0xd2b4, 0xca94, 0xca94, 0xd294, 0xca74, 0xca73, 0xca74, 0xd274, 0xc295, 0x6bb9, 0x6b99, 0xca54, 0xca53, 0xd254, 0xca33, 0xc294, 0x24fd, 0x063f, 0x351d, 0xb295, 0xca13, 0xca13, 0xca13, 0xb9f3, 0x7992, 0x4111, 0x4112, 0x38f1, 0x3911, 0x3911, 0x38f0, 0x30f0, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18cf, 0x00f7, 0x0119, 0x0119, 0x0119, 0x0119, 0x0117, 0x18ce, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cf, 0x0118, 0x00f9, 0x0119, 0x00f9, 0x18d0, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x00f9, 0x0119, 0x0119, 0x0119, 0x00fa, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x4090, 0xf03f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x6073, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20cd, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x30ef, 0x28f0, 0x30f0, 0x30f0, 0x30f0, 0x3910, 0x3911, 0x3912, 0x4112, 0x4112, 0x8233, 0xcb55, 0xd375, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd334, 0xd314, 0xd335, 0xd314, 0xd314, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2d4, 0xd2d4, 0xd2d4, 0xcad4, 0xd2d4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xcab4, 0xd2b4, 0xd2b4, 0xcab4, 0xd294, 0xd294, 0xd294, 0xca74, 0xca74, 0xca74, 0xca73, 0xca73, 0xca53, 0xca53, 0xca74, 0xaab6, 0x5b7a, 0xba74, 0xca53, 0xca33, 0xca33, 0xc254, 0x4bfb, 0x059f, 0x0d7f, 0x8b57, 0xc9f3, 0xca13, 0xc9f3, 0xc9f3, 0xa9b3, 0x5952, 0x4112, 0x3931, 0x3911, 0x3111, 0x3110, 0x30f0, 0x30f0, 0x28f0, 0x28ef, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x10d2, 0x08f3, 0x10d3, 0x10d2, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18d0, 0x00f9, 0x0119, 0x0119, 0x0118, 0x10cf, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x011a, 0x0119, 0x011a, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x4091, 0xe01d, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0x7074, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x011a, 0x08f3, 0x10d2, 0x20cd, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x20ad, 0x10d1, 0x0119, 0x0119, 0x10d2, 0x20ad, 0x18ad, 0x20ae, 0x18cd, 0x20ae, 0x20cd, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x3910, 0x3911, 0x3911, 0x3912, 0x4132, 0x4953, 0xb2f4, 0xd395, 0xdb95, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd334, 0x84f9, 0x467d, 0x1f5e, 0x07df, 0x07df, 0x07df, 0x07bf, 0x07bf, 0x07bf, 0x07bf, 0x07bf, 0x07bf, 0x07bf, 0x07bf, 0x07bf, 0x079f, 0x1f1e, 0x367d, 0x367c, 0x4ddb, 0x653a, 0x8498, 0x9bf7, 0xc2f5, 0xd294, 0xd294, 0xd294, 0xd294, 0xca94, 0xca94, 0xca74, 0xca73, 0xd253, 0xd254, 0xca74, 0xca53, 0xca53, 0xca53, 0xd253, 0x72d9, 0xaa76, 0xca33, 0xd233, 0xca13, 0xca33, 0x1c7e, 0x059f, 0x05ff, 0x5c7a, 0xca13, 0xc9f3, 0xc9f3, 0xc9f3, 0xd1f3, 0x9193, 0x4911, 0x3911, 0x3911, 0x3911, 0x3110, 0x30f0, 0x30f0, 0x30f0, 0x28ef, 0x28ef, 0x28cf, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0118, 0x10b0, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x10d1, 0x08f3, 0x08f3, 0x10d2, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x7074, 0x9077, 0x8856, 0x8876, 0x388f, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18cd, 0x18ae, 0x18ce, 0x00f7, 0x0119, 0x011a, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x08f7, 0x0119, 0x011a, 0x0119, 0x0119, 0x08f7, 0x18ce, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x30ef, 0x30f0, 0x30f0, 0x30f0, 0x3111, 0x3111, 0x38f1, 0x3911, 0x4111, 0x4132, 0x6193, 0xc355, 0xd396, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd375, 0xd355, 0xd355, 0xd335, 0xd335, 0xb3d6, 0x271d, 0x07ff, 0x07ff, 0x07bf, 0x079f, 0x079f, 0x077f, 0x079f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x075f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x079f, 0x079f, 0x1efe, 0x461c, 0x6d1a, 0x9bd6, 0xca74, 0xca74, 0xca74, 0xca73, 0xd274, 0xca74, 0xca53, 0xd254, 0xca54, 0xd253, 0xca53, 0xca33, 0xa275, 0x9a76, 0xca33, 0xca13, 0xca33, 0x9ad6, 0x04ff, 0x05bf, 0x063f, 0x357c, 0xc254, 0xc9f3, 0xd1f3, 0xc9f3, 0xc9f3, 0xb9d3, 0x6152, 0x4111, 0x3911, 0x3911, 0x38f0, 0x30f0, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x00f8, 0x10d0, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x208e, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18cd, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x00f9, 0x08f5, 0x18ae, 0x20ad, 0x18ad, 0x08f4, 0x0119, 0x011a, 0x00f7, 0x0117, 0x0119, 0x011a, 0x08f5, 0x20ae, 0x20ae, 0x20ad, 0x20ce, 0x20ce, 0x20ce, 0x20cd, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x30ef, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x3910, 0x3911, 0x3911, 0x3911, 0x4112, 0x4132, 0x6193, 0xcb55, 0xd395, 0xd395, 0xd375, 0xd395, 0xd375, 0xd375, 0xd375, 0xd355, 0xd375, 0xd355, 0xd355, 0xd355, 0xcb55, 0xd334, 0xcb55, 0xac17, 0x0fbf, 0x07ff, 0x07ff, 0x07bf, 0x07bf, 0x077f, 0x075f, 0x075f, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x075f, 0x075f, 0x077f, 0x077f, 0x079f, 0x07bf, 0x365c, 0x74b9, 0xb315, 0xca73, 0xca54, 0xca54, 0xca53, 0xca53, 0xca53, 0xca33, 0xd233, 0xca33, 0xb235, 0xaa16, 0xca33, 0xca13, 0xca13, 0x7b37, 0x055f, 0x05ff, 0x067f, 0x25dd, 0xa2f5, 0xd1d3, 0xc9f3, 0xc9d3, 0xc9d2, 0xc9d3, 0x9193, 0x4932, 0x4111, 0x3911, 0x38f0, 0x30f0, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x18b0, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x0119, 0x00f9, 0x011a, 0x011a, 0x0119, 0x011a, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x10d3, 0x18ce, 0x20ad, 0x10f4, 0x011a, 0x0119, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x30ef, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x3911, 0x4111, 0x4132, 0x4132, 0x61b3, 0xcb75, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd375, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0x8cb8, 0x0fbf, 0x07ff, 0x07df, 0x07bf, 0x079f, 0x077f, 0x075f, 0x073f, 0x071f, 0x06ff, 0x06ff, 0x06ff, 0x06ff, 0x06ff, 0x06ff, 0x06ff, 0x06df, 0x06ff, 0x06df, 0x06df, 0x06df, 0x06ff, 0x06ff, 0x06ff, 0x06ff, 0x071f, 0x071f, 0x071f, 0x073f, 0x073f, 0x073f, 0x073f, 0x075f, 0x075f, 0x071f, 0x2dfd, 0x7419, 0xb2b5, 0xca53, 0xca53, 0xca33, 0xca33, 0xca33, 0xca33, 0xd233, 0xca14, 0xa215, 0xca13, 0xca13, 0xc9f3, 0x8338, 0x05bf, 0x063f, 0x06bf, 0x0e9f, 0xaad5, 0xc9d3, 0xc9d2, 0xc9d3, 0xc9d3, 0xc9b2, 0xb1b2, 0x5931, 0x3911, 0x3911, 0x3911, 0x30f0, 0x30f0, 0x28f0, 0x28ef, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18cf, 0x011a, 0x0119, 0x10d0, 0x18ad, 0x20ae, 0x18d0, 0x0119, 0x0119, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x3111, 0x38f1, 0x3911, 0x3911, 0x4112, 0x4112, 0x4132, 0x6193, 0xcb75, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd354, 0xd355, 0xd355, 0xc395, 0x5dfa, 0x07ff, 0x07df, 0x07bf, 0x079f, 0x077f, 0x075f, 0x073f, 0x071f, 0x06ff, 0x06df, 0x06bf, 0x06bf, 0x069f, 0x069f, 0x069f, 0x069f, 0x06bf, 0x06bf, 0x069f, 0x069f, 0x069f, 0x069f, 0x069f, 0x069f, 0x069f, 0x06bf, 0x06bf, 0x06bf, 0x06df, 0x06df, 0x06ff, 0x06ff, 0x06ff, 0x071f, 0x071f, 0x06ff, 0x06bf, 0x065f, 0x05bf, 0x443c, 0x8af7, 0xca33, 0xca33, 0xca33, 0xca33, 0xca13, 0xca13, 0xca13, 0x99b6, 0xc9f3, 0xca13, 0xc9f3, 0x4c3b, 0x061f, 0x069f, 0x06ff, 0x0ebe, 0xa2d5, 0xc9b3, 0xc9d3, 0xc9b2, 0xc9b3, 0xc9b2, 0xc1b3, 0x7152, 0x3911, 0x3911, 0x3110, 0x30f0, 0x30f0, 0x28f0, 0x30d0, 0x28cf, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ce, 0x08f7, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x011a, 0x011a, 0x0119, 0x20ae, 0x20ad, 0x18ce, 0x0119, 0x0119, 0x10d3, 0x20ce, 0x20ae, 0x10f4, 0x0119, 0x011a, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28cf, 0x28ef, 0x30ef, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x3911, 0x3911, 0x3911, 0x4112, 0x3912, 0x4112, 0x4132, 0x4133, 0x5153, 0xbb35, 0xd395, 0xd396, 0xd395, 0xd375, 0xd375, 0xd375, 0xd355, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xbbd6, 0x5dfb, 0x0fbf, 0x07ff, 0x07df, 0x07bf, 0x077f, 0x075f, 0x073f, 0x071f, 0x06ff, 0x06df, 0x06bf, 0x069f, 0x069f, 0x067f, 0x067f, 0x067f, 0x065f, 0x065f, 0x065f, 0x065f, 0x065f, 0x065f, 0x065f, 0x065f, 0x065f, 0x065f, 0x067f, 0x065f, 0x065f, 0x067f, 0x067f, 0x069f, 0x069f, 0x069f, 0x06bf, 0x06bf, 0x06df, 0x06bf, 0x069f, 0x065f, 0x05ff, 0x053f, 0x049f, 0x1bbe, 0x8298, 0xca13, 0xca13, 0xca13, 0xca13, 0xca13, 0xd1f3, 0x99b6, 0xc9f3, 0xc9f3, 0xb254, 0x0d9f, 0x067f, 0x06df, 0x06ff, 0x0ebf, 0xa2d5, 0xc9d2, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b2, 0xc9b3, 0x8152, 0x3911, 0x3911, 0x3911, 0x30f0, 0x30f0, 0x28f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x0119, 0x0119, 0x00f9, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x08f5, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x011a, 0x08f5, 0x18ae, 0x20ae, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x0918, 0x0917, 0x0139, 0x011a, 0x10f5, 0x20ce, 0x20cf, 0x28cf, 0x28ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30ef, 0x30f0, 0x30f0, 0x30f0, 0x3110, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x3911, 0x4112, 0x4112, 0x4132, 0x4932, 0x4133, 0x4933, 0xbb35, 0xd395, 0xd396, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xac37, 0x6d9a, 0x2efe, 0x07ff, 0x07ff, 0x07df, 0x07bf, 0x079f, 0x075f, 0x073f, 0x071f, 0x06df, 0x06bf, 0x069f, 0x067f, 0x065f, 0x065f, 0x063f, 0x063f, 0x061f, 0x061f, 0x061f, 0x061f, 0x061f, 0x061f, 0x061f, 0x061f, 0x061f, 0x05ff, 0x061f, 0x061f, 0x061f, 0x061f, 0x061f, 0x061f, 0x063f, 0x063f, 0x063f, 0x065f, 0x065f, 0x065f, 0x065f, 0x067f, 0x067f, 0x063f, 0x05df, 0x055f, 0x04bf, 0x043f, 0x037f, 0x1abe, 0x7a18, 0xca13, 0xca13, 0xca13, 0xc9f3, 0xc1f4, 0x7178, 0xc9f2, 0xd1f3, 0x8338, 0x061f, 0x06bf, 0x06ff, 0x071f, 0x0edf, 0xa2d5, 0xc9b3, 0xc9b3, 0xc9b2, 0xc992, 0xc992, 0xc993, 0x9172, 0x3911, 0x3910, 0x3110, 0x30f0, 0x30f0, 0x30f0, 0x28ef, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x011a, 0x0119, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ae, 0x00f7, 0x011a, 0x0119, 0x0119, 0x011a, 0x00f7, 0x18ce, 0x20ad, 0x20ae, 0x20ae, 0x18ce, 0x0918, 0x011a, 0x011a, 0x0919, 0x011a, 0x0917, 0x20cf, 0x28ae, 0x20cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28ef, 0x28ef, 0x30ef, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x38f0, 0x3911, 0x3911, 0x3911, 0x3911, 0x3912, 0x4112, 0x4132, 0x4932, 0x4933, 0x4933, 0x4953, 0xa2b4, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd355, 0xd375, 0xd355, 0xc3b6, 0x8519, 0x4e3c, 0x0f9f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x079f, 0x077f, 0x077f, 0x075f, 0x073f, 0x06ff, 0x06bf, 0x069f, 0x067f, 0x065f, 0x063f, 0x061f, 0x061f, 0x05ff, 0x05df, 0x05df, 0x05df, 0x05df, 0x05bf, 0x05bf, 0x05df, 0x05df, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05df, 0x05df, 0x05df, 0x05df, 0x05ff, 0x05ff, 0x061f, 0x061f, 0x061f, 0x061f, 0x061f, 0x061f, 0x05df, 0x057f, 0x04ff, 0x047f, 0x03df, 0x031f, 0x025f, 0x19de, 0x79b8, 0xc9f3, 0xca13, 0xc9f3, 0xb9d3, 0xa1b5, 0xc9d3, 0xc9f3, 0x4c5b, 0x065f, 0x06df, 0x071f, 0x071f, 0x0edf, 0xa2b5, 0xc9b3, 0xc9b3, 0xc992, 0xc992, 0xc993, 0xc992, 0xb172, 0x4911, 0x3911, 0x38f0, 0x30f0, 0x30f0, 0x30ef, 0x28ef, 0x28ef, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x011a, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x10d2, 0x10f3, 0x10f3, 0x10d2, 0x20ae, 0x18ae, 0x20ae, 0x18ce, 0x20ce, 0x20ce, 0x20ce, 0x18f2, 0x10f4, 0x1114, 0x18f3, 0x20cf, 0x28ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28ef, 0x30ef, 0x30f0, 0x30f0, 0x30f0, 0x3110, 0x38f0, 0x3911, 0x3911, 0x3911, 0x3912, 0x3911, 0x4112, 0x4132, 0x4132, 0x4933, 0x4933, 0x4933, 0x4953, 0xa2b5, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xc3b5, 0x7d59, 0x36bd, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07bf, 0x07bf, 0x079f, 0x079f, 0x077f, 0x077f, 0x071f, 0x06de, 0x069e, 0x067e, 0x065e, 0x063f, 0x063f, 0x061e, 0x05ff, 0x05df, 0x05bf, 0x05bf, 0x059f, 0x059f, 0x059f, 0x057f, 0x057f, 0x057f, 0x057f, 0x057f, 0x057f, 0x057f, 0x057f, 0x057f, 0x057f, 0x057f, 0x057f, 0x059f, 0x059f, 0x059f, 0x05bf, 0x05bf, 0x05bf, 0x05df, 0x05df, 0x05df, 0x05bf, 0x057f, 0x04ff, 0x049f, 0x03ff, 0x037f, 0x02bf, 0x021f, 0x017f, 0x213d, 0x9996, 0xc9f3, 0xc9f3, 0xb9d4, 0x99b6, 0xc9d3, 0xc213, 0x0dbf, 0x069f, 0x06ff, 0x071f, 0x073f, 0x0eff, 0xa2b5, 0xc992, 0xc992, 0xc992, 0xc992, 0xc972, 0xc972, 0xa972, 0x4911, 0x3911, 0x38f0, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x0119, 0x0119, 0x011a, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ae, 0x18ce, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20af, 0x20ce, 0x28ce, 0x28cf, 0x28ef, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x3110, 0x3910, 0x3911, 0x3911, 0x3911, 0x3911, 0x4111, 0x4131, 0x4112, 0x4132, 0x4913, 0x4933, 0x4933, 0x4953, 0x5154, 0xaab5, 0xd375, 0xd395, 0xd375, 0xd395, 0xd375, 0x94d8, 0x467c, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07df, 0x07bf, 0x07bf, 0x079f, 0x079f, 0x077f, 0x077f, 0x06de, 0x06be, 0x067e, 0x067e, 0x065e, 0x063e, 0x061e, 0x05fe, 0x05de, 0x05de, 0x05be, 0x059f, 0x057f, 0x057f, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x055f, 0x055f, 0x055f, 0x057f, 0x057f, 0x057f, 0x057f, 0x057f, 0x055f, 0x04ff, 0x04bf, 0x041f, 0x039f, 0x031f, 0x025f, 0x01bf, 0x013f, 0x00bf, 0x40fb, 0xb1b5, 0xc9d2, 0xb1d5, 0xb1d4, 0xc9b3, 0x6399, 0x061f, 0x06df, 0x071f, 0x073f, 0x073f, 0x0eff, 0xa2b5, 0xc992, 0xc992, 0xc972, 0xc972, 0xc992, 0xc972, 0xb152, 0x4111, 0x3911, 0x30f0, 0x30f0, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x0117, 0x011a, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x18ad, 0x20ae, 0x20ae, 0x20ce, 0x20cd, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x28ce, 0x20cf, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30ef, 0x30d0, 0x28f0, 0x3110, 0x30f0, 0x30f0, 0x30f1, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x4112, 0x4132, 0x4132, 0x4132, 0x4932, 0x4933, 0x4953, 0x4953, 0x5153, 0x4a16, 0xa2b5, 0xd395, 0xd395, 0xd395, 0xd375, 0x8539, 0x1f5e, 0x07ff, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07df, 0x07df, 0x07bf, 0x07bf, 0x079f, 0x07bf, 0x075f, 0x06be, 0x069d, 0x067d, 0x065d, 0x063d, 0x063d, 0x061d, 0x05fe, 0x05de, 0x05de, 0x05be, 0x059e, 0x057e, 0x055f, 0x053f, 0x053f, 0x051f, 0x051f, 0x04ff, 0x04ff, 0x04ff, 0x04ff, 0x04ff, 0x04ff, 0x04ff, 0x04ff, 0x04ff, 0x04ff, 0x04ff, 0x051f, 0x051f, 0x051f, 0x051f, 0x051f, 0x051f, 0x053f, 0x053f, 0x051f, 0x04df, 0x04bf, 0x043f, 0x03df, 0x035f, 0x02bf, 0x021f, 0x017f, 0x00ff, 0x009f, 0x087f, 0x7119, 0xc9d3, 0xb1d4, 0xb9d3, 0xc9b3, 0x1cfe, 0x065f, 0x06ff, 0x071f, 0x073f, 0x073f, 0x1ebe, 0xb9f3, 0xc993, 0xc972, 0xc992, 0xc972, 0xc973, 0xc952, 0xb152, 0x4111, 0x3910, 0x38f0, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x011a, 0x0139, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x20ad, 0x20cd, 0x20ce, 0x20ae, 0x20ae, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x20cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28cf, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x3910, 0x3911, 0x3911, 0x3911, 0x3911, 0x4132, 0x4132, 0x4132, 0x4932, 0x4933, 0x4933, 0x4933, 0x4953, 0x4a15, 0x3439, 0x16bd, 0x8519, 0xd395, 0xd395, 0xd395, 0x94d8, 0x1f5e, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07bf, 0x07bf, 0x07bf, 0x07bf, 0x071e, 0x069d, 0x069d, 0x067d, 0x065d, 0x063d, 0x063d, 0x061d, 0x05fd, 0x05dd, 0x05bd, 0x059d, 0x059e, 0x057e, 0x055e, 0x053e, 0x051e, 0x04ff, 0x04ff, 0x04df, 0x04bf, 0x04bf, 0x04bf, 0x049f, 0x049f, 0x049f, 0x049f, 0x049f, 0x04bf, 0x04bf, 0x04bf, 0x04bf, 0x04bf, 0x04bf, 0x04df, 0x04bf, 0x04df, 0x04df, 0x04df, 0x04bf, 0x049f, 0x043f, 0x03df, 0x035f, 0x02ff, 0x025f, 0x01bf, 0x013f, 0x00df, 0x007f, 0x005f, 0x185e, 0x8957, 0x61b9, 0xc9d3, 0x9a96, 0x059f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x075f, 0x267d, 0xb9d3, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc952, 0xb152, 0x4111, 0x38f1, 0x30f0, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18cf, 0x00f7, 0x011a, 0x0119, 0x0119, 0x0119, 0x011a, 0x011a, 0x011a, 0x00f6, 0x18ce, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x28cf, 0x20cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x3110, 0x38f1, 0x38f1, 0x3911, 0x3911, 0x4111, 0x4112, 0x4132, 0x4112, 0x4932, 0x4932, 0x4933, 0x4933, 0x69b4, 0x6336, 0x6cd9, 0x4e5b, 0x07df, 0x8539, 0xd395, 0xd395, 0xbc17, 0x3e9c, 0x07df, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07ff, 0x07df, 0x07df, 0x07df, 0x07bf, 0x07df, 0x06bd, 0x069c, 0x069c, 0x067c, 0x065c, 0x065c, 0x063c, 0x061c, 0x05fc, 0x05dc, 0x05bc, 0x05bd, 0x059d, 0x057d, 0x055d, 0x053e, 0x051e, 0x04fe, 0x04de, 0x04be, 0x04bf, 0x049f, 0x047f, 0x047f, 0x047f, 0x045f, 0x045f, 0x045f, 0x047f, 0x047f, 0x047f, 0x047f, 0x047f, 0x047f, 0x047f, 0x047f, 0x047f, 0x047f, 0x049f, 0x047f, 0x045f, 0x041f, 0x03df, 0x037f, 0x031f, 0x029f, 0x021f, 0x017f, 0x011f, 0x00bf, 0x005f, 0x001f, 0x001f, 0x00ff, 0x89b7, 0xc9b3, 0x447b, 0x065f, 0x06bf, 0x071f, 0x073f, 0x073f, 0x075f, 0x3d9b, 0xc972, 0xc972, 0xc972, 0xc972, 0xc952, 0xc952, 0xc952, 0xa132, 0x3911, 0x3911, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x20ae, 0x20cd, 0x18ad, 0x18d0, 0x00f9, 0x0119, 0x0119, 0x0119, 0x00fa, 0x0119, 0x0119, 0x011a, 0x08f4, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x3110, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x3931, 0x40f1, 0x4111, 0x4132, 0x4132, 0x4132, 0x61b3, 0x9274, 0xb2f5, 0xc355, 0xd395, 0xd395, 0xd395, 0xbc16, 0x469d, 0x8539, 0xd376, 0xd375, 0x6dba, 0x0f9f, 0x07df, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07df, 0x07df, 0x07df, 0x077f, 0x06bc, 0x06bb, 0x069b, 0x067b, 0x065b, 0x063b, 0x063b, 0x061b, 0x05fb, 0x05db, 0x05bb, 0x059c, 0x059c, 0x057c, 0x055c, 0x053d, 0x051d, 0x04fd, 0x04dd, 0x04be, 0x049e, 0x047f, 0x047f, 0x045f, 0x043f, 0x043f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x043f, 0x043f, 0x043f, 0x043f, 0x043f, 0x043f, 0x043f, 0x043f, 0x043f, 0x041f, 0x03ff, 0x03bf, 0x037f, 0x033f, 0x02bf, 0x023f, 0x01df, 0x015f, 0x00df, 0x009f, 0x005f, 0x001f, 0x005f, 0x097f, 0xb9b3, 0xb214, 0x0dbf, 0x06ff, 0x075f, 0x073f, 0x073f, 0x075f, 0x077f, 0x6479, 0xc972, 0xc972, 0xc952, 0xc952, 0xc952, 0xc952, 0xc932, 0x9132, 0x3911, 0x3111, 0x30f0, 0x28f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x18ad, 0x18d0, 0x00f9, 0x0119, 0x00f9, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x08f4, 0x20cd, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x30ef, 0x30f0, 0x28f0, 0x30f0, 0x3110, 0x38f0, 0x38f1, 0x3911, 0x3911, 0x3912, 0x4111, 0x4132, 0x4132, 0x5152, 0x8234, 0xc335, 0xd395, 0xd395, 0xd395, 0xd395, 0xac57, 0x7d7a, 0x469c, 0x0f9f, 0xa4b8, 0xd395, 0x8539, 0x1f5e, 0x07df, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07ff, 0x07df, 0x075d, 0x06bb, 0x06bb, 0x069a, 0x067a, 0x065a, 0x065a, 0x063a, 0x061a, 0x05fa, 0x05da, 0x05db, 0x05bb, 0x059b, 0x057b, 0x055b, 0x053c, 0x053c, 0x051c, 0x04fc, 0x04dd, 0x04bd, 0x047e, 0x047e, 0x045e, 0x043f, 0x041f, 0x03ff, 0x03ff, 0x03df, 0x03df, 0x03df, 0x03df, 0x03df, 0x03df, 0x03df, 0x03df, 0x03df, 0x03df, 0x03df, 0x03df, 0x03df, 0x03df, 0x03bf, 0x035f, 0x031f, 0x02df, 0x027f, 0x01ff, 0x019f, 0x011f, 0x00bf, 0x007f, 0x003f, 0x001f, 0x009f, 0x39db, 0xc992, 0x6399, 0x069f, 0x079f, 0x07ff, 0x07df, 0x07bf, 0x077f, 0x079f, 0x9af6, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc932, 0x7112, 0x3110, 0x30f0, 0x30ef, 0x28f0, 0x28ef, 0x28ce, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20cd, 0x20ce, 0x20ae, 0x18cf, 0x00f9, 0x0119, 0x0119, 0x0119, 0x011a, 0x011a, 0x011a, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x08f3, 0x08d3, 0x10d2, 0x20ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x3911, 0x4112, 0x4132, 0x4132, 0x5193, 0x9274, 0xcb75, 0xd395, 0xd395, 0xd395, 0xc3d6, 0x6dba, 0x1f7e, 0x07ff, 0x07ff, 0x36dd, 0xbc17, 0x8539, 0x1f5e, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07df, 0x071b, 0x06da, 0x06ba, 0x06ba, 0x0699, 0x0679, 0x0659, 0x0639, 0x0619, 0x0619, 0x05f9, 0x05da, 0x05ba, 0x059a, 0x057a, 0x055a, 0x055b, 0x053b, 0x051b, 0x04fc, 0x04dc, 0x04bc, 0x049d, 0x047d, 0x045d, 0x043e, 0x041e, 0x03fe, 0x03df, 0x03df, 0x03bf, 0x03bf, 0x039f, 0x039f, 0x039f, 0x039f, 0x039f, 0x039f, 0x039f, 0x039f, 0x039f, 0x039f, 0x039f, 0x037f, 0x035f, 0x031f, 0x02df, 0x027f, 0x023f, 0x01bf, 0x015f, 0x00ff, 0x009f, 0x005f, 0x001f, 0x003f, 0x011f, 0x99b6, 0xb9d3, 0x0d9f, 0x06df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x0f7e, 0xb9b3, 0xc952, 0xc952, 0xc952, 0xc952, 0xc931, 0xc932, 0xc132, 0x6111, 0x38f0, 0x30f0, 0x28f0, 0x30ef, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x18ce, 0x08f5, 0x011a, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x00f9, 0x0119, 0x011a, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x3110, 0x3910, 0x3911, 0x3911, 0x3912, 0x4132, 0x4132, 0x6173, 0xa2b4, 0xd395, 0xd375, 0xd395, 0xd395, 0xc3d6, 0x6dba, 0x0fbf, 0x07ff, 0x07df, 0x07ff, 0x07df, 0x1f7e, 0x07df, 0x07ff, 0x07ff, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x06f9, 0x06f9, 0x06d9, 0x06b8, 0x0698, 0x0698, 0x0678, 0x0658, 0x0638, 0x0638, 0x0618, 0x05f8, 0x05d8, 0x05b8, 0x0598, 0x0579, 0x0559, 0x0559, 0x051a, 0x04fa, 0x04db, 0x04bb, 0x049c, 0x047c, 0x045d, 0x043d, 0x041e, 0x03fe, 0x03de, 0x03bf, 0x039f, 0x039f, 0x037f, 0x037f, 0x037f, 0x035f, 0x035f, 0x035f, 0x035f, 0x035f, 0x035f, 0x035f, 0x033f, 0x033f, 0x031f, 0x02ff, 0x02bf, 0x027f, 0x023f, 0x01ff, 0x019f, 0x013f, 0x00bf, 0x007f, 0x003f, 0x001f, 0x005f, 0x197e, 0xb993, 0x6379, 0x063f, 0x073f, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x3dfb, 0xc952, 0xc952, 0xc932, 0xc932, 0xc932, 0xc932, 0xc912, 0xb912, 0x4111, 0x30f0, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x08f6, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x08f5, 0x20ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18cd, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ae, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x0117, 0x00f7, 0x0119, 0x0119, 0x08f4, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28ef, 0x28cf, 0x28ef, 0x30ef, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x3911, 0x4111, 0x4952, 0x79f3, 0xb2f4, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0x94f9, 0x0fbf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x079d, 0x0719, 0x06f8, 0x06f8, 0x06d7, 0x06b7, 0x06b7, 0x0697, 0x0676, 0x0656, 0x0637, 0x0636, 0x0617, 0x05f7, 0x05d7, 0x05b7, 0x0597, 0x0578, 0x0578, 0x0538, 0x0519, 0x04f9, 0x04da, 0x04bb, 0x049b, 0x047c, 0x043c, 0x041d, 0x041d, 0x03fe, 0x03de, 0x03be, 0x039e, 0x037f, 0x035f, 0x035f, 0x033f, 0x031f, 0x031f, 0x031f, 0x031f, 0x02ff, 0x02ff, 0x02ff, 0x02ff, 0x02df, 0x02bf, 0x029f, 0x027f, 0x023f, 0x01ff, 0x019f, 0x015f, 0x00ff, 0x009f, 0x005f, 0x003f, 0x001f, 0x00bf, 0x59ba, 0xb9b3, 0x0d3f, 0x06bf, 0x079f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x7438, 0xc952, 0xc132, 0xc932, 0xc932, 0xc932, 0xc911, 0xc912, 0xa111, 0x3911, 0x30f0, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x08f5, 0x011a, 0x0119, 0x00fa, 0x0119, 0x0119, 0x08f5, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0119, 0x011a, 0x08f3, 0x18ad, 0x18ad, 0x10d3, 0x011a, 0x00f9, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x3911, 0x3911, 0x5151, 0x79f3, 0xa2b4, 0xcb75, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xc3d6, 0x469c, 0x07ff, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0xc335, 0x45d7, 0x0738, 0x0717, 0x06f6, 0x06f6, 0x06d6, 0x06b5, 0x06b5, 0x0695, 0x0675, 0x0655, 0x0635, 0x0615, 0x05f5, 0x05f5, 0x05d6, 0x05b6, 0x0597, 0x0557, 0x0538, 0x0518, 0x04f9, 0x04d9, 0x049a, 0x047b, 0x045b, 0x043c, 0x041c, 0x03dd, 0x03dd, 0x03be, 0x039e, 0x037e, 0x035f, 0x033f, 0x033f, 0x031f, 0x02ff, 0x02df, 0x02df, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x027f, 0x025f, 0x021f, 0x01ff, 0x01bf, 0x017f, 0x011f, 0x00df, 0x009f, 0x003f, 0x001f, 0x003f, 0x013f, 0xb174, 0x6339, 0x05ff, 0x071f, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x0f9f, 0xb992, 0xc932, 0xc932, 0xc931, 0xc912, 0xc912, 0xc912, 0xc911, 0x8111, 0x30f0, 0x30f0, 0x28ef, 0x30ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20d0, 0x0119, 0x0119, 0x0119, 0x0139, 0x08f5, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x10cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18af, 0x00f9, 0x0119, 0x18d0, 0x18cd, 0x18ad, 0x10d1, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x28cf, 0x28ef, 0x28ef, 0x28ef, 0x30f0, 0x30f0, 0x59b2, 0x7a13, 0x9a94, 0xbb55, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xac77, 0x2f1e, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07bc, 0x0759, 0xabb5, 0xc314, 0x1e97, 0x0736, 0x0716, 0x0715, 0x06f4, 0x06f4, 0x06f3, 0x06d3, 0x06b3, 0x06b2, 0x0692, 0x0672, 0x0653, 0x0633, 0x0613, 0x05f4, 0x05d4, 0x0595, 0x0575, 0x0556, 0x0517, 0x04f8, 0x04b9, 0x0499, 0x045a, 0x043b, 0x041b, 0x03fc, 0x03dd, 0x03bd, 0x039d, 0x037e, 0x035e, 0x033e, 0x033f, 0x031f, 0x02ff, 0x02df, 0x02bf, 0x02bf, 0x029f, 0x027f, 0x027f, 0x025f, 0x025f, 0x023f, 0x021f, 0x021f, 0x01df, 0x019f, 0x017f, 0x013f, 0x00ff, 0x009f, 0x007f, 0x003f, 0x001f, 0x007f, 0x399b, 0xb993, 0x055f, 0x067f, 0x079f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x45db, 0xc132, 0xc932, 0xc912, 0xc132, 0xc912, 0xc912, 0xc911, 0xc912, 0x5111, 0x38f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x18ce, 0x10d3, 0x10f4, 0x18d0, 0x18ad, 0x18ae, 0x20cd, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x00f9, 0x10d0, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x08d4, 0x18ad, 0x18ad, 0x08f3, 0x0119, 0x0119, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ad, 0x18ad, 0x20cd, 0x20ae, 0x20ad, 0x20ae, 0x18ce, 0x20ae, 0x20ce, 0x20ce, 0x28ae, 0x20ce, 0x28ee, 0x5171, 0x69d2, 0x8232, 0xaaf4, 0xc334, 0xd375, 0xd3b5, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0x757a, 0x0fbf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07bd, 0x079b, 0x077a, 0x0779, 0x74d6, 0xd2d4, 0x9bf5, 0x0756, 0x0735, 0x0734, 0x0734, 0x0733, 0x0712, 0x0711, 0x0711, 0x06f0, 0x06f0, 0x06d0, 0x06af, 0x06af, 0x066f, 0x0650, 0x0631, 0x0611, 0x05d2, 0x0594, 0x0554, 0x0515, 0x04f7, 0x04b8, 0x0478, 0x0459, 0x043a, 0x03fb, 0x03bc, 0x03bc, 0x039d, 0x037d, 0x035e, 0x033e, 0x031f, 0x031f, 0x02ff, 0x02df, 0x02bf, 0x02bf, 0x027f, 0x027f, 0x025f, 0x023f, 0x023f, 0x021f, 0x01ff, 0x01df, 0x01bf, 0x019f, 0x017f, 0x013f, 0x011f, 0x00bf, 0x007f, 0x005f, 0x001f, 0x001f, 0x00df, 0xa175, 0x33bc, 0x05df, 0x06ff, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x92d5, 0xc911, 0xc132, 0xc912, 0xc912, 0xc8f2, 0xc112, 0xc912, 0xa8f1, 0x3110, 0x30f0, 0x30ef, 0x28ef, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x0119, 0x0119, 0x10cf, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x08f5, 0x0119, 0x0119, 0x00f7, 0x00f7, 0x011a, 0x011a, 0x08f5, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ad, 0x390f, 0x4970, 0x59b0, 0x7a32, 0x9293, 0xaad3, 0xcb55, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0x9cb8, 0x271d, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07de, 0x07dd, 0x07bc, 0x079b, 0x079a, 0x079a, 0x0779, 0x55b7, 0xd2b4, 0xd2b4, 0x4db5, 0x0775, 0x0774, 0x0753, 0x0773, 0x0752, 0x0750, 0x0750, 0x074f, 0x074e, 0x074d, 0x074d, 0x074c, 0x072b, 0x072b, 0x072a, 0x070a, 0x06ea, 0x06ac, 0x064d, 0x05d0, 0x0573, 0x04f5, 0x04b6, 0x0478, 0x0438, 0x041a, 0x03fb, 0x03bc, 0x039c, 0x037c, 0x033d, 0x033d, 0x031e, 0x02fe, 0x02ff, 0x02df, 0x02bf, 0x029f, 0x029f, 0x027f, 0x025f, 0x023f, 0x021f, 0x01ff, 0x01df, 0x01bf, 0x019f, 0x017f, 0x015f, 0x013f, 0x011f, 0x00df, 0x009f, 0x005f, 0x003f, 0x001f, 0x003f, 0x213d, 0x1b1e, 0x051f, 0x065f, 0x077f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x1f3d, 0xc912, 0xc912, 0xc112, 0xc112, 0xc8f1, 0xc8f2, 0xc8f1, 0xc8f2, 0x80f1, 0x30f0, 0x30f0, 0x30ef, 0x28ef, 0x28cf, 0x28ce, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x00f7, 0x00f9, 0x0119, 0x10d0, 0x18ad, 0x18ad, 0x18cd, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x10d0, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x392f, 0xd395, 0xc374, 0xa2d3, 0xaad3, 0x7a31, 0x7a31, 0x7a11, 0x7231, 0x5190, 0x496f, 0x496f, 0x4970, 0x496f, 0x494f, 0x412f, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x4970, 0x494f, 0x496f, 0x496f, 0x69f1, 0x7a31, 0x7a31, 0x9272, 0xa2d3, 0xaaf3, 0xc355, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd375, 0xd395, 0xac57, 0x565c, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07de, 0x07bd, 0x07bc, 0x07bc, 0x07bb, 0x079a, 0x079a, 0x0799, 0x26b8, 0xcad4, 0xd2b4, 0xc314, 0x0f35, 0x0794, 0x0794, 0x0792, 0x0792, 0x0791, 0x0790, 0x078f, 0x078e, 0x078e, 0x078d, 0x078c, 0x07aa, 0x07a9, 0x07a9, 0x07a8, 0x07c7, 0x07c5, 0x07c4, 0x07e4, 0x07a4, 0x0727, 0x068a, 0x05af, 0x0496, 0x0438, 0x03f9, 0x03ba, 0x039b, 0x035c, 0x035d, 0x031d, 0x031d, 0x02fe, 0x02df, 0x02bf, 0x02bf, 0x029f, 0x027f, 0x025f, 0x025f, 0x023f, 0x021f, 0x01ff, 0x01df, 0x019f, 0x019f, 0x017f, 0x015f, 0x013f, 0x00ff, 0x00df, 0x00bf, 0x007f, 0x005f, 0x001f, 0x001f, 0x007f, 0x023f, 0x041f, 0x05bf, 0x06ff, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x6498, 0xc911, 0xc912, 0xc8f1, 0xc8f1, 0xc8f1, 0xc8f2, 0xc8f1, 0xc8d1, 0x50f1, 0x30f0, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ae, 0x00f7, 0x0119, 0x00f9, 0x10cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x10d0, 0x0119, 0x0119, 0x0117, 0x10d2, 0x08f3, 0x10d3, 0x10d2, 0x18cd, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x496f, 0xaad3, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xc3d6, 0x8539, 0x36dd, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07de, 0x07bd, 0x07bd, 0x07bc, 0x07bc, 0x07bb, 0x07ba, 0x07ba, 0x07b9, 0xd2b4, 0xd2b4, 0xd2b4, 0x6535, 0x07b5, 0x07b5, 0x07b4, 0x07b3, 0x07b2, 0x07b1, 0x07b0, 0x07af, 0x07ce, 0x07cd, 0x07cc, 0x07cb, 0x07ca, 0x07ca, 0x07c9, 0x07e8, 0x07e7, 0x07e6, 0x07e5, 0x07e5, 0x07e3, 0x07e3, 0x07e2, 0x07e1, 0x0726, 0x060c, 0x04b4, 0x03b9, 0x037b, 0x035c, 0x033d, 0x031d, 0x02de, 0x02df, 0x02be, 0x029f, 0x029f, 0x027f, 0x025f, 0x023f, 0x023f, 0x021f, 0x01ff, 0x01df, 0x019f, 0x019f, 0x015f, 0x015f, 0x013f, 0x00ff, 0x00df, 0x00bf, 0x007f, 0x007f, 0x003f, 0x001f, 0x001f, 0x011f, 0x02ff, 0x04df, 0x063f, 0x077f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x0f9f, 0xb972, 0xc8f2, 0xc8f2, 0xc0f1, 0xc8f2, 0xc0f2, 0xc0f1, 0xc8d1, 0xa0f1, 0x30f0, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28ce, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ae, 0x0117, 0x0119, 0x00f9, 0x18b0, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x10d0, 0x00f9, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x412f, 0x8a72, 0xc334, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd375, 0xac57, 0x469c, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x467c, 0x8519, 0x8519, 0x36dd, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07de, 0x07de, 0x07de, 0x07dd, 0x07dc, 0x07dc, 0x07db, 0x07db, 0x07da, 0x07da, 0x9bf5, 0xd2b4, 0xd2b4, 0xc2f4, 0x0f77, 0x07d6, 0x07d5, 0x07d4, 0x07d4, 0x07d3, 0x07d2, 0x07d1, 0x07d0, 0x07ef, 0x07ee, 0x07ed, 0x07ec, 0x07ec, 0x07ea, 0x07e9, 0x07e9, 0x07e7, 0x07e6, 0x07e6, 0x07e5, 0x07e5, 0x07e4, 0x07e4, 0x07e3, 0x07e3, 0x07e2, 0x0785, 0x060c, 0x04d3, 0x035b, 0x031c, 0x02de, 0x02de, 0x02be, 0x029f, 0x027f, 0x025f, 0x025f, 0x023f, 0x021f, 0x01ff, 0x01df, 0x01bf, 0x019f, 0x019f, 0x017f, 0x015f, 0x013f, 0x011f, 0x00df, 0x00bf, 0x009f, 0x007f, 0x005f, 0x001f, 0x001f, 0x003f, 0x01df, 0x03bf, 0x059f, 0x06df, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x4d7a, 0xc111, 0xc0f1, 0xc8f1, 0xc8f2, 0xc8d1, 0xc8f2, 0xc0d1, 0xc8d1, 0x68f1, 0x30f0, 0x30f0, 0x28f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x08f3, 0x08f3, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18cd, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x00f8, 0x18d0, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18d0, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x414f, 0x61d1, 0x8251, 0xa2d3, 0xbb34, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xbc16, 0x8539, 0x469c, 0x17bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x8518, 0xd355, 0xd355, 0xd335, 0xd335, 0x84f8, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x07de, 0x07fe, 0x07dd, 0x07dd, 0x07bc, 0x07dc, 0x07db, 0x07db, 0x07da, 0x8c56, 0xcab4, 0xcab4, 0xd294, 0x4df7, 0x07d7, 0x07d7, 0x07d6, 0x07f5, 0x07d5, 0x07f3, 0x07f3, 0x07f2, 0x07f1, 0x07f0, 0x07ef, 0x07ee, 0x07ed, 0x07ec, 0x07eb, 0x07eb, 0x07ea, 0x07e9, 0x07e8, 0x07e8, 0x07e7, 0x07e7, 0x07e6, 0x07e6, 0x07e5, 0x07e5, 0x07e5, 0x07e5, 0x07e4, 0x07a6, 0x060e, 0x03f8, 0x02de, 0x02be, 0x029f, 0x027f, 0x025f, 0x023f, 0x023f, 0x021f, 0x01ff, 0x01df, 0x01bf, 0x019f, 0x019f, 0x017f, 0x015f, 0x013f, 0x011f, 0x00df, 0x00bf, 0x009f, 0x007f, 0x005f, 0x003f, 0x001f, 0x001f, 0x00bf, 0x029f, 0x049f, 0x063f, 0x075f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xb1d3, 0xc8f1, 0xc8f2, 0xc0f1, 0xc8d1, 0xc8d1, 0xc0f1, 0xc8d1, 0xb8d1, 0x40f0, 0x30f0, 0x28f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20cf, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0139, 0x00f8, 0x18b0, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x10d0, 0x00f9, 0x0119, 0x00f7, 0x18af, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x310e, 0x496f, 0x5990, 0x7a12, 0x7a32, 0x9272, 0xa2d3, 0xa2d3, 0xc375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xac77, 0x757a, 0x36fd, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x4e3c, 0xd355, 0xd335, 0xd355, 0xd335, 0xd335, 0xd334, 0x7539, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x07fe, 0x07dd, 0x07dd, 0x07dd, 0x07dc, 0x07fc, 0x07dc, 0x07db, 0x6d38, 0xcab4, 0xd294, 0xd294, 0xab95, 0x07d8, 0x07d8, 0x07f7, 0x07f7, 0x07f6, 0x07f5, 0x07f5, 0x07f4, 0x07f3, 0x07f2, 0x07f1, 0x07f0, 0x07ef, 0x07ee, 0x07ed, 0x07ed, 0x07ec, 0x07ec, 0x07eb, 0x07ea, 0x07ea, 0x07ea, 0x07e9, 0x07e9, 0x07e8, 0x07e8, 0x07e8, 0x07e8, 0x07e7, 0x07e7, 0x07e8, 0x07c8, 0x06eb, 0x0514, 0x033c, 0x027f, 0x025f, 0x023f, 0x021f, 0x01ff, 0x01df, 0x01bf, 0x019f, 0x019f, 0x017f, 0x015f, 0x013f, 0x011f, 0x00ff, 0x00df, 0x00bf, 0x009f, 0x009f, 0x005f, 0x005f, 0x003f, 0x001f, 0x001f, 0x015f, 0x037f, 0x057f, 0x06df, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x4d5a, 0xc8f1, 0xc8d1, 0xc0f1, 0xc8d1, 0xc8d1, 0xc0d1, 0xc0d1, 0xc8b1, 0x78d1, 0x3110, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x0117, 0x0117, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x00f9, 0x10cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18af, 0x0118, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x496f, 0x496f, 0x4970, 0x7a12, 0x7a31, 0x8252, 0xaad3, 0xa2d3, 0xbb34, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xcbd6, 0x94f8, 0x565b, 0x0fbf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xb3f6, 0xd335, 0xd335, 0xd334, 0xd335, 0xd335, 0xd335, 0xd334, 0x1f7e, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x07de, 0x07dd, 0x07fd, 0x07fd, 0x07fd, 0x07dd, 0x07dc, 0x6d38, 0xcab4, 0xd294, 0xca94, 0xd294, 0x1f39, 0x07f9, 0x07f8, 0x07f8, 0x07f8, 0x07f7, 0x07f7, 0x07f6, 0x07f5, 0x07f4, 0x07f3, 0x07f2, 0x07f2, 0x07f1, 0x07f0, 0x07ef, 0x07ef, 0x07ee, 0x07ee, 0x07ed, 0x07ed, 0x07ec, 0x07ed, 0x07ec, 0x07eb, 0x07ec, 0x07eb, 0x07eb, 0x07ea, 0x07ea, 0x07ea, 0x07ca, 0x07ab, 0x076c, 0x070d, 0x05b2, 0x039b, 0x023f, 0x021f, 0x01ff, 0x01df, 0x01bf, 0x019f, 0x017f, 0x017f, 0x015f, 0x013f, 0x011f, 0x00ff, 0x00df, 0x00df, 0x009f, 0x009f, 0x007f, 0x005f, 0x003f, 0x003f, 0x001f, 0x60d9, 0x0a3f, 0x047f, 0x063f, 0x075f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xa9d3, 0xc0d1, 0xc8d1, 0xc0f1, 0xc8b1, 0xc0d1, 0xc8b1, 0xc0b1, 0xb8b1, 0x48f1, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x08f3, 0x18ad, 0x18ad, 0x08f3, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x10d0, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x00f9, 0x10d0, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18d0, 0x00f9, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x20ad, 0x18cd, 0x20ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x4970, 0x4970, 0x5990, 0x7a31, 0x7231, 0x7a31, 0x7a31, 0x9ab3, 0xaad4, 0xa2d4, 0xb314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0x94f8, 0x565c, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xd335, 0xd334, 0xd335, 0xd335, 0xd335, 0xd335, 0xd314, 0xd315, 0x5ddb, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fd, 0x07fd, 0x6d58, 0xd294, 0xd293, 0xca94, 0xd274, 0x4df8, 0x07fb, 0x07fa, 0x07fa, 0x07f9, 0x07f9, 0x07f8, 0x07f7, 0x07f6, 0x07f6, 0x07f5, 0x07f5, 0x07f4, 0x07f3, 0x07f3, 0x07f2, 0x07f1, 0x07f1, 0x07f0, 0x07f0, 0x07f0, 0x07ef, 0x07ef, 0x07ef, 0x07ef, 0x07ef, 0x07ee, 0x07ee, 0x07ee, 0x07ee, 0x07ee, 0x07ed, 0x07cd, 0x078e, 0x076e, 0x0710, 0x06b1, 0x0574, 0x037b, 0x01ff, 0x01df, 0x01bf, 0x019f, 0x017f, 0x017f, 0x013f, 0x013f, 0x011f, 0x00ff, 0x00df, 0x00bf, 0x009f, 0x009f, 0x007f, 0x005f, 0x003f, 0x003f, 0x001f, 0x88d6, 0x6159, 0x031f, 0x053f, 0x06df, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x4d5b, 0xc0d1, 0xc8d1, 0xc8d1, 0xc0b1, 0xc8b1, 0xc8b2, 0xc0b1, 0xc8b1, 0x90d1, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28cf, 0x20cf, 0x20cf, 0x20ce, 0x20ae, 0x20ce, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x0119, 0x011a, 0x10d1, 0x18ad, 0x18ad, 0x10d1, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119,
-  0x00f8, 0x10d0, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x0117, 0x0119, 0x0119, 0x10cf, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18b0, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x10d2, 0x08f3, 0x08f3, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ae, 0x18ad, 0x18ce, 0x18ad, 0x20ae, 0x20ad, 0x20ce, 0x20ce, 0x290f, 0x5170, 0x5170, 0x69f1, 0x7a32, 0x8232, 0xaaf3, 0xaaf4, 0xcb75, 0xd395, 0xd396, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xc3b6, 0x8539, 0x1f7f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xd335, 0xd335, 0xd335, 0xd315, 0xd314, 0xd315, 0xd314, 0xd314, 0x659a, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x6d39, 0xd294, 0xca94, 0xd274, 0xca74, 0x7c96, 0x07fc, 0x07fc, 0x07fb, 0x07fb, 0x07fa, 0x07fa, 0x07f9, 0x07f8, 0x07f8, 0x07f7, 0x07f7, 0x07f6, 0x07f6, 0x07f5, 0x07f4, 0x07f4, 0x07f3, 0x07f3, 0x07f3, 0x07f2, 0x07f2, 0x07f2, 0x07f2, 0x07f2, 0x07f2, 0x07f2, 0x07f1, 0x07f1, 0x07f1, 0x07f1, 0x07f0, 0x07f1, 0x07d0, 0x0791, 0x0751, 0x0712, 0x0693, 0x0634, 0x0517, 0x02dd, 0x01bf, 0x019f, 0x017f, 0x015f, 0x015f, 0x013f, 0x011f, 0x00ff, 0x00df, 0x00bf, 0x00bf, 0x007f, 0x005f, 0x005f, 0x003f, 0x003f, 0x001f, 0x60b8, 0xb8f3, 0x09bf, 0x041f, 0x061f, 0x073f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xb1b3, 0xc0d1, 0xc0d1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0x48f1, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x0119, 0x0119, 0x08f3, 0x18ad, 0x18ad, 0x08f3, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119,
-  0x011a, 0x0118, 0x10d0, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x00f9, 0x0119, 0x10d0, 0x18ad, 0x18ad, 0x18cd, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18af, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x20ae, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18cd, 0x18ae, 0x00f7, 0x011a, 0x011a, 0x011a, 0x0119, 0x0117, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x28ce, 0x28cf, 0x28ef, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x5172, 0x61b2, 0x8a54, 0x9a94, 0xb335, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0x9c97, 0x36dd, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xac17, 0xd335, 0xd314, 0xd335, 0xd314, 0xd315, 0xd315, 0xd2f4, 0x467c, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x6d59, 0xd274, 0xca94, 0xd274, 0xca74, 0xb334, 0x07fe, 0x07fd, 0x07fd, 0x07fd, 0x07fc, 0x07fc, 0x07fb, 0x07fa, 0x07fa, 0x07fa, 0x07f9, 0x07f8, 0x07f8, 0x07f8, 0x07f7, 0x07f6, 0x07f6, 0x07f6, 0x07f5, 0x07f5, 0x07f5, 0x07f5, 0x07f5, 0x07f5, 0x07f5, 0x07f5, 0x07f5, 0x07f5, 0x07f5, 0x07f4, 0x07f4, 0x07f4, 0x07d3, 0x07b3, 0x0793, 0x0753, 0x0714, 0x06b5, 0x5516, 0x0538, 0x037c, 0x01ff, 0x017f, 0x015f, 0x013f, 0x011f, 0x011f, 0x00ff, 0x00df, 0x00bf, 0x009f, 0x009f, 0x007f, 0x005f, 0x005f, 0x003f, 0x001f, 0x6099, 0xc911, 0x491a, 0x02df, 0x051f, 0x06bf, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x6459, 0xc8b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x90d1, 0x30f1, 0x30f0, 0x30ef, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x011a, 0x0119, 0x00f7, 0x00f7, 0x0119, 0x011a, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x00f7, 0x011a, 0x00f8, 0x10d0, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x00f9, 0x10cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18b0, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x08f5, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x011a, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x20ad, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x3111, 0x3911, 0x3911, 0x4132, 0x4132, 0x5152, 0x69d3, 0x9274, 0xb2f5, 0xd395, 0xd395, 0xd375, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xa478, 0x36dd, 0x07ff, 0x07ff, 0x563c, 0xd335, 0xd334, 0xd315, 0xd315, 0xd2f4, 0xcb15, 0xbb96, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x8498, 0xca94, 0xca94, 0xd274, 0xca74, 0xca74, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fd, 0x07fd, 0x07fc, 0x07fc, 0x07fc, 0x07fb, 0x07fb, 0x07fa, 0x07fa, 0x07f9, 0x07f9, 0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f7, 0x07f7, 0x07f7, 0x07f7, 0x07f7, 0x07f7, 0x07f7, 0x07f7, 0x07f7, 0x07f7, 0x07f7, 0x07f7, 0x07f6, 0x07f6, 0x07d6, 0x07b6, 0x0796, 0x0756, 0x0716, 0xa456, 0xbbd6, 0x3479, 0x02fd, 0x023f, 0x019f, 0x015f, 0x011f, 0x00ff, 0x00ff, 0x00bf, 0x00bf, 0x009f, 0x009f, 0x007f, 0x005f, 0x003f, 0x003f, 0x003f, 0x78b7, 0xc111, 0xa114, 0x01ff, 0x041f, 0x05ff, 0x075f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x0f9f, 0xc0b1, 0xc0d2, 0xc8b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x48f1, 0x30f0, 0x30ef, 0x28f0, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ce, 0x08f7, 0x0119, 0x00f8, 0x10cf, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x0117, 0x0119, 0x00f9, 0x18b0, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18af, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ae, 0x20cd, 0x20cd, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x28ce, 0x28cf, 0x28cf, 0x28cf, 0x28f0, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x4132, 0x4132, 0x4932, 0x4933, 0x4953, 0x5154, 0x5154, 0x71f4, 0x9a75, 0xb2f5, 0xd375, 0xd375, 0xd375, 0xd355, 0xd375, 0xd355, 0xd375, 0xd355, 0xd355, 0xd335, 0xd335, 0x9c78, 0x36dd, 0x07ff, 0x9c57, 0xd335, 0xd315, 0xd334, 0xd314, 0xc355, 0x271d, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x9bf7, 0xca94, 0xd274, 0xca73, 0xca74, 0xd253, 0x2efd, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x07fe, 0x07fd, 0x07fd, 0x07fd, 0x07fc, 0x07fc, 0x07fb, 0x07fb, 0x07fb, 0x07fa, 0x07fa, 0x07fa, 0x07f9, 0x07f9, 0x07f9, 0x07f9, 0x07f9, 0x07f9, 0x07fa, 0x07fa, 0x07fa, 0x07fa, 0x07fa, 0x07fa, 0x07f9, 0x07f9, 0x07f9, 0x07f8, 0x07d8, 0x07b8, 0x0797, 0x0758, 0x0ef8, 0xbbf6, 0xd395, 0x6b99, 0x025f, 0x021f, 0x01bf, 0x013f, 0x011f, 0x00ff, 0x00df, 0x00bf, 0x009f, 0x009f, 0x007f, 0x005f, 0x005f, 0x003f, 0x001f, 0x98d5, 0xc8f2, 0xc911, 0x195e, 0x033f, 0x053f, 0x06bf, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x7b76, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0x88d1, 0x30f1, 0x30f0, 0x28f0, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x08f3, 0x08f3, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ae, 0x18ae, 0x00f7, 0x011a, 0x00f9, 0x18cf, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x00f8, 0x18d0, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18b0, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x00f9, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x011a, 0x00fa, 0x011a, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x20ae, 0x20ae, 0x18ad, 0x20ae, 0x20ae, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20cf, 0x28ce, 0x28cf, 0x28cf, 0x28ef, 0x30ef, 0x30f0, 0x30f0, 0x3111, 0x3910, 0x3911, 0x4111, 0x4912, 0x4133, 0x4932, 0x4933, 0x5154, 0x5154, 0x5955, 0x5955, 0x5975, 0x6996, 0x8a16, 0xaad5, 0xcb55, 0xd375, 0xd355, 0xd354, 0xd355, 0xd335, 0xd335, 0xd335, 0xd335, 0xcb35, 0x84f9, 0x0fbf, 0x5ddb, 0xa457, 0x9c58, 0x84d8, 0x1f5e, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x9bd6, 0xca74, 0xca74, 0xca74, 0xca74, 0xca74, 0x369c, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x07fe, 0x07fe, 0x07fd, 0x07fd, 0x07fd, 0x07fc, 0x07fc, 0x07fc, 0x07fb, 0x07fb, 0x07fb, 0x07fb, 0x07fb, 0x07fb, 0x07fb, 0x07fb, 0x07fb, 0x07fc, 0x07fc, 0x07fc, 0x07fc, 0x07fb, 0x07fb, 0x07fb, 0x07fb, 0x07da, 0x07da, 0x07ba, 0x079a, 0x0779, 0x2e99, 0xc3d6, 0xd395, 0x8339, 0x0a3e, 0x01df, 0x019f, 0x015f, 0x011f, 0x00ff, 0x00bf, 0x009f, 0x007f, 0x007f, 0x007f, 0x003f, 0x003f, 0x003f, 0x90d5, 0xc912, 0xc0f1, 0x7117, 0x027f, 0x049f, 0x065f, 0x077f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x269d, 0xc891, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xb8b1, 0x3110, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ae, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x00f9, 0x10cf, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0139, 0x00f8, 0x18b0, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18d0, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18b0, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x011a, 0x00f9, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20cd, 0x18ce, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x28ef, 0x28cf, 0x28ef, 0x28d0, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x3931, 0x4132, 0x4132, 0x4933, 0x5133, 0x5153, 0x5154, 0x5154, 0x5975, 0x6175, 0x6195, 0x9255, 0x8b14, 0x4ad3, 0x7a94, 0xab14, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd315, 0xd314, 0xd335, 0xc355, 0x467c, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xc2d4, 0xca74, 0xca74, 0xd274, 0xca74, 0xd253, 0x369c, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fd, 0x07fd, 0x07fd, 0x07fd, 0x07fd, 0x07fc, 0x07fc, 0x07fc, 0x07fd, 0x07fd, 0x07fd, 0x07fd, 0x07fd, 0x07fd, 0x07fe, 0x07fe, 0x07fe, 0x07fd, 0x07fd, 0x07fd, 0x07fc, 0x07fc, 0x07db, 0x07bb, 0x07bb, 0x077b, 0x2eba, 0xc3d6, 0xd395, 0xb337, 0x09df, 0x01bf, 0x017f, 0x013f, 0x011f, 0x00df, 0x009f, 0x009f, 0x007f, 0x005f, 0x005f, 0x003f, 0x003f, 0x7896, 0xc0f1, 0xc8f1, 0xa8f3, 0x01df, 0x03df, 0x05bf, 0x071f, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xa214, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0x68f1, 0x30f0, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x0119, 0x00f9, 0x10cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x00f9, 0x10cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18af, 0x00f9, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18d0, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ef, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30ef, 0x30f0, 0x30f0, 0x3911, 0x3911, 0x4111, 0x4132, 0x4932, 0x4933, 0x5133, 0x5153, 0x5154, 0x5954, 0x6195, 0x9a75, 0xcb55, 0xcb75, 0x5bb4, 0x3b34, 0x42b3, 0x4a33, 0x6253, 0x9ab4, 0xd335, 0xd335, 0xd315, 0xd334, 0xd314, 0xd315, 0xd314, 0xd314, 0x5ddb, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x1f5e, 0xd274, 0xd274, 0xd274, 0xd274, 0xd274, 0xca53, 0x369d, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x07fe, 0x07fe, 0x07fd, 0x07dd, 0x07dd, 0x07bd, 0x079c, 0x561a, 0xd395, 0xd395, 0xab37, 0x099f, 0x015f, 0x013f, 0x011f, 0x00ff, 0x00bf, 0x009f, 0x007f, 0x007f, 0x005f, 0x003f, 0x003f, 0x305c, 0xc0f1, 0xc8f1, 0xc8d1, 0x215d, 0x033f, 0x051f, 0x06df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x5cd9, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x98d1, 0x38f0, 0x30f0, 0x30f0, 0x28cf, 0x28ef, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x011a, 0x00f8, 0x10d0, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ce, 0x00f7, 0x0119, 0x00f8, 0x10cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f8, 0x011a, 0x00f7, 0x18ae, 0x20ae, 0x18ad, 0x18ad, 0x18cd, 0x18b0, 0x00f9, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x0117, 0x0119, 0x0119, 0x011a, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x3911, 0x3911, 0x4111, 0x4131, 0x4132, 0x4933, 0x4933, 0x5154, 0x5974, 0x9255, 0xcb55, 0xd375, 0xbb95, 0x5474, 0x3c34, 0x3bb4, 0x4333, 0x42b3, 0x4a13, 0x49f3, 0x5a32, 0x9ab4, 0xd334, 0xd335, 0xd314, 0xd314, 0xd315, 0xd314, 0xd2f4, 0x84d8, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x4ddb, 0xd274, 0xca74, 0xca73, 0xd274, 0xca54, 0xca54, 0x369c, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x07fe, 0x07dd, 0x07de, 0x079d, 0x6d99, 0xd395, 0xd395, 0xab17, 0x097f, 0x011f, 0x011f, 0x00ff, 0x00bf, 0x00bf, 0x009f, 0x007f, 0x007f, 0x003f, 0x003f, 0x003f, 0xc8f1, 0xc8f1, 0xc8d1, 0x5119, 0x02df, 0x04ff, 0x06bf, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x1f1e, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x4910, 0x30f0, 0x30f0, 0x28ef, 0x28ef, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x10d2, 0x08f3, 0x08f3, 0x10d2, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x00f8, 0x10d0, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x00f7, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x00f7, 0x18ae, 0x20ae, 0x18ad, 0x18ad, 0x18ae, 0x10cf, 0x00f9, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ae, 0x10d2, 0x08f3, 0x08f3, 0x10d2, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x3910, 0x3911, 0x4112, 0x4132, 0x4132, 0x4933, 0x5133, 0x8214, 0xcb55, 0xd375, 0xd375, 0xb3d5, 0x3d55, 0x3515, 0x3495, 0x3c14, 0x3b94, 0x3b13, 0x4293, 0x4212, 0x49f3, 0x49f3, 0x5a13, 0x9ab4, 0xd314, 0xd315, 0xcb15, 0xd2f4, 0xd2f5, 0xd2f4, 0x7539, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x8c37, 0xca74, 0xd273, 0xd253, 0xca54, 0xca53, 0xd253, 0x1f5e, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x07df, 0x07df, 0x94d8, 0xd396, 0xd395, 0x8299, 0x00ff, 0x00ff, 0x00ff, 0x00bf, 0x00bf, 0x009f, 0x007f, 0x005f, 0x005f, 0x003f, 0x001f, 0xc8d1, 0xc0f1, 0xc0d1, 0xa0d4, 0x027f, 0x04bf, 0x069f, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x8315, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x70f1, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x08f7, 0x011a, 0x0118, 0x10d0, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ae, 0x00f7, 0x011a, 0x0119, 0x0119, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f9, 0x011a, 0x0119, 0x0117, 0x18ae, 0x20cd, 0x18ad, 0x18ae, 0x18ad, 0x18d0, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28ce, 0x28cf, 0x28cf, 0x28cf, 0x28f0, 0x30f0, 0x30f0, 0x30f0, 0x3911, 0x3911, 0x4132, 0x4132, 0x4132, 0x5973, 0xb2f4, 0xd375, 0xd375, 0xd375, 0x9435, 0x3d55, 0x2d55, 0x2d75, 0x3515, 0x3c94, 0x3414, 0x3b94, 0x4313, 0x4293, 0x4a13, 0x41f3, 0x49f2, 0x4a13, 0x5a33, 0xa2b4, 0xd314, 0xd2f4, 0xd2f4, 0xd2d4, 0xd2f4, 0x4e1b, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x179f, 0xd274, 0xca53, 0xca73, 0xca53, 0xca53, 0xca53, 0xd253, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x0f9e, 0xbc16, 0xd395, 0xd395, 0x725a, 0x00bf, 0x00bf, 0x00bf, 0x009f, 0x007f, 0x007f, 0x005f, 0x005f, 0x003f, 0x001f, 0x90b5, 0xc8d1, 0xc8d1, 0xc0d1, 0x123e, 0x047f, 0x067f, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x54d9, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0x90d1, 0x38f1, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ce, 0x00f7, 0x011a, 0x00f8, 0x10d0, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x20ae, 0x18ad, 0x18ae, 0x18ad, 0x18d0, 0x00f9, 0x00f9, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28f0, 0x30f0, 0x38f0, 0x30f0, 0x3911, 0x3911, 0x4112, 0x4132, 0x8234, 0xcb55, 0xd375, 0xd375, 0xd355, 0x9435, 0x3575, 0x3575, 0x2d75, 0x3555, 0x3555, 0x3514, 0x3474, 0x3bf4, 0x3b73, 0x42f4, 0x4273, 0x4a13, 0x4213, 0x49f2, 0x49f3, 0x49f3, 0x6a33, 0xbad4, 0xd2f5, 0xd2f4, 0xd2d4, 0xc335, 0x177e, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x5d9a, 0xca54, 0xd273, 0xca54, 0xca53, 0xca53, 0xca53, 0x9bb6, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07df, 0x07df, 0x07df, 0x07bf, 0x07bf, 0x07bf, 0x079f, 0x077f, 0x077f, 0x077e, 0x07bf, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07bf, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x36dd, 0xd395, 0xd395, 0xd395, 0x51bc, 0x009f, 0x009f, 0x007f, 0x007f, 0x007f, 0x005f, 0x005f, 0x003f, 0x001f, 0x7077, 0xc0d2, 0xc8d1, 0xc0d1, 0x49fa, 0x049f, 0x069f, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x1f1e, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0x3910, 0x30f0, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x18ce, 0x08f7, 0x0119, 0x00f8, 0x18b0, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18b0, 0x0119, 0x0119, 0x0117, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x4952, 0xaab4, 0xd375, 0xd375, 0xd375, 0xd355, 0x9435, 0x3575, 0x3575, 0x2d75, 0x2d75, 0x2d75, 0x3555, 0x54d5, 0x6475, 0x83b5, 0x8b74, 0x9b34, 0xab14, 0xaad4, 0xb2d4, 0xaad4, 0xaab4, 0xaab4, 0xb2b4, 0x6b15, 0x8a94, 0xc2d4, 0xd2f4, 0xd2d4, 0x84b8, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xb315, 0xd274, 0xca53, 0xca54, 0xca53, 0xca53, 0xd253, 0x653a, 0x07ff, 0x07ff, 0x07df, 0x07df, 0x07ff, 0x07df, 0x07df, 0x07bf, 0x07bf, 0x079f, 0x079f, 0x077f, 0x075f, 0x075f, 0x073f, 0x073f, 0x071f, 0x071e, 0x071e, 0x073e, 0x079f, 0x07df, 0x07ff, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07bf, 0x07bf, 0x07bf, 0x07bf, 0x07bf, 0x07bf, 0x07bf, 0x07bf, 0x07bf, 0x07df, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x7d7a, 0xd395, 0xd395, 0xc375, 0x28fe, 0x007f, 0x007f, 0x005f, 0x005f, 0x003f, 0x005f, 0x003f, 0x003f, 0x183e, 0xc0d1, 0xc0d1, 0xc0d2, 0x7996, 0x04bf, 0x067f, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xa214, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0x58f1, 0x30f0, 0x30f0, 0x30f0, 0x28cf, 0x28ef, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x18ad, 0x18ae, 0x18ae, 0x00f7, 0x011a, 0x00f8, 0x18d0, 0x18ad, 0x18ad, 0x20cd, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x20ad, 0x18cd, 0x20ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18d0, 0x00f9, 0x0119, 0x0117, 0x18ce, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x5972, 0xcb55, 0xd375, 0xd375, 0xd375, 0xd375, 0xabd5, 0x4515, 0x54f5, 0x7c75, 0x8c35, 0xabd5, 0xcb55, 0xd335, 0xd335, 0xd334, 0xd335, 0xd335, 0xd315, 0xd314, 0xd314, 0xc355, 0x9c37, 0x659a, 0x467c, 0x0fbf, 0x07ff, 0x07ff, 0x269d, 0x9c17, 0xd2d4, 0x9c17, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x5d9a, 0xd274, 0xca53, 0xca54, 0xca53, 0xca33, 0xca33, 0xca33, 0x26dd, 0x07ff, 0x07df, 0x07df, 0x07df, 0x07df, 0x07bf, 0x079f, 0x079f, 0x077f, 0x077f, 0x075f, 0x073f, 0x071e, 0x071e, 0x06fe, 0x06fe, 0x06ff, 0x06de, 0x06de, 0x06be, 0x06be, 0x06de, 0x073e, 0x079f, 0x07bf, 0x07bf, 0x079f, 0x079f, 0x079f, 0x077f, 0x079f, 0x079f, 0x077f, 0x079f, 0x079f, 0x079f, 0x079f, 0x07bf, 0x07bf, 0x07df, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x0fbf, 0xc3f6, 0xd395, 0xd395, 0xaaf7, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x001f, 0x001f, 0xa094, 0xc0d1, 0xc8b1, 0xa8f3, 0x04bf, 0x069f, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x73d8, 0xb8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0x78f1, 0x3911, 0x30f0, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x0119, 0x0119, 0x0119, 0x011a, 0x011a, 0x0119, 0x0119, 0x0119, 0x011a, 0x011a, 0x011a, 0x011a,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18cd, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x0118, 0x18d0, 0x18ad, 0x18ad, 0x18ad, 0x188d, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18cd, 0x10cf, 0x0119, 0x00f9, 0x0117, 0x18ce, 0x188d, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x3111, 0x71f2, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd375, 0xd355, 0xd355, 0xd335, 0xd335, 0xd355, 0xd335, 0xd335, 0xcb14, 0xd334, 0xd334, 0xac16, 0x753a, 0x467d, 0x1f5e, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x369c, 0x4e1b, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x26fd, 0xc2b4, 0xca53, 0xca53, 0xca53, 0xd253, 0xca33, 0xca33, 0xa356, 0x07ff, 0x07ff, 0x07df, 0x07bf, 0x07bf, 0x079f, 0x077f, 0x077f, 0x075f, 0x073f, 0x071f, 0x071f, 0x06ff, 0x06fe, 0x06fe, 0x06de, 0x06be, 0x06be, 0x069e, 0x069e, 0x069e, 0x067e, 0x067e, 0x065e, 0x065e, 0x06be, 0x073e, 0x075f, 0x075f, 0x075f, 0x075f, 0x075f, 0x075f, 0x075f, 0x075f, 0x077f, 0x077f, 0x077f, 0x077f, 0x079f, 0x07bf, 0x07bf, 0x07df, 0x07df, 0x07df, 0x07ff, 0x07df, 0x6dda, 0xd395, 0xd376, 0xd375, 0x79fa, 0x003f, 0x003f, 0x001f, 0x003f, 0x001f, 0x001f, 0x001f, 0x001f, 0x8896, 0xc0b1, 0xc0b1, 0xc8b1, 0x0c9f, 0x069f, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x3dbb, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xb8d1, 0xc0b1, 0xc0b1, 0x98d1, 0x3911, 0x30f0, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x20ad, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x011a, 0x0119, 0x18b0, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18b0, 0x00f9, 0x0119, 0x00f7, 0x18ce, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x9a93, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd355, 0xd355, 0xd335, 0xd335, 0xc375, 0x84f9, 0x4e3c, 0x0fbf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x0f9f, 0xab75, 0xca54, 0xd253, 0xca53, 0xca33, 0xca33, 0xd233, 0xca33, 0x4dbb, 0x07df, 0x07bf, 0x07bf, 0x079f, 0x077f, 0x075f, 0x075f, 0x073f, 0x071f, 0x071f, 0x06ff, 0x06de, 0x06de, 0x06de, 0x06be, 0x06be, 0x069e, 0x067e, 0x067e, 0x067e, 0x065e, 0x063e, 0x063e, 0x061e, 0x061e, 0x05fe, 0x05fd, 0x067d, 0x06de, 0x06fe, 0x06fe, 0x06fe, 0x06fe, 0x071e, 0x073f, 0x073f, 0x073f, 0x073e, 0x075f, 0x077f, 0x079f, 0x079f, 0x07bf, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x0fbf, 0xc3d6, 0xd375, 0xd375, 0xd355, 0x30fd, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x001f, 0x001f, 0x6058, 0xc0b1, 0xc0b1, 0xc0b1, 0x33fc, 0x06bf, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x0f9e, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xb8b1, 0xc0b1, 0xb8d1, 0xb8d1, 0x3911, 0x38f0, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ad, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x0118, 0x18d0, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18b0, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28ef, 0x28ef, 0x30f0, 0x3910, 0xaaf4, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xb3d6, 0x7539, 0x271d, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x2efd, 0xb315, 0xca53, 0xca54, 0xca33, 0xca53, 0xca34, 0xca34, 0xca33, 0xa335, 0x07bf, 0x07bf, 0x079f, 0x077f, 0x075f, 0x073f, 0x073f, 0x071f, 0x06ff, 0x06ff, 0x06df, 0x06de, 0x06bf, 0x06be, 0x069e, 0x069e, 0x069e, 0x067e, 0x065e, 0x065e, 0x063e, 0x061e, 0x061e, 0x05fe, 0x05de, 0x05bd, 0x05be, 0x059d, 0x055e, 0x055e, 0x05be, 0x05fe, 0x061d, 0x067e, 0x06be, 0x06fe, 0x06fe, 0x071f, 0x071e, 0x073f, 0x073f, 0x075f, 0x077f, 0x079f, 0x07bf, 0x07bf, 0x07df, 0x07ff, 0x07ff, 0x8539, 0xd375, 0xd355, 0xd355, 0xbaf6, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x403b, 0xc8b1, 0xc0b1, 0xc0b1, 0x6318, 0x06bf, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xa9b3, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xb8d1, 0x4910, 0x3910, 0x30f0, 0x30f0, 0x28cf, 0x28ef, 0x28cf, 0x20cf, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x20ae, 0x18ad, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10d2, 0x10d3, 0x10d3, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x0117, 0x011a, 0x0119, 0x18af, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ae, 0x18cf, 0x00f8, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x20cf, 0x28cf, 0x28cf, 0x28ef, 0x30cf, 0x3910, 0xb314, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd354, 0xd355, 0xd355, 0xcb96, 0x8518, 0x36dd, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x0fbe, 0x653a, 0xca54, 0xca53, 0xd253, 0xca53, 0xca53, 0xca33, 0xca33, 0xca33, 0xca33, 0x2e9d, 0x077f, 0x077f, 0x075f, 0x073f, 0x073f, 0x071f, 0x06ff, 0x06fe, 0x06df, 0x06de, 0x06bf, 0x06be, 0x06bf, 0x069e, 0x067e, 0x067e, 0x065e, 0x065e, 0x063e, 0x061e, 0x061e, 0x05fe, 0x05de, 0x05be, 0x05be, 0x059e, 0x057e, 0x053e, 0x051e, 0x04fe, 0x04be, 0x049e, 0x041e, 0x03dd, 0x04de, 0x065e, 0x06be, 0x06de, 0x06de, 0x06fe, 0x071f, 0x073e, 0x077f, 0x079f, 0x079f, 0x07bf, 0x07df, 0x07df, 0x07ff, 0x36dd, 0xd355, 0xd355, 0xd355, 0xd335, 0x699a, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xb8b2, 0xc091, 0xc0b1, 0x7a96, 0x06bf, 0x079f, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x82f5, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb8d1, 0x60f1, 0x3911, 0x30f0, 0x30f0, 0x28ef, 0x28ef, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x08f7, 0x0119, 0x08f7, 0x18ce, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x10d0, 0x0118, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x20ad, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28ce, 0x20cf, 0x28cf, 0x28ef, 0x3910, 0xb314, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd355, 0xbbd6, 0x5dfb, 0x0fbf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x0fbf, 0x5d9a, 0xb315, 0xd254, 0xca53, 0xd254, 0xca53, 0xca53, 0xca33, 0xd233, 0xca33, 0xca33, 0x64d9, 0x077f, 0x073f, 0x073f, 0x071f, 0x06ff, 0x06ff, 0x06df, 0x06df, 0x06df, 0x06bf, 0x06be, 0x069f, 0x069f, 0x067e, 0x065e, 0x065e, 0x063e, 0x063e, 0x061e, 0x05fe, 0x05fe, 0x05de, 0x05be, 0x059e, 0x059e, 0x055e, 0x055e, 0x051e, 0x04fe, 0x04de, 0x049e, 0x043d, 0x03de, 0x03be, 0x039e, 0x037e, 0x03fe, 0x05fe, 0x069e, 0x069e, 0x06be, 0x06fe, 0x071e, 0x073f, 0x075f, 0x079f, 0x079f, 0x07df, 0x07df, 0x07df, 0x07ff, 0xbbf6, 0xd355, 0xd335, 0xd335, 0xc2f5, 0x083f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x9095, 0xc8b1, 0xc8b1, 0x91f5, 0x067f, 0x06ff, 0x073f, 0x075f, 0x077f, 0x07bf, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x54d9, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xb8d1, 0xc0d1, 0xb8d1, 0xb8d1, 0x80f2, 0x3911, 0x30f0, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x20cd, 0x20ae, 0x18ad, 0x18ae, 0x20ae, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ce, 0x08f7, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f9, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f6, 0x18ce, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x20ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x28ce, 0x28cf, 0x28cf, 0x3110, 0xb314, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0x9c77, 0x563b, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x1f7e, 0x65db, 0x7cf9, 0x9c57, 0x9c57, 0x9c57, 0x9c57, 0x9c37, 0x9c37, 0x9c37, 0x9c37, 0x7539, 0x6d7a, 0x6579, 0x5dbb, 0x36bd, 0x36bd, 0x36bc, 0x2efd, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x0fbf, 0x36bd, 0x5d9a, 0x8c37, 0xd274, 0xd273, 0xd254, 0xca53, 0xd254, 0xd253, 0xca33, 0xd233, 0xca34, 0xca13, 0xca33, 0x8418, 0x075f, 0x073f, 0x071f, 0x06ff, 0x06ff, 0x06df, 0x06df, 0x06df, 0x06bf, 0x06bf, 0x069e, 0x069f, 0x067e, 0x067e, 0x065e, 0x065e, 0x063e, 0x061e, 0x061e, 0x05fe, 0x05de, 0x05de, 0x05be, 0x05be, 0x057e, 0x055e, 0x051e, 0x051e, 0x04fe, 0x04be, 0x045e, 0x03fe, 0x03be, 0x039e, 0x037e, 0x037e, 0x035e, 0x033e, 0x035e, 0x061d, 0x067e, 0x067e, 0x069e, 0x06be, 0x06fe, 0x073f, 0x075f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07ff, 0x7d59, 0xd335, 0xd335, 0xd335, 0xd314, 0x699a, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x007f, 0x60d8, 0xc0b1, 0xc0b1, 0xb8f2, 0x05df, 0x061f, 0x065f, 0x06df, 0x073f, 0x077f, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x363c, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xb8d1, 0xc0d1, 0xb8d1, 0xb8d1, 0x90d1, 0x3911, 0x30f0, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x18ae, 0x18ad, 0x18ae, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x00f9, 0x0119, 0x0119, 0x011a, 0x08d5, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x20ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x28ce, 0x28ce, 0x30ef, 0xb314, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd375, 0xd355, 0x9c77, 0x3edd, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x659a, 0xd315, 0xd314, 0xd315, 0xd314, 0xd314, 0xd314, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2d4, 0xd2d4, 0xd2f4, 0xcad4, 0xd2d4, 0xd2b4, 0xd2b4, 0xd2b4, 0xcab4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd294, 0xd294, 0xca94, 0xca94, 0xca94, 0xca94, 0xca74, 0xca74, 0xca73, 0xca73, 0xd274, 0xca53, 0xca53, 0xca53, 0xca53, 0xca53, 0xca53, 0xca33, 0xca33, 0xca33, 0xab15, 0x0edf, 0x06ff, 0x06ff, 0x06df, 0x06df, 0x06bf, 0x06bf, 0x06df, 0x06bf, 0x069f, 0x069f, 0x067e, 0x067f, 0x067e, 0x065e, 0x063f, 0x061e, 0x061e, 0x05fe, 0x05fe, 0x05de, 0x05be, 0x059e, 0x059e, 0x055e, 0x053e, 0x051e, 0x04fe, 0x04de, 0x049e, 0x043e, 0x03be, 0x039e, 0x039e, 0x035e, 0x035e, 0x033e, 0x033e, 0x031e, 0x02fe, 0x037e, 0x05fe, 0x065e, 0x067e, 0x069e, 0x06de, 0x06fe, 0x075f, 0x077f, 0x079f, 0x07bf, 0x07df, 0x07ff, 0x271d, 0xd335, 0xd314, 0xd315, 0xd315, 0xc2d5, 0x083f, 0x001f, 0x001f, 0x001f, 0x001f, 0x009f, 0x60d8, 0xc0b1, 0xc0b2, 0xc0b1, 0x04bf, 0x053f, 0x05bf, 0x067f, 0x06df, 0x075f, 0x079f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xc0b1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xc0b1, 0xb8d1, 0x98d1, 0x3911, 0x38f0, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x18ce, 0x20ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ae, 0x18ad, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28ce, 0x20ce, 0x30ef, 0xb314, 0xd375, 0xd375, 0xd375, 0xd375, 0xd355, 0xd375, 0xac37, 0x36dd, 0x07ff, 0x07ff, 0x07ff, 0x0ebd, 0x1d7b, 0x1c99, 0x32f5, 0x3a75, 0x6193, 0x69b3, 0x79f4, 0x8a14, 0xb294, 0xcaf4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2b4, 0xd2b4, 0xcad4, 0xd2b4, 0xcab4, 0xd2b4, 0xd2b4, 0xd294, 0xd294, 0xd294, 0xd294, 0xca94, 0xca94, 0xca74, 0xca74, 0xd274, 0xd274, 0xca53, 0xca54, 0xca54, 0xca53, 0xd253, 0xca53, 0xca33, 0xca33, 0xca33, 0xca33, 0x8b97, 0x35fd, 0x5d7b, 0x6d3a, 0x6d3a, 0x5d5b, 0x35fd, 0x06bf, 0x0e7e, 0x457c, 0x6c99, 0x6479, 0x6459, 0x4cba, 0x0e1e, 0x063e, 0x063e, 0x061e, 0x05fe, 0x05fe, 0x05fe, 0x05de, 0x05be, 0x059e, 0x057e, 0x055e, 0x051e, 0x051e, 0x04fe, 0x04de, 0x047e, 0x03de, 0x03be, 0x037e, 0x037f, 0x035e, 0x033e, 0x033e, 0x031e, 0x02fe, 0x02fe, 0x02fe, 0x02de, 0x03fe, 0x05be, 0x063e, 0x065e, 0x069e, 0x06de, 0x071f, 0x073e, 0x077f, 0x079f, 0x07bf, 0x07df, 0x07ff, 0xbbb6, 0xd314, 0xd315, 0xd2f4, 0xd2f4, 0x697a, 0x001f, 0x001f, 0x001f, 0x003f, 0x007f, 0x48fa, 0xc0b1, 0xc0b1, 0xc0b1, 0x331c, 0x047f, 0x053f, 0x05ff, 0x069f, 0x073f, 0x079f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x9a14, 0xb8d1, 0xb8d1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d1, 0x3911, 0x38f0, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x20cf, 0x20ae, 0x18cf, 0x08f6, 0x011a, 0x0119, 0x0119, 0x08f4, 0x18ce, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x20ad, 0x20ae, 0x18ad, 0x20ae, 0x20ae, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x9273, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xc3b6, 0x5dfb, 0x07ff, 0x0e3b, 0x1c98, 0x2ad5, 0x3911, 0x3911, 0x3912, 0x4111, 0x4112, 0x4112, 0x4112, 0x4132, 0x4132, 0x4132, 0x4132, 0x4933, 0x5173, 0x79d3, 0x9a54, 0xc294, 0xd2f4, 0xd2d5, 0xcad4, 0xd2d4, 0xd2b4, 0xcad4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd294, 0xd294, 0xd294, 0xd294, 0xca94, 0xca94, 0xca74, 0xca74, 0xca74, 0xca73, 0xd253, 0xca53, 0xca53, 0xca53, 0xca53, 0xca53, 0xca33, 0xca33, 0xca33, 0xca33, 0x99d4, 0x6358, 0xd395, 0xd396, 0xd395, 0xd395, 0xd375, 0xd375, 0x06bf, 0x5cfa, 0xd2b4, 0xca94, 0xca33, 0xca13, 0xc9d3, 0xb9d3, 0x4c5a, 0x061e, 0x061e, 0x05de, 0x05de, 0x05be, 0x059e, 0x059e, 0x057e, 0x053e, 0x051e, 0x051d, 0x04de, 0x04be, 0x043e, 0x03be, 0x03be, 0x037f, 0x0b7e, 0x337c, 0x333c, 0x335c, 0x333c, 0x333c, 0x331c, 0x331c, 0x32fc, 0x32fc, 0x32dc, 0x2b7c, 0x05de, 0x061e, 0x065e, 0x069e, 0x06de, 0x071f, 0x073f, 0x077f, 0x07bf, 0x07df, 0x07df, 0x84f9, 0xd314, 0xcb14, 0xcaf4, 0xd2d5, 0xb275, 0x001f, 0x001f, 0x001f, 0x001f, 0x005f, 0x08df, 0xb8d2, 0xc0b1, 0xc0b1, 0x3a7b, 0x03ff, 0x04df, 0x05bf, 0x067f, 0x071f, 0x079f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x7b77, 0xb8d1, 0xb8b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0x4111, 0x38f1, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28cf, 0x20cf, 0x20ae, 0x20cf, 0x0918, 0x013a, 0x011a, 0x0119, 0x011a, 0x0119, 0x08f6, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x00f9, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x011a, 0x0119, 0x0139, 0x00f9, 0x10d2, 0x20ae, 0x18ad, 0x20ae, 0x20ae, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x7a32, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0x9c78, 0x261b, 0x1b96, 0x3171, 0x30f0, 0x38f1, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x4111, 0x3912, 0x4112, 0x4112, 0x4112, 0x4132, 0x4112, 0x4132, 0x4132, 0x4912, 0x4132, 0x6172, 0x81f3, 0xaa73, 0xcad4, 0xd2b4, 0xcab4, 0xd2b4, 0xd2b4, 0xcab4, 0xcab4, 0xca94, 0xca94, 0xd294, 0xca94, 0xca94, 0xca74, 0xca74, 0xca74, 0xd274, 0xca54, 0xd274, 0xca53, 0xca53, 0xca53, 0xd233, 0xca33, 0xca33, 0xd233, 0xc234, 0x7994, 0x5975, 0xb315, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xc375, 0x067f, 0x067f, 0x6c79, 0xca33, 0xca13, 0xc9d3, 0xc992, 0xc952, 0xc912, 0x34bb, 0x05fe, 0x05de, 0x05be, 0x059e, 0x055e, 0x055e, 0x053e, 0x051e, 0x04fe, 0x249d, 0x347b, 0x6bfa, 0x7b99, 0x9b98, 0xab97, 0xdb95, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd396, 0xd395, 0xbbd6, 0x9c37, 0x8499, 0x6d1a, 0x363c, 0x1edd, 0x079f, 0x07bf, 0x07df, 0x4e1b, 0xd2f4, 0xd2f5, 0xd2d4, 0xd2d4, 0xd2d4, 0x40fc, 0x001f, 0x001f, 0x001f, 0x003f, 0x009f, 0x78d7, 0xc0b1, 0xc0b1, 0x61d8, 0x03bf, 0x049f, 0x057f, 0x065f, 0x071f, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x54d9, 0xb8d1, 0xb8b1, 0xb8d1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0x4111, 0x3911, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x20cf, 0x20ae, 0x10f3, 0x013a, 0x0119, 0x0139, 0x0119, 0x0119, 0x0119, 0x011a, 0x18d0, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x18ad, 0x20ae, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x5170, 0xd395, 0xd375, 0xd375, 0xd375, 0xd355, 0x6519, 0x22b3, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x4112, 0x4112, 0x4112, 0x4112, 0x4132, 0x4112, 0x4132, 0x4112, 0x4952, 0x79b3, 0xa233, 0xd2b4, 0xcab4, 0xd294, 0xca94, 0xd294, 0xca94, 0xca74, 0xca94, 0xca74, 0xca74, 0xd274, 0xca54, 0xd274, 0xd253, 0xca54, 0xca54, 0xca33, 0xd233, 0xca34, 0xca33, 0xca33, 0xa1d3, 0x5954, 0x5954, 0x79f5, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd335, 0x8c18, 0x067f, 0x065f, 0x063f, 0xa2d5, 0xc9d3, 0xc972, 0xc952, 0xc111, 0xc8d1, 0x8a55, 0x05de, 0x05be, 0x059e, 0x057e, 0x055e, 0x34dc, 0x6c5a, 0xa3f7, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd355, 0xd355, 0xd335, 0xd335, 0xd335, 0xbbb6, 0x84d9, 0x4e1b, 0x465c, 0xd2f5, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2b4, 0x81d8, 0x001f, 0x001f, 0x001f, 0x001f, 0x005f, 0x6098, 0xc0b1, 0xc0d1, 0x59b8, 0x035f, 0x045f, 0x055f, 0x063f, 0x06ff, 0x079f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x363c, 0xc0d1, 0xb8d1, 0xb8b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0x58f1, 0x3911, 0x30f0, 0x3110, 0x30cf, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x08f6, 0x013a, 0x0119, 0x0119, 0x011a, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119,
-  0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x011a, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x011a, 0x011a, 0x011a, 0x0119, 0x0119, 0x011a, 0x00f8, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ae, 0x20ce, 0x20ae, 0x28ee, 0xcb55, 0xd375, 0xd375, 0xd375, 0xbb14, 0x34f9, 0x2930, 0x30ef, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x4112, 0x4111, 0x3931, 0x4112, 0x4111, 0x6993, 0x91f2, 0xc254, 0xca93, 0xca94, 0xca94, 0xca74, 0xca74, 0xd274, 0xca73, 0xd273, 0xca73, 0xd254, 0xca53, 0xca53, 0xca54, 0xca33, 0xca34, 0xa1f3, 0x6973, 0x4953, 0x5134, 0x5154, 0xaaf5, 0xd395, 0xd395, 0xd395, 0xd375, 0xd335, 0xd314, 0x5cda, 0x065f, 0x063f, 0x063f, 0xb254, 0xc972, 0xc952, 0xc112, 0xc8d1, 0xc0b1, 0xc0b1, 0x05be, 0x059e, 0x2d1c, 0x9438, 0xcbb6, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd375, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd314, 0xd314, 0xd315, 0xd2f4, 0xd2f5, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2b4, 0xd2b4, 0xca94, 0x087f, 0x003f, 0x001f, 0x001f, 0x001f, 0x385b, 0xc0b1, 0xc0b1, 0x9135, 0x031f, 0x043f, 0x053f, 0x063f, 0x071f, 0x079f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8b1, 0xb8d1, 0xc0d1, 0xb8b1, 0xb8d1, 0x5911, 0x3911, 0x38f0, 0x30f0, 0x30cf, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x0917, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f9, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119,
-  0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0118, 0x011a, 0x00f9, 0x0119, 0x00f9, 0x10d2, 0x20ad, 0x18cd, 0x20ae, 0x18ad, 0x20ae, 0x20ce, 0x20ce, 0x8252, 0xd375, 0xd375, 0xd375, 0x9a93, 0x30ef, 0x20cf, 0x28cf, 0x28cf, 0x28ef, 0x28ef, 0x28f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x38f0, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x38f1, 0x3911, 0x3911, 0x3911, 0x3911, 0x4111, 0x6972, 0x81d2, 0xaa13, 0xba33, 0xca54, 0xca74, 0xca53, 0xca54, 0xca53, 0xca53, 0xb213, 0xa1f3, 0x8193, 0x5152, 0x4932, 0x4933, 0x4933, 0x4933, 0x5174, 0xd395, 0xd395, 0xd396, 0xd375, 0xd334, 0xd2f5, 0xd2b4, 0x2d9d, 0x063f, 0x063f, 0x061f, 0xc993, 0xc952, 0xc911, 0xc8f1, 0xc0b1, 0xc0b1, 0xb8d1, 0x059e, 0x057e, 0xabf7, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd315, 0xd335, 0xcb15, 0xd2f4, 0xd2f5, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2b4, 0xd2b4, 0xd294, 0xd294, 0x411c, 0x003f, 0x003f, 0x001f, 0x001f, 0x203c, 0xc0b1, 0xc0b1, 0x9135, 0x02ff, 0x041f, 0x051f, 0x061f, 0x06ff, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xa1b3, 0xb8b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0x68f1, 0x3911, 0x38f0, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x28cf, 0x20ce, 0x10f3, 0x0119, 0x0119, 0x0119, 0x00fa, 0x0119, 0x0119, 0x0119, 0x10d0, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ad, 0x18ae, 0x18ae, 0x18ad, 0x20ae, 0x18ad, 0x20ae, 0x20ce, 0x412f, 0xd375, 0xd375, 0xd375, 0x71d1, 0x20ce, 0x28cf, 0x20cf, 0x28ce, 0x28cf, 0x28cf, 0x28ef, 0x28ef, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x3110, 0x3110, 0x38f0, 0x30f0, 0x3111, 0x3111, 0x38f1, 0x38f1, 0x38f0, 0x3910, 0x3910, 0x3910, 0x3911, 0x3911, 0x3911, 0x3910, 0x6152, 0x6152, 0x5131, 0x3911, 0x3911, 0x3911, 0x3912, 0x4112, 0x4132, 0x4112, 0x4932, 0x4932, 0x8a34, 0xd395, 0xd395, 0xd375, 0xd335, 0xd2f4, 0xcad4, 0xb2f6, 0x065f, 0x061f, 0x061f, 0x34dc, 0xc952, 0xc912, 0xc8d2, 0xc0b1, 0xc0d1, 0xb8d1, 0x89b4, 0x2bba, 0x4216, 0x5154, 0x5154, 0x4954, 0x5154, 0x6194, 0x71d4, 0x69f4, 0x71d3, 0x69d4, 0x71d3, 0x7a14, 0x8a75, 0x9274, 0x9254, 0x9254, 0x9a95, 0xb315, 0xbb14, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd314, 0xd315, 0xd2f4, 0xcb14, 0xd2f4, 0xd2f4, 0xd2d4, 0xcad4, 0xcab4, 0xd2b4, 0xcab4, 0xca94, 0xca94, 0x81b8, 0x005f, 0x005f, 0x003f, 0x001f, 0x001f, 0xa8b3, 0xc0b1, 0xb0d2, 0x02df, 0x03ff, 0x051f, 0x061f, 0x06ff, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x8a95, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0x78f2, 0x3911, 0x38f0, 0x30f0, 0x28f0, 0x28cf, 0x28cf, 0x28ce, 0x20ce, 0x20cf, 0x0918, 0x0119, 0x0119, 0x011a, 0x00f9, 0x0119, 0x08f7, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x18ad, 0x20ae, 0x20ae, 0x20cd, 0x20ae, 0x20cd, 0x9272, 0xd375, 0xc334, 0x61d1, 0x20cf, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28ef, 0x30ef, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x30f0, 0x3110, 0x3110, 0x30f0, 0x3110, 0x38f0, 0x30f0, 0x38f0, 0x3111, 0x38f0, 0x3911, 0x38f1, 0x3911, 0x3911, 0x3912, 0x4111, 0x4132, 0x4132, 0xb2f5, 0xd395, 0xd375, 0xd355, 0xd2f4, 0xd2b4, 0xd274, 0x83b8, 0x063f, 0x061f, 0x061e, 0x6398, 0xc912, 0xc8d1, 0xc0b1, 0xc0b1, 0xb8b1, 0xb8d1, 0x7933, 0x5153, 0x5134, 0x5154, 0x5133, 0x4953, 0x4933, 0x4933, 0x4933, 0x4133, 0x4933, 0x4932, 0x4932, 0x4932, 0x4933, 0x4933, 0x4933, 0x4932, 0x4932, 0x4933, 0x4933, 0x4933, 0x61b3, 0x7a34, 0x9a95, 0xb2f5, 0xd375, 0xd375, 0xd355, 0xd355, 0xd355, 0xd335, 0xd335, 0xd314, 0xd314, 0xd315, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2d4, 0xd2d4, 0xd2b4, 0xd2b4, 0xd294, 0xd294, 0xd274, 0xca74, 0xc254, 0x007f, 0x005f, 0x005f, 0x003f, 0x001f, 0x5878, 0xb8d1, 0xc0b1, 0x02bf, 0x03bf, 0x04ff, 0x05ff, 0x06ff, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x6478, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0x78f1, 0x3911, 0x38f0, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20cf, 0x0917, 0x011a, 0x011a, 0x0119, 0x08f4, 0x18ce, 0x18ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20cd, 0x18ce, 0x20ae, 0x390f, 0xd375, 0xcb35, 0x414f, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28ef, 0x28ef, 0x30ef, 0x30ef, 0x30ef, 0x30ef, 0x30ef, 0x30ef, 0x30ef, 0x30ef, 0x30f0, 0x28f0, 0x30f0, 0x30f0, 0x30f0, 0x28f0, 0x30f0, 0x30ef, 0x3110, 0x30f0, 0x30d0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f1, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3910, 0x3911, 0x38f1, 0x3911, 0x3912, 0x4952, 0xd395, 0xd375, 0xd335, 0xd2f4, 0xd2b4, 0xd274, 0xca33, 0x4c9a, 0x05ff, 0x061f, 0x05ff, 0xa1f4, 0xc0d1, 0xc0b1, 0xc0b1, 0xb8d1, 0xb8d1, 0xa0f1, 0x5134, 0x4933, 0x4933, 0x4933, 0x4933, 0x4933, 0x4932, 0x4932, 0x4932, 0x4132, 0x4132, 0x4132, 0x4112, 0x4112, 0x4112, 0x4112, 0x4112, 0x4112, 0x4132, 0x4132, 0x4132, 0x4132, 0x4132, 0x4133, 0x4933, 0x4932, 0x4953, 0x6193, 0x8214, 0xa274, 0xc315, 0xd335, 0xd314, 0xd315, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2b4, 0xcab4, 0xcab4, 0xca94, 0xca74, 0xca74, 0xca74, 0xca54, 0x20fd, 0x009f, 0x007f, 0x005f, 0x003f, 0x105d, 0xc0b1, 0xc0d1, 0x029f, 0x03bf, 0x04df, 0x05ff, 0x06ff, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x54d9, 0xb8d1, 0xb8d1, 0xb8b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0x78f1, 0x3911, 0x38f0, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28ce, 0x20cf, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ad, 0x18ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x20ad, 0x20ae, 0x61d0, 0xbb14, 0x412f, 0x20ae, 0x20ae, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x28ce, 0x20ce, 0x20cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28ef, 0x28cf, 0x28f0, 0x30d0, 0x28ef, 0x28cf, 0x30cf, 0x30f0, 0x30d0, 0x30d0, 0x28f0, 0x30f0, 0x30f0, 0x30f0, 0x30d0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x38f0, 0x3911, 0x3911, 0x3911, 0x61b2, 0xd375, 0xd335, 0xd2f4, 0xcad4, 0xca74, 0xd233, 0xca13, 0x1d9d, 0x05ff, 0x05ff, 0x1d3d, 0xc0d1, 0xc0b1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb0d1, 0x6132, 0x4933, 0x4933, 0x4932, 0x4132, 0x4112, 0x4112, 0x4112, 0x4132, 0x4112, 0x4111, 0x4111, 0x4112, 0x4112, 0x4111, 0x3911, 0x3911, 0x4111, 0x4112, 0x4112, 0x3912, 0x4132, 0x4112, 0x4112, 0x4112, 0x4912, 0x4132, 0x4132, 0x4932, 0x4933, 0x4953, 0x4933, 0x6173, 0x8a14, 0xaa74, 0xcaf4, 0xd2f5, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2b4, 0xcab4, 0xd2b4, 0xd294, 0xca94, 0xca73, 0xd274, 0xd253, 0xd254, 0x597a, 0x00bf, 0x00bf, 0x009f, 0x009f, 0x005f, 0xa8b3, 0xc0b1, 0x31fc, 0x039f, 0x04df, 0x05df, 0x06df, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x2e3c, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8b1, 0xb8d1, 0xb8d1, 0x78f1, 0x3911, 0x30f0, 0x30f0, 0x28ef, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ad, 0x20ae, 0x18ce, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18af, 0x18af, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18af, 0x18af, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ae, 0x390f, 0x28ce, 0x20ae, 0x20ce, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28ef, 0x28ef, 0x28cf, 0x28ef, 0x28ef, 0x30ef, 0x28ef, 0x28ef, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x3911, 0x71f2, 0xd335, 0xd2f4, 0xd2b4, 0xca74, 0xd233, 0xca13, 0xa295, 0x05ff, 0x05ff, 0x05ff, 0x5399, 0xc0d1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb0d1, 0x7912, 0x4952, 0x4132, 0x4112, 0x4132, 0x4132, 0x4132, 0x4112, 0x3911, 0x3911, 0x3911, 0x3911, 0x38f1, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x4111, 0x4112, 0x4112, 0x4112, 0x4112, 0x4132, 0x4932, 0x4932, 0x4933, 0x4933, 0x5133, 0x6194, 0x9a34, 0xc2b4, 0xd2b5, 0xd2b3, 0xcab4, 0xd294, 0xd294, 0xca93, 0xd274, 0xd274, 0xca53, 0xca54, 0xca53, 0x81d8, 0x00df, 0x00df, 0x00df, 0x00bf, 0x00bf, 0x68b7, 0xb8d1, 0x31dc, 0x033f, 0x049f, 0x05df, 0x06ff, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x26bd, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d2, 0xb8d1, 0xb8d1, 0x78f1, 0x3911, 0x38f1, 0x30f0, 0x30ef, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18b0, 0x0118, 0x0119, 0x0119, 0x00f6, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x10cf, 0x00f8, 0x0119, 0x011a, 0x00f6, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20cf, 0x20cf, 0x20cf, 0x20cf, 0x20cf, 0x20cf, 0x20cf, 0x20cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28cf, 0x28ef, 0x28f0, 0x28f0, 0x30f0, 0x30f0, 0x38f0, 0x8213, 0xd2f5, 0xcad4, 0xd274, 0xca53, 0xc9f3, 0xc9d2, 0x7398, 0x05ff, 0x05ff, 0x05df, 0xa953, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0x98f2, 0x4132, 0x4132, 0x4112, 0x4111, 0x4111, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x38f0, 0x38f0, 0x38f0, 0x38f0, 0x3911, 0x38f0, 0x38f0, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x3911, 0x4112, 0x4112, 0x4112, 0x4132, 0x4132, 0x4933, 0x4933, 0x4933, 0x5153, 0x5974, 0x9214, 0xca94, 0xd294, 0xca94, 0xd274, 0xca74, 0xd274, 0xca53, 0xca54, 0xca53, 0xca34, 0x99f6, 0x011f, 0x011f, 0x00ff, 0x00ff, 0x00ff, 0x38db, 0xc0b1, 0x28fc, 0x02df, 0x047f, 0x059f, 0x06df, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0x78f1, 0x3911, 0x38f0, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18cd, 0x18ad, 0x18ae, 0x18b0, 0x0119, 0x00f9, 0x0119, 0x00f9, 0x0119, 0x08f6, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18d0, 0x00f9, 0x0119, 0x0119, 0x011a, 0x0119, 0x08f6, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x310e, 0x7a32, 0xaad3, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd335, 0xd2b4, 0xca94, 0xca33, 0xd1f3, 0xc9d3, 0xc993, 0xc972, 0xc992, 0xc972, 0xc932, 0xc0d1, 0xc0b1, 0xb8d1, 0xb0d2, 0xb9f2, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xca13, 0x015f, 0x013f, 0x013f, 0x013f, 0x011f, 0x093f, 0xc0b1, 0x311c, 0x01bf, 0x03ff, 0x059f, 0x069f, 0x079f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0xb8b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0x78f1, 0x3911, 0x3911, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ae, 0x18b0, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x011a, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x10cf, 0x0118, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x20ad, 0x18ad, 0x496f, 0xaad3, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd2f4, 0xca74, 0xca33, 0xca13, 0xc9d3, 0xc992, 0xc952, 0xc111, 0xc0d1, 0xc0b1, 0xc0d1, 0xb8b1, 0xb8d1, 0xb8d1, 0xca53, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xca13, 0x097f, 0x017f, 0x015f, 0x017f, 0x015f, 0x015f, 0x88f5, 0x293c, 0x013f, 0x02df, 0x053e, 0x067f, 0x077f, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x9234, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0x78f1, 0x3911, 0x3911, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ae, 0x10d0, 0x0118, 0x0119, 0x011a, 0x011a, 0x0119, 0x011a, 0x0119, 0x011a, 0x18ad, 0x18ad, 0x18ad, 0x18d0, 0x00f8, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x011a, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ee, 0x8252, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd3b5, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd2b4, 0xd233, 0xca13, 0xc9b3, 0xc992, 0xc952, 0xc912, 0xc8d1, 0xc0b1, 0xc0b1, 0xb8b1, 0xb8d1, 0xb8d1, 0xc253, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdb95, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xca13, 0x31bc, 0x01bf, 0x019f, 0x019f, 0x019f, 0x019f, 0x5139, 0x315c, 0x017f, 0x01bf, 0x045e, 0x063e, 0x077f, 0x07fe, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x8a95, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb8d1, 0x78f1, 0x3911, 0x3911, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x10d0, 0x0118, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x10d0, 0x00f9, 0x0119, 0x0119, 0x00fa, 0x0119, 0x0119, 0x011a, 0x0119, 0x08f5, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x28ee, 0xb314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd4f8, 0xd65c, 0xd6dd, 0xd6fd, 0xd7ff, 0xd7ff, 0xdfff, 0xd7ff, 0xd7ff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xd7ff, 0xcb15, 0xca13, 0xc9d3, 0xc992, 0xc932, 0xc911, 0xc0d1, 0xc0b1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xc397, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xd539, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdb95, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xc9f3, 0x31fc, 0x01df, 0x01df, 0x01df, 0x01df, 0x01df, 0x01bf, 0x01df, 0x01bf, 0x01bf, 0x02df, 0x05fd, 0x073e, 0x07fe, 0x07fe, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x8ab5, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0f1, 0xb8d1, 0x78f1, 0x3911, 0x3911, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x00f9, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x00f7, 0x18ce, 0x18ad, 0x10d0, 0x00f8, 0x0119, 0x011a, 0x0119, 0x011a, 0x011a, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ae, 0x18ae, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x28ee, 0xcb55, 0xd375, 0xd395, 0xd395, 0xd3d6, 0xd5db, 0xd7bf, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xdfff, 0xca13, 0xc9b3, 0xc992, 0xc952, 0xc912, 0xc0d1, 0xc0b1, 0xc0d1, 0xb8b1, 0xb8d1, 0xb0f1, 0xba95, 0xdfff, 0xd7ff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xd7ff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xd539, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xc9f3, 0x31fd, 0x021f, 0x01ff, 0x01ff, 0x01ff, 0x01ff, 0x01ff, 0x01ff, 0x01ff, 0x01df, 0x01ff, 0x051d, 0x071d, 0x07fd, 0x07fe, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x6bf7, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d1, 0x78f1, 0x3911, 0x3911, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18cf, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x011a, 0x011a, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x28ee, 0xb314, 0xd395, 0xd395, 0xd395, 0xd477, 0xd77e, 0xd7ff, 0xd7ff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xc9d3, 0xc992, 0xc952, 0xc912, 0xc8d1, 0xc0b1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb152, 0xd79e, 0xdfff, 0xdfff, 0xdfff, 0xd7ff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xd7ff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd539, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xc9d3, 0x323c, 0x023f, 0x023f, 0x021f, 0x023f, 0x023f, 0x021f, 0x021f, 0x021f, 0x021f, 0x021f, 0x037e, 0x06dc, 0x07fd, 0x07fd, 0x07fe, 0x07ff, 0x07ff, 0x07ff, 0x5c78, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb8d1, 0xb0f1, 0x7911, 0x3911, 0x3911, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x011a, 0x00f9, 0x0119, 0x0119, 0x0119, 0x011a, 0x0117, 0x18ae, 0x18ad, 0x10d0, 0x00f9, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18cd, 0x8252, 0xd395, 0xd395, 0xd396, 0xd4b8, 0xd7bf, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xc972, 0xc952, 0xc912, 0xc8d1, 0xc0b1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0f1, 0xd63c, 0xdfff, 0xdfff, 0xd7ff, 0xdfff, 0xdfff, 0xd7ff, 0xdfff, 0xdfff, 0xd7ff, 0xd7ff, 0xdfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xdfff, 0xd7ff, 0xdfff, 0xd539, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xc9d3, 0x325c, 0x027f, 0x025f, 0x025f, 0x025f, 0x023f, 0x025f, 0x025f, 0x023f, 0x023f, 0x023f, 0x029f, 0x067c, 0x07fc, 0x07fc, 0x07fe, 0x07ff, 0x07ff, 0x07ff, 0x5c78, 0xb8d1, 0xb0d1, 0xb8d1, 0xb0d1, 0xb0d1, 0xb8d1, 0x70f1, 0x3911, 0x3911, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x10cf, 0x0119, 0x0119, 0x011a, 0x011a, 0x0119, 0x0119, 0x0119, 0x011a, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x496f, 0xd395, 0xd395, 0xd395, 0xd457, 0xd7bf, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7df, 0xd7ff, 0xcf3e, 0xc67c, 0xc53a, 0xc951, 0xc912, 0xc0d1, 0xc0b1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb0f1, 0xbb97, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd65b, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd396, 0xd395, 0xc9b3, 0x327c, 0x029f, 0x029f, 0x029f, 0x029f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x025f, 0x027f, 0x05bc, 0x07db, 0x07fc, 0x07fd, 0x07ff, 0x07ff, 0x07ff, 0x5c78, 0xb8d1, 0xb0d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d1, 0x58f1, 0x3911, 0x3111, 0x30f0, 0x28f0, 0x28f0, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x011a, 0x0119, 0x0119, 0x011a, 0x0117, 0x18ce, 0x18ae, 0x18d0, 0x0118, 0x00f9, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0xa2d3, 0xd395, 0xd395, 0xd3d6, 0xd75e, 0xcfff, 0xcfff, 0xd7ff, 0xd7ff, 0xcfff, 0xcfff, 0xd7ff, 0xd7ff, 0xd7df, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7df, 0xd7ff, 0xd7ff, 0xcfdf, 0xcfff, 0xd7ff, 0xd7df, 0xd7ff, 0xcfff, 0xd7ff, 0xd7df, 0xd7ff, 0xcfff, 0xd7df, 0xcfff, 0xcfff, 0xd7ff, 0xd7ff, 0xcfff, 0xd7ff, 0xcfff, 0xd7ff, 0xd7df, 0xd7df, 0xcfff, 0xd7df, 0xcfff, 0xd7ff, 0xd7ff, 0xcfff, 0xd7ff, 0xcfff, 0xd7ff, 0xd7df, 0xd7ff, 0xd7ff, 0xcfff, 0xcfff, 0xd7ff, 0xcfff, 0xd7df, 0xcfff, 0xd7ff, 0xd7df, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xcfff, 0xd7ff, 0xcfdf, 0xd7df, 0xcfdf, 0xcfff, 0xd7df, 0xacd8, 0x8191, 0x9151, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0xa8f1, 0xa972, 0xd77e, 0xd7ff, 0xd7ff, 0xd7df, 0xd7df, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7df, 0xcfff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7df, 0xd7df, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7ff, 0xd7df, 0xd7ff, 0xd7df, 0xd7ff, 0xd7df, 0xd65c, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xc193, 0x0a7f, 0x02ff, 0x02df, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x027f, 0x029f, 0x027f, 0x04dd, 0x07bb, 0x07fb, 0x07fd, 0x07ff, 0x07ff, 0x07ff, 0x3dbb, 0xb8d1, 0xb8d1, 0xb0f1, 0xb0d1, 0xb0d1, 0xb0d1, 0x5911, 0x3911, 0x30f0, 0x30f0, 0x28f0, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x00f9, 0x0119, 0x011a, 0x00f7, 0x18ae, 0x18ad, 0x18af, 0x0118, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x011a, 0x0117, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x310e, 0xd395, 0xd375, 0xd375, 0xd5ba, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xc77e, 0xbe5b, 0xbe3c, 0xb57a, 0xacb8, 0xbdbb, 0xc63c, 0xbe3b, 0xc71e, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xc77e, 0xbe5c, 0xb5db, 0xacb8, 0xac98, 0xbd5a, 0xbe3c, 0xc61c, 0xc69d, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xacb9, 0x8191, 0x9151, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0xa111, 0xa911, 0xbc78, 0xcfdf, 0xcfdf, 0xcfdf, 0xd7df, 0xcfdf, 0xcf5e, 0xbe5c, 0xbe5c, 0xc63c, 0xc61c, 0xcefd, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfff, 0xcfdf, 0xd63b, 0xd375, 0xd395, 0xd375, 0xd395, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd375, 0xd395, 0xd375, 0xd375, 0xd375, 0xd395, 0x089f, 0x011f, 0x031f, 0x02ff, 0x02ff, 0x02df, 0x02df, 0x02df, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x03fd, 0x079a, 0x07fa, 0x07fc, 0x07fe, 0x07ff, 0x07ff, 0x2e5c, 0xb0d1, 0xb8d1, 0xb8d1, 0xb0f1, 0xb0d1, 0xb8d1, 0x5912, 0x3911, 0x38f1, 0x30f0, 0x28f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x0119, 0x0119, 0x0117, 0x18ce, 0x18ad, 0x18ad, 0x0118, 0x011a, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0117, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x79f1, 0xd355, 0xd355, 0xd355, 0xcf7e, 0xc7df, 0xcfbf, 0xcfdf, 0xc7df, 0xc7df, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfbf, 0xcfdf, 0xcfdf, 0xcfbf, 0xbefd, 0xacb8, 0x8a52, 0x9151, 0x9131, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0xa192, 0xab96, 0xbe7d, 0xcfdf, 0xc7df, 0xcfbf, 0xc7df, 0xcfdf, 0xcfbf, 0xc75e, 0xad19, 0x92b4, 0x8971, 0x9151, 0x9931, 0x9931, 0x9911, 0x9911, 0xa111, 0x9931, 0xa111, 0x9911, 0xab36, 0xbd5a, 0xc75e, 0xcfdf, 0xc7bf, 0xc7bf, 0xcfdf, 0xc7df, 0xc7bf, 0xc7df, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xcfdf, 0xc7df, 0xcfbf, 0xc7df, 0xc7bf, 0xcfbf, 0xc7df, 0xa4b8, 0x8191, 0x9151, 0x9931, 0x9911, 0x9931, 0x9931, 0x9911, 0x9931, 0x9912, 0xbe3b, 0xcfbf, 0xcfdf, 0xcfbf, 0xcfdf, 0xcfdf, 0xb5da, 0x8a12, 0x8971, 0x9931, 0x9931, 0xa111, 0x9931, 0xab35, 0xc75e, 0xcfbf, 0xcfdf, 0xc7df, 0xc7df, 0xcfdf, 0xcfdf, 0xcfbf, 0xc7df, 0xc7df, 0xcfdf, 0xcfdf, 0xcfdf, 0xc7df, 0xcfdf, 0xcfdf, 0xcfdf, 0xce1b, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0x007f, 0x009e, 0x023f, 0x033f, 0x031f, 0x031f, 0x031f, 0x02ff, 0x031f, 0x02ff, 0x02df, 0x02df, 0x02df, 0x039e, 0x075a, 0x07f9, 0x07fb, 0x07fd, 0x07ff, 0x07ff, 0x2e3c, 0xb8d2, 0xb8d1, 0xb0d1, 0xb8d1, 0xb0d1, 0xb0d1, 0x4911, 0x3911, 0x38f0, 0x30f0, 0x28f0, 0x28ef, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x011a, 0x00f7, 0x18ce, 0x18ad, 0x18ae, 0x18ad, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x011a, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0xa293, 0xd335, 0xd335, 0xcc98, 0xc7bf, 0xc7be, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc75e, 0xa4b8, 0x8191, 0x9151, 0x9911, 0xa131, 0xa111, 0xa111, 0x9931, 0xa111, 0xa112, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xab35, 0xbefe, 0xc7bf, 0xc7be, 0xc7bf, 0xb5db, 0x89f1, 0x8971, 0x9931, 0x9911, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa132, 0x9911, 0xa111, 0xa111, 0xa111, 0xa111, 0xa172, 0xbd3a, 0xc7be, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7be, 0xc79f, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc79f, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xac98, 0x8191, 0x9151, 0x9931, 0xa111, 0xa131, 0xa111, 0xa131, 0xa111, 0x9931, 0xbe1b, 0xc79f, 0xc7bf, 0xc7bf, 0xc7bf, 0xbefd, 0x89f2, 0x8991, 0x9931, 0xa112, 0xa131, 0xa111, 0xa111, 0xa111, 0xab97, 0xc7bf, 0xc7bf, 0xc7be, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc7bf, 0xc6dd, 0xd375, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd335, 0xd334, 0xd335, 0xd335, 0x009f, 0x009f, 0x013f, 0x033f, 0x037f, 0x035f, 0x033f, 0x031f, 0x031f, 0x031f, 0x031f, 0x02ff, 0x02ff, 0x033f, 0x06f9, 0x07f9, 0x07fb, 0x07fd, 0x07ff, 0x07ff, 0x2e3c, 0xb8d2, 0xb0f1, 0xb8d1, 0xb0d1, 0xb0f1, 0xb0d1, 0x3911, 0x3911, 0x38f0, 0x30f0, 0x3110, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x00f9, 0x0119, 0x0119, 0x0139, 0x0119, 0x011a, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0xd315, 0xd315, 0xd314, 0xc5fb, 0xc79f, 0xc79e, 0xc7bf, 0xc7bf, 0xc79e, 0xc79e, 0xc7bf, 0xc79f, 0xbf9e, 0xbfbf, 0xbfbe, 0xb67c, 0x8a53, 0x8971, 0xa131, 0xa112, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa112, 0xa111, 0xa111, 0xa172, 0xb539, 0xbf9f, 0x9bf6, 0x8191, 0x9151, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa112, 0xa111, 0xa111, 0xab15, 0xbf3d, 0xc79f, 0xc7be, 0xc79f, 0xc79f, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79e, 0xc79f, 0xc79e, 0xc79f, 0xc79e, 0xc79e, 0xc7bf, 0xc79f, 0xa4b8, 0x8191, 0x9151, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa112, 0xa111, 0xbdfb, 0xc79f, 0xc79e, 0xc7be, 0xc79f, 0xacf9, 0x8191, 0x9171, 0xa111, 0xa111, 0xa111, 0xa112, 0xa111, 0xa131, 0xa111, 0xbf3e, 0xbfbf, 0xc79e, 0xc79e, 0xc79e, 0xc7bf, 0xc79e, 0xc79e, 0xc79e, 0xbfbf, 0xc79e, 0xc79e, 0xc79e, 0xbf9e, 0xc79f, 0xc79e, 0xbfbe, 0xc79e, 0xc6bd, 0xd355, 0xd2f5, 0xd315, 0xcb14, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd314, 0xd315, 0xd315, 0xd315, 0xd314, 0x007f, 0x007f, 0x00ff, 0x027f, 0x039f, 0x039f, 0x037f, 0x231d, 0x5259, 0x5a3a, 0x033f, 0x033f, 0x031f, 0x031f, 0x0699, 0x07f8, 0x07fa, 0x07fd, 0x07ff, 0x07ff, 0x363c, 0xb0d1, 0xb0f1, 0xb0d1, 0xb8d1, 0xb0d1, 0xb0d1, 0x4112, 0x38f1, 0x3911, 0x30f0, 0x30ef, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ae, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x20ad, 0x0915, 0x00f9, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20cd, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xd2f4, 0xcaf4, 0xd2f4, 0xc65c, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf7f, 0xb67c, 0x8a12, 0x8971, 0xa111, 0xa111, 0xa911, 0xa111, 0xa911, 0xa111, 0xa111, 0xa111, 0xa911, 0xa911, 0xa111, 0xa111, 0xa111, 0xa911, 0xa111, 0xa111, 0xa111, 0xa912, 0xa911, 0xa1f3, 0x8191, 0x9931, 0xa111, 0xa111, 0xa912, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa911, 0xa911, 0xa911, 0xa911, 0xa911, 0xa111, 0xa111, 0xa111, 0xa112, 0xa911, 0xaa54, 0xbf1d, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xb79e, 0xbf9f, 0xa498, 0x8191, 0x9951, 0xa911, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa911, 0xb5fb, 0xbf9e, 0xbf9f, 0xbf9e, 0xbf9f, 0xa498, 0x8191, 0x9951, 0xa111, 0xa111, 0xa111, 0xa111, 0xa112, 0xa111, 0xa911, 0xb5fb, 0xbf7e, 0xbf9e, 0xbf9e, 0xbf9f, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbf9e, 0xbebd, 0xd335, 0xcaf4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xcaf4, 0xd2f4, 0xd2f5, 0xcaf4, 0x007f, 0x007f, 0x00bf, 0x021f, 0x2abd, 0x7a36, 0xb953, 0xc112, 0xc911, 0xc912, 0x0b3f, 0x035f, 0x035f, 0x033f, 0x05fa, 0x07f7, 0x07f9, 0x07fc, 0x07fe, 0x07ff, 0x2e3c, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0d1, 0xb0d1, 0xa0f1, 0x68f1, 0x4111, 0x30f0, 0x30f0, 0x28ef, 0x28ef, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ae, 0x18ae, 0x08f5, 0x0119, 0x0119, 0x08f5, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xd2d4, 0xd2d4, 0xd2d4, 0xbe5c, 0xb77e, 0xb79e, 0xb77e, 0xbf7e, 0xb77e, 0xb77e, 0xb77e, 0xb79e, 0xbf7e, 0xae7b, 0x89f2, 0x8971, 0xa111, 0xa8f1, 0xa911, 0xa8f1, 0xa911, 0xa911, 0xa911, 0xa911, 0xa911, 0xa8f1, 0xa911, 0xa911, 0xa911, 0xa8f1, 0xa911, 0xa8f1, 0xa911, 0xa911, 0xa912, 0xa911, 0xa911, 0xa111, 0xa911, 0xa8f1, 0xa911, 0xa8f1, 0xa111, 0xa911, 0xa8f1, 0xa8f1, 0xa911, 0xa911, 0xa8f1, 0xa911, 0xa8f1, 0xa8f1, 0xa912, 0xa911, 0xa911, 0xa911, 0xa8f1, 0xa111, 0xaa34, 0xb71e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xbf7e, 0xb77e, 0xb77e, 0xbf7e, 0xb77e, 0xb77e, 0xbf7f, 0xb77e, 0x9c97, 0x8191, 0x9951, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa911, 0xa8f1, 0xb5db, 0xbf7e, 0xb77e, 0xbf7e, 0xbf7e, 0xa478, 0x8191, 0x9951, 0xa911, 0xa8f1, 0xa8f1, 0xa911, 0xa911, 0xa8f1, 0xa911, 0xb5db, 0xb77f, 0xb77e, 0xbf7e, 0xbf7e, 0xb77e, 0xbf7e, 0xbf7e, 0xbf7e, 0xb77e, 0xb77e, 0xbf7e, 0xb77e, 0xbf7e, 0xb77e, 0xbf7e, 0xbf7e, 0xb77e, 0xb77e, 0xbf7e, 0xbe9d, 0xcb75, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2d5, 0x007f, 0x007f, 0x30bb, 0x9955, 0xc931, 0xc932, 0xc932, 0xc912, 0xc0f2, 0xc8f2, 0x32fc, 0x037f, 0x037f, 0x037f, 0x059b, 0x07f7, 0x07f9, 0x07fc, 0x07fe, 0x07ff, 0x2e3c, 0xb8d1, 0xb0d1, 0xb0d2, 0xb0d1, 0xb0f1, 0x98f1, 0xb0f1, 0x88f1, 0x3110, 0x30f0, 0x30f0, 0x28cf, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xd2b4, 0xd2b4, 0xd2b4, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb71d, 0x8a53, 0x8191, 0xa111, 0xa8f1, 0xb0f1, 0xa911, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f2, 0xa8f1, 0xb0f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xb2f5, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb75e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb75e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb75e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0x9c78, 0x8191, 0x9951, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xb5db, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0x9c77, 0x8191, 0x9151, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xb5db, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb77e, 0xb75e, 0xb71d, 0xcb96, 0xd2b4, 0xd2b4, 0xcab4, 0xd2b4, 0xcab4, 0xd2b4, 0xcab4, 0xd2b4, 0xcab4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xca94, 0xd2b4, 0xd2b4, 0xd2b4, 0xcab4, 0x087e, 0x70f8, 0xc952, 0xc932, 0xc912, 0xc932, 0xc111, 0xc8f1, 0xc8f1, 0xc8d1, 0x331c, 0x03bf, 0x039f, 0x039f, 0x051b, 0x07d6, 0x07f7, 0x07fb, 0x07fe, 0x07ff, 0x2e3c, 0xb8d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xa0f1, 0xb0f1, 0xb0d1, 0x50f0, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xd294, 0xd294, 0xca94, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xb75e, 0x9416, 0x8991, 0x9951, 0xb0f1, 0xa8f1, 0xb0f1, 0xa8f1, 0xb0f1, 0xa8f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xa8f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xa8f1, 0xa8f1, 0xb0f1, 0xa8f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0f2, 0xa8f1, 0xb0f1, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0f2, 0xa8f1, 0xb0f2, 0xb0f1, 0xb0f1, 0xb0f1, 0xa8f1, 0xb0f1, 0xb0f1, 0xacf9, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf7e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xb75e, 0xb75e, 0xaf5e, 0xb75e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xb75e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5d, 0xb75e, 0xaf5e, 0xaf5e, 0x9c77, 0x8191, 0x9951, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xadbb, 0xb75e, 0xb75e, 0xb75e, 0xb75e, 0x9c78, 0x8991, 0x9951, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb5bb, 0xb75e, 0xb75e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf5e, 0xb75e, 0xb75e, 0xb75e, 0xaf5e, 0xb75e, 0xb75e, 0xb75e, 0xaf5e, 0xaf5e, 0xb75e, 0xaf5e, 0xaf1d, 0xcb75, 0xca93, 0xd294, 0xca74, 0xca94, 0xca74, 0xd274, 0xca74, 0xd294, 0xca94, 0xca94, 0xca94, 0xca94, 0xca94, 0xca94, 0xca94, 0xca94, 0xd294, 0xca93, 0xca94, 0xd293, 0xca74, 0x9915, 0xc932, 0xc932, 0xc932, 0xc912, 0xc111, 0xc8f2, 0xc0f2, 0xc8d1, 0xc8d1, 0x333c, 0x03ff, 0x03df, 0x03bf, 0x04dc, 0x07d6, 0x07f7, 0x07fb, 0x07fe, 0x07ff, 0x2e3c, 0xb0d1, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0f1, 0xa8f1, 0xb0f1, 0xb0f1, 0x90f1, 0x30f0, 0x28f0, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xd274, 0xd274, 0xca53, 0xaf5e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3d, 0xaf5d, 0xaf3d, 0xaf3e, 0xa69c, 0x8191, 0x8191, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0d1, 0xb0f2, 0xb0d1, 0xb0d1, 0xb0f2, 0xb0f1, 0xb0f1, 0xaa13, 0xb418, 0xa438, 0x9ab4, 0x9931, 0xa8f1, 0xb0f1, 0xb0f2, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xaa74, 0xac78, 0xacf9, 0x9b35, 0x9931, 0xa8f1, 0xb0f1, 0xb0f2, 0xb0f1, 0xb0d1, 0xb0d1, 0xb0f1, 0xb0f2, 0xb0d1, 0xb0f1, 0xa9b3, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3d, 0xaf3d, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3d, 0xaf3d, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3d, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0x9c77, 0x8191, 0x9931, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xadbb, 0xaf3e, 0xaf3e, 0xaf5d, 0xaf3e, 0x9477, 0x8191, 0x9951, 0xb0d1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xadba, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3d, 0xaf5e, 0xaf5e, 0xaf5e, 0xaf3d, 0xaf3d, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf5e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaf3e, 0xaefd, 0xcb56, 0xca53, 0xca74, 0xd253, 0xd274, 0xd274, 0xd273, 0xca73, 0xd274, 0xd274, 0xd274, 0xd274, 0xd274, 0xd274, 0xd274, 0xd274, 0xd254, 0xca74, 0xca54, 0xca54, 0xca74, 0xc932, 0xc932, 0xc932, 0xc912, 0xc912, 0xc912, 0xc0f1, 0xc8d1, 0xc8d1, 0xc8d1, 0x335c, 0x041f, 0x03ff, 0x03ff, 0x047d, 0x0795, 0x07f6, 0x07fa, 0x07fe, 0x07ff, 0x2e3c, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0f1, 0xa8f1, 0xb0f1, 0xb0d1, 0xb0f1, 0x40f0, 0x28cf, 0x28ef, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xca53, 0xca53, 0xca53, 0xa73e, 0xa73e, 0xa73e, 0xa73e, 0xa73d, 0xa73d, 0xa73d, 0xa73d, 0x9457, 0x8191, 0x9931, 0xb8d1, 0xb0d1, 0xb8d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb1b3, 0xad9a, 0xaf3d, 0xaf3d, 0xa73d, 0xa73d, 0x9dda, 0x89d1, 0x9951, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0f1, 0xb213, 0xad9b, 0xa73e, 0xa73d, 0xaf3e, 0xaf3e, 0x9dda, 0x81f2, 0x9171, 0xb0f1, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0d1, 0xb8d1, 0xb8d2, 0xb0f1, 0xad39, 0xa73d, 0xa73e, 0xa73d, 0xa73d, 0xa73d, 0xa73d, 0xa73d, 0xa73e, 0xa73d, 0xa73d, 0xa73d, 0xaf3d, 0xa73d, 0xa73d, 0xa73d, 0xa73e, 0xa73e, 0xa73d, 0xaf3d, 0xa73d, 0xa73d, 0xa73e, 0xaf3d, 0xa73e, 0xa73e, 0xa73d, 0xaf3d, 0xa73d, 0xa73d, 0xa73e, 0xaf3e, 0xaf1e, 0xa73e, 0xa73e, 0xa73e, 0xa73e, 0xa73e, 0xa73e, 0xa73e, 0xa73e, 0xaf3e, 0xa73e, 0xa73d, 0xaf3e, 0xa73e, 0xa73d, 0xa73d, 0xa73d, 0xaf3d, 0xa73e, 0xa73e, 0xa73e, 0xa73d, 0xaf3d, 0xa73d, 0xaf3d, 0xa73e, 0xa73e, 0xaf3d, 0xa73e, 0xa73d, 0xa73d, 0xa73e, 0x9478, 0x8191, 0x9931, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb8d1, 0xad9a, 0xa73e, 0xa73d, 0xa73e, 0xa73d, 0xa73d, 0xa73d, 0xaf3d, 0xa73d, 0xa73d, 0xa73d, 0xa73d, 0xa73d, 0xaf3d, 0xa73d, 0xa73d, 0xa73d, 0xaf3e, 0xa73e, 0xa73d, 0xa73d, 0xa73d, 0xaf3d, 0xaf3e, 0xa73d, 0xaf3d, 0xaf3e, 0xa73d, 0xa73d, 0xaf3d, 0xa73e, 0xaf3d, 0xaf3d, 0xaf3d, 0xa73e, 0xa73d, 0xa73d, 0xaf3d, 0xa73d, 0xaedd, 0xc376, 0xca53, 0xca53, 0xca53, 0xca53, 0xca33, 0xca53, 0xca53, 0xca53, 0xca53, 0xca53, 0xca53, 0xca53, 0xca53, 0xca53, 0xd233, 0xca53, 0xd253, 0xca53, 0xca53, 0x309c, 0x005f, 0x58b9, 0xc912, 0xc111, 0xc8f1, 0xc8d1, 0xc8d1, 0xc0d1, 0xc0d1, 0x337c, 0x045f, 0x041f, 0x041f, 0x045e, 0x0775, 0x07f5, 0x07fa, 0x07fe, 0x07ff, 0x2e3c, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0d1, 0xb0f1, 0xa8f1, 0xb0f1, 0xb0f1, 0xb0d1, 0x80f1, 0x28ef, 0x28cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xca13, 0xca33, 0xca13, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa73d, 0xa73d, 0x8a53, 0x8191, 0xa8f1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb213, 0xa6bd, 0xa71d, 0xa73e, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0x9e1b, 0x81f1, 0x9171, 0xb0f1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb1f3, 0xa6bd, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa71d, 0x9e1b, 0x89f2, 0x8991, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb8d1, 0xb336, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa73d, 0xa73d, 0xa71d, 0xa71d, 0xa73d, 0xa71d, 0xa71e, 0xa71d, 0xa71d, 0xa73d, 0xa73e, 0xa71d, 0xa71d, 0xa71d, 0xa73e, 0xa71d, 0xa73e, 0xa73d, 0xa71d, 0xa71d, 0xa73d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa73d, 0xa73d, 0xa73e, 0xa71d, 0xa73d, 0xa73d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa71d, 0xa71d, 0xa73e, 0xa73d, 0xa73d, 0xa71d, 0xa71d, 0x9477, 0x8191, 0x9931, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xa59a, 0xa71d, 0xa73d, 0xa73e, 0xa71d, 0xa71d, 0xa71e, 0xa73d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa73d, 0xa71e, 0xa71d, 0xa73d, 0xa71d, 0xa73d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa73d, 0xa73d, 0xa71d, 0xa73d, 0xa73d, 0xa71d, 0xa73e, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xa71d, 0xbbf7, 0xca13, 0xca33, 0xca13, 0xca33, 0xca33, 0xca33, 0xca33, 0xca33, 0xca33, 0xca33, 0xca33, 0xca33, 0xca33, 0xca13, 0xca13, 0xca14, 0xd233, 0xca33, 0x003f, 0x003f, 0x005f, 0x78d7, 0xc0f2, 0xc8f1, 0xc0d1, 0xc0d1, 0xc0d1, 0xc8b1, 0x4b1a, 0x047f, 0x045f, 0x043f, 0x045f, 0x0735, 0x07f4, 0x07f9, 0x07fe, 0x07ff, 0x2e3c, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0d1, 0xb0d1, 0xa8f1, 0xb0f1, 0xb0d1, 0xb0f1, 0xa0f1, 0x28cf, 0x28ef, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x18ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xca13, 0xca13, 0xca13, 0x9f1d, 0x9f1d, 0xa71d, 0x9f1d, 0x9f1d, 0xa71d, 0x9f1d, 0x9f1d, 0x8191, 0x8191, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xa5db, 0x9f1d, 0x9f1d, 0x9efd, 0x9f1d, 0x9f1d, 0x9f1d, 0xa6fd, 0x9f1d, 0x94f9, 0x8191, 0x9931, 0xb8d1, 0xb8d1, 0xb8b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8b1, 0xa5db, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0xa6fd, 0x9f1d, 0x9f1d, 0x9f1d, 0x94f9, 0x8191, 0x9931, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb932, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1e, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9e1b, 0x9457, 0x92d4, 0xa1f3, 0xa911, 0xb0f1, 0xb0f1, 0xa911, 0xb274, 0xb254, 0xb254, 0xabf7, 0xa5db, 0xa6fd, 0xa6fd, 0xa71d, 0xa71d, 0x9f1d, 0x9f1d, 0xa6fd, 0x9f1d, 0x9f1d, 0xa71d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9e7c, 0x9498, 0x8b14, 0x9a13, 0xa131, 0xa912, 0xb0f1, 0xa8f1, 0xb255, 0xb274, 0xb254, 0xab97, 0xad1a, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0xa71d, 0x9f1d, 0xa71d, 0x9457, 0x8191, 0xa131, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xa57a, 0x9f1d, 0xa71d, 0x9f1d, 0xa71d, 0x9e7c, 0x9dba, 0xa59a, 0xa57a, 0xa57a, 0xa57a, 0xa57a, 0xa57a, 0xa57a, 0xa57a, 0xa69c, 0x9f1d, 0x9f1d, 0x9f1d, 0xa71d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9f1d, 0x9e5c, 0x94b8, 0x8af4, 0x9a13, 0xa131, 0xa8f1, 0xb0f1, 0xb0f1, 0xb932, 0xb274, 0xb254, 0xb336, 0xacb9, 0xa63c, 0x9f1d, 0xbbf7, 0xc9f3, 0xca13, 0xca13, 0xca13, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xca13, 0xca13, 0xca13, 0xca13, 0xca13, 0x003f, 0x003f, 0x005f, 0x58b9, 0xc0f1, 0xc0d1, 0xc8d1, 0xc8b2, 0xc0b1, 0xc0b1, 0x62b8, 0x04bf, 0x047f, 0x047f, 0x045f, 0x0715, 0x07f4, 0x07f9, 0x07fd, 0x07ff, 0x2e3c, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0d1, 0xa8f1, 0xa8f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0x58f0, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xc9d3, 0xc9d3, 0xc9d3, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x959a, 0x8191, 0x9151, 0xc0b1, 0xb8d1, 0xc0b1, 0xb8d1, 0xc0d1, 0xb8d1, 0xb8d1, 0xb2b5, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x8252, 0x8191, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xc0b1, 0xc0d1, 0xb8d1, 0xc0d1, 0xb1f3, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9f1d, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x8a93, 0x8191, 0xb8d1, 0xb8d1, 0xc0d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xc0b1, 0xa63c, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x94f8, 0x8a53, 0x9171, 0xb0f1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8b1, 0xb8b1, 0xc0b1, 0xc0d1, 0xc0d1, 0xb8d1, 0xc0d1, 0xb8b1, 0xb992, 0xacb9, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9e5c, 0x8b96, 0x8991, 0xa131, 0xb8d1, 0xb8d1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xc0b1, 0xb8d1, 0xb932, 0xabf7, 0x9e9c, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9437, 0x8191, 0xa131, 0xb8d1, 0xc0b1, 0xb8d1, 0xc0b1, 0xc0b1, 0xb8d1, 0xb8d1, 0xa57a, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9437, 0x8191, 0xa131, 0xb8d1, 0xc0b1, 0xb8d1, 0xb8d1, 0xc0b1, 0xb8d1, 0xb8d1, 0xa57a, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9efd, 0x9e9c, 0x8b96, 0x8971, 0xa131, 0xb8d1, 0xb8d1, 0xc0b1, 0xb8d1, 0xc0b1, 0xc0d1, 0xb8d1, 0xb8d1, 0xc0d1, 0xb8d1, 0xb8d1, 0xc0d1, 0xb335, 0xa63c, 0xbbd7, 0xc9d3, 0xc9f3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9f3, 0xc9d3, 0xc9d3, 0xc9f3, 0xc9d3, 0x001f, 0x003f, 0x003f, 0x00df, 0x88f6, 0xc8d1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc8b1, 0x62d9, 0x04ff, 0x04bf, 0x049f, 0x047f, 0x06b6, 0x07f3, 0x07f8, 0x07fd, 0x07ff, 0x2e3c, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0f1, 0x98f2, 0xb0f1, 0xb0f1, 0xb0f1, 0x78f0, 0x90f1, 0x80d1, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0xc9b3, 0xc9b3, 0xc9b3, 0x9edd, 0x96fd, 0x9edd, 0x96fd, 0x9efc, 0x96fd, 0x96fd, 0x9599, 0x8991, 0x9171, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xabd7, 0x9efc, 0x96fd, 0x96fd, 0x96dd, 0x96fd, 0x9efd, 0x9edd, 0x96fd, 0x9edd, 0x9efd, 0x8c37, 0x8191, 0xa111, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xab76, 0x9edd, 0x9efd, 0x9efd, 0x9edd, 0x9edd, 0x96dd, 0x9efd, 0x9edd, 0x96fd, 0x9edd, 0x8c37, 0x8191, 0xa131, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0d1, 0xa55a, 0x96fd, 0x9edd, 0x9efd, 0x96fd, 0x963b, 0x8af4, 0x8991, 0xa911, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xb992, 0xa55a, 0x9edd, 0x9efc, 0x96fd, 0x9edd, 0x96fd, 0x9efd, 0x96fd, 0x96fd, 0x96fd, 0x96fd, 0x96fd, 0x96fd, 0x96fd, 0x96fd, 0x94f9, 0x81f1, 0x9171, 0xb8d2, 0xc0b1, 0xc0d1, 0xc0d1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xb992, 0x9dbb, 0x96fd, 0x9edd, 0x96fd, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xa55a, 0x9edd, 0x96fd, 0x96fd, 0x9efd, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xa55a, 0x96fd, 0x9efd, 0x96fd, 0x9efd, 0x9efd, 0x96fd, 0x9efd, 0x96fd, 0x9539, 0x81f1, 0x9171, 0xb0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xb8d1, 0xb911, 0xacfa, 0xb458, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9d2, 0xc9d3, 0xc9d3, 0xc9b3, 0x001f, 0x003f, 0x003f, 0x00bf, 0x311c, 0xc0d1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x6278, 0x053f, 0x04ff, 0x04bf, 0x049f, 0x0696, 0x07f2, 0x07f7, 0x07fc, 0x07ff, 0x2e3c, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0f1, 0x8912, 0xb0f1, 0xb0f1, 0xb0d1, 0x48f0, 0x28f0, 0x28ef, 0x28cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xc993, 0xc993, 0xc992, 0x96dc, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x8d79, 0x8191, 0x9151, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xabd7, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xabd7, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x9d5a, 0x96dd, 0x96dd, 0x96dd, 0x95da, 0x89f2, 0x8971, 0xb8d1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xa499, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dc, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x8c37, 0x8191, 0x9931, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xa499, 0x96dc, 0x96dd, 0x8c37, 0x8191, 0xa111, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x9d5a, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x9d5a, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x96dd, 0x8cd8, 0x8191, 0x9951, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xac79, 0xacf9, 0xc992, 0xc993, 0xc9b2, 0xc992, 0xc992, 0xc993, 0xc993, 0xc993, 0xc992, 0xc992, 0xc992, 0xc993, 0xc993, 0xc993, 0x003f, 0x003f, 0x003f, 0x00bf, 0x011f, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x79d6, 0x051f, 0x051f, 0x04ff, 0x04bf, 0x0638, 0x07f1, 0x07f7, 0x07fc, 0x07ff, 0x2e3c, 0xb0f1, 0xb0f2, 0xb0f1, 0xb0f1, 0x80f2, 0xb0f1, 0xb0f1, 0xb0f2, 0x3110, 0x30f0, 0x28cf, 0x28ef, 0x20ce, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0x18ad, 0x10d2, 0x08f3, 0x10f3, 0x10d2, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xc972, 0xc972, 0xc972, 0x8ebc, 0x8ebd, 0x8ebd, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebd, 0x8d7a, 0x8191, 0x9151, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xabb7, 0x8ebd, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebd, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xabb7, 0x8ebc, 0x8ebc, 0x8ebc, 0x8edc, 0x8ebc, 0x8edd, 0x8ebc, 0x8ebc, 0x8ebd, 0x8ebc, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x9d39, 0x8ebd, 0x8edd, 0x8dba, 0x81f2, 0x9171, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc8b1, 0xc8b2, 0xc0b1, 0xc8b2, 0xc8b1, 0xc8b1, 0xc0d1, 0xc0b1, 0xc0d1, 0xc0d1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xa437, 0x8ebc, 0x8edd, 0x8ebc, 0x8ebd, 0x8ebc, 0x8ebc, 0x8ebd, 0x8ebc, 0x8ebd, 0x8ebd, 0x8cd8, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc8b2, 0xc8b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc8b1, 0xa4d9, 0x8ebc, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc8b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0x9d3a, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8c37, 0x8191, 0xa131, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x9d5a, 0x8ebc, 0x8ebc, 0x8edc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8cd8, 0x8191, 0x9951, 0xc8b1, 0xc0b1, 0xc8b1, 0xc8b2, 0xc8b1, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc8b1, 0xc8b1, 0xc8d1, 0xa478, 0xa4d9, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0xc972, 0x003f, 0x003f, 0x001f, 0x009f, 0x00df, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x9174, 0x049f, 0x057f, 0x051f, 0x04ff, 0x0619, 0x07f1, 0x07f6, 0x07fc, 0x07ff, 0x35bb, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0f1, 0x6912, 0xb0f1, 0xb0f1, 0x98f1, 0x30f0, 0x30f0, 0x28ef, 0x28cf, 0x28ef, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x011a, 0x00fa, 0x011a, 0x0119, 0x08f7, 0x18ce, 0x18ad, 0x20ad, 0x18ae, 0x18ae, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0xc952, 0xc952, 0xc952, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8d59, 0x8191, 0x9171, 0xc8f2, 0xc8f1, 0xc8f2, 0xc8f2, 0xc8f2, 0xc8f1, 0xc8f2, 0xabd7, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8c36, 0x8191, 0xa931, 0xc8f2, 0xc8f1, 0xc8f2, 0xc8f2, 0xc8f2, 0xc8f2, 0xc0f2, 0xabb7, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8437, 0x8191, 0xa951, 0xc8f1, 0xc8f1, 0xc8f2, 0xc8f1, 0xc8f1, 0xc8f2, 0xc8f1, 0x9d3a, 0x8ebc, 0x8e1b, 0x81f2, 0x8971, 0xb912, 0xc8f1, 0xc8f1, 0xc8f2, 0xc8f1, 0xc8f1, 0xc8f1, 0xc8f2, 0xc8d1, 0xc112, 0xc8f2, 0xc8f2, 0xc8f2, 0xc8d1, 0xc8f2, 0xc8d1, 0xc8f2, 0xc0f1, 0xc8f1, 0xc8f2, 0xc8f1, 0xc8f2, 0xc0f1, 0xa498, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8dba, 0x8991, 0x8991, 0xc0f1, 0xc8f2, 0xc0f2, 0xc8f1, 0xc8f2, 0xc8f1, 0xc0f1, 0xc8f2, 0xc8f1, 0xc8f2, 0xc0f2, 0xc8f1, 0xc0f1, 0xc8f2, 0xc8f1, 0xc8f2, 0xc8f2, 0xc8f2, 0xc8f1, 0xc8f1, 0xc0f2, 0xc132, 0x8e5c, 0x8c17, 0x8191, 0xa931, 0xc8f2, 0xc8f2, 0xc8f2, 0xc8f2, 0xc8f1, 0xc8f2, 0xc8f2, 0x9d59, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8c17, 0x8191, 0xa951, 0xc8f1, 0xc8f1, 0xc8f2, 0xc8f1, 0xc8f1, 0xc8f2, 0xc8f1, 0x9d5a, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebd, 0x8dba, 0x81f2, 0x8991, 0xc111, 0xc8f1, 0xc8f1, 0xc8f1, 0xc0f2, 0xc8f1, 0xc8f1, 0xc0f2, 0xc8d2, 0xc8f1, 0xc8f2, 0xc0f1, 0xc0f1, 0xc8f2, 0xc0f1, 0xc8f1, 0xc8f2, 0xc8f2, 0xc8f1, 0xc8f1, 0xc8f2, 0xc152, 0x95fb, 0xa4b8, 0xc152, 0xc952, 0xc952, 0xc952, 0xc972, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0x001f, 0x001f, 0x001f, 0x007f, 0x00df, 0x68b7, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xa8f3, 0x041f, 0x057f, 0x053f, 0x051f, 0x05f9, 0x07f0, 0x07f6, 0x07fc, 0x07ff, 0x5c78, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0f1, 0x5912, 0xb0f1, 0xb0f1, 0x90f1, 0x30f0, 0x30ef, 0x30ef, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ae, 0x20ce, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x08f5, 0x0119, 0x0119, 0x0117, 0x00f7, 0x0119, 0x0119, 0x08f5, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xc932, 0xc932, 0xc932, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8d79, 0x8191, 0x9171, 0xc132, 0xc131, 0xc912, 0xc912, 0xc132, 0xc911, 0xc912, 0xabf7, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x96bc, 0x8c36, 0x8191, 0xa951, 0xc912, 0xc911, 0xc912, 0xc912, 0xc112, 0xc912, 0xc912, 0xabf7, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8ebc, 0x8c36, 0x8191, 0xa951, 0xc912, 0xc912, 0xc912, 0xc911, 0xc911, 0xc912, 0xc912, 0x9d59, 0x8ebc, 0x8ad4, 0x8191, 0xb152, 0xc912, 0xc131, 0xc912, 0xc912, 0xc912, 0xc912, 0xc912, 0xc912, 0xc932, 0xc912, 0xc912, 0xc912, 0xc912, 0xc911, 0xc112, 0xc932, 0xc912, 0xc912, 0xc932, 0xc911, 0xc912, 0xc912, 0xc932, 0xc131, 0x9dba, 0x8ebc, 0x96bc, 0x8ebc, 0x8edc, 0x96bb, 0x8ebc, 0x8edc, 0x82d4, 0x8191, 0xb932, 0xc912, 0xc112, 0xc912, 0xc112, 0xc912, 0xc112, 0xc912, 0xc911, 0xc911, 0xc932, 0xc911, 0xc131, 0xc912, 0xc132, 0xc131, 0xc912, 0xc912, 0xc911, 0xc911, 0xc131, 0xc912, 0xc912, 0xb356, 0x8c36, 0x8191, 0xa151, 0xc912, 0xc912, 0xc912, 0xc912, 0xc912, 0xc912, 0xc112, 0x9d59, 0x8ebc, 0x96bc, 0x8ebc, 0x8ebc, 0x8c37, 0x8191, 0xa951, 0xc912, 0xc912, 0xc912, 0xc911, 0xc911, 0xc912, 0xc912, 0x9d59, 0x8ebc, 0x8ebc, 0x8ebc, 0x96bc, 0x8ebc, 0x82f4, 0x8991, 0xb151, 0xc912, 0xc912, 0xc932, 0xc912, 0xc912, 0xc131, 0xc932, 0xc912, 0xc911, 0xc911, 0xc932, 0xc911, 0xc912, 0xc911, 0xc932, 0xc932, 0xc112, 0xc911, 0xc132, 0xc912, 0xc912, 0xc932, 0xb336, 0x96bc, 0xa4f9, 0xc192, 0xc932, 0xc932, 0xc932, 0xc932, 0xc932, 0xc932, 0xc932, 0xc932, 0xc932, 0xc932, 0x001f, 0x001f, 0x001f, 0x007f, 0x00bf, 0x009f, 0x90b5, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x0b9e, 0x053f, 0x057f, 0x053f, 0x05da, 0x07ef, 0x07f5, 0x07fb, 0x07ff, 0x5478, 0xb0d1, 0xb0f1, 0xb0f1, 0x9111, 0x5912, 0xa8f1, 0xb0f1, 0x70f1, 0x30f0, 0x28ef, 0x20ef, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x0119, 0x0119, 0x08f3, 0x18ad, 0x18ad, 0x08f3, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xc912, 0xc912, 0xc912, 0x9edb, 0x9edb, 0x9edb, 0x9edc, 0x9edb, 0x9edb, 0x9edb, 0x9578, 0x8191, 0x9991, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xb417, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9436, 0x8191, 0xa972, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xa518, 0x9edb, 0x96db, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9436, 0x8191, 0xa171, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xa579, 0x94d8, 0x8191, 0x9991, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc152, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc253, 0xc2b4, 0xb952, 0xc152, 0xc952, 0xc152, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xbab5, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x9599, 0x8191, 0x91b1, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc1f3, 0xc2b5, 0xb952, 0xc152, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc972, 0xc952, 0xc952, 0xc972, 0xc1b2, 0x9436, 0x8191, 0xa972, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xa579, 0x9edb, 0x9edb, 0x9edb, 0x9edb, 0x8c36, 0x8991, 0xa171, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xa579, 0x9edb, 0x9edc, 0x9edb, 0x9edb, 0x9598, 0x8191, 0x9191, 0xc952, 0xc952, 0xc952, 0xc952, 0xc152, 0xc952, 0xc172, 0xc952, 0xc952, 0xc952, 0xc1f3, 0xc2b4, 0xb952, 0xc152, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xc952, 0xa61a, 0x9edc, 0xa5da, 0xc172, 0xc912, 0xc911, 0xc911, 0xc912, 0xc912, 0xc111, 0xc912, 0xc912, 0xc912, 0x001f, 0x001f, 0x001f, 0x005f, 0x007f, 0x007f, 0x6098, 0xc0b1, 0xb8b1, 0xc0b1, 0xc0b1, 0x2afc, 0x04ff, 0x05bf, 0x055f, 0x05fb, 0x07cf, 0x07f4, 0x07fc, 0x07ff, 0x5c79, 0xb0f1, 0xb0f1, 0xb0f1, 0x8112, 0x5912, 0xb0f1, 0xb0f1, 0x68f1, 0x30f0, 0x30ef, 0x30cf, 0x28cf, 0x20cf, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f9, 0x18d0, 0x18ad, 0x18ad, 0x10d0, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xc8f1, 0xc8f1, 0xc8f2, 0xa6fb, 0xa6fa, 0xa6fa, 0xa6fb, 0xa6fa, 0xa6da, 0xa6fa, 0x9d98, 0x8191, 0x9191, 0xc972, 0xc992, 0xc992, 0xc972, 0xc992, 0xc992, 0xc992, 0xb436, 0xa6fb, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0x9436, 0x8191, 0xa992, 0xc992, 0xc992, 0xc972, 0xc972, 0xc972, 0xc992, 0xc992, 0xad98, 0xa6da, 0xa6da, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0xa6fa, 0x9436, 0x8191, 0xa992, 0xc993, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xad99, 0x8a32, 0x8991, 0xc192, 0xc992, 0xc992, 0xc972, 0xc992, 0xc992, 0xc973, 0xc992, 0xc992, 0xc992, 0xbc36, 0xa69a, 0xa6fa, 0xa6fa, 0xa69a, 0x9395, 0x8991, 0xb992, 0xc993, 0xc972, 0xc972, 0xc992, 0xc992, 0xc972, 0xc992, 0xc972, 0xc972, 0xad98, 0xa6db, 0xa6da, 0xa6fa, 0xa6fb, 0xa6fa, 0x9395, 0x8191, 0xb192, 0xc992, 0xc992, 0xc992, 0xc993, 0xc972, 0xc972, 0xc992, 0xc972, 0xc233, 0xad98, 0xa6fa, 0xa6fb, 0xa639, 0x8a93, 0x9992, 0xc192, 0xc972, 0xc992, 0xc992, 0xc992, 0xc972, 0xc992, 0xc972, 0xc972, 0x9a93, 0x8191, 0xa992, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xad98, 0xa6fa, 0xa6fb, 0xa6fa, 0xa6fa, 0x9436, 0x8191, 0xa992, 0xc993, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xad98, 0xa6da, 0xa6da, 0xa6fa, 0xa6da, 0x8b95, 0x8191, 0xb192, 0xc972, 0xc992, 0xc972, 0xc992, 0xc992, 0xc972, 0xc992, 0xc972, 0xc294, 0xadf9, 0xa6fa, 0xa6da, 0xa69a, 0x9334, 0x9191, 0xb992, 0xc992, 0xc993, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xc992, 0xb497, 0xaefb, 0xaefb, 0xb5d9, 0xc952, 0xc8f1, 0xc8f2, 0xc0f1, 0xc8f1, 0xc8f1, 0xc8f1, 0xc8f1, 0xc8f1, 0x001f, 0x001f, 0x001f, 0x003f, 0x007f, 0x005f, 0x7897, 0xc0b1, 0xc0d1, 0xc0b1, 0xb8d1, 0x6238, 0x04df, 0x05bf, 0x059f, 0x05fa, 0x07ce, 0x07f4, 0x07fc, 0x07ff, 0x5c78, 0xb0f1, 0xb0f1, 0xb0f1, 0x7112, 0x5912, 0xb0f1, 0xa8f1, 0x5110, 0x30f0, 0x30cf, 0x28cf, 0x28cf, 0x28cf, 0x20ae, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x011a, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x08f3, 0x18ad, 0x18ad, 0x08f3, 0x0119, 0x0119, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0xc0d1, 0xc0d1, 0xc8d2, 0xb71a, 0xb71a, 0xb71a, 0xaefa, 0xb71a, 0xaf1a, 0xaefa, 0xa598, 0x8191, 0x9191, 0xc9b3, 0xc9b3, 0xc9d3, 0xc9d3, 0xc9b2, 0xc9b3, 0xc9d3, 0xbc76, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0x9c55, 0x8191, 0xa9b2, 0xc9d3, 0xc9d3, 0xc9b3, 0xc9b2, 0xc9b3, 0xc9d3, 0xc9d3, 0xb5b8, 0xb71a, 0xaf1a, 0xb71a, 0xb6fa, 0xb71a, 0xb71a, 0xb71a, 0xb71a, 0xb6fa, 0xaf1a, 0x9c56, 0x8191, 0xa992, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xa3b5, 0x8191, 0x9992, 0xc9b2, 0xc9b3, 0xc9d2, 0xc9b2, 0xc9b3, 0xc9b2, 0xc9b3, 0xc9d3, 0xca13, 0xbdb8, 0xaefa, 0xaf1a, 0xb71a, 0xb6fa, 0xaefa, 0xaf19, 0xa4f7, 0x8991, 0xb1b2, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9d2, 0xc9b3, 0xc9b3, 0xc314, 0xaf1a, 0xaf1a, 0xaef9, 0xaf1a, 0xaf1a, 0x89f1, 0x8191, 0xc1b2, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b2, 0xc9b2, 0xc9d3, 0xc9b3, 0xcab4, 0xb6b9, 0xaf1a, 0xb71a, 0xaefa, 0xb71a, 0xb6b9, 0x8a93, 0x8991, 0xc1d2, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b2, 0xc9d3, 0xc9b2, 0xa992, 0x8191, 0xa9b2, 0xc9d3, 0xc9b3, 0xc9d3, 0xc9b2, 0xc9b2, 0xc9b2, 0xc9b3, 0xb5b8, 0xaf1a, 0xaefa, 0xaf1a, 0xb71a, 0x9c56, 0x8191, 0xa992, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xb5b8, 0xb6fa, 0xaf1a, 0xaf1a, 0xb6fa, 0x89f2, 0x8191, 0xc1b2, 0xc9b3, 0xc9b2, 0xc9d3, 0xc9b3, 0xc9b3, 0xc9b2, 0xc9d3, 0xcab4, 0xb6b9, 0xaf1a, 0xb71a, 0xb71a, 0xb6fa, 0xb71a, 0x92f3, 0x89b1, 0xc1b2, 0xc9d3, 0xc9b3, 0xc9b3, 0xc9d3, 0xc9d3, 0xc9b3, 0xc9d3, 0xc315, 0xb71a, 0xb71a, 0xb71a, 0xbdd9, 0xc132, 0xc0d1, 0xc8d1, 0xc8d1, 0xc8d1, 0xc8d1, 0xc0d1, 0xc0d1, 0x001f, 0x001f, 0x001f, 0x003f, 0x007f, 0x007f, 0x6878, 0xb8b1, 0xc0b1, 0xc0d1, 0xb8d1, 0x9954, 0x047f, 0x05bf, 0x05bf, 0x061a, 0x07ce, 0x07f2, 0x07fc, 0x07ff, 0x5c78, 0xb0f1, 0xb0f1, 0xb0f1, 0x6112, 0x5912, 0xa8f1, 0xa8f1, 0x60f0, 0x30f0, 0x28ef, 0x28cf, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x00f7, 0x0119, 0x00f7, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x08f5, 0x0119, 0x0119, 0x00f7, 0x00f7, 0x0119, 0x0119, 0x08f4, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0xc0b1, 0xc8b1, 0xc0b1, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xa4b5, 0x8191, 0xa1b2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xd1f3, 0xc496, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xa455, 0x8191, 0xa9d2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xbdd8, 0xbf19, 0xbf19, 0xbf19, 0xbf39, 0xbf19, 0xbf19, 0xbf39, 0xbf19, 0xbf39, 0xbf39, 0xa455, 0x8191, 0xa9d2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0x99f2, 0x8991, 0xb1d2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f2, 0xc577, 0xbf19, 0xbf39, 0xbf39, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0x9bf5, 0x8191, 0xb1d2, 0xc9f3, 0xc9f3, 0xd1f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xbe78, 0xbf19, 0xbf19, 0xbf19, 0xb6b9, 0x8191, 0x8991, 0xc9f3, 0xc9f3, 0xc9f2, 0xc9f3, 0xc9f3, 0xc9d3, 0xc9f3, 0xc9f3, 0xbed8, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0xbf39, 0xad57, 0x8191, 0x99b2, 0xc9f3, 0xc9f2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xb9d3, 0x8191, 0xa9b2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xbdd8, 0xbf19, 0xbf19, 0xbf19, 0xbf19, 0x9c75, 0x8191, 0xa9d2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xbdd8, 0xbf19, 0xbf19, 0xbf19, 0xb6b8, 0x8191, 0x8191, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xbe78, 0xbf19, 0xbf39, 0xbf19, 0xbf39, 0xbf19, 0xbf19, 0xadb7, 0x8191, 0x91b1, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f2, 0xc9f3, 0xc9f3, 0xc9f3, 0xc9f3, 0xc71a, 0xbf1a, 0xc73a, 0xbf3a, 0xc659, 0xc9d3, 0xc0b1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc8b1, 0xc0b1, 0x001f, 0x001f, 0x001f, 0x003f, 0x005f, 0x003f, 0x001f, 0x7076, 0xc0d1, 0xb8d1, 0xb8d1, 0xb8d1, 0x0bff, 0x05df, 0x05bf, 0x0639, 0x07cd, 0x07f2, 0x07fc, 0x07ff, 0x63f7, 0xb0f1, 0xb0f1, 0xb0f1, 0x4132, 0x4111, 0xa0f1, 0xb0f1, 0x90f1, 0x30f0, 0x28ef, 0x28ce, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x00f8, 0x10d0, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ce, 0x00f7, 0x0119, 0x0119, 0x0119, 0x0119, 0x00f7, 0x18ce, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18cd, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ae, 0xc0b1, 0xc0b1, 0xc0b1, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xa475, 0x8991, 0xa9d2, 0xca13, 0xca33, 0xca33, 0xca34, 0xca13, 0xca33, 0xca33, 0xccb6, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xa455, 0x8191, 0xa9d2, 0xca33, 0xca33, 0xca13, 0xca33, 0xca33, 0xca33, 0xd213, 0xc5f7, 0xc738, 0xc738, 0xc738, 0xc738, 0xc739, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xa475, 0x8191, 0xa9d2, 0xca13, 0xca33, 0xca33, 0xca33, 0xca33, 0xca13, 0xca33, 0x91b1, 0x8191, 0xca13, 0xca33, 0xca33, 0xca33, 0xca33, 0xca13, 0xca33, 0xca13, 0xc455, 0xc738, 0xc739, 0xc738, 0xc738, 0xc738, 0xc738, 0xc739, 0xc738, 0xc738, 0xc738, 0x8a52, 0x8991, 0xc213, 0xca13, 0xca13, 0xca13, 0xca13, 0xca33, 0xca13, 0xca33, 0xcd56, 0xc738, 0xc738, 0xc739, 0xb5d7, 0x8191, 0x91b1, 0xca13, 0xca13, 0xca13, 0xd233, 0xca33, 0xca33, 0xca33, 0xcb55, 0xcf38, 0xc738, 0xc738, 0xc738, 0xc738, 0xc738, 0xc739, 0xc738, 0x8191, 0x8191, 0xca13, 0xca13, 0xca13, 0xca33, 0xca13, 0xca33, 0xd233, 0xca13, 0x8191, 0xa9d2, 0xca33, 0xca33, 0xca13, 0xca13, 0xca33, 0xca13, 0xca33, 0xcdf7, 0xc738, 0xc738, 0xc738, 0xc739, 0xa475, 0x8191, 0xa9d2, 0xca13, 0xca33, 0xca33, 0xca33, 0xca33, 0xca13, 0xca33, 0xc5f7, 0xc738, 0xc738, 0xc738, 0xb5d6, 0x8191, 0x99b2, 0xca33, 0xca33, 0xd213, 0xca33, 0xca33, 0xca33, 0xca33, 0xcb74, 0xc739, 0xc738, 0xc738, 0xc738, 0xc738, 0xc739, 0xc738, 0xc738, 0x8ab2, 0x8191, 0xba13, 0xca13, 0xca13, 0xca33, 0xca13, 0xca33, 0xca33, 0xca13, 0xcf39, 0xc739, 0xc759, 0xcf3a, 0xcf39, 0xced9, 0xc9f3, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x003f, 0x001f, 0x001f, 0x9894, 0xb8d1, 0xb8d1, 0xb8d1, 0x42da, 0x059f, 0x05ff, 0x0678, 0x07cc, 0x07f1, 0x07fc, 0x07ff, 0x82b5, 0xa8f1, 0xb0f1, 0x98f2, 0x4132, 0x3912, 0x70f1, 0xa8f1, 0xa8f1, 0x50f0, 0x28cf, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x00f8, 0x10cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x10d2, 0x10d3, 0x08f3, 0x10d2, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0xc0b1, 0xc0b1, 0xc0b1, 0xcf57, 0xd758, 0xd758, 0xcf58, 0xd758, 0xcf58, 0xd758, 0xac74, 0x8191, 0xa9f2, 0xca53, 0xd253, 0xca54, 0xca53, 0xca53, 0xca53, 0xca54, 0xccd6, 0xcf58, 0xd758, 0xd758, 0xd758, 0xd758, 0xd758, 0xd758, 0xd758, 0xd758, 0xcf58, 0xac75, 0x8191, 0xa9f2, 0xca53, 0xca53, 0xd253, 0xca53, 0xca53, 0xca53, 0xd254, 0xce17, 0xcf57, 0xd758, 0xcf58, 0xd758, 0xcf58, 0xd758, 0xd758, 0xcf58, 0xd758, 0xcf58, 0xac74, 0x8191, 0xa9f2, 0xca53, 0xca54, 0xd253, 0xca53, 0xca53, 0xca54, 0xca53, 0x99d2, 0x89b1, 0xca53, 0xca53, 0xca53, 0xca53, 0xd253, 0xca53, 0xca53, 0xca54, 0xd6b7, 0xd758, 0xcf58, 0xcf57, 0xcf58, 0xd758, 0xd757, 0xd758, 0xd757, 0xd758, 0xcf58, 0xb535, 0x8191, 0xa1d2, 0xca53, 0xca53, 0xca53, 0xd254, 0xca73, 0xca53, 0xca53, 0xcc95, 0xd758, 0xd758, 0xcf58, 0xbdd6, 0x8191, 0x99d2, 0xca53, 0xca53, 0xca54, 0xca53, 0xca53, 0xd254, 0xca54, 0xd435, 0xd758, 0xd758, 0xcf58, 0xd758, 0xd758, 0xcf57, 0xd738, 0xcf58, 0x9af3, 0x8991, 0xc213, 0xca54, 0xca53, 0xca53, 0xd253, 0xca53, 0xca54, 0xca73, 0x8191, 0xa9f2, 0xca53, 0xd253, 0xd253, 0xca54, 0xd253, 0xca53, 0xca54, 0xce17, 0xcf58, 0xd758, 0xd758, 0xcf58, 0xac74, 0x8191, 0xa9f2, 0xca53, 0xca54, 0xd253, 0xca53, 0xca53, 0xca54, 0xca53, 0xd617, 0xd758, 0xcf58, 0xcf58, 0xbdd6, 0x8191, 0x91b2, 0xca53, 0xd254, 0xca53, 0xca53, 0xca54, 0xd253, 0xd253, 0xccd6, 0xd758, 0xd758, 0xd758, 0xd758, 0xcf57, 0xd757, 0xcf58, 0xd758, 0x9af3, 0x8191, 0xba33, 0xca54, 0xca53, 0xd253, 0xca54, 0xca53, 0xd253, 0xca53, 0xd758, 0xd758, 0xdf59, 0xd779, 0xd759, 0xd759, 0xd6f9, 0xc1f2, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x001f, 0x001f, 0x001f, 0x003f, 0x001f, 0x001f, 0x001f, 0x001f, 0x183e, 0xb0d2, 0xb8d1, 0xb8d1, 0x9974, 0x059f, 0x061f, 0x0698, 0x07cc, 0x07f0, 0x07fc, 0x07ff, 0x82b5, 0xb0f1, 0xb0f1, 0x88f1, 0x4132, 0x4111, 0x3910, 0x98f1, 0xa8f2, 0x88f1, 0x28ef, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x0119, 0x0118, 0x10d0, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0xc0b1, 0xc0b1, 0xc0b1, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xb494, 0x8191, 0xaa12, 0xca94, 0xca74, 0xca94, 0xca94, 0xca94, 0xca94, 0xd294, 0xd4f5, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xb474, 0x8191, 0xaa12, 0xca94, 0xca94, 0xd294, 0xca94, 0xd294, 0xca94, 0xd294, 0xde36, 0xdf77, 0xdf77, 0xdf57, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xb494, 0x8191, 0xaa12, 0xca94, 0xd294, 0xd294, 0xd294, 0xd294, 0xd294, 0xd294, 0x99d2, 0x91d2, 0xd294, 0xca94, 0xd294, 0xca94, 0xd294, 0xca94, 0xca94, 0xd3d4, 0xdf77, 0xdf77, 0xdf77, 0xdf76, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf57, 0xdf77, 0xdf77, 0x8191, 0x8992, 0xca94, 0xca94, 0xca94, 0xd294, 0xca94, 0xca93, 0xca94, 0xd3d5, 0xdf77, 0xdf77, 0xdf77, 0xc5f5, 0x8191, 0x99d2, 0xca94, 0xca94, 0xd273, 0xca94, 0xd294, 0xca94, 0xd294, 0xd515, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0x9b12, 0x8191, 0xba53, 0xca94, 0xca94, 0xd294, 0xca94, 0xca93, 0xd294, 0xca94, 0x8191, 0xaa12, 0xd294, 0xd294, 0xd294, 0xca94, 0xca94, 0xd294, 0xd294, 0xde36, 0xdf77, 0xdf77, 0xdf57, 0xdf77, 0xb474, 0x8191, 0xaa12, 0xca94, 0xd294, 0xd294, 0xd294, 0xd294, 0xd294, 0xd294, 0xde36, 0xdf77, 0xdf77, 0xdf77, 0xc5f5, 0x8191, 0x99d2, 0xd294, 0xca94, 0xca94, 0xd294, 0xca94, 0xca94, 0xca93, 0xd4f5, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0xdf77, 0x9b12, 0x8191, 0xba53, 0xd294, 0xca94, 0xca94, 0xd294, 0xca94, 0xd294, 0xca94, 0xdf78, 0xdf78, 0xdf78, 0xdf78, 0xdf78, 0xdf78, 0xe779, 0xdf19, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x385b, 0xb8d1, 0xb8d1, 0xb8d1, 0x2c3c, 0x061f, 0x06b7, 0x07cb, 0x07f0, 0x07fb, 0x07ff, 0xb0f1, 0xb0f1, 0xa8f1, 0x7912, 0x4132, 0x4111, 0x3911, 0x4110, 0xa0f1, 0xa8f1, 0x48ef, 0x28ce, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x0118, 0x10cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x208e, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xb8d1, 0xb8d1, 0xc0d1, 0xe776, 0xe796, 0xe797, 0xe797, 0xe796, 0xe796, 0xe796, 0xb494, 0x8191, 0xaa33, 0xd2b4, 0xd2b4, 0xd2b4, 0xcab4, 0xd2d4, 0xd2b4, 0xd2b4, 0xdd35, 0xe776, 0xe796, 0xe796, 0xe796, 0xe796, 0xe796, 0xe796, 0xe796, 0xe796, 0xe796, 0xb474, 0x8191, 0xaa33, 0xd2d4, 0xd2d4, 0xd2d4, 0xd2b4, 0xd2b4, 0xcad4, 0xd2d4, 0xe656, 0xef96, 0xe776, 0xe797, 0xe796, 0xe796, 0xe776, 0xe777, 0xe796, 0xe796, 0xe796, 0xb494, 0x8191, 0xaa33, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0x99d2, 0x99f2, 0xcab4, 0xd2b4, 0xd2d4, 0xd2b4, 0xd2b4, 0xcad4, 0xd2b4, 0xd3f5, 0xe777, 0xe797, 0xef97, 0xe796, 0xe796, 0xe776, 0xe777, 0xe796, 0xe796, 0xe796, 0xe777, 0xef97, 0x8191, 0x8191, 0xd2b4, 0xd2b4, 0xd2d4, 0xd2d4, 0xd2b4, 0xd2b4, 0xcad4, 0xd3d5, 0xe796, 0xe796, 0xe796, 0xce15, 0x8191, 0x99f2, 0xcad4, 0xd2b4, 0xd2d4, 0xd2b4, 0xd2b4, 0xcab4, 0xd2b4, 0xdd35, 0xe777, 0xef76, 0xe796, 0xe797, 0xe797, 0xe776, 0xe796, 0xe776, 0xc534, 0xb494, 0xcc15, 0xd3f5, 0xdbf4, 0xdbf4, 0xdbf5, 0xd3f5, 0xd3f4, 0xcb34, 0x8191, 0xaa32, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2d4, 0xd2b4, 0xcab4, 0xe656, 0xe776, 0xe796, 0xe796, 0xe776, 0xb494, 0x8191, 0xaa33, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xde56, 0xe796, 0xe796, 0xe796, 0xce15, 0x8191, 0x99f2, 0xd2b4, 0xd2b4, 0xd2d4, 0xd2b4, 0xd2d4, 0xcad4, 0xcad4, 0xdd15, 0xe796, 0xe796, 0xe776, 0xe796, 0xef96, 0xe796, 0xe796, 0xe796, 0x9b13, 0x8191, 0xba73, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xd2b4, 0xe797, 0xef97, 0xef77, 0xef97, 0xef78, 0xef98, 0xef98, 0xef98, 0xc992, 0xb8d1, 0xc0d1, 0xc0b1, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x7096, 0xb8d1, 0xb8d1, 0x8a35, 0x063f, 0x06d6, 0x07ea, 0x07f1, 0x07fc, 0x07ff, 0xa8f1, 0xa8f1, 0xa8f1, 0x6132, 0x4132, 0x4111, 0x38f1, 0x3110, 0x48f0, 0xa8f1, 0x98f1, 0x30cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x20ae, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x0118, 0x18d0, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xb8d1, 0xb8d1, 0xb8d1, 0xf796, 0xf7b6, 0xf796, 0xf795, 0xf795, 0xf796, 0xefb6, 0xbc93, 0x8191, 0xaa52, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2f5, 0xd2f5, 0xd2f4, 0xdd55, 0xf7b6, 0xf7b6, 0xf7b6, 0xf7b6, 0xf7b6, 0xf7b6, 0xf7b6, 0xf7b6, 0xf7b6, 0xefb6, 0xbc93, 0x8191, 0xaa53, 0xd2f5, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xe675, 0xf796, 0xf795, 0xf796, 0xf796, 0xf796, 0xf7b6, 0xf7b5, 0xf7b5, 0xef96, 0xf796, 0xbc93, 0x8191, 0xaa33, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0x99f2, 0x99f2, 0xd2f5, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2d4, 0xd2f4, 0xd2f4, 0xdc75, 0xf795, 0xf795, 0xf795, 0xf796, 0xf7b5, 0xf796, 0xf796, 0xf796, 0xf796, 0xefb6, 0xf7b5, 0xf796, 0x8191, 0x8991, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xdc15, 0xf796, 0xf796, 0xf796, 0xd615, 0x8191, 0x99f2, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f5, 0xd2f4, 0xd2f5, 0xe535, 0xf7b6, 0xf7b5, 0xf796, 0xefb6, 0xf796, 0xf795, 0xf7b6, 0xf796, 0xf7b6, 0xf795, 0xf796, 0xf796, 0xf795, 0xf7b6, 0xf795, 0xf7b6, 0xf796, 0xbc93, 0x8191, 0xaa53, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xee75, 0xf796, 0xf796, 0xf7b5, 0xf796, 0xbc93, 0x8191, 0xaa33, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xee75, 0xf796, 0xf7b5, 0xf795, 0xd634, 0x8191, 0x99f2, 0xd2f4, 0xd2f5, 0xd2f4, 0xd2f5, 0xd2f5, 0xd2f5, 0xd2d4, 0xe555, 0xf796, 0xf7b5, 0xf7b6, 0xf7b6, 0xf795, 0xf7b6, 0xf796, 0xf7b6, 0xa311, 0x8191, 0xba94, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xd2f4, 0xf796, 0xf796, 0xf797, 0xf797, 0xf797, 0xf7b7, 0xf798, 0xf798, 0xd273, 0xb8d1, 0xb8d1, 0xb8d1, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x98b4, 0xb8d1, 0xb8d1, 0x3c9b, 0x06f5, 0x07e9, 0x07f1, 0x07fd, 0x26bd, 0xb0f1, 0xb0f2, 0xb0f1, 0x4932, 0x4132, 0x4111, 0x3911, 0x3110, 0x30f0, 0x60f0, 0xa911, 0x70f0, 0x20ce, 0x20cf, 0x20ae, 0x20ce, 0x20ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x0117, 0x0119, 0x0118, 0x18d0, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xb8d1, 0xb8d1, 0xb8d1, 0xff94, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb4, 0xffb5, 0xc493, 0x8191, 0xaa53, 0xd315, 0xd335, 0xd335, 0xd335, 0xd334, 0xd315, 0xd335, 0xe575, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xc493, 0x8191, 0xaa53, 0xd335, 0xd335, 0xd314, 0xd315, 0xd335, 0xd335, 0xd335, 0xf675, 0xffb5, 0xffb4, 0xffb5, 0xffb5, 0xffb4, 0xffb4, 0xffb4, 0xffb5, 0xffb5, 0xff95, 0xc493, 0x8191, 0xaa53, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xd315, 0xd335, 0x99f2, 0x99f2, 0xd335, 0xd314, 0xd315, 0xd335, 0xd335, 0xd315, 0xd335, 0xdc54, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb4, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb4, 0xffb5, 0x8191, 0x8191, 0xd334, 0xd315, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xdc34, 0xffb4, 0xffb5, 0xffb5, 0xde34, 0x8191, 0x99f2, 0xd314, 0xd335, 0xd315, 0xd334, 0xd334, 0xd335, 0xd335, 0xe574, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xffb4, 0xffb4, 0xffb5, 0xffb4, 0xffb5, 0xffb5, 0xffb5, 0xffb4, 0xffb5, 0xffb5, 0xc4b3, 0x8191, 0xaa53, 0xd335, 0xd335, 0xd314, 0xd315, 0xd335, 0xd335, 0xd335, 0xedf5, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xc493, 0x8191, 0xaa53, 0xd335, 0xd335, 0xd335, 0xd335, 0xd315, 0xd315, 0xd335, 0xf694, 0xffb5, 0xffb5, 0xffb5, 0xde14, 0x8191, 0x99f2, 0xd335, 0xd335, 0xd314, 0xd334, 0xd314, 0xd334, 0xd315, 0xe555, 0xffb5, 0xffb5, 0xffb5, 0xffb4, 0xffb5, 0xffb5, 0xffb5, 0xffb5, 0xa332, 0x8191, 0xbab4, 0xd335, 0xd335, 0xd335, 0xd315, 0xd334, 0xd335, 0xd335, 0xffb5, 0xffb6, 0xffb6, 0xffb6, 0xffb6, 0xffb6, 0xffb7, 0xffb8, 0xdbd4, 0xb8d2, 0xb8d1, 0xb8d1, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x083f, 0x70f7, 0xb8d1, 0xa952, 0x0e94, 0x07c9, 0x07f2, 0x07fd, 0x2e3c, 0xa8f1, 0xa8f1, 0x9911, 0x4132, 0x4132, 0x3911, 0x3910, 0x30f0, 0x30f0, 0x30ef, 0x58f0, 0xa8f1, 0x40cf, 0x20ae, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x00f7, 0x00f9, 0x0118, 0x18cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xb8d1, 0xb8d1, 0xb8d1, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe4e, 0xfe4e, 0xc3f0, 0x8191, 0xaa73, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xecd1, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xc3ef, 0x8191, 0xaa73, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd354, 0xf590, 0xfe4e, 0xfe4e, 0xfe2e, 0xfe2e, 0xfe4e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xc3ef, 0x8191, 0xaa73, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0x9a12, 0x91f2, 0xd355, 0xd354, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xdbd4, 0xfe4e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe4e, 0xfe2e, 0xfe4e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe4e, 0x8191, 0x8191, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xdc13, 0xfe4e, 0xfe2e, 0xfe2e, 0xe50f, 0x8191, 0x99f2, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd354, 0xecd1, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe4e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe2e, 0xfe4e, 0xfe4e, 0xfe2e, 0xfe2e, 0xc3cf, 0x8191, 0xaa73, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xe4d1, 0xfe4e, 0xfe2e, 0xfe2e, 0xfe4e, 0xc3d0, 0x8191, 0xaa73, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xf590, 0xfe4e, 0xfe2e, 0xfe2e, 0xe50f, 0x8191, 0x9a12, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xecd2, 0xfe2e, 0xfe4e, 0xfe2e, 0xfe4e, 0xfe4e, 0xfe4e, 0xfe4d, 0xfe2f, 0xa2b0, 0x8191, 0xc2f4, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xd355, 0xfe2f, 0xfe50, 0xfe50, 0xfe50, 0xfe51, 0xfe51, 0xfe52, 0xfe52, 0xe3d2, 0xb8d2, 0xb8d1, 0xb8d1, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x001f, 0x003f, 0x00df, 0x59f8, 0xb8d1, 0x8291, 0x07c9, 0x07f2, 0x07fe, 0x455a, 0xb0f1, 0xa8f1, 0x8112, 0x4132, 0x4132, 0x3911, 0x38f0, 0x30f0, 0x30ef, 0x28ef, 0x28cf, 0x50cf, 0x48ef, 0x20ae, 0x20ae, 0x20ce, 0x20ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x00f7, 0x0119, 0x00f8, 0x10cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ac, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0xb8d1, 0xb0d1, 0xb0d2, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc6d, 0xc30f, 0x81b1, 0xaa73, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd375, 0xec11, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd375, 0xd375, 0xd395, 0xd395, 0xd375, 0xd395, 0xd396, 0xf42f, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd395, 0x9a12, 0x8191, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xf44f, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc8d, 0xfc6d, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd396, 0xdbd3, 0xfc8d, 0xfc6d, 0xfc6d, 0xe3ce, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd376, 0xd395, 0xd395, 0xd395, 0xec11, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc6d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xebf1, 0xfc8d, 0xfc6d, 0xfc8d, 0xfc6d, 0xc30f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd375, 0xd395, 0xf42f, 0xfc6d, 0xfc6d, 0xfc8d, 0xe3ce, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd375, 0xd395, 0xd376, 0xd395, 0xd395, 0xebf1, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc8d, 0xfc6d, 0xfc6d, 0xfc6d, 0xfc8d, 0xa250, 0x8191, 0xc314, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xfc8e, 0xfc8f, 0xfc8f, 0xfc8f, 0xfcb0, 0xfcb0, 0xfcb1, 0xfcb1, 0xf3b2, 0xb8d1, 0xb0f1, 0xb8d1, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x003f, 0x005f, 0x031f, 0x2d3b, 0x99b2, 0x454b, 0x07f3, 0x07fe, 0x5498, 0xb0f1, 0xa8f1, 0x6912, 0x4912, 0x4112, 0x3911, 0x3110, 0x30f0, 0x30ef, 0x30cf, 0x28cf, 0x20ce, 0x20ce, 0x20ce, 0x20cd, 0x20ce, 0x20ae, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x00f7, 0x0119, 0x00f8, 0x18cf, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xb0f1, 0xb0f1, 0xb0d1, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec11, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf44f, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0x9a12, 0x8191, 0xc334, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdbb4, 0xfc8e, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xdbd3, 0xfc8d, 0xfc8d, 0xfc8d, 0xe3ce, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec11, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xcb2f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xec11, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xc30f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf44f, 0xfc8d, 0xfc8d, 0xfc8d, 0xcb6f, 0x8191, 0x9a32, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec11, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xfc8d, 0xa250, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfc8e, 0xfc8f, 0xfcaf, 0xfcaf, 0xfcb0, 0xfcb0, 0xfcb0, 0xfcb2, 0xf451, 0xb0d1, 0xb0d1, 0xb0d1, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x003f, 0x003f, 0x005f, 0x025f, 0x06fd, 0x0770, 0x0f88, 0x07f4, 0x07ff, 0x5478, 0xa8f1, 0xa8f1, 0x5932, 0x4132, 0x4111, 0x3911, 0x3911, 0x30f0, 0x30f0, 0x30ef, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f7, 0x0119, 0x00f8, 0x18cf, 0x18ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xb0f1, 0xb0f1, 0xb0d1, 0xfcad, 0xfccd, 0xfcad, 0xfcad, 0xfccd, 0xfccd, 0xfccd, 0xcb4e, 0x8191, 0xaa73, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec31, 0xfcad, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xc32f, 0x8991, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf46f, 0xfccd, 0xfccd, 0xfccd, 0xfcad, 0xfccd, 0xfccd, 0xfccd, 0xfcad, 0xfcad, 0xfcad, 0xc32f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xbb11, 0x8191, 0xaa73, 0xd396, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xdbb4, 0xfcae, 0xfcad, 0xfccd, 0xfcad, 0xfccd, 0xfcad, 0xfccd, 0xfccd, 0xfcad, 0xfcad, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xdbd3, 0xfcad, 0xfccd, 0xfccd, 0xdbee, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec31, 0xfccd, 0xfcad, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xfcad, 0xfccd, 0xfcad, 0xfccd, 0xdbee, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdbd3, 0xfccd, 0xfccd, 0xfccd, 0xfccd, 0xc32f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf46f, 0xfcad, 0xfccd, 0xfccd, 0xc32f, 0x8991, 0xaa94, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec31, 0xfccd, 0xfccd, 0xfcad, 0xfccd, 0xfcad, 0xfcad, 0xfcad, 0xfcad, 0xa270, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfcce, 0xfccf, 0xfccf, 0xfcef, 0xfcd0, 0xfcf0, 0xfcf1, 0xfcf1, 0xfcf2, 0xb0f1, 0xb0f1, 0xb0f2, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x003f, 0x005f, 0x007f, 0x021f, 0x06fc, 0x078d, 0x07e7, 0x07f6, 0x07ff, 0x82b5, 0xa8f1, 0xa111, 0x4932, 0x4132, 0x4111, 0x38f1, 0x38f0, 0x30f0, 0x30ef, 0x30ef, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ce, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ae, 0x00f6, 0x0119, 0x0118, 0x18cf, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xb0f1, 0xa8f1, 0xb0f1, 0xfd0d, 0xfced, 0xfced, 0xfced, 0xfd0d, 0xfced, 0xfd0d, 0xe42e, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec51, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xc34f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf48f, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xc32f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec6f, 0x91d1, 0x89d1, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xdbb4, 0xec70, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfd0d, 0xfced, 0xfced, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdbf3, 0xfced, 0xfced, 0xfced, 0xe42e, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec51, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfd0d, 0xfced, 0xec6e, 0x8191, 0x91f2, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd376, 0xd395, 0xd395, 0xf4af, 0xfd0d, 0xfced, 0xfd0d, 0xc34f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf48f, 0xfced, 0xfced, 0xfced, 0xc34f, 0x8191, 0xaa93, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec51, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xfced, 0xa270, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfd0e, 0xfd0f, 0xfd0f, 0xfd0f, 0xfd10, 0xfd10, 0xfd31, 0xfd31, 0xfd32, 0xb0f1, 0xb0f1, 0xb0f1, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x005f, 0x005f, 0x005f, 0x021f, 0x073b, 0x07ac, 0x07e7, 0x07f7, 0x07ff, 0x82b5, 0xa8f1, 0x8912, 0x4932, 0x4112, 0x3911, 0x3911, 0x3110, 0x30f0, 0x30ef, 0x28cf, 0x28cf, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ae, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f6, 0x0119, 0x0118, 0x10cf, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xb0f1, 0xa8f1, 0xb0f1, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xe44e, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xc34f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf4cf, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xc34f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf4cf, 0xc34f, 0x8191, 0xb2d4, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdbd4, 0xe431, 0xec71, 0xec71, 0xdbf0, 0xe450, 0xf4cf, 0xfd0e, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdbd4, 0xf4af, 0xf4cf, 0xf4af, 0xdc10, 0x9a12, 0xaa73, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2c, 0xfd2c, 0x9211, 0x8191, 0xd375, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfcee, 0xfd2d, 0xc36f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdc10, 0xe44e, 0xdc2e, 0xe44e, 0xb2f0, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xa270, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfd2e, 0xfd2f, 0xfd2f, 0xfd4f, 0xfd50, 0xfd50, 0xfd51, 0xfd51, 0xfd71, 0xa8f1, 0xb0f1, 0xb0f2, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x005f, 0x005f, 0x007f, 0x007f, 0x023f, 0x073b, 0x07ab, 0x07e8, 0x07f9, 0x07ff, 0xa152, 0xa8f1, 0x7132, 0x4132, 0x4131, 0x3911, 0x3910, 0x38f0, 0x30f0, 0x30ef, 0x28cf, 0x28ce, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ae, 0x00f6, 0x0119, 0x0118, 0x18cf, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xa8f1, 0xa8f1, 0xa8f2, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd4d, 0xfd6d, 0xfd6d, 0xe46e, 0x8191, 0x9212, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xc36f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf4ef, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xc36f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf4ef, 0xfd2d, 0x9211, 0x89b2, 0xcb75, 0xd396, 0xd375, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec91, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xcb95, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd4d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xbb2f, 0x8191, 0xb2d4, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xc314, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec71, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xa290, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfd6e, 0xfd6f, 0xfd6f, 0xfd8f, 0xfd90, 0xfd90, 0xfd91, 0xfd91, 0xfd92, 0xa8f1, 0xa8f1, 0xa8f1, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x003f, 0x005f, 0x005f, 0x007f, 0x009f, 0x023f, 0x0779, 0x07aa, 0x07e8, 0x07fb, 0x07ff, 0xa8f1, 0xa8f1, 0x5932, 0x4932, 0x4131, 0x3911, 0x3910, 0x38f0, 0x30ef, 0x30ef, 0x28cf, 0x28ce, 0x28ce, 0x20ce, 0x20ce, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18cd, 0x0116, 0x0119, 0x0118, 0x18cf, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0xa8f1, 0xa8f1, 0xa8f1, 0xec6f, 0xfd8d, 0xfdad, 0xfd8d, 0xfdad, 0xfdad, 0xfdad, 0xe48e, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec91, 0xfdad, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xc38f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf52f, 0xfdad, 0xfd8d, 0xfdad, 0xfd8d, 0xfd8d, 0xfdad, 0xfd8d, 0xfd8d, 0xfdad, 0xfdad, 0xc38f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf52f, 0xfd8d, 0xe4ae, 0x8991, 0x9a32, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xe491, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec91, 0xfdad, 0xfdad, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfd8d, 0xfdad, 0xfdad, 0xfd8d, 0xfd8d, 0xfdad, 0xfdad, 0xfd8d, 0xfdad, 0xf52d, 0x8191, 0x91f2, 0xd395, 0xd395, 0xd395, 0xd395, 0xd376, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xc314, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xec91, 0xfd8d, 0xfd8d, 0xfdad, 0xfdad, 0xfdad, 0xfdad, 0xfdad, 0xfd8d, 0xa290, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfdaf, 0xfdaf, 0xfdaf, 0xfdaf, 0xfdb0, 0xfdb0, 0xfdb1, 0xfdd1, 0xe4b2, 0xa911, 0xa8f1, 0xa8f1, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x005f, 0x005f, 0x007f, 0x007f, 0x009f, 0x02bf, 0x0778, 0x07c8, 0x07e9, 0x07fd, 0x173e, 0xa8f1, 0x9912, 0x4932, 0x4932, 0x4131, 0x4111, 0x3911, 0x38f0, 0x30ef, 0x30ef, 0x28cf, 0x28ce, 0x28ce, 0x20ce, 0x20ce, 0x20cd, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x00f7, 0x0119, 0x0118, 0x18cf, 0x18ad, 0x18ad, 0x18ad, 0x18ac, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18cd, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xa911, 0xa911, 0xa911, 0xec8e, 0xfded, 0xfded, 0xfdcd, 0xfdcd, 0xfdcd, 0xfded, 0xe4ce, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecb1, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xc3af, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf54f, 0xfdcd, 0xfdcd, 0xfded, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfded, 0xfdcd, 0xc3af, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf54f, 0xfded, 0xfdcd, 0xd44f, 0x8191, 0xb2b3, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xecb1, 0x8991, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecb1, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xfdcd, 0xbb6f, 0x8191, 0xbaf4, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xc314, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecb1, 0xfded, 0xfded, 0xfdcd, 0xfdcd, 0xfded, 0xfded, 0xfded, 0xfded, 0xa2b0, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xfdee, 0xfdef, 0xfdef, 0xfdf0, 0xfdf0, 0xfdf0, 0xfdf1, 0xfdf1, 0xecb1, 0xa0f1, 0xa911, 0xa911, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x005f, 0x005f, 0x005f, 0x007f, 0x009f, 0x009f, 0x041f, 0x0797, 0x07c7, 0x07eb, 0x07fe, 0x2e5c, 0xa8f1, 0x7932, 0x4932, 0x4932, 0x4111, 0x3911, 0x3910, 0x38f0, 0x30ef, 0x30ef, 0x28ce, 0x28ce, 0x28ce, 0x20ce, 0x20ce, 0x20cd, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x00f7, 0x0118, 0x0117, 0x18cf, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ac, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ac, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0xa911, 0xa911, 0xa111, 0xe42e, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xe4ee, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecd1, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xc3cf, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf56f, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xc3cf, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf56f, 0xfe0d, 0xfe0d, 0xfe0d, 0xd44f, 0x8191, 0xbad3, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd376, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xecd1, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecd1, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0d, 0xf5ad, 0x9a70, 0x89b1, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xc314, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecd1, 0xfe0d, 0xfe0d, 0xfe0d, 0xfe0e, 0xfe0d, 0xfe0e, 0xfe0e, 0xfe0e, 0xa2b0, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfe0f, 0xfe0f, 0xfe0f, 0xfe30, 0xfe30, 0xfe30, 0xfe31, 0xfe31, 0xdc32, 0xa111, 0xa911, 0xa111, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x005f, 0x005f, 0x007f, 0x007f, 0x009f, 0x00bf, 0x043f, 0x0794, 0x07e6, 0x07ec, 0x07fe, 0x35db, 0xa911, 0x5133, 0x4932, 0x4132, 0x4111, 0x4111, 0x3910, 0x30f0, 0x30ef, 0x30ef, 0x28ce, 0x28ce, 0x20ce, 0x20ce, 0x20ce, 0x20cd, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ac, 0x18ad, 0x18ae, 0x00f6, 0x0119, 0x00f8, 0x18cf, 0x20ad, 0x18ad, 0x20ad, 0x18ac, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ac, 0x80f0, 0xa111, 0xa111, 0xc2b0, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xe50e, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecf1, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xc3ef, 0x8991, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xf58f, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xc3ef, 0x8191, 0xaa93, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf58f, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xe50e, 0x89d1, 0xa253, 0xcb75, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd376, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecf1, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecf1, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xf60e, 0x9a70, 0x91f2, 0xcb75, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xc314, 0x8191, 0xaa93, 0xd395, 0xd396, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecf2, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4e, 0xfe4d, 0xfe4e, 0xfe4d, 0xfe4e, 0xa2d0, 0x8191, 0xc314, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfe4e, 0xfe4f, 0xfe6f, 0xfe70, 0xfe50, 0xfe50, 0xfe71, 0xfe51, 0xba52, 0xa111, 0xa111, 0x78d5, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x005f, 0x007f, 0x007f, 0x009f, 0x00bf, 0x00bf, 0x043f, 0x07b3, 0x07c5, 0x07ee, 0x07ff, 0x5478, 0x6ad6, 0x4953, 0x4932, 0x4912, 0x4111, 0x3911, 0x3910, 0x30f0, 0x30ef, 0x28cf, 0x28ce, 0x28ce, 0x28ce, 0x20ce, 0x20cd, 0x20cd, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x18ad, 0x00f6, 0x0118, 0x00f8, 0x18cf, 0x18ac, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ad, 0x18ac, 0x60ef, 0xa111, 0xa111, 0xa112, 0xfe2d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xe54e, 0x8191, 0x9a12, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xed11, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe8d, 0xc40f, 0x8191, 0xaa93, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xf5cf, 0xfe6d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe6d, 0xc40f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf5ce, 0xfe6d, 0xfe6d, 0xfe8d, 0xfe6c, 0xfe8d, 0xf62d, 0xc40f, 0x9a12, 0xb2d4, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xecf1, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xed11, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe8d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6c, 0xfe8d, 0xfe6d, 0xfe2d, 0xbbcf, 0x89b1, 0xbaf4, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd396, 0xc314, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xed12, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xa2d0, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe90, 0xfe90, 0xfe90, 0xfe91, 0xe471, 0xa111, 0xa112, 0xa111, 0x60d5, 0x001f, 0x283c, 0x7097, 0x405a, 0x001f, 0x001f, 0x001f, 0x003f, 0x007f, 0x009f, 0x00bf, 0x00bf, 0x00df, 0x045f, 0x07d2, 0x07e4, 0x07ef, 0x07ff, 0x2e3c, 0x2d1a, 0x5133, 0x4932, 0x4132, 0x3911, 0x3911, 0x38f0, 0x30f0, 0x30ef, 0x28cf, 0x28ce, 0x28ce, 0x20ce, 0x20ce, 0x20cd, 0x20cd, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x18ad, 0x00f6, 0x0118, 0x00f7, 0x18cf, 0x18ad, 0x18ad, 0x20ad, 0x18ad, 0x18ad, 0x20ad, 0x18ac, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x28cd, 0xa111, 0xa111, 0xa111, 0xcbcf, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xf5ed, 0x89d1, 0x91d2, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd396, 0xd395, 0xed11, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xc42f, 0x81b1, 0xaa93, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xf5ef, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfecc, 0xfead, 0xc42f, 0x8191, 0xaa93, 0xd395, 0xd395, 0xd396, 0xd395, 0xd395, 0xd395, 0xd395, 0xf5ef, 0xfead, 0xfeac, 0xfead, 0xfead, 0xfeac, 0xfead, 0xfead, 0xf64d, 0xd4ce, 0xbbd0, 0xc3b2, 0xc314, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xed12, 0x8191, 0x8191, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xd395, 0xd395, 0xed31, 0xfeac, 0xfeac, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xee0d, 0xcc6f, 0xbb51, 0xbad4, 0xcb55, 0xd395, 0xd395, 0xd395, 0xd395, 0xc334, 0x8191, 0xb294, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd375, 0xd395, 0xed11, 0xfeae, 0xfece, 0xfead, 0xfeae, 0xfead, 0xfece, 0xfeae, 0xfeae, 0xa2f0, 0x8191, 0xc314, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xd395, 0xdc34, 0xfeaf, 0xfed0, 0xfeaf, 0xfed0, 0xfeb0, 0xfed1, 0xe491, 0xa911, 0xa111, 0x9931, 0xa111, 0x58d6, 0x88b5, 0xb8d1, 0xb8d1, 0x5059, 0x001f, 0x001f, 0x001f, 0x001f, 0x007f, 0x009f, 0x00bf, 0x00ff, 0x00df, 0x047f, 0x07d2, 0x07e3, 0x07f1, 0x07ff, 0x07ff, 0x2cba, 0x4933, 0x4132, 0x4131, 0x4111, 0x38f0, 0x38f0, 0x30f0, 0x30ef, 0x28ef, 0x28ce, 0x28ce, 0x20ce, 0x20cd, 0x20cd, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x00f6, 0x0118, 0x0118, 0x18cf, 0x20ad, 0x18ac, 0x18ac, 0x18ad, 0x18ad, 0x18ac, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x20ac, 0x20ad, 0x18ad, 0x8110, 0x9911, 0xa111, 0xa171, 0xf5ed, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfe6d, 0xf5cf, 0xf5ef, 0xf5cf, 0xf5cf, 0xf5ef, 0xf5cf, 0xfe4d, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfe4e, 0xf5ef, 0xf5ef, 0xf5cf, 0xf5ee, 0xf5ef, 0xf5ef, 0xf5ef, 0xfe8d, 0xfeac, 0xfeac, 0xfeac, 0xfeac, 0xfead, 0xfe8d, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfeac, 0xfead, 0xf64d, 0xf5ef, 0xf5cf, 0xf5ef, 0xf5cf, 0xf5ef, 0xf5ef, 0xf5ef, 0xfe6e, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfeac, 0xfead, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfead, 0xfead, 0xf60e, 0xf5ef, 0xf5cf, 0xf5ef, 0xf5ef, 0xf5cf, 0xf64e, 0xfeac, 0xfead, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5cf, 0xf5ef, 0xf5ef, 0xf5ef, 0xf5cf, 0xfe4d, 0xfeac, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfe6d, 0xf5ef, 0xf5ef, 0xf5cf, 0xf5cf, 0xfead, 0xf62e, 0xf5ef, 0xf5d0, 0xf5ef, 0xf5cf, 0xf5f0, 0xf5f0, 0xf5ef, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5ef, 0xf5f0, 0xfe4f, 0xfece, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeaf, 0xf610, 0xf5d0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf5f0, 0xf610, 0xfeaf, 0xfeaf, 0xfeaf, 0xfed0, 0xfeb0, 0xfeb1, 0xe471, 0xb8d1, 0xa111, 0x9931, 0x9931, 0x9912, 0x6933, 0xb0f1, 0xb0d1, 0xb0d1, 0x283c, 0x001f, 0x001f, 0x001f, 0x003f, 0x007f, 0x00bf, 0x00df, 0x00ff, 0x011f, 0x047f, 0x07d1, 0x07e3, 0x07f3, 0x07ff, 0x07ff, 0x3b77, 0x4932, 0x4932, 0x4131, 0x4111, 0x38f0, 0x38f0, 0x30ef, 0x30ef, 0x28ef, 0x28ce, 0x28ce, 0x20ce, 0x20cd, 0x20cd, 0x20ad, 0x20ad, 0x20ad, 0x20ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ac, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad, 0x18ad,
-  0x0118, 0x0117, 0x18cf, 0x18ad, 0x18ac, 0x18ac, 0x18ad, 0x18ac, 0x20ad, 0x18ac, 0x20ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18cd, 0x18ac, 0x20ac, 0x38ce, 0x9931, 0x9931, 0x9931, 0xaa31, 0xfe2d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfead, 0xfe8c, 0xfeac, 0xfeac, 0xfe8c, 0xfe8c, 0xfeac, 0xfead, 0xfe8d, 0xfe8c, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfe8c, 0xfe8c, 0xfeac, 0xfeac, 0xfead, 0xfe8c, 0xfead, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8c, 0xfead, 0xfe8c, 0xfe8c, 0xfead, 0xfead, 0xfeac, 0xfeac, 0xfe8c, 0xfe8c, 0xfeac, 0xfe8c, 0xfeac, 0xfead, 0xfead, 0xfe8d, 0xfe8c, 0xfead, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8d, 0xfeac, 0xfe8c, 0xfeac, 0xfe8d, 0xfead, 0xfead, 0xfe8c, 0xfeac, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8c, 0xfeac, 0xfe8d, 0xfe8c, 0xfead, 0xfead, 0xfe8c, 0xfe8c, 0xfe8c, 0xfead, 0xfe8c, 0xfeac, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfe8c, 0xfeac, 0xfe8d, 0xfeac, 0xfead, 0xfead, 0xfe8c, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfead, 0xfeac, 0xfe8c, 0xfead, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfead, 0xfead, 0xfead, 0xfe8d, 0xfead, 0xfead, 0xfead, 0xfead, 0xfe8d, 0xfe8e, 0xfead, 0xfeae, 0xfeae, 0xfead, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfeae, 0xfe8e, 0xfe8e, 0xfeae, 0xfeae, 0xfeae, 0xfe8e, 0xfeae, 0xfeae, 0xfeae, 0xfe8e, 0xfe8e, 0xfeae, 0xfeaf, 0xfeae, 0xfeae, 0xfeaf, 0xfe8e, 0xfeaf, 0xfeaf, 0xfeaf, 0xfeaf, 0xfeaf, 0xfe8f, 0xfeb0, 0xfeaf, 0xfeb0, 0xfe90, 0xe471, 0xb8d2, 0xa111, 0x9911, 0x9931, 0x9931, 0x7132, 0x7133, 0xb0f1, 0xb0d1, 0xb0d2, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x007f, 0x00df, 0x00df, 0x011f, 0x011f, 0x049f, 0x07f0, 0x07e2, 0x07f4, 0x07ff, 0x07ff, 0x3af6, 0x4932, 0x4932, 0x4111, 0x3911, 0x3910, 0x38f0, 0x30ef, 0x30ef, 0x28ee, 0x28ce, 0x28ce, 0x20ce, 0x20cd, 0x20cd, 0x20ad, 0x20ad, 0x20ad, 0x18ac, 0x20ac, 0x18ad, 0x18ad, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac,
-  0x0117, 0x18cf, 0x20ac, 0x20ac, 0x20ad, 0x18ac, 0x18ac, 0x20ac, 0x20ac, 0x18ac, 0x20ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x20ad, 0x20ac, 0x60ef, 0x9912, 0x9931, 0x9931, 0xb270, 0xf62d, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe6d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8c, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8e, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8d, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8e, 0xfe8f, 0xfe8e, 0xfe8e, 0xfe8f, 0xfe8f, 0xfe8e, 0xfe8f, 0xfe8f, 0xfe8e, 0xfe8f, 0xfe8e, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe8f, 0xfe90, 0xfe90, 0xfeb0, 0xfeb0, 0xe471, 0xb8d1, 0xa111, 0x9931, 0x9931, 0x9912, 0x8911, 0x5174, 0x6953, 0xb0f1, 0xb0d1, 0x90b4, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x009f, 0x00df, 0x00ff, 0x011f, 0x015f, 0x049f, 0x07f1, 0x07e2, 0x07f6, 0x07ff, 0x0f9f, 0x4a35, 0x4933, 0x4932, 0x4131, 0x3910, 0x3910, 0x38f0, 0x30ef, 0x30ef, 0x28ce, 0x28ce, 0x28ce, 0x20cd, 0x20cd, 0x20cd, 0x20ad, 0x20ad, 0x20ad, 0x18ac, 0x20ac, 0x20ac, 0x18ac, 0x18ac, 0x20ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac,
-  0x18ce, 0x18ac, 0x20cc, 0x20ac, 0x18ac, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x20ad, 0x18cc, 0x20ad, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x20ac, 0x28ad, 0x8110, 0x9931, 0x9931, 0x9911, 0xaa31, 0xf5cd, 0xfe8c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe8c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe8c, 0xfe6d, 0xfe6d, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe8e, 0xfe8d, 0xfe8d, 0xfe6e, 0xfe8d, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe8f, 0xfe8f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe8f, 0xfe6f, 0xfe6f, 0xfe8f, 0xfe8f, 0xfe6f, 0xfe6f, 0xfe8f, 0xfe6f, 0xfe6f, 0xfe8f, 0xfe8f, 0xfe6f, 0xfe8f, 0xfe8f, 0xfe6f, 0xfe90, 0xfe8f, 0xfe8f, 0xfe90, 0xfe90, 0xe471, 0xb0d1, 0xa111, 0x9931, 0x9931, 0x9931, 0x9912, 0x5953, 0x5153, 0x7133, 0xb0d1, 0xb0d1, 0x7896, 0x001f, 0x001f, 0x001f, 0x003f, 0x005f, 0x00bf, 0x011f, 0x011f, 0x013f, 0x017f, 0x04bf, 0x07f2, 0x07e2, 0x07f5, 0x07ff, 0x7336, 0x5153, 0x4933, 0x4932, 0x4131, 0x4110, 0x3910, 0x30ef, 0x30ef, 0x30ef, 0x28ce, 0x28ce, 0x28cd, 0x20cd, 0x20cd, 0x20cd, 0x20ad, 0x20ad, 0x20ad, 0x20ac, 0x20ac, 0x20ad, 0x18ac, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac,
-  0x20ac, 0x20ac, 0x18ac, 0x18ac, 0x20ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x18ac, 0x20ac, 0x20ac, 0x18ac, 0x28ad, 0x9111, 0x9931, 0x9931, 0x9931, 0xa171, 0xcbcf, 0xf60d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6c, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6d, 0xfe6d, 0xfe6d, 0xfe4d, 0xfe6e, 0xfe6e, 0xfe4e, 0xfe6d, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6e, 0xfe6f, 0xfe6e, 0xfe6e, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe70, 0xfe70, 0xfe6f, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe90, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe71, 0xfe71, 0xfe71, 0xe471, 0xa8f1, 0xa111, 0x9931, 0x9932, 0x9931, 0x9931, 0x6933, 0x5153, 0x5953, 0x7153, 0xb0d1, 0xb0d1, 0x5878, 0x001f, 0x001f, 0x003f, 0x007f, 0x009f, 0x00ff, 0x013f, 0x013f, 0x017f, 0x019f, 0x033f, 0x07f3, 0x07e2, 0x07f3, 0x07ff, 0xa8f1, 0x6932, 0x4932, 0x4932, 0x4931, 0x4111, 0x3910, 0x3110, 0x30ef, 0x30ef, 0x28ce, 0x28ce, 0x28cd, 0x20cd, 0x20cd, 0x20cd, 0x20ad, 0x20ad, 0x20ad, 0x20ac, 0x20ac, 0x20ad, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac,
-  0x18cc, 0x18ac, 0x18ac, 0x20ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x20ac, 0x18ac, 0x18ac, 0x18ac, 0x20ac, 0x28cd, 0x8111, 0x9931, 0x9912, 0x9931, 0x9931, 0x9911, 0xbab0, 0xdc6f, 0xe50f, 0xe50e, 0xfe4e, 0xfe6e, 0xfe4e, 0xfe6d, 0xfe4e, 0xfe4e, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4e, 0xfe4e, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4d, 0xfe4e, 0xfe4e, 0xfe4e, 0xfe4e, 0xfe6e, 0xfe6e, 0xfe4e, 0xfe4e, 0xfe4e, 0xfe6e, 0xfe6e, 0xfe4e, 0xfe6f, 0xfe6e, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe6f, 0xfe4f, 0xfe6f, 0xfe70, 0xfe50, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe70, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xfe71, 0xf612, 0xe531, 0xe512, 0xd472, 0xb271, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9911, 0x6153, 0x5153, 0x5954, 0x5954, 0x7154, 0xb0f1, 0xb0f1, 0x285c, 0x003f, 0x005f, 0x007f, 0x00bf, 0x00ff, 0x013f, 0x015f, 0x017f, 0x019f, 0x01bf, 0x02ff, 0x07f4, 0x07e3, 0x07f1, 0x2e5c, 0xa911, 0x6932, 0x5132, 0x4931, 0x4132, 0x4110, 0x3910, 0x3910, 0x30ef, 0x30ee, 0x28ce, 0x28ce, 0x28cd, 0x20cd, 0x20cd, 0x20cd, 0x20ac, 0x20ad, 0x20ad, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x18ac, 0x20ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac, 0x18ac,
-  0x20ac, 0x18ac, 0x20ac, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x20ac, 0x20ac, 0x28cc, 0x610f, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9932, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9912, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9911, 0x9931, 0x9931, 0x9911, 0x9911, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9911, 0x9931, 0x9932, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9912, 0x9931, 0x9931, 0x9931, 0x9931, 0x8912, 0x5153, 0x5953, 0x5153, 0x5974, 0x5974, 0x7953, 0xb0f1, 0xb0d1, 0x087f, 0x009f, 0x00bf, 0x00df, 0x011f, 0x015f, 0x019f, 0x019f, 0x019f, 0x01df, 0x01df, 0x01ff, 0x07f7, 0x07e3, 0x07ef, 0x5498, 0xa8f1, 0x7132, 0x4952, 0x4931, 0x4131, 0x4110, 0x3910, 0x30ef, 0x30ef, 0x30ee, 0x28ce, 0x28ce, 0x28cd, 0x20cd, 0x20cd, 0x20cd, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac,
-  0x20ac, 0x18ac, 0x20ac, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x40ce, 0x7910, 0x9931, 0x9931, 0x9932, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0xa111, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9912, 0x7132, 0x5153, 0x5153, 0x5153, 0x5974, 0x5974, 0x6174, 0x9113, 0xb0f1, 0x98f3, 0x00df, 0x00ff, 0x011f, 0x013f, 0x017f, 0x01bf, 0x01bf, 0x01df, 0x01df, 0x01ff, 0x01ff, 0x021f, 0x06d9, 0x07e5, 0x07ec, 0x7355, 0xa8f1, 0x7932, 0x4932, 0x4931, 0x4131, 0x4110, 0x3910, 0x390f, 0x30ef, 0x30ee, 0x28ce, 0x28ce, 0x28cd, 0x28cd, 0x20cd, 0x20cd, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac,
-  0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18ab, 0x30cc, 0x58cf, 0x7910, 0x9931, 0x9931, 0x9912, 0x9931, 0x9931, 0x9911, 0x9931, 0x9911, 0x9932, 0x9931, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9911, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0xa111, 0x9911, 0x8932, 0x6932, 0x5152, 0x5153, 0x5953, 0x5953, 0x5974, 0x6174, 0x6175, 0x7954, 0xa8f1, 0xb0f1, 0x80f5, 0x013f, 0x017f, 0x019f, 0x01bf, 0x01df, 0x01ff, 0x01df, 0x01ff, 0x021f, 0x023f, 0x023f, 0x023f, 0x057d, 0x07e8, 0x07e9, 0x82d5, 0xa0f1, 0x8132, 0x5132, 0x4931, 0x4131, 0x4110, 0x38f0, 0x38ef, 0x30ef, 0x30ee, 0x28ce, 0x28cd, 0x28cd, 0x28cd, 0x20cd, 0x20cd, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac,
-  0x18ac, 0x20ac, 0x20ac, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18cc, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ab, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20cc, 0x20ad, 0x20cd, 0x20cd, 0x28cd, 0x28cd, 0x28cd, 0x28cd, 0x28cd, 0x28ce, 0x28ee, 0x28ee, 0x30ee, 0x30ef, 0x30ef, 0x30ee, 0x38ef, 0x5110, 0x6110, 0x5910, 0x6930, 0x7931, 0x8131, 0x8130, 0x9931, 0xa932, 0xa131, 0xb131, 0xc912, 0xc911, 0xc8f2, 0xc8f2, 0xc8f2, 0xc8d1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xb8b1, 0xc0d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0d1, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0f1, 0x5158, 0x01bf, 0x01df, 0x01ff, 0x021f, 0x023f, 0x023f, 0x021f, 0x023f, 0x025f, 0x025f, 0x025f, 0x025f, 0x041f, 0x07ed, 0x07e4, 0x7ab4, 0xa911, 0x9112, 0x5132, 0x4931, 0x4111, 0x4110, 0x3910, 0x38ef, 0x30ef, 0x30ee, 0x30ee, 0x28cd, 0x28cd, 0x28cd, 0x20cd, 0x20cc, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac,
-  0x20cc, 0x20ac, 0x20ab, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x20ac, 0x20ab, 0x18ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ab, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20cc, 0x20cd, 0x20cd, 0x28cd, 0x28cd, 0x28cd, 0x28cd, 0x28ad, 0x28ce, 0x30ce, 0x30ce, 0x30ee, 0x8151, 0xb192, 0xc9b3, 0xc9b2, 0xc992, 0xc992, 0xc992, 0xc972, 0xc972, 0xc972, 0xc952, 0xc952, 0xc932, 0xc932, 0xc932, 0xc912, 0xc912, 0xc111, 0xc8f1, 0xc8f1, 0xc8d1, 0xc0d1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0d1, 0xb8b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d2, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xa8f1, 0x39bb, 0x021f, 0x023f, 0x025f, 0x027f, 0x027f, 0x025f, 0x025f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x029f, 0x07f3, 0x07e2, 0x9972, 0xa911, 0xa112, 0x4952, 0x4932, 0x4131, 0x4110, 0x3910, 0x38ef, 0x30ef, 0x30ee, 0x30ee, 0x28cd, 0x28cd, 0x28cd, 0x20cd, 0x20cc, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac,
-  0x20ab, 0x20ab, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x18ac, 0x20ac, 0x18cc, 0x18ac, 0x20ab, 0x20ac, 0x20ac, 0x20ab, 0x20ac, 0x20ac, 0x18ac, 0x20ab, 0x20ab, 0x20ac, 0x20ac, 0x20ab, 0x20ab, 0x20ac, 0x20ac, 0x20ab, 0x20ab, 0x20ac, 0x20ab, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20cc, 0x20cc, 0x20cc, 0x28cd, 0x28cd, 0x28cd, 0x28cd, 0x30cd, 0x28ee, 0x30ee, 0x490e, 0xa9b2, 0xc9d3, 0xc9d3, 0xc9b3, 0xc9b3, 0xc992, 0xc992, 0xc972, 0xc972, 0xc972, 0xc952, 0xc952, 0xc952, 0xc932, 0xc932, 0xc912, 0xc912, 0xc912, 0xc0f2, 0xc8d1, 0xc0d1, 0xc0d1, 0xc8b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb0d1, 0xb8d2, 0xb8d1, 0xb0f1, 0xb0d1, 0xb0f2, 0xb0f1, 0xb0f1, 0xb0f1, 0xa8f1, 0xa8f1, 0x123e, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02df, 0x06b9, 0x07e3, 0xa111, 0xa911, 0xa111, 0x5932, 0x4931, 0x4911, 0x4110, 0x4110, 0x390f, 0x38ef, 0x30ee, 0x30ee, 0x28cd, 0x28cd, 0x28cd, 0x20cd, 0x20cc, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ab, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac,
-  0x20ab, 0x20ac, 0x20ab, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ab, 0x20ac, 0x20ab, 0x20ac, 0x20ac, 0x20ab, 0x20ab, 0x18ac, 0x20ac, 0x20ab, 0x20ac, 0x20ac, 0x20ac, 0x18ab, 0x20ab, 0x20ab, 0x20ac, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20cc, 0x20cd, 0x28cd, 0x28cd, 0x28cd, 0x28cd, 0x28cd, 0x28cd, 0x30ed, 0x692f, 0xc9d3, 0xc9d3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc992, 0xc992, 0xc972, 0xc972, 0xc972, 0xc952, 0xc952, 0xc932, 0xc932, 0xc132, 0xc912, 0xc912, 0xc8f2, 0xc8f1, 0xc8d1, 0xc0d1, 0xc0d1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xc0b1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0d1, 0xb8d1, 0xb0f1, 0xb0d1, 0xb0d1, 0xb0f1, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xa8f1, 0x9933, 0x02df, 0x02df, 0x02ff, 0x02ff, 0x02df, 0x02bf, 0x02df, 0x02df, 0x02df, 0x02df, 0x02df, 0x02bf, 0x02bf, 0x02ff, 0x051e, 0x07e8, 0xa912, 0xa111, 0xa111, 0x6932, 0x4931, 0x4931, 0x4130, 0x410f, 0x390f, 0x38ee, 0x30ee, 0x30ee, 0x28cd, 0x28cd, 0x28cd, 0x20cd, 0x20cc, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ab, 0x20ab, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac, 0x20ac,
-  0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ac, 0x20ac, 0x20ac, 0x28ac, 0x20cc, 0x28cc, 0x28cc, 0x28cc, 0x28cd, 0x28cd, 0x28ed, 0x28cd, 0x30cd, 0x9191, 0xc9d3, 0xc9d3, 0xc9b3, 0xc9b3, 0xc992, 0xc9b3, 0xc992, 0xc992, 0xc972, 0xc972, 0xc952, 0xc952, 0xc932, 0xc932, 0xc912, 0xc932, 0xc912, 0xc112, 0xc8f2, 0xc8f2, 0xc8d1, 0xc8d1, 0x9095, 0x9095, 0x9075, 0x8875, 0x6078, 0x6059, 0x6059, 0x6058, 0x6058, 0x6078, 0x6078, 0x6059, 0x6078, 0x6078, 0x5878, 0x6078, 0x88b4, 0x88b5, 0x88b5, 0xb8d1, 0xb8d1, 0xb8d1, 0xb8d1, 0xb0f1, 0xb0f1, 0xb0d1, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xa8f1, 0xa8f1, 0xa8f1, 0x69d6, 0x033f, 0x033f, 0x033f, 0x031f, 0x02ff, 0x02ff, 0x02ff, 0x02ff, 0x02ff, 0x02ff, 0x02ff, 0x02df, 0x02ff, 0x035f, 0x03ff, 0x07f0, 0x8a4f, 0xa111, 0xa111, 0x8132, 0x4931, 0x4931, 0x4110, 0x410f, 0x390f, 0x30ee, 0x30ee, 0x30cd, 0x30cd, 0x28cd, 0x28cd, 0x28cc, 0x28cc, 0x20cc, 0x20ac, 0x20ac, 0x20ac, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab,
-  0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cc, 0x20ac, 0x28cc, 0x28cc, 0x28cc, 0x20cc, 0x28cc, 0x28cc, 0x28cd, 0x40ee, 0xa9b2, 0xc9d3, 0xc9d3, 0xc9b3, 0xc9b2, 0xc9b3, 0xc992, 0xc992, 0xc972, 0xc972, 0xc952, 0xc952, 0xc952, 0xc932, 0xc932, 0x90d5, 0x88d6, 0x6098, 0x5879, 0x303c, 0x305c, 0x081e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x005f, 0x007f, 0x009f, 0x00bf, 0x00df, 0x291c, 0x411a, 0x6118, 0x8915, 0xb0d1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f1, 0xb0f2, 0xa8f1, 0xb0f1, 0x429a, 0x039f, 0x039f, 0x035f, 0x035f, 0x033f, 0x033f, 0x033f, 0x033f, 0x033f, 0x033f, 0x031f, 0x031f, 0x031f, 0x037f, 0x03ff, 0x06d7, 0x7acf, 0xa111, 0xa111, 0x9912, 0x5131, 0x4931, 0x4110, 0x410f, 0x40ef, 0x38ee, 0x30ee, 0x30ed, 0x30cd, 0x28cd, 0x28cd, 0x28cc, 0x28cc, 0x20cc, 0x20cc, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab,
-  0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20cb, 0x20cb, 0x28cc, 0x28cc, 0x28cc, 0x28cd, 0x28cc, 0x490e, 0xc1d3, 0xc9d3, 0xc9d3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc9b3, 0xc992, 0xc992, 0xc972, 0xc952, 0x98f5, 0x60b8, 0x407b, 0x183e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x003f, 0x007f, 0x007f, 0x009f, 0x00bf, 0x00ff, 0x011f, 0x013f, 0x017f, 0x019f, 0x01df, 0x021f, 0x21fd, 0x49d9, 0x7996, 0xa112, 0xa8f1, 0xb0f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0x139e, 0x03df, 0x03bf, 0x039f, 0x039f, 0x037f, 0x037f, 0x037f, 0x037f, 0x035f, 0x035f, 0x033f, 0x033f, 0x035f, 0x03bf, 0x041f, 0x05de, 0x7ad1, 0xa111, 0xa111, 0xa111, 0x5931, 0x4931, 0x4130, 0x4130, 0x40ef, 0x38ee, 0x30ee, 0x30ed, 0x30ed, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab,
-  0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x692f, 0xc9f3, 0xc9d3, 0xc9d3, 0xc9b2, 0xc9b3, 0xc992, 0xc9b2, 0xc972, 0xb973, 0x80f7, 0x387b, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x003f, 0x005f, 0x007f, 0x009f, 0x00bf, 0x00df, 0x00ff, 0x013f, 0x015f, 0x019f, 0x01bf, 0x01ff, 0x023f, 0x025f, 0x029f, 0x02df, 0x02ff, 0x033f, 0x2adc, 0x5a58, 0x8994, 0xa8f1, 0xa8f1, 0x81d4, 0x041f, 0x041f, 0x03ff, 0x03df, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x039f, 0x037f, 0x035f, 0x037f, 0x039f, 0x03ff, 0x047f, 0x04ff, 0x6375, 0xa112, 0xa111, 0xa111, 0x7111, 0x4931, 0x4110, 0x4110, 0x390f, 0x38ee, 0x30ee, 0x30ed, 0x30ed, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab,
-  0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x28ac, 0x28cc, 0x28cc, 0x28cc, 0x692e, 0xc9f3, 0xc9d2, 0xc9d3, 0xc9b3, 0xc9b3, 0xc992, 0xc993, 0x80f7, 0x389b, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x083c, 0x085b, 0x105b, 0x2078, 0x2098, 0x2097, 0x2097, 0x2097, 0x2097, 0x2097, 0x2098, 0x187a, 0x105b, 0x085d, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x003f, 0x005f, 0x007f, 0x009f, 0x00df, 0x00ff, 0x011f, 0x015f, 0x017f, 0x01bf, 0x01ff, 0x021f, 0x025f, 0x029f, 0x02df, 0x02ff, 0x033f, 0x037f, 0x03bf, 0x03df, 0x041f, 0x043f, 0x0c3f, 0x2bbc, 0x0c3f, 0x045f, 0x043f, 0x041f, 0x041f, 0x03ff, 0x03ff, 0x03ff, 0x03df, 0x03df, 0x03bf, 0x039f, 0x037f, 0x039f, 0x03df, 0x043f, 0x04bf, 0x053f, 0x5398, 0xa111, 0xa111, 0xa111, 0x9111, 0x4931, 0x4910, 0x4110, 0x410f, 0x38ee, 0x38ee, 0x30ed, 0x30cd, 0x30cd, 0x28cc, 0x28cc, 0x28cc, 0x28cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x28cb, 0x28cb, 0x28cc, 0x28cb, 0x614e, 0xd1f3, 0xc9f3, 0xc9d3, 0xc9b2, 0xc9b3, 0xb173, 0x60d9, 0x081e, 0x003d, 0x083b, 0x1878, 0x1877, 0x28d2, 0x28d2, 0x40ee, 0x38ee, 0x390f, 0x390f, 0x390f, 0x410e, 0x410f, 0x410f, 0x410f, 0x410f, 0x410f, 0x410f, 0x410f, 0x4110, 0x410f, 0x4910, 0x4130, 0x38f3, 0x28b6, 0x189a, 0x003e, 0x001f, 0x001f, 0x003f, 0x005f, 0x005f, 0x007f, 0x00bf, 0x00df, 0x00ff, 0x013f, 0x015f, 0x019f, 0x01df, 0x021f, 0x023f, 0x027f, 0x029f, 0x02ff, 0x033f, 0x035f, 0x039f, 0x03df, 0x041f, 0x045f, 0x047f, 0x04bf, 0x04df, 0x04df, 0x04bf, 0x04bf, 0x047f, 0x047f, 0x043f, 0x043f, 0x043f, 0x041f, 0x041f, 0x03ff, 0x03df, 0x03bf, 0x03bf, 0x03df, 0x043f, 0x047f, 0x04df, 0x057f, 0x3c1a, 0xa111, 0xa111, 0xa111, 0xa111, 0x5931, 0x4910, 0x4110, 0x410f, 0x390e, 0x38ee, 0x30ed, 0x30ed, 0x30cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x28cb, 0x20cb, 0x28ab, 0x692e, 0xc9d3, 0xc9d3, 0xc9d3, 0xc9b3, 0xb1b2, 0x58f3, 0x1895, 0x28b2, 0x30ed, 0x38ed, 0x30ed, 0x38ed, 0x38ed, 0x38ed, 0x38ee, 0x390e, 0x390e, 0x38ee, 0x38ee, 0x390e, 0x390e, 0x390e, 0x390e, 0x410f, 0x390e, 0x410f, 0x410f, 0x410f, 0x410f, 0x410f, 0x410f, 0x4110, 0x410f, 0x492f, 0x4930, 0x4910, 0x38f3, 0x20b8, 0x087d, 0x007f, 0x009f, 0x00df, 0x00ff, 0x011f, 0x015f, 0x017f, 0x019f, 0x01df, 0x021f, 0x025f, 0x02bf, 0x02df, 0x031f, 0x035f, 0x039f, 0x03df, 0x041f, 0x045f, 0x049f, 0x04df, 0x04ff, 0x051f, 0x051f, 0x053f, 0x04ff, 0x04df, 0x04bf, 0x049f, 0x047f, 0x047f, 0x045f, 0x045f, 0x043f, 0x041f, 0x03ff, 0x03df, 0x03ff, 0x043f, 0x045f, 0x04bf, 0x053f, 0x05bf, 0x2cdc, 0xa112, 0xa111, 0xa111, 0xa111, 0x7131, 0x4930, 0x4130, 0x410f, 0x390e, 0x38ee, 0x30ed, 0x30ed, 0x30cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x28ab, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x28ab, 0x28cb, 0x28cb, 0x612e, 0xc9f3, 0xc9d3, 0xc9d3, 0xb992, 0x692e, 0x28cc, 0x28ec, 0x30cd, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x38ed, 0x30ed, 0x38ed, 0x38ed, 0x390e, 0x38ee, 0x38ee, 0x38ee, 0x390f, 0x38ee, 0x40ee, 0x40ee, 0x390f, 0x390e, 0x410e, 0x40ef, 0x410f, 0x410f, 0x410f, 0x410f, 0x410f, 0x410f, 0x410f, 0x412f, 0x4910, 0x4910, 0x4930, 0x4113, 0x28f8, 0x08fe, 0x013f, 0x015f, 0x019f, 0x01df, 0x021f, 0x023f, 0x029f, 0x02bf, 0x031f, 0x035f, 0x039f, 0x03df, 0x041f, 0x045f, 0x049f, 0x04df, 0x051f, 0x053f, 0x057f, 0x059f, 0x057f, 0x055f, 0x053f, 0x04ff, 0x04ff, 0x04df, 0x04bf, 0x049f, 0x049f, 0x047f, 0x045f, 0x043f, 0x041f, 0x041f, 0x043f, 0x045f, 0x04bf, 0x04ff, 0x055f, 0x05df, 0x0e1f, 0xa111, 0xa111, 0xa111, 0xa112, 0x8931, 0x4930, 0x4130, 0x410f, 0x410e, 0x38ee, 0x30ed, 0x30ed, 0x30cc, 0x28cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20cb, 0x20ab, 0x20ab, 0x20cb, 0x28ab, 0x20cb, 0x612e, 0xd1f3, 0xc9f3, 0xc1b2, 0x612e, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cc, 0x30cd, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x38ed, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x390e, 0x38ee, 0x390e, 0x390e, 0x390e, 0x410f, 0x410f, 0x410f, 0x410f, 0x410f, 0x410f, 0x4130, 0x4930, 0x4930, 0x4931, 0x4930, 0x4133, 0x197a, 0x01de, 0x021f, 0x027f, 0x02bf, 0x02ff, 0x033f, 0x037f, 0x03bf, 0x03ff, 0x045f, 0x049f, 0x04df, 0x051f, 0x057f, 0x059f, 0x05df, 0x05df, 0x05df, 0x05bf, 0x059f, 0x055f, 0x055f, 0x053f, 0x051f, 0x04ff, 0x04df, 0x04df, 0x04bf, 0x047f, 0x045f, 0x043f, 0x043f, 0x047f, 0x04bf, 0x04ff, 0x053f, 0x05bf, 0x061f, 0x069f, 0x9972, 0xa111, 0xa111, 0xa111, 0xa111, 0x5130, 0x4910, 0x410f, 0x390f, 0x390e, 0x38ed, 0x30ed, 0x30cd, 0x28cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20cb, 0x28ab, 0x510d, 0xd1f3, 0xc9d2, 0x816f, 0x30cc, 0x28ac, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cc, 0x30cd, 0x30ed, 0x30ed, 0x30cd, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x38ed, 0x38ed, 0x38ed, 0x38ed, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x390e, 0x390e, 0x390e, 0x390e, 0x390e, 0x410f, 0x410f, 0x410f, 0x410f, 0x4110, 0x410f, 0x4910, 0x4930, 0x4930, 0x4930, 0x4931, 0x4932, 0x31b6, 0x0a9d, 0x02ff, 0x035f, 0x039f, 0x03ff, 0x043f, 0x047f, 0x04bf, 0x051f, 0x055f, 0x05bf, 0x05df, 0x061f, 0x063f, 0x063f, 0x05ff, 0x05df, 0x05bf, 0x059f, 0x059f, 0x057f, 0x055f, 0x053f, 0x051f, 0x04ff, 0x04df, 0x04bf, 0x047f, 0x047f, 0x047f, 0x049f, 0x04df, 0x053f, 0x057f, 0x05ff, 0x065f, 0x06df, 0x7a95, 0xa111, 0xa111, 0xa111, 0xa111, 0x6911, 0x4930, 0x410f, 0x410f, 0x390e, 0x38ee, 0x30ed, 0x30cd, 0x28cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20cb, 0x20cb, 0x20ab, 0x20ab, 0x40ec, 0xc1d2, 0xc1b3, 0x490d, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cc, 0x30ec, 0x30cd, 0x30cd, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x38ed, 0x38ed, 0x38ed, 0x38ed, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x390e, 0x390e, 0x390f, 0x410f, 0x410f, 0x410f, 0x410f, 0x4910, 0x4910, 0x4930, 0x4931, 0x4951, 0x4951, 0x39d5, 0x131c, 0x041f, 0x047f, 0x04bf, 0x051f, 0x055f, 0x059f, 0x05df, 0x061f, 0x067f, 0x069f, 0x069f, 0x067f, 0x065f, 0x061f, 0x05ff, 0x05ff, 0x05bf, 0x059f, 0x057f, 0x055f, 0x053f, 0x051f, 0x04ff, 0x04df, 0x04bf, 0x04bf, 0x04bf, 0x04df, 0x051f, 0x057f, 0x05bf, 0x063f, 0x069f, 0x071f, 0x5438, 0xa111, 0xa111, 0xa111, 0xa111, 0x8111, 0x4930, 0x410f, 0x410f, 0x390e, 0x38ee, 0x30ed, 0x30ed, 0x30cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x30cb, 0xa992, 0xa9b1, 0x30cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cc, 0x30cc, 0x30cc, 0x30ec, 0x30ec, 0x30cd, 0x30ed, 0x30ed, 0x30cd, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x38ed, 0x38ed, 0x38ed, 0x38ed, 0x38ee, 0x38ee, 0x38ee, 0x390e, 0x390e, 0x390e, 0x410f, 0x410f, 0x410f, 0x410f, 0x410f, 0x412f, 0x4930, 0x4930, 0x5130, 0x4931, 0x5131, 0x3a15, 0x237b, 0x053f, 0x059f, 0x5358, 0x349b, 0x0e1f, 0x06bf, 0x06ff, 0x06ff, 0x06df, 0x06bf, 0x069f, 0x065f, 0x063f, 0x061f, 0x05ff, 0x05df, 0x05bf, 0x059f, 0x057f, 0x055f, 0x051f, 0x04ff, 0x04df, 0x04df, 0x04ff, 0x051f, 0x055f, 0x059f, 0x05ff, 0x065f, 0x06df, 0x073f, 0x359b, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0x4930, 0x4910, 0x412f, 0x390e, 0x38ee, 0x30ed, 0x30ed, 0x30cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x692f, 0x816f, 0x20ab, 0x20cb, 0x20ab, 0x28cb, 0x28cb, 0x28cb, 0x28ab, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cc, 0x30cc, 0x30cd, 0x30cd, 0x30cd, 0x30cd, 0x30cd, 0x30cd, 0x30cd, 0x30cd, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x38ed, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x390e, 0x390e, 0x410f, 0x410f, 0x410f, 0x410f, 0x412f, 0x4930, 0x4930, 0x4930, 0x4931, 0x4931, 0x5131, 0x49d4, 0x243a, 0xa132, 0xa8f1, 0xa8f1, 0xa8f1, 0x8295, 0x8295, 0x5418, 0x351b, 0x06df, 0x069f, 0x067f, 0x065f, 0x063f, 0x05ff, 0x05ff, 0x05bf, 0x059f, 0x057f, 0x055f, 0x053f, 0x051f, 0x051f, 0x053f, 0x057f, 0x059f, 0x05df, 0x063f, 0x069f, 0x06ff, 0x077f, 0x0f5f, 0xa111, 0xa111, 0xa111, 0xa111, 0x9931, 0x6911, 0x4930, 0x410f, 0x390e, 0x38ee, 0x30ed, 0x30ed, 0x30cd, 0x30cc, 0x28cc, 0x28cb, 0x28cb, 0x28cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20cb, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20cb, 0x20ab, 0x28cb, 0x28ab, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cc, 0x30cc, 0x30cc, 0x30cd, 0x30cd, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ee, 0x38ed, 0x38ed, 0x390e, 0x390e, 0x390e, 0x410e, 0x410f, 0x410f, 0x410f, 0x410f, 0x4130, 0x4930, 0x4930, 0x4930, 0x5131, 0x5131, 0x6992, 0xa8f1, 0xa911, 0xa8f1, 0xa911, 0xa8f1, 0xa8f1, 0xa8f1, 0xa172, 0x4c39, 0x2d5c, 0x069f, 0x065f, 0x063f, 0x061f, 0x05ff, 0x05df, 0x059f, 0x057f, 0x055f, 0x055f, 0x055f, 0x057f, 0x059f, 0x05df, 0x061f, 0x067f, 0x06df, 0x073f, 0x079f, 0x07df, 0x8254, 0xa111, 0xa131, 0xa111, 0x9911, 0x8131, 0x4910, 0x410f, 0x410e, 0x38ee, 0x38ed, 0x30ed, 0x30cd, 0x30cc, 0x28cc, 0x28cb, 0x28cb, 0x28cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x28ab, 0x28ab, 0x20cb, 0x20cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30ec, 0x30ec, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x390e, 0x390f, 0x410f, 0x410f, 0x410f, 0x412f, 0x4930, 0x4910, 0x4930, 0x5131, 0x5131, 0x6931, 0xa111, 0xa8f1, 0xa8f1, 0xa8f1, 0xa8f1, 0xa911, 0xa111, 0xa911, 0xa0f1, 0x9972, 0x4419, 0x067f, 0x065f, 0x061f, 0x05ff, 0x05df, 0x05bf, 0x059f, 0x059f, 0x05bf, 0x05bf, 0x05df, 0x061f, 0x065f, 0x06bf, 0x06ff, 0x075f, 0x07bf, 0x07ff, 0x5498, 0xa131, 0xa111, 0xa111, 0xa111, 0x9911, 0x4930, 0x410f, 0x410f, 0x38ee, 0x38ee, 0x30ed, 0x30cd, 0x30cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20ca, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20ab, 0x20ab, 0x28cb, 0x20cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cc, 0x30cc, 0x30ec, 0x30ec, 0x30cd, 0x30ed, 0x30ed, 0x30ed, 0x38ed, 0x38ee, 0x390e, 0x390e, 0x390e, 0x390f, 0x410f, 0x410f, 0x490f, 0x412f, 0x4910, 0x4930, 0x4931, 0x4931, 0x5931, 0x9111, 0xa8f1, 0xa8f1, 0xa911, 0xa8f1, 0xa8f1, 0xa911, 0xa911, 0xa911, 0xa111, 0x7a55, 0x34bb, 0x065f, 0x061f, 0x05ff, 0x05df, 0x05df, 0x05df, 0x05df, 0x05ff, 0x063f, 0x065f, 0x069f, 0x06df, 0x071f, 0x077f, 0x07bf, 0x07ff, 0x2e3c, 0x9911, 0xa111, 0xa111, 0x9931, 0x9931, 0x6910, 0x410f, 0x410f, 0x38ee, 0x38ee, 0x30ed, 0x30ed, 0x30cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x20cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20cb, 0x20cb, 0x20cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cc, 0x30ec, 0x30cd, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x390e, 0x410f, 0x410f, 0x410f, 0x410f, 0x4910, 0x4930, 0x4931, 0x5131, 0x7931, 0xa911, 0xa8f1, 0xa911, 0xa911, 0xa911, 0xa911, 0xa8f1, 0xa111, 0xa111, 0xa111, 0xa111, 0x91b3, 0x62f6, 0x347b, 0x061f, 0x061f, 0x063f, 0x063f, 0x065f, 0x067f, 0x06bf, 0x071f, 0x073f, 0x079f, 0x07df, 0x07ff, 0x07ff, 0xa111, 0x9912, 0x9911, 0x9931, 0x9932, 0x8131, 0x4130, 0x410f, 0x410e, 0x38ee, 0x30ee, 0x30ed, 0x30cd, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x28cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20ab, 0x28ab, 0x28ab, 0x28ab, 0x28ab, 0x28ab, 0x28ab, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cc, 0x30cd, 0x30ed, 0x30ed, 0x30ed, 0x30ed, 0x38ee, 0x38ee, 0x38ee, 0x38ee, 0x390f, 0x410f, 0x410f, 0x410f, 0x4910, 0x4930, 0x4930, 0x4930, 0x7111, 0xa911, 0xa911, 0xa911, 0xa911, 0xa111, 0xa911, 0xa911, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0x91b3, 0x349b, 0x065f, 0x067f, 0x069f, 0x06bf, 0x06ff, 0x073f, 0x077f, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x7ad4, 0xa111, 0x9911, 0xa111, 0x9931, 0x9931, 0x4930, 0x410f, 0x390e, 0x38ee, 0x30ee, 0x30ed, 0x30ed, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x28cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x28ab, 0x28ab, 0x28ab, 0x28ab, 0x20cb, 0x20cb, 0x20cb, 0x20cb, 0x20cb, 0x20cb, 0x20cb, 0x20cb, 0x20cb, 0x20cb, 0x20cb, 0x20cb, 0x28cb, 0x28cb, 0x20cb, 0x20cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cc, 0x30ec, 0x30cd, 0x30ed, 0x30ed, 0x30ed, 0x38ed, 0x38ee, 0x38ee, 0x390e, 0x390e, 0x410f, 0x410f, 0x4110, 0x4930, 0x4930, 0x5130, 0x8111, 0xa111, 0xa911, 0xa111, 0xa111, 0xa911, 0xa112, 0xa111, 0xa911, 0xa111, 0xa112, 0xa0f1, 0xa111, 0xa111, 0xa111, 0x7a75, 0x15fd, 0x06bf, 0x06ff, 0x071f, 0x075f, 0x079f, 0x07bf, 0x07ff, 0x07ff, 0x07ff, 0x5499, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x6930, 0x410f, 0x390e, 0x390e, 0x38ee, 0x30ed, 0x30cd, 0x30cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20cb, 0x28ab, 0x20ab, 0x28ab, 0x28ab, 0x20cb, 0x20cb, 0x20cb, 0x20cb, 0x20cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30ec, 0x30cd, 0x30ed, 0x30ed, 0x30ed, 0x38ed, 0x38ee, 0x38ee, 0x40ee, 0x410f, 0x410f, 0x410f, 0x4130, 0x4930, 0x4930, 0x5931, 0x90f1, 0xa911, 0xa912, 0xa111, 0xa111, 0xa111, 0xa911, 0xa911, 0xa111, 0xa112, 0xa111, 0xa111, 0xa111, 0xa111, 0x9972, 0x353b, 0x071f, 0x073f, 0x077f, 0x07bf, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x2e3c, 0xa111, 0x9931, 0x9931, 0x9931, 0x9931, 0x8931, 0x410f, 0x410f, 0x38ee, 0x38ee, 0x30ed, 0x30ed, 0x30cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20cb, 0x28ab, 0x20cb, 0x20cb, 0x20cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cd, 0x30cd, 0x30ed, 0x30ed, 0x30ed, 0x38ee, 0x390e, 0x390e, 0x390e, 0x410f, 0x410f, 0x412f, 0x4130, 0x4930, 0x4930, 0x8111, 0xa911, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa112, 0xa112, 0xa111, 0xa111, 0x4499, 0x077f, 0x079f, 0x07bf, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x9931, 0xa111, 0x9931, 0x9931, 0x9931, 0x9931, 0x490f, 0x410f, 0x38ee, 0x30ee, 0x38ed, 0x30ed, 0x30cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20cb, 0x28ab, 0x28ab, 0x20cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cc, 0x30cd, 0x30cd, 0x30ed, 0x30ed, 0x38ed, 0x310e, 0x38ee, 0x390e, 0x390e, 0x410f, 0x410f, 0x412f, 0x4930, 0x4930, 0x7131, 0xa111, 0xa111, 0xa112, 0xa111, 0xa0f1, 0xa111, 0xa111, 0xa112, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa131, 0x6397, 0x07bf, 0x07df, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x7ad4, 0x9931, 0x9931, 0x9931, 0x9931, 0x9912, 0x7130, 0x390f, 0x38ee, 0x38ee, 0x38ed, 0x30ed, 0x30cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x28ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20cb, 0x20cb, 0x20cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30ec, 0x30ec, 0x30ed, 0x38ee, 0x30ed, 0x38ed, 0x390e, 0x38ee, 0x410e, 0x410f, 0x410f, 0x4930, 0x4930, 0x6931, 0xa111, 0xa111, 0xa112, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa112, 0x9931, 0x9911, 0x6397, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x5c14, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9131, 0x410f, 0x390e, 0x390e, 0x30ed, 0x30ed, 0x30cc, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x28ab, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x20cb, 0x20cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cd, 0x30ed, 0x30ed, 0x38ed, 0x30ee, 0x38ee, 0x390e, 0x390e, 0x410f, 0x410f, 0x4130, 0x4930, 0x5931, 0x7911, 0x9131, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0xa111, 0x9931, 0xa111, 0x9931, 0x5498, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x35f5, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x510f, 0x390e, 0x390e, 0x38ed, 0x30ed, 0x30cc, 0x30cc, 0x28cc, 0x28cb, 0x28cb, 0x28ab, 0x20cb, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20cb, 0x28ab, 0x28cb, 0x20cb, 0x28ab, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30cd, 0x30ed, 0x30ed, 0x38ed, 0x38ee, 0x38ee, 0x390e, 0x410f, 0x410f, 0x412f, 0x4130, 0x4930, 0x4930, 0x6131, 0x8931, 0xa111, 0xa111, 0xa111, 0xa131, 0xa111, 0xa111, 0x9931, 0xa111, 0xa111, 0xa111, 0xa111, 0x3d7a, 0x07ff, 0x07ff, 0x07ff, 0x07fe, 0x07f6, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x7911, 0x390e, 0x38ee, 0x30ee, 0x30ed, 0x30cd, 0x30cc, 0x28cc, 0x28cc, 0x28cb, 0x28ab, 0x28ab, 0x20ab, 0x20ab, 0x20ca, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab,
-  0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20cb, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20ca, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x18aa, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ca, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x28cb, 0x20ab, 0x20cb, 0x20cb, 0x28cb, 0x28cb, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x28cc, 0x30cc, 0x30ec, 0x30ed, 0x30ed, 0x30ed, 0x38ee, 0x38ee, 0x390e, 0x390e, 0x410f, 0x410f, 0x410f, 0x4930, 0x4930, 0x5131, 0x6131, 0x9911, 0xa111, 0xa111, 0xa111, 0x9931, 0xa111, 0xa111, 0xa112, 0x9931, 0x9911, 0x9192, 0x1ebd, 0x07ff, 0x07ff, 0x07fe, 0x07f6, 0x7a71, 0x9931, 0x9931, 0x9932, 0x9931, 0x9931, 0x9111, 0x410e, 0x38ee, 0x30ed, 0x30ed, 0x30ed, 0x28cc, 0x28cc, 0x28cb, 0x28cb, 0x20ab, 0x28ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa,
-  0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ca, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20ab, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20aa, 0x20ca, 0x20aa, 0x20ab, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20aa, 0x20ab, 0x20aa, 0x20ab, 0x20ab, 0x20ac, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cc, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x28cd, 0x28cd, 0x28cd, 0x28cd, 0x20cd, 0x28ce, 0x28ce, 0x28ce, 0x28ee, 0x28ce, 0x28ee, 0x30ee, 0x30ef, 0x30ef, 0x30ef, 0x390f, 0x390f, 0x3910, 0x3910, 0x4110, 0x4131, 0x4931, 0x4931, 0x4932, 0x4952, 0x5152, 0x9132, 0xa111, 0xa111, 0xa111, 0x9912, 0x9931, 0x9931, 0x9911, 0x9931, 0x9912, 0x8274, 0x07ff, 0x07ff, 0x07fd, 0x07f6, 0x5c32, 0x9911, 0x9931, 0x9932, 0x9931, 0x9931, 0x9931, 0x5910, 0x390f, 0x30ef, 0x30ef, 0x30ee, 0x30ce, 0x28cd, 0x28ee, 0x28ed, 0x28cd, 0x20cd, 0x20ac, 0x20cd, 0x20cd, 0x20ad, 0x20cd, 0x20ad, 0x20cc, 0x20cc, 0x20ad, 0x20cc, 0x20ac, 0x20cc, 0x20cc, 0x20ac, 0x20ac, 0x20cc, 0x20cc, 0x20cc, 0x20cc, 0x20cc, 0x20cc, 0x20cc, 0x20cc,
-  0x18d2, 0x10f2, 0x18d2, 0x10f2, 0x10f2, 0x10f2, 0x10f2, 0x10f2, 0x10f2, 0x10f2, 0x10f2, 0x10f2, 0x18d2, 0x18d2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18d2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f3, 0x18f3, 0x18f2, 0x20f2, 0x18f2, 0x18f2, 0x20f2, 0x18f3, 0x18f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f2, 0x18f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x2113, 0x20f3, 0x20f3, 0x2113, 0x20f3, 0x20f3, 0x2113, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x2113, 0x2113, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x2113, 0x20f3, 0x2113, 0x2113, 0x2113, 0x28f3, 0x28f3, 0x2113, 0x28f3, 0x28f3, 0x2913, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2113, 0x2913, 0x2914, 0x2113, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2914, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2913, 0x2913, 0x28f3, 0x28f3, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x28f3, 0x2913, 0x2113, 0x2913, 0x2914, 0x2913, 0x2913, 0x2914, 0x2914, 0x2914, 0x2914, 0x2914, 0x3134, 0x3134, 0x3134, 0x3134, 0x3134, 0x3934, 0x3934, 0x3935, 0x3955, 0x4155, 0x4155, 0x4176, 0x4176, 0x4976, 0x4977, 0x5176, 0x9132, 0xa111, 0xa111, 0x9931, 0x9911, 0xa111, 0x9931, 0x9931, 0x9912, 0x9931, 0x5c38, 0x07ff, 0x07fd, 0x07f6, 0x44f2, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x7933, 0x3955, 0x3135, 0x3134, 0x3114, 0x2133, 0x2113, 0x2113, 0x20f3, 0x20f3, 0x2113, 0x1912, 0x18f2, 0x20f3, 0x18f2, 0x18f3, 0x18f2, 0x18f3, 0x18f3, 0x18f3, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18d2, 0x18d2, 0x18d2, 0x18d2,
-  0x10f2, 0x18d2, 0x18d2, 0x10d2, 0x18d2, 0x18d2, 0x18d2, 0x18d2, 0x18d2, 0x18d2, 0x18d2, 0x18d2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18d2, 0x18f2, 0x18f2, 0x18d2, 0x18d2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f3, 0x18f3, 0x18f3, 0x18f3, 0x18f3, 0x18f2, 0x18f3, 0x18f3, 0x20f2, 0x18f3, 0x18f3, 0x18f3, 0x18f3, 0x18f3, 0x18f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x2112, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x2113, 0x20f2, 0x20f3, 0x20f2, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x20f3, 0x2113, 0x28f3, 0x2113, 0x20f3, 0x2113, 0x28f3, 0x20f3, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x28f3, 0x28f3, 0x2113, 0x2113, 0x2113, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2113, 0x2913, 0x2913, 0x2913, 0x2914, 0x2913, 0x2913, 0x28f3, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x28f3, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2113, 0x2913, 0x2913, 0x2914, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2913, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2113, 0x2913, 0x28f3, 0x28f3, 0x2913, 0x2113, 0x2913, 0x2913, 0x2113, 0x2113, 0x28f3, 0x2913, 0x2113, 0x2914, 0x2914, 0x2914, 0x2914, 0x2914, 0x2914, 0x2914, 0x2914, 0x3134, 0x3134, 0x3134, 0x3135, 0x3935, 0x3935, 0x3955, 0x3955, 0x4155, 0x4156, 0x4176, 0x4976, 0x4956, 0x5176, 0x9132, 0xa111, 0xa112, 0xa111, 0x9931, 0x9931, 0x9911, 0x9932, 0x9931, 0x9911, 0x2e5c, 0x07fc, 0x07f6, 0x2e53, 0x9931, 0x9931, 0x9931, 0x9911, 0x9911, 0x9931, 0x9132, 0x3134, 0x3134, 0x3134, 0x2934, 0x2914, 0x2913, 0x2113, 0x2113, 0x20f3, 0x2112, 0x20f3, 0x20d3, 0x1912, 0x18f2, 0x18f3, 0x18f2, 0x18f2, 0x18f2, 0x18d2, 0x18f2, 0x20f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18f2, 0x18d2, 0x18d2, 0x18d2, 0x18d2,
-  0x1d7c, 0x1d7c, 0x1d7c, 0x1d7c, 0x1d7c, 0x1d7c, 0x1d7c, 0x1d7c, 0x1d7c, 0x1d7c, 0x1d7c, 0x1d7c, 0x1d9c, 0x1d9c, 0x1d9c, 0x1d9c, 0x1d9c, 0x1d9c, 0x1d9c, 0x1d9c, 0x1d9d, 0x1d9d, 0x1d9d, 0x1d9d, 0x259c, 0x1dbc, 0x1d9d, 0x259d, 0x1d9c, 0x259c, 0x259c, 0x259c, 0x259c, 0x259c, 0x25bd, 0x25bd, 0x25bd, 0x25bd, 0x25bd, 0x25bd, 0x25bd, 0x25bd, 0x25bd, 0x25bd, 0x25bd, 0x25bd, 0x25bd, 0x25bd, 0x25dd, 0x25dd, 0x25bd, 0x25bd, 0x1ddd, 0x25dd, 0x25dd, 0x25dd, 0x25bd, 0x25dd, 0x25dd, 0x25dd, 0x25dd, 0x25dd, 0x25dd, 0x25dd, 0x25dd, 0x25dd, 0x25fd, 0x25fd, 0x25fd, 0x25fd, 0x25fd, 0x25fd, 0x25fd, 0x25fd, 0x25fd, 0x25fd, 0x25fd, 0x25fd, 0x2dfd, 0x25fd, 0x25fd, 0x25fd, 0x25fd, 0x2dfd, 0x2dfd, 0x2dfd, 0x2dfd, 0x2dfd, 0x25fd, 0x2dfe, 0x2dfd, 0x2dfd, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e3e, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e3d, 0x2e3d, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3d, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x365e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e3e, 0x365e, 0x365e, 0x2e5d, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e5e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3e, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3e, 0x2e3d, 0x2e3e, 0x2e3d, 0x363d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e3d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x2e1d, 0x361d, 0x361d, 0x361d, 0x361d, 0x361d, 0x3e1d, 0x3e1d, 0x3e1d, 0x3e1d, 0x3e1d, 0x3e1e, 0x461e, 0x461d, 0x4dfe, 0x4dfd, 0x4e3e, 0x4dfe, 0x55dd, 0x9214, 0x9931, 0x9931, 0x9931, 0x9932, 0x9931, 0x9911, 0x9911, 0x9931, 0x7a74, 0x07fb, 0x07f6, 0x07f6, 0x9931, 0x9931, 0x9911, 0x9932, 0x9931, 0x9931, 0x9931, 0x4cfb, 0x3dfe, 0x35dd, 0x35dd, 0x2ddd, 0x2ddd, 0x2ddd, 0x2ddd, 0x25dd, 0x25dd, 0x25bd, 0x25bd, 0x25dd, 0x25dd, 0x25bd, 0x25dc, 0x25bd, 0x25bd, 0x25bd, 0x1dbd, 0x25bc, 0x1dbd, 0x1dbd, 0x1dbc, 0x1dbc, 0x1dbc, 0x1dbc, 0x1dbc, 0x1dbc, 0x1d9d, 0x1d9d, 0x1d9d, 0x1d9d,
-  0x1c7c, 0x1c7c, 0x1c7c, 0x1c7b, 0x1c7c, 0x1c7c, 0x1c7c, 0x1c7c, 0x1c7c, 0x1c7c, 0x1c9c, 0x1c9c, 0x1c9c, 0x1c9c, 0x1c9c, 0x1c9c, 0x1c9c, 0x1c9c, 0x1c9c, 0x1c9c, 0x1c9c, 0x1c9c, 0x249c, 0x1c9c, 0x1d9d, 0x1d7c, 0x1cfc, 0x1c9c, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x24bc, 0x1cbc, 0x1cbc, 0x24bc, 0x24bc, 0x24bc, 0x1cbc, 0x24dc, 0x24dc, 0x24dc, 0x253d, 0x25bd, 0x253d, 0x24dd, 0x24bc, 0x24bc, 0x24dd, 0x24dd, 0x24dd, 0x24dd, 0x24dd, 0x24dd, 0x24dd, 0x24dd, 0x24dd, 0x24dd, 0x24dd, 0x24dd, 0x24dd, 0x24dd, 0x24dd, 0x24dd, 0x24fd, 0x24dc, 0x24dc, 0x24fd, 0x24fd, 0x24fc, 0x24dd, 0x24fd, 0x251c, 0x25fd, 0x255d, 0x24fd, 0x24fd, 0x24fd, 0x24fd, 0x24fc, 0x24fd, 0x24fd, 0x24fd, 0x24fd, 0x24fd, 0x24fd, 0x24fd, 0x24fd, 0x2cfd, 0x2cfd, 0x2cfd, 0x2cfd, 0x2cfd, 0x2cfd, 0x2cfd, 0x2cfd, 0x251d, 0x24fd, 0x24fd, 0x251d, 0x2d1d, 0x24fd, 0x2cfd, 0x25bd, 0x25bd, 0x253c, 0x2cfc, 0x2d1d, 0x251d, 0x2cfd, 0x2cfd, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1c, 0x2d5d, 0x2dde, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d1d, 0x2d3d, 0x2d1d, 0x2d1d, 0x2e1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d3d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2ddd, 0x2d5d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2d1d, 0x2cfd, 0x2cfd, 0x2cfd, 0x2cfd, 0x2d1d, 0x2d1d, 0x2cfd, 0x2cfd, 0x2cfd, 0x2dbd, 0x2dbd, 0x2cfd, 0x2d1d, 0x251c, 0x251c, 0x2cfd, 0x2cfd, 0x2cfd, 0x2cfd, 0x2cfd, 0x2cfd, 0x2cfd, 0x2cfd, 0x2cfd, 0x34fd, 0x34fd, 0x34fd, 0x34fd, 0x34fd, 0x3cfd, 0x3cfd, 0x3cfd, 0x3cfd, 0x3d1d, 0x451d, 0x451d, 0x451d, 0x4d1d, 0x4d1d, 0x553d, 0x91b3, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0xa112, 0x9931, 0x9931, 0x5496, 0x07f7, 0x07f7, 0x8a13, 0xa111, 0x9931, 0x9931, 0x9912, 0x9932, 0x9911, 0x6318, 0x34dd, 0x34dd, 0x2cdd, 0x2cdc, 0x2cdd, 0x2cbc, 0x24dc, 0x24bc, 0x24bc, 0x253c, 0x25bd, 0x253c, 0x24bc, 0x24bc, 0x24bc, 0x1cbc, 0x24bc, 0x1cbc, 0x1cbc, 0x24bc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1cbc, 0x1c9c, 0x1c9c, 0x1c9c, 0x1c9c, 0x1c9c, 0x1c9c,
-  0x1abb, 0x1abb, 0x1abb, 0x1abb, 0x1abb, 0x1abb, 0x1abb, 0x1abb, 0x1abb, 0x1abb, 0x1abb, 0x1abb, 0x1abb, 0x1abb, 0x1abb, 0x1abb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1b3b, 0x1cfc, 0x157c, 0x1c1c, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x22db, 0x22db, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x22db, 0x22db, 0x22fb, 0x231c, 0x1d1c, 0x1d5c, 0x235b, 0x22dc, 0x22db, 0x22dc, 0x22fb, 0x22fc, 0x22dc, 0x22dc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fb, 0x22fb, 0x22fb, 0x22fb, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x231b, 0x22fc, 0x233c, 0x253c, 0x1cfd, 0x22fc, 0x22fc, 0x22fb, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x22fc, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x2afc, 0x2afc, 0x231c, 0x2b1c, 0x2b1c, 0x259c, 0x247c, 0x231c, 0x231c, 0x2b1c, 0x231c, 0x231c, 0x2b1c, 0x231c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x25bd, 0x2bbc, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x231c, 0x2b1c, 0x2b1c, 0x25dd, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x231c, 0x2b1c, 0x2b7c, 0x259d, 0x2b1c, 0x2b1c, 0x231c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x231c, 0x245d, 0x259c, 0x22fc, 0x2afc, 0x231c, 0x2afc, 0x22fc, 0x231c, 0x231c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2b1c, 0x2afc, 0x2b1c, 0x2b1c, 0x2b1c, 0x331c, 0x331c, 0x331c, 0x331c, 0x331c, 0x3b1c, 0x3b3d, 0x3b3d, 0x3b3d, 0x433c, 0x433d, 0x4b3d, 0x435d, 0x5a9a, 0x9932, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x1737, 0x07f9, 0x72d4, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x8194, 0x331c, 0x32fc, 0x2afb, 0x2afc, 0x2afb, 0x22fb, 0x22dc, 0x22dc, 0x22fb, 0x22db, 0x22db, 0x235c, 0x1d5c, 0x1d1d, 0x231b, 0x1adb, 0x1adb, 0x1adb, 0x22db, 0x1abb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1adb, 0x1abb, 0x1abb, 0x1adb, 0x1adb, 0x1adb, 0x1adb,
-  0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x1b7b, 0x137b, 0x1b5b, 0x1b7b, 0x137b, 0x137b, 0x137b, 0x139b, 0x1bbb, 0x14fb, 0x153c, 0x13fb, 0x1b7b, 0x139b, 0x1b7b, 0x1b7c, 0x1b9b, 0x1b7b, 0x1b7b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9c, 0x1b9b, 0x1b9b, 0x1b9b, 0x139c, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9c, 0x1b9b, 0x1d3c, 0x1d5c, 0x1bfb, 0x1b9c, 0x1bbb, 0x1b9b, 0x1bbc, 0x1b9b, 0x1b9b, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbc, 0x1bbb, 0x1bbb, 0x1bbc, 0x1bbb, 0x1bbc, 0x1bbb, 0x1bbb, 0x1bbc, 0x1bbb, 0x1bbc, 0x1bbb, 0x1bbc, 0x1bbb, 0x1cdc, 0x1d7d, 0x23fc, 0x1bdc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x23bc, 0x23bc, 0x23bc, 0x23bc, 0x23bc, 0x23bc, 0x23bc, 0x23bc, 0x1bbc, 0x1bbc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23bc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x247c, 0x1d9c, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x241c, 0x259d, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x1dbd, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x1dbd, 0x243c, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x23bc, 0x23dc, 0x23dc, 0x259c, 0x247c, 0x23bc, 0x23bc, 0x23dc, 0x23bc, 0x23dc, 0x23dc, 0x23bc, 0x23bc, 0x23bc, 0x23dc, 0x23dc, 0x23dc, 0x23dc, 0x2bdc, 0x2bdc, 0x2bdc, 0x2bdc, 0x2bdc, 0x33dc, 0x33dc, 0x33dc, 0x33dc, 0x3bdc, 0x3bfc, 0x3bfc, 0x3bdc, 0x43fc, 0x43fd, 0x6b18, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9932, 0x9931, 0x6b53, 0x07fa, 0x5437, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9912, 0x9931, 0x2bbc, 0x2bbc, 0x2bbc, 0x2bbb, 0x23bb, 0x23bb, 0x239b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1bdb, 0x1d5c, 0x1d1c, 0x1b9b, 0x1b9b, 0x139b, 0x139c, 0x1b9b, 0x1b7b, 0x1b7b, 0x139b, 0x1b9b, 0x1b9b, 0x1b7b, 0x1b9b, 0x139b, 0x1b7b, 0x1b7b, 0x1b9b, 0x1b9b,
-  0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x137b, 0x135a, 0x135a, 0x137b, 0x135a, 0x135b, 0x139b, 0x14bb, 0x14fb, 0x13fb, 0x137b, 0x137b, 0x135b, 0x137b, 0x137a, 0x137a, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x1b7b, 0x1b7b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x137b, 0x1bbb, 0x153c, 0x151c, 0x1b7b, 0x139b, 0x137b, 0x139b, 0x139b, 0x1b9b, 0x139b, 0x1b9b, 0x1b9b, 0x139b, 0x139b, 0x139b, 0x139b, 0x139b, 0x139b, 0x139b, 0x139b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x13bb, 0x139b, 0x1b9b, 0x139b, 0x1b9b, 0x1b9b, 0x1b9c, 0x1c3b, 0x1d5c, 0x1c3c, 0x1b9b, 0x1bbb, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1b9b, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbc, 0x1bbb, 0x1bbb, 0x1c9c, 0x1d1c, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bdb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1cfc, 0x1c7c, 0x1bbb, 0x1bdb, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbb, 0x1bdc, 0x23bc, 0x1bbb, 0x1d7c, 0x1bbb, 0x1bdc, 0x1bbb, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbc, 0x1b9c, 0x1bdc, 0x1bbb, 0x1c5b, 0x1cfb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbb, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbc, 0x1bbb, 0x1bbb, 0x1bbb, 0x1b9b, 0x1d3c, 0x1cbc, 0x1bbb, 0x1bbb, 0x1b9b, 0x1b9c, 0x1b9c, 0x1b9b, 0x1b9b, 0x1bbb, 0x1b9c, 0x1b9b, 0x1bbb, 0x239b, 0x23bc, 0x23bc, 0x23bc, 0x23bc, 0x23bc, 0x2bbc, 0x2bbc, 0x2bbc, 0x2bbc, 0x33bc, 0x33bc, 0x33dc, 0x3bdc, 0x3bdc, 0x3bdc, 0x3bdc, 0x8194, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9911, 0x9931, 0x2659, 0x4c98, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x4b19, 0x23bc, 0x239b, 0x239b, 0x239b, 0x1b9b, 0x1b9b, 0x1b9b, 0x1b7b, 0x1b7b, 0x1b7b, 0x1b7b, 0x137b, 0x137b, 0x137b, 0x14bb, 0x151b, 0x13db, 0x137b, 0x137a, 0x137b, 0x137b, 0x137a, 0x137b, 0x137b, 0x137b, 0x135b, 0x137b, 0x135b, 0x135b, 0x135b, 0x137b,
-  0x0999, 0x0999, 0x0999, 0x0999, 0x1199, 0x11ba, 0x11ba, 0x11b9, 0x09b9, 0x11ba, 0x1199, 0x11ba, 0x11ba, 0x1199, 0x11da, 0x0b3a, 0x0c9b, 0x0bfb, 0x127a, 0x11ba, 0x119a, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x119a, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x119a, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x12ba, 0x14bb, 0x13fb, 0x11db, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11da, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11bb, 0x11ba, 0x11da, 0x11ba, 0x11da, 0x11ba, 0x11ba, 0x11da, 0x11ba, 0x127a, 0x14db, 0x137b, 0x11da, 0x19ba, 0x11da, 0x11da, 0x11da, 0x11da, 0x11da, 0x11da, 0x11da, 0x11da, 0x11da, 0x11da, 0x11da, 0x11da, 0x11da, 0x19da, 0x19da, 0x19da, 0x11da, 0x11db, 0x11db, 0x11db, 0x11db, 0x11db, 0x11db, 0x11db, 0x19db, 0x11da, 0x19da, 0x1a3b, 0x14fb, 0x1afb, 0x19da, 0x11db, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19da, 0x19db, 0x19da, 0x1a1b, 0x153c, 0x1a3b, 0x19da, 0x19da, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19db, 0x19db, 0x19da, 0x19db, 0x153b, 0x19db, 0x19da, 0x19db, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x19da, 0x11db, 0x19db, 0x19da, 0x19db, 0x19fb, 0x153c, 0x123a, 0x19da, 0x19da, 0x11da, 0x11da, 0x11da, 0x11da, 0x11da, 0x19da, 0x11db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x19db, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x19db, 0x19ba, 0x11da, 0x11ba, 0x1abb, 0x14fb, 0x1a5b, 0x19ba, 0x19ba, 0x11da, 0x11da, 0x19db, 0x19db, 0x19da, 0x19db, 0x19ba, 0x19da, 0x19da, 0x19db, 0x19db, 0x19db, 0x21db, 0x21db, 0x21db, 0x21fb, 0x21fb, 0x29fb, 0x29fb, 0x29fb, 0x29fb, 0x31fb, 0x321b, 0x31fb, 0x321b, 0x41fa, 0x9912, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9912, 0x72d4, 0x4c98, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x5996, 0x21db, 0x21da, 0x19da, 0x19da, 0x19da, 0x11da, 0x11da, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11d9, 0x137a, 0x149b, 0x131a, 0x11ba, 0x119a, 0x11b9, 0x11ba, 0x11ba, 0x119a, 0x11ba, 0x119a, 0x11ba, 0x11ba, 0x11ba, 0x11ba, 0x11ba,
-  0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0b1a, 0x0b1a, 0x0afa, 0x0afa, 0x0b1a, 0x0afa, 0x0b1a, 0x0afa, 0x0b1a, 0x0b1a, 0x0c3a, 0x0c9a, 0x0bda, 0x0b1a, 0x0afa, 0x0afa, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b3a, 0x0b1a, 0x0b1a, 0x0b3a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0bdb, 0x14bb, 0x0bfa, 0x0b1a, 0x0b1a, 0x0b3a, 0x0b3a, 0x0b1a, 0x0b1a, 0x0b3a, 0x0b3a, 0x131a, 0x0b3a, 0x0b1a, 0x0b3a, 0x0b3a, 0x0b3a, 0x0b3a, 0x0b3a, 0x0b3a, 0x0b3a, 0x0b3a, 0x133b, 0x133b, 0x133a, 0x0b3a, 0x0b3a, 0x0b3a, 0x0b3a, 0x0b3a, 0x133a, 0x0b3a, 0x137a, 0x0cdb, 0x0c5b, 0x133b, 0x133b, 0x0b3a, 0x133a, 0x133a, 0x133a, 0x133a, 0x133a, 0x133a, 0x133a, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x135b, 0x135b, 0x135b, 0x135b, 0x133b, 0x133b, 0x135a, 0x0b5b, 0x133b, 0x143a, 0x147b, 0x135b, 0x135a, 0x133b, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135a, 0x13bb, 0x14db, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135a, 0x135b, 0x133b, 0x14fb, 0x135a, 0x135b, 0x135a, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135b, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x135a, 0x133a, 0x135b, 0x135a, 0x135b, 0x135b, 0x149b, 0x13fb, 0x133a, 0x135b, 0x135b, 0x135a, 0x135a, 0x135a, 0x135b, 0x135b, 0x135b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133b, 0x133a, 0x133b, 0x133a, 0x135a, 0x133a, 0x143b, 0x147b, 0x133a, 0x133a, 0x133a, 0x133a, 0x133b, 0x133a, 0x133a, 0x133b, 0x133a, 0x133a, 0x133a, 0x135b, 0x133b, 0x133b, 0x1b3b, 0x1b5b, 0x1b5b, 0x1b3b, 0x1b5b, 0x235b, 0x235b, 0x235b, 0x235b, 0x2b5b, 0x2b5b, 0x2b7b, 0x2b7b, 0x335b, 0x7235, 0x9911, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x72d5, 0x9932, 0x9932, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x71b4, 0x1b3b, 0x1b3b, 0x133a, 0x133b, 0x133a, 0x131a, 0x131a, 0x131a, 0x131a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b3a, 0x0afa, 0x0b1a, 0x0afa, 0x0bda, 0x0cbb, 0x0bda, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a,
-  0x02d9, 0x02d9, 0x02d9, 0x02d9, 0x02d9, 0x02d9, 0x02f9, 0x02d9, 0x02da, 0x0ada, 0x0afa, 0x0bfa, 0x0c5b, 0x0bfa, 0x0ad9, 0x02fa, 0x02f9, 0x02f9, 0x0af9, 0x02f9, 0x0af9, 0x02d9, 0x02f9, 0x0af9, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0af9, 0x0afa, 0x0afa, 0x0afa, 0x0c1a, 0x0c7b, 0x0b5a, 0x0afa, 0x0af9, 0x0b1a, 0x0afa, 0x0afa, 0x0afa, 0x0b1a, 0x0afa, 0x0afa, 0x0b1a, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0b1a, 0x0b1a, 0x0b1a, 0x031a, 0x0afa, 0x0b1a, 0x0b1a, 0x0afa, 0x0b1a, 0x0b1a, 0x0b1a, 0x0afa, 0x0c3a, 0x0c5a, 0x0b1a, 0x0afa, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0c5b, 0x0c1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b3a, 0x0c7b, 0x0b7a, 0x0b3a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0cbb, 0x0b1a, 0x0b3a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b7a, 0x0cbb, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0bda, 0x0c7b, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x0b1a, 0x131a, 0x131a, 0x131a, 0x131a, 0x131a, 0x1b1a, 0x1b3a, 0x1b3a, 0x1b3a, 0x1b3a, 0x233a, 0x233a, 0x233b, 0x2b3b, 0x2b5b, 0x3ad9, 0x9931, 0x9931, 0x9931, 0x9912, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x8993, 0x1b1a, 0x131a, 0x131a, 0x12fa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x0afa, 0x02fa, 0x0afa, 0x035a, 0x045a, 0x0c3a, 0x0afa, 0x02da, 0x0afa, 0x0af9, 0x02f9, 0x0afa, 0x0afa, 0x0afa, 0x02d9, 0x02d9,
-  0x0158, 0x0158, 0x0158, 0x0158, 0x0138, 0x0158, 0x0158, 0x0158, 0x0138, 0x0238, 0x03b9, 0x03da, 0x0259, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0138, 0x0178, 0x0158, 0x0158, 0x0159, 0x01b9, 0x037a, 0x0bda, 0x0218, 0x0958, 0x0159, 0x0159, 0x0958, 0x0158, 0x0158, 0x0158, 0x0158, 0x0958, 0x0959, 0x0158, 0x0159, 0x0179, 0x0158, 0x0159, 0x0159, 0x0159, 0x0159, 0x0158, 0x0158, 0x0158, 0x0158, 0x0979, 0x0179, 0x0958, 0x0979, 0x0159, 0x0178, 0x0159, 0x0958, 0x033a, 0x041a, 0x01f9, 0x0959, 0x0179, 0x0958, 0x0959, 0x0158, 0x0159, 0x0159, 0x0159, 0x0159, 0x0979, 0x0979, 0x0979, 0x0979, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0979, 0x0979, 0x0959, 0x0959, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0a79, 0x043a, 0x0199, 0x0959, 0x0179, 0x0179, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0979, 0x0179, 0x09b9, 0x0c3b, 0x0179, 0x0979, 0x0179, 0x0179, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0179, 0x0979, 0x0179, 0x0c7a, 0x0979, 0x0179, 0x0179, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0979, 0x0979, 0x0979, 0x0979, 0x0bfa, 0x0259, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0959, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0179, 0x0958, 0x0979, 0x0178, 0x0958, 0x0159, 0x0999, 0x0bda, 0x02d9, 0x0159, 0x0959, 0x0159, 0x0979, 0x0959, 0x0979, 0x0959, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x0979, 0x1179, 0x1179, 0x1179, 0x1179, 0x1179, 0x1999, 0x1999, 0x199a, 0x1999, 0x2199, 0x219a, 0x21ba, 0x7154, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x1179, 0x1179, 0x1179, 0x0979, 0x0979, 0x0958, 0x0958, 0x0958, 0x0958, 0x0158, 0x0158, 0x0158, 0x0958, 0x0158, 0x0158, 0x0158, 0x0158, 0x0159, 0x0158, 0x01d8, 0x0399, 0x0399, 0x01d9, 0x0158, 0x0158, 0x0138, 0x0138, 0x0158, 0x0158, 0x0158, 0x0158,
-  0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0138, 0x0137, 0x01d8, 0x0339, 0x0399, 0x0238, 0x0137, 0x0137, 0x0138, 0x0138, 0x0137, 0x0137, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0137, 0x0137, 0x0138, 0x0138, 0x0137, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0157, 0x0138, 0x0278, 0x03d9, 0x02b9, 0x0178, 0x0158, 0x0138, 0x0138, 0x0158, 0x0138, 0x0137, 0x0137, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0137, 0x0158, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0158, 0x0158, 0x0158, 0x0138, 0x0138, 0x0938, 0x0158, 0x0158, 0x0158, 0x0178, 0x0339, 0x0399, 0x0178, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x01d9, 0x03f9, 0x01f9, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x02d9, 0x0319, 0x0158, 0x0158, 0x0158, 0x0159, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0959, 0x0158, 0x0158, 0x0159, 0x041a, 0x0959, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x02b9, 0x0319, 0x0158, 0x0158, 0x0138, 0x0138, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0138, 0x0158, 0x01d8, 0x03f9, 0x01f8, 0x0138, 0x0138, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0958, 0x0958, 0x0958, 0x0958, 0x0958, 0x1158, 0x1158, 0x1158, 0x1178, 0x1179, 0x1979, 0x1979, 0x1979, 0x1979, 0x1999, 0x2179, 0x3178, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x3157, 0x0958, 0x1158, 0x0958, 0x0958, 0x0938, 0x0938, 0x0938, 0x0938, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0137, 0x0137, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0298, 0x03f9, 0x0298, 0x0137, 0x0138, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137,
-  0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x01d7, 0x0318, 0x0379, 0x0238, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0137, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0137, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0137, 0x0117, 0x0117, 0x0177, 0x0318, 0x0379, 0x01d7, 0x0137, 0x0117, 0x0137, 0x0117, 0x0137, 0x0136, 0x0117, 0x0117, 0x0137, 0x0137, 0x0117, 0x0117, 0x0137, 0x0137, 0x0137, 0x0117, 0x0137, 0x0137, 0x0137, 0x0117, 0x0117, 0x0117, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0138, 0x0137, 0x0117, 0x0157, 0x0359, 0x02f8, 0x0157, 0x0117, 0x0137, 0x0117, 0x0137, 0x0117, 0x0137, 0x0137, 0x0137, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0158, 0x0359, 0x0278, 0x0137, 0x0138, 0x0137, 0x0138, 0x0138, 0x0137, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0137, 0x0138, 0x03b9, 0x01b8, 0x0137, 0x0138, 0x0138, 0x0137, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0137, 0x0137, 0x0137, 0x0138, 0x03f9, 0x0137, 0x0138, 0x0137, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0137, 0x0138, 0x0118, 0x0138, 0x0138, 0x0178, 0x03f9, 0x0158, 0x0137, 0x0137, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0137, 0x0137, 0x0137, 0x0138, 0x0138, 0x0137, 0x0137, 0x0118, 0x0238, 0x03b9, 0x0177, 0x0137, 0x0138, 0x0137, 0x0117, 0x0137, 0x0138, 0x0137, 0x0137, 0x0137, 0x0137, 0x0937, 0x0938, 0x0938, 0x0938, 0x0938, 0x0938, 0x0958, 0x1158, 0x1158, 0x1158, 0x1158, 0x1158, 0x1958, 0x1958, 0x1959, 0x1978, 0x6934, 0x9931, 0x9931, 0x9912, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9912, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9932, 0x4135, 0x0938, 0x0957, 0x0937, 0x0937, 0x0937, 0x0937, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117, 0x0137, 0x0137, 0x0117, 0x0117, 0x0117, 0x0117, 0x0197, 0x0318, 0x0338, 0x01b7, 0x0117, 0x0117, 0x0117, 0x0117, 0x0117,
-  0x02d8, 0x02d8, 0x02d7, 0x02d7, 0x02f7, 0x0358, 0x0378, 0x02f7, 0x02d8, 0x02d8, 0x02d8, 0x02d7, 0x02d7, 0x02d7, 0x02d7, 0x02d7, 0x02d7, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02d7, 0x02f8, 0x02f8, 0x0398, 0x0378, 0x02f8, 0x02d8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x0378, 0x0398, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x0318, 0x02f8, 0x0318, 0x02f7, 0x02f8, 0x02f8, 0x0318, 0x0358, 0x0399, 0x0318, 0x02f8, 0x02f8, 0x0318, 0x0318, 0x02f8, 0x0318, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0338, 0x03b8, 0x0318, 0x0318, 0x02f8, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x03b8, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x02f8, 0x0318, 0x0318, 0x02f8, 0x0318, 0x0378, 0x0338, 0x02f8, 0x02f8, 0x0318, 0x02f8, 0x0318, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x0318, 0x0318, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x0378, 0x0338, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x0af8, 0x0af8, 0x0af8, 0x0af8, 0x0b18, 0x0b18, 0x1318, 0x1319, 0x1319, 0x1319, 0x1319, 0x1319, 0x1b18, 0x2af8, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9932, 0x9931, 0x9911, 0x9931, 0x9932, 0x9931, 0x9931, 0x9931, 0x5215, 0x0af8, 0x0af8, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d7, 0x02d8, 0x02d8, 0x0378, 0x0378, 0x02d7, 0x02d8, 0x02d7, 0x02d7, 0x02d8,
-  0x0176, 0x01b6, 0x02f8, 0x0317, 0x0217, 0x0196, 0x0176, 0x0196, 0x0196, 0x0196, 0x0196, 0x0176, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0176, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x01f7, 0x0337, 0x02d7, 0x01b6, 0x0197, 0x0196, 0x0196, 0x0176, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0197, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0237, 0x0358, 0x0217, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0196, 0x0196, 0x0197, 0x0197, 0x0196, 0x0196, 0x0277, 0x0318, 0x01b6, 0x0196, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x01b7, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x01b6, 0x02f7, 0x0257, 0x0197, 0x01b6, 0x01b7, 0x01b6, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x01b7, 0x01b6, 0x01b7, 0x0378, 0x01b7, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x01b6, 0x01f7, 0x0358, 0x0196, 0x0196, 0x01b6, 0x0196, 0x01b6, 0x0197, 0x0196, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0197, 0x0196, 0x0196, 0x0197, 0x0197, 0x02f7, 0x02f7, 0x0196, 0x0196, 0x0196, 0x0196, 0x0197, 0x0196, 0x0197, 0x01b6, 0x01b6, 0x0196, 0x0196, 0x0196, 0x0197, 0x0197, 0x0197, 0x09b7, 0x0997, 0x09b7, 0x09b7, 0x09b7, 0x11b7, 0x11b7, 0x11d7, 0x11b7, 0x11b7, 0x11b7, 0x7153, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x6174, 0x09b6, 0x0196, 0x0197, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0176, 0x0196, 0x0196, 0x0196, 0x0196, 0x0177, 0x0196, 0x02b7, 0x0337, 0x0216, 0x0196, 0x0196,
-  0x0236, 0x0317, 0x0256, 0x00f4, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00f5, 0x00f5, 0x00d5, 0x00f5, 0x00d5, 0x00d5, 0x00f5, 0x01f6, 0x0317, 0x01f6, 0x00f5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00f5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00f5, 0x00f5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00f5, 0x00d5, 0x00f5, 0x01b6, 0x0337, 0x01b6, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x0155, 0x0337, 0x0156, 0x00d5, 0x00d5, 0x00f6, 0x00f6, 0x00f6, 0x00f5, 0x00d6, 0x00d6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f6, 0x00d5, 0x00f6, 0x00f6, 0x00f5, 0x00f5, 0x00f5, 0x00f6, 0x0115, 0x0338, 0x0115, 0x00f6, 0x00f5, 0x00f6, 0x00f5, 0x00d6, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00d5, 0x00f6, 0x00d5, 0x00f5, 0x0357, 0x00f5, 0x00f6, 0x00f6, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f6, 0x00f5, 0x00d5, 0x00d5, 0x00d6, 0x00d6, 0x00d5, 0x00f5, 0x02f7, 0x0176, 0x00f5, 0x00d5, 0x00f5, 0x00f6, 0x00f6, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00d5, 0x00f5, 0x00d5, 0x0116, 0x02f7, 0x01d6, 0x00d6, 0x00d5, 0x00f5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00f5, 0x00d5, 0x00d5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x08f6, 0x08f6, 0x08f6, 0x08f6, 0x0916, 0x0916, 0x10f6, 0x1117, 0x1116, 0x3135, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9911, 0x9912, 0x9931, 0x9931, 0x9931, 0x9931, 0x7113, 0x08f5, 0x08f6, 0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d4, 0x00d5, 0x00d5, 0x00d5, 0x01d6, 0x02f7, 0x0236, 0x0114,
-  0x01f4, 0x0113, 0x00b3, 0x00d3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00d3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00d3, 0x00b3, 0x00d3, 0x00d4, 0x00b3, 0x00b3, 0x00d4, 0x00b3, 0x00b3, 0x00d4, 0x00b3, 0x00d3, 0x0133, 0x0275, 0x0255, 0x0134, 0x00d3, 0x00b3, 0x00d3, 0x00d3, 0x00d4, 0x00d4, 0x00b4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00b4, 0x00d4, 0x00b4, 0x00d4, 0x00d4, 0x00b4, 0x00b4, 0x01d4, 0x02b5, 0x0134, 0x00d4, 0x00b4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00f4, 0x02b5, 0x01b5, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x01b5, 0x0255, 0x00d5, 0x00b4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x02f6, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x01f5, 0x0235, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00d4, 0x00d4, 0x00b4, 0x0154, 0x02b5, 0x0134, 0x00d4, 0x00b4, 0x00b4, 0x00d4, 0x00d4, 0x00d4, 0x00b4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x00d4, 0x08d4, 0x08d4, 0x08d4, 0x08f4, 0x08f4, 0x08f4, 0x08f5, 0x10f4, 0x10d5, 0x7912, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x8132, 0x00d4, 0x00d4, 0x00d4, 0x00d3, 0x00d3, 0x00d3, 0x00d3, 0x00d3, 0x00b3, 0x00d3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b2, 0x00b3, 0x00d3, 0x00d3, 0x0214, 0x0295,
-  0x00b1, 0x0091, 0x0091, 0x0091, 0x00b1, 0x0091, 0x00b1, 0x00b1, 0x0091, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x0091, 0x0091, 0x00d2, 0x01b2, 0x0273, 0x0172, 0x00b1, 0x00b2, 0x00b1, 0x00b1, 0x00b2, 0x00b1, 0x00b1, 0x00b2, 0x00b1, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b1, 0x00b1, 0x00b2, 0x00b2, 0x00b1, 0x00b2, 0x00b2, 0x00b2, 0x01d3, 0x0253, 0x0112, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x0213, 0x01d3, 0x0092, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x0253, 0x0153, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x0294, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00f2, 0x0293, 0x00d2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b1, 0x00b2, 0x0172, 0x0253, 0x00b1, 0x00b1, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b1, 0x00b1, 0x00b1, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x08b2, 0x08b2, 0x08b2, 0x08d2, 0x08b2, 0x08d2, 0x08d3, 0x10d3, 0x40f2, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x00d2, 0x00b2, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x0091, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x0091, 0x0131,
-  0x0090, 0x0070, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0111, 0x0212, 0x01d1, 0x00d0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00b0, 0x01d2, 0x01f2, 0x00b0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00b0, 0x00b0, 0x0171, 0x0212, 0x00b0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00b0, 0x00b0, 0x0090, 0x0090, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x0090, 0x0090, 0x0090, 0x00b0, 0x00b0, 0x0090, 0x0090, 0x00f1, 0x0252, 0x00b0, 0x0090, 0x00b0, 0x0090, 0x0090, 0x00b0, 0x00b0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00b0, 0x00b0, 0x0090, 0x0090, 0x0272, 0x00b0, 0x0090, 0x00b0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x0090, 0x0090, 0x0090, 0x0090, 0x01d1, 0x0171, 0x0091, 0x00b0, 0x00b0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x01d1, 0x01d1, 0x0090, 0x00b0, 0x0090, 0x0090, 0x0090, 0x00b0, 0x00b0, 0x00b0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0091, 0x0091, 0x0091, 0x0091, 0x08b1, 0x08b1, 0x08b1, 0x08b1, 0x08b1, 0x08b1, 0x08b1, 0x8912, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9911, 0x9911, 0x9912, 0x9931, 0x0091, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090,
-  0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00b0, 0x0191, 0x0232, 0x0151, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00b0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00b0, 0x01f2, 0x01d1, 0x00b0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0110, 0x0252, 0x00d0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x01b1, 0x0191, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00b0, 0x0090, 0x0090, 0x0252, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0151, 0x0232, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00b0, 0x01f1, 0x0171, 0x00b0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0091, 0x00b0, 0x00b0, 0x00b1, 0x08b1, 0x08b0, 0x08b1, 0x08b1, 0x50f1, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9911, 0x9931, 0x9911, 0x9931, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0070, 0x0090, 0x0090,
-  0x008f, 0x008f, 0x008f, 0x0090, 0x0090, 0x0090, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x008f, 0x0090, 0x008f, 0x008f, 0x008f, 0x008f, 0x00d0, 0x0212, 0x01d2, 0x00d0, 0x0090, 0x008f, 0x0090, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x0090, 0x008f, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x0090, 0x0090, 0x00f0, 0x0232, 0x01b1, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0232, 0x0130, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00b0, 0x0232, 0x00d0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0252, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0232, 0x00f0, 0x0090, 0x0070, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00f0, 0x0232, 0x00f1, 0x00b0, 0x008f, 0x008f, 0x0090, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00b0, 0x00b0, 0x0890, 0x08b0, 0x0891, 0x10b0, 0x9931, 0x9911, 0x9911, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f,
-  0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x006f, 0x008f, 0x008f, 0x008f, 0x008f, 0x006f, 0x008f, 0x008f, 0x008f, 0x008f, 0x0171, 0x0232, 0x0151, 0x008f, 0x006f, 0x008f, 0x008f, 0x006f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x0070, 0x0090, 0x008f, 0x008f, 0x008f, 0x008f, 0x006f, 0x008f, 0x006f, 0x00f0, 0x0212, 0x0151, 0x006f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x008f, 0x0090, 0x008f, 0x008f, 0x008f, 0x008f, 0x0070, 0x0090, 0x01f1, 0x01b1, 0x0070, 0x008f, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x008f, 0x008f, 0x0090, 0x008f, 0x008f, 0x0130, 0x01f1, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x0252, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x0191, 0x01b1, 0x0090, 0x008f, 0x008f, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x0090, 0x0090, 0x008f, 0x0090, 0x006f, 0x008f, 0x0131, 0x0232, 0x00d0, 0x0090, 0x008f, 0x008f, 0x008f, 0x0090, 0x0090, 0x008f, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x60f1, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x0150, 0x0090, 0x0090, 0x0090, 0x006f, 0x0090, 0x006f, 0x008f, 0x008f, 0x0070, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f,
-  0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x0070, 0x008f, 0x006f, 0x008f, 0x0110, 0x0232, 0x01b1, 0x00af, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x006f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x006f, 0x008f, 0x006f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x006f, 0x0110, 0x0252, 0x0130, 0x008f, 0x006f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x006f, 0x0170, 0x01f2, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x006f, 0x008f, 0x008f, 0x01d2, 0x0130, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x006f, 0x008f, 0x008f, 0x0252, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x00cf, 0x0232, 0x00af, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x006f, 0x008f, 0x008f, 0x006f, 0x006f, 0x006f, 0x008f, 0x0191, 0x0212, 0x006f, 0x008f, 0x008f, 0x006f, 0x006f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x18af, 0x9911, 0x9912, 0x9911, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0xa111, 0x9931, 0xa111, 0x29d2, 0x01b1, 0x008f, 0x006f, 0x008f, 0x006f, 0x008f, 0x008f, 0x006f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f,
-  0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x008f, 0x008f, 0x006f, 0x006f, 0x006f, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x008f, 0x01b1, 0x0232, 0x010f, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x008f, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x008f, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x0150, 0x0232, 0x00cf, 0x006f, 0x006f, 0x008e, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x008f, 0x006f, 0x010f, 0x0212, 0x00af, 0x006f, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x008f, 0x008f, 0x006f, 0x006f, 0x008f, 0x00af, 0x0212, 0x00af, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x008f, 0x008f, 0x006f, 0x006f, 0x0252, 0x006f, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x008f, 0x006f, 0x006f, 0x01d1, 0x0130, 0x008f, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x01f1, 0x01b1, 0x008f, 0x006f, 0x006f, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x006f, 0x0090, 0x8111, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9912, 0x9932, 0x9931, 0x9931, 0x28d0, 0x01f2, 0x01d1, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006e, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f,
-  0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x008e, 0x0110, 0x0212, 0x01b1, 0x008f, 0x006f, 0x006e, 0x006f, 0x006f, 0x006e, 0x008f, 0x006e, 0x006e, 0x006e, 0x006f, 0x006f, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006f, 0x008f, 0x006e, 0x006e, 0x006f, 0x006f, 0x008e, 0x006e, 0x0191, 0x01f1, 0x00cf, 0x006f, 0x006f, 0x006e, 0x008f, 0x006e, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x008f, 0x008f, 0x006e, 0x006e, 0x006f, 0x00cf, 0x0212, 0x0110, 0x008f, 0x006f, 0x006e, 0x008f, 0x006f, 0x006e, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x0150, 0x0191, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x0232, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x0110, 0x01f1, 0x008f, 0x006e, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x00af, 0x0212, 0x0110, 0x006f, 0x006f, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x008f, 0x008f, 0x008f, 0x008f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x48d0, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x008e, 0x008f, 0x01b1, 0x01f2, 0x00af, 0x006f, 0x006e, 0x008f, 0x006e, 0x008f, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e,
-  0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x008e, 0x01b1, 0x0212, 0x00ef, 0x006e, 0x006e, 0x006e, 0x006f, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006f, 0x006e, 0x006e, 0x008e, 0x01d1, 0x01f1, 0x008f, 0x006f, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x00ae, 0x01f1, 0x0170, 0x006f, 0x006e, 0x006e, 0x006e, 0x006f, 0x006e, 0x006e, 0x006f, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x0211, 0x00cf, 0x008f, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x0232, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x008f, 0x0212, 0x00cf, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x00ef, 0x0212, 0x00cf, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006e, 0x108f, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x006e, 0x006f, 0x006e, 0x0190, 0x0212, 0x00cf, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e,
-  0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x0130, 0x0212, 0x0170, 0x008e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x00af, 0x01d1, 0x0190, 0x008e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x0190, 0x01f1, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x00ef, 0x0211, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x0232, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x0170, 0x0190, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x0150, 0x01f1, 0x008e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x68f0, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9931, 0x006e, 0x006e, 0x006e, 0x006e, 0x010f, 0x0212, 0x00ef, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e,
-  0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x008e, 0x01b1, 0x01f2, 0x00cf, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x00af, 0x0212, 0x0191, 0x006e, 0x006e, 0x004e, 0x006e, 0x006e, 0x006e, 0x004e, 0x008e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x010f, 0x0212, 0x008e, 0x006e, 0x006e, 0x004e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x0190, 0x0150, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x0232, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x008e, 0x0211, 0x008e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x0190, 0x01b1, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x38b0, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9911, 0x9931, 0x9912, 0x004e, 0x006e, 0x006e, 0x004e, 0x006e, 0x010f, 0x0212, 0x010f, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e,
-  0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x004e, 0x004d, 0x0130, 0x01f2, 0x0150, 0x006d, 0x006d, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x00ef, 0x0212, 0x010f, 0x004e, 0x006e, 0x004e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x004e, 0x00af, 0x0212, 0x00cf, 0x004e, 0x006e, 0x004e, 0x004e, 0x006e, 0x006e, 0x006e, 0x004e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x006e, 0x008e, 0x0232, 0x008e, 0x004e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x0232, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x006e, 0x004e, 0x006e, 0x006e, 0x01d1, 0x010f, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x006e, 0x006e, 0x004e, 0x006e, 0x004e, 0x006e, 0x008e, 0x01f1, 0x012f, 0x004e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x004e, 0x006e, 0x086e, 0x9911, 0x9931, 0x9931, 0x9931, 0x9931, 0x9912, 0x9931, 0x9931, 0x9911, 0x9931, 0x004e, 0x006d, 0x006e, 0x006e, 0x006e, 0x006e, 0x00ae, 0x0211, 0x0190, 0x004e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e,
-  0x004d, 0x004d, 0x004d, 0x004d, 0x006e, 0x006d, 0x004d, 0x004d, 0x004e, 0x004d, 0x004d, 0x006d, 0x006d, 0x008e, 0x01b1, 0x01d1, 0x00ce, 0x006d, 0x004d, 0x004d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x004d, 0x006e, 0x004d, 0x006e, 0x006e, 0x004e, 0x006d, 0x010f, 0x0212, 0x00ef, 0x006d, 0x006e, 0x006e, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004d, 0x006d, 0x006e, 0x006e, 0x006e, 0x004d, 0x006e, 0x004d, 0x006e, 0x01d1, 0x0150, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x0130, 0x0191, 0x006e, 0x006e, 0x004e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x0232, 0x004e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x006e, 0x004d, 0x004d, 0x004e, 0x010f, 0x01d1, 0x006e, 0x006e, 0x006e, 0x006e, 0x006d, 0x004e, 0x004e, 0x004d, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006d, 0x006d, 0x00ce, 0x0212, 0x00ce, 0x006e, 0x006e, 0x006e, 0x006e, 0x006d, 0x004d, 0x004d, 0x006d, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004e, 0x70f0, 0x9932, 0x9931, 0x9931, 0x9911, 0x9931, 0x9911, 0x9931, 0x9931, 0x8110, 0x006e, 0x006e, 0x004d, 0x006d, 0x006d, 0x006d, 0x006d, 0x008e, 0x01d1, 0x0190, 0x006d, 0x006d, 0x004e, 0x006e, 0x006e, 0x004d, 0x006d, 0x006e, 0x004d, 0x004d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x004d, 0x004d, 0x004d, 0x004d,
-  0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x006d, 0x004d, 0x004d, 0x004d, 0x0150, 0x01f1, 0x0150, 0x006d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x006d, 0x004d, 0x004e, 0x004d, 0x004d, 0x004d, 0x0150, 0x01f1, 0x00ae, 0x006d, 0x004d, 0x004d, 0x004d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x004d, 0x006d, 0x006d, 0x004d, 0x006d, 0x004d, 0x006d, 0x006d, 0x006d, 0x0170, 0x01b1, 0x006d, 0x006d, 0x004d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006d, 0x004e, 0x006e, 0x01d1, 0x010f, 0x006d, 0x006d, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004d, 0x006d, 0x006e, 0x004e, 0x0212, 0x004d, 0x004d, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x004d, 0x006d, 0x006d, 0x006d, 0x006e, 0x01f1, 0x008e, 0x006d, 0x006e, 0x004d, 0x004d, 0x006d, 0x006d, 0x004e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x004d, 0x006d, 0x004d, 0x010f, 0x01f1, 0x006d, 0x006d, 0x004d, 0x006e, 0x006d, 0x006d, 0x006d, 0x004d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x004e, 0x006d, 0x006d, 0x004d, 0x40cf, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x9931, 0x70f0, 0x004d, 0x006d, 0x004d, 0x004d, 0x006d, 0x006d, 0x004d, 0x004d, 0x006d, 0x0191, 0x01b1, 0x006d, 0x004d, 0x006d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d
+// RLE16, generated by buildroot/share/scripts/rle16_compress_cpp_image_data.py
+extern const uint8_t marlin_logo_320x240x16[62680] = {
+  0x35, 0x18, 0xad, 0x01, 0x18, 0xae, 0x18, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xae, 0x20, 0xad, 0x11, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x01, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x09, 0x18, 0xad, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x20, 0xae, 0x18, 0x18, 0xad, 0x01, 0x01, 0x19, 0x04, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xad, 0x18, 0xce, 0x00, 0xf8, 0x03, 0x01, 0x19, 0x84, 0x08, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x03, 0x18, 0xad, 0x01, 0x18, 0xae, 0x04, 0x18, 0xad, 0x83, 0x08, 0xd5, 0x01, 0x1a, 0x01, 0x19, 0x10, 0xd2, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x85, 0x18, 0xae, 0x28, 0xee, 0x82, 0x52, 0xcb, 0x54, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x82, 0x01, 0x19, 0x01, 0x1a, 0x10, 0xd2, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x1a, 0x18, 0xad, 0x01, 0x01, 0x19, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x21, 0x18, 0xad, 0x01, 0x01, 0x19, 0x04, 0x18, 0xad, 0x01, 0x01, 0x19, 0x07, 0x18, 0xad, 0x01, 0x18, 0xae,
+  0x08, 0x18, 0xad, 0x80, 0x18, 0xae, 0x2a, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x15, 0x18, 0xad, 0x01, 0x18, 0xae, 0x17, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xcd, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xad, 0x01, 0x01, 0x19, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x01, 0x01, 0x19, 0x08, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x01, 0x19, 0x1d, 0x18, 0xad, 0x01, 0x01, 0x19, 0x06, 0x18, 0xad, 0x82, 0x08, 0xf5, 0x00, 0xf9, 0x01, 0x19, 0x01, 0x00, 0xf7, 0x01, 0x01, 0x19, 0x81, 0x08, 0xf5, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xad, 0x01, 0x18, 0xae, 0x02, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xad, 0x20, 0xae, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x10, 0xd2, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x20, 0xae, 0x02, 0x18, 0xad, 0x86, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x39, 0x4f, 0xb3, 0x13, 0xd3, 0x95, 0x72, 0x11, 0x01, 0x18, 0xad, 0x80, 0x20, 0xcd, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x01, 0x19, 0x00, 0xf9, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x17, 0x18, 0xad, 0x01, 0x01, 0x19, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x21, 0x18, 0xad, 0x01, 0x01, 0x19, 0x04, 0x18, 0xad, 0x01, 0x01, 0x19, 0x09, 0x18, 0xad,
+  0x37, 0x18, 0xad, 0x80, 0x18, 0xae, 0x2f, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xad, 0x01, 0x18, 0xae, 0x84, 0x18, 0xad, 0x01, 0x1a, 0x01, 0x19, 0x18, 0xad, 0x18, 0xae, 0x06, 0x18, 0xad, 0x01, 0x01, 0x19, 0x08, 0x18, 0xad, 0x85, 0x18, 0xae, 0x01, 0x19, 0x01, 0x1a, 0x18, 0xcd, 0x20, 0xad, 0x18, 0xcd, 0x1a, 0x18, 0xad, 0x01, 0x01, 0x19, 0x04, 0x18, 0xad, 0x84, 0x20, 0xad, 0x18, 0xae, 0x01, 0x19, 0x01, 0x1a, 0x08, 0xf3, 0x01, 0x18, 0xad, 0x80, 0x08, 0xf4, 0x01, 0x01, 0x19, 0x08, 0x18, 0xad, 0x88, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x08, 0xf5, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xd2, 0x18, 0xad, 0x18, 0xae, 0x04, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x84, 0x49, 0x6f, 0xcb, 0x55, 0xd3, 0x95, 0xbb, 0x54, 0x28, 0xce, 0x02, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x83, 0x18, 0xcd, 0x18, 0xad, 0x01, 0x1a, 0x01, 0x19, 0x02, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x15, 0x18, 0xad, 0x01, 0x01, 0x19, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x21, 0x18, 0xad, 0x01, 0x01, 0x19, 0x04, 0x18, 0xad, 0x01, 0x01, 0x19, 0x07, 0x18, 0xad, 0x01, 0x20, 0xad,
+  0x4f, 0x18, 0xad, 0x80, 0x18, 0xae, 0x15, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x87, 0x20, 0xad, 0x18, 0xad, 0x10, 0xd2, 0x01, 0x1a, 0x01, 0x19, 0x10, 0xd2, 0x18, 0xad, 0x20, 0x8d, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x09, 0x18, 0xad, 0x84, 0x00, 0xfa, 0x01, 0x19, 0x10, 0xd2, 0x20, 0xad, 0x18, 0xad, 0x01, 0x20, 0xad, 0x18, 0x18, 0xad, 0x01, 0x01, 0x19, 0x05, 0x18, 0xad, 0x80, 0x18, 0xaf, 0x01, 0x01, 0x19, 0x80, 0x18, 0xd0, 0x01, 0x18, 0xad, 0x80, 0x10, 0xd0, 0x01, 0x01, 0x19, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x81, 0x18, 0xae, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x80, 0x10, 0xd2, 0x06, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x81, 0x18, 0xae, 0x61, 0xd0, 0x02, 0xd3, 0x95, 0x82, 0x69, 0xf1, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x01, 0x01, 0x19, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x16, 0x18, 0xad, 0x01, 0x01, 0x19, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x21, 0x18, 0xad, 0x01, 0x01, 0x19, 0x04, 0x18, 0xad, 0x01, 0x01, 0x19, 0x09, 0x18, 0xad,
+  0x68, 0x18, 0xad, 0x85, 0x18, 0xae, 0x18, 0xad, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf9, 0x01, 0x01, 0x1a, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x09, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x80, 0x10, 0xd2, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x18, 0x18, 0xad, 0x01, 0x01, 0x19, 0x06, 0x18, 0xad, 0x82, 0x01, 0x19, 0x01, 0x1a, 0x08, 0xf3, 0x01, 0x18, 0xad, 0x80, 0x10, 0xd3, 0x01, 0x01, 0x1a, 0x80, 0x18, 0xad, 0x01, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x86, 0x20, 0xae, 0x08, 0xf5, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xd2, 0x20, 0xad, 0x18, 0xae, 0x05, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x61, 0xd0, 0x01, 0xd3, 0x95, 0x82, 0xd3, 0x96, 0xd3, 0x75, 0x31, 0x0e, 0x04, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xcd, 0x01, 0x1a, 0x00, 0xf9, 0x05, 0x18, 0xad, 0x80, 0x18, 0xae, 0x17, 0x18, 0xad, 0x01, 0x01, 0x19, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x21, 0x18, 0xad, 0x01, 0x01, 0x19, 0x04, 0x18, 0xad, 0x01, 0x01, 0x19, 0x06, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x18, 0xae, 0x18, 0xce,
+  0x37, 0x18, 0xad, 0x80, 0x18, 0xae, 0x14, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x11, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x05, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x0a, 0x18, 0xad, 0x80, 0x08, 0xd4, 0x01, 0x01, 0x19, 0x80, 0x10, 0xd2, 0x1a, 0x18, 0xad, 0x01, 0x01, 0x19, 0x06, 0x18, 0xad, 0x80, 0x08, 0xd5, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x01, 0x17, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x08, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x83, 0x10, 0xd2, 0x20, 0xad, 0x18, 0xcd, 0x18, 0xae, 0x02, 0x18, 0xad, 0x81, 0x18, 0xae, 0x20, 0xad, 0x03, 0x18, 0xad, 0x82, 0x39, 0x2f, 0xd3, 0x95, 0xd3, 0x96, 0x02, 0xd3, 0x95, 0x80, 0x28, 0xce, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x01, 0x19, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x1c, 0x18, 0xad, 0x01, 0x01, 0x19, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x21, 0x18, 0xad, 0x01, 0x01, 0x19, 0x04, 0x18, 0xad, 0x01, 0x01, 0x19, 0x08, 0x18, 0xad, 0x80, 0x08, 0xf5,
+  0x08, 0x18, 0xad, 0x80, 0x20, 0xad, 0x47, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x20, 0xad, 0x08, 0x18, 0xad, 0x05, 0x01, 0x19, 0x84, 0x00, 0xf9, 0x01, 0x19, 0x18, 0xae, 0x18, 0xad, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x84, 0x01, 0x19, 0x01, 0x1a, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x04, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x83, 0x10, 0xd2, 0x20, 0xad, 0x18, 0xad, 0x18, 0xcd, 0x0e, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x87, 0x20, 0xad, 0x18, 0xad, 0x10, 0xd2, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xf2, 0x18, 0xae, 0x20, 0xad, 0x03, 0x18, 0xad, 0x82, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x10, 0xd2, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x81, 0x31, 0x0e, 0xcb, 0x55, 0x04, 0xd3, 0x95, 0x82, 0x82, 0x52, 0x20, 0xad, 0x18, 0xae, 0x05, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x87, 0x10, 0xd2, 0x18, 0xad, 0x18, 0xcd, 0x18, 0xad, 0x20, 0xad, 0x18, 0xad, 0x18, 0xcd, 0x18, 0xae, 0x16, 0x18, 0xad, 0x01, 0x01, 0x19, 0x03, 0x18, 0xad, 0x81, 0x18, 0xae, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x82, 0x10, 0xd2, 0x18, 0xad, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x13, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x01, 0x01, 0x19, 0x04, 0x18, 0xad, 0x83, 0x01, 0x19, 0x01, 0x1a, 0x18, 0xad, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x01, 0x19,
+  0x08, 0x18, 0xad, 0x80, 0x20, 0xad, 0x46, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0c, 0x18, 0xad, 0x80, 0x18, 0xce, 0x01, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xad, 0x01, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x07, 0x01, 0x19, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x01, 0x19, 0x80, 0x10, 0xf2, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x20, 0xad, 0x03, 0x18, 0xad, 0x85, 0x20, 0xae, 0x08, 0xf5, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xd2, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0e, 0x18, 0xad, 0x81, 0x18, 0xce, 0x00, 0xf7, 0x03, 0x01, 0x19, 0x85, 0x00, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x83, 0x10, 0xd2, 0x10, 0xd3, 0x08, 0xf3, 0x10, 0xd2, 0x03, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x86, 0x08, 0xf5, 0x01, 0x1a, 0x00, 0xf9, 0x10, 0xd2, 0x18, 0xae, 0x18, 0xad, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x81, 0x18, 0xae, 0xb3, 0x14, 0x05, 0xd3, 0x95, 0x80, 0x51, 0x90, 0x06, 0x18, 0xad, 0x81, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x81, 0x00, 0xf7, 0x18, 0xae, 0x02, 0x18, 0xad, 0x83, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x14, 0x18, 0xad, 0x01, 0x01, 0x19, 0x02, 0x18, 0xad, 0x83, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x17, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x82, 0x20, 0xad, 0x00, 0xf9, 0x01, 0x19, 0x03, 0x18, 0xad, 0x82, 0x18, 0xae, 0x01, 0x19, 0x01, 0x1a, 0x04, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x81, 0x18, 0xaf, 0x01, 0x19,
+  0x51, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xad, 0x01, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x06, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xee, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x86, 0x00, 0xf9, 0x01, 0x19, 0x01, 0x1a, 0x00, 0xf9, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x10, 0xf2, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x04, 0x18, 0xad, 0x81, 0x18, 0xae, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x10, 0xd2, 0x18, 0xae, 0x0d, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x83, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x81, 0x01, 0x1a, 0x08, 0xd5, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x05, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x03, 0x18, 0xad, 0x85, 0x20, 0xad, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x19, 0x10, 0xd2, 0x18, 0xcd, 0x0b, 0x18, 0xad, 0x80, 0x82, 0x52, 0x06, 0xd3, 0x95, 0x81, 0x41, 0x2f, 0x20, 0xad, 0x05, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x03, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x08, 0xd5, 0x1b, 0x18, 0xad, 0x01, 0x01, 0x19, 0x02, 0x18, 0xad, 0x81, 0x08, 0xf5, 0x01, 0x1a, 0x03, 0x01, 0x19, 0x81, 0x01, 0x1a, 0x08, 0xf5, 0x02, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x10, 0x18, 0xad, 0x01, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x08, 0xf4, 0x01, 0x01, 0x19, 0x01, 0x18, 0xad, 0x82, 0x20, 0xae, 0x20, 0xad, 0x18, 0xae, 0x01, 0x01, 0x19, 0x02, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x01, 0x1a,
+  0x4c, 0x18, 0xad, 0x86, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0x18, 0xad, 0x18, 0xcd, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xcd, 0x80, 0x20, 0xad, 0x07, 0x18, 0xad, 0x83, 0x03, 0x55, 0x19, 0x0f, 0x18, 0xad, 0x20, 0xad, 0x03, 0x18, 0xad, 0x82, 0x18, 0xae, 0x08, 0xf4, 0x01, 0x1a, 0x04, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x03, 0x18, 0xad, 0x86, 0x20, 0xad, 0x18, 0xad, 0x20, 0xae, 0x10, 0xd2, 0x01, 0x19, 0x01, 0x1a, 0x08, 0xf5, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x03, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x82, 0x10, 0xd2, 0x18, 0xad, 0x18, 0xae, 0x0d, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x01, 0x19, 0x80, 0x00, 0xf9, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x04, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x80, 0x20, 0x8e, 0x03, 0x18, 0xad, 0x89, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x08, 0xf5, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xd2, 0x18, 0xcd, 0x18, 0xae, 0x08, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x49, 0x6f, 0x05, 0xd3, 0x95, 0x83, 0xd3, 0x96, 0xd3, 0x95, 0x49, 0x6f, 0x20, 0xad, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x07, 0x01, 0x19, 0x1b, 0x18, 0xad, 0x01, 0x01, 0x19, 0x02, 0x18, 0xad, 0x81, 0x00, 0xf9, 0x01, 0x19, 0x02, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x11, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xad, 0x20, 0xae, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x10, 0xd2, 0x18, 0xae, 0x03, 0x18, 0xad, 0x01, 0x01, 0x19, 0x81, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x08, 0xf5,
+  0x4d, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x04, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x04, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x82, 0x11, 0xd1, 0x03, 0xb7, 0x0a, 0x93, 0x04, 0x18, 0xad, 0x83, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x01, 0x19, 0x83, 0x00, 0xf9, 0x01, 0x1a, 0x00, 0xf7, 0x18, 0xce, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x84, 0x20, 0xae, 0x10, 0xd2, 0x01, 0x1a, 0x01, 0x19, 0x08, 0xf5, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x88, 0x20, 0xad, 0x18, 0xad, 0x20, 0xae, 0x08, 0xf5, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xd2, 0x18, 0xcd, 0x18, 0xae, 0x0f, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x02, 0x18, 0xad, 0x84, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x18, 0xad, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x81, 0x18, 0xae, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x82, 0x10, 0xd2, 0x18, 0xad, 0x18, 0xae, 0x06, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x82, 0x20, 0xad, 0x28, 0xee, 0xbb, 0x34, 0x07, 0xd3, 0x95, 0x80, 0x9a, 0xb3, 0x06, 0x18, 0xad, 0x02, 0x01, 0x19, 0x01, 0x00, 0xf9, 0x02, 0x01, 0x19, 0x81, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x15, 0x18, 0xad, 0x01, 0x01, 0x19, 0x01, 0x18, 0xad, 0x82, 0x10, 0xaf, 0x01, 0x19, 0x01, 0x1a, 0x05, 0x01, 0x19, 0x80, 0x18, 0xae, 0x17, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x82, 0x10, 0xd2, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xad, 0x01, 0x01, 0x1a, 0x81, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x18, 0xce,
+  0x4b, 0x18, 0xad, 0x88, 0x20, 0xad, 0x20, 0x8d, 0x18, 0xad, 0x10, 0xd2, 0x08, 0xf3, 0x10, 0xd3, 0x10, 0xd2, 0x18, 0xad, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x07, 0x18, 0xad, 0x80, 0x03, 0x56, 0x01, 0x03, 0xb7, 0x80, 0x19, 0x0f, 0x07, 0x18, 0xad, 0x83, 0x10, 0xd2, 0x08, 0xf3, 0x08, 0xd4, 0x10, 0xd2, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x05, 0x18, 0xad, 0x83, 0x10, 0xd2, 0x00, 0xf9, 0x01, 0x19, 0x08, 0xf5, 0x04, 0x18, 0xad, 0x01, 0x18, 0xae, 0x04, 0x18, 0xad, 0x84, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x19, 0x10, 0xd2, 0x18, 0xcd, 0x0a, 0x18, 0xad, 0x85, 0x18, 0xae, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x18, 0xad, 0x01, 0x01, 0x19, 0x80, 0x00, 0xfa, 0x04, 0x01, 0x19, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x06, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x10, 0xd2, 0x18, 0xae, 0x06, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x7a, 0x31, 0x01, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0xdb, 0x95, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x03, 0x01, 0x19, 0x81, 0x00, 0xf9, 0x18, 0xae, 0x1a, 0x18, 0xad, 0x01, 0x01, 0x19, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x85, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x13, 0x18, 0xad, 0x81, 0x18, 0xae, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x10, 0xd2, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x01, 0x19, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x06, 0x18, 0xad,
+  0x08, 0x18, 0xad, 0x80, 0x20, 0xad, 0x41, 0x18, 0xad, 0x01, 0x18, 0xae, 0x82, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf9, 0x01, 0x01, 0x19, 0x83, 0x00, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x18, 0xae, 0x07, 0x18, 0xad, 0x86, 0x18, 0xce, 0x11, 0xd1, 0x03, 0xb8, 0x03, 0xb7, 0x03, 0xb8, 0x0a, 0x94, 0x20, 0xae, 0x04, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x03, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x03, 0x18, 0xad, 0x84, 0x20, 0xad, 0x10, 0xd2, 0x00, 0xf9, 0x01, 0x19, 0x08, 0xf5, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x05, 0x18, 0xad, 0x86, 0x08, 0xf5, 0x01, 0x1a, 0x00, 0xf9, 0x10, 0xd2, 0x18, 0xae, 0x18, 0xad, 0x18, 0xcd, 0x07, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x8f, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x08, 0xf5, 0x00, 0xf9, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x08, 0xf5, 0x20, 0xae, 0x18, 0xad, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xcd, 0x01, 0x18, 0xae, 0x06, 0x18, 0xad, 0x80, 0x08, 0xd5, 0x01, 0x01, 0x19, 0x81, 0x10, 0xd2, 0x18, 0xae, 0x04, 0x18, 0xad, 0x88, 0x18, 0xae, 0x18, 0xad, 0x20, 0xae, 0x18, 0xad, 0x18, 0xcd, 0x18, 0xad, 0x20, 0xad, 0x18, 0xad, 0x31, 0x0e, 0x04, 0xd3, 0x95, 0x82, 0xd3, 0x96, 0xd3, 0x95, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x80, 0xb3, 0x13, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x82, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x19, 0x02, 0x01, 0x1a, 0x83, 0x01, 0x19, 0x08, 0xf5, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x16, 0x18, 0xad, 0x01, 0x01, 0x19, 0x02, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x04, 0x01, 0x19, 0x84, 0x00, 0xf9, 0x08, 0xf5, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x12, 0x18, 0xad, 0x84, 0x20, 0xae, 0x08, 0xf5, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xd2, 0x06, 0x18, 0xad, 0x83, 0x10, 0xd2, 0x01, 0x19, 0x01, 0x1a, 0x10, 0xd2, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad,
+  0x4c, 0x18, 0xad, 0x82, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x82, 0x20, 0xae, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x03, 0x56, 0x01, 0x03, 0xb7, 0x83, 0x03, 0xb8, 0x03, 0xb7, 0x19, 0x0e, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x06, 0x18, 0xad, 0x80, 0x20, 0xad, 0x09, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x20, 0xad, 0x10, 0xd2, 0x01, 0x01, 0x1a, 0x80, 0x08, 0xf5, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x10, 0xd2, 0x18, 0xae, 0x09, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x02, 0x18, 0xad, 0x83, 0x18, 0xae, 0x01, 0x17, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xae, 0x09, 0x18, 0xad, 0x86, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x08, 0xf5, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xd2, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x08, 0x18, 0xad, 0x83, 0x20, 0xae, 0x18, 0xad, 0x18, 0xae, 0xa2, 0xd3, 0x08, 0xd3, 0x95, 0x81, 0xd3, 0x96, 0xa2, 0xd3, 0x06, 0x18, 0xad, 0x81, 0x18, 0xae, 0x01, 0x17, 0x03, 0x01, 0x19, 0x81, 0x01, 0x17, 0x18, 0xce, 0x02, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x15, 0x18, 0xad, 0x01, 0x01, 0x19, 0x02, 0x18, 0xad, 0x87, 0x18, 0xae, 0x01, 0x17, 0x00, 0xf9, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x17, 0x18, 0xae, 0x02, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x13, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x10, 0xd2, 0x20, 0xad, 0x02, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xad, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x00, 0xf7, 0x01, 0x18, 0xae, 0x03, 0x18, 0xad, 0x81, 0x20, 0xae, 0x18, 0xad,
+  0x4c, 0x18, 0xad, 0x07, 0x01, 0x19, 0x82, 0x18, 0xcd, 0x18, 0xad, 0x20, 0xae, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x81, 0x11, 0xd1, 0x03, 0xb8, 0x03, 0x03, 0xb7, 0x80, 0x0a, 0x94, 0x03, 0x18, 0xad, 0x80, 0x20, 0xae, 0x02, 0x18, 0xad, 0x80, 0x20, 0xae, 0x0d, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x20, 0xae, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x04, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x10, 0xd2, 0x20, 0xad, 0x0f, 0x18, 0xad, 0x84, 0x10, 0xd2, 0x08, 0xd4, 0x08, 0xf3, 0x10, 0xd2, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x0a, 0x18, 0xad, 0x01, 0x01, 0x19, 0x80, 0x18, 0xb0, 0x0e, 0x18, 0xad, 0x80, 0x49, 0x6f, 0x0a, 0xd3, 0x95, 0x80, 0xaa, 0xd3, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x10, 0xd1, 0x01, 0x08, 0xf3, 0x81, 0x10, 0xd2, 0x18, 0xcd, 0x1c, 0x18, 0xad, 0x01, 0x01, 0x19, 0x81, 0x18, 0xad, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x84, 0x18, 0xcd, 0x10, 0xd2, 0x08, 0xf3, 0x08, 0xd4, 0x10, 0xd2, 0x10, 0x18, 0xad, 0x84, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x08, 0xf4, 0x01, 0x01, 0x19, 0x84, 0x10, 0xd1, 0x18, 0xad, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x02, 0x18, 0xad, 0x81, 0x08, 0xf5, 0x00, 0xf9, 0x04, 0x01, 0x19, 0x83, 0x08, 0xf5, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x03, 0x18, 0xad,
+  0x09, 0x18, 0xad, 0x43, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x09, 0x18, 0xad, 0x81, 0x03, 0x56, 0x03, 0xb8, 0x04, 0x03, 0xb7, 0x80, 0x19, 0x0f, 0x01, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x0f, 0x18, 0xad, 0x83, 0x10, 0xd2, 0x00, 0xf9, 0x01, 0x19, 0x08, 0xf5, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x20, 0xad, 0x03, 0x18, 0xad, 0x84, 0x20, 0xae, 0x08, 0xf5, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xd2, 0x12, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0b, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x84, 0x01, 0x1a, 0x01, 0x19, 0x18, 0xce, 0x18, 0xad, 0x18, 0xae, 0x09, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0xb3, 0x14, 0x0b, 0xd3, 0x95, 0x82, 0x61, 0xd0, 0x18, 0xad, 0x18, 0xcd, 0x08, 0x18, 0xad, 0x80, 0x18, 0xae, 0x1d, 0x18, 0xad, 0x01, 0x01, 0x19, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x15, 0x18, 0xad, 0x01, 0x18, 0xcd, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x86, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x19, 0x10, 0xd2, 0x18, 0xae, 0x18, 0xad, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x18, 0xae, 0x18, 0xad, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x18, 0xae, 0x05, 0x18, 0xad,
+  0x09, 0x18, 0xad, 0x43, 0x01, 0x19, 0x82, 0x00, 0xf9, 0x01, 0x19, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x80, 0x00, 0xf9, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x84, 0x20, 0xad, 0x18, 0xad, 0x03, 0x97, 0x03, 0xb8, 0x03, 0xb7, 0x02, 0x18, 0xad, 0x01, 0x18, 0xae, 0x81, 0x18, 0xad, 0x20, 0xae, 0x02, 0x18, 0xad, 0x81, 0x20, 0xae, 0x18, 0xcd, 0x0f, 0x18, 0xad, 0x84, 0x18, 0xae, 0x10, 0xd2, 0x00, 0xf9, 0x01, 0x19, 0x08, 0xf5, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x04, 0x18, 0xad, 0x81, 0x18, 0xae, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x80, 0x10, 0xd2, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x0a, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x0a, 0x18, 0xad, 0x01, 0x01, 0x1a, 0x0c, 0x18, 0xad, 0x84, 0x18, 0xae, 0x18, 0xad, 0x59, 0xd0, 0xd3, 0x95, 0xd3, 0x75, 0x08, 0xd3, 0x95, 0x82, 0xd3, 0x96, 0xd3, 0x95, 0xd3, 0x96, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x1e, 0x18, 0xad, 0x01, 0x01, 0x19, 0x81, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x17, 0x18, 0xad, 0x84, 0x08, 0xf4, 0x01, 0x1a, 0x01, 0x19, 0x10, 0xd2, 0x20, 0xad, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x03, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x06, 0x18, 0xad,
+  0x4c, 0x18, 0xad, 0x82, 0x08, 0xf5, 0x01, 0x19, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x81, 0x01, 0x1a, 0x08, 0xf5, 0x02, 0x18, 0xad, 0x02, 0x20, 0xad, 0x03, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xad, 0x02, 0x03, 0xb7, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x03, 0xb7, 0x82, 0x03, 0x97, 0x03, 0xb7, 0x03, 0xb8, 0x01, 0x03, 0xb7, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x20, 0xad, 0x0c, 0x18, 0xad, 0x84, 0x18, 0xae, 0x10, 0xd2, 0x01, 0x19, 0x01, 0x1a, 0x08, 0xf5, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x03, 0x18, 0xad, 0x87, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x08, 0xf5, 0x01, 0x19, 0x01, 0x1a, 0x10, 0xd1, 0x20, 0xae, 0x10, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0a, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x01, 0x01, 0x19, 0x0b, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0xbb, 0x34, 0x0c, 0xd3, 0x95, 0x83, 0xaa, 0xd3, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x1c, 0x18, 0xad, 0x01, 0x01, 0x19, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x17, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x18, 0xad, 0x86, 0x08, 0xf5, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xd2, 0x18, 0xcd, 0x18, 0xad, 0x20, 0xad, 0x06, 0x18, 0xad, 0x80, 0x01, 0x1a, 0x05, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x18, 0xad, 0x18, 0xae, 0x04, 0x18, 0xad,
+  0x4c, 0x18, 0xad, 0x81, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x01, 0x19, 0x85, 0x01, 0x1a, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x18, 0xae, 0x05, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x03, 0xb7, 0x81, 0x18, 0xae, 0x20, 0xad, 0x01, 0x18, 0xad, 0x04, 0x03, 0xb7, 0x81, 0x03, 0x97, 0x03, 0xb7, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0a, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xae, 0x02, 0x18, 0xad, 0x83, 0x10, 0xd2, 0x01, 0x1a, 0x01, 0x19, 0x08, 0xf5, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x88, 0x20, 0xad, 0x18, 0xad, 0x20, 0xae, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x19, 0x10, 0xd2, 0x18, 0xad, 0x18, 0xae, 0x1d, 0x18, 0xad, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x18, 0xae, 0x09, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x61, 0xb1, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x0a, 0xd3, 0x95, 0x80, 0x8a, 0x92, 0x29, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1a, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x80, 0x10, 0xd2, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x84, 0x20, 0xad, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x80, 0x08, 0xf4, 0x06, 0x18, 0xad,
+  0x4b, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0x8d, 0x18, 0xad, 0x10, 0xd2, 0x01, 0x08, 0xf3, 0x82, 0x10, 0xd2, 0x18, 0xad, 0x20, 0xad, 0x06, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x02, 0x03, 0xb7, 0x01, 0x18, 0xad, 0x84, 0x18, 0xcd, 0x20, 0xad, 0x03, 0xb8, 0x03, 0xb7, 0x03, 0xb8, 0x03, 0x03, 0xb7, 0x03, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x08, 0x18, 0xad, 0x80, 0x20, 0xad, 0x04, 0x18, 0xad, 0x84, 0x20, 0xae, 0x10, 0xd2, 0x00, 0xf9, 0x01, 0x19, 0x08, 0xf5, 0x04, 0x18, 0xad, 0x01, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x83, 0x10, 0xd2, 0x18, 0xad, 0x18, 0xcd, 0x20, 0xad, 0x1b, 0x18, 0xad, 0x01, 0x01, 0x19, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x08, 0x18, 0xad, 0x84, 0x20, 0xae, 0x18, 0xad, 0xaa, 0xd3, 0xd3, 0x95, 0xd3, 0x75, 0x09, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x80, 0x31, 0x0e, 0x28, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1c, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xad, 0x01, 0x01, 0x19, 0x83, 0x10, 0xd1, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x81, 0x18, 0xce, 0x00, 0xf7, 0x03, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x03, 0x18, 0xad,
+  0x4d, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x08, 0x18, 0xad, 0x82, 0x03, 0xd7, 0x03, 0x97, 0x03, 0xb7, 0x03, 0x18, 0xad, 0x84, 0x03, 0xb7, 0x03, 0xb8, 0x03, 0x97, 0x03, 0xb7, 0x03, 0xb8, 0x01, 0x03, 0xb7, 0x83, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x18, 0xcd, 0x0a, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x85, 0x18, 0xcd, 0x20, 0xad, 0x10, 0xd2, 0x00, 0xf9, 0x01, 0x19, 0x08, 0xf5, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x81, 0x18, 0xae, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x80, 0x10, 0xd0, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x0b, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0c, 0x18, 0xad, 0x82, 0x20, 0xad, 0x01, 0x19, 0x01, 0x1a, 0x0b, 0x18, 0xad, 0x81, 0x20, 0xae, 0x49, 0x6f, 0x0d, 0xd3, 0x95, 0x84, 0xd3, 0x75, 0xd3, 0x95, 0x72, 0x31, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x20, 0x18, 0xad, 0x01, 0x01, 0x19, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x14, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xcd, 0x18, 0xae, 0x01, 0x18, 0xad, 0x01, 0x01, 0x19, 0x03, 0x18, 0xad, 0x87, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x18, 0xcd, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x86, 0x10, 0xd1, 0x10, 0xd3, 0x08, 0xd3, 0x10, 0xd2, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x05, 0x18, 0xad,
+  0x51, 0x18, 0xad, 0x80, 0x20, 0xae, 0x0d, 0x18, 0xad, 0x01, 0x03, 0xb7, 0x80, 0x03, 0xb8, 0x03, 0x18, 0xad, 0x06, 0x03, 0xb7, 0x01, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x18, 0xad, 0x20, 0xad, 0x0f, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x20, 0xad, 0x10, 0xd2, 0x01, 0x01, 0x1a, 0x80, 0x08, 0xf5, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x81, 0x20, 0xad, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x0b, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0c, 0x18, 0xad, 0x85, 0x20, 0xad, 0x01, 0x1a, 0x01, 0x19, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x07, 0x18, 0xad, 0x82, 0x20, 0xcd, 0x20, 0xae, 0x8a, 0x92, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x0b, 0xd3, 0x95, 0x83, 0x7a, 0x31, 0x20, 0xad, 0x18, 0xad, 0x18, 0xcd, 0x07, 0x18, 0xad, 0x80, 0x18, 0xae, 0x1c, 0x18, 0xad, 0x01, 0x01, 0x19, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x14, 0x18, 0xad, 0x01, 0x18, 0xae, 0x02, 0x18, 0xad, 0x81, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x05, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad,
+  0x53, 0x18, 0xad, 0x80, 0x20, 0xad, 0x06, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x20, 0xae, 0x02, 0x03, 0xb7, 0x01, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xad, 0x01, 0x03, 0xb7, 0x80, 0x03, 0xb8, 0x03, 0x03, 0xb7, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x11, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x20, 0xae, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x04, 0x18, 0xad, 0x80, 0x20, 0xad, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1d, 0x18, 0xad, 0x01, 0x01, 0x19, 0x06, 0x18, 0xad, 0x03, 0x20, 0xae, 0x82, 0x20, 0xad, 0x28, 0xee, 0xc3, 0x74, 0x0f, 0xd3, 0x95, 0x83, 0xa2, 0xd3, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0x22, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x81, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x17, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1b, 0x18, 0xad,
+  0x56, 0x18, 0xad, 0x87, 0x18, 0xae, 0x20, 0xad, 0x18, 0xad, 0x18, 0xce, 0x19, 0x4f, 0x18, 0xae, 0x20, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x86, 0x03, 0xb7, 0x03, 0x97, 0x03, 0xb8, 0x18, 0xad, 0x20, 0xae, 0x20, 0xad, 0x18, 0xad, 0x03, 0x03, 0xb7, 0x80, 0x03, 0xb8, 0x01, 0x03, 0xb7, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x16, 0x18, 0xad, 0x85, 0x10, 0xd2, 0x00, 0xf9, 0x01, 0x19, 0x08, 0xf5, 0x18, 0xad, 0x18, 0xae, 0x08, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1d, 0x18, 0xad, 0x01, 0x01, 0x19, 0x03, 0x18, 0xad, 0x03, 0x20, 0xae, 0x01, 0x20, 0xad, 0x01, 0x20, 0xae, 0x80, 0x61, 0xd1, 0x0f, 0xd3, 0x95, 0x84, 0xd3, 0x96, 0xd3, 0x95, 0x69, 0xf1, 0x20, 0xad, 0x18, 0xae, 0x23, 0x18, 0xad, 0x84, 0x18, 0xcd, 0x10, 0xd2, 0x01, 0x1a, 0x01, 0x19, 0x10, 0xd2, 0x1d, 0x18, 0xad, 0x01, 0x01, 0x19, 0x19, 0x18, 0xad, 0x81, 0x18, 0xce, 0x18, 0xad,
+  0x57, 0x18, 0xad, 0x85, 0x19, 0x30, 0x02, 0xf5, 0x03, 0xb7, 0x03, 0xb8, 0x03, 0x56, 0x11, 0x4f, 0x02, 0x18, 0xad, 0x80, 0x03, 0xb8, 0x01, 0x03, 0xb7, 0x02, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x18, 0xad, 0x84, 0x03, 0xb7, 0x03, 0xb8, 0x03, 0xb7, 0x18, 0xad, 0x20, 0xad, 0x18, 0x18, 0xad, 0x88, 0x18, 0xae, 0x10, 0xd2, 0x00, 0xf9, 0x01, 0x19, 0x08, 0xf4, 0x18, 0xad, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1d, 0x18, 0xad, 0x01, 0x01, 0x19, 0x03, 0x18, 0xad, 0x01, 0x20, 0xae, 0x03, 0x20, 0xad, 0x01, 0x20, 0xae, 0x81, 0x9a, 0xb3, 0xd3, 0x75, 0x0d, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x02, 0xd3, 0x95, 0x80, 0x41, 0x2f, 0x21, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xad, 0x18, 0xce, 0x00, 0xf8, 0x03, 0x01, 0x19, 0x84, 0x08, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x18, 0x18, 0xad, 0x01, 0x01, 0x19, 0x0f, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x03, 0xb7, 0x81, 0x03, 0x97, 0x03, 0xb7,
+  0x53, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x87, 0x19, 0x0f, 0x03, 0x77, 0x03, 0x97, 0x03, 0xb8, 0x03, 0x98, 0x03, 0x97, 0x0b, 0x77, 0x18, 0xce, 0x01, 0x18, 0xad, 0x82, 0x03, 0xb7, 0x03, 0x97, 0x03, 0xb8, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x82, 0x03, 0xb7, 0x0b, 0xb7, 0x03, 0x98, 0x05, 0x18, 0xad, 0x80, 0x20, 0xad, 0x14, 0x18, 0xad, 0x81, 0x18, 0xae, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x81, 0x08, 0xf5, 0x18, 0xae, 0x07, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1d, 0x18, 0xad, 0x01, 0x01, 0x19, 0x01, 0x18, 0xad, 0x82, 0x20, 0xae, 0x18, 0xad, 0x20, 0xad, 0x05, 0x20, 0xae, 0x81, 0x20, 0xce, 0xc3, 0x55, 0x12, 0xd3, 0x95, 0x80, 0x49, 0x70, 0x23, 0x18, 0xad, 0x82, 0x08, 0xf5, 0x00, 0xf9, 0x01, 0x19, 0x01, 0x00, 0xf7, 0x01, 0x01, 0x19, 0x81, 0x08, 0xf5, 0x18, 0xae, 0x01, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xae, 0x15, 0x18, 0xad, 0x01, 0x01, 0x19, 0x15, 0x18, 0xad, 0x03, 0x03, 0xb7, 0x81, 0x03, 0xb8, 0x03, 0xb7,
+  0x55, 0x18, 0xad, 0x84, 0x20, 0xad, 0x12, 0x53, 0x0b, 0x78, 0x0b, 0x98, 0x0b, 0x78, 0x01, 0x0b, 0x98, 0x81, 0x13, 0x78, 0x11, 0xf2, 0x01, 0x18, 0xad, 0x80, 0x0b, 0x98, 0x01, 0x0b, 0x78, 0x05, 0x18, 0xad, 0x84, 0x0b, 0x98, 0x13, 0x78, 0x0b, 0x78, 0x18, 0xad, 0x20, 0xae, 0x15, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xae, 0x02, 0x18, 0xad, 0x87, 0x10, 0xd2, 0x01, 0x19, 0x01, 0x1a, 0x08, 0xf5, 0x18, 0xad, 0x20, 0xad, 0x18, 0xad, 0x20, 0xae, 0x03, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1d, 0x18, 0xad, 0x01, 0x01, 0x19, 0x01, 0x18, 0xad, 0x81, 0x20, 0xae, 0x20, 0xad, 0x05, 0x20, 0xae, 0x83, 0x20, 0xce, 0x49, 0x70, 0xd3, 0x95, 0xd3, 0x75, 0x10, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0x82, 0x52, 0x02, 0x20, 0xae, 0x1e, 0x18, 0xad, 0x84, 0x20, 0xad, 0x18, 0xae, 0x01, 0x19, 0x01, 0x1a, 0x08, 0xf3, 0x01, 0x18, 0xad, 0x80, 0x08, 0xf4, 0x01, 0x01, 0x19, 0x1b, 0x18, 0xad, 0x01, 0x01, 0x19, 0x12, 0x18, 0xad, 0x80, 0x18, 0xce, 0x01, 0x18, 0xad, 0x80, 0x03, 0xb8, 0x04, 0x03, 0xb7,
+  0x54, 0x18, 0xad, 0x89, 0x18, 0xae, 0x18, 0xad, 0x1a, 0xb5, 0x1b, 0x78, 0x1b, 0x58, 0x13, 0x58, 0x1b, 0x78, 0x13, 0x78, 0x13, 0x58, 0x1a, 0x13, 0x01, 0x18, 0xae, 0x01, 0x13, 0x58, 0x82, 0x13, 0x78, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xad, 0x02, 0x13, 0x58, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x20, 0xad, 0x10, 0x18, 0xad, 0x80, 0x20, 0xad, 0x04, 0x18, 0xad, 0x81, 0x20, 0xae, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x81, 0x08, 0xf5, 0x18, 0xae, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1d, 0x18, 0xad, 0x01, 0x01, 0x19, 0x01, 0x20, 0xae, 0x80, 0x18, 0xad, 0x04, 0x20, 0xae, 0x02, 0x20, 0xce, 0x80, 0x7a, 0x32, 0x0f, 0xd3, 0x95, 0x86, 0xd3, 0x75, 0xd3, 0x95, 0xd3, 0x75, 0xd3, 0x95, 0xc3, 0x54, 0x59, 0x90, 0x20, 0xad, 0x03, 0x20, 0xae, 0x1c, 0x18, 0xad, 0x80, 0x18, 0xaf, 0x01, 0x01, 0x19, 0x80, 0x18, 0xd0, 0x01, 0x18, 0xad, 0x80, 0x10, 0xd0, 0x01, 0x01, 0x19, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x16, 0x18, 0xad, 0x01, 0x01, 0x19, 0x15, 0x18, 0xad, 0x05, 0x03, 0xb7,
+  0x56, 0x18, 0xad, 0x80, 0x1a, 0x54, 0x01, 0x1b, 0x38, 0x84, 0x23, 0x38, 0x1b, 0x38, 0x1b, 0x58, 0x23, 0x38, 0x21, 0xd2, 0x01, 0x18, 0xad, 0x01, 0x23, 0x38, 0x81, 0x23, 0x58, 0x18, 0xae, 0x03, 0x18, 0xad, 0x85, 0x19, 0x30, 0x23, 0x39, 0x23, 0x58, 0x23, 0x38, 0x18, 0xad, 0x20, 0xad, 0x16, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x18, 0xad, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x82, 0x08, 0xf5, 0x18, 0xad, 0x18, 0xae, 0x03, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1d, 0x18, 0xad, 0x01, 0x01, 0x19, 0x04, 0x20, 0xae, 0x05, 0x20, 0xce, 0x80, 0xa2, 0xb3, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x0b, 0xd3, 0x95, 0x03, 0xd3, 0x75, 0x80, 0x49, 0x70, 0x05, 0x20, 0xae, 0x1b, 0x18, 0xad, 0x82, 0x01, 0x19, 0x01, 0x1a, 0x08, 0xf3, 0x01, 0x18, 0xad, 0x80, 0x10, 0xd3, 0x01, 0x01, 0x1a, 0x80, 0x18, 0xad, 0x01, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x15, 0x18, 0xad, 0x01, 0x01, 0x19, 0x15, 0x18, 0xad, 0x03, 0x03, 0xb7, 0x81, 0x18, 0xae, 0x18, 0xad,
+  0x54, 0x18, 0xad, 0x85, 0x18, 0xae, 0x18, 0xad, 0x21, 0x50, 0x2b, 0x18, 0x2b, 0x39, 0x2b, 0x18, 0x01, 0x2b, 0x19, 0x81, 0x2a, 0xf8, 0x18, 0xce, 0x01, 0x18, 0xad, 0x87, 0x2b, 0x19, 0x2b, 0x18, 0x2b, 0x19, 0x18, 0xad, 0x18, 0xcd, 0x18, 0xae, 0x18, 0xad, 0x21, 0x92, 0x01, 0x2b, 0x19, 0x83, 0x2b, 0x18, 0x23, 0x38, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x1a, 0x18, 0xad, 0x82, 0x10, 0xcf, 0x01, 0x19, 0x01, 0x1a, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1d, 0x18, 0xad, 0x01, 0x01, 0x19, 0x80, 0x18, 0xad, 0x03, 0x20, 0xae, 0x05, 0x20, 0xce, 0x80, 0xbb, 0x34, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x0b, 0xd3, 0x95, 0x06, 0xd3, 0x75, 0x81, 0x49, 0x70, 0x20, 0xce, 0x02, 0x20, 0xae, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x20, 0xae, 0x19, 0x18, 0xad, 0x80, 0x08, 0xd5, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x01, 0x17, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x1b, 0x18, 0xad, 0x01, 0x01, 0x19, 0x0f, 0x18, 0xad, 0x80, 0x20, 0xad, 0x04, 0x18, 0xad, 0x04, 0x03, 0xb7, 0x80, 0x03, 0xb8,
+  0x03, 0x18, 0xad, 0x85, 0x10, 0xd2, 0x08, 0xf3, 0x10, 0xd3, 0x10, 0xd2, 0x18, 0xad, 0x18, 0xae, 0x1a, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x2d, 0x18, 0xad, 0x87, 0x20, 0xad, 0x21, 0x92, 0x2b, 0x19, 0x33, 0x19, 0x32, 0xf9, 0x2a, 0x15, 0x18, 0xef, 0x20, 0xad, 0x01, 0x18, 0xad, 0x82, 0x32, 0xf9, 0x33, 0x19, 0x32, 0xf9, 0x02, 0x18, 0xad, 0x85, 0x21, 0x91, 0x33, 0x19, 0x2a, 0xf9, 0x33, 0x19, 0x2a, 0xf9, 0x2a, 0x97, 0x01, 0x18, 0xad, 0x81, 0x18, 0xae, 0x20, 0xad, 0x1c, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x01, 0x19, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1b, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x01, 0x01, 0x19, 0x03, 0x20, 0xae, 0x02, 0x20, 0xce, 0x02, 0x20, 0xcf, 0x80, 0x28, 0xcf, 0x10, 0xd3, 0x95, 0x05, 0xd3, 0x75, 0x80, 0x71, 0xd1, 0x05, 0x20, 0xae, 0x81, 0x20, 0xad, 0x20, 0xcd, 0x01, 0x20, 0xae, 0x17, 0x18, 0xad, 0x82, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x85, 0x00, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xae, 0x17, 0x18, 0xad, 0x01, 0x01, 0x19, 0x0f, 0x18, 0xad, 0x80, 0x20, 0xad, 0x04, 0x18, 0xad, 0x04, 0x03, 0xb7, 0x80, 0x03, 0xb8,
+  0x83, 0x18, 0xad, 0x18, 0xae, 0x18, 0xce, 0x00, 0xf7, 0x03, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x1e, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x2b, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x3a, 0xd9, 0x02, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x3a, 0xf9, 0x01, 0x3a, 0xd9, 0x89, 0x18, 0xad, 0x20, 0xad, 0x32, 0x15, 0x3a, 0xd9, 0x3a, 0xf9, 0x3a, 0xda, 0x3a, 0xd9, 0x32, 0x77, 0x18, 0xce, 0x18, 0xad, 0x01, 0x18, 0xae, 0x1e, 0x18, 0xad, 0x01, 0x01, 0x19, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1d, 0x18, 0xad, 0x01, 0x01, 0x1a, 0x80, 0x20, 0xcd, 0x01, 0x20, 0xae, 0x03, 0x20, 0xce, 0x80, 0x20, 0xcf, 0x01, 0x28, 0xcf, 0x80, 0x49, 0x50, 0x0f, 0xd3, 0x95, 0x02, 0xd3, 0x75, 0x81, 0xd3, 0x74, 0xd3, 0x75, 0x01, 0xd3, 0x55, 0x85, 0xaa, 0xb3, 0x20, 0xce, 0x18, 0xce, 0x20, 0xce, 0x20, 0xae, 0x20, 0xce, 0x06, 0x20, 0xae, 0x14, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x83, 0x10, 0xd2, 0x10, 0xd3, 0x08, 0xf3, 0x10, 0xd2, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x18, 0x18, 0xad, 0x01, 0x01, 0x19, 0x13, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xad, 0x03, 0x03, 0x98, 0x81, 0x03, 0xb7, 0x03, 0x97,
+  0x01, 0x18, 0xad, 0x84, 0x08, 0xf5, 0x01, 0x39, 0x01, 0x1a, 0x01, 0x17, 0x00, 0xf7, 0x01, 0x01, 0x1a, 0x80, 0x08, 0xf5, 0x1f, 0x18, 0xad, 0x81, 0x20, 0xae, 0x18, 0xae, 0x2b, 0x18, 0xad, 0x81, 0x20, 0xad, 0x42, 0xd9, 0x01, 0x42, 0xb9, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x42, 0xb9, 0x88, 0x42, 0xba, 0x18, 0xae, 0x31, 0xf5, 0x42, 0xda, 0x42, 0xd9, 0x42, 0xb9, 0x42, 0xd9, 0x3a, 0x77, 0x18, 0xce, 0x01, 0x18, 0xad, 0x81, 0x18, 0xae, 0x20, 0xad, 0x1b, 0x18, 0xad, 0x84, 0x18, 0xcd, 0x18, 0xad, 0x20, 0xad, 0x01, 0x19, 0x01, 0x1a, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1c, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x01, 0x19, 0x80, 0x20, 0xae, 0x04, 0x20, 0xce, 0x03, 0x28, 0xcf, 0x80, 0x59, 0x91, 0x0d, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x81, 0xd3, 0x74, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x81, 0x92, 0x52, 0x30, 0xef, 0x03, 0x20, 0xce, 0x06, 0x20, 0xae, 0x12, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x07, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x16, 0x18, 0xad, 0x01, 0x01, 0x19, 0x13, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xad, 0x01, 0x23, 0x38, 0x81, 0x23, 0x18, 0x23, 0x19, 0x01, 0x23, 0x38,
+  0x01, 0x18, 0xad, 0x82, 0x00, 0xf9, 0x01, 0x19, 0x10, 0xd3, 0x01, 0x18, 0xad, 0x83, 0x10, 0xf3, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x19, 0x01, 0x19, 0x82, 0x18, 0xb0, 0x18, 0xad, 0x18, 0xae, 0x30, 0x18, 0xad, 0x82, 0x4a, 0x99, 0x4a, 0xb9, 0x4a, 0x9a, 0x04, 0x18, 0xad, 0x01, 0x4a, 0xba, 0x82, 0x4a, 0x9a, 0x42, 0x57, 0x4a, 0x99, 0x01, 0x4a, 0x9a, 0x87, 0x4a, 0xba, 0x42, 0x37, 0x20, 0xce, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x18, 0xcd, 0x1b, 0x18, 0xad, 0x84, 0x18, 0xae, 0x18, 0xad, 0x18, 0xcd, 0x01, 0x1a, 0x01, 0x19, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1a, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x20, 0xae, 0x01, 0x01, 0x19, 0x80, 0x20, 0xae, 0x03, 0x20, 0xce, 0x80, 0x28, 0xce, 0x02, 0x28, 0xcf, 0x81, 0x28, 0xef, 0x69, 0xf1, 0x0d, 0xd3, 0x95, 0x03, 0xd3, 0x75, 0x81, 0xd3, 0x55, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x84, 0xd3, 0x35, 0xd3, 0x55, 0xcb, 0x14, 0x41, 0x30, 0x20, 0xaf, 0x01, 0x20, 0xce, 0x81, 0x20, 0xae, 0x20, 0xce, 0x03, 0x20, 0xae, 0x81, 0x20, 0xad, 0x18, 0xad, 0x01, 0x20, 0xae, 0x12, 0x18, 0xad, 0x83, 0x18, 0xcd, 0x20, 0xad, 0x18, 0xad, 0x20, 0x8e, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x1a, 0x18, 0xad, 0x01, 0x01, 0x19, 0x12, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x83, 0x42, 0xb9, 0x4a, 0x99, 0x42, 0xb9, 0x42, 0xba, 0x01, 0x18, 0xad,
+  0x87, 0x18, 0xad, 0x18, 0xaf, 0x01, 0x1a, 0x00, 0xf9, 0x10, 0xd0, 0x18, 0xad, 0x20, 0xad, 0x10, 0xd0, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x19, 0x01, 0x19, 0x81, 0x01, 0x18, 0x10, 0xd0, 0x31, 0x18, 0xad, 0x02, 0x52, 0x7a, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x01, 0x52, 0x7a, 0x80, 0x52, 0x9a, 0x03, 0x52, 0x7a, 0x81, 0x4a, 0x18, 0x20, 0xce, 0x01, 0x18, 0xad, 0x01, 0x20, 0xad, 0x1f, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x00, 0xf9, 0x01, 0x19, 0x05, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1a, 0x18, 0xad, 0x82, 0x18, 0xae, 0x10, 0xd1, 0x01, 0x17, 0x01, 0x01, 0x19, 0x84, 0x09, 0x17, 0x18, 0xd2, 0x20, 0xce, 0x20, 0xcf, 0x28, 0xce, 0x02, 0x28, 0xcf, 0x82, 0x28, 0xef, 0x30, 0xf0, 0x82, 0x53, 0x0c, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x05, 0xd3, 0x55, 0x83, 0xd3, 0x54, 0xd3, 0x55, 0x7a, 0x11, 0x20, 0xcf, 0x02, 0x20, 0xce, 0x81, 0x20, 0xae, 0x20, 0xce, 0x07, 0x20, 0xae, 0x01, 0x20, 0xad, 0x0f, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x18, 0xcd, 0x08, 0x18, 0xad, 0x80, 0x18, 0xae, 0x15, 0x18, 0xad, 0x01, 0x01, 0x19, 0x15, 0x18, 0xad, 0x02, 0x6a, 0x3b, 0x80, 0x62, 0x1a, 0x01, 0x6a, 0x3b,
+  0x01, 0x18, 0xad, 0x01, 0x01, 0x19, 0x83, 0x10, 0xd3, 0x18, 0xad, 0x20, 0xae, 0x08, 0xf3, 0x01, 0x01, 0x19, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x17, 0x18, 0xad, 0x85, 0x08, 0xf5, 0x01, 0x19, 0x00, 0xf9, 0x18, 0xd0, 0x18, 0xad, 0x18, 0xae, 0x2a, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x18, 0xad, 0x86, 0x20, 0xad, 0x5a, 0x5b, 0x5a, 0x5a, 0x5a, 0x7a, 0x29, 0x10, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x5a, 0x5a, 0x5a, 0x7b, 0x03, 0x5a, 0x5a, 0x81, 0x4a, 0x18, 0x20, 0xce, 0x08, 0x18, 0xad, 0x80, 0x20, 0xad, 0x1b, 0x18, 0xad, 0x01, 0x01, 0x19, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1a, 0x18, 0xad, 0x80, 0x10, 0xd1, 0x03, 0x01, 0x19, 0x84, 0x01, 0x1a, 0x09, 0x1a, 0x18, 0xf2, 0x28, 0xcf, 0x28, 0xce, 0x01, 0x28, 0xcf, 0x83, 0x28, 0xef, 0x28, 0xf0, 0x30, 0xf0, 0x82, 0x32, 0x0b, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x04, 0xd3, 0x55, 0x03, 0xd3, 0x35, 0x81, 0xa2, 0x93, 0x28, 0xcf, 0x07, 0x20, 0xce, 0x81, 0x20, 0xae, 0x20, 0xce, 0x01, 0x20, 0xae, 0x01, 0x20, 0xad, 0x80, 0x20, 0xae, 0x01, 0x20, 0xad, 0x80, 0x20, 0xae, 0x12, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x20, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x15, 0x18, 0xad, 0x01, 0x01, 0x19, 0x0f, 0x18, 0xad, 0x80, 0x20, 0xad, 0x04, 0x18, 0xad, 0x02, 0x89, 0xbc, 0x82, 0x91, 0xbc, 0x89, 0xbc, 0x89, 0x9c,
+  0x01, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x01, 0x17, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x19, 0x18, 0xad, 0x85, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf9, 0x18, 0xd0, 0x18, 0xae, 0x2e, 0x18, 0xad, 0x85, 0x62, 0x3a, 0x62, 0x3b, 0x62, 0x5a, 0x62, 0x1a, 0x29, 0x10, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x82, 0x62, 0x3b, 0x62, 0x3a, 0x62, 0x5a, 0x01, 0x62, 0x3b, 0x81, 0x51, 0xf8, 0x20, 0xce, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x21, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x82, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x02, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1a, 0x18, 0xad, 0x82, 0x01, 0x18, 0x01, 0x19, 0x09, 0x17, 0x01, 0x18, 0xd2, 0x82, 0x09, 0x18, 0x09, 0x1a, 0x09, 0x18, 0x01, 0x28, 0xcf, 0x01, 0x28, 0xef, 0x80, 0x30, 0xd0, 0x01, 0x30, 0xf0, 0x80, 0x82, 0x52, 0x09, 0xd3, 0x95, 0x06, 0xd3, 0x75, 0x03, 0xd3, 0x55, 0x03, 0xd3, 0x35, 0x85, 0xd3, 0x15, 0xd3, 0x35, 0x92, 0x53, 0x30, 0xef, 0x28, 0xcf, 0x28, 0xce, 0x05, 0x20, 0xce, 0x01, 0x20, 0xae, 0x80, 0x20, 0xce, 0x03, 0x20, 0xae, 0x80, 0x20, 0xad, 0x02, 0x20, 0xae, 0x09, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x17, 0x18, 0xad, 0x01, 0x01, 0x19, 0x15, 0x18, 0xad, 0x02, 0xa9, 0x3d, 0x80, 0xb1, 0x3d, 0x01, 0xa9, 0x3d,
+  0x83, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x01, 0x17, 0x01, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xae, 0x19, 0x18, 0xad, 0x01, 0x18, 0xae, 0x84, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf8, 0x18, 0xd0, 0x18, 0xae, 0x2b, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xcd, 0x59, 0xd8, 0x03, 0x6a, 0x1b, 0x80, 0x41, 0x33, 0x01, 0x18, 0xad, 0x80, 0x6a, 0x3b, 0x02, 0x6a, 0x1b, 0x81, 0x51, 0xb6, 0x20, 0xcf, 0x07, 0x18, 0xad, 0x80, 0x18, 0xae, 0x1c, 0x18, 0xad, 0x84, 0x10, 0xd2, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xd3, 0x20, 0xad, 0x04, 0x18, 0xad, 0x01, 0x01, 0x19, 0x1a, 0x18, 0xad, 0x82, 0x01, 0x19, 0x01, 0x1a, 0x18, 0xd1, 0x01, 0x20, 0xce, 0x80, 0x18, 0xd1, 0x01, 0x09, 0x3a, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x30, 0xf0, 0x81, 0x38, 0xf0, 0x92, 0x73, 0x09, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x04, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x81, 0xd3, 0x34, 0xd3, 0x35, 0x01, 0xd3, 0x34, 0x82, 0xd3, 0x14, 0xd3, 0x15, 0xaa, 0x93, 0x02, 0x28, 0xcf, 0x07, 0x20, 0xce, 0x80, 0x20, 0xae, 0x01, 0x20, 0xce, 0x02, 0x20, 0xae, 0x01, 0x20, 0xad, 0x80, 0x20, 0xae, 0x06, 0x18, 0xad, 0x80, 0x20, 0xae, 0x09, 0x18, 0xad, 0x02, 0x18, 0xae, 0x17, 0x18, 0xad, 0x01, 0x01, 0x19, 0x12, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x05, 0xd0, 0xbe,
+  0x03, 0x18, 0xad, 0x84, 0x10, 0xd2, 0x08, 0xd4, 0x08, 0xf3, 0x10, 0xd2, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x0a, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0d, 0x18, 0xad, 0x81, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x01, 0x19, 0x81, 0x18, 0xd0, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x22, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x85, 0x20, 0xad, 0x18, 0xad, 0x20, 0xce, 0x61, 0xb8, 0x72, 0x1b, 0x71, 0xfb, 0x01, 0x72, 0x1b, 0x88, 0x41, 0x33, 0x20, 0xad, 0x71, 0xfb, 0x72, 0x1b, 0x71, 0xfb, 0x41, 0x74, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x1c, 0x18, 0xad, 0x80, 0x18, 0xae, 0x05, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x01, 0x18, 0xad, 0x01, 0x18, 0xae, 0x02, 0x18, 0xad, 0x01, 0x01, 0x1a, 0x19, 0x18, 0xad, 0x86, 0x20, 0xae, 0x01, 0x19, 0x01, 0x1a, 0x18, 0xd1, 0x20, 0xae, 0x20, 0xce, 0x20, 0xf1, 0x01, 0x09, 0x3a, 0x01, 0x28, 0xcf, 0x80, 0x30, 0xef, 0x01, 0x30, 0xf0, 0x82, 0x38, 0xf0, 0x39, 0x11, 0xaa, 0xf4, 0x08, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x05, 0xd3, 0x55, 0x05, 0xd3, 0x35, 0x01, 0xd3, 0x14, 0x80, 0xd3, 0x15, 0x01, 0x28, 0xef, 0x02, 0x28, 0xcf, 0x01, 0x28, 0xce, 0x05, 0x20, 0xce, 0x80, 0x20, 0xae, 0x01, 0x20, 0xce, 0x02, 0x20, 0xae, 0x80, 0x18, 0xae, 0x01, 0x20, 0xad, 0x8c, 0x20, 0xae, 0x30, 0xee, 0x61, 0x50, 0x81, 0xb1, 0xa1, 0xf2, 0xc2, 0x33, 0xca, 0x53, 0xca, 0x54, 0xca, 0x53, 0xc2, 0x33, 0xa1, 0xf2, 0x81, 0x91, 0x51, 0x2f, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x16, 0x18, 0xad, 0x01, 0x01, 0x19, 0x10, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x05, 0xf0, 0x3f,
+  0x06, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0e, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0e, 0x18, 0xad, 0x81, 0x18, 0xae, 0x01, 0x17, 0x01, 0x01, 0x19, 0x80, 0x18, 0xd0, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x21, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x20, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x8a, 0x20, 0xce, 0x69, 0xb9, 0x81, 0xfb, 0x79, 0xdb, 0x79, 0xdc, 0x81, 0xfc, 0x59, 0x76, 0x79, 0xdb, 0x79, 0xdc, 0x81, 0xdc, 0x20, 0xad, 0x1e, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x06, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x01, 0x19, 0x19, 0x18, 0xad, 0x8b, 0x20, 0xae, 0x09, 0x18, 0x01, 0x19, 0x09, 0x17, 0x18, 0xd0, 0x20, 0xd0, 0x09, 0x17, 0x09, 0x3a, 0x11, 0x38, 0x28, 0xcf, 0x30, 0xcf, 0x30, 0xef, 0x01, 0x30, 0xf0, 0x01, 0x39, 0x11, 0x80, 0xaa, 0xd4, 0x07, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x06, 0xd3, 0x55, 0x03, 0xd3, 0x35, 0x81, 0xd3, 0x15, 0xd3, 0x14, 0x01, 0xd3, 0x15, 0x82, 0xd3, 0x14, 0x69, 0xb2, 0x28, 0xef, 0x04, 0x28, 0xcf, 0x01, 0x28, 0xce, 0x07, 0x20, 0xce, 0x89, 0x20, 0xae, 0x20, 0xce, 0x41, 0x0f, 0x69, 0x90, 0x99, 0xf2, 0xc2, 0x53, 0xca, 0x74, 0xd2, 0x74, 0xca, 0x74, 0xd2, 0x53, 0x02, 0xca, 0x53, 0x87, 0xd2, 0x33, 0xd2, 0x53, 0xca, 0x53, 0xd2, 0x33, 0xca, 0x33, 0xc2, 0x13, 0x89, 0x91, 0x41, 0x0f, 0x1a, 0x18, 0xad, 0x01, 0x01, 0x19, 0x13, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x04, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd,
+  0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x17, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xae, 0x09, 0x17, 0x01, 0x01, 0x19, 0x81, 0x10, 0xcf, 0x18, 0xad, 0x01, 0x18, 0xae, 0x28, 0x18, 0xad, 0x01, 0x18, 0xae, 0x84, 0x20, 0xae, 0x71, 0x99, 0x89, 0xdb, 0x89, 0xbc, 0x81, 0xbc, 0x03, 0x89, 0xbc, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x1e, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x06, 0x18, 0xad, 0x84, 0x18, 0xae, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x19, 0x18, 0xae, 0x18, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xd2, 0x01, 0x01, 0x19, 0x03, 0x09, 0x3a, 0x82, 0x20, 0xf2, 0x28, 0xcf, 0x28, 0xf0, 0x01, 0x30, 0xf0, 0x80, 0x31, 0x11, 0x01, 0x39, 0x11, 0x80, 0xb2, 0xf5, 0x05, 0xd3, 0x95, 0x05, 0xd3, 0x75, 0x06, 0xd3, 0x55, 0x03, 0xd3, 0x35, 0x01, 0xd3, 0x15, 0x01, 0xd3, 0x14, 0x86, 0xd2, 0xf4, 0xd2, 0xf5, 0xca, 0xd4, 0x59, 0x71, 0x30, 0xf0, 0x30, 0xd0, 0x28, 0xef, 0x05, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x83, 0x28, 0xce, 0x38, 0xef, 0x79, 0xb1, 0xba, 0x53, 0x01, 0xca, 0x94, 0x80, 0xca, 0x74, 0x01, 0xd2, 0x73, 0x85, 0xca, 0x73, 0xca, 0x54, 0xca, 0x53, 0xca, 0x54, 0xca, 0x53, 0xca, 0x33, 0x01, 0xca, 0x53, 0x02, 0xca, 0x33, 0x80, 0xd2, 0x13, 0x01, 0xca, 0x13, 0x83, 0xa1, 0xb2, 0x49, 0x0f, 0x18, 0xad, 0x18, 0xae, 0x16, 0x18, 0xad, 0x01, 0x01, 0x19, 0x0f, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x20, 0xcd,
+  0x07, 0x18, 0xad, 0x80, 0x18, 0xae, 0x1c, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x84, 0x18, 0xae, 0x01, 0x17, 0x01, 0x19, 0x00, 0xf9, 0x18, 0xb0, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x27, 0x18, 0xad, 0x81, 0x20, 0xce, 0x79, 0x79, 0x01, 0x91, 0x9c, 0x84, 0x91, 0xbc, 0x91, 0x9c, 0x89, 0x9c, 0x89, 0xbc, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x1c, 0x18, 0xad, 0x84, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x83, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x19, 0x10, 0xf2, 0x17, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x20, 0xae, 0x82, 0x20, 0xce, 0x18, 0xf2, 0x09, 0x19, 0x01, 0x09, 0x1a, 0x82, 0x09, 0x19, 0x20, 0xf3, 0x28, 0xef, 0x02, 0x30, 0xf0, 0x80, 0x31, 0x10, 0x01, 0x39, 0x11, 0x81, 0x41, 0x12, 0xb2, 0xf5, 0x05, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x06, 0xd3, 0x55, 0x03, 0xd3, 0x35, 0x80, 0xd3, 0x15, 0x02, 0xd3, 0x14, 0x82, 0xd2, 0xf4, 0xd3, 0x14, 0xd2, 0xf5, 0x01, 0xd2, 0xf4, 0x83, 0x49, 0x30, 0x30, 0xf0, 0x30, 0xef, 0x28, 0xf0, 0x02, 0x28, 0xcf, 0x81, 0x28, 0xef, 0x28, 0xce, 0x02, 0x28, 0xcf, 0x81, 0x41, 0x30, 0x89, 0xf1, 0x01, 0xd2, 0x94, 0x82, 0xca, 0x93, 0xca, 0x74, 0xd2, 0x74, 0x01, 0xca, 0x74, 0x83, 0xca, 0x53, 0xca, 0x73, 0xd2, 0x53, 0xd2, 0x54, 0x01, 0xca, 0x53, 0x8c, 0xca, 0x54, 0xc2, 0x74, 0x9b, 0x36, 0x83, 0xb8, 0x64, 0x19, 0x6c, 0x39, 0x64, 0x39, 0x6c, 0x1a, 0x8b, 0x57, 0xb2, 0x95, 0xca, 0x13, 0x91, 0x91, 0x28, 0xce, 0x16, 0x18, 0xad, 0x01, 0x01, 0x19, 0x11, 0x18, 0xad, 0x81, 0x18, 0xae, 0x20, 0xad, 0x01, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad,
+  0x16, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0b, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x02, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x01, 0x19, 0x80, 0x18, 0xaf, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x25, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x82, 0x28, 0xae, 0x81, 0x59, 0x91, 0x7c, 0x01, 0x99, 0x7c, 0x01, 0x99, 0x9c, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x1b, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x80, 0x08, 0xd5, 0x03, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x85, 0x08, 0xf4, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xd2, 0x18, 0xad, 0x18, 0xae, 0x15, 0x18, 0xad, 0x01, 0x20, 0xad, 0x01, 0x20, 0xae, 0x02, 0x20, 0xce, 0x81, 0x20, 0xd0, 0x20, 0xd1, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x01, 0x30, 0xf0, 0x82, 0x31, 0x10, 0x39, 0x10, 0x41, 0x11, 0x01, 0x41, 0x12, 0x80, 0x92, 0x94, 0x04, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x05, 0xd3, 0x55, 0x04, 0xd3, 0x35, 0x01, 0xd3, 0x15, 0x80, 0xd3, 0x14, 0x01, 0xd2, 0xf4, 0x86, 0xd3, 0x15, 0xd2, 0xf4, 0xd2, 0xf5, 0xd2, 0xf4, 0xd2, 0xd5, 0x79, 0xd2, 0x31, 0x10, 0x02, 0x30, 0xf0, 0x87, 0x28, 0xf0, 0x30, 0xd0, 0x28, 0xef, 0x28, 0xf0, 0x28, 0xcf, 0x51, 0x50, 0xaa, 0x32, 0xd2, 0x93, 0x01, 0xd2, 0x94, 0x80, 0xca, 0x93, 0x03, 0xca, 0x74, 0x8a, 0xd2, 0x74, 0xd2, 0x54, 0xca, 0x53, 0xca, 0x54, 0xb2, 0xd5, 0x83, 0xb8, 0x44, 0xfc, 0x1d, 0xbe, 0x06, 0x3f, 0x0c, 0xdb, 0x0b, 0x76, 0x01, 0x13, 0x77, 0x86, 0x0b, 0x76, 0x13, 0x56, 0x0b, 0x76, 0x0b, 0x77, 0x23, 0xf8, 0x69, 0x91, 0x51, 0x0f, 0x16, 0x18, 0xad, 0x01, 0x01, 0x19, 0x10, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x06, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad,
+  0x13, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x07, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x84, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf9, 0x18, 0xaf, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x23, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x85, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0x20, 0xae, 0x89, 0x39, 0x01, 0xa1, 0x7c, 0x01, 0xa1, 0x5d, 0x06, 0x18, 0xad, 0x80, 0x20, 0xad, 0x18, 0x18, 0xad, 0x86, 0x18, 0xae, 0x18, 0xad, 0x10, 0xd2, 0x01, 0x19, 0x01, 0x1a, 0x08, 0xf5, 0x18, 0xae, 0x04, 0x18, 0xad, 0x82, 0x20, 0xae, 0x18, 0xad, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x10, 0xd2, 0x20, 0xad, 0x16, 0x18, 0xad, 0x04, 0x20, 0xae, 0x02, 0x20, 0xce, 0x80, 0x28, 0xce, 0x01, 0x28, 0xcf, 0x83, 0x28, 0xef, 0x28, 0xf0, 0x30, 0xf0, 0x31, 0x10, 0x02, 0x39, 0x11, 0x82, 0x41, 0x12, 0x41, 0x32, 0x8a, 0x54, 0x03, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x06, 0xd3, 0x55, 0x02, 0xd3, 0x35, 0x02, 0xd3, 0x15, 0x02, 0xd3, 0x14, 0x01, 0xd2, 0xf4, 0x80, 0xd2, 0xf5, 0x01, 0xd2, 0xf4, 0x83, 0xd2, 0xd4, 0xca, 0xd4, 0x59, 0x51, 0x38, 0xf0, 0x04, 0x30, 0xf0, 0x81, 0x41, 0x30, 0x91, 0xf2, 0x01, 0xd2, 0x94, 0x81, 0xca, 0x94, 0xca, 0x74, 0x01, 0xca, 0x94, 0x80, 0xca, 0x74, 0x02, 0xd2, 0x74, 0x8a, 0xd2, 0x53, 0xb2, 0xd5, 0x74, 0x19, 0x25, 0x7d, 0x06, 0x3f, 0x06, 0x1f, 0x05, 0x7d, 0x12, 0xb5, 0x19, 0x0f, 0x18, 0xce, 0x20, 0xae, 0x01, 0x20, 0xad, 0x01, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x19, 0x18, 0xad, 0x01, 0x01, 0x19, 0x15, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad,
+  0x07, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0e, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0d, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x81, 0x18, 0xce, 0x01, 0x17, 0x01, 0x01, 0x19, 0x80, 0x18, 0xb0, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x2a, 0x18, 0xad, 0x84, 0x20, 0xce, 0x91, 0x3a, 0xa9, 0x3d, 0xa9, 0x5d, 0xa9, 0x5c, 0x21, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x81, 0x08, 0xf5, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x80, 0x10, 0xd2, 0x01, 0x18, 0xad, 0x83, 0x20, 0xae, 0x18, 0xae, 0x18, 0xcd, 0x18, 0xae, 0x12, 0x18, 0xad, 0x03, 0x20, 0xae, 0x02, 0x20, 0xce, 0x84, 0x20, 0xcf, 0x28, 0xce, 0x28, 0xcf, 0x28, 0xef, 0x28, 0xf0, 0x01, 0x30, 0xf0, 0x02, 0x39, 0x11, 0x01, 0x41, 0x32, 0x81, 0x49, 0x32, 0x92, 0x55, 0x01, 0xd3, 0x95, 0x05, 0xd3, 0x75, 0x05, 0xd3, 0x55, 0x03, 0xd3, 0x35, 0x02, 0xd3, 0x15, 0x02, 0xd3, 0x14, 0x81, 0xd2, 0xf4, 0xd2, 0xf5, 0x03, 0xd2, 0xf4, 0x01, 0xd2, 0xd4, 0x89, 0xca, 0xb4, 0x51, 0x72, 0x39, 0x11, 0x38, 0xf1, 0x38, 0xf0, 0x30, 0xf0, 0x81, 0xd2, 0xc2, 0x94, 0xd2, 0x94, 0xd2, 0x93, 0x01, 0xd2, 0x94, 0x01, 0xca, 0x93, 0x01, 0xd2, 0x74, 0x84, 0xca, 0x73, 0xd2, 0x74, 0x83, 0xd8, 0x35, 0x3d, 0x06, 0x1f, 0x02, 0x06, 0x3f, 0x81, 0x4c, 0x5a, 0x49, 0x70, 0x01, 0x20, 0xae, 0x81, 0x20, 0xad, 0x18, 0xcd, 0x01, 0x20, 0xad, 0x82, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x01, 0x18, 0xae, 0x16, 0x18, 0xad, 0x01, 0x01, 0x19, 0x10, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x01, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x20, 0xad,
+  0x07, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0a, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x84, 0x18, 0xcd, 0x10, 0xd2, 0x08, 0xf3, 0x08, 0xd4, 0x10, 0xd2, 0x07, 0x18, 0xad, 0x85, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x84, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xcf, 0x2d, 0x18, 0xad, 0x80, 0x20, 0xae, 0x02, 0xb1, 0x1d, 0x03, 0x18, 0xad, 0x81, 0x18, 0xae, 0x20, 0xad, 0x1a, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x01, 0x01, 0x19, 0x81, 0x08, 0xd5, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x80, 0x10, 0xd2, 0x04, 0x18, 0xad, 0x80, 0x20, 0xad, 0x12, 0x18, 0xad, 0x02, 0x20, 0xae, 0x03, 0x20, 0xce, 0x81, 0x28, 0xcf, 0x20, 0xcf, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x01, 0x30, 0xf0, 0x80, 0x38, 0xf0, 0x01, 0x39, 0x11, 0x84, 0x41, 0x12, 0x41, 0x32, 0x49, 0x32, 0x49, 0x53, 0x6b, 0x36, 0x01, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x06, 0xd3, 0x55, 0x03, 0xd3, 0x35, 0x80, 0xd3, 0x15, 0x04, 0xd3, 0x14, 0x02, 0xd2, 0xf4, 0x80, 0xd2, 0xf5, 0x01, 0xd2, 0xd4, 0x93, 0xd2, 0xd5, 0xd2, 0xd4, 0xca, 0xd4, 0xca, 0xb4, 0x59, 0x72, 0x39, 0x11, 0x51, 0x51, 0xb2, 0x53, 0xca, 0xb4, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0xca, 0x94, 0xca, 0x74, 0xd2, 0x74, 0xc2, 0x94, 0x64, 0x5a, 0x1d, 0xbe, 0x02, 0x06, 0x3f, 0x84, 0x1d, 0xbe, 0x64, 0x59, 0xc2, 0x74, 0x99, 0xd2, 0x28, 0xce, 0x03, 0x20, 0xae, 0x80, 0x18, 0xce, 0x01, 0x18, 0xad, 0x82, 0x20, 0xae, 0x18, 0xad, 0x20, 0xad, 0x19, 0x18, 0xad, 0x01, 0x01, 0x19, 0x0f, 0x18, 0xad, 0x80, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad,
+  0x15, 0x18, 0xad, 0x81, 0x18, 0xaf, 0x01, 0x17, 0x03, 0x01, 0x19, 0x81, 0x01, 0x17, 0x18, 0xae, 0x02, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x0a, 0x18, 0xad, 0x81, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x01, 0x19, 0x81, 0x18, 0xd0, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xae, 0x18, 0xcd, 0x18, 0xae, 0x17, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x83, 0x18, 0xcd, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x02, 0x18, 0xad, 0x82, 0xb8, 0xfe, 0xb8, 0xfd, 0xb8, 0xfe, 0x02, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x18, 0x18, 0xad, 0x83, 0x10, 0xd0, 0x00, 0xf9, 0x01, 0x19, 0x08, 0xf5, 0x03, 0x18, 0xad, 0x01, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x80, 0x10, 0xd2, 0x17, 0x18, 0xad, 0x81, 0x20, 0xae, 0x20, 0xad, 0x03, 0x20, 0xae, 0x02, 0x20, 0xce, 0x02, 0x28, 0xcf, 0x81, 0x28, 0xef, 0x28, 0xf0, 0x01, 0x30, 0xf0, 0x01, 0x39, 0x11, 0x80, 0x41, 0x11, 0x01, 0x41, 0x32, 0x84, 0x49, 0x33, 0x49, 0x53, 0x25, 0x3b, 0x46, 0x5c, 0x6d, 0x7b, 0x01, 0x6d, 0x9a, 0x83, 0x6d, 0x7a, 0x84, 0xf9, 0x9c, 0x78, 0x9c, 0x77, 0x01, 0x9c, 0x78, 0x81, 0x9c, 0x57, 0x9c, 0x78, 0x01, 0x9c, 0x58, 0x88, 0xbb, 0xb6, 0xd3, 0x34, 0xd3, 0x15, 0xd3, 0x34, 0xd3, 0x15, 0xd3, 0x14, 0xd3, 0x15, 0xd2, 0xf4, 0xca, 0xf4, 0x02, 0xd2, 0xf4, 0x82, 0xd2, 0xf5, 0xd2, 0xd4, 0xca, 0xd4, 0x01, 0xd2, 0xd4, 0x85, 0xca, 0xd4, 0xca, 0xb4, 0xd2, 0xd4, 0x91, 0xf3, 0x59, 0x72, 0xca, 0x74, 0x01, 0xd2, 0xb4, 0x81, 0xd2, 0x94, 0xca, 0x94, 0x01, 0xd2, 0x94, 0x84, 0xca, 0x94, 0xca, 0x74, 0xc2, 0xb4, 0x6c, 0x5a, 0x0d, 0xff, 0x02, 0x06, 0x3f, 0x84, 0x35, 0x3d, 0x83, 0xb8, 0xca, 0x53, 0xca, 0x33, 0x89, 0xb1, 0x01, 0x20, 0xce, 0x06, 0x20, 0xae, 0x19, 0x18, 0xad, 0x85, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x01, 0x1a, 0x01, 0x19, 0x18, 0xcd, 0x1a, 0x18, 0xad,
+  0x15, 0x18, 0xad, 0x81, 0x08, 0xf5, 0x00, 0xf9, 0x03, 0x01, 0x19, 0x84, 0x00, 0xf9, 0x08, 0xf5, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0a, 0x18, 0xad, 0x81, 0x18, 0xae, 0x01, 0x17, 0x01, 0x01, 0x19, 0x81, 0x18, 0xd0, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x20, 0xad, 0x16, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0a, 0x18, 0xad, 0x89, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0xc0, 0xde, 0xc0, 0xfe, 0xc0, 0xdd, 0x18, 0xae, 0x18, 0xcd, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x19, 0x18, 0xad, 0x86, 0x00, 0xf9, 0x00, 0xfa, 0x08, 0xf4, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x20, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x01, 0x01, 0x19, 0x80, 0x10, 0xd2, 0x16, 0x18, 0xad, 0x04, 0x20, 0xae, 0x81, 0x20, 0xce, 0x20, 0xae, 0x02, 0x20, 0xce, 0x03, 0x28, 0xcf, 0x80, 0x30, 0xef, 0x01, 0x30, 0xf0, 0x8c, 0x39, 0x11, 0x38, 0xf1, 0x39, 0x11, 0x41, 0x12, 0x41, 0x32, 0x49, 0x32, 0x49, 0x53, 0x51, 0x53, 0x4d, 0x1a, 0x6d, 0x9a, 0x94, 0xb9, 0x9c, 0x98, 0x9c, 0x77, 0x02, 0x9c, 0x78, 0x80, 0x94, 0xb8, 0x01, 0x6d, 0x7a, 0x89, 0x6d, 0x7b, 0x36, 0x7c, 0x36, 0x7d, 0x1e, 0xfe, 0x07, 0x7f, 0x07, 0x5f, 0x1e, 0xde, 0x36, 0x3d, 0x6d, 0x3a, 0x9c, 0x17, 0x04, 0xd2, 0xf4, 0x80, 0xd2, 0xf5, 0x03, 0xd2, 0xd4, 0x86, 0xca, 0xd4, 0xd2, 0xb4, 0xca, 0xd4, 0xd2, 0xb3, 0xca, 0xb4, 0xc2, 0x94, 0xca, 0xb4, 0x01, 0xca, 0x94, 0x81, 0xd2, 0x94, 0xca, 0x94, 0x02, 0xca, 0x74, 0x8b, 0x7b, 0xd8, 0x0d, 0xff, 0x06, 0x3f, 0x06, 0x1f, 0x06, 0x3f, 0x4c, 0xbb, 0x9b, 0x57, 0xd2, 0x33, 0xca, 0x33, 0xca, 0x53, 0x61, 0x50, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x05, 0x20, 0xae, 0x16, 0x18, 0xad, 0x80, 0x20, 0xad, 0x03, 0x18, 0xad, 0x01, 0x01, 0x19, 0x06, 0x18, 0xad, 0x80, 0x20, 0xad, 0x13, 0x18, 0xad,
+  0x13, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xad, 0x01, 0x01, 0x19, 0x02, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x85, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x07, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xae, 0x09, 0x17, 0x01, 0x01, 0x19, 0x80, 0x18, 0xcf, 0x04, 0x18, 0xad, 0x80, 0x20, 0xcd, 0x16, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xad, 0x01, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x06, 0x18, 0xad, 0x82, 0xc8, 0xbe, 0xc8, 0xde, 0xc8, 0xbe, 0x01, 0x18, 0xad, 0x02, 0x18, 0xae, 0x81, 0x18, 0xad, 0x18, 0xae, 0x18, 0x18, 0xad, 0x01, 0x01, 0x19, 0x01, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xcd, 0x05, 0x18, 0xad, 0x81, 0x01, 0x19, 0x01, 0x1a, 0x16, 0x18, 0xad, 0x80, 0x20, 0xad, 0x05, 0x20, 0xae, 0x02, 0x20, 0xce, 0x03, 0x28, 0xcf, 0x02, 0x30, 0xf0, 0x80, 0x38, 0xf0, 0x01, 0x39, 0x11, 0x80, 0x39, 0x12, 0x01, 0x41, 0x32, 0x82, 0x49, 0x33, 0x51, 0x53, 0xa2, 0xb5, 0x04, 0xd3, 0x75, 0x03, 0xd3, 0x55, 0x82, 0xd3, 0x35, 0xd3, 0x55, 0xd3, 0x34, 0x03, 0xd3, 0x35, 0x8b, 0xbb, 0x96, 0xa4, 0x37, 0x74, 0xf9, 0x4d, 0xbc, 0x2e, 0x7e, 0x0e, 0xdf, 0x55, 0x9b, 0x84, 0x98, 0xc3, 0x35, 0xd2, 0xf4, 0xd2, 0xd4, 0xd2, 0xf5, 0x01, 0xd2, 0xd4, 0x81, 0xd2, 0xb5, 0xca, 0xb4, 0x01, 0xd2, 0xb4, 0x80, 0xca, 0xb4, 0x01, 0xd2, 0xb4, 0x94, 0xba, 0xb4, 0xba, 0xf6, 0xca, 0x94, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x73, 0x9b, 0x76, 0x1d, 0xbe, 0x06, 0x1f, 0x06, 0x3f, 0x0d, 0xdf, 0x64, 0x3a, 0xb2, 0xd5, 0xca, 0x54, 0xd2, 0x53, 0xca, 0x53, 0xc2, 0x94, 0x59, 0xb1, 0x28, 0xce, 0x28, 0xcf, 0x28, 0xce, 0x03, 0x20, 0xce, 0x06, 0x20, 0xae, 0x15, 0x18, 0xad, 0x85, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x18, 0x18, 0xad,
+  0x15, 0x18, 0xad, 0x80, 0x01, 0x1a, 0x06, 0x01, 0x19, 0x80, 0x18, 0xae, 0x0e, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x85, 0x18, 0xae, 0x01, 0x17, 0x01, 0x19, 0x00, 0xf9, 0x18, 0xaf, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x12, 0x18, 0xad, 0x86, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0x18, 0xad, 0x18, 0xcd, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xcd, 0x80, 0x20, 0xad, 0x03, 0x18, 0xad, 0x8b, 0x20, 0xad, 0x40, 0xb0, 0xa0, 0x9a, 0xd0, 0xbe, 0xd0, 0x9e, 0xd0, 0xbe, 0xb8, 0x9c, 0x78, 0xb5, 0x28, 0xae, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x19, 0x18, 0xad, 0x01, 0x01, 0x19, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x83, 0x18, 0xae, 0x01, 0x19, 0x01, 0x1a, 0x20, 0xad, 0x14, 0x18, 0xad, 0x01, 0x20, 0xad, 0x03, 0x20, 0xae, 0x03, 0x20, 0xce, 0x03, 0x28, 0xcf, 0x80, 0x30, 0xef, 0x01, 0x30, 0xf0, 0x80, 0x38, 0xf0, 0x01, 0x39, 0x11, 0x01, 0x41, 0x12, 0x84, 0x49, 0x32, 0x49, 0x33, 0x51, 0x73, 0xbb, 0x15, 0xd3, 0x95, 0x02, 0xd3, 0x75, 0x05, 0xd3, 0x55, 0x81, 0xd3, 0x35, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x01, 0xd3, 0x14, 0x83, 0xd3, 0x35, 0xd3, 0x15, 0xd3, 0x14, 0xd3, 0x15, 0x01, 0xd2, 0xf5, 0x88, 0xd2, 0xf4, 0x9b, 0xf7, 0x6d, 0x1a, 0x2e, 0x3d, 0x45, 0xbc, 0x94, 0x18, 0xd2, 0xd4, 0xca, 0xd4, 0xd2, 0xd4, 0x02, 0xd2, 0xb4, 0x81, 0xca, 0xb4, 0xd2, 0xb4, 0x02, 0xd2, 0x94, 0x84, 0xc2, 0xd4, 0x4c, 0xdb, 0x7b, 0xd8, 0x9b, 0x57, 0x44, 0xfc, 0x01, 0x06, 0x3f, 0x89, 0x1d, 0xbe, 0x83, 0xd8, 0xc2, 0x94, 0xca, 0x53, 0xca, 0x54, 0xca, 0x33, 0xca, 0x53, 0xb2, 0xb5, 0x33, 0xb8, 0x28, 0xf0, 0x02, 0x28, 0xcf, 0x01, 0x20, 0xcf, 0x04, 0x20, 0xce, 0x03, 0x20, 0xae, 0x16, 0x18, 0xad, 0x88, 0x18, 0x8e, 0x20, 0xcd, 0x10, 0xd1, 0x01, 0x19, 0x01, 0x1a, 0x10, 0xd1, 0x20, 0xae, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xae, 0x20, 0xad, 0x13, 0x18, 0xad,
+  0x13, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xad, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x09, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x02, 0x18, 0xad, 0x86, 0x20, 0xad, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x01, 0x18, 0x10, 0xd0, 0x18, 0xae, 0x15, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x04, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x05, 0x18, 0xad, 0x83, 0x20, 0xae, 0x40, 0xb0, 0xd0, 0x7d, 0xd8, 0x7e, 0x01, 0xd8, 0x9f, 0x85, 0xe0, 0x7f, 0xd8, 0x9e, 0xd8, 0x9f, 0xb8, 0x7b, 0x28, 0xae, 0x20, 0xad, 0x01, 0x18, 0xae, 0x18, 0x18, 0xad, 0x01, 0x01, 0x19, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x20, 0xad, 0x12, 0x18, 0xad, 0x01, 0x20, 0xae, 0x01, 0x20, 0xad, 0x80, 0x20, 0xae, 0x05, 0x20, 0xce, 0x01, 0x28, 0xcf, 0x02, 0x28, 0xef, 0x01, 0x30, 0xf0, 0x80, 0x31, 0x10, 0x02, 0x39, 0x11, 0x01, 0x41, 0x32, 0x82, 0x49, 0x33, 0x51, 0x74, 0xbb, 0x14, 0x04, 0xd3, 0x75, 0x04, 0xd3, 0x55, 0x81, 0xd3, 0x35, 0xd3, 0x34, 0x02, 0xd3, 0x35, 0x82, 0xd3, 0x14, 0xd3, 0x35, 0xd3, 0x15, 0x01, 0xd3, 0x14, 0x80, 0xd3, 0x15, 0x03, 0xd2, 0xf4, 0x88, 0xd2, 0xf5, 0xd2, 0xd4, 0xc3, 0x35, 0x84, 0x78, 0x4d, 0x7b, 0x4d, 0x5b, 0xab, 0x96, 0xd2, 0xb4, 0xca, 0xb4, 0x01, 0xd2, 0xb4, 0x81, 0xca, 0x94, 0xca, 0xb4, 0x01, 0xd2, 0x94, 0x82, 0xd2, 0x73, 0xc2, 0xb4, 0x5c, 0x9a, 0x01, 0x06, 0x1f, 0x81, 0x06, 0x3f, 0x74, 0x19, 0x01, 0xd2, 0x73, 0x01, 0xca, 0x53, 0x84, 0xd2, 0x33, 0xca, 0x53, 0xaa, 0xf6, 0x15, 0x3c, 0x29, 0x51, 0x01, 0x30, 0xf0, 0x01, 0x28, 0xef, 0x02, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x04, 0x20, 0xae, 0x15, 0x18, 0xad, 0x81, 0x18, 0xae, 0x01, 0x17, 0x03, 0x01, 0x19, 0x81, 0x01, 0x17, 0x18, 0xce, 0x01, 0x18, 0xad, 0x01, 0x18, 0xae, 0x80, 0x18, 0xcd, 0x13, 0x18, 0xad,
+  0x15, 0x18, 0xad, 0x80, 0x08, 0xf6, 0x04, 0x01, 0x19, 0x81, 0x01, 0x1a, 0x08, 0xf5, 0x02, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x07, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x81, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x01, 0x19, 0x83, 0x10, 0xb0, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x10, 0x18, 0xad, 0x88, 0x20, 0xad, 0x20, 0x8d, 0x18, 0xad, 0x10, 0xd2, 0x08, 0xf3, 0x10, 0xd3, 0x10, 0xd2, 0x18, 0xad, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0xb0, 0x7a, 0x01, 0xe8, 0x5f, 0x8a, 0xe0, 0x7f, 0xe8, 0x5f, 0xe8, 0x7f, 0xe0, 0x7f, 0xe8, 0x5f, 0xe0, 0x7f, 0x98, 0x98, 0x20, 0xad, 0x18, 0xad, 0x18, 0xcd, 0x20, 0xad, 0x17, 0x18, 0xad, 0x81, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x83, 0x01, 0x19, 0x01, 0x1a, 0x18, 0xad, 0x18, 0xae, 0x0f, 0x18, 0xad, 0x07, 0x20, 0xae, 0x03, 0x20, 0xce, 0x80, 0x20, 0xcf, 0x02, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x01, 0x30, 0xf0, 0x81, 0x31, 0x10, 0x39, 0x10, 0x01, 0x39, 0x11, 0x85, 0x41, 0x12, 0x41, 0x32, 0x49, 0x32, 0x51, 0x53, 0xbb, 0x15, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x01, 0xd3, 0x55, 0x83, 0xd3, 0x54, 0xd3, 0x55, 0xd3, 0x35, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x82, 0xd3, 0x15, 0xcb, 0x34, 0xd3, 0x15, 0x01, 0xd3, 0x14, 0x86, 0xd3, 0x15, 0xd3, 0x14, 0xd2, 0xf4, 0xd2, 0xf5, 0xd2, 0xf4, 0xca, 0xf4, 0xd2, 0xf4, 0x01, 0xd2, 0xd4, 0x80, 0xd2, 0xd5, 0x01, 0xd2, 0xd4, 0x85, 0xbb, 0x55, 0x74, 0x99, 0x35, 0xdc, 0x84, 0x39, 0xc2, 0xf4, 0xd2, 0xb4, 0x02, 0xd2, 0x94, 0x84, 0xca, 0x93, 0xd2, 0x94, 0xd2, 0x74, 0xca, 0x74, 0x9b, 0x76, 0x01, 0x06, 0x1f, 0x81, 0x83, 0xd8, 0xc2, 0x95, 0x03, 0xca, 0x53, 0x82, 0x7b, 0xb8, 0x06, 0x3f, 0x2a, 0x34, 0x01, 0x30, 0xf0, 0x81, 0x30, 0xef, 0x30, 0xf0, 0x04, 0x28, 0xcf, 0x04, 0x20, 0xce, 0x02, 0x20, 0xae, 0x80, 0x20, 0xad, 0x01, 0x20, 0xae, 0x10, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x84, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x00, 0xf9, 0x08, 0xd5, 0x03, 0x18, 0xad, 0x80, 0x20, 0xae, 0x13, 0x18, 0xad,
+  0x14, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x04, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x00, 0xf7, 0x18, 0xce, 0x10, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x84, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x19, 0x01, 0x18, 0x18, 0xd0, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0f, 0x18, 0xad, 0x01, 0x18, 0xae, 0x82, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf9, 0x01, 0x01, 0x19, 0x83, 0x00, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x18, 0xae, 0x05, 0x18, 0xad, 0x83, 0x38, 0xb0, 0xf0, 0x5f, 0xe8, 0x3f, 0xf0, 0x3f, 0x01, 0xf0, 0x5f, 0x02, 0xf0, 0x3f, 0x81, 0xf0, 0x5f, 0xe8, 0x3f, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x18, 0x18, 0xad, 0x81, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x18, 0xad, 0x01, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x81, 0x01, 0x19, 0x01, 0x1a, 0x11, 0x18, 0xad, 0x04, 0x20, 0xae, 0x04, 0x20, 0xce, 0x04, 0x28, 0xcf, 0x80, 0x30, 0xef, 0x02, 0x30, 0xf0, 0x02, 0x39, 0x11, 0x85, 0x41, 0x12, 0x41, 0x32, 0x49, 0x33, 0x51, 0x73, 0xbb, 0x35, 0xd3, 0x95, 0x03, 0xd3, 0x75, 0x04, 0xd3, 0x55, 0x04, 0xd3, 0x35, 0x81, 0xcb, 0x35, 0xd3, 0x15, 0x03, 0xd3, 0x14, 0x02, 0xd2, 0xf4, 0x01, 0xd2, 0xf5, 0x82, 0xca, 0xd4, 0xd2, 0xf4, 0xca, 0xd4, 0x01, 0xd2, 0xd4, 0x81, 0xca, 0xb4, 0xd2, 0xb4, 0x01, 0xca, 0xb4, 0x83, 0x8b, 0xf8, 0x3d, 0x5c, 0x64, 0x99, 0xc2, 0xd4, 0x01, 0xd2, 0x94, 0x01, 0xca, 0x74, 0x80, 0xd2, 0x74, 0x01, 0xca, 0x74, 0x8b, 0x54, 0xbb, 0x5c, 0x9a, 0x35, 0x3d, 0x1d, 0xbe, 0x4c, 0xbb, 0x93, 0x77, 0x9b, 0x36, 0x44, 0xfc, 0x06, 0x1f, 0x1b, 0xf9, 0x39, 0x11, 0x39, 0x10, 0x03, 0x30, 0xf0, 0x80, 0x30, 0xef, 0x03, 0x28, 0xcf, 0x04, 0x20, 0xce, 0x04, 0x20, 0xae, 0x80, 0x20, 0xad, 0x10, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x81, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x81, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x13, 0x18, 0xad,
+  0x13, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x03, 0x01, 0x19, 0x84, 0x08, 0xf4, 0x10, 0xf3, 0x10, 0xd2, 0x18, 0xad, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x08, 0x18, 0xad, 0x85, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x01, 0x18, 0xae, 0x83, 0x00, 0xf7, 0x01, 0x19, 0x01, 0x18, 0x18, 0xce, 0x12, 0x18, 0xad, 0x82, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x82, 0x20, 0xae, 0x18, 0xad, 0x50, 0x92, 0x01, 0xf8, 0x3f, 0x80, 0xf0, 0x3f, 0x03, 0xf8, 0x3f, 0x83, 0xf8, 0x1f, 0xf0, 0x3f, 0xf8, 0x3f, 0x50, 0x92, 0x1a, 0x18, 0xad, 0x01, 0x01, 0x19, 0x06, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x81, 0x01, 0x1a, 0x01, 0x19, 0x10, 0x18, 0xad, 0x05, 0x20, 0xae, 0x03, 0x20, 0xce, 0x03, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x03, 0x30, 0xf0, 0x02, 0x39, 0x11, 0x84, 0x41, 0x12, 0x41, 0x32, 0x49, 0x32, 0x69, 0xb3, 0xc3, 0x55, 0x06, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x03, 0xd3, 0x35, 0x80, 0xd3, 0x15, 0x01, 0xd3, 0x35, 0x02, 0xd3, 0x14, 0x01, 0xd2, 0xf5, 0x03, 0xd2, 0xf4, 0x05, 0xd2, 0xd4, 0x81, 0xca, 0xd4, 0xca, 0xb4, 0x01, 0xd2, 0xb4, 0x94, 0xca, 0xb4, 0xd2, 0x94, 0x9b, 0x97, 0x45, 0x3c, 0x6c, 0x59, 0xc2, 0xb4, 0xca, 0x74, 0xd2, 0x74, 0xd2, 0x73, 0xca, 0x73, 0xd2, 0x73, 0xc2, 0x94, 0x6c, 0x39, 0xc2, 0x94, 0xca, 0x53, 0x8b, 0x98, 0x4c, 0xbb, 0x0d, 0xff, 0x06, 0x3f, 0x0d, 0x7e, 0x39, 0x72, 0x02, 0x39, 0x11, 0x80, 0x38, 0xf0, 0x02, 0x30, 0xf0, 0x80, 0x30, 0xef, 0x03, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x80, 0x20, 0xae, 0x01, 0x20, 0xce, 0x01, 0x20, 0xae, 0x01, 0x20, 0xad, 0x0e, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xad, 0x03, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x82, 0x01, 0x19, 0x01, 0x1a, 0x20, 0xad, 0x17, 0x18, 0xad,
+  0x0d, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xcd, 0x20, 0xae, 0x01, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x02, 0x01, 0x19, 0x81, 0x00, 0xf9, 0x10, 0xcf, 0x1c, 0x18, 0xad, 0x84, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x13, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x82, 0x18, 0xcd, 0x18, 0xad, 0x20, 0xae, 0x02, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x50, 0x92, 0x09, 0xf8, 0x1f, 0x80, 0x50, 0x92, 0x1a, 0x18, 0xad, 0x01, 0x01, 0x19, 0x02, 0x18, 0xad, 0x81, 0x18, 0xae, 0x20, 0xad, 0x04, 0x18, 0xad, 0x81, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xae, 0x20, 0xad, 0x04, 0x18, 0xad, 0x01, 0x20, 0xae, 0x80, 0x20, 0xad, 0x04, 0x20, 0xae, 0x04, 0x20, 0xce, 0x81, 0x28, 0xcf, 0x28, 0xce, 0x03, 0x28, 0xcf, 0x02, 0x30, 0xf0, 0x80, 0x38, 0xf0, 0x01, 0x39, 0x11, 0x85, 0x41, 0x11, 0x41, 0x12, 0x41, 0x32, 0x49, 0x33, 0x92, 0x54, 0xd3, 0x95, 0x03, 0xd3, 0x75, 0x81, 0xd3, 0x55, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x80, 0xd3, 0x55, 0x04, 0xd3, 0x35, 0x03, 0xd3, 0x14, 0x02, 0xd2, 0xf4, 0x81, 0xd2, 0xf5, 0xd2, 0xf4, 0x01, 0xd2, 0xd4, 0x85, 0xca, 0xd4, 0xd2, 0xd4, 0xca, 0xd4, 0xd2, 0xd4, 0xd2, 0xb4, 0xca, 0xb4, 0x01, 0xd2, 0xb4, 0x80, 0xca, 0xb4, 0x02, 0xd2, 0x94, 0x90, 0xca, 0x94, 0x9b, 0x77, 0x44, 0xdc, 0x73, 0xf9, 0xca, 0x73, 0xca, 0x74, 0xd2, 0x54, 0xca, 0x73, 0xca, 0x53, 0xc2, 0x94, 0x35, 0x1c, 0x6c, 0x3a, 0xc2, 0x94, 0xd2, 0x53, 0xca, 0x34, 0x83, 0xb8, 0x5a, 0x55, 0x01, 0x41, 0x32, 0x80, 0x39, 0x12, 0x01, 0x39, 0x11, 0x80, 0x39, 0x10, 0x02, 0x30, 0xf0, 0x81, 0x28, 0xf0, 0x28, 0xef, 0x03, 0x28, 0xcf, 0x80, 0x20, 0xcf, 0x04, 0x20, 0xce, 0x81, 0x20, 0xae, 0x18, 0xad, 0x01, 0x20, 0xae, 0x0f, 0x18, 0xad, 0x05, 0x01, 0x19, 0x81, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x13, 0x18, 0xad,
+  0x0f, 0x18, 0xad, 0x87, 0x18, 0xae, 0x18, 0xad, 0x18, 0xb0, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x19, 0x00, 0xf8, 0x18, 0xd0, 0x1b, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x81, 0x18, 0xce, 0x01, 0x17, 0x01, 0x01, 0x19, 0x80, 0x00, 0xf9, 0x11, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x07, 0x18, 0xad, 0x80, 0x40, 0x90, 0x09, 0xf8, 0x1f, 0x80, 0x28, 0xaf, 0x17, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x01, 0x01, 0x19, 0x04, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x20, 0xad, 0x01, 0x01, 0x19, 0x83, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0x08, 0x18, 0xad, 0x80, 0x20, 0xad, 0x04, 0x20, 0xae, 0x04, 0x20, 0xce, 0x02, 0x28, 0xcf, 0x01, 0x28, 0xef, 0x80, 0x28, 0xf0, 0x02, 0x30, 0xf0, 0x80, 0x38, 0xf0, 0x01, 0x39, 0x11, 0x80, 0x41, 0x12, 0x01, 0x41, 0x32, 0x81, 0x69, 0xd3, 0xc3, 0x55, 0x01, 0xd3, 0x95, 0x03, 0xd3, 0x75, 0x05, 0xd3, 0x55, 0x81, 0xd3, 0x35, 0xcb, 0x55, 0x02, 0xd3, 0x35, 0x80, 0xd3, 0x15, 0x03, 0xd3, 0x14, 0x04, 0xd2, 0xf4, 0x81, 0xca, 0xd4, 0xd2, 0xf4, 0x01, 0xd2, 0xd4, 0x02, 0xd2, 0xb4, 0x02, 0xca, 0xb4, 0x81, 0xd2, 0xb4, 0xca, 0xb4, 0x02, 0xd2, 0x94, 0x85, 0xca, 0x94, 0xd2, 0x74, 0xca, 0x74, 0x8b, 0x78, 0x44, 0x7c, 0xa3, 0x16, 0x01, 0xd2, 0x53, 0x86, 0xca, 0x54, 0xca, 0x53, 0xc2, 0x94, 0x25, 0x7d, 0x0d, 0xdf, 0x83, 0xb8, 0xd2, 0x33, 0x01, 0xca, 0x33, 0x81, 0xba, 0x13, 0x79, 0x93, 0x01, 0x41, 0x12, 0x80, 0x41, 0x11, 0x01, 0x39, 0x11, 0x82, 0x38, 0xf0, 0x30, 0xf0, 0x28, 0xf0, 0x01, 0x30, 0xd0, 0x80, 0x28, 0xef, 0x02, 0x28, 0xcf, 0x05, 0x20, 0xce, 0x01, 0x20, 0xae, 0x81, 0x18, 0xad, 0x20, 0xae, 0x0b, 0x18, 0xad, 0x84, 0x18, 0xae, 0x18, 0xcd, 0x18, 0xad, 0x08, 0xf5, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x83, 0x01, 0x19, 0x01, 0x1a, 0x00, 0xf9, 0x08, 0xf5, 0x18, 0x18, 0xad,
+  0x0b, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x89, 0x10, 0xcf, 0x01, 0x19, 0x00, 0xf9, 0x01, 0x19, 0x00, 0xf8, 0x18, 0xcf, 0x18, 0xad, 0x18, 0xae, 0x18, 0xcd, 0x18, 0xae, 0x31, 0x18, 0xad, 0x84, 0x00, 0xf9, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x00, 0xf9, 0x01, 0x01, 0x19, 0x80, 0x00, 0xf9, 0x04, 0x18, 0xad, 0x84, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0xd0, 0x3c, 0x07, 0xf8, 0x1f, 0x83, 0xd0, 0x3c, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x18, 0x18, 0xad, 0x01, 0x01, 0x19, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x83, 0x00, 0xf9, 0x01, 0x19, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x01, 0x18, 0xae, 0x81, 0x20, 0xae, 0x20, 0xad, 0x01, 0x20, 0xae, 0x01, 0x20, 0xad, 0x01, 0x20, 0xae, 0x01, 0x20, 0xce, 0x80, 0x20, 0xae, 0x05, 0x20, 0xce, 0x04, 0x28, 0xcf, 0x03, 0x30, 0xf0, 0x02, 0x39, 0x11, 0x85, 0x41, 0x11, 0x41, 0x12, 0x51, 0x93, 0xaa, 0xd4, 0xd3, 0x75, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x05, 0xd3, 0x55, 0x02, 0xd3, 0x35, 0x01, 0xd3, 0x14, 0x80, 0xd3, 0x15, 0x03, 0xd3, 0x14, 0x80, 0xd3, 0x15, 0x03, 0xd2, 0xf4, 0x02, 0xd2, 0xd4, 0x80, 0xca, 0xd4, 0x01, 0xd2, 0xb4, 0x82, 0xd2, 0xd4, 0xd2, 0xb4, 0xca, 0xb4, 0x01, 0xd2, 0xb4, 0x81, 0xd2, 0x94, 0xd2, 0xb4, 0x01, 0xca, 0x94, 0x90, 0xd2, 0x94, 0xca, 0x74, 0xca, 0x73, 0xca, 0x74, 0xd2, 0x74, 0xc2, 0x95, 0x6b, 0xb9, 0x6b, 0x99, 0xca, 0x54, 0xca, 0x53, 0xd2, 0x54, 0xca, 0x33, 0xc2, 0x94, 0x24, 0xfd, 0x06, 0x3f, 0x35, 0x1d, 0xb2, 0x95, 0x02, 0xca, 0x13, 0x84, 0xb9, 0xf3, 0x79, 0x92, 0x41, 0x11, 0x41, 0x12, 0x38, 0xf1, 0x01, 0x39, 0x11, 0x80, 0x38, 0xf0, 0x01, 0x30, 0xf0, 0x80, 0x30, 0xef, 0x02, 0x28, 0xcf, 0x80, 0x20, 0xcf, 0x05, 0x20, 0xce, 0x03, 0x20, 0xae, 0x0b, 0x18, 0xad, 0x83, 0x18, 0xae, 0x18, 0xad, 0x18, 0xcf, 0x00, 0xf7, 0x03, 0x01, 0x19, 0x81, 0x01, 0x17, 0x18, 0xce, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x15, 0x18, 0xad,
+  0x0f, 0x18, 0xad, 0x87, 0x18, 0xcf, 0x01, 0x18, 0x00, 0xf9, 0x01, 0x19, 0x00, 0xf9, 0x18, 0xd0, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x19, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x10, 0x18, 0xad, 0x82, 0x08, 0xf5, 0x01, 0x19, 0x00, 0xf9, 0x02, 0x01, 0x19, 0x81, 0x00, 0xfa, 0x08, 0xf5, 0x02, 0x18, 0xad, 0x02, 0x20, 0xad, 0x01, 0x18, 0xad, 0x82, 0x20, 0xad, 0x40, 0x90, 0xf0, 0x3f, 0x06, 0xf8, 0x1f, 0x82, 0x60, 0x73, 0x20, 0xad, 0x20, 0xae, 0x13, 0x18, 0xad, 0x01, 0x18, 0xae, 0x03, 0x18, 0xad, 0x01, 0x01, 0x19, 0x81, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x81, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x01, 0x20, 0xae, 0x82, 0x20, 0xcd, 0x20, 0xae, 0x20, 0xad, 0x03, 0x20, 0xae, 0x05, 0x20, 0xce, 0x80, 0x28, 0xce, 0x03, 0x28, 0xcf, 0x81, 0x30, 0xef, 0x28, 0xf0, 0x02, 0x30, 0xf0, 0x82, 0x39, 0x10, 0x39, 0x11, 0x39, 0x12, 0x01, 0x41, 0x12, 0x83, 0x82, 0x33, 0xcb, 0x55, 0xd3, 0x75, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x03, 0xd3, 0x55, 0x04, 0xd3, 0x35, 0x82, 0xd3, 0x34, 0xd3, 0x14, 0xd3, 0x35, 0x01, 0xd3, 0x14, 0x05, 0xd2, 0xf4, 0x02, 0xd2, 0xd4, 0x81, 0xca, 0xd4, 0xd2, 0xd4, 0x03, 0xd2, 0xb4, 0x80, 0xca, 0xb4, 0x01, 0xd2, 0xb4, 0x80, 0xca, 0xb4, 0x02, 0xd2, 0x94, 0x02, 0xca, 0x74, 0x01, 0xca, 0x73, 0x01, 0xca, 0x53, 0x84, 0xca, 0x74, 0xaa, 0xb6, 0x5b, 0x7a, 0xba, 0x74, 0xca, 0x53, 0x01, 0xca, 0x33, 0x86, 0xc2, 0x54, 0x4b, 0xfb, 0x05, 0x9f, 0x0d, 0x7f, 0x8b, 0x57, 0xc9, 0xf3, 0xca, 0x13, 0x01, 0xc9, 0xf3, 0x86, 0xa9, 0xb3, 0x59, 0x52, 0x41, 0x12, 0x39, 0x31, 0x39, 0x11, 0x31, 0x11, 0x31, 0x10, 0x01, 0x30, 0xf0, 0x81, 0x28, 0xf0, 0x28, 0xef, 0x02, 0x28, 0xcf, 0x05, 0x20, 0xce, 0x03, 0x20, 0xae, 0x0d, 0x18, 0xad, 0x85, 0x20, 0xad, 0x10, 0xd2, 0x08, 0xf3, 0x10, 0xd3, 0x10, 0xd2, 0x20, 0xae, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x15, 0x18, 0xad,
+  0x0d, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xd0, 0x00, 0xf9, 0x01, 0x01, 0x19, 0x85, 0x01, 0x18, 0x10, 0xcf, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x1e, 0x18, 0xad, 0x80, 0x20, 0xad, 0x13, 0x18, 0xad, 0x89, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x18, 0xae, 0x07, 0x18, 0xad, 0x81, 0x40, 0x91, 0xe0, 0x1d, 0x04, 0xf8, 0x1f, 0x80, 0x70, 0x74, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x11, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x04, 0x18, 0xad, 0x84, 0x01, 0x19, 0x01, 0x1a, 0x08, 0xf3, 0x10, 0xd2, 0x20, 0xcd, 0x02, 0x18, 0xad, 0x83, 0x20, 0xae, 0x18, 0xad, 0x20, 0xad, 0x10, 0xd1, 0x01, 0x01, 0x19, 0x86, 0x10, 0xd2, 0x20, 0xad, 0x18, 0xad, 0x20, 0xae, 0x18, 0xcd, 0x20, 0xae, 0x20, 0xcd, 0x05, 0x20, 0xae, 0x04, 0x20, 0xce, 0x03, 0x28, 0xcf, 0x82, 0x28, 0xef, 0x28, 0xcf, 0x28, 0xef, 0x03, 0x30, 0xf0, 0x80, 0x39, 0x10, 0x01, 0x39, 0x11, 0x85, 0x39, 0x12, 0x41, 0x32, 0x49, 0x53, 0xb2, 0xf4, 0xd3, 0x95, 0xdb, 0x95, 0x05, 0xd3, 0x75, 0x04, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x83, 0xd3, 0x34, 0x84, 0xf9, 0x46, 0x7d, 0x1f, 0x5e, 0x02, 0x07, 0xdf, 0x08, 0x07, 0xbf, 0x88, 0x07, 0x9f, 0x1f, 0x1e, 0x36, 0x7d, 0x36, 0x7c, 0x4d, 0xdb, 0x65, 0x3a, 0x84, 0x98, 0x9b, 0xf7, 0xc2, 0xf5, 0x03, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x84, 0xca, 0x74, 0xca, 0x73, 0xd2, 0x53, 0xd2, 0x54, 0xca, 0x74, 0x02, 0xca, 0x53, 0x8b, 0xd2, 0x53, 0x72, 0xd9, 0xaa, 0x76, 0xca, 0x33, 0xd2, 0x33, 0xca, 0x13, 0xca, 0x33, 0x1c, 0x7e, 0x05, 0x9f, 0x05, 0xff, 0x5c, 0x7a, 0xca, 0x13, 0x02, 0xc9, 0xf3, 0x82, 0xd1, 0xf3, 0x91, 0x93, 0x49, 0x11, 0x02, 0x39, 0x11, 0x80, 0x31, 0x10, 0x02, 0x30, 0xf0, 0x01, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xce, 0x02, 0x20, 0xce, 0x04, 0x20, 0xae, 0x80, 0x20, 0xad, 0x0a, 0x18, 0xad, 0x83, 0x18, 0xae, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x13, 0x18, 0xad,
+  0x11, 0x01, 0x19, 0x81, 0x01, 0x18, 0x10, 0xb0, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x1e, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x10, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x10, 0xd1, 0x01, 0x08, 0xf3, 0x82, 0x10, 0xd2, 0x18, 0xad, 0x20, 0xad, 0x0b, 0x18, 0xad, 0x84, 0x70, 0x74, 0x90, 0x77, 0x88, 0x56, 0x88, 0x76, 0x38, 0x8f, 0x03, 0x18, 0xad, 0x01, 0x18, 0xae, 0x11, 0x18, 0xad, 0x87, 0x20, 0xae, 0x18, 0xad, 0x18, 0xcd, 0x18, 0xae, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xae, 0x02, 0x18, 0xad, 0x83, 0x18, 0xce, 0x08, 0xf7, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x82, 0x08, 0xf7, 0x18, 0xce, 0x20, 0xad, 0x03, 0x20, 0xae, 0x81, 0x20, 0xce, 0x20, 0xae, 0x05, 0x20, 0xce, 0x06, 0x28, 0xcf, 0x80, 0x30, 0xef, 0x02, 0x30, 0xf0, 0x01, 0x31, 0x11, 0x86, 0x38, 0xf1, 0x39, 0x11, 0x41, 0x11, 0x41, 0x32, 0x61, 0x93, 0xc3, 0x55, 0xd3, 0x96, 0x02, 0xd3, 0x95, 0x02, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x81, 0xb3, 0xd6, 0x27, 0x1d, 0x01, 0x07, 0xff, 0x80, 0x07, 0xbf, 0x01, 0x07, 0x9f, 0x81, 0x07, 0x7f, 0x07, 0x9f, 0x06, 0x07, 0x7f, 0x80, 0x07, 0x5f, 0x06, 0x07, 0x7f, 0x01, 0x07, 0x9f, 0x83, 0x1e, 0xfe, 0x46, 0x1c, 0x6d, 0x1a, 0x9b, 0xd6, 0x02, 0xca, 0x74, 0x95, 0xca, 0x73, 0xd2, 0x74, 0xca, 0x74, 0xca, 0x53, 0xd2, 0x54, 0xca, 0x54, 0xd2, 0x53, 0xca, 0x53, 0xca, 0x33, 0xa2, 0x75, 0x9a, 0x76, 0xca, 0x33, 0xca, 0x13, 0xca, 0x33, 0x9a, 0xd6, 0x04, 0xff, 0x05, 0xbf, 0x06, 0x3f, 0x35, 0x7c, 0xc2, 0x54, 0xc9, 0xf3, 0xd1, 0xf3, 0x01, 0xc9, 0xf3, 0x82, 0xb9, 0xd3, 0x61, 0x52, 0x41, 0x11, 0x01, 0x39, 0x11, 0x80, 0x38, 0xf0, 0x02, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x02, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x03, 0x20, 0xae, 0x01, 0x20, 0xad, 0x07, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x07, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x13, 0x18, 0xad,
+  0x0c, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x83, 0x01, 0x1a, 0x00, 0xf8, 0x10, 0xd0, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x1b, 0x18, 0xad, 0x80, 0x18, 0xae, 0x1b, 0x18, 0xad, 0x80, 0x20, 0x8e, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x06, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x20, 0xae, 0x04, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x17, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x03, 0x01, 0x19, 0x8d, 0x01, 0x1a, 0x00, 0xf9, 0x08, 0xf5, 0x18, 0xae, 0x20, 0xad, 0x18, 0xad, 0x08, 0xf4, 0x01, 0x19, 0x01, 0x1a, 0x00, 0xf7, 0x01, 0x17, 0x01, 0x19, 0x01, 0x1a, 0x08, 0xf5, 0x01, 0x20, 0xae, 0x80, 0x20, 0xad, 0x02, 0x20, 0xce, 0x80, 0x20, 0xcd, 0x03, 0x20, 0xce, 0x06, 0x28, 0xcf, 0x80, 0x30, 0xef, 0x02, 0x30, 0xf0, 0x81, 0x38, 0xf0, 0x39, 0x10, 0x02, 0x39, 0x11, 0x83, 0x41, 0x12, 0x41, 0x32, 0x61, 0x93, 0xcb, 0x55, 0x01, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0xd3, 0x95, 0x02, 0xd3, 0x75, 0x81, 0xd3, 0x55, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x84, 0xcb, 0x55, 0xd3, 0x34, 0xcb, 0x55, 0xac, 0x17, 0x0f, 0xbf, 0x01, 0x07, 0xff, 0x01, 0x07, 0xbf, 0x80, 0x07, 0x7f, 0x01, 0x07, 0x5f, 0x10, 0x07, 0x3f, 0x01, 0x07, 0x5f, 0x01, 0x07, 0x7f, 0x85, 0x07, 0x9f, 0x07, 0xbf, 0x36, 0x5c, 0x74, 0xb9, 0xb3, 0x15, 0xca, 0x73, 0x01, 0xca, 0x54, 0x02, 0xca, 0x53, 0x85, 0xca, 0x33, 0xd2, 0x33, 0xca, 0x33, 0xb2, 0x35, 0xaa, 0x16, 0xca, 0x33, 0x01, 0xca, 0x13, 0x8f, 0x7b, 0x37, 0x05, 0x5f, 0x05, 0xff, 0x06, 0x7f, 0x25, 0xdd, 0xa2, 0xf5, 0xd1, 0xd3, 0xc9, 0xf3, 0xc9, 0xd3, 0xc9, 0xd2, 0xc9, 0xd3, 0x91, 0x93, 0x49, 0x32, 0x41, 0x11, 0x39, 0x11, 0x38, 0xf0, 0x02, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x02, 0x28, 0xcf, 0x80, 0x20, 0xcf, 0x02, 0x20, 0xce, 0x04, 0x20, 0xae, 0x80, 0x20, 0xad, 0x07, 0x18, 0xad, 0x80, 0x20, 0xad, 0x06, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x03, 0x18, 0xad, 0x80, 0x20, 0xad, 0x14, 0x18, 0xad,
+  0x10, 0x01, 0x19, 0x80, 0x18, 0xb0, 0x25, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xcd, 0x13, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x0a, 0x18, 0xad, 0x80, 0x18, 0xae, 0x06, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x16, 0x18, 0xad, 0x83, 0x18, 0xae, 0x20, 0xad, 0x01, 0x19, 0x00, 0xf9, 0x01, 0x01, 0x1a, 0x83, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x02, 0x18, 0xad, 0x01, 0x01, 0x19, 0x85, 0x10, 0xd3, 0x18, 0xce, 0x20, 0xad, 0x10, 0xf4, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x20, 0xae, 0x07, 0x20, 0xce, 0x05, 0x28, 0xcf, 0x80, 0x30, 0xef, 0x03, 0x30, 0xf0, 0x80, 0x38, 0xf0, 0x02, 0x39, 0x11, 0x80, 0x41, 0x11, 0x01, 0x41, 0x32, 0x81, 0x61, 0xb3, 0xcb, 0x75, 0x02, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x81, 0xd3, 0x55, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x89, 0x8c, 0xb8, 0x0f, 0xbf, 0x07, 0xff, 0x07, 0xdf, 0x07, 0xbf, 0x07, 0x9f, 0x07, 0x7f, 0x07, 0x5f, 0x07, 0x3f, 0x07, 0x1f, 0x06, 0x06, 0xff, 0x81, 0x06, 0xdf, 0x06, 0xff, 0x02, 0x06, 0xdf, 0x03, 0x06, 0xff, 0x02, 0x07, 0x1f, 0x03, 0x07, 0x3f, 0x01, 0x07, 0x5f, 0x83, 0x07, 0x1f, 0x2d, 0xfd, 0x74, 0x19, 0xb2, 0xb5, 0x01, 0xca, 0x53, 0x03, 0xca, 0x33, 0x82, 0xd2, 0x33, 0xca, 0x14, 0xa2, 0x15, 0x01, 0xca, 0x13, 0x88, 0xc9, 0xf3, 0x83, 0x38, 0x05, 0xbf, 0x06, 0x3f, 0x06, 0xbf, 0x0e, 0x9f, 0xaa, 0xd5, 0xc9, 0xd3, 0xc9, 0xd2, 0x01, 0xc9, 0xd3, 0x82, 0xc9, 0xb2, 0xb1, 0xb2, 0x59, 0x31, 0x02, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xf0, 0x01, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x04, 0x20, 0xce, 0x02, 0x20, 0xae, 0x01, 0x20, 0xad, 0x07, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x13, 0x18, 0xad,
+  0x7c, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x03, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x01, 0x18, 0xad, 0x86, 0x18, 0xcf, 0x01, 0x1a, 0x01, 0x19, 0x10, 0xd0, 0x18, 0xad, 0x20, 0xae, 0x18, 0xd0, 0x01, 0x01, 0x19, 0x06, 0x20, 0xce, 0x80, 0x20, 0xcf, 0x04, 0x28, 0xcf, 0x01, 0x28, 0xef, 0x03, 0x30, 0xf0, 0x82, 0x38, 0xf0, 0x31, 0x11, 0x38, 0xf1, 0x01, 0x39, 0x11, 0x01, 0x41, 0x12, 0x82, 0x41, 0x32, 0x61, 0x93, 0xcb, 0x75, 0x02, 0xd3, 0x95, 0x04, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x80, 0xd3, 0x54, 0x01, 0xd3, 0x55, 0x8b, 0xc3, 0x95, 0x5d, 0xfa, 0x07, 0xff, 0x07, 0xdf, 0x07, 0xbf, 0x07, 0x9f, 0x07, 0x7f, 0x07, 0x5f, 0x07, 0x3f, 0x07, 0x1f, 0x06, 0xff, 0x06, 0xdf, 0x01, 0x06, 0xbf, 0x03, 0x06, 0x9f, 0x01, 0x06, 0xbf, 0x06, 0x06, 0x9f, 0x02, 0x06, 0xbf, 0x01, 0x06, 0xdf, 0x02, 0x06, 0xff, 0x01, 0x07, 0x1f, 0x85, 0x06, 0xff, 0x06, 0xbf, 0x06, 0x5f, 0x05, 0xbf, 0x44, 0x3c, 0x8a, 0xf7, 0x03, 0xca, 0x33, 0x02, 0xca, 0x13, 0x90, 0x99, 0xb6, 0xc9, 0xf3, 0xca, 0x13, 0xc9, 0xf3, 0x4c, 0x3b, 0x06, 0x1f, 0x06, 0x9f, 0x06, 0xff, 0x0e, 0xbe, 0xa2, 0xd5, 0xc9, 0xb3, 0xc9, 0xd3, 0xc9, 0xb2, 0xc9, 0xb3, 0xc9, 0xb2, 0xc1, 0xb3, 0x71, 0x52, 0x01, 0x39, 0x11, 0x80, 0x31, 0x10, 0x01, 0x30, 0xf0, 0x81, 0x28, 0xf0, 0x30, 0xd0, 0x02, 0x28, 0xcf, 0x80, 0x20, 0xcf, 0x02, 0x20, 0xce, 0x01, 0x20, 0xae, 0x81, 0x20, 0xad, 0x20, 0xae, 0x07, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x02, 0x18, 0xad, 0x85, 0x18, 0xae, 0x18, 0xad, 0x18, 0xce, 0x08, 0xf7, 0x01, 0x19, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x13, 0x01, 0x19,
+  0x7f, 0x18, 0xad, 0x01, 0x18, 0xad, 0x03, 0x01, 0x19, 0x02, 0x01, 0x1a, 0x83, 0x01, 0x19, 0x20, 0xae, 0x20, 0xad, 0x18, 0xce, 0x01, 0x01, 0x19, 0x87, 0x10, 0xd3, 0x20, 0xce, 0x20, 0xae, 0x10, 0xf4, 0x01, 0x19, 0x01, 0x1a, 0x20, 0xce, 0x20, 0xae, 0x02, 0x20, 0xce, 0x03, 0x28, 0xcf, 0x83, 0x28, 0xef, 0x28, 0xcf, 0x28, 0xef, 0x30, 0xef, 0x04, 0x30, 0xf0, 0x02, 0x39, 0x11, 0x89, 0x41, 0x12, 0x39, 0x12, 0x41, 0x12, 0x41, 0x32, 0x41, 0x33, 0x51, 0x53, 0xbb, 0x35, 0xd3, 0x95, 0xd3, 0x96, 0xd3, 0x95, 0x02, 0xd3, 0x75, 0x81, 0xd3, 0x55, 0xd3, 0x75, 0x04, 0xd3, 0x55, 0x8c, 0xbb, 0xd6, 0x5d, 0xfb, 0x0f, 0xbf, 0x07, 0xff, 0x07, 0xdf, 0x07, 0xbf, 0x07, 0x7f, 0x07, 0x5f, 0x07, 0x3f, 0x07, 0x1f, 0x06, 0xff, 0x06, 0xdf, 0x06, 0xbf, 0x01, 0x06, 0x9f, 0x02, 0x06, 0x7f, 0x09, 0x06, 0x5f, 0x80, 0x06, 0x7f, 0x01, 0x06, 0x5f, 0x01, 0x06, 0x7f, 0x02, 0x06, 0x9f, 0x01, 0x06, 0xbf, 0x88, 0x06, 0xdf, 0x06, 0xbf, 0x06, 0x9f, 0x06, 0x5f, 0x05, 0xff, 0x05, 0x3f, 0x04, 0x9f, 0x1b, 0xbe, 0x82, 0x98, 0x04, 0xca, 0x13, 0x81, 0xd1, 0xf3, 0x99, 0xb6, 0x01, 0xc9, 0xf3, 0x87, 0xb2, 0x54, 0x0d, 0x9f, 0x06, 0x7f, 0x06, 0xdf, 0x06, 0xff, 0x0e, 0xbf, 0xa2, 0xd5, 0xc9, 0xd2, 0x02, 0xc9, 0xb3, 0x82, 0xc9, 0xb2, 0xc9, 0xb3, 0x81, 0x52, 0x02, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x82, 0x28, 0xf0, 0x30, 0xf0, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x04, 0x20, 0xce, 0x01, 0x20, 0xae, 0x06, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x05, 0x18, 0xad, 0x81, 0x18, 0xae, 0x00, 0xf7, 0x02, 0x01, 0x19, 0x80, 0x00, 0xf9, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x13, 0x01, 0x19,
+  0x7c, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x84, 0x20, 0xad, 0x18, 0xae, 0x08, 0xf5, 0x01, 0x19, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x85, 0x01, 0x1a, 0x08, 0xf5, 0x18, 0xae, 0x20, 0xae, 0x18, 0xad, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x88, 0x09, 0x18, 0x09, 0x17, 0x01, 0x39, 0x01, 0x1a, 0x10, 0xf5, 0x20, 0xce, 0x20, 0xcf, 0x28, 0xcf, 0x28, 0xce, 0x04, 0x28, 0xcf, 0x81, 0x28, 0xef, 0x30, 0xef, 0x02, 0x30, 0xf0, 0x82, 0x31, 0x10, 0x30, 0xf0, 0x38, 0xf0, 0x02, 0x39, 0x11, 0x01, 0x41, 0x12, 0x87, 0x41, 0x32, 0x49, 0x32, 0x41, 0x33, 0x49, 0x33, 0xbb, 0x35, 0xd3, 0x95, 0xd3, 0x96, 0xd3, 0x95, 0x05, 0xd3, 0x75, 0x01, 0xd3, 0x55, 0x82, 0xac, 0x37, 0x6d, 0x9a, 0x2e, 0xfe, 0x01, 0x07, 0xff, 0x89, 0x07, 0xdf, 0x07, 0xbf, 0x07, 0x9f, 0x07, 0x5f, 0x07, 0x3f, 0x07, 0x1f, 0x06, 0xdf, 0x06, 0xbf, 0x06, 0x9f, 0x06, 0x7f, 0x01, 0x06, 0x5f, 0x01, 0x06, 0x3f, 0x08, 0x06, 0x1f, 0x80, 0x05, 0xff, 0x05, 0x06, 0x1f, 0x02, 0x06, 0x3f, 0x03, 0x06, 0x5f, 0x01, 0x06, 0x7f, 0x87, 0x06, 0x3f, 0x05, 0xdf, 0x05, 0x5f, 0x04, 0xbf, 0x04, 0x3f, 0x03, 0x7f, 0x1a, 0xbe, 0x7a, 0x18, 0x02, 0xca, 0x13, 0x8b, 0xc9, 0xf3, 0xc1, 0xf4, 0x71, 0x78, 0xc9, 0xf2, 0xd1, 0xf3, 0x83, 0x38, 0x06, 0x1f, 0x06, 0xbf, 0x06, 0xff, 0x07, 0x1f, 0x0e, 0xdf, 0xa2, 0xd5, 0x01, 0xc9, 0xb3, 0x80, 0xc9, 0xb2, 0x01, 0xc9, 0x92, 0x84, 0xc9, 0x93, 0x91, 0x72, 0x39, 0x11, 0x39, 0x10, 0x31, 0x10, 0x02, 0x30, 0xf0, 0x01, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x81, 0x20, 0xae, 0x20, 0xad, 0x01, 0x20, 0xae, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x87, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x13, 0x01, 0x1a,
+  0x7c, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x02, 0x18, 0xae, 0x81, 0x00, 0xf7, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x83, 0x01, 0x1a, 0x00, 0xf7, 0x18, 0xce, 0x20, 0xad, 0x01, 0x20, 0xae, 0x81, 0x18, 0xce, 0x09, 0x18, 0x01, 0x01, 0x1a, 0x85, 0x09, 0x19, 0x01, 0x1a, 0x09, 0x17, 0x20, 0xcf, 0x28, 0xae, 0x20, 0xcf, 0x02, 0x28, 0xcf, 0x02, 0x28, 0xef, 0x80, 0x30, 0xef, 0x02, 0x30, 0xf0, 0x01, 0x38, 0xf0, 0x03, 0x39, 0x11, 0x83, 0x39, 0x12, 0x41, 0x12, 0x41, 0x32, 0x49, 0x32, 0x01, 0x49, 0x33, 0x81, 0x49, 0x53, 0xa2, 0xb4, 0x01, 0xd3, 0x95, 0x02, 0xd3, 0x75, 0x86, 0xd3, 0x55, 0xd3, 0x75, 0xd3, 0x55, 0xc3, 0xb6, 0x85, 0x19, 0x4e, 0x3c, 0x0f, 0x9f, 0x03, 0x07, 0xff, 0x81, 0x07, 0xdf, 0x07, 0x9f, 0x01, 0x07, 0x7f, 0x87, 0x07, 0x5f, 0x07, 0x3f, 0x06, 0xff, 0x06, 0xbf, 0x06, 0x9f, 0x06, 0x7f, 0x06, 0x5f, 0x06, 0x3f, 0x01, 0x06, 0x1f, 0x80, 0x05, 0xff, 0x03, 0x05, 0xdf, 0x01, 0x05, 0xbf, 0x01, 0x05, 0xdf, 0x05, 0x05, 0xbf, 0x03, 0x05, 0xdf, 0x01, 0x05, 0xff, 0x05, 0x06, 0x1f, 0x92, 0x05, 0xdf, 0x05, 0x7f, 0x04, 0xff, 0x04, 0x7f, 0x03, 0xdf, 0x03, 0x1f, 0x02, 0x5f, 0x19, 0xde, 0x79, 0xb8, 0xc9, 0xf3, 0xca, 0x13, 0xc9, 0xf3, 0xb9, 0xd3, 0xa1, 0xb5, 0xc9, 0xd3, 0xc9, 0xf3, 0x4c, 0x5b, 0x06, 0x5f, 0x06, 0xdf, 0x01, 0x07, 0x1f, 0x81, 0x0e, 0xdf, 0xa2, 0xb5, 0x01, 0xc9, 0xb3, 0x01, 0xc9, 0x92, 0x85, 0xc9, 0x93, 0xc9, 0x92, 0xb1, 0x72, 0x49, 0x11, 0x39, 0x11, 0x38, 0xf0, 0x01, 0x30, 0xf0, 0x80, 0x30, 0xef, 0x01, 0x28, 0xef, 0x80, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x81, 0x20, 0xae, 0x20, 0xce, 0x02, 0x20, 0xae, 0x09, 0x18, 0xad, 0x82, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x17, 0x01, 0x19,
+  0x7f, 0x18, 0xad, 0x02, 0x18, 0xad, 0x81, 0x20, 0xae, 0x10, 0xd2, 0x01, 0x10, 0xf3, 0x84, 0x10, 0xd2, 0x20, 0xae, 0x18, 0xae, 0x20, 0xae, 0x18, 0xce, 0x02, 0x20, 0xce, 0x85, 0x18, 0xf2, 0x10, 0xf4, 0x11, 0x14, 0x18, 0xf3, 0x20, 0xcf, 0x28, 0xce, 0x03, 0x28, 0xcf, 0x01, 0x28, 0xef, 0x80, 0x30, 0xef, 0x02, 0x30, 0xf0, 0x81, 0x31, 0x10, 0x38, 0xf0, 0x02, 0x39, 0x11, 0x82, 0x39, 0x12, 0x39, 0x11, 0x41, 0x12, 0x01, 0x41, 0x32, 0x02, 0x49, 0x33, 0x81, 0x49, 0x53, 0xa2, 0xb5, 0x02, 0xd3, 0x95, 0x02, 0xd3, 0x75, 0x83, 0xc3, 0xb5, 0x7d, 0x59, 0x36, 0xbd, 0x07, 0xdf, 0x05, 0x07, 0xff, 0x01, 0x07, 0xbf, 0x01, 0x07, 0x9f, 0x01, 0x07, 0x7f, 0x84, 0x07, 0x1f, 0x06, 0xde, 0x06, 0x9e, 0x06, 0x7e, 0x06, 0x5e, 0x01, 0x06, 0x3f, 0x82, 0x06, 0x1e, 0x05, 0xff, 0x05, 0xdf, 0x01, 0x05, 0xbf, 0x02, 0x05, 0x9f, 0x0b, 0x05, 0x7f, 0x02, 0x05, 0x9f, 0x02, 0x05, 0xbf, 0x02, 0x05, 0xdf, 0x8a, 0x05, 0xbf, 0x05, 0x7f, 0x04, 0xff, 0x04, 0x9f, 0x03, 0xff, 0x03, 0x7f, 0x02, 0xbf, 0x02, 0x1f, 0x01, 0x7f, 0x21, 0x3d, 0x99, 0x96, 0x01, 0xc9, 0xf3, 0x8a, 0xb9, 0xd4, 0x99, 0xb6, 0xc9, 0xd3, 0xc2, 0x13, 0x0d, 0xbf, 0x06, 0x9f, 0x06, 0xff, 0x07, 0x1f, 0x07, 0x3f, 0x0e, 0xff, 0xa2, 0xb5, 0x03, 0xc9, 0x92, 0x01, 0xc9, 0x72, 0x83, 0xa9, 0x72, 0x49, 0x11, 0x39, 0x11, 0x38, 0xf0, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x02, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x01, 0x20, 0xae, 0x01, 0x20, 0xad, 0x07, 0x18, 0xad, 0x81, 0x18, 0xae, 0x01, 0x17, 0x01, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x81, 0x01, 0x19, 0x01, 0x1a, 0x17, 0x01, 0x19,
+  0x7d, 0x18, 0xad, 0x81, 0x20, 0xae, 0x18, 0xad, 0x04, 0x20, 0xad, 0x83, 0x20, 0xae, 0x18, 0xce, 0x20, 0xae, 0x20, 0xad, 0x01, 0x20, 0xae, 0x81, 0x20, 0xce, 0x20, 0xae, 0x03, 0x20, 0xce, 0x84, 0x20, 0xaf, 0x20, 0xce, 0x28, 0xce, 0x28, 0xcf, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x03, 0x30, 0xf0, 0x81, 0x31, 0x10, 0x39, 0x10, 0x03, 0x39, 0x11, 0x84, 0x41, 0x11, 0x41, 0x31, 0x41, 0x12, 0x41, 0x32, 0x49, 0x13, 0x01, 0x49, 0x33, 0x89, 0x49, 0x53, 0x51, 0x54, 0xaa, 0xb5, 0xd3, 0x75, 0xd3, 0x95, 0xd3, 0x75, 0xd3, 0x95, 0xd3, 0x75, 0x94, 0xd8, 0x46, 0x7c, 0x04, 0x07, 0xdf, 0x02, 0x07, 0xff, 0x01, 0x07, 0xdf, 0x01, 0x07, 0xbf, 0x01, 0x07, 0x9f, 0x01, 0x07, 0x7f, 0x81, 0x06, 0xde, 0x06, 0xbe, 0x01, 0x06, 0x7e, 0x83, 0x06, 0x5e, 0x06, 0x3e, 0x06, 0x1e, 0x05, 0xfe, 0x01, 0x05, 0xde, 0x81, 0x05, 0xbe, 0x05, 0x9f, 0x01, 0x05, 0x7f, 0x01, 0x05, 0x5f, 0x0c, 0x05, 0x3f, 0x02, 0x05, 0x5f, 0x04, 0x05, 0x7f, 0x93, 0x05, 0x5f, 0x04, 0xff, 0x04, 0xbf, 0x04, 0x1f, 0x03, 0x9f, 0x03, 0x1f, 0x02, 0x5f, 0x01, 0xbf, 0x01, 0x3f, 0x00, 0xbf, 0x40, 0xfb, 0xb1, 0xb5, 0xc9, 0xd2, 0xb1, 0xd5, 0xb1, 0xd4, 0xc9, 0xb3, 0x63, 0x99, 0x06, 0x1f, 0x06, 0xdf, 0x07, 0x1f, 0x01, 0x07, 0x3f, 0x81, 0x0e, 0xff, 0xa2, 0xb5, 0x01, 0xc9, 0x92, 0x01, 0xc9, 0x72, 0x84, 0xc9, 0x92, 0xc9, 0x72, 0xb1, 0x52, 0x41, 0x11, 0x39, 0x11, 0x02, 0x30, 0xf0, 0x80, 0x30, 0xef, 0x02, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x80, 0x20, 0xae, 0x01, 0x20, 0xad, 0x80, 0x20, 0xae, 0x03, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x01, 0x17, 0x01, 0x01, 0x1a, 0x05, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x13, 0x01, 0x19,
+  0x7d, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x01, 0x20, 0xae, 0x80, 0x18, 0xad, 0x01, 0x20, 0xae, 0x82, 0x20, 0xce, 0x20, 0xcd, 0x20, 0xae, 0x02, 0x20, 0xce, 0x82, 0x28, 0xce, 0x20, 0xcf, 0x20, 0xce, 0x02, 0x28, 0xcf, 0x84, 0x28, 0xef, 0x30, 0xef, 0x30, 0xd0, 0x28, 0xf0, 0x31, 0x10, 0x01, 0x30, 0xf0, 0x80, 0x30, 0xf1, 0x04, 0x39, 0x11, 0x80, 0x41, 0x12, 0x02, 0x41, 0x32, 0x81, 0x49, 0x32, 0x49, 0x33, 0x01, 0x49, 0x53, 0x82, 0x51, 0x53, 0x4a, 0x16, 0xa2, 0xb5, 0x02, 0xd3, 0x95, 0x84, 0xd3, 0x75, 0x85, 0x39, 0x1f, 0x5e, 0x07, 0xff, 0x07, 0xdf, 0x07, 0x07, 0xff, 0x02, 0x07, 0xdf, 0x01, 0x07, 0xbf, 0x86, 0x07, 0x9f, 0x07, 0xbf, 0x07, 0x5f, 0x06, 0xbe, 0x06, 0x9d, 0x06, 0x7d, 0x06, 0x5d, 0x01, 0x06, 0x3d, 0x81, 0x06, 0x1d, 0x05, 0xfe, 0x01, 0x05, 0xde, 0x83, 0x05, 0xbe, 0x05, 0x9e, 0x05, 0x7e, 0x05, 0x5f, 0x01, 0x05, 0x3f, 0x01, 0x05, 0x1f, 0x0a, 0x04, 0xff, 0x05, 0x05, 0x1f, 0x01, 0x05, 0x3f, 0x94, 0x05, 0x1f, 0x04, 0xdf, 0x04, 0xbf, 0x04, 0x3f, 0x03, 0xdf, 0x03, 0x5f, 0x02, 0xbf, 0x02, 0x1f, 0x01, 0x7f, 0x00, 0xff, 0x00, 0x9f, 0x08, 0x7f, 0x71, 0x19, 0xc9, 0xd3, 0xb1, 0xd4, 0xb9, 0xd3, 0xc9, 0xb3, 0x1c, 0xfe, 0x06, 0x5f, 0x06, 0xff, 0x07, 0x1f, 0x01, 0x07, 0x3f, 0x8b, 0x1e, 0xbe, 0xb9, 0xf3, 0xc9, 0x93, 0xc9, 0x72, 0xc9, 0x92, 0xc9, 0x72, 0xc9, 0x73, 0xc9, 0x52, 0xb1, 0x52, 0x41, 0x11, 0x39, 0x10, 0x38, 0xf0, 0x01, 0x30, 0xf0, 0x03, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x02, 0x20, 0xae, 0x80, 0x20, 0xad, 0x04, 0x18, 0xad, 0x84, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x39, 0x03, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x13, 0x18, 0xad,
+  0x7c, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x20, 0xad, 0x01, 0x18, 0xad, 0x84, 0x20, 0xae, 0x18, 0xad, 0x20, 0xad, 0x20, 0xcd, 0x20, 0xce, 0x01, 0x20, 0xae, 0x80, 0x20, 0xcf, 0x03, 0x20, 0xce, 0x01, 0x20, 0xcf, 0x02, 0x28, 0xcf, 0x81, 0x28, 0xef, 0x28, 0xcf, 0x04, 0x30, 0xf0, 0x80, 0x39, 0x10, 0x03, 0x39, 0x11, 0x02, 0x41, 0x32, 0x80, 0x49, 0x32, 0x02, 0x49, 0x33, 0x84, 0x49, 0x53, 0x4a, 0x15, 0x34, 0x39, 0x16, 0xbd, 0x85, 0x19, 0x02, 0xd3, 0x95, 0x81, 0x94, 0xd8, 0x1f, 0x5e, 0x01, 0x07, 0xdf, 0x07, 0x07, 0xff, 0x04, 0x07, 0xdf, 0x03, 0x07, 0xbf, 0x80, 0x07, 0x1e, 0x01, 0x06, 0x9d, 0x81, 0x06, 0x7d, 0x06, 0x5d, 0x01, 0x06, 0x3d, 0x89, 0x06, 0x1d, 0x05, 0xfd, 0x05, 0xdd, 0x05, 0xbd, 0x05, 0x9d, 0x05, 0x9e, 0x05, 0x7e, 0x05, 0x5e, 0x05, 0x3e, 0x05, 0x1e, 0x01, 0x04, 0xff, 0x80, 0x04, 0xdf, 0x02, 0x04, 0xbf, 0x04, 0x04, 0x9f, 0x05, 0x04, 0xbf, 0x81, 0x04, 0xdf, 0x04, 0xbf, 0x02, 0x04, 0xdf, 0x98, 0x04, 0xbf, 0x04, 0x9f, 0x04, 0x3f, 0x03, 0xdf, 0x03, 0x5f, 0x02, 0xff, 0x02, 0x5f, 0x01, 0xbf, 0x01, 0x3f, 0x00, 0xdf, 0x00, 0x7f, 0x00, 0x5f, 0x18, 0x5e, 0x89, 0x57, 0x61, 0xb9, 0xc9, 0xd3, 0x9a, 0x96, 0x05, 0x9f, 0x06, 0x7f, 0x06, 0xff, 0x07, 0x1f, 0x07, 0x3f, 0x07, 0x5f, 0x26, 0x7d, 0xb9, 0xd3, 0x04, 0xc9, 0x72, 0x83, 0xc9, 0x52, 0xb1, 0x52, 0x41, 0x11, 0x38, 0xf1, 0x02, 0x30, 0xf0, 0x02, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x01, 0x20, 0xae, 0x01, 0x20, 0xad, 0x01, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xcf, 0x00, 0xf7, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x02, 0x01, 0x1a, 0x83, 0x00, 0xf6, 0x18, 0xce, 0x18, 0xad, 0x20, 0xae, 0x15, 0x18, 0xad,
+  0x34, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x41, 0x18, 0xad, 0x02, 0x20, 0xae, 0x80, 0x20, 0xad, 0x02, 0x20, 0xae, 0x03, 0x20, 0xce, 0x82, 0x20, 0xcf, 0x28, 0xcf, 0x20, 0xcf, 0x03, 0x28, 0xcf, 0x03, 0x30, 0xf0, 0x80, 0x31, 0x10, 0x01, 0x38, 0xf1, 0x01, 0x39, 0x11, 0x83, 0x41, 0x11, 0x41, 0x12, 0x41, 0x32, 0x41, 0x12, 0x01, 0x49, 0x32, 0x01, 0x49, 0x33, 0x85, 0x69, 0xb4, 0x63, 0x36, 0x6c, 0xd9, 0x4e, 0x5b, 0x07, 0xdf, 0x85, 0x39, 0x01, 0xd3, 0x95, 0x81, 0xbc, 0x17, 0x3e, 0x9c, 0x02, 0x07, 0xdf, 0x0a, 0x07, 0xff, 0x81, 0x07, 0xdf, 0x07, 0xff, 0x02, 0x07, 0xdf, 0x82, 0x07, 0xbf, 0x07, 0xdf, 0x06, 0xbd, 0x01, 0x06, 0x9c, 0x80, 0x06, 0x7c, 0x01, 0x06, 0x5c, 0x8f, 0x06, 0x3c, 0x06, 0x1c, 0x05, 0xfc, 0x05, 0xdc, 0x05, 0xbc, 0x05, 0xbd, 0x05, 0x9d, 0x05, 0x7d, 0x05, 0x5d, 0x05, 0x3e, 0x05, 0x1e, 0x04, 0xfe, 0x04, 0xde, 0x04, 0xbe, 0x04, 0xbf, 0x04, 0x9f, 0x02, 0x04, 0x7f, 0x02, 0x04, 0x5f, 0x09, 0x04, 0x7f, 0x8c, 0x04, 0x9f, 0x04, 0x7f, 0x04, 0x5f, 0x04, 0x1f, 0x03, 0xdf, 0x03, 0x7f, 0x03, 0x1f, 0x02, 0x9f, 0x02, 0x1f, 0x01, 0x7f, 0x01, 0x1f, 0x00, 0xbf, 0x00, 0x5f, 0x01, 0x00, 0x1f, 0x86, 0x00, 0xff, 0x89, 0xb7, 0xc9, 0xb3, 0x44, 0x7b, 0x06, 0x5f, 0x06, 0xbf, 0x07, 0x1f, 0x01, 0x07, 0x3f, 0x81, 0x07, 0x5f, 0x3d, 0x9b, 0x03, 0xc9, 0x72, 0x02, 0xc9, 0x52, 0x80, 0xa1, 0x32, 0x01, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x81, 0x20, 0xce, 0x20, 0xcf, 0x02, 0x20, 0xce, 0x86, 0x20, 0xae, 0x20, 0xad, 0x20, 0xae, 0x20, 0xcd, 0x18, 0xad, 0x18, 0xd0, 0x00, 0xf9, 0x02, 0x01, 0x19, 0x80, 0x00, 0xfa, 0x01, 0x01, 0x19, 0x81, 0x01, 0x1a, 0x08, 0xf4, 0x04, 0x18, 0xad, 0x80, 0x20, 0xad, 0x13, 0x18, 0xad,
+  0x37, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xcd, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x41, 0x18, 0xad, 0x03, 0x20, 0xae, 0x81, 0x20, 0xce, 0x20, 0xae, 0x04, 0x20, 0xce, 0x80, 0x28, 0xce, 0x03, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x01, 0x30, 0xf0, 0x82, 0x31, 0x10, 0x30, 0xf0, 0x38, 0xf0, 0x01, 0x39, 0x11, 0x82, 0x39, 0x31, 0x40, 0xf1, 0x41, 0x11, 0x02, 0x41, 0x32, 0x83, 0x61, 0xb3, 0x92, 0x74, 0xb2, 0xf5, 0xc3, 0x55, 0x02, 0xd3, 0x95, 0x86, 0xbc, 0x16, 0x46, 0x9d, 0x85, 0x39, 0xd3, 0x76, 0xd3, 0x75, 0x6d, 0xba, 0x0f, 0x9f, 0x02, 0x07, 0xdf, 0x0d, 0x07, 0xff, 0x03, 0x07, 0xdf, 0x85, 0x07, 0x7f, 0x06, 0xbc, 0x06, 0xbb, 0x06, 0x9b, 0x06, 0x7b, 0x06, 0x5b, 0x01, 0x06, 0x3b, 0x83, 0x06, 0x1b, 0x05, 0xfb, 0x05, 0xdb, 0x05, 0xbb, 0x01, 0x05, 0x9c, 0x87, 0x05, 0x7c, 0x05, 0x5c, 0x05, 0x3d, 0x05, 0x1d, 0x04, 0xfd, 0x04, 0xdd, 0x04, 0xbe, 0x04, 0x9e, 0x01, 0x04, 0x7f, 0x80, 0x04, 0x5f, 0x01, 0x04, 0x3f, 0x04, 0x04, 0x1f, 0x08, 0x04, 0x3f, 0x93, 0x04, 0x1f, 0x03, 0xff, 0x03, 0xbf, 0x03, 0x7f, 0x03, 0x3f, 0x02, 0xbf, 0x02, 0x3f, 0x01, 0xdf, 0x01, 0x5f, 0x00, 0xdf, 0x00, 0x9f, 0x00, 0x5f, 0x00, 0x1f, 0x00, 0x5f, 0x09, 0x7f, 0xb9, 0xb3, 0xb2, 0x14, 0x0d, 0xbf, 0x06, 0xff, 0x07, 0x5f, 0x01, 0x07, 0x3f, 0x82, 0x07, 0x5f, 0x07, 0x7f, 0x64, 0x79, 0x01, 0xc9, 0x72, 0x03, 0xc9, 0x52, 0x86, 0xc9, 0x32, 0x91, 0x32, 0x39, 0x11, 0x31, 0x11, 0x30, 0xf0, 0x28, 0xf0, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x02, 0x20, 0xae, 0x85, 0x20, 0xad, 0x18, 0xad, 0x18, 0xd0, 0x00, 0xf9, 0x01, 0x19, 0x00, 0xf9, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x81, 0x08, 0xf4, 0x20, 0xcd, 0x01, 0x18, 0xad, 0x80, 0x20, 0xae, 0x16, 0x18, 0xad,
+  0x81, 0x18, 0xad, 0x18, 0xae, 0x31, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x44, 0x18, 0xad, 0x01, 0x20, 0xae, 0x05, 0x20, 0xce, 0x80, 0x20, 0xcf, 0x03, 0x28, 0xcf, 0x86, 0x30, 0xef, 0x30, 0xf0, 0x28, 0xf0, 0x30, 0xf0, 0x31, 0x10, 0x38, 0xf0, 0x38, 0xf1, 0x01, 0x39, 0x11, 0x81, 0x39, 0x12, 0x41, 0x11, 0x01, 0x41, 0x32, 0x82, 0x51, 0x52, 0x82, 0x34, 0xc3, 0x35, 0x03, 0xd3, 0x95, 0x87, 0xac, 0x57, 0x7d, 0x7a, 0x46, 0x9c, 0x0f, 0x9f, 0xa4, 0xb8, 0xd3, 0x95, 0x85, 0x39, 0x1f, 0x5e, 0x02, 0x07, 0xdf, 0x10, 0x07, 0xff, 0x83, 0x07, 0xdf, 0x07, 0xff, 0x07, 0xdf, 0x07, 0x5d, 0x01, 0x06, 0xbb, 0x81, 0x06, 0x9a, 0x06, 0x7a, 0x01, 0x06, 0x5a, 0x88, 0x06, 0x3a, 0x06, 0x1a, 0x05, 0xfa, 0x05, 0xda, 0x05, 0xdb, 0x05, 0xbb, 0x05, 0x9b, 0x05, 0x7b, 0x05, 0x5b, 0x01, 0x05, 0x3c, 0x83, 0x05, 0x1c, 0x04, 0xfc, 0x04, 0xdd, 0x04, 0xbd, 0x01, 0x04, 0x7e, 0x82, 0x04, 0x5e, 0x04, 0x3f, 0x04, 0x1f, 0x01, 0x03, 0xff, 0x0d, 0x03, 0xdf, 0x97, 0x03, 0xbf, 0x03, 0x5f, 0x03, 0x1f, 0x02, 0xdf, 0x02, 0x7f, 0x01, 0xff, 0x01, 0x9f, 0x01, 0x1f, 0x00, 0xbf, 0x00, 0x7f, 0x00, 0x3f, 0x00, 0x1f, 0x00, 0x9f, 0x39, 0xdb, 0xc9, 0x92, 0x63, 0x99, 0x06, 0x9f, 0x07, 0x9f, 0x07, 0xff, 0x07, 0xdf, 0x07, 0xbf, 0x07, 0x7f, 0x07, 0x9f, 0x9a, 0xf6, 0x05, 0xc9, 0x52, 0x88, 0xc9, 0x32, 0x71, 0x12, 0x31, 0x10, 0x30, 0xf0, 0x30, 0xef, 0x28, 0xf0, 0x28, 0xef, 0x28, 0xce, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x84, 0x20, 0xcd, 0x20, 0xce, 0x20, 0xae, 0x18, 0xcf, 0x00, 0xf9, 0x02, 0x01, 0x19, 0x02, 0x01, 0x1a, 0x81, 0x01, 0x19, 0x08, 0xf5, 0x06, 0x18, 0xad, 0x80, 0x18, 0xae, 0x13, 0x18, 0xad,
+  0x34, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x04, 0x18, 0xad, 0x87, 0x10, 0xd2, 0x08, 0xf3, 0x08, 0xd3, 0x10, 0xd2, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0x3b, 0x18, 0xad, 0x01, 0x20, 0xae, 0x81, 0x20, 0xad, 0x20, 0xae, 0x05, 0x20, 0xce, 0x80, 0x20, 0xcf, 0x03, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x03, 0x30, 0xf0, 0x80, 0x38, 0xf0, 0x02, 0x39, 0x11, 0x80, 0x41, 0x12, 0x01, 0x41, 0x32, 0x82, 0x51, 0x93, 0x92, 0x74, 0xcb, 0x75, 0x02, 0xd3, 0x95, 0x82, 0xc3, 0xd6, 0x6d, 0xba, 0x1f, 0x7e, 0x01, 0x07, 0xff, 0x83, 0x36, 0xdd, 0xbc, 0x17, 0x85, 0x39, 0x1f, 0x5e, 0x01, 0x07, 0xdf, 0x14, 0x07, 0xff, 0x01, 0x07, 0xdf, 0x81, 0x07, 0x1b, 0x06, 0xda, 0x01, 0x06, 0xba, 0x83, 0x06, 0x99, 0x06, 0x79, 0x06, 0x59, 0x06, 0x39, 0x01, 0x06, 0x19, 0x91, 0x05, 0xf9, 0x05, 0xda, 0x05, 0xba, 0x05, 0x9a, 0x05, 0x7a, 0x05, 0x5a, 0x05, 0x5b, 0x05, 0x3b, 0x05, 0x1b, 0x04, 0xfc, 0x04, 0xdc, 0x04, 0xbc, 0x04, 0x9d, 0x04, 0x7d, 0x04, 0x5d, 0x04, 0x3e, 0x04, 0x1e, 0x03, 0xfe, 0x01, 0x03, 0xdf, 0x01, 0x03, 0xbf, 0x0a, 0x03, 0x9f, 0x92, 0x03, 0x7f, 0x03, 0x5f, 0x03, 0x1f, 0x02, 0xdf, 0x02, 0x7f, 0x02, 0x3f, 0x01, 0xbf, 0x01, 0x5f, 0x00, 0xff, 0x00, 0x9f, 0x00, 0x5f, 0x00, 0x1f, 0x00, 0x3f, 0x01, 0x1f, 0x99, 0xb6, 0xb9, 0xd3, 0x0d, 0x9f, 0x06, 0xdf, 0x07, 0xdf, 0x03, 0x07, 0xff, 0x81, 0x0f, 0x7e, 0xb9, 0xb3, 0x03, 0xc9, 0x52, 0x87, 0xc9, 0x31, 0xc9, 0x32, 0xc1, 0x32, 0x61, 0x11, 0x38, 0xf0, 0x30, 0xf0, 0x28, 0xf0, 0x30, 0xef, 0x01, 0x28, 0xcf, 0x80, 0x20, 0xcf, 0x02, 0x20, 0xce, 0x83, 0x20, 0xae, 0x18, 0xce, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x82, 0x08, 0xf5, 0x18, 0xad, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x15, 0x18, 0xad,
+  0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x34, 0x18, 0xad, 0x87, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf9, 0x01, 0x19, 0x01, 0x1a, 0x00, 0xf7, 0x18, 0xce, 0x3d, 0x18, 0xad, 0x03, 0x20, 0xae, 0x81, 0x20, 0xce, 0x20, 0xae, 0x03, 0x20, 0xce, 0x03, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x02, 0x30, 0xf0, 0x81, 0x31, 0x10, 0x39, 0x10, 0x01, 0x39, 0x11, 0x80, 0x39, 0x12, 0x01, 0x41, 0x32, 0x83, 0x61, 0x73, 0xa2, 0xb4, 0xd3, 0x95, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x88, 0xc3, 0xd6, 0x6d, 0xba, 0x0f, 0xbf, 0x07, 0xff, 0x07, 0xdf, 0x07, 0xff, 0x07, 0xdf, 0x1f, 0x7e, 0x07, 0xdf, 0x01, 0x07, 0xff, 0x80, 0x07, 0xdf, 0x16, 0x07, 0xff, 0x80, 0x07, 0xdf, 0x01, 0x06, 0xf9, 0x81, 0x06, 0xd9, 0x06, 0xb8, 0x01, 0x06, 0x98, 0x81, 0x06, 0x78, 0x06, 0x58, 0x01, 0x06, 0x38, 0x85, 0x06, 0x18, 0x05, 0xf8, 0x05, 0xd8, 0x05, 0xb8, 0x05, 0x98, 0x05, 0x79, 0x01, 0x05, 0x59, 0x8b, 0x05, 0x1a, 0x04, 0xfa, 0x04, 0xdb, 0x04, 0xbb, 0x04, 0x9c, 0x04, 0x7c, 0x04, 0x5d, 0x04, 0x3d, 0x04, 0x1e, 0x03, 0xfe, 0x03, 0xde, 0x03, 0xbf, 0x01, 0x03, 0x9f, 0x02, 0x03, 0x7f, 0x06, 0x03, 0x5f, 0x01, 0x03, 0x3f, 0x92, 0x03, 0x1f, 0x02, 0xff, 0x02, 0xbf, 0x02, 0x7f, 0x02, 0x3f, 0x01, 0xff, 0x01, 0x9f, 0x01, 0x3f, 0x00, 0xbf, 0x00, 0x7f, 0x00, 0x3f, 0x00, 0x1f, 0x00, 0x5f, 0x19, 0x7e, 0xb9, 0x93, 0x63, 0x79, 0x06, 0x3f, 0x07, 0x3f, 0x07, 0xdf, 0x03, 0x07, 0xff, 0x80, 0x3d, 0xfb, 0x01, 0xc9, 0x52, 0x03, 0xc9, 0x32, 0x82, 0xc9, 0x12, 0xb9, 0x12, 0x41, 0x11, 0x02, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xce, 0x01, 0x20, 0xce, 0x84, 0x20, 0xae, 0x20, 0xce, 0x08, 0xf6, 0x01, 0x19, 0x01, 0x1a, 0x03, 0x01, 0x19, 0x81, 0x08, 0xf5, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x20, 0xae, 0x03, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x13, 0x18, 0xad,
+  0x83, 0x18, 0xad, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xcd, 0x30, 0x18, 0xad, 0x84, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x01, 0x17, 0x00, 0xf7, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf4, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x3a, 0x18, 0xad, 0x02, 0x20, 0xae, 0x05, 0x20, 0xce, 0x01, 0x28, 0xcf, 0x83, 0x28, 0xef, 0x28, 0xcf, 0x28, 0xef, 0x30, 0xef, 0x01, 0x30, 0xf0, 0x80, 0x38, 0xf0, 0x02, 0x39, 0x11, 0x83, 0x41, 0x11, 0x49, 0x52, 0x79, 0xf3, 0xb2, 0xf4, 0x04, 0xd3, 0x95, 0x81, 0x94, 0xf9, 0x0f, 0xbf, 0x08, 0x07, 0xff, 0x80, 0x07, 0xdf, 0x17, 0x07, 0xff, 0x81, 0x07, 0x9d, 0x07, 0x19, 0x01, 0x06, 0xf8, 0x80, 0x06, 0xd7, 0x01, 0x06, 0xb7, 0x89, 0x06, 0x97, 0x06, 0x76, 0x06, 0x56, 0x06, 0x37, 0x06, 0x36, 0x06, 0x17, 0x05, 0xf7, 0x05, 0xd7, 0x05, 0xb7, 0x05, 0x97, 0x01, 0x05, 0x78, 0x87, 0x05, 0x38, 0x05, 0x19, 0x04, 0xf9, 0x04, 0xda, 0x04, 0xbb, 0x04, 0x9b, 0x04, 0x7c, 0x04, 0x3c, 0x01, 0x04, 0x1d, 0x84, 0x03, 0xfe, 0x03, 0xde, 0x03, 0xbe, 0x03, 0x9e, 0x03, 0x7f, 0x01, 0x03, 0x5f, 0x80, 0x03, 0x3f, 0x03, 0x03, 0x1f, 0x03, 0x02, 0xff, 0x92, 0x02, 0xdf, 0x02, 0xbf, 0x02, 0x9f, 0x02, 0x7f, 0x02, 0x3f, 0x01, 0xff, 0x01, 0x9f, 0x01, 0x5f, 0x00, 0xff, 0x00, 0x9f, 0x00, 0x5f, 0x00, 0x3f, 0x00, 0x1f, 0x00, 0xbf, 0x59, 0xba, 0xb9, 0xb3, 0x0d, 0x3f, 0x06, 0xbf, 0x07, 0x9f, 0x04, 0x07, 0xff, 0x82, 0x74, 0x38, 0xc9, 0x52, 0xc1, 0x32, 0x02, 0xc9, 0x32, 0x83, 0xc9, 0x11, 0xc9, 0x12, 0xa1, 0x11, 0x39, 0x11, 0x02, 0x30, 0xf0, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xce, 0x03, 0x20, 0xce, 0x83, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x19, 0x00, 0xfa, 0x01, 0x01, 0x19, 0x81, 0x08, 0xf5, 0x18, 0xae, 0x04, 0x18, 0xad, 0x80, 0x18, 0xae, 0x17, 0x18, 0xad,
+  0x37, 0x18, 0xad, 0x83, 0x18, 0xae, 0x01, 0x19, 0x01, 0x1a, 0x08, 0xf3, 0x01, 0x18, 0xad, 0x82, 0x10, 0xd3, 0x01, 0x1a, 0x00, 0xf9, 0x3c, 0x18, 0xad, 0x03, 0x20, 0xae, 0x04, 0x20, 0xce, 0x80, 0x20, 0xcf, 0x02, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x03, 0x30, 0xf0, 0x01, 0x39, 0x11, 0x83, 0x51, 0x51, 0x79, 0xf3, 0xa2, 0xb4, 0xcb, 0x75, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x82, 0xc3, 0xd6, 0x46, 0x9c, 0x07, 0xff, 0x01, 0x07, 0xdf, 0x06, 0x07, 0xff, 0x80, 0x07, 0xdf, 0x17, 0x07, 0xff, 0x84, 0x07, 0xfe, 0xc3, 0x35, 0x45, 0xd7, 0x07, 0x38, 0x07, 0x17, 0x01, 0x06, 0xf6, 0x80, 0x06, 0xd6, 0x01, 0x06, 0xb5, 0x84, 0x06, 0x95, 0x06, 0x75, 0x06, 0x55, 0x06, 0x35, 0x06, 0x15, 0x01, 0x05, 0xf5, 0x8c, 0x05, 0xd6, 0x05, 0xb6, 0x05, 0x97, 0x05, 0x57, 0x05, 0x38, 0x05, 0x18, 0x04, 0xf9, 0x04, 0xd9, 0x04, 0x9a, 0x04, 0x7b, 0x04, 0x5b, 0x04, 0x3c, 0x04, 0x1c, 0x01, 0x03, 0xdd, 0x83, 0x03, 0xbe, 0x03, 0x9e, 0x03, 0x7e, 0x03, 0x5f, 0x01, 0x03, 0x3f, 0x81, 0x03, 0x1f, 0x02, 0xff, 0x01, 0x02, 0xdf, 0x03, 0x02, 0xbf, 0x01, 0x02, 0x9f, 0x91, 0x02, 0x7f, 0x02, 0x5f, 0x02, 0x1f, 0x01, 0xff, 0x01, 0xbf, 0x01, 0x7f, 0x01, 0x1f, 0x00, 0xdf, 0x00, 0x9f, 0x00, 0x3f, 0x00, 0x1f, 0x00, 0x3f, 0x01, 0x3f, 0xb1, 0x74, 0x63, 0x39, 0x05, 0xff, 0x07, 0x1f, 0x07, 0xdf, 0x03, 0x07, 0xff, 0x81, 0x0f, 0x9f, 0xb9, 0x92, 0x01, 0xc9, 0x32, 0x80, 0xc9, 0x31, 0x02, 0xc9, 0x12, 0x81, 0xc9, 0x11, 0x81, 0x11, 0x01, 0x30, 0xf0, 0x81, 0x28, 0xef, 0x30, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x81, 0x20, 0xae, 0x20, 0xd0, 0x02, 0x01, 0x19, 0x84, 0x01, 0x39, 0x08, 0xf5, 0x18, 0xad, 0x18, 0xae, 0x18, 0xcd, 0x04, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x14, 0x18, 0xad,
+  0x80, 0x10, 0xcf, 0x36, 0x18, 0xad, 0x86, 0x18, 0xaf, 0x00, 0xf9, 0x01, 0x19, 0x18, 0xd0, 0x18, 0xcd, 0x18, 0xad, 0x10, 0xd1, 0x01, 0x01, 0x19, 0x3c, 0x18, 0xad, 0x81, 0x20, 0xae, 0x18, 0xad, 0x01, 0x20, 0xae, 0x04, 0x20, 0xce, 0x81, 0x20, 0xcf, 0x28, 0xcf, 0x02, 0x28, 0xef, 0x01, 0x30, 0xf0, 0x83, 0x59, 0xb2, 0x7a, 0x13, 0x9a, 0x94, 0xbb, 0x55, 0x03, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x02, 0xd3, 0x95, 0x81, 0xac, 0x77, 0x2f, 0x1e, 0x22, 0x07, 0xff, 0x87, 0x07, 0xbc, 0x07, 0x59, 0xab, 0xb5, 0xc3, 0x14, 0x1e, 0x97, 0x07, 0x36, 0x07, 0x16, 0x07, 0x15, 0x01, 0x06, 0xf4, 0x9f, 0x06, 0xf3, 0x06, 0xd3, 0x06, 0xb3, 0x06, 0xb2, 0x06, 0x92, 0x06, 0x72, 0x06, 0x53, 0x06, 0x33, 0x06, 0x13, 0x05, 0xf4, 0x05, 0xd4, 0x05, 0x95, 0x05, 0x75, 0x05, 0x56, 0x05, 0x17, 0x04, 0xf8, 0x04, 0xb9, 0x04, 0x99, 0x04, 0x5a, 0x04, 0x3b, 0x04, 0x1b, 0x03, 0xfc, 0x03, 0xdd, 0x03, 0xbd, 0x03, 0x9d, 0x03, 0x7e, 0x03, 0x5e, 0x03, 0x3e, 0x03, 0x3f, 0x03, 0x1f, 0x02, 0xff, 0x02, 0xdf, 0x01, 0x02, 0xbf, 0x80, 0x02, 0x9f, 0x01, 0x02, 0x7f, 0x01, 0x02, 0x5f, 0x80, 0x02, 0x3f, 0x01, 0x02, 0x1f, 0x8e, 0x01, 0xdf, 0x01, 0x9f, 0x01, 0x7f, 0x01, 0x3f, 0x00, 0xff, 0x00, 0x9f, 0x00, 0x7f, 0x00, 0x3f, 0x00, 0x1f, 0x00, 0x7f, 0x39, 0x9b, 0xb9, 0x93, 0x05, 0x5f, 0x06, 0x7f, 0x07, 0x9f, 0x04, 0x07, 0xff, 0x84, 0x45, 0xdb, 0xc1, 0x32, 0xc9, 0x32, 0xc9, 0x12, 0xc1, 0x32, 0x01, 0xc9, 0x12, 0x85, 0xc9, 0x11, 0xc9, 0x12, 0x51, 0x11, 0x38, 0xf0, 0x30, 0xf0, 0x28, 0xef, 0x02, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x8a, 0x20, 0xae, 0x18, 0xce, 0x10, 0xd3, 0x10, 0xf4, 0x18, 0xd0, 0x18, 0xad, 0x18, 0xae, 0x20, 0xcd, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0x02, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x13, 0x18, 0xad,
+  0x82, 0x00, 0xf9, 0x10, 0xd0, 0x20, 0xad, 0x02, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x30, 0x18, 0xad, 0x01, 0x01, 0x19, 0x80, 0x08, 0xd4, 0x01, 0x18, 0xad, 0x80, 0x08, 0xf3, 0x01, 0x01, 0x19, 0x80, 0x20, 0xad, 0x15, 0x18, 0xad, 0x82, 0x20, 0xae, 0x18, 0xad, 0x20, 0xad, 0x1e, 0x18, 0xad, 0x01, 0x20, 0xad, 0x86, 0x18, 0xad, 0x20, 0xcd, 0x20, 0xae, 0x20, 0xad, 0x20, 0xae, 0x18, 0xce, 0x20, 0xae, 0x01, 0x20, 0xce, 0x89, 0x28, 0xae, 0x20, 0xce, 0x28, 0xee, 0x51, 0x71, 0x69, 0xd2, 0x82, 0x32, 0xaa, 0xf4, 0xc3, 0x34, 0xd3, 0x75, 0xd3, 0xb5, 0x09, 0xd3, 0x95, 0x81, 0x75, 0x7a, 0x0f, 0xbf, 0x21, 0x07, 0xff, 0x88, 0x07, 0xbd, 0x07, 0x9b, 0x07, 0x7a, 0x07, 0x79, 0x74, 0xd6, 0xd2, 0xd4, 0x9b, 0xf5, 0x07, 0x56, 0x07, 0x35, 0x01, 0x07, 0x34, 0x81, 0x07, 0x33, 0x07, 0x12, 0x01, 0x07, 0x11, 0x01, 0x06, 0xf0, 0x80, 0x06, 0xd0, 0x01, 0x06, 0xaf, 0x8d, 0x06, 0x6f, 0x06, 0x50, 0x06, 0x31, 0x06, 0x11, 0x05, 0xd2, 0x05, 0x94, 0x05, 0x54, 0x05, 0x15, 0x04, 0xf7, 0x04, 0xb8, 0x04, 0x78, 0x04, 0x59, 0x04, 0x3a, 0x03, 0xfb, 0x01, 0x03, 0xbc, 0x83, 0x03, 0x9d, 0x03, 0x7d, 0x03, 0x5e, 0x03, 0x3e, 0x01, 0x03, 0x1f, 0x81, 0x02, 0xff, 0x02, 0xdf, 0x01, 0x02, 0xbf, 0x01, 0x02, 0x7f, 0x80, 0x02, 0x5f, 0x01, 0x02, 0x3f, 0x8a, 0x02, 0x1f, 0x01, 0xff, 0x01, 0xdf, 0x01, 0xbf, 0x01, 0x9f, 0x01, 0x7f, 0x01, 0x3f, 0x01, 0x1f, 0x00, 0xbf, 0x00, 0x7f, 0x00, 0x5f, 0x01, 0x00, 0x1f, 0x85, 0x00, 0xdf, 0xa1, 0x75, 0x33, 0xbc, 0x05, 0xdf, 0x06, 0xff, 0x07, 0xdf, 0x04, 0x07, 0xff, 0x82, 0x92, 0xd5, 0xc9, 0x11, 0xc1, 0x32, 0x01, 0xc9, 0x12, 0x89, 0xc8, 0xf2, 0xc1, 0x12, 0xc9, 0x12, 0xa8, 0xf1, 0x31, 0x10, 0x30, 0xf0, 0x30, 0xef, 0x28, 0xef, 0x28, 0xcf, 0x28, 0xce, 0x03, 0x20, 0xce, 0x82, 0x20, 0xae, 0x20, 0xce, 0x20, 0xad, 0x21, 0x18, 0xad,
+  0x01, 0x01, 0x19, 0x81, 0x10, 0xcf, 0x20, 0xad, 0x32, 0x18, 0xad, 0x82, 0x18, 0xae, 0x20, 0xad, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x01, 0x00, 0xf7, 0x01, 0x01, 0x1a, 0x82, 0x08, 0xf5, 0x18, 0xad, 0x18, 0xae, 0x10, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x04, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x20, 0xad, 0x0c, 0x18, 0xad, 0x80, 0x18, 0xce, 0x03, 0x18, 0xad, 0x01, 0x20, 0xae, 0x87, 0x20, 0xad, 0x39, 0x0f, 0x49, 0x70, 0x59, 0xb0, 0x7a, 0x32, 0x92, 0x93, 0xaa, 0xd3, 0xcb, 0x55, 0x03, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x07, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x81, 0x9c, 0xb8, 0x27, 0x1d, 0x20, 0x07, 0xff, 0x83, 0x07, 0xde, 0x07, 0xdd, 0x07, 0xbc, 0x07, 0x9b, 0x01, 0x07, 0x9a, 0x81, 0x07, 0x79, 0x55, 0xb7, 0x01, 0xd2, 0xb4, 0x85, 0x4d, 0xb5, 0x07, 0x75, 0x07, 0x74, 0x07, 0x53, 0x07, 0x73, 0x07, 0x52, 0x01, 0x07, 0x50, 0x81, 0x07, 0x4f, 0x07, 0x4e, 0x01, 0x07, 0x4d, 0x80, 0x07, 0x4c, 0x01, 0x07, 0x2b, 0x8f, 0x07, 0x2a, 0x07, 0x0a, 0x06, 0xea, 0x06, 0xac, 0x06, 0x4d, 0x05, 0xd0, 0x05, 0x73, 0x04, 0xf5, 0x04, 0xb6, 0x04, 0x78, 0x04, 0x38, 0x04, 0x1a, 0x03, 0xfb, 0x03, 0xbc, 0x03, 0x9c, 0x03, 0x7c, 0x01, 0x03, 0x3d, 0x84, 0x03, 0x1e, 0x02, 0xfe, 0x02, 0xff, 0x02, 0xdf, 0x02, 0xbf, 0x01, 0x02, 0x9f, 0x96, 0x02, 0x7f, 0x02, 0x5f, 0x02, 0x3f, 0x02, 0x1f, 0x01, 0xff, 0x01, 0xdf, 0x01, 0xbf, 0x01, 0x9f, 0x01, 0x7f, 0x01, 0x5f, 0x01, 0x3f, 0x01, 0x1f, 0x00, 0xdf, 0x00, 0x9f, 0x00, 0x5f, 0x00, 0x3f, 0x00, 0x1f, 0x00, 0x3f, 0x21, 0x3d, 0x1b, 0x1e, 0x05, 0x1f, 0x06, 0x5f, 0x07, 0x7f, 0x04, 0x07, 0xff, 0x80, 0x1f, 0x3d, 0x01, 0xc9, 0x12, 0x01, 0xc1, 0x12, 0x84, 0xc8, 0xf1, 0xc8, 0xf2, 0xc8, 0xf1, 0xc8, 0xf2, 0x80, 0xf1, 0x01, 0x30, 0xf0, 0x85, 0x30, 0xef, 0x28, 0xef, 0x28, 0xcf, 0x28, 0xce, 0x20, 0xce, 0x20, 0xae, 0x01, 0x20, 0xce, 0x02, 0x20, 0xae, 0x20, 0x18, 0xad,
+  0x83, 0x00, 0xf7, 0x00, 0xf9, 0x01, 0x19, 0x10, 0xd0, 0x01, 0x18, 0xad, 0x83, 0x18, 0xcd, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x2a, 0x18, 0xad, 0x85, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x10, 0xd0, 0x01, 0x19, 0x01, 0x1a, 0x03, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xae, 0x12, 0x18, 0xad, 0x84, 0x39, 0x2f, 0xd3, 0x95, 0xc3, 0x74, 0xa2, 0xd3, 0xaa, 0xd3, 0x01, 0x7a, 0x31, 0x82, 0x7a, 0x11, 0x72, 0x31, 0x51, 0x90, 0x01, 0x49, 0x6f, 0x83, 0x49, 0x70, 0x49, 0x6f, 0x49, 0x4f, 0x41, 0x2f, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0a, 0x18, 0xad, 0x81, 0x49, 0x70, 0x49, 0x4f, 0x01, 0x49, 0x6f, 0x80, 0x69, 0xf1, 0x01, 0x7a, 0x31, 0x83, 0x92, 0x72, 0xa2, 0xd3, 0xaa, 0xf3, 0xc3, 0x55, 0x0d, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x03, 0xd3, 0x95, 0x84, 0xd3, 0x96, 0xd3, 0x75, 0xd3, 0x95, 0xac, 0x57, 0x56, 0x5c, 0x20, 0x07, 0xff, 0x82, 0x07, 0xdf, 0x07, 0xde, 0x07, 0xbd, 0x01, 0x07, 0xbc, 0x80, 0x07, 0xbb, 0x01, 0x07, 0x9a, 0x85, 0x07, 0x99, 0x26, 0xb8, 0xca, 0xd4, 0xd2, 0xb4, 0xc3, 0x14, 0x0f, 0x35, 0x01, 0x07, 0x94, 0x01, 0x07, 0x92, 0x82, 0x07, 0x91, 0x07, 0x90, 0x07, 0x8f, 0x01, 0x07, 0x8e, 0x82, 0x07, 0x8d, 0x07, 0x8c, 0x07, 0xaa, 0x01, 0x07, 0xa9, 0x8f, 0x07, 0xa8, 0x07, 0xc7, 0x07, 0xc5, 0x07, 0xc4, 0x07, 0xe4, 0x07, 0xa4, 0x07, 0x27, 0x06, 0x8a, 0x05, 0xaf, 0x04, 0x96, 0x04, 0x38, 0x03, 0xf9, 0x03, 0xba, 0x03, 0x9b, 0x03, 0x5c, 0x03, 0x5d, 0x01, 0x03, 0x1d, 0x81, 0x02, 0xfe, 0x02, 0xdf, 0x01, 0x02, 0xbf, 0x81, 0x02, 0x9f, 0x02, 0x7f, 0x01, 0x02, 0x5f, 0x83, 0x02, 0x3f, 0x02, 0x1f, 0x01, 0xff, 0x01, 0xdf, 0x01, 0x01, 0x9f, 0x87, 0x01, 0x7f, 0x01, 0x5f, 0x01, 0x3f, 0x00, 0xff, 0x00, 0xdf, 0x00, 0xbf, 0x00, 0x7f, 0x00, 0x5f, 0x01, 0x00, 0x1f, 0x85, 0x00, 0x7f, 0x02, 0x3f, 0x04, 0x1f, 0x05, 0xbf, 0x06, 0xff, 0x07, 0xbf, 0x04, 0x07, 0xff, 0x82, 0x64, 0x98, 0xc9, 0x11, 0xc9, 0x12, 0x02, 0xc8, 0xf1, 0x83, 0xc8, 0xf2, 0xc8, 0xf1, 0xc8, 0xd1, 0x50, 0xf1, 0x01, 0x30, 0xf0, 0x80, 0x30, 0xef, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xce, 0x02, 0x20, 0xce, 0x01, 0x20, 0xae, 0x80, 0x20, 0xad, 0x20, 0x18, 0xad,
+  0x84, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xcf, 0x2c, 0x18, 0xad, 0x01, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x10, 0xd0, 0x01, 0x01, 0x19, 0x85, 0x01, 0x17, 0x10, 0xd2, 0x08, 0xf3, 0x10, 0xd3, 0x10, 0xd2, 0x18, 0xcd, 0x01, 0x18, 0xae, 0x12, 0x18, 0xad, 0x81, 0x49, 0x6f, 0xaa, 0xd3, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x34, 0xd3, 0x95, 0x82, 0xc3, 0xd6, 0x85, 0x39, 0x36, 0xdd, 0x22, 0x07, 0xff, 0x81, 0x07, 0xdf, 0x07, 0xde, 0x01, 0x07, 0xbd, 0x01, 0x07, 0xbc, 0x80, 0x07, 0xbb, 0x01, 0x07, 0xba, 0x80, 0x07, 0xb9, 0x02, 0xd2, 0xb4, 0x80, 0x65, 0x35, 0x01, 0x07, 0xb5, 0x89, 0x07, 0xb4, 0x07, 0xb3, 0x07, 0xb2, 0x07, 0xb1, 0x07, 0xb0, 0x07, 0xaf, 0x07, 0xce, 0x07, 0xcd, 0x07, 0xcc, 0x07, 0xcb, 0x01, 0x07, 0xca, 0x83, 0x07, 0xc9, 0x07, 0xe8, 0x07, 0xe7, 0x07, 0xe6, 0x01, 0x07, 0xe5, 0x01, 0x07, 0xe3, 0x8c, 0x07, 0xe2, 0x07, 0xe1, 0x07, 0x26, 0x06, 0x0c, 0x04, 0xb4, 0x03, 0xb9, 0x03, 0x7b, 0x03, 0x5c, 0x03, 0x3d, 0x03, 0x1d, 0x02, 0xde, 0x02, 0xdf, 0x02, 0xbe, 0x01, 0x02, 0x9f, 0x81, 0x02, 0x7f, 0x02, 0x5f, 0x01, 0x02, 0x3f, 0x82, 0x02, 0x1f, 0x01, 0xff, 0x01, 0xdf, 0x01, 0x01, 0x9f, 0x01, 0x01, 0x5f, 0x83, 0x01, 0x3f, 0x00, 0xff, 0x00, 0xdf, 0x00, 0xbf, 0x01, 0x00, 0x7f, 0x80, 0x00, 0x3f, 0x01, 0x00, 0x1f, 0x84, 0x01, 0x1f, 0x02, 0xff, 0x04, 0xdf, 0x06, 0x3f, 0x07, 0x7f, 0x04, 0x07, 0xff, 0x81, 0x0f, 0x9f, 0xb9, 0x72, 0x01, 0xc8, 0xf2, 0x85, 0xc0, 0xf1, 0xc8, 0xf2, 0xc0, 0xf2, 0xc0, 0xf1, 0xc8, 0xd1, 0xa0, 0xf1, 0x02, 0x30, 0xf0, 0x83, 0x28, 0xef, 0x28, 0xcf, 0x28, 0xce, 0x20, 0xcf, 0x02, 0x20, 0xce, 0x83, 0x20, 0xae, 0x20, 0xad, 0x18, 0xad, 0x20, 0xae, 0x1e, 0x18, 0xad,
+  0x87, 0x18, 0xad, 0x18, 0xae, 0x01, 0x17, 0x01, 0x19, 0x00, 0xf9, 0x18, 0xb0, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x28, 0x18, 0xad, 0x87, 0x18, 0xae, 0x10, 0xd0, 0x00, 0xf9, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x13, 0x18, 0xad, 0x84, 0x18, 0xae, 0x41, 0x2f, 0x8a, 0x72, 0xc3, 0x34, 0xd3, 0x96, 0x18, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x08, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x0b, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x82, 0xd3, 0x75, 0xac, 0x57, 0x46, 0x9c, 0x16, 0x07, 0xff, 0x80, 0x46, 0x7c, 0x01, 0x85, 0x19, 0x80, 0x36, 0xdd, 0x0a, 0x07, 0xff, 0x02, 0x07, 0xde, 0x80, 0x07, 0xdd, 0x01, 0x07, 0xdc, 0x01, 0x07, 0xdb, 0x01, 0x07, 0xda, 0x80, 0x9b, 0xf5, 0x01, 0xd2, 0xb4, 0x83, 0xc2, 0xf4, 0x0f, 0x77, 0x07, 0xd6, 0x07, 0xd5, 0x01, 0x07, 0xd4, 0x86, 0x07, 0xd3, 0x07, 0xd2, 0x07, 0xd1, 0x07, 0xd0, 0x07, 0xef, 0x07, 0xee, 0x07, 0xed, 0x01, 0x07, 0xec, 0x80, 0x07, 0xea, 0x01, 0x07, 0xe9, 0x80, 0x07, 0xe7, 0x01, 0x07, 0xe6, 0x01, 0x07, 0xe5, 0x01, 0x07, 0xe4, 0x01, 0x07, 0xe3, 0x85, 0x07, 0xe2, 0x07, 0x85, 0x06, 0x0c, 0x04, 0xd3, 0x03, 0x5b, 0x03, 0x1c, 0x01, 0x02, 0xde, 0x82, 0x02, 0xbe, 0x02, 0x9f, 0x02, 0x7f, 0x01, 0x02, 0x5f, 0x84, 0x02, 0x3f, 0x02, 0x1f, 0x01, 0xff, 0x01, 0xdf, 0x01, 0xbf, 0x01, 0x01, 0x9f, 0x88, 0x01, 0x7f, 0x01, 0x5f, 0x01, 0x3f, 0x01, 0x1f, 0x00, 0xdf, 0x00, 0xbf, 0x00, 0x9f, 0x00, 0x7f, 0x00, 0x5f, 0x01, 0x00, 0x1f, 0x85, 0x00, 0x3f, 0x01, 0xdf, 0x03, 0xbf, 0x05, 0x9f, 0x06, 0xdf, 0x07, 0xbf, 0x04, 0x07, 0xff, 0x89, 0x4d, 0x7a, 0xc1, 0x11, 0xc0, 0xf1, 0xc8, 0xf1, 0xc8, 0xf2, 0xc8, 0xd1, 0xc8, 0xf2, 0xc0, 0xd1, 0xc8, 0xd1, 0x68, 0xf1, 0x01, 0x30, 0xf0, 0x81, 0x28, 0xf0, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x01, 0x20, 0xae, 0x81, 0x20, 0xad, 0x20, 0xae, 0x14, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x01, 0x08, 0xf3, 0x80, 0x10, 0xd2, 0x05, 0x18, 0xad,
+  0x86, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf8, 0x18, 0xd0, 0x01, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xcd, 0x28, 0x18, 0xad, 0x80, 0x18, 0xd0, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x03, 0x18, 0xad, 0x80, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0f, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x02, 0x18, 0xad, 0x84, 0x41, 0x4f, 0x61, 0xd1, 0x82, 0x51, 0xa2, 0xd3, 0xbb, 0x34, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x03, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x03, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x15, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x04, 0xd3, 0x95, 0x84, 0xd3, 0x75, 0xbc, 0x16, 0x85, 0x39, 0x46, 0x9c, 0x17, 0xbf, 0x12, 0x07, 0xff, 0x80, 0x85, 0x18, 0x01, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x80, 0x84, 0xf8, 0x09, 0x07, 0xff, 0x82, 0x07, 0xfe, 0x07, 0xde, 0x07, 0xfe, 0x01, 0x07, 0xdd, 0x81, 0x07, 0xbc, 0x07, 0xdc, 0x01, 0x07, 0xdb, 0x81, 0x07, 0xda, 0x8c, 0x56, 0x01, 0xca, 0xb4, 0x81, 0xd2, 0x94, 0x4d, 0xf7, 0x01, 0x07, 0xd7, 0x82, 0x07, 0xd6, 0x07, 0xf5, 0x07, 0xd5, 0x01, 0x07, 0xf3, 0x86, 0x07, 0xf2, 0x07, 0xf1, 0x07, 0xf0, 0x07, 0xef, 0x07, 0xee, 0x07, 0xed, 0x07, 0xec, 0x01, 0x07, 0xeb, 0x81, 0x07, 0xea, 0x07, 0xe9, 0x01, 0x07, 0xe8, 0x01, 0x07, 0xe7, 0x01, 0x07, 0xe6, 0x03, 0x07, 0xe5, 0x88, 0x07, 0xe4, 0x07, 0xa6, 0x06, 0x0e, 0x03, 0xf8, 0x02, 0xde, 0x02, 0xbe, 0x02, 0x9f, 0x02, 0x7f, 0x02, 0x5f, 0x01, 0x02, 0x3f, 0x83, 0x02, 0x1f, 0x01, 0xff, 0x01, 0xdf, 0x01, 0xbf, 0x01, 0x01, 0x9f, 0x89, 0x01, 0x7f, 0x01, 0x5f, 0x01, 0x3f, 0x01, 0x1f, 0x00, 0xdf, 0x00, 0xbf, 0x00, 0x9f, 0x00, 0x7f, 0x00, 0x5f, 0x00, 0x3f, 0x01, 0x00, 0x1f, 0x84, 0x00, 0xbf, 0x02, 0x9f, 0x04, 0x9f, 0x06, 0x3f, 0x07, 0x5f, 0x05, 0x07, 0xff, 0x83, 0xb1, 0xd3, 0xc8, 0xf1, 0xc8, 0xf2, 0xc0, 0xf1, 0x01, 0xc8, 0xd1, 0x86, 0xc0, 0xf1, 0xc8, 0xd1, 0xb8, 0xd1, 0x40, 0xf0, 0x30, 0xf0, 0x28, 0xf0, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x81, 0x20, 0xce, 0x20, 0xcf, 0x01, 0x20, 0xce, 0x03, 0x20, 0xae, 0x11, 0x18, 0xad, 0x81, 0x18, 0xae, 0x00, 0xf7, 0x03, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xae, 0x03, 0x18, 0xad,
+  0x02, 0x18, 0xad, 0x84, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x39, 0x00, 0xf8, 0x18, 0xb0, 0x26, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x85, 0x18, 0xae, 0x10, 0xd0, 0x00, 0xf9, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xaf, 0x05, 0x18, 0xad, 0x80, 0x18, 0xae, 0x18, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x03, 0x18, 0xad, 0x85, 0x31, 0x0e, 0x49, 0x6f, 0x59, 0x90, 0x7a, 0x12, 0x7a, 0x32, 0x92, 0x72, 0x01, 0xa2, 0xd3, 0x80, 0xc3, 0x75, 0x14, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x0a, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x08, 0xd3, 0x95, 0x82, 0xac, 0x77, 0x75, 0x7a, 0x36, 0xfd, 0x0e, 0x07, 0xff, 0x83, 0x4e, 0x3c, 0xd3, 0x55, 0xd3, 0x35, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x81, 0xd3, 0x34, 0x75, 0x39, 0x09, 0x07, 0xff, 0x01, 0x07, 0xfe, 0x02, 0x07, 0xdd, 0x85, 0x07, 0xdc, 0x07, 0xfc, 0x07, 0xdc, 0x07, 0xdb, 0x6d, 0x38, 0xca, 0xb4, 0x01, 0xd2, 0x94, 0x80, 0xab, 0x95, 0x01, 0x07, 0xd8, 0x01, 0x07, 0xf7, 0x80, 0x07, 0xf6, 0x01, 0x07, 0xf5, 0x86, 0x07, 0xf4, 0x07, 0xf3, 0x07, 0xf2, 0x07, 0xf1, 0x07, 0xf0, 0x07, 0xef, 0x07, 0xee, 0x01, 0x07, 0xed, 0x01, 0x07, 0xec, 0x80, 0x07, 0xeb, 0x02, 0x07, 0xea, 0x01, 0x07, 0xe9, 0x03, 0x07, 0xe8, 0x01, 0x07, 0xe7, 0x8b, 0x07, 0xe8, 0x07, 0xc8, 0x06, 0xeb, 0x05, 0x14, 0x03, 0x3c, 0x02, 0x7f, 0x02, 0x5f, 0x02, 0x3f, 0x02, 0x1f, 0x01, 0xff, 0x01, 0xdf, 0x01, 0xbf, 0x01, 0x01, 0x9f, 0x86, 0x01, 0x7f, 0x01, 0x5f, 0x01, 0x3f, 0x01, 0x1f, 0x00, 0xff, 0x00, 0xdf, 0x00, 0xbf, 0x01, 0x00, 0x9f, 0x01, 0x00, 0x5f, 0x80, 0x00, 0x3f, 0x01, 0x00, 0x1f, 0x84, 0x01, 0x5f, 0x03, 0x7f, 0x05, 0x7f, 0x06, 0xdf, 0x07, 0xbf, 0x04, 0x07, 0xff, 0x83, 0x4d, 0x5a, 0xc8, 0xf1, 0xc8, 0xd1, 0xc0, 0xf1, 0x01, 0xc8, 0xd1, 0x01, 0xc0, 0xd1, 0x84, 0xc8, 0xb1, 0x78, 0xd1, 0x31, 0x10, 0x30, 0xf0, 0x30, 0xef, 0x02, 0x28, 0xcf, 0x80, 0x20, 0xcf, 0x01, 0x20, 0xce, 0x03, 0x20, 0xae, 0x11, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x01, 0x01, 0x17, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x03, 0x18, 0xad,
+  0x03, 0x18, 0xad, 0x84, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xcf, 0x25, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x85, 0x18, 0xae, 0x18, 0xaf, 0x01, 0x18, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xce, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x06, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0f, 0x18, 0xad, 0x80, 0x18, 0xae, 0x05, 0x18, 0xad, 0x80, 0x18, 0xae, 0x09, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x01, 0x49, 0x6f, 0x86, 0x49, 0x70, 0x7a, 0x12, 0x7a, 0x31, 0x82, 0x52, 0xaa, 0xd3, 0xa2, 0xd3, 0xbb, 0x34, 0x23, 0xd3, 0x95, 0x83, 0xcb, 0xd6, 0x94, 0xf8, 0x56, 0x5b, 0x0f, 0xbf, 0x0a, 0x07, 0xff, 0x80, 0xb3, 0xf6, 0x01, 0xd3, 0x35, 0x80, 0xd3, 0x34, 0x02, 0xd3, 0x35, 0x81, 0xd3, 0x34, 0x1f, 0x7e, 0x09, 0x07, 0xff, 0x82, 0x07, 0xfe, 0x07, 0xde, 0x07, 0xdd, 0x02, 0x07, 0xfd, 0x88, 0x07, 0xdd, 0x07, 0xdc, 0x6d, 0x38, 0xca, 0xb4, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0x1f, 0x39, 0x07, 0xf9, 0x02, 0x07, 0xf8, 0x01, 0x07, 0xf7, 0x83, 0x07, 0xf6, 0x07, 0xf5, 0x07, 0xf4, 0x07, 0xf3, 0x01, 0x07, 0xf2, 0x81, 0x07, 0xf1, 0x07, 0xf0, 0x01, 0x07, 0xef, 0x01, 0x07, 0xee, 0x01, 0x07, 0xed, 0x84, 0x07, 0xec, 0x07, 0xed, 0x07, 0xec, 0x07, 0xeb, 0x07, 0xec, 0x01, 0x07, 0xeb, 0x02, 0x07, 0xea, 0x8b, 0x07, 0xca, 0x07, 0xab, 0x07, 0x6c, 0x07, 0x0d, 0x05, 0xb2, 0x03, 0x9b, 0x02, 0x3f, 0x02, 0x1f, 0x01, 0xff, 0x01, 0xdf, 0x01, 0xbf, 0x01, 0x9f, 0x01, 0x01, 0x7f, 0x83, 0x01, 0x5f, 0x01, 0x3f, 0x01, 0x1f, 0x00, 0xff, 0x01, 0x00, 0xdf, 0x01, 0x00, 0x9f, 0x81, 0x00, 0x7f, 0x00, 0x5f, 0x01, 0x00, 0x3f, 0x85, 0x00, 0x1f, 0x60, 0xd9, 0x0a, 0x3f, 0x04, 0x7f, 0x06, 0x3f, 0x07, 0x5f, 0x05, 0x07, 0xff, 0x89, 0xa9, 0xd3, 0xc0, 0xd1, 0xc8, 0xd1, 0xc0, 0xf1, 0xc8, 0xb1, 0xc0, 0xd1, 0xc8, 0xb1, 0xc0, 0xb1, 0xb8, 0xb1, 0x48, 0xf1, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x83, 0x20, 0xae, 0x20, 0xad, 0x18, 0xad, 0x20, 0xae, 0x10, 0x18, 0xad, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf3, 0x01, 0x18, 0xad, 0x80, 0x08, 0xf3, 0x01, 0x01, 0x19, 0x03, 0x18, 0xad,
+  0x80, 0x10, 0xd0, 0x01, 0x18, 0xad, 0x87, 0x20, 0xad, 0x18, 0xad, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xd0, 0x20, 0xad, 0x02, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x1c, 0x18, 0xad, 0x80, 0x20, 0xae, 0x02, 0x18, 0xad, 0x85, 0x20, 0xad, 0x18, 0xd0, 0x00, 0xf9, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xae, 0x05, 0x18, 0xad, 0x84, 0x18, 0xcd, 0x20, 0xad, 0x18, 0xcd, 0x20, 0xad, 0x18, 0xcd, 0x05, 0x18, 0xad, 0x83, 0x18, 0xae, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x29, 0x18, 0xad, 0x01, 0x49, 0x70, 0x82, 0x59, 0x90, 0x7a, 0x31, 0x72, 0x31, 0x01, 0x7a, 0x31, 0x83, 0x9a, 0xb3, 0xaa, 0xd4, 0xa2, 0xd4, 0xb3, 0x14, 0x05, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x06, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x08, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x81, 0x94, 0xf8, 0x56, 0x5c, 0x08, 0x07, 0xff, 0x81, 0xd3, 0x35, 0xd3, 0x34, 0x03, 0xd3, 0x35, 0x82, 0xd3, 0x14, 0xd3, 0x15, 0x5d, 0xdb, 0x0a, 0x07, 0xff, 0x04, 0x07, 0xfe, 0x01, 0x07, 0xfd, 0x86, 0x6d, 0x58, 0xd2, 0x94, 0xd2, 0x93, 0xca, 0x94, 0xd2, 0x74, 0x4d, 0xf8, 0x07, 0xfb, 0x01, 0x07, 0xfa, 0x01, 0x07, 0xf9, 0x81, 0x07, 0xf8, 0x07, 0xf7, 0x01, 0x07, 0xf6, 0x01, 0x07, 0xf5, 0x80, 0x07, 0xf4, 0x01, 0x07, 0xf3, 0x80, 0x07, 0xf2, 0x01, 0x07, 0xf1, 0x02, 0x07, 0xf0, 0x04, 0x07, 0xef, 0x04, 0x07, 0xee, 0x8b, 0x07, 0xed, 0x07, 0xcd, 0x07, 0x8e, 0x07, 0x6e, 0x07, 0x10, 0x06, 0xb1, 0x05, 0x74, 0x03, 0x7b, 0x01, 0xff, 0x01, 0xdf, 0x01, 0xbf, 0x01, 0x9f, 0x01, 0x01, 0x7f, 0x01, 0x01, 0x3f, 0x83, 0x01, 0x1f, 0x00, 0xff, 0x00, 0xdf, 0x00, 0xbf, 0x01, 0x00, 0x9f, 0x81, 0x00, 0x7f, 0x00, 0x5f, 0x01, 0x00, 0x3f, 0x86, 0x00, 0x1f, 0x88, 0xd6, 0x61, 0x59, 0x03, 0x1f, 0x05, 0x3f, 0x06, 0xdf, 0x07, 0xbf, 0x04, 0x07, 0xff, 0x81, 0x4d, 0x5b, 0xc0, 0xd1, 0x01, 0xc8, 0xd1, 0x85, 0xc0, 0xb1, 0xc8, 0xb1, 0xc8, 0xb2, 0xc0, 0xb1, 0xc8, 0xb1, 0x90, 0xd1, 0x01, 0x30, 0xf0, 0x02, 0x28, 0xcf, 0x01, 0x20, 0xcf, 0x82, 0x20, 0xce, 0x20, 0xae, 0x20, 0xce, 0x01, 0x20, 0xae, 0x0f, 0x18, 0xad, 0x01, 0x18, 0xae, 0x82, 0x01, 0x19, 0x01, 0x1a, 0x10, 0xd1, 0x01, 0x18, 0xad, 0x81, 0x10, 0xd1, 0x01, 0x1a, 0x04, 0x01, 0x19,
+  0x81, 0x00, 0xf8, 0x10, 0xd0, 0x03, 0x18, 0xad, 0x81, 0x18, 0xce, 0x01, 0x17, 0x01, 0x01, 0x19, 0x81, 0x10, 0xcf, 0x20, 0xad, 0x1f, 0x18, 0xad, 0x80, 0x20, 0xae, 0x02, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xb0, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xae, 0x01, 0x18, 0xad, 0x83, 0x20, 0xae, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x01, 0x08, 0xf3, 0x80, 0x10, 0xd2, 0x2c, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xae, 0x84, 0x18, 0xad, 0x18, 0xce, 0x18, 0xad, 0x20, 0xae, 0x20, 0xad, 0x01, 0x20, 0xce, 0x80, 0x29, 0x0f, 0x01, 0x51, 0x70, 0x88, 0x69, 0xf1, 0x7a, 0x32, 0x82, 0x32, 0xaa, 0xf3, 0xaa, 0xf4, 0xcb, 0x75, 0xd3, 0x95, 0xd3, 0x96, 0xd3, 0x75, 0x06, 0xd3, 0x95, 0x01, 0xd3, 0x96, 0x03, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x82, 0xc3, 0xb6, 0x85, 0x39, 0x1f, 0x7f, 0x05, 0x07, 0xff, 0x02, 0xd3, 0x35, 0x82, 0xd3, 0x15, 0xd3, 0x14, 0xd3, 0x15, 0x01, 0xd3, 0x14, 0x80, 0x65, 0x9a, 0x0d, 0x07, 0xff, 0x03, 0x07, 0xfe, 0x85, 0x6d, 0x39, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x74, 0xca, 0x74, 0x7c, 0x96, 0x01, 0x07, 0xfc, 0x01, 0x07, 0xfb, 0x01, 0x07, 0xfa, 0x80, 0x07, 0xf9, 0x01, 0x07, 0xf8, 0x01, 0x07, 0xf7, 0x01, 0x07, 0xf6, 0x80, 0x07, 0xf5, 0x01, 0x07, 0xf4, 0x02, 0x07, 0xf3, 0x06, 0x07, 0xf2, 0x03, 0x07, 0xf1, 0x8c, 0x07, 0xf0, 0x07, 0xf1, 0x07, 0xd0, 0x07, 0x91, 0x07, 0x51, 0x07, 0x12, 0x06, 0x93, 0x06, 0x34, 0x05, 0x17, 0x02, 0xdd, 0x01, 0xbf, 0x01, 0x9f, 0x01, 0x7f, 0x01, 0x01, 0x5f, 0x83, 0x01, 0x3f, 0x01, 0x1f, 0x00, 0xff, 0x00, 0xdf, 0x01, 0x00, 0xbf, 0x80, 0x00, 0x7f, 0x01, 0x00, 0x5f, 0x01, 0x00, 0x3f, 0x86, 0x00, 0x1f, 0x60, 0xb8, 0xb8, 0xf3, 0x09, 0xbf, 0x04, 0x1f, 0x06, 0x1f, 0x07, 0x3f, 0x05, 0x07, 0xff, 0x80, 0xb1, 0xb3, 0x01, 0xc0, 0xd1, 0x81, 0xc0, 0xb1, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x82, 0xc8, 0xb1, 0xc0, 0xb1, 0x48, 0xf1, 0x01, 0x30, 0xf0, 0x02, 0x28, 0xcf, 0x80, 0x20, 0xcf, 0x02, 0x20, 0xce, 0x01, 0x20, 0xae, 0x81, 0x18, 0xad, 0x20, 0xae, 0x0d, 0x18, 0xad, 0x01, 0x18, 0xae, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf3, 0x01, 0x18, 0xad, 0x80, 0x08, 0xf3, 0x05, 0x01, 0x19,
+  0x82, 0x01, 0x1a, 0x01, 0x18, 0x10, 0xd0, 0x03, 0x18, 0xad, 0x84, 0x18, 0xae, 0x00, 0xf7, 0x00, 0xf9, 0x01, 0x19, 0x10, 0xd0, 0x01, 0x18, 0xad, 0x83, 0x18, 0xcd, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x1b, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xaf, 0x01, 0x01, 0x19, 0x84, 0x00, 0xf7, 0x18, 0xae, 0x20, 0xae, 0x18, 0xad, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x04, 0x18, 0xad, 0x84, 0x20, 0xad, 0x18, 0xad, 0x18, 0xcd, 0x18, 0xae, 0x00, 0xf7, 0x02, 0x01, 0x1a, 0x82, 0x01, 0x19, 0x01, 0x17, 0x18, 0xae, 0x29, 0x18, 0xad, 0x80, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x20, 0xae, 0x20, 0xad, 0x02, 0x20, 0xae, 0x02, 0x20, 0xce, 0x81, 0x28, 0xce, 0x28, 0xcf, 0x01, 0x28, 0xef, 0x02, 0x30, 0xf0, 0x84, 0x51, 0x72, 0x61, 0xb2, 0x8a, 0x54, 0x9a, 0x94, 0xb3, 0x35, 0x07, 0xd3, 0x95, 0x05, 0xd3, 0x75, 0x82, 0xd3, 0x55, 0x9c, 0x97, 0x36, 0xdd, 0x03, 0x07, 0xff, 0x84, 0xac, 0x17, 0xd3, 0x35, 0xd3, 0x14, 0xd3, 0x35, 0xd3, 0x14, 0x01, 0xd3, 0x15, 0x81, 0xd2, 0xf4, 0x46, 0x7c, 0x11, 0x07, 0xff, 0x86, 0x6d, 0x59, 0xd2, 0x74, 0xca, 0x94, 0xd2, 0x74, 0xca, 0x74, 0xb3, 0x34, 0x07, 0xfe, 0x02, 0x07, 0xfd, 0x01, 0x07, 0xfc, 0x80, 0x07, 0xfb, 0x02, 0x07, 0xfa, 0x80, 0x07, 0xf9, 0x02, 0x07, 0xf8, 0x80, 0x07, 0xf7, 0x02, 0x07, 0xf6, 0x0a, 0x07, 0xf5, 0x02, 0x07, 0xf4, 0x8c, 0x07, 0xd3, 0x07, 0xb3, 0x07, 0x93, 0x07, 0x53, 0x07, 0x14, 0x06, 0xb5, 0x55, 0x16, 0x05, 0x38, 0x03, 0x7c, 0x01, 0xff, 0x01, 0x7f, 0x01, 0x5f, 0x01, 0x3f, 0x01, 0x01, 0x1f, 0x82, 0x00, 0xff, 0x00, 0xdf, 0x00, 0xbf, 0x01, 0x00, 0x9f, 0x80, 0x00, 0x7f, 0x01, 0x00, 0x5f, 0x88, 0x00, 0x3f, 0x00, 0x1f, 0x60, 0x99, 0xc9, 0x11, 0x49, 0x1a, 0x02, 0xdf, 0x05, 0x1f, 0x06, 0xbf, 0x07, 0xbf, 0x04, 0x07, 0xff, 0x83, 0x64, 0x59, 0xc8, 0xb1, 0xc0, 0xb1, 0xc8, 0xb1, 0x04, 0xc0, 0xb1, 0x84, 0x90, 0xd1, 0x30, 0xf1, 0x30, 0xf0, 0x30, 0xef, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x0f, 0x18, 0xad, 0x82, 0x08, 0xf5, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x00, 0xf7, 0x82, 0x01, 0x19, 0x01, 0x1a, 0x08, 0xf5, 0x03, 0x18, 0xad,
+  0x83, 0x00, 0xf7, 0x01, 0x1a, 0x00, 0xf8, 0x10, 0xd0, 0x01, 0x18, 0xad, 0x86, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xcf, 0x1c, 0x18, 0xad, 0x01, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xb0, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x07, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x84, 0x20, 0xad, 0x18, 0xad, 0x08, 0xf5, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x80, 0x08, 0xf5, 0x2a, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x20, 0xad, 0x18, 0xad, 0x01, 0x20, 0xad, 0x03, 0x20, 0xae, 0x03, 0x20, 0xce, 0x02, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x02, 0x30, 0xf0, 0x80, 0x31, 0x11, 0x01, 0x39, 0x11, 0x01, 0x41, 0x32, 0x83, 0x51, 0x52, 0x69, 0xd3, 0x92, 0x74, 0xb2, 0xf5, 0x01, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0xd3, 0x95, 0x05, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x81, 0xa4, 0x78, 0x36, 0xdd, 0x01, 0x07, 0xff, 0x82, 0x56, 0x3c, 0xd3, 0x35, 0xd3, 0x34, 0x01, 0xd3, 0x15, 0x82, 0xd2, 0xf4, 0xcb, 0x15, 0xbb, 0x96, 0x12, 0x07, 0xff, 0x80, 0x84, 0x98, 0x01, 0xca, 0x94, 0x80, 0xd2, 0x74, 0x01, 0xca, 0x74, 0x03, 0x07, 0xfe, 0x01, 0x07, 0xfd, 0x02, 0x07, 0xfc, 0x01, 0x07, 0xfb, 0x01, 0x07, 0xfa, 0x01, 0x07, 0xf9, 0x03, 0x07, 0xf8, 0x0b, 0x07, 0xf7, 0x01, 0x07, 0xf6, 0x8c, 0x07, 0xd6, 0x07, 0xb6, 0x07, 0x96, 0x07, 0x56, 0x07, 0x16, 0xa4, 0x56, 0xbb, 0xd6, 0x34, 0x79, 0x02, 0xfd, 0x02, 0x3f, 0x01, 0x9f, 0x01, 0x5f, 0x01, 0x1f, 0x01, 0x00, 0xff, 0x01, 0x00, 0xbf, 0x01, 0x00, 0x9f, 0x81, 0x00, 0x7f, 0x00, 0x5f, 0x02, 0x00, 0x3f, 0x86, 0x78, 0xb7, 0xc1, 0x11, 0xa1, 0x14, 0x01, 0xff, 0x04, 0x1f, 0x05, 0xff, 0x07, 0x5f, 0x04, 0x07, 0xff, 0x85, 0x0f, 0x9f, 0xc0, 0xb1, 0xc0, 0xd2, 0xc8, 0xb1, 0xc0, 0xb1, 0xc8, 0xb1, 0x03, 0xc0, 0xb1, 0x83, 0x48, 0xf1, 0x30, 0xf0, 0x30, 0xef, 0x28, 0xf0, 0x01, 0x28, 0xcf, 0x80, 0x20, 0xcf, 0x02, 0x20, 0xce, 0x02, 0x20, 0xae, 0x0f, 0x18, 0xad, 0x81, 0x18, 0xae, 0x00, 0xf7, 0x03, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xae, 0x03, 0x18, 0xad,
+  0x8f, 0x18, 0xce, 0x08, 0xf7, 0x01, 0x19, 0x00, 0xf8, 0x10, 0xcf, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x01, 0x17, 0x01, 0x19, 0x00, 0xf9, 0x18, 0xb0, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x18, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xaf, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xae, 0x05, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xad, 0x06, 0x01, 0x19, 0x81, 0x01, 0x1a, 0x20, 0xad, 0x29, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x20, 0xcd, 0x01, 0x20, 0xae, 0x03, 0x20, 0xce, 0x81, 0x20, 0xcf, 0x28, 0xce, 0x02, 0x28, 0xcf, 0x80, 0x28, 0xf0, 0x01, 0x30, 0xf0, 0x80, 0x38, 0xf0, 0x01, 0x39, 0x11, 0x01, 0x41, 0x32, 0x82, 0x49, 0x32, 0x49, 0x33, 0x49, 0x53, 0x01, 0x51, 0x54, 0x82, 0x71, 0xf4, 0x9a, 0x75, 0xb2, 0xf5, 0x02, 0xd3, 0x75, 0x83, 0xd3, 0x55, 0xd3, 0x75, 0xd3, 0x55, 0xd3, 0x75, 0x01, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x89, 0x9c, 0x78, 0x36, 0xdd, 0x07, 0xff, 0x9c, 0x57, 0xd3, 0x35, 0xd3, 0x15, 0xd3, 0x34, 0xd3, 0x14, 0xc3, 0x55, 0x27, 0x1d, 0x12, 0x07, 0xff, 0x86, 0x9b, 0xf7, 0xca, 0x94, 0xd2, 0x74, 0xca, 0x73, 0xca, 0x74, 0xd2, 0x53, 0x2e, 0xfd, 0x03, 0x07, 0xff, 0x01, 0x07, 0xfe, 0x02, 0x07, 0xfd, 0x01, 0x07, 0xfc, 0x02, 0x07, 0xfb, 0x02, 0x07, 0xfa, 0x05, 0x07, 0xf9, 0x05, 0x07, 0xfa, 0x02, 0x07, 0xf9, 0x90, 0x07, 0xf8, 0x07, 0xd8, 0x07, 0xb8, 0x07, 0x97, 0x07, 0x58, 0x0e, 0xf8, 0xbb, 0xf6, 0xd3, 0x95, 0x6b, 0x99, 0x02, 0x5f, 0x02, 0x1f, 0x01, 0xbf, 0x01, 0x3f, 0x01, 0x1f, 0x00, 0xff, 0x00, 0xdf, 0x00, 0xbf, 0x01, 0x00, 0x9f, 0x80, 0x00, 0x7f, 0x01, 0x00, 0x5f, 0x89, 0x00, 0x3f, 0x00, 0x1f, 0x98, 0xd5, 0xc8, 0xf2, 0xc9, 0x11, 0x19, 0x5e, 0x03, 0x3f, 0x05, 0x3f, 0x06, 0xbf, 0x07, 0xbf, 0x04, 0x07, 0xff, 0x80, 0x7b, 0x76, 0x06, 0xc0, 0xb1, 0x84, 0xc0, 0xd1, 0x88, 0xd1, 0x30, 0xf1, 0x30, 0xf0, 0x28, 0xf0, 0x02, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x02, 0x20, 0xae, 0x11, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x01, 0x08, 0xf3, 0x80, 0x10, 0xd2, 0x05, 0x18, 0xad,
+  0x01, 0x18, 0xae, 0x8c, 0x00, 0xf7, 0x01, 0x1a, 0x00, 0xf9, 0x18, 0xcf, 0x18, 0xad, 0x18, 0xae, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf8, 0x18, 0xd0, 0x01, 0x18, 0xad, 0x82, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xcd, 0x17, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xb0, 0x01, 0x01, 0x19, 0x83, 0x00, 0xf7, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x01, 0x17, 0x00, 0xf9, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x84, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x00, 0xfa, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x2d, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x01, 0x20, 0xae, 0x80, 0x18, 0xad, 0x01, 0x20, 0xae, 0x81, 0x20, 0xce, 0x20, 0xae, 0x01, 0x20, 0xce, 0x81, 0x20, 0xcf, 0x28, 0xce, 0x01, 0x28, 0xcf, 0x81, 0x28, 0xef, 0x30, 0xef, 0x01, 0x30, 0xf0, 0x87, 0x31, 0x11, 0x39, 0x10, 0x39, 0x11, 0x41, 0x11, 0x49, 0x12, 0x41, 0x33, 0x49, 0x32, 0x49, 0x33, 0x01, 0x51, 0x54, 0x01, 0x59, 0x55, 0x88, 0x59, 0x75, 0x69, 0x96, 0x8a, 0x16, 0xaa, 0xd5, 0xcb, 0x55, 0xd3, 0x75, 0xd3, 0x55, 0xd3, 0x54, 0xd3, 0x55, 0x03, 0xd3, 0x35, 0x87, 0xcb, 0x35, 0x84, 0xf9, 0x0f, 0xbf, 0x5d, 0xdb, 0xa4, 0x57, 0x9c, 0x58, 0x84, 0xd8, 0x1f, 0x5e, 0x13, 0x07, 0xff, 0x80, 0x9b, 0xd6, 0x04, 0xca, 0x74, 0x80, 0x36, 0x9c, 0x06, 0x07, 0xff, 0x02, 0x07, 0xfe, 0x02, 0x07, 0xfd, 0x02, 0x07, 0xfc, 0x08, 0x07, 0xfb, 0x03, 0x07, 0xfc, 0x03, 0x07, 0xfb, 0x01, 0x07, 0xda, 0x8e, 0x07, 0xba, 0x07, 0x9a, 0x07, 0x79, 0x2e, 0x99, 0xc3, 0xd6, 0xd3, 0x95, 0x83, 0x39, 0x0a, 0x3e, 0x01, 0xdf, 0x01, 0x9f, 0x01, 0x5f, 0x01, 0x1f, 0x00, 0xff, 0x00, 0xbf, 0x00, 0x9f, 0x02, 0x00, 0x7f, 0x02, 0x00, 0x3f, 0x87, 0x90, 0xd5, 0xc9, 0x12, 0xc0, 0xf1, 0x71, 0x17, 0x02, 0x7f, 0x04, 0x9f, 0x06, 0x5f, 0x07, 0x7f, 0x04, 0x07, 0xff, 0x81, 0x26, 0x9d, 0xc8, 0x91, 0x06, 0xc0, 0xb1, 0x81, 0xb8, 0xb1, 0x31, 0x10, 0x01, 0x30, 0xf0, 0x02, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x02, 0x20, 0xae, 0x0f, 0x18, 0xad, 0x80, 0x20, 0xad, 0x05, 0x18, 0xad, 0x80, 0x20, 0xad, 0x03, 0x18, 0xad,
+  0x87, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xcf, 0x18, 0xae, 0x02, 0x18, 0xad, 0x84, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x39, 0x00, 0xf8, 0x18, 0xb0, 0x16, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xd0, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x03, 0x18, 0xad, 0x80, 0x18, 0xb0, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x0d, 0x01, 0x19, 0x84, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x00, 0xf9, 0x20, 0xae, 0x27, 0x18, 0xad, 0x83, 0x20, 0xae, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0x04, 0x18, 0xad, 0x81, 0x20, 0xcd, 0x18, 0xce, 0x01, 0x20, 0xae, 0x01, 0x20, 0xce, 0x80, 0x20, 0xae, 0x02, 0x20, 0xce, 0x83, 0x28, 0xef, 0x28, 0xcf, 0x28, 0xef, 0x28, 0xd0, 0x01, 0x30, 0xf0, 0x80, 0x38, 0xf0, 0x01, 0x39, 0x11, 0x80, 0x39, 0x31, 0x01, 0x41, 0x32, 0x82, 0x49, 0x33, 0x51, 0x33, 0x51, 0x53, 0x01, 0x51, 0x54, 0x87, 0x59, 0x75, 0x61, 0x75, 0x61, 0x95, 0x92, 0x55, 0x8b, 0x14, 0x4a, 0xd3, 0x7a, 0x94, 0xab, 0x14, 0x02, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x84, 0xd3, 0x15, 0xd3, 0x14, 0xd3, 0x35, 0xc3, 0x55, 0x46, 0x7c, 0x17, 0x07, 0xff, 0x80, 0xc2, 0xd4, 0x01, 0xca, 0x74, 0x83, 0xd2, 0x74, 0xca, 0x74, 0xd2, 0x53, 0x36, 0x9c, 0x08, 0x07, 0xff, 0x03, 0x07, 0xfe, 0x04, 0x07, 0xfd, 0x02, 0x07, 0xfc, 0x05, 0x07, 0xfd, 0x02, 0x07, 0xfe, 0x02, 0x07, 0xfd, 0x01, 0x07, 0xfc, 0x80, 0x07, 0xdb, 0x01, 0x07, 0xbb, 0x8a, 0x07, 0x7b, 0x2e, 0xba, 0xc3, 0xd6, 0xd3, 0x95, 0xb3, 0x37, 0x09, 0xdf, 0x01, 0xbf, 0x01, 0x7f, 0x01, 0x3f, 0x01, 0x1f, 0x00, 0xdf, 0x01, 0x00, 0x9f, 0x80, 0x00, 0x7f, 0x01, 0x00, 0x5f, 0x01, 0x00, 0x3f, 0x88, 0x78, 0x96, 0xc0, 0xf1, 0xc8, 0xf1, 0xa8, 0xf3, 0x01, 0xdf, 0x03, 0xdf, 0x05, 0xbf, 0x07, 0x1f, 0x07, 0xdf, 0x04, 0x07, 0xff, 0x80, 0xa2, 0x14, 0x04, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x80, 0x68, 0xf1, 0x01, 0x30, 0xf0, 0x80, 0x30, 0xef, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xce, 0x03, 0x20, 0xce, 0x01, 0x20, 0xae, 0x1a, 0x18, 0xad,
+  0x02, 0x18, 0xad, 0x84, 0x18, 0xae, 0x01, 0x17, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xcf, 0x03, 0x18, 0xad, 0x84, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xcf, 0x15, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x87, 0x18, 0xae, 0x18, 0xaf, 0x00, 0xf9, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xd0, 0x01, 0x01, 0x19, 0x83, 0x00, 0xf7, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x05, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x2f, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x81, 0x20, 0xce, 0x20, 0xae, 0x03, 0x20, 0xce, 0x80, 0x20, 0xef, 0x01, 0x28, 0xcf, 0x82, 0x28, 0xef, 0x30, 0xf0, 0x30, 0xef, 0x01, 0x30, 0xf0, 0x01, 0x39, 0x11, 0x91, 0x41, 0x11, 0x41, 0x32, 0x49, 0x32, 0x49, 0x33, 0x51, 0x33, 0x51, 0x53, 0x51, 0x54, 0x59, 0x54, 0x61, 0x95, 0x9a, 0x75, 0xcb, 0x55, 0xcb, 0x75, 0x5b, 0xb4, 0x3b, 0x34, 0x42, 0xb3, 0x4a, 0x33, 0x62, 0x53, 0x9a, 0xb4, 0x01, 0xd3, 0x35, 0x83, 0xd3, 0x15, 0xd3, 0x34, 0xd3, 0x14, 0xd3, 0x15, 0x01, 0xd3, 0x14, 0x80, 0x5d, 0xdb, 0x15, 0x07, 0xff, 0x80, 0x1f, 0x5e, 0x04, 0xd2, 0x74, 0x81, 0xca, 0x53, 0x36, 0x9d, 0x0c, 0x07, 0xff, 0x0c, 0x07, 0xfe, 0x05, 0x07, 0xff, 0x02, 0x07, 0xfe, 0x80, 0x07, 0xfd, 0x01, 0x07, 0xdd, 0x82, 0x07, 0xbd, 0x07, 0x9c, 0x56, 0x1a, 0x01, 0xd3, 0x95, 0x87, 0xab, 0x37, 0x09, 0x9f, 0x01, 0x5f, 0x01, 0x3f, 0x01, 0x1f, 0x00, 0xff, 0x00, 0xbf, 0x00, 0x9f, 0x01, 0x00, 0x7f, 0x80, 0x00, 0x5f, 0x01, 0x00, 0x3f, 0x88, 0x30, 0x5c, 0xc0, 0xf1, 0xc8, 0xf1, 0xc8, 0xd1, 0x21, 0x5d, 0x03, 0x3f, 0x05, 0x1f, 0x06, 0xdf, 0x07, 0xdf, 0x04, 0x07, 0xff, 0x80, 0x5c, 0xd9, 0x02, 0xc0, 0xb1, 0x80, 0xc8, 0xb1, 0x03, 0xc0, 0xb1, 0x81, 0x98, 0xd1, 0x38, 0xf0, 0x01, 0x30, 0xf0, 0x82, 0x28, 0xcf, 0x28, 0xef, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x05, 0x18, 0xad, 0x80, 0x18, 0xae, 0x12, 0x18, 0xad,
+  0x03, 0x18, 0xad, 0x84, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x1a, 0x00, 0xf8, 0x10, 0xd0, 0x01, 0x18, 0xad, 0x86, 0x20, 0xad, 0x18, 0xae, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf8, 0x10, 0xcf, 0x11, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x03, 0x18, 0xad, 0x85, 0x18, 0xae, 0x00, 0xf8, 0x01, 0x1a, 0x00, 0xf7, 0x18, 0xae, 0x20, 0xae, 0x01, 0x18, 0xad, 0x85, 0x18, 0xcd, 0x18, 0xb0, 0x00, 0xf9, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xce, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x06, 0x18, 0xad, 0x01, 0x18, 0xae, 0x80, 0x01, 0x17, 0x01, 0x01, 0x19, 0x83, 0x01, 0x1a, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xce, 0x32, 0x18, 0xad, 0x81, 0x20, 0xae, 0x18, 0xad, 0x01, 0x20, 0xae, 0x04, 0x20, 0xce, 0x02, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x02, 0x30, 0xf0, 0x01, 0x39, 0x11, 0x82, 0x41, 0x11, 0x41, 0x31, 0x41, 0x32, 0x01, 0x49, 0x33, 0x90, 0x51, 0x54, 0x59, 0x74, 0x92, 0x55, 0xcb, 0x55, 0xd3, 0x75, 0xbb, 0x95, 0x54, 0x74, 0x3c, 0x34, 0x3b, 0xb4, 0x43, 0x33, 0x42, 0xb3, 0x4a, 0x13, 0x49, 0xf3, 0x5a, 0x32, 0x9a, 0xb4, 0xd3, 0x34, 0xd3, 0x35, 0x01, 0xd3, 0x14, 0x83, 0xd3, 0x15, 0xd3, 0x14, 0xd2, 0xf4, 0x84, 0xd8, 0x14, 0x07, 0xff, 0x84, 0x4d, 0xdb, 0xd2, 0x74, 0xca, 0x74, 0xca, 0x73, 0xd2, 0x74, 0x01, 0xca, 0x54, 0x80, 0x36, 0x9c, 0x23, 0x07, 0xff, 0x01, 0x07, 0xfe, 0x83, 0x07, 0xdd, 0x07, 0xde, 0x07, 0x9d, 0x6d, 0x99, 0x01, 0xd3, 0x95, 0x81, 0xab, 0x17, 0x09, 0x7f, 0x01, 0x01, 0x1f, 0x80, 0x00, 0xff, 0x01, 0x00, 0xbf, 0x80, 0x00, 0x9f, 0x01, 0x00, 0x7f, 0x02, 0x00, 0x3f, 0x01, 0xc8, 0xf1, 0x85, 0xc8, 0xd1, 0x51, 0x19, 0x02, 0xdf, 0x04, 0xff, 0x06, 0xbf, 0x07, 0xbf, 0x04, 0x07, 0xff, 0x80, 0x1f, 0x1e, 0x08, 0xc0, 0xb1, 0x80, 0x49, 0x10, 0x01, 0x30, 0xf0, 0x01, 0x28, 0xef, 0x81, 0x28, 0xcf, 0x20, 0xcf, 0x01, 0x20, 0xce, 0x02, 0x20, 0xae, 0x81, 0x20, 0xad, 0x20, 0xae, 0x0c, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x10, 0xd2, 0x01, 0x08, 0xf3, 0x82, 0x10, 0xd2, 0x18, 0xad, 0x18, 0xae, 0x03, 0x18, 0xad,
+  0x04, 0x18, 0xad, 0x84, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf8, 0x10, 0xd0, 0x01, 0x18, 0xad, 0x87, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xae, 0x20, 0xad, 0x0f, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x18, 0xad, 0x87, 0x18, 0xae, 0x18, 0xad, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xae, 0x20, 0xae, 0x01, 0x18, 0xad, 0x85, 0x18, 0xae, 0x10, 0xcf, 0x00, 0xf9, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xce, 0x0b, 0x18, 0xad, 0x82, 0x18, 0xae, 0x20, 0xae, 0x10, 0xd2, 0x01, 0x08, 0xf3, 0x81, 0x10, 0xd2, 0x20, 0xad, 0x33, 0x18, 0xad, 0x81, 0x20, 0xae, 0x18, 0xad, 0x01, 0x20, 0xae, 0x04, 0x20, 0xce, 0x02, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x02, 0x30, 0xf0, 0x82, 0x39, 0x10, 0x39, 0x11, 0x41, 0x12, 0x01, 0x41, 0x32, 0x83, 0x49, 0x33, 0x51, 0x33, 0x82, 0x14, 0xcb, 0x55, 0x01, 0xd3, 0x75, 0x88, 0xb3, 0xd5, 0x3d, 0x55, 0x35, 0x15, 0x34, 0x95, 0x3c, 0x14, 0x3b, 0x94, 0x3b, 0x13, 0x42, 0x93, 0x42, 0x12, 0x01, 0x49, 0xf3, 0x88, 0x5a, 0x13, 0x9a, 0xb4, 0xd3, 0x14, 0xd3, 0x15, 0xcb, 0x15, 0xd2, 0xf4, 0xd2, 0xf5, 0xd2, 0xf4, 0x75, 0x39, 0x13, 0x07, 0xff, 0x87, 0x8c, 0x37, 0xca, 0x74, 0xd2, 0x73, 0xd2, 0x53, 0xca, 0x54, 0xca, 0x53, 0xd2, 0x53, 0x1f, 0x5e, 0x26, 0x07, 0xff, 0x80, 0x07, 0xfe, 0x01, 0x07, 0xdf, 0x83, 0x94, 0xd8, 0xd3, 0x96, 0xd3, 0x95, 0x82, 0x99, 0x02, 0x00, 0xff, 0x01, 0x00, 0xbf, 0x81, 0x00, 0x9f, 0x00, 0x7f, 0x01, 0x00, 0x5f, 0x89, 0x00, 0x3f, 0x00, 0x1f, 0xc8, 0xd1, 0xc0, 0xf1, 0xc0, 0xd1, 0xa0, 0xd4, 0x02, 0x7f, 0x04, 0xbf, 0x06, 0x9f, 0x07, 0xbf, 0x05, 0x07, 0xff, 0x80, 0x83, 0x15, 0x07, 0xc0, 0xb1, 0x80, 0x70, 0xf1, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x02, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x01, 0x20, 0xae, 0x81, 0x20, 0xad, 0x20, 0xae, 0x0c, 0x18, 0xad, 0x81, 0x18, 0xae, 0x00, 0xf7, 0x03, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xae, 0x03, 0x18, 0xad,
+  0x05, 0x18, 0xad, 0x84, 0x18, 0xae, 0x08, 0xf7, 0x01, 0x1a, 0x01, 0x18, 0x10, 0xd0, 0x01, 0x18, 0xad, 0x02, 0x18, 0xae, 0x81, 0x00, 0xf7, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x0f, 0x01, 0x1a, 0x03, 0x01, 0x19, 0x89, 0x00, 0xf9, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x17, 0x18, 0xae, 0x20, 0xcd, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x18, 0xd0, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x42, 0x18, 0xad, 0x81, 0x20, 0xae, 0x20, 0xad, 0x01, 0x20, 0xae, 0x03, 0x20, 0xce, 0x80, 0x28, 0xce, 0x02, 0x28, 0xcf, 0x80, 0x28, 0xf0, 0x02, 0x30, 0xf0, 0x01, 0x39, 0x11, 0x02, 0x41, 0x32, 0x81, 0x59, 0x73, 0xb2, 0xf4, 0x02, 0xd3, 0x75, 0x90, 0x94, 0x35, 0x3d, 0x55, 0x2d, 0x55, 0x2d, 0x75, 0x35, 0x15, 0x3c, 0x94, 0x34, 0x14, 0x3b, 0x94, 0x43, 0x13, 0x42, 0x93, 0x4a, 0x13, 0x41, 0xf3, 0x49, 0xf2, 0x4a, 0x13, 0x5a, 0x33, 0xa2, 0xb4, 0xd3, 0x14, 0x01, 0xd2, 0xf4, 0x82, 0xd2, 0xd4, 0xd2, 0xf4, 0x4e, 0x1b, 0x11, 0x07, 0xff, 0x83, 0x17, 0x9f, 0xd2, 0x74, 0xca, 0x53, 0xca, 0x73, 0x02, 0xca, 0x53, 0x80, 0xd2, 0x53, 0x09, 0x07, 0xff, 0x04, 0x07, 0xdf, 0x0c, 0x07, 0xff, 0x07, 0x07, 0xdf, 0x06, 0x07, 0xff, 0x81, 0x0f, 0x9e, 0xbc, 0x16, 0x01, 0xd3, 0x95, 0x80, 0x72, 0x5a, 0x02, 0x00, 0xbf, 0x80, 0x00, 0x9f, 0x01, 0x00, 0x7f, 0x01, 0x00, 0x5f, 0x82, 0x00, 0x3f, 0x00, 0x1f, 0x90, 0xb5, 0x01, 0xc8, 0xd1, 0x84, 0xc0, 0xd1, 0x12, 0x3e, 0x04, 0x7f, 0x06, 0x7f, 0x07, 0xbf, 0x05, 0x07, 0xff, 0x80, 0x54, 0xd9, 0x05, 0xc0, 0xb1, 0x83, 0xc0, 0xd1, 0xc0, 0xb1, 0x90, 0xd1, 0x38, 0xf1, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x01, 0x20, 0xae, 0x81, 0x20, 0xad, 0x20, 0xae, 0x0c, 0x18, 0xad, 0x81, 0x08, 0xf5, 0x01, 0x1a, 0x03, 0x01, 0x19, 0x81, 0x01, 0x1a, 0x08, 0xf5, 0x03, 0x18, 0xad,
+  0x05, 0x18, 0xad, 0x87, 0x18, 0xae, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x1a, 0x00, 0xf8, 0x10, 0xd0, 0x18, 0xad, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x83, 0x18, 0xce, 0x00, 0xf7, 0x01, 0x19, 0x01, 0x1a, 0x11, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x86, 0x00, 0xf7, 0x18, 0xae, 0x20, 0xae, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x18, 0xd0, 0x01, 0x00, 0xf9, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x01, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x08, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x34, 0x18, 0xad, 0x81, 0x20, 0xae, 0x20, 0xad, 0x01, 0x20, 0xae, 0x03, 0x20, 0xce, 0x02, 0x28, 0xcf, 0x84, 0x28, 0xef, 0x28, 0xf0, 0x30, 0xf0, 0x38, 0xf0, 0x30, 0xf0, 0x01, 0x39, 0x11, 0x83, 0x41, 0x12, 0x41, 0x32, 0x82, 0x34, 0xcb, 0x55, 0x01, 0xd3, 0x75, 0x81, 0xd3, 0x55, 0x94, 0x35, 0x01, 0x35, 0x75, 0x80, 0x2d, 0x75, 0x01, 0x35, 0x55, 0x88, 0x35, 0x14, 0x34, 0x74, 0x3b, 0xf4, 0x3b, 0x73, 0x42, 0xf4, 0x42, 0x73, 0x4a, 0x13, 0x42, 0x13, 0x49, 0xf2, 0x01, 0x49, 0xf3, 0x86, 0x6a, 0x33, 0xba, 0xd4, 0xd2, 0xf5, 0xd2, 0xf4, 0xd2, 0xd4, 0xc3, 0x35, 0x17, 0x7e, 0x10, 0x07, 0xff, 0x83, 0x5d, 0x9a, 0xca, 0x54, 0xd2, 0x73, 0xca, 0x54, 0x02, 0xca, 0x53, 0x80, 0x9b, 0xb6, 0x05, 0x07, 0xff, 0x03, 0x07, 0xdf, 0x02, 0x07, 0xbf, 0x80, 0x07, 0x9f, 0x01, 0x07, 0x7f, 0x82, 0x07, 0x7e, 0x07, 0xbf, 0x07, 0xdf, 0x04, 0x07, 0xff, 0x07, 0x07, 0xdf, 0x80, 0x07, 0xbf, 0x04, 0x07, 0xdf, 0x05, 0x07, 0xff, 0x80, 0x36, 0xdd, 0x02, 0xd3, 0x95, 0x80, 0x51, 0xbc, 0x01, 0x00, 0x9f, 0x02, 0x00, 0x7f, 0x01, 0x00, 0x5f, 0x89, 0x00, 0x3f, 0x00, 0x1f, 0x70, 0x77, 0xc0, 0xd2, 0xc8, 0xd1, 0xc0, 0xd1, 0x49, 0xfa, 0x04, 0x9f, 0x06, 0x9f, 0x07, 0xdf, 0x05, 0x07, 0xff, 0x80, 0x1f, 0x1e, 0x06, 0xc0, 0xb1, 0x82, 0xc0, 0xd1, 0xc0, 0xb1, 0x39, 0x10, 0x01, 0x30, 0xf0, 0x80, 0x30, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x04, 0x20, 0xae, 0x0b, 0x18, 0xad, 0x80, 0x01, 0x1a, 0x05, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x03, 0x18, 0xad,
+  0x04, 0x18, 0xad, 0x87, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x18, 0xce, 0x08, 0xf7, 0x01, 0x19, 0x00, 0xf8, 0x18, 0xb0, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x13, 0x18, 0xad, 0x80, 0x20, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x18, 0xb0, 0x01, 0x01, 0x19, 0x81, 0x01, 0x17, 0x18, 0xae, 0x01, 0x18, 0xad, 0x01, 0x18, 0xae, 0x80, 0x18, 0xcd, 0x0a, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x33, 0x18, 0xad, 0x01, 0x20, 0xae, 0x80, 0x20, 0xad, 0x01, 0x20, 0xae, 0x03, 0x20, 0xce, 0x02, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x02, 0x30, 0xf0, 0x80, 0x38, 0xf0, 0x01, 0x39, 0x11, 0x81, 0x49, 0x52, 0xaa, 0xb4, 0x02, 0xd3, 0x75, 0x81, 0xd3, 0x55, 0x94, 0x35, 0x01, 0x35, 0x75, 0x02, 0x2d, 0x75, 0x89, 0x35, 0x55, 0x54, 0xd5, 0x64, 0x75, 0x83, 0xb5, 0x8b, 0x74, 0x9b, 0x34, 0xab, 0x14, 0xaa, 0xd4, 0xb2, 0xd4, 0xaa, 0xd4, 0x01, 0xaa, 0xb4, 0x86, 0xb2, 0xb4, 0x6b, 0x15, 0x8a, 0x94, 0xc2, 0xd4, 0xd2, 0xf4, 0xd2, 0xd4, 0x84, 0xb8, 0x10, 0x07, 0xff, 0x83, 0xb3, 0x15, 0xd2, 0x74, 0xca, 0x53, 0xca, 0x54, 0x01, 0xca, 0x53, 0x81, 0xd2, 0x53, 0x65, 0x3a, 0x01, 0x07, 0xff, 0x01, 0x07, 0xdf, 0x80, 0x07, 0xff, 0x01, 0x07, 0xdf, 0x01, 0x07, 0xbf, 0x01, 0x07, 0x9f, 0x80, 0x07, 0x7f, 0x01, 0x07, 0x5f, 0x01, 0x07, 0x3f, 0x80, 0x07, 0x1f, 0x01, 0x07, 0x1e, 0x83, 0x07, 0x3e, 0x07, 0x9f, 0x07, 0xdf, 0x07, 0xff, 0x04, 0x07, 0xdf, 0x08, 0x07, 0xbf, 0x02, 0x07, 0xdf, 0x04, 0x07, 0xff, 0x80, 0x7d, 0x7a, 0x01, 0xd3, 0x95, 0x81, 0xc3, 0x75, 0x28, 0xfe, 0x01, 0x00, 0x7f, 0x01, 0x00, 0x5f, 0x81, 0x00, 0x3f, 0x00, 0x5f, 0x01, 0x00, 0x3f, 0x80, 0x18, 0x3e, 0x01, 0xc0, 0xd1, 0x84, 0xc0, 0xd2, 0x79, 0x96, 0x04, 0xbf, 0x06, 0x7f, 0x07, 0xbf, 0x06, 0x07, 0xff, 0x80, 0xa2, 0x14, 0x02, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x02, 0xc0, 0xb1, 0x81, 0xc0, 0xd1, 0x58, 0xf1, 0x02, 0x30, 0xf0, 0x82, 0x28, 0xcf, 0x28, 0xef, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x0b, 0x18, 0xad, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x05, 0x01, 0x19,
+  0x05, 0x18, 0xad, 0x81, 0x18, 0xce, 0x18, 0xad, 0x01, 0x18, 0xae, 0x83, 0x00, 0xf7, 0x01, 0x1a, 0x00, 0xf8, 0x18, 0xd0, 0x01, 0x18, 0xad, 0x80, 0x20, 0xcd, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0f, 0x18, 0xad, 0x86, 0x18, 0xae, 0x18, 0xcd, 0x20, 0xad, 0x18, 0xcd, 0x20, 0xad, 0x18, 0xae, 0x20, 0xad, 0x01, 0x18, 0xad, 0x86, 0x18, 0xae, 0x18, 0xd0, 0x00, 0xf9, 0x01, 0x19, 0x01, 0x17, 0x18, 0xce, 0x18, 0xae, 0x04, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x0e, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x30, 0x18, 0xad, 0x01, 0x20, 0xae, 0x80, 0x20, 0xad, 0x02, 0x20, 0xae, 0x02, 0x20, 0xce, 0x02, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x02, 0x30, 0xf0, 0x83, 0x38, 0xf0, 0x39, 0x11, 0x59, 0x72, 0xcb, 0x55, 0x03, 0xd3, 0x75, 0x86, 0xab, 0xd5, 0x45, 0x15, 0x54, 0xf5, 0x7c, 0x75, 0x8c, 0x35, 0xab, 0xd5, 0xcb, 0x55, 0x01, 0xd3, 0x35, 0x80, 0xd3, 0x34, 0x01, 0xd3, 0x35, 0x80, 0xd3, 0x15, 0x01, 0xd3, 0x14, 0x84, 0xc3, 0x55, 0x9c, 0x37, 0x65, 0x9a, 0x46, 0x7c, 0x0f, 0xbf, 0x01, 0x07, 0xff, 0x83, 0x26, 0x9d, 0x9c, 0x17, 0xd2, 0xd4, 0x9c, 0x17, 0x0f, 0x07, 0xff, 0x84, 0x5d, 0x9a, 0xd2, 0x74, 0xca, 0x53, 0xca, 0x54, 0xca, 0x53, 0x02, 0xca, 0x33, 0x81, 0x26, 0xdd, 0x07, 0xff, 0x03, 0x07, 0xdf, 0x80, 0x07, 0xbf, 0x01, 0x07, 0x9f, 0x01, 0x07, 0x7f, 0x81, 0x07, 0x5f, 0x07, 0x3f, 0x01, 0x07, 0x1e, 0x01, 0x06, 0xfe, 0x80, 0x06, 0xff, 0x01, 0x06, 0xde, 0x01, 0x06, 0xbe, 0x82, 0x06, 0xde, 0x07, 0x3e, 0x07, 0x9f, 0x01, 0x07, 0xbf, 0x02, 0x07, 0x9f, 0x80, 0x07, 0x7f, 0x01, 0x07, 0x9f, 0x80, 0x07, 0x7f, 0x03, 0x07, 0x9f, 0x01, 0x07, 0xbf, 0x02, 0x07, 0xdf, 0x02, 0x07, 0xff, 0x81, 0x0f, 0xbf, 0xc3, 0xf6, 0x01, 0xd3, 0x95, 0x80, 0xaa, 0xf7, 0x06, 0x00, 0x3f, 0x01, 0x00, 0x1f, 0x86, 0xa0, 0x94, 0xc0, 0xd1, 0xc8, 0xb1, 0xa8, 0xf3, 0x04, 0xbf, 0x06, 0x9f, 0x07, 0xdf, 0x06, 0x07, 0xff, 0x81, 0x73, 0xd8, 0xb8, 0xb1, 0x02, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x02, 0xc0, 0xb1, 0x81, 0x78, 0xf1, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x30, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x01, 0x20, 0xae, 0x81, 0x20, 0xad, 0x20, 0xae, 0x0b, 0x18, 0xad, 0x02, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x03, 0x01, 0x1a,
+  0x03, 0x18, 0xad, 0x8a, 0x20, 0xae, 0x18, 0xcd, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x01, 0x18, 0x18, 0xd0, 0x02, 0x18, 0xad, 0x80, 0x18, 0x8d, 0x10, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x01, 0x18, 0xae, 0x86, 0x18, 0xcd, 0x10, 0xcf, 0x01, 0x19, 0x00, 0xf9, 0x01, 0x17, 0x18, 0xce, 0x18, 0x8d, 0x02, 0x18, 0xad, 0x01, 0x18, 0xae, 0x81, 0x18, 0xad, 0x18, 0xae, 0x42, 0x18, 0xad, 0x01, 0x20, 0xae, 0x80, 0x20, 0xad, 0x02, 0x20, 0xae, 0x02, 0x20, 0xce, 0x02, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x02, 0x30, 0xf0, 0x81, 0x31, 0x11, 0x71, 0xf2, 0x04, 0xd3, 0x75, 0x81, 0xd3, 0x55, 0xd3, 0x75, 0x01, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x80, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x80, 0xcb, 0x14, 0x01, 0xd3, 0x34, 0x83, 0xac, 0x16, 0x75, 0x3a, 0x46, 0x7d, 0x1f, 0x5e, 0x08, 0x07, 0xff, 0x81, 0x36, 0x9c, 0x4e, 0x1b, 0x0e, 0x07, 0xff, 0x81, 0x26, 0xfd, 0xc2, 0xb4, 0x02, 0xca, 0x53, 0x80, 0xd2, 0x53, 0x01, 0xca, 0x33, 0x80, 0xa3, 0x56, 0x01, 0x07, 0xff, 0x80, 0x07, 0xdf, 0x01, 0x07, 0xbf, 0x80, 0x07, 0x9f, 0x01, 0x07, 0x7f, 0x81, 0x07, 0x5f, 0x07, 0x3f, 0x01, 0x07, 0x1f, 0x80, 0x06, 0xff, 0x01, 0x06, 0xfe, 0x80, 0x06, 0xde, 0x01, 0x06, 0xbe, 0x02, 0x06, 0x9e, 0x01, 0x06, 0x7e, 0x01, 0x06, 0x5e, 0x81, 0x06, 0xbe, 0x07, 0x3e, 0x07, 0x07, 0x5f, 0x03, 0x07, 0x7f, 0x80, 0x07, 0x9f, 0x01, 0x07, 0xbf, 0x02, 0x07, 0xdf, 0x86, 0x07, 0xff, 0x07, 0xdf, 0x6d, 0xda, 0xd3, 0x95, 0xd3, 0x76, 0xd3, 0x75, 0x79, 0xfa, 0x01, 0x00, 0x3f, 0x81, 0x00, 0x1f, 0x00, 0x3f, 0x03, 0x00, 0x1f, 0x80, 0x88, 0x96, 0x01, 0xc0, 0xb1, 0x83, 0xc8, 0xb1, 0x0c, 0x9f, 0x06, 0x9f, 0x07, 0xbf, 0x06, 0x07, 0xff, 0x80, 0x3d, 0xbb, 0x02, 0xc0, 0xb1, 0x82, 0xc0, 0xd1, 0xc0, 0xb1, 0xb8, 0xd1, 0x01, 0xc0, 0xb1, 0x81, 0x98, 0xd1, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x30, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x82, 0x20, 0xae, 0x20, 0xce, 0x20, 0xad, 0x01, 0x20, 0xae, 0x0a, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x05, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x03, 0x18, 0xad,
+  0x04, 0x18, 0xad, 0x80, 0x20, 0xae, 0x04, 0x18, 0xad, 0x84, 0x18, 0xae, 0x01, 0x17, 0x01, 0x1a, 0x01, 0x19, 0x18, 0xb0, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x10, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x85, 0x18, 0xb0, 0x00, 0xf9, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xce, 0x18, 0xae, 0x15, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x30, 0x18, 0xad, 0x05, 0x20, 0xae, 0x02, 0x20, 0xce, 0x02, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x02, 0x30, 0xf0, 0x80, 0x9a, 0x93, 0x03, 0xd3, 0x75, 0x04, 0xd3, 0x55, 0x80, 0xd3, 0x35, 0x01, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x83, 0xc3, 0x75, 0x84, 0xf9, 0x4e, 0x3c, 0x0f, 0xbf, 0x1c, 0x07, 0xff, 0x84, 0x0f, 0x9f, 0xab, 0x75, 0xca, 0x54, 0xd2, 0x53, 0xca, 0x53, 0x01, 0xca, 0x33, 0x83, 0xd2, 0x33, 0xca, 0x33, 0x4d, 0xbb, 0x07, 0xdf, 0x01, 0x07, 0xbf, 0x81, 0x07, 0x9f, 0x07, 0x7f, 0x01, 0x07, 0x5f, 0x80, 0x07, 0x3f, 0x01, 0x07, 0x1f, 0x80, 0x06, 0xff, 0x02, 0x06, 0xde, 0x01, 0x06, 0xbe, 0x80, 0x06, 0x9e, 0x02, 0x06, 0x7e, 0x80, 0x06, 0x5e, 0x01, 0x06, 0x3e, 0x01, 0x06, 0x1e, 0x83, 0x05, 0xfe, 0x05, 0xfd, 0x06, 0x7d, 0x06, 0xde, 0x03, 0x06, 0xfe, 0x80, 0x07, 0x1e, 0x02, 0x07, 0x3f, 0x82, 0x07, 0x3e, 0x07, 0x5f, 0x07, 0x7f, 0x01, 0x07, 0x9f, 0x80, 0x07, 0xbf, 0x01, 0x07, 0xdf, 0x01, 0x07, 0xff, 0x81, 0x0f, 0xbf, 0xc3, 0xd6, 0x01, 0xd3, 0x75, 0x81, 0xd3, 0x55, 0x30, 0xfd, 0x03, 0x00, 0x1f, 0x80, 0x00, 0x3f, 0x01, 0x00, 0x1f, 0x80, 0x60, 0x58, 0x02, 0xc0, 0xb1, 0x82, 0x33, 0xfc, 0x06, 0xbf, 0x07, 0xbf, 0x06, 0x07, 0xff, 0x81, 0x0f, 0x9e, 0xc0, 0xd1, 0x02, 0xc0, 0xb1, 0x82, 0xc0, 0xd1, 0xb8, 0xb1, 0xc0, 0xb1, 0x01, 0xb8, 0xd1, 0x81, 0x39, 0x11, 0x38, 0xf0, 0x01, 0x30, 0xf0, 0x02, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x80, 0x20, 0xad, 0x01, 0x20, 0xae, 0x0a, 0x18, 0xad, 0x81, 0x18, 0xae, 0x00, 0xf7, 0x03, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xae, 0x03, 0x18, 0xad,
+  0x0b, 0x18, 0xad, 0x84, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x01, 0x18, 0x18, 0xd0, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x15, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xb0, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x4b, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x20, 0xae, 0x05, 0x20, 0xce, 0x01, 0x28, 0xcf, 0x01, 0x28, 0xef, 0x82, 0x30, 0xf0, 0x39, 0x10, 0xaa, 0xf4, 0x04, 0xd3, 0x75, 0x04, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x82, 0xb3, 0xd6, 0x75, 0x39, 0x27, 0x1d, 0x1f, 0x07, 0xff, 0x85, 0x2e, 0xfd, 0xb3, 0x15, 0xca, 0x53, 0xca, 0x54, 0xca, 0x33, 0xca, 0x53, 0x01, 0xca, 0x34, 0x81, 0xca, 0x33, 0xa3, 0x35, 0x01, 0x07, 0xbf, 0x82, 0x07, 0x9f, 0x07, 0x7f, 0x07, 0x5f, 0x01, 0x07, 0x3f, 0x80, 0x07, 0x1f, 0x01, 0x06, 0xff, 0x83, 0x06, 0xdf, 0x06, 0xde, 0x06, 0xbf, 0x06, 0xbe, 0x02, 0x06, 0x9e, 0x80, 0x06, 0x7e, 0x01, 0x06, 0x5e, 0x80, 0x06, 0x3e, 0x01, 0x06, 0x1e, 0x84, 0x05, 0xfe, 0x05, 0xde, 0x05, 0xbd, 0x05, 0xbe, 0x05, 0x9d, 0x01, 0x05, 0x5e, 0x84, 0x05, 0xbe, 0x05, 0xfe, 0x06, 0x1d, 0x06, 0x7e, 0x06, 0xbe, 0x01, 0x06, 0xfe, 0x81, 0x07, 0x1f, 0x07, 0x1e, 0x01, 0x07, 0x3f, 0x82, 0x07, 0x5f, 0x07, 0x7f, 0x07, 0x9f, 0x01, 0x07, 0xbf, 0x80, 0x07, 0xdf, 0x01, 0x07, 0xff, 0x81, 0x85, 0x39, 0xd3, 0x75, 0x01, 0xd3, 0x55, 0x80, 0xba, 0xf6, 0x06, 0x00, 0x1f, 0x81, 0x40, 0x3b, 0xc8, 0xb1, 0x01, 0xc0, 0xb1, 0x82, 0x63, 0x18, 0x06, 0xbf, 0x07, 0xbf, 0x07, 0x07, 0xff, 0x80, 0xa9, 0xb3, 0x05, 0xc0, 0xb1, 0x83, 0xc0, 0xd1, 0xb8, 0xd1, 0x49, 0x10, 0x39, 0x10, 0x01, 0x30, 0xf0, 0x84, 0x28, 0xcf, 0x28, 0xef, 0x28, 0xcf, 0x20, 0xcf, 0x20, 0xce, 0x02, 0x20, 0xae, 0x84, 0x18, 0xad, 0x20, 0xae, 0x18, 0xad, 0x20, 0xad, 0x20, 0xae, 0x09, 0x18, 0xad, 0x80, 0x10, 0xd2, 0x01, 0x10, 0xd3, 0x80, 0x10, 0xd2, 0x05, 0x18, 0xad,
+  0x0b, 0x18, 0xad, 0x01, 0x18, 0xae, 0x83, 0x01, 0x17, 0x01, 0x1a, 0x01, 0x19, 0x18, 0xaf, 0x14, 0x18, 0xad, 0x89, 0x20, 0xae, 0x18, 0xad, 0x18, 0xae, 0x18, 0xcf, 0x00, 0xf8, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x42, 0x18, 0xad, 0x80, 0x18, 0xae, 0x06, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0x20, 0xae, 0x03, 0x20, 0xce, 0x01, 0x20, 0xcf, 0x01, 0x28, 0xcf, 0x83, 0x28, 0xef, 0x30, 0xcf, 0x39, 0x10, 0xb3, 0x14, 0x04, 0xd3, 0x75, 0x01, 0xd3, 0x55, 0x80, 0xd3, 0x54, 0x01, 0xd3, 0x55, 0x82, 0xcb, 0x96, 0x85, 0x18, 0x36, 0xdd, 0x20, 0x07, 0xff, 0x84, 0x0f, 0xbe, 0x65, 0x3a, 0xca, 0x54, 0xca, 0x53, 0xd2, 0x53, 0x01, 0xca, 0x53, 0x03, 0xca, 0x33, 0x80, 0x2e, 0x9d, 0x01, 0x07, 0x7f, 0x80, 0x07, 0x5f, 0x01, 0x07, 0x3f, 0x88, 0x07, 0x1f, 0x06, 0xff, 0x06, 0xfe, 0x06, 0xdf, 0x06, 0xde, 0x06, 0xbf, 0x06, 0xbe, 0x06, 0xbf, 0x06, 0x9e, 0x01, 0x06, 0x7e, 0x01, 0x06, 0x5e, 0x80, 0x06, 0x3e, 0x01, 0x06, 0x1e, 0x81, 0x05, 0xfe, 0x05, 0xde, 0x01, 0x05, 0xbe, 0x8b, 0x05, 0x9e, 0x05, 0x7e, 0x05, 0x3e, 0x05, 0x1e, 0x04, 0xfe, 0x04, 0xbe, 0x04, 0x9e, 0x04, 0x1e, 0x03, 0xdd, 0x04, 0xde, 0x06, 0x5e, 0x06, 0xbe, 0x01, 0x06, 0xde, 0x83, 0x06, 0xfe, 0x07, 0x1f, 0x07, 0x3e, 0x07, 0x7f, 0x01, 0x07, 0x9f, 0x80, 0x07, 0xbf, 0x01, 0x07, 0xdf, 0x81, 0x07, 0xff, 0x36, 0xdd, 0x02, 0xd3, 0x55, 0x81, 0xd3, 0x35, 0x69, 0x9a, 0x06, 0x00, 0x1f, 0x85, 0xb8, 0xb2, 0xc0, 0x91, 0xc0, 0xb1, 0x7a, 0x96, 0x06, 0xbf, 0x07, 0x9f, 0x04, 0x07, 0xdf, 0x02, 0x07, 0xff, 0x82, 0x82, 0xf5, 0xc0, 0xb1, 0xc0, 0xd1, 0x02, 0xc0, 0xb1, 0x02, 0xb8, 0xd1, 0x81, 0x60, 0xf1, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x01, 0x28, 0xef, 0x81, 0x28, 0xcf, 0x20, 0xcf, 0x01, 0x20, 0xce, 0x02, 0x20, 0xae, 0x80, 0x18, 0xce, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x20, 0xad, 0x0c, 0x18, 0xad,
+  0x0d, 0x18, 0xad, 0x85, 0x18, 0xae, 0x08, 0xf7, 0x01, 0x19, 0x08, 0xf7, 0x18, 0xce, 0x20, 0xae, 0x11, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x84, 0x10, 0xd0, 0x01, 0x18, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xce, 0x03, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x43, 0x18, 0xad, 0x01, 0x18, 0xae, 0x80, 0x18, 0xad, 0x01, 0x20, 0xad, 0x02, 0x20, 0xae, 0x04, 0x20, 0xce, 0x86, 0x28, 0xce, 0x20, 0xcf, 0x28, 0xcf, 0x28, 0xef, 0x39, 0x10, 0xb3, 0x14, 0xd3, 0x95, 0x03, 0xd3, 0x75, 0x03, 0xd3, 0x55, 0x82, 0xbb, 0xd6, 0x5d, 0xfb, 0x0f, 0xbf, 0x20, 0x07, 0xff, 0x85, 0x0f, 0xbf, 0x5d, 0x9a, 0xb3, 0x15, 0xd2, 0x54, 0xca, 0x53, 0xd2, 0x54, 0x01, 0xca, 0x53, 0x81, 0xca, 0x33, 0xd2, 0x33, 0x01, 0xca, 0x33, 0x81, 0x64, 0xd9, 0x07, 0x7f, 0x01, 0x07, 0x3f, 0x80, 0x07, 0x1f, 0x01, 0x06, 0xff, 0x02, 0x06, 0xdf, 0x81, 0x06, 0xbf, 0x06, 0xbe, 0x01, 0x06, 0x9f, 0x80, 0x06, 0x7e, 0x01, 0x06, 0x5e, 0x01, 0x06, 0x3e, 0x80, 0x06, 0x1e, 0x01, 0x05, 0xfe, 0x81, 0x05, 0xde, 0x05, 0xbe, 0x01, 0x05, 0x9e, 0x01, 0x05, 0x5e, 0x8a, 0x05, 0x1e, 0x04, 0xfe, 0x04, 0xde, 0x04, 0x9e, 0x04, 0x3d, 0x03, 0xde, 0x03, 0xbe, 0x03, 0x9e, 0x03, 0x7e, 0x03, 0xfe, 0x05, 0xfe, 0x01, 0x06, 0x9e, 0x84, 0x06, 0xbe, 0x06, 0xfe, 0x07, 0x1e, 0x07, 0x3f, 0x07, 0x5f, 0x01, 0x07, 0x9f, 0x02, 0x07, 0xdf, 0x82, 0x07, 0xff, 0xbb, 0xf6, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x81, 0xc2, 0xf5, 0x08, 0x3f, 0x04, 0x00, 0x1f, 0x81, 0x00, 0x3f, 0x90, 0x95, 0x01, 0xc8, 0xb1, 0x87, 0x91, 0xf5, 0x06, 0x7f, 0x06, 0xff, 0x07, 0x3f, 0x07, 0x5f, 0x07, 0x7f, 0x07, 0xbf, 0x07, 0xdf, 0x02, 0x07, 0xff, 0x80, 0x54, 0xd9, 0x03, 0xc0, 0xb1, 0x81, 0xb8, 0xd1, 0xc0, 0xd1, 0x01, 0xb8, 0xd1, 0x81, 0x80, 0xf2, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x30, 0xef, 0x01, 0x28, 0xcf, 0x01, 0x20, 0xce, 0x87, 0x20, 0xae, 0x20, 0xad, 0x20, 0xcd, 0x20, 0xae, 0x18, 0xad, 0x18, 0xae, 0x20, 0xae, 0x18, 0xad, 0x01, 0x18, 0xae, 0x01, 0x18, 0xad, 0x85, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x03, 0x18, 0xad, 0x81, 0x18, 0xae, 0x20, 0xad, 0x03, 0x18, 0xad,
+  0x0d, 0x18, 0xad, 0x83, 0x18, 0xae, 0x18, 0xce, 0x08, 0xf7, 0x01, 0x1a, 0x11, 0x01, 0x19, 0x80, 0x00, 0xf9, 0x05, 0x01, 0x19, 0x81, 0x00, 0xf6, 0x18, 0xce, 0x01, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x43, 0x18, 0xad, 0x01, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xae, 0x20, 0xad, 0x03, 0x20, 0xae, 0x02, 0x20, 0xce, 0x81, 0x20, 0xcf, 0x28, 0xce, 0x01, 0x28, 0xcf, 0x82, 0x31, 0x10, 0xb3, 0x14, 0xd3, 0x95, 0x03, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x81, 0x9c, 0x77, 0x56, 0x3b, 0x03, 0x07, 0xff, 0x82, 0x1f, 0x7e, 0x65, 0xdb, 0x7c, 0xf9, 0x03, 0x9c, 0x57, 0x03, 0x9c, 0x37, 0x83, 0x75, 0x39, 0x6d, 0x7a, 0x65, 0x79, 0x5d, 0xbb, 0x01, 0x36, 0xbd, 0x81, 0x36, 0xbc, 0x2e, 0xfd, 0x08, 0x07, 0xff, 0x92, 0x0f, 0xbf, 0x36, 0xbd, 0x5d, 0x9a, 0x8c, 0x37, 0xd2, 0x74, 0xd2, 0x73, 0xd2, 0x54, 0xca, 0x53, 0xd2, 0x54, 0xd2, 0x53, 0xca, 0x33, 0xd2, 0x33, 0xca, 0x34, 0xca, 0x13, 0xca, 0x33, 0x84, 0x18, 0x07, 0x5f, 0x07, 0x3f, 0x07, 0x1f, 0x01, 0x06, 0xff, 0x02, 0x06, 0xdf, 0x01, 0x06, 0xbf, 0x81, 0x06, 0x9e, 0x06, 0x9f, 0x01, 0x06, 0x7e, 0x01, 0x06, 0x5e, 0x80, 0x06, 0x3e, 0x01, 0x06, 0x1e, 0x80, 0x05, 0xfe, 0x01, 0x05, 0xde, 0x01, 0x05, 0xbe, 0x81, 0x05, 0x7e, 0x05, 0x5e, 0x01, 0x05, 0x1e, 0x85, 0x04, 0xfe, 0x04, 0xbe, 0x04, 0x5e, 0x03, 0xfe, 0x03, 0xbe, 0x03, 0x9e, 0x01, 0x03, 0x7e, 0x83, 0x03, 0x5e, 0x03, 0x3e, 0x03, 0x5e, 0x06, 0x1d, 0x01, 0x06, 0x7e, 0x86, 0x06, 0x9e, 0x06, 0xbe, 0x06, 0xfe, 0x07, 0x3f, 0x07, 0x5f, 0x07, 0x7f, 0x07, 0x9f, 0x01, 0x07, 0xdf, 0x81, 0x07, 0xff, 0x7d, 0x59, 0x02, 0xd3, 0x35, 0x81, 0xd3, 0x14, 0x69, 0x9a, 0x04, 0x00, 0x1f, 0x81, 0x00, 0x7f, 0x60, 0xd8, 0x01, 0xc0, 0xb1, 0x87, 0xb8, 0xf2, 0x05, 0xdf, 0x06, 0x1f, 0x06, 0x5f, 0x06, 0xdf, 0x07, 0x3f, 0x07, 0x7f, 0x07, 0xdf, 0x02, 0x07, 0xff, 0x80, 0x36, 0x3c, 0x03, 0xc0, 0xb1, 0x81, 0xb8, 0xd1, 0xc0, 0xd1, 0x01, 0xb8, 0xd1, 0x81, 0x90, 0xd1, 0x39, 0x11, 0x02, 0x30, 0xf0, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xce, 0x02, 0x20, 0xce, 0x85, 0x20, 0xae, 0x20, 0xad, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x05, 0x18, 0xad,
+  0x0b, 0x18, 0xad, 0x01, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xae, 0x00, 0xf7, 0x11, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x00, 0xf9, 0x01, 0x01, 0x19, 0x81, 0x01, 0x1a, 0x08, 0xd5, 0x02, 0x18, 0xad, 0x82, 0x20, 0xae, 0x18, 0xae, 0x18, 0xcd, 0x45, 0x18, 0xad, 0x84, 0x18, 0xae, 0x18, 0xcd, 0x18, 0xad, 0x20, 0xad, 0x18, 0xad, 0x04, 0x20, 0xae, 0x02, 0x20, 0xce, 0x80, 0x20, 0xcf, 0x01, 0x28, 0xce, 0x81, 0x30, 0xef, 0xb3, 0x14, 0x03, 0xd3, 0x75, 0x84, 0xd3, 0x55, 0xd3, 0x75, 0xd3, 0x55, 0x9c, 0x77, 0x3e, 0xdd, 0x04, 0x07, 0xff, 0x83, 0x65, 0x9a, 0xd3, 0x15, 0xd3, 0x14, 0xd3, 0x15, 0x02, 0xd3, 0x14, 0x03, 0xd2, 0xf4, 0x01, 0xd2, 0xd4, 0x82, 0xd2, 0xf4, 0xca, 0xd4, 0xd2, 0xd4, 0x02, 0xd2, 0xb4, 0x80, 0xca, 0xb4, 0x02, 0xd2, 0xb4, 0x01, 0xd2, 0x94, 0x03, 0xca, 0x94, 0x01, 0xca, 0x74, 0x01, 0xca, 0x73, 0x80, 0xd2, 0x74, 0x05, 0xca, 0x53, 0x02, 0xca, 0x33, 0x81, 0xab, 0x15, 0x0e, 0xdf, 0x01, 0x06, 0xff, 0x01, 0x06, 0xdf, 0x01, 0x06, 0xbf, 0x81, 0x06, 0xdf, 0x06, 0xbf, 0x01, 0x06, 0x9f, 0x84, 0x06, 0x7e, 0x06, 0x7f, 0x06, 0x7e, 0x06, 0x5e, 0x06, 0x3f, 0x01, 0x06, 0x1e, 0x01, 0x05, 0xfe, 0x81, 0x05, 0xde, 0x05, 0xbe, 0x01, 0x05, 0x9e, 0x87, 0x05, 0x5e, 0x05, 0x3e, 0x05, 0x1e, 0x04, 0xfe, 0x04, 0xde, 0x04, 0x9e, 0x04, 0x3e, 0x03, 0xbe, 0x01, 0x03, 0x9e, 0x01, 0x03, 0x5e, 0x01, 0x03, 0x3e, 0x91, 0x03, 0x1e, 0x02, 0xfe, 0x03, 0x7e, 0x05, 0xfe, 0x06, 0x5e, 0x06, 0x7e, 0x06, 0x9e, 0x06, 0xde, 0x06, 0xfe, 0x07, 0x5f, 0x07, 0x7f, 0x07, 0x9f, 0x07, 0xbf, 0x07, 0xdf, 0x07, 0xff, 0x27, 0x1d, 0xd3, 0x35, 0xd3, 0x14, 0x01, 0xd3, 0x15, 0x81, 0xc2, 0xd5, 0x08, 0x3f, 0x03, 0x00, 0x1f, 0x8b, 0x00, 0x9f, 0x60, 0xd8, 0xc0, 0xb1, 0xc0, 0xb2, 0xc0, 0xb1, 0x04, 0xbf, 0x05, 0x3f, 0x05, 0xbf, 0x06, 0x7f, 0x06, 0xdf, 0x07, 0x5f, 0x07, 0x9f, 0x03, 0x07, 0xff, 0x01, 0xc0, 0xb1, 0x03, 0xb8, 0xd1, 0x84, 0xc0, 0xb1, 0xb8, 0xd1, 0x98, 0xd1, 0x39, 0x11, 0x38, 0xf0, 0x01, 0x30, 0xf0, 0x02, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x01, 0x20, 0xae, 0x84, 0x18, 0xce, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x18, 0xae, 0x12, 0x18, 0xad,
+  0x10, 0x18, 0xad, 0x81, 0x20, 0xae, 0x20, 0xad, 0x13, 0x18, 0xad, 0x80, 0x20, 0xae, 0x07, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x43, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x83, 0x20, 0xad, 0x18, 0xad, 0x20, 0xae, 0x18, 0xad, 0x01, 0x20, 0xae, 0x03, 0x20, 0xce, 0x83, 0x28, 0xce, 0x20, 0xce, 0x30, 0xef, 0xb3, 0x14, 0x03, 0xd3, 0x75, 0x83, 0xd3, 0x55, 0xd3, 0x75, 0xac, 0x37, 0x36, 0xdd, 0x02, 0x07, 0xff, 0x8a, 0x0e, 0xbd, 0x1d, 0x7b, 0x1c, 0x99, 0x32, 0xf5, 0x3a, 0x75, 0x61, 0x93, 0x69, 0xb3, 0x79, 0xf4, 0x8a, 0x14, 0xb2, 0x94, 0xca, 0xf4, 0x03, 0xd2, 0xf4, 0x03, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x82, 0xca, 0xd4, 0xd2, 0xb4, 0xca, 0xb4, 0x01, 0xd2, 0xb4, 0x03, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x01, 0xca, 0x74, 0x01, 0xd2, 0x74, 0x80, 0xca, 0x53, 0x01, 0xca, 0x54, 0x82, 0xca, 0x53, 0xd2, 0x53, 0xca, 0x53, 0x03, 0xca, 0x33, 0x82, 0x8b, 0x97, 0x35, 0xfd, 0x5d, 0x7b, 0x01, 0x6d, 0x3a, 0x89, 0x5d, 0x5b, 0x35, 0xfd, 0x06, 0xbf, 0x0e, 0x7e, 0x45, 0x7c, 0x6c, 0x99, 0x64, 0x79, 0x64, 0x59, 0x4c, 0xba, 0x0e, 0x1e, 0x01, 0x06, 0x3e, 0x80, 0x06, 0x1e, 0x02, 0x05, 0xfe, 0x84, 0x05, 0xde, 0x05, 0xbe, 0x05, 0x9e, 0x05, 0x7e, 0x05, 0x5e, 0x01, 0x05, 0x1e, 0x87, 0x04, 0xfe, 0x04, 0xde, 0x04, 0x7e, 0x03, 0xde, 0x03, 0xbe, 0x03, 0x7e, 0x03, 0x7f, 0x03, 0x5e, 0x01, 0x03, 0x3e, 0x80, 0x03, 0x1e, 0x02, 0x02, 0xfe, 0x90, 0x02, 0xde, 0x03, 0xfe, 0x05, 0xbe, 0x06, 0x3e, 0x06, 0x5e, 0x06, 0x9e, 0x06, 0xde, 0x07, 0x1f, 0x07, 0x3e, 0x07, 0x7f, 0x07, 0x9f, 0x07, 0xbf, 0x07, 0xdf, 0x07, 0xff, 0xbb, 0xb6, 0xd3, 0x14, 0xd3, 0x15, 0x01, 0xd2, 0xf4, 0x80, 0x69, 0x7a, 0x02, 0x00, 0x1f, 0x82, 0x00, 0x3f, 0x00, 0x7f, 0x48, 0xfa, 0x02, 0xc0, 0xb1, 0x86, 0x33, 0x1c, 0x04, 0x7f, 0x05, 0x3f, 0x05, 0xff, 0x06, 0x9f, 0x07, 0x3f, 0x07, 0x9f, 0x03, 0x07, 0xff, 0x80, 0x9a, 0x14, 0x01, 0xb8, 0xd1, 0x80, 0xc0, 0xb1, 0x03, 0xb8, 0xd1, 0x82, 0xb0, 0xd1, 0x39, 0x11, 0x38, 0xf0, 0x01, 0x30, 0xf0, 0x02, 0x28, 0xcf, 0x85, 0x20, 0xce, 0x20, 0xcf, 0x20, 0xae, 0x18, 0xcf, 0x08, 0xf6, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x81, 0x08, 0xf4, 0x18, 0xce, 0x01, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x0e, 0x18, 0xad,
+  0x0c, 0x18, 0xad, 0x80, 0x20, 0xad, 0x04, 0x18, 0xad, 0x80, 0x20, 0xae, 0x10, 0x18, 0xad, 0x80, 0x20, 0xad, 0x07, 0x18, 0xad, 0x01, 0x18, 0xae, 0x47, 0x18, 0xad, 0x85, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x20, 0xad, 0x20, 0xae, 0x18, 0xad, 0x01, 0x20, 0xae, 0x81, 0x20, 0xce, 0x20, 0xae, 0x02, 0x20, 0xce, 0x81, 0x28, 0xcf, 0x92, 0x73, 0x04, 0xd3, 0x75, 0x85, 0xc3, 0xb6, 0x5d, 0xfb, 0x07, 0xff, 0x0e, 0x3b, 0x1c, 0x98, 0x2a, 0xd5, 0x01, 0x39, 0x11, 0x81, 0x39, 0x12, 0x41, 0x11, 0x02, 0x41, 0x12, 0x03, 0x41, 0x32, 0x8a, 0x49, 0x33, 0x51, 0x73, 0x79, 0xd3, 0x9a, 0x54, 0xc2, 0x94, 0xd2, 0xf4, 0xd2, 0xd5, 0xca, 0xd4, 0xd2, 0xd4, 0xd2, 0xb4, 0xca, 0xd4, 0x03, 0xd2, 0xb4, 0x03, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x02, 0xca, 0x74, 0x81, 0xca, 0x73, 0xd2, 0x53, 0x04, 0xca, 0x53, 0x03, 0xca, 0x33, 0x83, 0x99, 0xd4, 0x63, 0x58, 0xd3, 0x95, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x88, 0x06, 0xbf, 0x5c, 0xfa, 0xd2, 0xb4, 0xca, 0x94, 0xca, 0x33, 0xca, 0x13, 0xc9, 0xd3, 0xb9, 0xd3, 0x4c, 0x5a, 0x01, 0x06, 0x1e, 0x01, 0x05, 0xde, 0x80, 0x05, 0xbe, 0x01, 0x05, 0x9e, 0x86, 0x05, 0x7e, 0x05, 0x3e, 0x05, 0x1e, 0x05, 0x1d, 0x04, 0xde, 0x04, 0xbe, 0x04, 0x3e, 0x01, 0x03, 0xbe, 0x84, 0x03, 0x7f, 0x0b, 0x7e, 0x33, 0x7c, 0x33, 0x3c, 0x33, 0x5c, 0x01, 0x33, 0x3c, 0x01, 0x33, 0x1c, 0x01, 0x32, 0xfc, 0x8a, 0x32, 0xdc, 0x2b, 0x7c, 0x05, 0xde, 0x06, 0x1e, 0x06, 0x5e, 0x06, 0x9e, 0x06, 0xde, 0x07, 0x1f, 0x07, 0x3f, 0x07, 0x7f, 0x07, 0xbf, 0x01, 0x07, 0xdf, 0x85, 0x84, 0xf9, 0xd3, 0x14, 0xcb, 0x14, 0xca, 0xf4, 0xd2, 0xd5, 0xb2, 0x75, 0x03, 0x00, 0x1f, 0x82, 0x00, 0x5f, 0x08, 0xdf, 0xb8, 0xd2, 0x01, 0xc0, 0xb1, 0x86, 0x3a, 0x7b, 0x03, 0xff, 0x04, 0xdf, 0x05, 0xbf, 0x06, 0x7f, 0x07, 0x1f, 0x07, 0x9f, 0x03, 0x07, 0xff, 0x82, 0x7b, 0x77, 0xb8, 0xd1, 0xb8, 0xb1, 0x05, 0xb8, 0xd1, 0x81, 0x41, 0x11, 0x38, 0xf1, 0x01, 0x30, 0xf0, 0x02, 0x28, 0xcf, 0x89, 0x20, 0xcf, 0x20, 0xae, 0x20, 0xcf, 0x09, 0x18, 0x01, 0x3a, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x19, 0x08, 0xf6, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x0b, 0x18, 0xad,
+  0x0c, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x80, 0x00, 0xf9, 0x12, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x4c, 0x01, 0x19, 0x88, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x39, 0x00, 0xf9, 0x10, 0xd2, 0x20, 0xae, 0x18, 0xad, 0x01, 0x20, 0xae, 0x81, 0x20, 0xce, 0x20, 0xae, 0x02, 0x20, 0xce, 0x80, 0x7a, 0x32, 0x04, 0xd3, 0x75, 0x85, 0x9c, 0x78, 0x26, 0x1b, 0x1b, 0x96, 0x31, 0x71, 0x30, 0xf0, 0x38, 0xf1, 0x05, 0x39, 0x11, 0x81, 0x41, 0x11, 0x39, 0x12, 0x02, 0x41, 0x12, 0x81, 0x41, 0x32, 0x41, 0x12, 0x01, 0x41, 0x32, 0x87, 0x49, 0x12, 0x41, 0x32, 0x61, 0x72, 0x81, 0xf3, 0xaa, 0x73, 0xca, 0xd4, 0xd2, 0xb4, 0xca, 0xb4, 0x01, 0xd2, 0xb4, 0x01, 0xca, 0xb4, 0x01, 0xca, 0x94, 0x80, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x02, 0xca, 0x74, 0x82, 0xd2, 0x74, 0xca, 0x54, 0xd2, 0x74, 0x02, 0xca, 0x53, 0x80, 0xd2, 0x33, 0x01, 0xca, 0x33, 0x84, 0xd2, 0x33, 0xc2, 0x34, 0x79, 0x94, 0x59, 0x75, 0xb3, 0x15, 0x03, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0xc3, 0x75, 0x01, 0x06, 0x7f, 0x8b, 0x6c, 0x79, 0xca, 0x33, 0xca, 0x13, 0xc9, 0xd3, 0xc9, 0x92, 0xc9, 0x52, 0xc9, 0x12, 0x34, 0xbb, 0x05, 0xfe, 0x05, 0xde, 0x05, 0xbe, 0x05, 0x9e, 0x01, 0x05, 0x5e, 0x8a, 0x05, 0x3e, 0x05, 0x1e, 0x04, 0xfe, 0x24, 0x9d, 0x34, 0x7b, 0x6b, 0xfa, 0x7b, 0x99, 0x9b, 0x98, 0xab, 0x97, 0xdb, 0x95, 0xd3, 0x96, 0x08, 0xd3, 0x95, 0x8f, 0xd3, 0x96, 0xd3, 0x95, 0xd3, 0x96, 0xd3, 0x95, 0xbb, 0xd6, 0x9c, 0x37, 0x84, 0x99, 0x6d, 0x1a, 0x36, 0x3c, 0x1e, 0xdd, 0x07, 0x9f, 0x07, 0xbf, 0x07, 0xdf, 0x4e, 0x1b, 0xd2, 0xf4, 0xd2, 0xf5, 0x02, 0xd2, 0xd4, 0x80, 0x40, 0xfc, 0x02, 0x00, 0x1f, 0x82, 0x00, 0x3f, 0x00, 0x9f, 0x78, 0xd7, 0x01, 0xc0, 0xb1, 0x86, 0x61, 0xd8, 0x03, 0xbf, 0x04, 0x9f, 0x05, 0x7f, 0x06, 0x5f, 0x07, 0x1f, 0x07, 0xbf, 0x03, 0x07, 0xff, 0x84, 0x54, 0xd9, 0xb8, 0xd1, 0xb8, 0xb1, 0xb8, 0xd1, 0xc0, 0xb1, 0x03, 0xb8, 0xd1, 0x81, 0x41, 0x11, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x85, 0x20, 0xcf, 0x20, 0xae, 0x10, 0xf3, 0x01, 0x3a, 0x01, 0x19, 0x01, 0x39, 0x02, 0x01, 0x19, 0x81, 0x01, 0x1a, 0x18, 0xd0, 0x03, 0x18, 0xad, 0x80, 0x20, 0xae, 0x0c, 0x18, 0xad,
+  0x07, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x67, 0x01, 0x19, 0x84, 0x01, 0x1a, 0x01, 0x19, 0x18, 0xad, 0x20, 0xae, 0x18, 0xad, 0x02, 0x20, 0xae, 0x01, 0x20, 0xce, 0x81, 0x51, 0x70, 0xd3, 0x95, 0x02, 0xd3, 0x75, 0x82, 0xd3, 0x55, 0x65, 0x19, 0x22, 0xb3, 0x04, 0x30, 0xf0, 0x80, 0x38, 0xf0, 0x0a, 0x39, 0x11, 0x03, 0x41, 0x12, 0x8e, 0x41, 0x32, 0x41, 0x12, 0x41, 0x32, 0x41, 0x12, 0x49, 0x52, 0x79, 0xb3, 0xa2, 0x33, 0xd2, 0xb4, 0xca, 0xb4, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0xca, 0x94, 0xca, 0x74, 0xca, 0x94, 0x01, 0xca, 0x74, 0x83, 0xd2, 0x74, 0xca, 0x54, 0xd2, 0x74, 0xd2, 0x53, 0x01, 0xca, 0x54, 0x82, 0xca, 0x33, 0xd2, 0x33, 0xca, 0x34, 0x01, 0xca, 0x33, 0x80, 0xa1, 0xd3, 0x01, 0x59, 0x54, 0x80, 0x79, 0xf5, 0x02, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x93, 0xd3, 0x35, 0x8c, 0x18, 0x06, 0x7f, 0x06, 0x5f, 0x06, 0x3f, 0xa2, 0xd5, 0xc9, 0xd3, 0xc9, 0x72, 0xc9, 0x52, 0xc1, 0x11, 0xc8, 0xd1, 0x8a, 0x55, 0x05, 0xde, 0x05, 0xbe, 0x05, 0x9e, 0x05, 0x7e, 0x05, 0x5e, 0x34, 0xdc, 0x6c, 0x5a, 0xa3, 0xf7, 0x14, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x01, 0xd3, 0x55, 0x02, 0xd3, 0x35, 0x84, 0xbb, 0xb6, 0x84, 0xd9, 0x4e, 0x1b, 0x46, 0x5c, 0xd2, 0xf5, 0x02, 0xd2, 0xd4, 0x81, 0xd2, 0xb4, 0x81, 0xd8, 0x03, 0x00, 0x1f, 0x8a, 0x00, 0x5f, 0x60, 0x98, 0xc0, 0xb1, 0xc0, 0xd1, 0x59, 0xb8, 0x03, 0x5f, 0x04, 0x5f, 0x05, 0x5f, 0x06, 0x3f, 0x06, 0xff, 0x07, 0x9f, 0x03, 0x07, 0xff, 0x83, 0x36, 0x3c, 0xc0, 0xd1, 0xb8, 0xd1, 0xb8, 0xb1, 0x04, 0xb8, 0xd1, 0x85, 0x58, 0xf1, 0x39, 0x11, 0x30, 0xf0, 0x31, 0x10, 0x30, 0xcf, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x82, 0x20, 0xce, 0x08, 0xf6, 0x01, 0x3a, 0x01, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x03, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x0d, 0x01, 0x19,
+  0x04, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x03, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x5f, 0x01, 0x19, 0x03, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x83, 0x01, 0x1a, 0x00, 0xf8, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x84, 0x20, 0xae, 0x20, 0xce, 0x20, 0xae, 0x28, 0xee, 0xcb, 0x55, 0x02, 0xd3, 0x75, 0x83, 0xbb, 0x14, 0x34, 0xf9, 0x29, 0x30, 0x30, 0xef, 0x07, 0x30, 0xf0, 0x0f, 0x39, 0x11, 0x88, 0x41, 0x12, 0x41, 0x11, 0x39, 0x31, 0x41, 0x12, 0x41, 0x11, 0x69, 0x93, 0x91, 0xf2, 0xc2, 0x54, 0xca, 0x93, 0x01, 0xca, 0x94, 0x01, 0xca, 0x74, 0x84, 0xd2, 0x74, 0xca, 0x73, 0xd2, 0x73, 0xca, 0x73, 0xd2, 0x54, 0x01, 0xca, 0x53, 0x88, 0xca, 0x54, 0xca, 0x33, 0xca, 0x34, 0xa1, 0xf3, 0x69, 0x73, 0x49, 0x53, 0x51, 0x34, 0x51, 0x54, 0xaa, 0xf5, 0x02, 0xd3, 0x95, 0x84, 0xd3, 0x75, 0xd3, 0x35, 0xd3, 0x14, 0x5c, 0xda, 0x06, 0x5f, 0x01, 0x06, 0x3f, 0x84, 0xb2, 0x54, 0xc9, 0x72, 0xc9, 0x52, 0xc1, 0x12, 0xc8, 0xd1, 0x01, 0xc0, 0xb1, 0x85, 0x05, 0xbe, 0x05, 0x9e, 0x2d, 0x1c, 0x94, 0x38, 0xcb, 0xb6, 0xd3, 0x96, 0x15, 0xd3, 0x95, 0x81, 0xd3, 0x96, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x01, 0xd3, 0x14, 0x82, 0xd3, 0x15, 0xd2, 0xf4, 0xd2, 0xf5, 0x02, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x82, 0xca, 0x94, 0x08, 0x7f, 0x00, 0x3f, 0x02, 0x00, 0x1f, 0x80, 0x38, 0x5b, 0x01, 0xc0, 0xb1, 0x86, 0x91, 0x35, 0x03, 0x1f, 0x04, 0x3f, 0x05, 0x3f, 0x06, 0x3f, 0x07, 0x1f, 0x07, 0x9f, 0x04, 0x07, 0xff, 0x02, 0xb8, 0xd1, 0x89, 0xb8, 0xb1, 0xb8, 0xd1, 0xc0, 0xd1, 0xb8, 0xb1, 0xb8, 0xd1, 0x59, 0x11, 0x39, 0x11, 0x38, 0xf0, 0x30, 0xf0, 0x30, 0xcf, 0x01, 0x28, 0xcf, 0x85, 0x20, 0xcf, 0x20, 0xce, 0x09, 0x17, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x04, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x03, 0x01, 0x19, 0x80, 0x00, 0xf9, 0x0b, 0x01, 0x19,
+  0x04, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x64, 0x01, 0x19, 0x8c, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x18, 0x01, 0x1a, 0x00, 0xf9, 0x01, 0x19, 0x00, 0xf9, 0x10, 0xd2, 0x20, 0xad, 0x18, 0xcd, 0x20, 0xae, 0x18, 0xad, 0x20, 0xae, 0x01, 0x20, 0xce, 0x80, 0x82, 0x52, 0x02, 0xd3, 0x75, 0x82, 0x9a, 0x93, 0x30, 0xef, 0x20, 0xcf, 0x01, 0x28, 0xcf, 0x01, 0x28, 0xef, 0x80, 0x28, 0xf0, 0x09, 0x30, 0xf0, 0x01, 0x38, 0xf0, 0x0b, 0x39, 0x11, 0x80, 0x38, 0xf1, 0x03, 0x39, 0x11, 0x88, 0x41, 0x11, 0x69, 0x72, 0x81, 0xd2, 0xaa, 0x13, 0xba, 0x33, 0xca, 0x54, 0xca, 0x74, 0xca, 0x53, 0xca, 0x54, 0x01, 0xca, 0x53, 0x84, 0xb2, 0x13, 0xa1, 0xf3, 0x81, 0x93, 0x51, 0x52, 0x49, 0x32, 0x02, 0x49, 0x33, 0x80, 0x51, 0x74, 0x01, 0xd3, 0x95, 0x85, 0xd3, 0x96, 0xd3, 0x75, 0xd3, 0x34, 0xd2, 0xf5, 0xd2, 0xb4, 0x2d, 0x9d, 0x01, 0x06, 0x3f, 0x84, 0x06, 0x1f, 0xc9, 0x93, 0xc9, 0x52, 0xc9, 0x11, 0xc8, 0xf1, 0x01, 0xc0, 0xb1, 0x83, 0xb8, 0xd1, 0x05, 0x9e, 0x05, 0x7e, 0xab, 0xf7, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x0a, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x02, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x84, 0xd3, 0x15, 0xd3, 0x35, 0xcb, 0x15, 0xd2, 0xf4, 0xd2, 0xf5, 0x02, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x01, 0xd2, 0x94, 0x80, 0x41, 0x1c, 0x01, 0x00, 0x3f, 0x01, 0x00, 0x1f, 0x80, 0x20, 0x3c, 0x01, 0xc0, 0xb1, 0x86, 0x91, 0x35, 0x02, 0xff, 0x04, 0x1f, 0x05, 0x1f, 0x06, 0x1f, 0x06, 0xff, 0x07, 0xbf, 0x04, 0x07, 0xff, 0x81, 0xa1, 0xb3, 0xb8, 0xb1, 0x05, 0xb8, 0xd1, 0x84, 0x68, 0xf1, 0x39, 0x11, 0x38, 0xf0, 0x30, 0xf0, 0x30, 0xef, 0x02, 0x28, 0xcf, 0x81, 0x20, 0xce, 0x10, 0xf3, 0x02, 0x01, 0x19, 0x80, 0x00, 0xfa, 0x02, 0x01, 0x19, 0x80, 0x10, 0xd0, 0x03, 0x18, 0xad, 0x01, 0x18, 0xae, 0x0b, 0x18, 0xad,
+  0x07, 0x18, 0xad, 0x80, 0x18, 0xae, 0x6f, 0x18, 0xad, 0x01, 0x20, 0xad, 0x01, 0x18, 0xae, 0x85, 0x18, 0xad, 0x20, 0xae, 0x18, 0xad, 0x20, 0xae, 0x20, 0xce, 0x41, 0x2f, 0x02, 0xd3, 0x75, 0x84, 0x71, 0xd1, 0x20, 0xce, 0x28, 0xcf, 0x20, 0xcf, 0x28, 0xce, 0x01, 0x28, 0xcf, 0x02, 0x28, 0xef, 0x12, 0x30, 0xf0, 0x01, 0x31, 0x10, 0x81, 0x38, 0xf0, 0x30, 0xf0, 0x01, 0x31, 0x11, 0x01, 0x38, 0xf1, 0x80, 0x38, 0xf0, 0x02, 0x39, 0x10, 0x02, 0x39, 0x11, 0x80, 0x39, 0x10, 0x01, 0x61, 0x52, 0x80, 0x51, 0x31, 0x02, 0x39, 0x11, 0x83, 0x39, 0x12, 0x41, 0x12, 0x41, 0x32, 0x41, 0x12, 0x01, 0x49, 0x32, 0x80, 0x8a, 0x34, 0x01, 0xd3, 0x95, 0x85, 0xd3, 0x75, 0xd3, 0x35, 0xd2, 0xf4, 0xca, 0xd4, 0xb2, 0xf6, 0x06, 0x5f, 0x01, 0x06, 0x1f, 0x89, 0x34, 0xdc, 0xc9, 0x52, 0xc9, 0x12, 0xc8, 0xd2, 0xc0, 0xb1, 0xc0, 0xd1, 0xb8, 0xd1, 0x89, 0xb4, 0x2b, 0xba, 0x42, 0x16, 0x01, 0x51, 0x54, 0x8a, 0x49, 0x54, 0x51, 0x54, 0x61, 0x94, 0x71, 0xd4, 0x69, 0xf4, 0x71, 0xd3, 0x69, 0xd4, 0x71, 0xd3, 0x7a, 0x14, 0x8a, 0x75, 0x92, 0x74, 0x01, 0x92, 0x54, 0x83, 0x9a, 0x95, 0xb3, 0x15, 0xbb, 0x14, 0xd3, 0x96, 0x04, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x83, 0xd3, 0x14, 0xd3, 0x15, 0xd2, 0xf4, 0xcb, 0x14, 0x01, 0xd2, 0xf4, 0x84, 0xd2, 0xd4, 0xca, 0xd4, 0xca, 0xb4, 0xd2, 0xb4, 0xca, 0xb4, 0x01, 0xca, 0x94, 0x80, 0x81, 0xb8, 0x01, 0x00, 0x5f, 0x80, 0x00, 0x3f, 0x01, 0x00, 0x1f, 0x88, 0xa8, 0xb3, 0xc0, 0xb1, 0xb0, 0xd2, 0x02, 0xdf, 0x03, 0xff, 0x05, 0x1f, 0x06, 0x1f, 0x06, 0xff, 0x07, 0xbf, 0x04, 0x07, 0xff, 0x80, 0x8a, 0x95, 0x06, 0xb8, 0xd1, 0x84, 0x78, 0xf2, 0x39, 0x11, 0x38, 0xf0, 0x30, 0xf0, 0x28, 0xf0, 0x01, 0x28, 0xcf, 0x83, 0x28, 0xce, 0x20, 0xce, 0x20, 0xcf, 0x09, 0x18, 0x01, 0x01, 0x19, 0x84, 0x01, 0x1a, 0x00, 0xf9, 0x01, 0x19, 0x08, 0xf7, 0x18, 0xae, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x0b, 0x18, 0xad,
+  0x0a, 0x18, 0xad, 0x80, 0x18, 0xae, 0x05, 0x18, 0xad, 0x80, 0x18, 0xae, 0x65, 0x18, 0xad, 0x83, 0x18, 0xae, 0x18, 0xad, 0x20, 0xad, 0x18, 0xad, 0x01, 0x20, 0xae, 0x87, 0x20, 0xcd, 0x20, 0xae, 0x20, 0xcd, 0x92, 0x72, 0xd3, 0x75, 0xc3, 0x34, 0x61, 0xd1, 0x20, 0xcf, 0x01, 0x20, 0xce, 0x07, 0x28, 0xcf, 0x01, 0x28, 0xef, 0x80, 0x30, 0xef, 0x17, 0x30, 0xf0, 0x81, 0x38, 0xf0, 0x30, 0xf0, 0x01, 0x31, 0x10, 0x88, 0x30, 0xf0, 0x31, 0x10, 0x38, 0xf0, 0x30, 0xf0, 0x38, 0xf0, 0x31, 0x11, 0x38, 0xf0, 0x39, 0x11, 0x38, 0xf1, 0x01, 0x39, 0x11, 0x81, 0x39, 0x12, 0x41, 0x11, 0x01, 0x41, 0x32, 0x8d, 0xb2, 0xf5, 0xd3, 0x95, 0xd3, 0x75, 0xd3, 0x55, 0xd2, 0xf4, 0xd2, 0xb4, 0xd2, 0x74, 0x83, 0xb8, 0x06, 0x3f, 0x06, 0x1f, 0x06, 0x1e, 0x63, 0x98, 0xc9, 0x12, 0xc8, 0xd1, 0x01, 0xc0, 0xb1, 0x87, 0xb8, 0xb1, 0xb8, 0xd1, 0x79, 0x33, 0x51, 0x53, 0x51, 0x34, 0x51, 0x54, 0x51, 0x33, 0x49, 0x53, 0x02, 0x49, 0x33, 0x81, 0x41, 0x33, 0x49, 0x33, 0x02, 0x49, 0x32, 0x02, 0x49, 0x33, 0x01, 0x49, 0x32, 0x02, 0x49, 0x33, 0x83, 0x61, 0xb3, 0x7a, 0x34, 0x9a, 0x95, 0xb2, 0xf5, 0x01, 0xd3, 0x75, 0x02, 0xd3, 0x55, 0x01, 0xd3, 0x35, 0x01, 0xd3, 0x14, 0x80, 0xd3, 0x15, 0x02, 0xd2, 0xf4, 0x01, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x01, 0xd2, 0x94, 0x83, 0xd2, 0x74, 0xca, 0x74, 0xc2, 0x54, 0x00, 0x7f, 0x01, 0x00, 0x5f, 0x8a, 0x00, 0x3f, 0x00, 0x1f, 0x58, 0x78, 0xb8, 0xd1, 0xc0, 0xb1, 0x02, 0xbf, 0x03, 0xbf, 0x04, 0xff, 0x05, 0xff, 0x06, 0xff, 0x07, 0xbf, 0x04, 0x07, 0xff, 0x80, 0x64, 0x78, 0x06, 0xb8, 0xd1, 0x82, 0x78, 0xf1, 0x39, 0x11, 0x38, 0xf0, 0x01, 0x30, 0xf0, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xce, 0x01, 0x20, 0xce, 0x81, 0x20, 0xcf, 0x09, 0x17, 0x01, 0x01, 0x1a, 0x83, 0x01, 0x19, 0x08, 0xf4, 0x18, 0xce, 0x18, 0xae, 0x01, 0x18, 0xad, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x0c, 0x18, 0xad,
+  0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x09, 0x18, 0xad, 0x80, 0x18, 0xae, 0x67, 0x18, 0xad, 0x01, 0x18, 0xae, 0x02, 0x18, 0xad, 0x87, 0x20, 0xad, 0x20, 0xcd, 0x18, 0xce, 0x20, 0xae, 0x39, 0x0f, 0xd3, 0x75, 0xcb, 0x35, 0x41, 0x4f, 0x04, 0x20, 0xce, 0x09, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x03, 0x28, 0xcf, 0x02, 0x28, 0xef, 0x07, 0x30, 0xef, 0x81, 0x30, 0xf0, 0x28, 0xf0, 0x02, 0x30, 0xf0, 0x85, 0x28, 0xf0, 0x30, 0xf0, 0x30, 0xef, 0x31, 0x10, 0x30, 0xf0, 0x30, 0xd0, 0x04, 0x30, 0xf0, 0x80, 0x30, 0xf1, 0x01, 0x30, 0xf0, 0x94, 0x38, 0xf0, 0x39, 0x11, 0x39, 0x10, 0x39, 0x11, 0x38, 0xf1, 0x39, 0x11, 0x39, 0x12, 0x49, 0x52, 0xd3, 0x95, 0xd3, 0x75, 0xd3, 0x35, 0xd2, 0xf4, 0xd2, 0xb4, 0xd2, 0x74, 0xca, 0x33, 0x4c, 0x9a, 0x05, 0xff, 0x06, 0x1f, 0x05, 0xff, 0xa1, 0xf4, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x01, 0xb8, 0xd1, 0x81, 0xa0, 0xf1, 0x51, 0x34, 0x04, 0x49, 0x33, 0x02, 0x49, 0x32, 0x02, 0x41, 0x32, 0x05, 0x41, 0x12, 0x04, 0x41, 0x32, 0x8a, 0x41, 0x33, 0x49, 0x33, 0x49, 0x32, 0x49, 0x53, 0x61, 0x93, 0x82, 0x14, 0xa2, 0x74, 0xc3, 0x15, 0xd3, 0x35, 0xd3, 0x14, 0xd3, 0x15, 0x01, 0xd2, 0xf4, 0x80, 0xd2, 0xf5, 0x02, 0xd2, 0xd4, 0x80, 0xd2, 0xb4, 0x01, 0xca, 0xb4, 0x80, 0xca, 0x94, 0x02, 0xca, 0x74, 0x8e, 0xca, 0x54, 0x20, 0xfd, 0x00, 0x9f, 0x00, 0x7f, 0x00, 0x5f, 0x00, 0x3f, 0x10, 0x5d, 0xc0, 0xb1, 0xc0, 0xd1, 0x02, 0x9f, 0x03, 0xbf, 0x04, 0xdf, 0x05, 0xff, 0x06, 0xff, 0x07, 0xbf, 0x04, 0x07, 0xff, 0x80, 0x54, 0xd9, 0x01, 0xb8, 0xd1, 0x80, 0xb8, 0xb1, 0x03, 0xb8, 0xd1, 0x82, 0x78, 0xf1, 0x39, 0x11, 0x38, 0xf0, 0x01, 0x30, 0xf0, 0x01, 0x28, 0xcf, 0x82, 0x28, 0xce, 0x20, 0xcf, 0x20, 0xce, 0x02, 0x20, 0xae, 0x81, 0x20, 0xad, 0x18, 0xad, 0x01, 0x20, 0xad, 0x12, 0x18, 0xad,
+  0x03, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xad, 0x01, 0x18, 0xae, 0x74, 0x18, 0xad, 0x86, 0x20, 0xae, 0x18, 0xad, 0x20, 0xad, 0x20, 0xae, 0x61, 0xd0, 0xbb, 0x14, 0x41, 0x2f, 0x01, 0x20, 0xae, 0x81, 0x20, 0xce, 0x20, 0xae, 0x01, 0x20, 0xce, 0x82, 0x28, 0xce, 0x20, 0xce, 0x20, 0xcf, 0x18, 0x28, 0xcf, 0x01, 0x28, 0xef, 0x86, 0x28, 0xcf, 0x28, 0xf0, 0x30, 0xd0, 0x28, 0xef, 0x28, 0xcf, 0x30, 0xcf, 0x30, 0xf0, 0x01, 0x30, 0xd0, 0x80, 0x28, 0xf0, 0x02, 0x30, 0xf0, 0x80, 0x30, 0xd0, 0x03, 0x30, 0xf0, 0x80, 0x38, 0xf0, 0x02, 0x39, 0x11, 0x88, 0x61, 0xb2, 0xd3, 0x75, 0xd3, 0x35, 0xd2, 0xf4, 0xca, 0xd4, 0xca, 0x74, 0xd2, 0x33, 0xca, 0x13, 0x1d, 0x9d, 0x01, 0x05, 0xff, 0x81, 0x1d, 0x3d, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x01, 0xb8, 0xd1, 0x81, 0xb0, 0xd1, 0x61, 0x32, 0x01, 0x49, 0x33, 0x81, 0x49, 0x32, 0x41, 0x32, 0x02, 0x41, 0x12, 0x81, 0x41, 0x32, 0x41, 0x12, 0x01, 0x41, 0x11, 0x01, 0x41, 0x12, 0x80, 0x41, 0x11, 0x01, 0x39, 0x11, 0x80, 0x41, 0x11, 0x01, 0x41, 0x12, 0x81, 0x39, 0x12, 0x41, 0x32, 0x02, 0x41, 0x12, 0x80, 0x49, 0x12, 0x01, 0x41, 0x32, 0x88, 0x49, 0x32, 0x49, 0x33, 0x49, 0x53, 0x49, 0x33, 0x61, 0x73, 0x8a, 0x14, 0xaa, 0x74, 0xca, 0xf4, 0xd2, 0xf5, 0x02, 0xd2, 0xd4, 0x89, 0xd2, 0xb4, 0xca, 0xb4, 0xd2, 0xb4, 0xd2, 0x94, 0xca, 0x94, 0xca, 0x73, 0xd2, 0x74, 0xd2, 0x53, 0xd2, 0x54, 0x59, 0x7a, 0x01, 0x00, 0xbf, 0x01, 0x00, 0x9f, 0x88, 0x00, 0x5f, 0xa8, 0xb3, 0xc0, 0xb1, 0x31, 0xfc, 0x03, 0x9f, 0x04, 0xdf, 0x05, 0xdf, 0x06, 0xdf, 0x07, 0xbf, 0x04, 0x07, 0xff, 0x80, 0x2e, 0x3c, 0x03, 0xb8, 0xd1, 0x80, 0xb8, 0xb1, 0x01, 0xb8, 0xd1, 0x81, 0x78, 0xf1, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x01, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x84, 0x20, 0xad, 0x20, 0xae, 0x18, 0xce, 0x18, 0xad, 0x20, 0xad, 0x03, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x0c, 0x18, 0xad,
+  0x04, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xaf, 0x08, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xaf, 0x63, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x87, 0x18, 0xae, 0x18, 0xad, 0x20, 0xae, 0x39, 0x0f, 0x28, 0xce, 0x20, 0xae, 0x20, 0xce, 0x20, 0xae, 0x0a, 0x20, 0xce, 0x1c, 0x28, 0xcf, 0x02, 0x28, 0xef, 0x80, 0x28, 0xcf, 0x01, 0x28, 0xef, 0x80, 0x30, 0xef, 0x01, 0x28, 0xef, 0x05, 0x30, 0xf0, 0x88, 0x39, 0x11, 0x71, 0xf2, 0xd3, 0x35, 0xd2, 0xf4, 0xd2, 0xb4, 0xca, 0x74, 0xd2, 0x33, 0xca, 0x13, 0xa2, 0x95, 0x02, 0x05, 0xff, 0x82, 0x53, 0x99, 0xc0, 0xd1, 0xc0, 0xb1, 0x01, 0xb8, 0xd1, 0x84, 0xb0, 0xd1, 0x79, 0x12, 0x49, 0x52, 0x41, 0x32, 0x41, 0x12, 0x02, 0x41, 0x32, 0x80, 0x41, 0x12, 0x03, 0x39, 0x11, 0x80, 0x38, 0xf1, 0x0b, 0x39, 0x11, 0x80, 0x41, 0x11, 0x03, 0x41, 0x12, 0x80, 0x41, 0x32, 0x01, 0x49, 0x32, 0x01, 0x49, 0x33, 0x86, 0x51, 0x33, 0x61, 0x94, 0x9a, 0x34, 0xc2, 0xb4, 0xd2, 0xb5, 0xd2, 0xb3, 0xca, 0xb4, 0x01, 0xd2, 0x94, 0x80, 0xca, 0x93, 0x01, 0xd2, 0x74, 0x83, 0xca, 0x53, 0xca, 0x54, 0xca, 0x53, 0x81, 0xd8, 0x02, 0x00, 0xdf, 0x01, 0x00, 0xbf, 0x87, 0x68, 0xb7, 0xb8, 0xd1, 0x31, 0xdc, 0x03, 0x3f, 0x04, 0x9f, 0x05, 0xdf, 0x06, 0xff, 0x07, 0xbf, 0x04, 0x07, 0xff, 0x80, 0x26, 0xbd, 0x03, 0xb8, 0xd1, 0x80, 0xb8, 0xd2, 0x01, 0xb8, 0xd1, 0x85, 0x78, 0xf1, 0x39, 0x11, 0x38, 0xf1, 0x30, 0xf0, 0x30, 0xef, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x01, 0x20, 0xce, 0x02, 0x20, 0xae, 0x02, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xae, 0x11, 0x18, 0xad,
+  0x03, 0x18, 0xad, 0x81, 0x18, 0xb0, 0x01, 0x18, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf6, 0x18, 0xae, 0x05, 0x18, 0xad, 0x85, 0x10, 0xcf, 0x00, 0xf8, 0x01, 0x19, 0x01, 0x1a, 0x00, 0xf6, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xae, 0x23, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x06, 0x18, 0xad, 0x80, 0x18, 0xae, 0x38, 0x18, 0xad, 0x03, 0x20, 0xae, 0x0b, 0x20, 0xce, 0x07, 0x20, 0xcf, 0x1b, 0x28, 0xcf, 0x80, 0x28, 0xef, 0x01, 0x28, 0xf0, 0x01, 0x30, 0xf0, 0x88, 0x38, 0xf0, 0x82, 0x13, 0xd2, 0xf5, 0xca, 0xd4, 0xd2, 0x74, 0xca, 0x53, 0xc9, 0xf3, 0xc9, 0xd2, 0x73, 0x98, 0x01, 0x05, 0xff, 0x81, 0x05, 0xdf, 0xa9, 0x53, 0x03, 0xb8, 0xd1, 0x80, 0x98, 0xf2, 0x01, 0x41, 0x32, 0x80, 0x41, 0x12, 0x01, 0x41, 0x11, 0x07, 0x39, 0x11, 0x03, 0x38, 0xf0, 0x80, 0x39, 0x11, 0x01, 0x38, 0xf0, 0x08, 0x39, 0x11, 0x02, 0x41, 0x12, 0x01, 0x41, 0x32, 0x02, 0x49, 0x33, 0x8d, 0x51, 0x53, 0x59, 0x74, 0x92, 0x14, 0xca, 0x94, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x74, 0xca, 0x74, 0xd2, 0x74, 0xca, 0x53, 0xca, 0x54, 0xca, 0x53, 0xca, 0x34, 0x99, 0xf6, 0x01, 0x01, 0x1f, 0x02, 0x00, 0xff, 0x87, 0x38, 0xdb, 0xc0, 0xb1, 0x28, 0xfc, 0x02, 0xdf, 0x04, 0x7f, 0x05, 0x9f, 0x06, 0xdf, 0x07, 0xbf, 0x05, 0x07, 0xff, 0x06, 0xb8, 0xd1, 0x82, 0x78, 0xf1, 0x39, 0x11, 0x38, 0xf0, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x14, 0x18, 0xad,
+  0x89, 0x18, 0xcd, 0x18, 0xad, 0x18, 0xae, 0x18, 0xb0, 0x01, 0x19, 0x00, 0xf9, 0x01, 0x19, 0x00, 0xf9, 0x01, 0x19, 0x08, 0xf6, 0x02, 0x18, 0xad, 0x83, 0x18, 0xae, 0x18, 0xad, 0x18, 0xd0, 0x00, 0xf9, 0x01, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x08, 0xf6, 0x2a, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0x18, 0xad, 0x84, 0x20, 0xad, 0x18, 0xad, 0x31, 0x0e, 0x7a, 0x32, 0xaa, 0xd3, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x03, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x68, 0xd3, 0x95, 0x91, 0xd3, 0x96, 0xd3, 0x95, 0xd3, 0x35, 0xd2, 0xb4, 0xca, 0x94, 0xca, 0x33, 0xd1, 0xf3, 0xc9, 0xd3, 0xc9, 0x93, 0xc9, 0x72, 0xc9, 0x92, 0xc9, 0x72, 0xc9, 0x32, 0xc0, 0xd1, 0xc0, 0xb1, 0xb8, 0xd1, 0xb0, 0xd2, 0xb9, 0xf2, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x0b, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0xd3, 0x96, 0x12, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x0a, 0xd3, 0x95, 0x81, 0xca, 0x13, 0x01, 0x5f, 0x02, 0x01, 0x3f, 0x88, 0x01, 0x1f, 0x09, 0x3f, 0xc0, 0xb1, 0x31, 0x1c, 0x01, 0xbf, 0x03, 0xff, 0x05, 0x9f, 0x06, 0x9f, 0x07, 0x9f, 0x05, 0x07, 0xff, 0x80, 0xb8, 0xb1, 0x05, 0xb8, 0xd1, 0x80, 0x78, 0xf1, 0x01, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x14, 0x18, 0xad,
+  0x82, 0x18, 0xad, 0x18, 0xae, 0x18, 0xb0, 0x04, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x81, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x83, 0x10, 0xcf, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1a, 0x03, 0x01, 0x19, 0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xae, 0x23, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x85, 0x20, 0xad, 0x18, 0xae, 0x20, 0xad, 0x18, 0xad, 0x49, 0x6f, 0xaa, 0xd3, 0x06, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x6e, 0xd3, 0x95, 0x8b, 0xd2, 0xf4, 0xca, 0x74, 0xca, 0x33, 0xca, 0x13, 0xc9, 0xd3, 0xc9, 0x92, 0xc9, 0x52, 0xc1, 0x11, 0xc0, 0xd1, 0xc0, 0xb1, 0xc0, 0xd1, 0xb8, 0xb1, 0x01, 0xb8, 0xd1, 0x80, 0xca, 0x53, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x08, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x03, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x1e, 0xd3, 0x95, 0x84, 0xca, 0x13, 0x09, 0x7f, 0x01, 0x7f, 0x01, 0x5f, 0x01, 0x7f, 0x01, 0x01, 0x5f, 0x86, 0x88, 0xf5, 0x29, 0x3c, 0x01, 0x3f, 0x02, 0xdf, 0x05, 0x3e, 0x06, 0x7f, 0x07, 0x7f, 0x05, 0x07, 0xff, 0x80, 0x92, 0x34, 0x05, 0xb8, 0xd1, 0x80, 0x78, 0xf1, 0x01, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x14, 0x18, 0xad,
+  0x83, 0x18, 0xae, 0x10, 0xd0, 0x01, 0x18, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x83, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x1a, 0x02, 0x18, 0xad, 0x81, 0x18, 0xd0, 0x00, 0xf8, 0x03, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x80, 0x01, 0x19, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x20, 0x18, 0xad, 0x80, 0x18, 0xae, 0x05, 0x18, 0xad, 0x82, 0x20, 0xee, 0x82, 0x52, 0xd3, 0x96, 0x0a, 0xd3, 0x95, 0x80, 0xd3, 0xb5, 0x6b, 0xd3, 0x95, 0x87, 0xd2, 0xb4, 0xd2, 0x33, 0xca, 0x13, 0xc9, 0xb3, 0xc9, 0x92, 0xc9, 0x52, 0xc9, 0x12, 0xc8, 0xd1, 0x01, 0xc0, 0xb1, 0x80, 0xb8, 0xb1, 0x01, 0xb8, 0xd1, 0x80, 0xc2, 0x53, 0x13, 0xd3, 0x95, 0x80, 0xdb, 0x95, 0x15, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x08, 0xd3, 0x95, 0x82, 0xca, 0x13, 0x31, 0xbc, 0x01, 0xbf, 0x03, 0x01, 0x9f, 0x87, 0x51, 0x39, 0x31, 0x5c, 0x01, 0x7f, 0x01, 0xbf, 0x04, 0x5e, 0x06, 0x3e, 0x07, 0x7f, 0x07, 0xfe, 0x04, 0x07, 0xff, 0x80, 0x8a, 0x95, 0x03, 0xb8, 0xd1, 0x82, 0xb0, 0xd1, 0xb8, 0xd1, 0x78, 0xf1, 0x01, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x14, 0x18, 0xad,
+  0x81, 0x10, 0xd0, 0x01, 0x18, 0x06, 0x01, 0x19, 0x80, 0x08, 0xf5, 0x01, 0x18, 0xad, 0x81, 0x10, 0xd0, 0x00, 0xf9, 0x01, 0x01, 0x19, 0x80, 0x00, 0xfa, 0x01, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x01, 0x19, 0x08, 0xf5, 0x26, 0x18, 0xad, 0x82, 0x20, 0xae, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xad, 0x81, 0x28, 0xee, 0xb3, 0x14, 0x04, 0xd3, 0x95, 0x83, 0xd4, 0xf8, 0xd6, 0x5c, 0xd6, 0xdd, 0xd6, 0xfd, 0x01, 0xd7, 0xff, 0x80, 0xdf, 0xff, 0x01, 0xd7, 0xff, 0x80, 0xdf, 0xff, 0x68, 0xd7, 0xff, 0x88, 0xdf, 0xff, 0xd7, 0xff, 0xcb, 0x15, 0xca, 0x13, 0xc9, 0xd3, 0xc9, 0x92, 0xc9, 0x32, 0xc9, 0x11, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x02, 0xb8, 0xd1, 0x80, 0xc3, 0x97, 0x09, 0xdf, 0xff, 0x06, 0xd7, 0xff, 0x81, 0xdf, 0xff, 0xd5, 0x39, 0x19, 0xd3, 0x95, 0x80, 0xdb, 0x95, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x81, 0xc9, 0xf3, 0x31, 0xfc, 0x04, 0x01, 0xdf, 0x81, 0x01, 0xbf, 0x01, 0xdf, 0x01, 0x01, 0xbf, 0x82, 0x02, 0xdf, 0x05, 0xfd, 0x07, 0x3e, 0x01, 0x07, 0xfe, 0x03, 0x07, 0xff, 0x80, 0x8a, 0xb5, 0x03, 0xb8, 0xd1, 0x82, 0xb0, 0xf1, 0xb8, 0xd1, 0x78, 0xf1, 0x01, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x14, 0x18, 0xad,
+  0x80, 0x00, 0xf9, 0x05, 0x01, 0x19, 0x88, 0x01, 0x1a, 0x00, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x10, 0xd0, 0x00, 0xf8, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x02, 0x18, 0xae, 0x25, 0x18, 0xad, 0x84, 0x20, 0xad, 0x18, 0xae, 0x28, 0xee, 0xcb, 0x55, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x82, 0xd3, 0xd6, 0xd5, 0xdb, 0xd7, 0xbf, 0x72, 0xd7, 0xff, 0x01, 0xdf, 0xff, 0x8d, 0xca, 0x13, 0xc9, 0xb3, 0xc9, 0x92, 0xc9, 0x52, 0xc9, 0x12, 0xc0, 0xd1, 0xc0, 0xb1, 0xc0, 0xd1, 0xb8, 0xb1, 0xb8, 0xd1, 0xb0, 0xf1, 0xba, 0x95, 0xdf, 0xff, 0xd7, 0xff, 0x04, 0xdf, 0xff, 0x80, 0xd7, 0xff, 0x04, 0xdf, 0xff, 0x05, 0xd7, 0xff, 0x81, 0xdf, 0xff, 0xd5, 0x39, 0x21, 0xd3, 0x95, 0x82, 0xc9, 0xf3, 0x31, 0xfd, 0x02, 0x1f, 0x06, 0x01, 0xff, 0x85, 0x01, 0xdf, 0x01, 0xff, 0x05, 0x1d, 0x07, 0x1d, 0x07, 0xfd, 0x07, 0xfe, 0x03, 0x07, 0xff, 0x80, 0x6b, 0xf7, 0x04, 0xb8, 0xd1, 0x81, 0xb0, 0xd1, 0x78, 0xf1, 0x01, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x14, 0x18, 0xad,
+  0x04, 0x01, 0x19, 0x85, 0x01, 0x1a, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x18, 0xcf, 0x03, 0x01, 0x19, 0x81, 0x01, 0x1a, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x2a, 0x18, 0xad, 0x81, 0x28, 0xee, 0xb3, 0x14, 0x02, 0xd3, 0x95, 0x81, 0xd4, 0x77, 0xd7, 0x7e, 0x01, 0xd7, 0xff, 0x80, 0xdf, 0xff, 0x03, 0xd7, 0xff, 0x80, 0xdf, 0xff, 0x6e, 0xd7, 0xff, 0x84, 0xc9, 0xd3, 0xc9, 0x92, 0xc9, 0x52, 0xc9, 0x12, 0xc8, 0xd1, 0x01, 0xc0, 0xb1, 0x01, 0xb8, 0xd1, 0x82, 0xb0, 0xd1, 0xb1, 0x52, 0xd7, 0x9e, 0x02, 0xdf, 0xff, 0x80, 0xd7, 0xff, 0x03, 0xdf, 0xff, 0x81, 0xd7, 0xff, 0xdf, 0xff, 0x0a, 0xd7, 0xff, 0x80, 0xd5, 0x39, 0x20, 0xd3, 0x95, 0x81, 0xc9, 0xd3, 0x32, 0x3c, 0x01, 0x02, 0x3f, 0x80, 0x02, 0x1f, 0x01, 0x02, 0x3f, 0x04, 0x02, 0x1f, 0x81, 0x03, 0x7e, 0x06, 0xdc, 0x01, 0x07, 0xfd, 0x80, 0x07, 0xfe, 0x02, 0x07, 0xff, 0x80, 0x5c, 0x78, 0x02, 0xb8, 0xd1, 0x83, 0xb0, 0xd1, 0xb8, 0xd1, 0xb0, 0xf1, 0x79, 0x11, 0x01, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x14, 0x18, 0xad,
+  0x81, 0x01, 0x1a, 0x00, 0xf9, 0x02, 0x01, 0x19, 0x85, 0x01, 0x1a, 0x01, 0x17, 0x18, 0xae, 0x18, 0xad, 0x10, 0xd0, 0x00, 0xf9, 0x06, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x01, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x20, 0xae, 0x01, 0x18, 0xad, 0x80, 0x18, 0xae, 0x1f, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x82, 0x52, 0x01, 0xd3, 0x95, 0x82, 0xd3, 0x96, 0xd4, 0xb8, 0xd7, 0xbf, 0x77, 0xd7, 0xff, 0x83, 0xc9, 0x72, 0xc9, 0x52, 0xc9, 0x12, 0xc8, 0xd1, 0x01, 0xc0, 0xb1, 0x02, 0xb8, 0xd1, 0x81, 0xb0, 0xf1, 0xd6, 0x3c, 0x01, 0xdf, 0xff, 0x80, 0xd7, 0xff, 0x01, 0xdf, 0xff, 0x80, 0xd7, 0xff, 0x01, 0xdf, 0xff, 0x01, 0xd7, 0xff, 0x80, 0xdf, 0xff, 0x08, 0xd7, 0xff, 0x83, 0xdf, 0xff, 0xd7, 0xff, 0xdf, 0xff, 0xd5, 0x39, 0x14, 0xd3, 0x95, 0x01, 0xd3, 0x96, 0x08, 0xd3, 0x95, 0x82, 0xc9, 0xd3, 0x32, 0x5c, 0x02, 0x7f, 0x02, 0x02, 0x5f, 0x80, 0x02, 0x3f, 0x01, 0x02, 0x5f, 0x02, 0x02, 0x3f, 0x81, 0x02, 0x9f, 0x06, 0x7c, 0x01, 0x07, 0xfc, 0x80, 0x07, 0xfe, 0x02, 0x07, 0xff, 0x83, 0x5c, 0x78, 0xb8, 0xd1, 0xb0, 0xd1, 0xb8, 0xd1, 0x01, 0xb0, 0xd1, 0x81, 0xb8, 0xd1, 0x70, 0xf1, 0x01, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x14, 0x18, 0xad,
+  0x81, 0x01, 0x19, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x83, 0x00, 0xf7, 0x18, 0xae, 0x18, 0xad, 0x10, 0xcf, 0x01, 0x01, 0x19, 0x01, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x00, 0xf7, 0x18, 0xce, 0x2b, 0x18, 0xad, 0x80, 0x49, 0x6f, 0x02, 0xd3, 0x95, 0x81, 0xd4, 0x57, 0xd7, 0xbf, 0x73, 0xd7, 0xff, 0x87, 0xd7, 0xdf, 0xd7, 0xff, 0xcf, 0x3e, 0xc6, 0x7c, 0xc5, 0x3a, 0xc9, 0x51, 0xc9, 0x12, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x01, 0xb8, 0xd1, 0x82, 0xb0, 0xd1, 0xb0, 0xf1, 0xbb, 0x97, 0x18, 0xd7, 0xff, 0x82, 0xd6, 0x5b, 0xd3, 0x95, 0xd3, 0x96, 0x17, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x83, 0xd3, 0x96, 0xd3, 0x95, 0xc9, 0xb3, 0x32, 0x7c, 0x03, 0x02, 0x9f, 0x04, 0x02, 0x7f, 0x85, 0x02, 0x5f, 0x02, 0x7f, 0x05, 0xbc, 0x07, 0xdb, 0x07, 0xfc, 0x07, 0xfd, 0x02, 0x07, 0xff, 0x82, 0x5c, 0x78, 0xb8, 0xd1, 0xb0, 0xd1, 0x02, 0xb8, 0xd1, 0x84, 0xb0, 0xd1, 0x58, 0xf1, 0x39, 0x11, 0x31, 0x11, 0x30, 0xf0, 0x01, 0x28, 0xf0, 0x81, 0x28, 0xcf, 0x28, 0xce, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x14, 0x18, 0xad,
+  0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x87, 0x01, 0x1a, 0x01, 0x17, 0x18, 0xce, 0x18, 0xae, 0x18, 0xd0, 0x01, 0x18, 0x00, 0xf9, 0x01, 0x1a, 0x04, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xae, 0x2b, 0x18, 0xad, 0x81, 0x20, 0xae, 0xa2, 0xd3, 0x01, 0xd3, 0x95, 0x81, 0xd3, 0xd6, 0xd7, 0x5e, 0x01, 0xcf, 0xff, 0x01, 0xd7, 0xff, 0x01, 0xcf, 0xff, 0x01, 0xd7, 0xff, 0x80, 0xd7, 0xdf, 0x02, 0xd7, 0xff, 0x80, 0xd7, 0xdf, 0x01, 0xd7, 0xff, 0x8a, 0xcf, 0xdf, 0xcf, 0xff, 0xd7, 0xff, 0xd7, 0xdf, 0xd7, 0xff, 0xcf, 0xff, 0xd7, 0xff, 0xd7, 0xdf, 0xd7, 0xff, 0xcf, 0xff, 0xd7, 0xdf, 0x01, 0xcf, 0xff, 0x01, 0xd7, 0xff, 0x83, 0xcf, 0xff, 0xd7, 0xff, 0xcf, 0xff, 0xd7, 0xff, 0x01, 0xd7, 0xdf, 0x82, 0xcf, 0xff, 0xd7, 0xdf, 0xcf, 0xff, 0x01, 0xd7, 0xff, 0x84, 0xcf, 0xff, 0xd7, 0xff, 0xcf, 0xff, 0xd7, 0xff, 0xd7, 0xdf, 0x01, 0xd7, 0xff, 0x01, 0xcf, 0xff, 0x85, 0xd7, 0xff, 0xcf, 0xff, 0xd7, 0xdf, 0xcf, 0xff, 0xd7, 0xff, 0xd7, 0xdf, 0x37, 0xd7, 0xff, 0x89, 0xcf, 0xff, 0xd7, 0xff, 0xcf, 0xdf, 0xd7, 0xdf, 0xcf, 0xdf, 0xcf, 0xff, 0xd7, 0xdf, 0xac, 0xd8, 0x81, 0x91, 0x91, 0x51, 0x02, 0x99, 0x31, 0x80, 0x99, 0x11, 0x02, 0x99, 0x31, 0x82, 0xa8, 0xf1, 0xa9, 0x72, 0xd7, 0x7e, 0x01, 0xd7, 0xff, 0x01, 0xd7, 0xdf, 0x02, 0xd7, 0xff, 0x81, 0xd7, 0xdf, 0xcf, 0xff, 0x05, 0xd7, 0xff, 0x01, 0xd7, 0xdf, 0x03, 0xd7, 0xff, 0x85, 0xd7, 0xdf, 0xd7, 0xff, 0xd7, 0xdf, 0xd7, 0xff, 0xd7, 0xdf, 0xd6, 0x5c, 0x1d, 0xd3, 0x95, 0x83, 0xc1, 0x93, 0x0a, 0x7f, 0x02, 0xff, 0x02, 0xdf, 0x02, 0x02, 0xbf, 0x02, 0x02, 0x9f, 0x86, 0x02, 0x7f, 0x02, 0x9f, 0x02, 0x7f, 0x04, 0xdd, 0x07, 0xbb, 0x07, 0xfb, 0x07, 0xfd, 0x02, 0x07, 0xff, 0x80, 0x3d, 0xbb, 0x01, 0xb8, 0xd1, 0x80, 0xb0, 0xf1, 0x02, 0xb0, 0xd1, 0x81, 0x59, 0x11, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x80, 0x28, 0xf0, 0x01, 0x28, 0xcf, 0x80, 0x20, 0xcf, 0x03, 0x20, 0xce, 0x02, 0x20, 0xae, 0x14, 0x18, 0xad,
+  0x87, 0x00, 0xf9, 0x01, 0x19, 0x01, 0x1a, 0x00, 0xf7, 0x18, 0xae, 0x18, 0xad, 0x18, 0xaf, 0x01, 0x18, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x01, 0x17, 0x18, 0xae, 0x2c, 0x18, 0xad, 0x81, 0x31, 0x0e, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x80, 0xd5, 0xba, 0x0f, 0xcf, 0xdf, 0x88, 0xc7, 0x7e, 0xbe, 0x5b, 0xbe, 0x3c, 0xb5, 0x7a, 0xac, 0xb8, 0xbd, 0xbb, 0xc6, 0x3c, 0xbe, 0x3b, 0xc7, 0x1e, 0x0b, 0xcf, 0xdf, 0x88, 0xc7, 0x7e, 0xbe, 0x5c, 0xb5, 0xdb, 0xac, 0xb8, 0xac, 0x98, 0xbd, 0x5a, 0xbe, 0x3c, 0xc6, 0x1c, 0xc6, 0x9d, 0x49, 0xcf, 0xdf, 0x83, 0xac, 0xb9, 0x81, 0x91, 0x91, 0x51, 0x99, 0x11, 0x03, 0x99, 0x31, 0x83, 0x99, 0x11, 0xa1, 0x11, 0xa9, 0x11, 0xbc, 0x78, 0x02, 0xcf, 0xdf, 0x82, 0xd7, 0xdf, 0xcf, 0xdf, 0xcf, 0x5e, 0x01, 0xbe, 0x5c, 0x82, 0xc6, 0x3c, 0xc6, 0x1c, 0xce, 0xfd, 0x0e, 0xcf, 0xdf, 0x86, 0xcf, 0xff, 0xcf, 0xdf, 0xd6, 0x3b, 0xd3, 0x75, 0xd3, 0x95, 0xd3, 0x75, 0xd3, 0x95, 0x13, 0xd3, 0x75, 0x80, 0xd3, 0x95, 0x02, 0xd3, 0x75, 0x83, 0xd3, 0x95, 0x08, 0x9f, 0x01, 0x1f, 0x03, 0x1f, 0x01, 0x02, 0xff, 0x02, 0x02, 0xdf, 0x04, 0x02, 0xbf, 0x84, 0x03, 0xfd, 0x07, 0x9a, 0x07, 0xfa, 0x07, 0xfc, 0x07, 0xfe, 0x01, 0x07, 0xff, 0x81, 0x2e, 0x5c, 0xb0, 0xd1, 0x01, 0xb8, 0xd1, 0x88, 0xb0, 0xf1, 0xb0, 0xd1, 0xb8, 0xd1, 0x59, 0x12, 0x39, 0x11, 0x38, 0xf1, 0x30, 0xf0, 0x28, 0xf0, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x01, 0x20, 0xae, 0x15, 0x18, 0xad,
+  0x01, 0x01, 0x19, 0x81, 0x01, 0x17, 0x18, 0xce, 0x01, 0x18, 0xad, 0x81, 0x01, 0x18, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x02, 0x01, 0x19, 0x81, 0x01, 0x17, 0x18, 0xae, 0x2d, 0x18, 0xad, 0x80, 0x79, 0xf1, 0x02, 0xd3, 0x55, 0x83, 0xcf, 0x7e, 0xc7, 0xdf, 0xcf, 0xbf, 0xcf, 0xdf, 0x01, 0xc7, 0xdf, 0x03, 0xcf, 0xdf, 0x80, 0xcf, 0xbf, 0x01, 0xcf, 0xdf, 0x85, 0xcf, 0xbf, 0xbe, 0xfd, 0xac, 0xb8, 0x8a, 0x52, 0x91, 0x51, 0x91, 0x31, 0x05, 0x99, 0x31, 0x8e, 0x99, 0x11, 0xa1, 0x92, 0xab, 0x96, 0xbe, 0x7d, 0xcf, 0xdf, 0xc7, 0xdf, 0xcf, 0xbf, 0xc7, 0xdf, 0xcf, 0xdf, 0xcf, 0xbf, 0xc7, 0x5e, 0xad, 0x19, 0x92, 0xb4, 0x89, 0x71, 0x91, 0x51, 0x01, 0x99, 0x31, 0x01, 0x99, 0x11, 0x87, 0xa1, 0x11, 0x99, 0x31, 0xa1, 0x11, 0x99, 0x11, 0xab, 0x36, 0xbd, 0x5a, 0xc7, 0x5e, 0xcf, 0xdf, 0x01, 0xc7, 0xbf, 0x83, 0xcf, 0xdf, 0xc7, 0xdf, 0xc7, 0xbf, 0xc7, 0xdf, 0x38, 0xcf, 0xdf, 0x8a, 0xc7, 0xdf, 0xcf, 0xbf, 0xc7, 0xdf, 0xc7, 0xbf, 0xcf, 0xbf, 0xc7, 0xdf, 0xa4, 0xb8, 0x81, 0x91, 0x91, 0x51, 0x99, 0x31, 0x99, 0x11, 0x01, 0x99, 0x31, 0x86, 0x99, 0x11, 0x99, 0x31, 0x99, 0x12, 0xbe, 0x3b, 0xcf, 0xbf, 0xcf, 0xdf, 0xcf, 0xbf, 0x01, 0xcf, 0xdf, 0x82, 0xb5, 0xda, 0x8a, 0x12, 0x89, 0x71, 0x01, 0x99, 0x31, 0x85, 0xa1, 0x11, 0x99, 0x31, 0xab, 0x35, 0xc7, 0x5e, 0xcf, 0xbf, 0xcf, 0xdf, 0x01, 0xc7, 0xdf, 0x01, 0xcf, 0xdf, 0x80, 0xcf, 0xbf, 0x01, 0xc7, 0xdf, 0x02, 0xcf, 0xdf, 0x80, 0xc7, 0xdf, 0x02, 0xcf, 0xdf, 0x80, 0xce, 0x1b, 0x1b, 0xd3, 0x55, 0x83, 0x00, 0x7f, 0x00, 0x9e, 0x02, 0x3f, 0x03, 0x3f, 0x02, 0x03, 0x1f, 0x82, 0x02, 0xff, 0x03, 0x1f, 0x02, 0xff, 0x02, 0x02, 0xdf, 0x84, 0x03, 0x9e, 0x07, 0x5a, 0x07, 0xf9, 0x07, 0xfb, 0x07, 0xfd, 0x01, 0x07, 0xff, 0x84, 0x2e, 0x3c, 0xb8, 0xd2, 0xb8, 0xd1, 0xb0, 0xd1, 0xb8, 0xd1, 0x01, 0xb0, 0xd1, 0x87, 0x49, 0x11, 0x39, 0x11, 0x38, 0xf0, 0x30, 0xf0, 0x28, 0xf0, 0x28, 0xef, 0x28, 0xcf, 0x28, 0xce, 0x02, 0x20, 0xce, 0x02, 0x20, 0xae, 0x15, 0x18, 0xad,
+  0x85, 0x01, 0x1a, 0x00, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x18, 0xae, 0x18, 0xad, 0x02, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x01, 0x01, 0x19, 0x82, 0x01, 0x1a, 0x00, 0xf7, 0x18, 0xae, 0x2d, 0x18, 0xad, 0x81, 0x20, 0xad, 0xa2, 0x93, 0x01, 0xd3, 0x35, 0x82, 0xcc, 0x98, 0xc7, 0xbf, 0xc7, 0xbe, 0x09, 0xc7, 0xbf, 0x85, 0xc7, 0x5e, 0xa4, 0xb8, 0x81, 0x91, 0x91, 0x51, 0x99, 0x11, 0xa1, 0x31, 0x01, 0xa1, 0x11, 0x82, 0x99, 0x31, 0xa1, 0x11, 0xa1, 0x12, 0x05, 0xa1, 0x11, 0x89, 0xab, 0x35, 0xbe, 0xfe, 0xc7, 0xbf, 0xc7, 0xbe, 0xc7, 0xbf, 0xb5, 0xdb, 0x89, 0xf1, 0x89, 0x71, 0x99, 0x31, 0x99, 0x11, 0x04, 0xa1, 0x11, 0x81, 0xa1, 0x32, 0x99, 0x11, 0x03, 0xa1, 0x11, 0x82, 0xa1, 0x72, 0xbd, 0x3a, 0xc7, 0xbe, 0x02, 0xc7, 0xbf, 0x81, 0xc7, 0xbe, 0xc7, 0x9f, 0x37, 0xc7, 0xbf, 0x80, 0xc7, 0x9f, 0x05, 0xc7, 0xbf, 0x8b, 0xac, 0x98, 0x81, 0x91, 0x91, 0x51, 0x99, 0x31, 0xa1, 0x11, 0xa1, 0x31, 0xa1, 0x11, 0xa1, 0x31, 0xa1, 0x11, 0x99, 0x31, 0xbe, 0x1b, 0xc7, 0x9f, 0x02, 0xc7, 0xbf, 0x85, 0xbe, 0xfd, 0x89, 0xf2, 0x89, 0x91, 0x99, 0x31, 0xa1, 0x12, 0xa1, 0x31, 0x02, 0xa1, 0x11, 0x80, 0xab, 0x97, 0x01, 0xc7, 0xbf, 0x80, 0xc7, 0xbe, 0x0d, 0xc7, 0xbf, 0x81, 0xc6, 0xdd, 0xd3, 0x75, 0x16, 0xd3, 0x35, 0x80, 0xd3, 0x34, 0x01, 0xd3, 0x35, 0x01, 0x00, 0x9f, 0x84, 0x01, 0x3f, 0x03, 0x3f, 0x03, 0x7f, 0x03, 0x5f, 0x03, 0x3f, 0x03, 0x03, 0x1f, 0x01, 0x02, 0xff, 0x84, 0x03, 0x3f, 0x06, 0xf9, 0x07, 0xf9, 0x07, 0xfb, 0x07, 0xfd, 0x01, 0x07, 0xff, 0x86, 0x2e, 0x3c, 0xb8, 0xd2, 0xb0, 0xf1, 0xb8, 0xd1, 0xb0, 0xd1, 0xb0, 0xf1, 0xb0, 0xd1, 0x01, 0x39, 0x11, 0x82, 0x38, 0xf0, 0x30, 0xf0, 0x31, 0x10, 0x01, 0x28, 0xcf, 0x80, 0x20, 0xcf, 0x02, 0x20, 0xce, 0x82, 0x20, 0xae, 0x20, 0xad, 0x20, 0xae, 0x15, 0x18, 0xad,
+  0x81, 0x00, 0xf7, 0x18, 0xce, 0x03, 0x18, 0xad, 0x80, 0x00, 0xf9, 0x01, 0x01, 0x19, 0x84, 0x01, 0x39, 0x01, 0x19, 0x01, 0x1a, 0x00, 0xf7, 0x18, 0xae, 0x03, 0x18, 0xad, 0x81, 0x20, 0xcd, 0x18, 0xae, 0x28, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0xd3, 0x15, 0x83, 0xd3, 0x14, 0xc5, 0xfb, 0xc7, 0x9f, 0xc7, 0x9e, 0x01, 0xc7, 0xbf, 0x01, 0xc7, 0x9e, 0x89, 0xc7, 0xbf, 0xc7, 0x9f, 0xbf, 0x9e, 0xbf, 0xbf, 0xbf, 0xbe, 0xb6, 0x7c, 0x8a, 0x53, 0x89, 0x71, 0xa1, 0x31, 0xa1, 0x12, 0x0a, 0xa1, 0x11, 0x80, 0xa1, 0x12, 0x01, 0xa1, 0x11, 0x85, 0xa1, 0x72, 0xb5, 0x39, 0xbf, 0x9f, 0x9b, 0xf6, 0x81, 0x91, 0x91, 0x51, 0x0c, 0xa1, 0x11, 0x80, 0xa1, 0x12, 0x01, 0xa1, 0x11, 0x83, 0xab, 0x15, 0xbf, 0x3d, 0xc7, 0x9f, 0xc7, 0xbe, 0x01, 0xc7, 0x9f, 0x37, 0xc7, 0x9e, 0x82, 0xc7, 0x9f, 0xc7, 0x9e, 0xc7, 0x9f, 0x01, 0xc7, 0x9e, 0x84, 0xc7, 0xbf, 0xc7, 0x9f, 0xa4, 0xb8, 0x81, 0x91, 0x91, 0x51, 0x04, 0xa1, 0x11, 0x89, 0xa1, 0x12, 0xa1, 0x11, 0xbd, 0xfb, 0xc7, 0x9f, 0xc7, 0x9e, 0xc7, 0xbe, 0xc7, 0x9f, 0xac, 0xf9, 0x81, 0x91, 0x91, 0x71, 0x02, 0xa1, 0x11, 0x85, 0xa1, 0x12, 0xa1, 0x11, 0xa1, 0x31, 0xa1, 0x11, 0xbf, 0x3e, 0xbf, 0xbf, 0x02, 0xc7, 0x9e, 0x80, 0xc7, 0xbf, 0x02, 0xc7, 0x9e, 0x80, 0xbf, 0xbf, 0x02, 0xc7, 0x9e, 0x89, 0xbf, 0x9e, 0xc7, 0x9f, 0xc7, 0x9e, 0xbf, 0xbe, 0xc7, 0x9e, 0xc6, 0xbd, 0xd3, 0x55, 0xd2, 0xf5, 0xd3, 0x15, 0xcb, 0x14, 0x11, 0xd3, 0x14, 0x02, 0xd3, 0x15, 0x80, 0xd3, 0x14, 0x01, 0x00, 0x7f, 0x81, 0x00, 0xff, 0x02, 0x7f, 0x01, 0x03, 0x9f, 0x83, 0x03, 0x7f, 0x23, 0x1d, 0x52, 0x59, 0x5a, 0x3a, 0x01, 0x03, 0x3f, 0x01, 0x03, 0x1f, 0x83, 0x06, 0x99, 0x07, 0xf8, 0x07, 0xfa, 0x07, 0xfd, 0x01, 0x07, 0xff, 0x84, 0x36, 0x3c, 0xb0, 0xd1, 0xb0, 0xf1, 0xb0, 0xd1, 0xb8, 0xd1, 0x01, 0xb0, 0xd1, 0x85, 0x41, 0x12, 0x38, 0xf1, 0x39, 0x11, 0x30, 0xf0, 0x30, 0xef, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x82, 0x20, 0xae, 0x20, 0xad, 0x20, 0xae, 0x15, 0x18, 0xad,
+  0x82, 0x18, 0xae, 0x18, 0xad, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x82, 0x20, 0xad, 0x09, 0x15, 0x00, 0xf9, 0x02, 0x01, 0x19, 0x81, 0x00, 0xf7, 0x18, 0xce, 0x03, 0x18, 0xad, 0x82, 0x20, 0xcd, 0x18, 0xad, 0x18, 0xcd, 0x29, 0x18, 0xad, 0x83, 0xd2, 0xf4, 0xca, 0xf4, 0xd2, 0xf4, 0xc6, 0x5c, 0x08, 0xbf, 0x9e, 0x83, 0xbf, 0x7f, 0xb6, 0x7c, 0x8a, 0x12, 0x89, 0x71, 0x01, 0xa1, 0x11, 0x82, 0xa9, 0x11, 0xa1, 0x11, 0xa9, 0x11, 0x02, 0xa1, 0x11, 0x01, 0xa9, 0x11, 0x02, 0xa1, 0x11, 0x80, 0xa9, 0x11, 0x02, 0xa1, 0x11, 0x84, 0xa9, 0x12, 0xa9, 0x11, 0xa1, 0xf3, 0x81, 0x91, 0x99, 0x31, 0x01, 0xa1, 0x11, 0x80, 0xa9, 0x12, 0x04, 0xa1, 0x11, 0x04, 0xa9, 0x11, 0x02, 0xa1, 0x11, 0x83, 0xa1, 0x12, 0xa9, 0x11, 0xaa, 0x54, 0xbf, 0x1d, 0x3f, 0xbf, 0x9e, 0x85, 0xb7, 0x9e, 0xbf, 0x9f, 0xa4, 0x98, 0x81, 0x91, 0x99, 0x51, 0xa9, 0x11, 0x04, 0xa1, 0x11, 0x88, 0xa9, 0x11, 0xb5, 0xfb, 0xbf, 0x9e, 0xbf, 0x9f, 0xbf, 0x9e, 0xbf, 0x9f, 0xa4, 0x98, 0x81, 0x91, 0x99, 0x51, 0x03, 0xa1, 0x11, 0x84, 0xa1, 0x12, 0xa1, 0x11, 0xa9, 0x11, 0xb5, 0xfb, 0xbf, 0x7e, 0x01, 0xbf, 0x9e, 0x80, 0xbf, 0x9f, 0x0d, 0xbf, 0x9e, 0x82, 0xbe, 0xbd, 0xd3, 0x35, 0xca, 0xf4, 0x12, 0xd2, 0xf4, 0x83, 0xca, 0xf4, 0xd2, 0xf4, 0xd2, 0xf5, 0xca, 0xf4, 0x01, 0x00, 0x7f, 0x88, 0x00, 0xbf, 0x02, 0x1f, 0x2a, 0xbd, 0x7a, 0x36, 0xb9, 0x53, 0xc1, 0x12, 0xc9, 0x11, 0xc9, 0x12, 0x0b, 0x3f, 0x01, 0x03, 0x5f, 0x88, 0x03, 0x3f, 0x05, 0xfa, 0x07, 0xf7, 0x07, 0xf9, 0x07, 0xfc, 0x07, 0xfe, 0x07, 0xff, 0x2e, 0x3c, 0xb0, 0xd1, 0x01, 0xb0, 0xf1, 0x01, 0xb0, 0xd1, 0x82, 0xa0, 0xf1, 0x68, 0xf1, 0x41, 0x11, 0x01, 0x30, 0xf0, 0x01, 0x28, 0xef, 0x80, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x82, 0x20, 0xae, 0x18, 0xad, 0x20, 0xae, 0x15, 0x18, 0xad,
+  0x03, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xae, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x08, 0xf5, 0x18, 0xae, 0x04, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x2a, 0x18, 0xad, 0x02, 0xd2, 0xd4, 0x84, 0xbe, 0x5c, 0xb7, 0x7e, 0xb7, 0x9e, 0xb7, 0x7e, 0xbf, 0x7e, 0x02, 0xb7, 0x7e, 0x88, 0xb7, 0x9e, 0xbf, 0x7e, 0xae, 0x7b, 0x89, 0xf2, 0x89, 0x71, 0xa1, 0x11, 0xa8, 0xf1, 0xa9, 0x11, 0xa8, 0xf1, 0x04, 0xa9, 0x11, 0x80, 0xa8, 0xf1, 0x02, 0xa9, 0x11, 0x82, 0xa8, 0xf1, 0xa9, 0x11, 0xa8, 0xf1, 0x01, 0xa9, 0x11, 0x80, 0xa9, 0x12, 0x01, 0xa9, 0x11, 0x86, 0xa1, 0x11, 0xa9, 0x11, 0xa8, 0xf1, 0xa9, 0x11, 0xa8, 0xf1, 0xa1, 0x11, 0xa9, 0x11, 0x01, 0xa8, 0xf1, 0x01, 0xa9, 0x11, 0x81, 0xa8, 0xf1, 0xa9, 0x11, 0x01, 0xa8, 0xf1, 0x80, 0xa9, 0x12, 0x02, 0xa9, 0x11, 0x83, 0xa8, 0xf1, 0xa1, 0x11, 0xaa, 0x34, 0xb7, 0x1e, 0x39, 0xbf, 0x7e, 0x01, 0xb7, 0x7e, 0x80, 0xbf, 0x7e, 0x01, 0xb7, 0x7e, 0x84, 0xbf, 0x7f, 0xb7, 0x7e, 0x9c, 0x97, 0x81, 0x91, 0x99, 0x51, 0x04, 0xa8, 0xf1, 0x84, 0xa9, 0x11, 0xa8, 0xf1, 0xb5, 0xdb, 0xbf, 0x7e, 0xb7, 0x7e, 0x01, 0xbf, 0x7e, 0x83, 0xa4, 0x78, 0x81, 0x91, 0x99, 0x51, 0xa9, 0x11, 0x01, 0xa8, 0xf1, 0x01, 0xa9, 0x11, 0x84, 0xa8, 0xf1, 0xa9, 0x11, 0xb5, 0xdb, 0xb7, 0x7f, 0xb7, 0x7e, 0x01, 0xbf, 0x7e, 0x80, 0xb7, 0x7e, 0x02, 0xbf, 0x7e, 0x01, 0xb7, 0x7e, 0x83, 0xbf, 0x7e, 0xb7, 0x7e, 0xbf, 0x7e, 0xb7, 0x7e, 0x01, 0xbf, 0x7e, 0x01, 0xb7, 0x7e, 0x82, 0xbf, 0x7e, 0xbe, 0x9d, 0xcb, 0x75, 0x15, 0xd2, 0xd4, 0x80, 0xd2, 0xd5, 0x01, 0x00, 0x7f, 0x82, 0x30, 0xbb, 0x99, 0x55, 0xc9, 0x31, 0x01, 0xc9, 0x32, 0x83, 0xc9, 0x12, 0xc0, 0xf2, 0xc8, 0xf2, 0x32, 0xfc, 0x02, 0x03, 0x7f, 0x8f, 0x05, 0x9b, 0x07, 0xf7, 0x07, 0xf9, 0x07, 0xfc, 0x07, 0xfe, 0x07, 0xff, 0x2e, 0x3c, 0xb8, 0xd1, 0xb0, 0xd1, 0xb0, 0xd2, 0xb0, 0xd1, 0xb0, 0xf1, 0x98, 0xf1, 0xb0, 0xf1, 0x88, 0xf1, 0x31, 0x10, 0x01, 0x30, 0xf0, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xce, 0x02, 0x20, 0xce, 0x82, 0x20, 0xae, 0x18, 0xad, 0x20, 0xae, 0x15, 0x18, 0xad,
+  0x3d, 0x18, 0xad, 0x02, 0xd2, 0xb4, 0x08, 0xb7, 0x7e, 0x86, 0xb7, 0x1d, 0x8a, 0x53, 0x81, 0x91, 0xa1, 0x11, 0xa8, 0xf1, 0xb0, 0xf1, 0xa9, 0x11, 0x16, 0xa8, 0xf1, 0x82, 0xa8, 0xf2, 0xa8, 0xf1, 0xb0, 0xf1, 0x0d, 0xa8, 0xf1, 0x80, 0xb2, 0xf5, 0x04, 0xb7, 0x7e, 0x80, 0xb7, 0x5e, 0x02, 0xb7, 0x7e, 0x01, 0xb7, 0x5e, 0x81, 0xb7, 0x7e, 0xb7, 0x5e, 0x01, 0xb7, 0x7e, 0x80, 0xb7, 0x5e, 0x0c, 0xb7, 0x7e, 0x01, 0xb7, 0x5e, 0x14, 0xb7, 0x7e, 0x80, 0xb7, 0x5e, 0x01, 0xb7, 0x7e, 0x82, 0xb7, 0x5e, 0xb7, 0x7e, 0xb7, 0x5e, 0x06, 0xb7, 0x7e, 0x82, 0x9c, 0x78, 0x81, 0x91, 0x99, 0x51, 0x06, 0xa8, 0xf1, 0x80, 0xb5, 0xdb, 0x03, 0xb7, 0x7e, 0x82, 0x9c, 0x77, 0x81, 0x91, 0x91, 0x51, 0x06, 0xa8, 0xf1, 0x80, 0xb5, 0xdb, 0x02, 0xb7, 0x7e, 0x82, 0xb7, 0x5e, 0xb7, 0x7e, 0xb7, 0x5e, 0x06, 0xb7, 0x7e, 0x80, 0xb7, 0x5e, 0x04, 0xb7, 0x7e, 0x82, 0xb7, 0x5e, 0xb7, 0x1d, 0xcb, 0x96, 0x01, 0xd2, 0xb4, 0x86, 0xca, 0xb4, 0xd2, 0xb4, 0xca, 0xb4, 0xd2, 0xb4, 0xca, 0xb4, 0xd2, 0xb4, 0xca, 0xb4, 0x07, 0xd2, 0xb4, 0x80, 0xca, 0x94, 0x02, 0xd2, 0xb4, 0x87, 0xca, 0xb4, 0x08, 0x7e, 0x70, 0xf8, 0xc9, 0x52, 0xc9, 0x32, 0xc9, 0x12, 0xc9, 0x32, 0xc1, 0x11, 0x01, 0xc8, 0xf1, 0x82, 0xc8, 0xd1, 0x33, 0x1c, 0x03, 0xbf, 0x01, 0x03, 0x9f, 0x87, 0x05, 0x1b, 0x07, 0xd6, 0x07, 0xf7, 0x07, 0xfb, 0x07, 0xfe, 0x07, 0xff, 0x2e, 0x3c, 0xb8, 0xd1, 0x03, 0xb0, 0xd1, 0x85, 0xa0, 0xf1, 0xb0, 0xf1, 0xb0, 0xd1, 0x50, 0xf0, 0x30, 0xf0, 0x30, 0xef, 0x01, 0x28, 0xcf, 0x80, 0x20, 0xcf, 0x01, 0x20, 0xce, 0x01, 0x20, 0xae, 0x17, 0x18, 0xad,
+  0x3d, 0x18, 0xad, 0x01, 0xd2, 0x94, 0x80, 0xca, 0x94, 0x04, 0xaf, 0x5e, 0x80, 0xb7, 0x5e, 0x01, 0xaf, 0x5e, 0x89, 0xb7, 0x5e, 0x94, 0x16, 0x89, 0x91, 0x99, 0x51, 0xb0, 0xf1, 0xa8, 0xf1, 0xb0, 0xf1, 0xa8, 0xf1, 0xb0, 0xf1, 0xa8, 0xf1, 0x02, 0xb0, 0xf1, 0x80, 0xa8, 0xf1, 0x09, 0xb0, 0xf1, 0x01, 0xa8, 0xf1, 0x81, 0xb0, 0xf1, 0xa8, 0xf1, 0x02, 0xb0, 0xf1, 0x80, 0xb0, 0xd1, 0x01, 0xb0, 0xf1, 0x81, 0xb0, 0xf2, 0xa8, 0xf1, 0x01, 0xb0, 0xf1, 0x84, 0xb0, 0xd1, 0xb0, 0xf1, 0xb0, 0xf2, 0xa8, 0xf1, 0xb0, 0xf2, 0x02, 0xb0, 0xf1, 0x80, 0xa8, 0xf1, 0x01, 0xb0, 0xf1, 0x80, 0xac, 0xf9, 0x01, 0xaf, 0x5e, 0x80, 0xb7, 0x5e, 0x05, 0xaf, 0x5e, 0x80, 0xaf, 0x7e, 0x02, 0xaf, 0x5e, 0x02, 0xb7, 0x5e, 0x83, 0xaf, 0x5e, 0xb7, 0x5e, 0xaf, 0x5e, 0xb7, 0x5e, 0x03, 0xaf, 0x5e, 0x02, 0xb7, 0x5e, 0x02, 0xaf, 0x5e, 0x01, 0xb7, 0x5e, 0x0a, 0xaf, 0x5e, 0x80, 0xb7, 0x5e, 0x01, 0xaf, 0x5e, 0x80, 0xb7, 0x5e, 0x02, 0xaf, 0x5e, 0x01, 0xb7, 0x5e, 0x02, 0xaf, 0x5e, 0x80, 0xb7, 0x5e, 0x03, 0xaf, 0x5e, 0x81, 0xaf, 0x5d, 0xb7, 0x5e, 0x01, 0xaf, 0x5e, 0x82, 0x9c, 0x77, 0x81, 0x91, 0x99, 0x51, 0x06, 0xb0, 0xf1, 0x80, 0xad, 0xbb, 0x03, 0xb7, 0x5e, 0x82, 0x9c, 0x78, 0x89, 0x91, 0x99, 0x51, 0x06, 0xb0, 0xf1, 0x80, 0xb5, 0xbb, 0x01, 0xb7, 0x5e, 0x04, 0xaf, 0x5e, 0x80, 0xb7, 0x5e, 0x01, 0xaf, 0x5e, 0x02, 0xb7, 0x5e, 0x80, 0xaf, 0x5e, 0x02, 0xb7, 0x5e, 0x01, 0xaf, 0x5e, 0x8b, 0xb7, 0x5e, 0xaf, 0x5e, 0xaf, 0x1d, 0xcb, 0x75, 0xca, 0x93, 0xd2, 0x94, 0xca, 0x74, 0xca, 0x94, 0xca, 0x74, 0xd2, 0x74, 0xca, 0x74, 0xd2, 0x94, 0x07, 0xca, 0x94, 0x85, 0xd2, 0x94, 0xca, 0x93, 0xca, 0x94, 0xd2, 0x93, 0xca, 0x74, 0x99, 0x15, 0x02, 0xc9, 0x32, 0x83, 0xc9, 0x12, 0xc1, 0x11, 0xc8, 0xf2, 0xc0, 0xf2, 0x01, 0xc8, 0xd1, 0x8a, 0x33, 0x3c, 0x03, 0xff, 0x03, 0xdf, 0x03, 0xbf, 0x04, 0xdc, 0x07, 0xd6, 0x07, 0xf7, 0x07, 0xfb, 0x07, 0xfe, 0x07, 0xff, 0x2e, 0x3c, 0x01, 0xb0, 0xd1, 0x02, 0xb0, 0xf1, 0x80, 0xa8, 0xf1, 0x01, 0xb0, 0xf1, 0x82, 0x90, 0xf1, 0x30, 0xf0, 0x28, 0xf0, 0x01, 0x28, 0xcf, 0x80, 0x20, 0xcf, 0x01, 0x20, 0xce, 0x01, 0x20, 0xae, 0x17, 0x18, 0xad,
+  0x3d, 0x18, 0xad, 0x01, 0xd2, 0x74, 0x89, 0xca, 0x53, 0xaf, 0x5e, 0xaf, 0x3e, 0xaf, 0x5e, 0xaf, 0x3e, 0xaf, 0x3d, 0xaf, 0x5d, 0xaf, 0x3d, 0xaf, 0x3e, 0xa6, 0x9c, 0x01, 0x81, 0x91, 0x02, 0xb0, 0xf1, 0x81, 0xb0, 0xd1, 0xb0, 0xf2, 0x01, 0xb0, 0xd1, 0x80, 0xb0, 0xf2, 0x01, 0xb0, 0xf1, 0x8c, 0xaa, 0x13, 0xb4, 0x18, 0xa4, 0x38, 0x9a, 0xb4, 0x99, 0x31, 0xa8, 0xf1, 0xb0, 0xf1, 0xb0, 0xf2, 0xb0, 0xf1, 0xb0, 0xd1, 0xb0, 0xf1, 0xb0, 0xd1, 0xb0, 0xf1, 0x01, 0xb0, 0xd1, 0x81, 0xb0, 0xf1, 0xb0, 0xd1, 0x03, 0xb0, 0xf1, 0x88, 0xaa, 0x74, 0xac, 0x78, 0xac, 0xf9, 0x9b, 0x35, 0x99, 0x31, 0xa8, 0xf1, 0xb0, 0xf1, 0xb0, 0xf2, 0xb0, 0xf1, 0x01, 0xb0, 0xd1, 0x84, 0xb0, 0xf1, 0xb0, 0xf2, 0xb0, 0xd1, 0xb0, 0xf1, 0xa9, 0xb3, 0x03, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x01, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x02, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x01, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x01, 0xaf, 0x3e, 0x01, 0xaf, 0x3d, 0x01, 0xaf, 0x3e, 0x81, 0xaf, 0x5e, 0xaf, 0x3e, 0x01, 0xaf, 0x3d, 0x03, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x01, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x07, 0xaf, 0x3e, 0x81, 0xaf, 0x3d, 0xaf, 0x5e, 0x03, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x02, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x04, 0xaf, 0x3e, 0x82, 0xaf, 0x5e, 0xaf, 0x3e, 0xaf, 0x5e, 0x03, 0xaf, 0x3e, 0x84, 0x9c, 0x77, 0x81, 0x91, 0x99, 0x31, 0xb0, 0xf1, 0xb0, 0xd1, 0x04, 0xb0, 0xf1, 0x80, 0xad, 0xbb, 0x01, 0xaf, 0x3e, 0x84, 0xaf, 0x5d, 0xaf, 0x3e, 0x94, 0x77, 0x81, 0x91, 0x99, 0x51, 0x01, 0xb0, 0xd1, 0x80, 0xb0, 0xf1, 0x03, 0xb0, 0xd1, 0x84, 0xad, 0xba, 0xaf, 0x3e, 0xaf, 0x5e, 0xaf, 0x3e, 0xaf, 0x5e, 0x02, 0xaf, 0x3e, 0x80, 0xaf, 0x3d, 0x02, 0xaf, 0x5e, 0x01, 0xaf, 0x3d, 0x03, 0xaf, 0x3e, 0x80, 0xaf, 0x5e, 0x03, 0xaf, 0x3e, 0x84, 0xae, 0xfd, 0xcb, 0x56, 0xca, 0x53, 0xca, 0x74, 0xd2, 0x53, 0x01, 0xd2, 0x74, 0x81, 0xd2, 0x73, 0xca, 0x73, 0x07, 0xd2, 0x74, 0x81, 0xd2, 0x54, 0xca, 0x74, 0x01, 0xca, 0x54, 0x80, 0xca, 0x74, 0x02, 0xc9, 0x32, 0x02, 0xc9, 0x12, 0x80, 0xc0, 0xf1, 0x02, 0xc8, 0xd1, 0x81, 0x33, 0x5c, 0x04, 0x1f, 0x01, 0x03, 0xff, 0x88, 0x04, 0x7d, 0x07, 0x95, 0x07, 0xf6, 0x07, 0xfa, 0x07, 0xfe, 0x07, 0xff, 0x2e, 0x3c, 0xb0, 0xf1, 0xb0, 0xd1, 0x02, 0xb0, 0xf1, 0x87, 0xa8, 0xf1, 0xb0, 0xf1, 0xb0, 0xd1, 0xb0, 0xf1, 0x40, 0xf0, 0x28, 0xcf, 0x28, 0xef, 0x28, 0xce, 0x02, 0x20, 0xce, 0x01, 0x20, 0xae, 0x81, 0x18, 0xad, 0x20, 0xae, 0x15, 0x18, 0xad,
+  0x3d, 0x18, 0xad, 0x02, 0xca, 0x53, 0x03, 0xa7, 0x3e, 0x03, 0xa7, 0x3d, 0x85, 0x94, 0x57, 0x81, 0x91, 0x99, 0x31, 0xb8, 0xd1, 0xb0, 0xd1, 0xb8, 0xd1, 0x02, 0xb0, 0xd1, 0x83, 0xb0, 0xf1, 0xb0, 0xd1, 0xb1, 0xb3, 0xad, 0x9a, 0x01, 0xaf, 0x3d, 0x01, 0xa7, 0x3d, 0x85, 0x9d, 0xda, 0x89, 0xd1, 0x99, 0x51, 0xb0, 0xf1, 0xb0, 0xd1, 0xb0, 0xf1, 0x02, 0xb0, 0xd1, 0x01, 0xb8, 0xd1, 0x02, 0xb0, 0xd1, 0x84, 0xb0, 0xf1, 0xb2, 0x13, 0xad, 0x9b, 0xa7, 0x3e, 0xa7, 0x3d, 0x01, 0xaf, 0x3e, 0x82, 0x9d, 0xda, 0x81, 0xf2, 0x91, 0x71, 0x01, 0xb0, 0xf1, 0x81, 0xb0, 0xd1, 0xb0, 0xf1, 0x01, 0xb0, 0xd1, 0x85, 0xb8, 0xd1, 0xb8, 0xd2, 0xb0, 0xf1, 0xad, 0x39, 0xa7, 0x3d, 0xa7, 0x3e, 0x04, 0xa7, 0x3d, 0x80, 0xa7, 0x3e, 0x02, 0xa7, 0x3d, 0x80, 0xaf, 0x3d, 0x02, 0xa7, 0x3d, 0x01, 0xa7, 0x3e, 0x81, 0xa7, 0x3d, 0xaf, 0x3d, 0x01, 0xa7, 0x3d, 0x81, 0xa7, 0x3e, 0xaf, 0x3d, 0x01, 0xa7, 0x3e, 0x81, 0xa7, 0x3d, 0xaf, 0x3d, 0x01, 0xa7, 0x3d, 0x82, 0xa7, 0x3e, 0xaf, 0x3e, 0xaf, 0x1e, 0x07, 0xa7, 0x3e, 0x84, 0xaf, 0x3e, 0xa7, 0x3e, 0xa7, 0x3d, 0xaf, 0x3e, 0xa7, 0x3e, 0x02, 0xa7, 0x3d, 0x80, 0xaf, 0x3d, 0x02, 0xa7, 0x3e, 0x83, 0xa7, 0x3d, 0xaf, 0x3d, 0xa7, 0x3d, 0xaf, 0x3d, 0x01, 0xa7, 0x3e, 0x81, 0xaf, 0x3d, 0xa7, 0x3e, 0x01, 0xa7, 0x3d, 0x83, 0xa7, 0x3e, 0x94, 0x78, 0x81, 0x91, 0x99, 0x31, 0x05, 0xb0, 0xd1, 0x84, 0xb8, 0xd1, 0xad, 0x9a, 0xa7, 0x3e, 0xa7, 0x3d, 0xa7, 0x3e, 0x02, 0xa7, 0x3d, 0x80, 0xaf, 0x3d, 0x04, 0xa7, 0x3d, 0x80, 0xaf, 0x3d, 0x02, 0xa7, 0x3d, 0x81, 0xaf, 0x3e, 0xa7, 0x3e, 0x02, 0xa7, 0x3d, 0x84, 0xaf, 0x3d, 0xaf, 0x3e, 0xa7, 0x3d, 0xaf, 0x3d, 0xaf, 0x3e, 0x01, 0xa7, 0x3d, 0x81, 0xaf, 0x3d, 0xa7, 0x3e, 0x02, 0xaf, 0x3d, 0x80, 0xa7, 0x3e, 0x01, 0xa7, 0x3d, 0x83, 0xaf, 0x3d, 0xa7, 0x3d, 0xae, 0xdd, 0xc3, 0x76, 0x03, 0xca, 0x53, 0x80, 0xca, 0x33, 0x08, 0xca, 0x53, 0x82, 0xd2, 0x33, 0xca, 0x53, 0xd2, 0x53, 0x01, 0xca, 0x53, 0x85, 0x30, 0x9c, 0x00, 0x5f, 0x58, 0xb9, 0xc9, 0x12, 0xc1, 0x11, 0xc8, 0xf1, 0x01, 0xc8, 0xd1, 0x01, 0xc0, 0xd1, 0x81, 0x33, 0x7c, 0x04, 0x5f, 0x01, 0x04, 0x1f, 0x86, 0x04, 0x5e, 0x07, 0x75, 0x07, 0xf5, 0x07, 0xfa, 0x07, 0xfe, 0x07, 0xff, 0x2e, 0x3c, 0x02, 0xb0, 0xf1, 0x82, 0xb0, 0xd1, 0xb0, 0xf1, 0xa8, 0xf1, 0x01, 0xb0, 0xf1, 0x82, 0xb0, 0xd1, 0x80, 0xf1, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x80, 0x20, 0xcf, 0x01, 0x20, 0xce, 0x01, 0x20, 0xae, 0x81, 0x18, 0xad, 0x20, 0xae, 0x15, 0x18, 0xad,
+  0x3d, 0x18, 0xad, 0x82, 0xca, 0x13, 0xca, 0x33, 0xca, 0x13, 0x04, 0xa7, 0x1d, 0x02, 0xa7, 0x3d, 0x82, 0x8a, 0x53, 0x81, 0x91, 0xa8, 0xf1, 0x02, 0xb8, 0xd1, 0x80, 0xb0, 0xd1, 0x02, 0xb8, 0xd1, 0x83, 0xb2, 0x13, 0xa6, 0xbd, 0xa7, 0x1d, 0xa7, 0x3e, 0x03, 0xa7, 0x1d, 0x83, 0x9e, 0x1b, 0x81, 0xf1, 0x91, 0x71, 0xb0, 0xf1, 0x08, 0xb8, 0xd1, 0x81, 0xb1, 0xf3, 0xa6, 0xbd, 0x03, 0xa7, 0x1d, 0x84, 0xa7, 0x3d, 0xa7, 0x1d, 0x9e, 0x1b, 0x89, 0xf2, 0x89, 0x91, 0x05, 0xb8, 0xd1, 0x82, 0xb0, 0xd1, 0xb8, 0xd1, 0xb3, 0x36, 0x09, 0xa7, 0x1d, 0x02, 0xa7, 0x3d, 0x01, 0xa7, 0x1d, 0x82, 0xa7, 0x3d, 0xa7, 0x1d, 0xa7, 0x1e, 0x01, 0xa7, 0x1d, 0x81, 0xa7, 0x3d, 0xa7, 0x3e, 0x02, 0xa7, 0x1d, 0x83, 0xa7, 0x3e, 0xa7, 0x1d, 0xa7, 0x3e, 0xa7, 0x3d, 0x01, 0xa7, 0x1d, 0x80, 0xa7, 0x3d, 0x09, 0xa7, 0x1d, 0x02, 0xa7, 0x3d, 0x81, 0xa7, 0x3e, 0xa7, 0x1d, 0x01, 0xa7, 0x3d, 0x05, 0xa7, 0x1d, 0x80, 0xa7, 0x3d, 0x01, 0xa7, 0x1d, 0x80, 0xa7, 0x3e, 0x01, 0xa7, 0x3d, 0x01, 0xa7, 0x1d, 0x82, 0x94, 0x77, 0x81, 0x91, 0x99, 0x31, 0x06, 0xb8, 0xd1, 0x83, 0xa5, 0x9a, 0xa7, 0x1d, 0xa7, 0x3d, 0xa7, 0x3e, 0x01, 0xa7, 0x1d, 0x81, 0xa7, 0x1e, 0xa7, 0x3d, 0x07, 0xa7, 0x1d, 0x01, 0xa7, 0x3d, 0x84, 0xa7, 0x1e, 0xa7, 0x1d, 0xa7, 0x3d, 0xa7, 0x1d, 0xa7, 0x3d, 0x05, 0xa7, 0x1d, 0x01, 0xa7, 0x3d, 0x80, 0xa7, 0x1d, 0x01, 0xa7, 0x3d, 0x81, 0xa7, 0x1d, 0xa7, 0x3e, 0x04, 0xa7, 0x1d, 0x83, 0xbb, 0xf7, 0xca, 0x13, 0xca, 0x33, 0xca, 0x13, 0x09, 0xca, 0x33, 0x01, 0xca, 0x13, 0x82, 0xca, 0x14, 0xd2, 0x33, 0xca, 0x33, 0x01, 0x00, 0x3f, 0x83, 0x00, 0x5f, 0x78, 0xd7, 0xc0, 0xf2, 0xc8, 0xf1, 0x02, 0xc0, 0xd1, 0x8d, 0xc8, 0xb1, 0x4b, 0x1a, 0x04, 0x7f, 0x04, 0x5f, 0x04, 0x3f, 0x04, 0x5f, 0x07, 0x35, 0x07, 0xf4, 0x07, 0xf9, 0x07, 0xfe, 0x07, 0xff, 0x2e, 0x3c, 0xb0, 0xd1, 0xb0, 0xf1, 0x02, 0xb0, 0xd1, 0x87, 0xa8, 0xf1, 0xb0, 0xf1, 0xb0, 0xd1, 0xb0, 0xf1, 0xa0, 0xf1, 0x28, 0xcf, 0x28, 0xef, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x01, 0x20, 0xae, 0x81, 0x18, 0xad, 0x20, 0xae, 0x15, 0x18, 0xad,
+  0x3d, 0x18, 0xad, 0x02, 0xca, 0x13, 0x01, 0x9f, 0x1d, 0x80, 0xa7, 0x1d, 0x01, 0x9f, 0x1d, 0x80, 0xa7, 0x1d, 0x01, 0x9f, 0x1d, 0x01, 0x81, 0x91, 0x07, 0xb8, 0xd1, 0x80, 0xa5, 0xdb, 0x01, 0x9f, 0x1d, 0x80, 0x9e, 0xfd, 0x02, 0x9f, 0x1d, 0x84, 0xa6, 0xfd, 0x9f, 0x1d, 0x94, 0xf9, 0x81, 0x91, 0x99, 0x31, 0x01, 0xb8, 0xd1, 0x80, 0xb8, 0xb1, 0x04, 0xb8, 0xd1, 0x81, 0xb8, 0xb1, 0xa5, 0xdb, 0x03, 0x9f, 0x1d, 0x80, 0xa6, 0xfd, 0x02, 0x9f, 0x1d, 0x82, 0x94, 0xf9, 0x81, 0x91, 0x99, 0x31, 0x06, 0xb8, 0xd1, 0x80, 0xb9, 0x32, 0x02, 0x9f, 0x1d, 0x80, 0x9f, 0x1e, 0x04, 0x9f, 0x1d, 0x84, 0x9e, 0x1b, 0x94, 0x57, 0x92, 0xd4, 0xa1, 0xf3, 0xa9, 0x11, 0x01, 0xb0, 0xf1, 0x81, 0xa9, 0x11, 0xb2, 0x74, 0x01, 0xb2, 0x54, 0x81, 0xab, 0xf7, 0xa5, 0xdb, 0x01, 0xa6, 0xfd, 0x01, 0xa7, 0x1d, 0x01, 0x9f, 0x1d, 0x80, 0xa6, 0xfd, 0x01, 0x9f, 0x1d, 0x80, 0xa7, 0x1d, 0x0a, 0x9f, 0x1d, 0x8c, 0x9e, 0x7c, 0x94, 0x98, 0x8b, 0x14, 0x9a, 0x13, 0xa1, 0x31, 0xa9, 0x12, 0xb0, 0xf1, 0xa8, 0xf1, 0xb2, 0x55, 0xb2, 0x74, 0xb2, 0x54, 0xab, 0x97, 0xad, 0x1a, 0x03, 0x9f, 0x1d, 0x85, 0xa7, 0x1d, 0x9f, 0x1d, 0xa7, 0x1d, 0x94, 0x57, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xb8, 0xd1, 0x87, 0xa5, 0x7a, 0x9f, 0x1d, 0xa7, 0x1d, 0x9f, 0x1d, 0xa7, 0x1d, 0x9e, 0x7c, 0x9d, 0xba, 0xa5, 0x9a, 0x06, 0xa5, 0x7a, 0x80, 0xa6, 0x9c, 0x02, 0x9f, 0x1d, 0x80, 0xa7, 0x1d, 0x06, 0x9f, 0x1d, 0x85, 0x9e, 0x5c, 0x94, 0xb8, 0x8a, 0xf4, 0x9a, 0x13, 0xa1, 0x31, 0xa8, 0xf1, 0x01, 0xb0, 0xf1, 0x88, 0xb9, 0x32, 0xb2, 0x74, 0xb2, 0x54, 0xb3, 0x36, 0xac, 0xb9, 0xa6, 0x3c, 0x9f, 0x1d, 0xbb, 0xf7, 0xc9, 0xf3, 0x02, 0xca, 0x13, 0x07, 0xc9, 0xf3, 0x04, 0xca, 0x13, 0x01, 0x00, 0x3f, 0x85, 0x00, 0x5f, 0x58, 0xb9, 0xc0, 0xf1, 0xc0, 0xd1, 0xc8, 0xd1, 0xc8, 0xb2, 0x01, 0xc0, 0xb1, 0x81, 0x62, 0xb8, 0x04, 0xbf, 0x01, 0x04, 0x7f, 0x88, 0x04, 0x5f, 0x07, 0x15, 0x07, 0xf4, 0x07, 0xf9, 0x07, 0xfd, 0x07, 0xff, 0x2e, 0x3c, 0xb0, 0xd1, 0xb0, 0xf1, 0x01, 0xb0, 0xd1, 0x01, 0xa8, 0xf1, 0x03, 0xb0, 0xf1, 0x82, 0x58, 0xf0, 0x28, 0xcf, 0x28, 0xce, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x15, 0x18, 0xad,
+  0x3d, 0x18, 0xad, 0x02, 0xc9, 0xd3, 0x06, 0x9e, 0xfd, 0x87, 0x95, 0x9a, 0x81, 0x91, 0x91, 0x51, 0xc0, 0xb1, 0xb8, 0xd1, 0xc0, 0xb1, 0xb8, 0xd1, 0xc0, 0xd1, 0x01, 0xb8, 0xd1, 0x80, 0xb2, 0xb5, 0x09, 0x9e, 0xfd, 0x81, 0x82, 0x52, 0x81, 0x91, 0x03, 0xb8, 0xd1, 0x84, 0xc0, 0xb1, 0xc0, 0xd1, 0xb8, 0xd1, 0xc0, 0xd1, 0xb1, 0xf3, 0x04, 0x9e, 0xfd, 0x80, 0x9f, 0x1d, 0x03, 0x9e, 0xfd, 0x81, 0x8a, 0x93, 0x81, 0x91, 0x01, 0xb8, 0xd1, 0x80, 0xc0, 0xd1, 0x03, 0xb8, 0xd1, 0x81, 0xc0, 0xb1, 0xa6, 0x3c, 0x05, 0x9e, 0xfd, 0x83, 0x94, 0xf8, 0x8a, 0x53, 0x91, 0x71, 0xb0, 0xf1, 0x02, 0xb8, 0xd1, 0x01, 0xb8, 0xb1, 0x80, 0xc0, 0xb1, 0x01, 0xc0, 0xd1, 0x84, 0xb8, 0xd1, 0xc0, 0xd1, 0xb8, 0xb1, 0xb9, 0x92, 0xac, 0xb9, 0x10, 0x9e, 0xfd, 0x83, 0x9e, 0x5c, 0x8b, 0x96, 0x89, 0x91, 0xa1, 0x31, 0x01, 0xb8, 0xd1, 0x80, 0xc0, 0xb1, 0x05, 0xb8, 0xd1, 0x84, 0xc0, 0xb1, 0xb8, 0xd1, 0xb9, 0x32, 0xab, 0xf7, 0x9e, 0x9c, 0x03, 0x9e, 0xfd, 0x85, 0x94, 0x37, 0x81, 0x91, 0xa1, 0x31, 0xb8, 0xd1, 0xc0, 0xb1, 0xb8, 0xd1, 0x01, 0xc0, 0xb1, 0x01, 0xb8, 0xd1, 0x80, 0xa5, 0x7a, 0x03, 0x9e, 0xfd, 0x84, 0x94, 0x37, 0x81, 0x91, 0xa1, 0x31, 0xb8, 0xd1, 0xc0, 0xb1, 0x01, 0xb8, 0xd1, 0x80, 0xc0, 0xb1, 0x01, 0xb8, 0xd1, 0x80, 0xa5, 0x7a, 0x08, 0x9e, 0xfd, 0x83, 0x9e, 0x9c, 0x8b, 0x96, 0x89, 0x71, 0xa1, 0x31, 0x01, 0xb8, 0xd1, 0x83, 0xc0, 0xb1, 0xb8, 0xd1, 0xc0, 0xb1, 0xc0, 0xd1, 0x01, 0xb8, 0xd1, 0x80, 0xc0, 0xd1, 0x01, 0xb8, 0xd1, 0x85, 0xc0, 0xd1, 0xb3, 0x35, 0xa6, 0x3c, 0xbb, 0xd7, 0xc9, 0xd3, 0xc9, 0xf3, 0x08, 0xc9, 0xd3, 0x80, 0xc9, 0xf3, 0x01, 0xc9, 0xd3, 0x82, 0xc9, 0xf3, 0xc9, 0xd3, 0x00, 0x1f, 0x01, 0x00, 0x3f, 0x91, 0x00, 0xdf, 0x88, 0xf6, 0xc8, 0xd1, 0xc0, 0xb1, 0xc8, 0xb1, 0xc0, 0xb1, 0xc8, 0xb1, 0x62, 0xd9, 0x04, 0xff, 0x04, 0xbf, 0x04, 0x9f, 0x04, 0x7f, 0x06, 0xb6, 0x07, 0xf3, 0x07, 0xf8, 0x07, 0xfd, 0x07, 0xff, 0x2e, 0x3c, 0x02, 0xb0, 0xd1, 0x81, 0xb0, 0xf1, 0x98, 0xf2, 0x02, 0xb0, 0xf1, 0x84, 0x78, 0xf0, 0x90, 0xf1, 0x80, 0xd1, 0x28, 0xcf, 0x28, 0xce, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x15, 0x18, 0xad,
+  0x3c, 0x18, 0xad, 0x80, 0x18, 0xae, 0x02, 0xc9, 0xb3, 0x84, 0x9e, 0xdd, 0x96, 0xfd, 0x9e, 0xdd, 0x96, 0xfd, 0x9e, 0xfc, 0x01, 0x96, 0xfd, 0x84, 0x95, 0x99, 0x89, 0x91, 0x91, 0x71, 0xc0, 0xb1, 0xc0, 0xd1, 0x03, 0xc0, 0xb1, 0x82, 0xc0, 0xd1, 0xab, 0xd7, 0x9e, 0xfc, 0x01, 0x96, 0xfd, 0x89, 0x96, 0xdd, 0x96, 0xfd, 0x9e, 0xfd, 0x9e, 0xdd, 0x96, 0xfd, 0x9e, 0xdd, 0x9e, 0xfd, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x11, 0x01, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x83, 0xc0, 0xd1, 0xc0, 0xb1, 0xab, 0x76, 0x9e, 0xdd, 0x01, 0x9e, 0xfd, 0x01, 0x9e, 0xdd, 0x88, 0x96, 0xdd, 0x9e, 0xfd, 0x9e, 0xdd, 0x96, 0xfd, 0x9e, 0xdd, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x89, 0xc0, 0xd1, 0xa5, 0x5a, 0x96, 0xfd, 0x9e, 0xdd, 0x9e, 0xfd, 0x96, 0xfd, 0x96, 0x3b, 0x8a, 0xf4, 0x89, 0x91, 0xa9, 0x11, 0x01, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x03, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x03, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x87, 0xb9, 0x92, 0xa5, 0x5a, 0x9e, 0xdd, 0x9e, 0xfc, 0x96, 0xfd, 0x9e, 0xdd, 0x96, 0xfd, 0x9e, 0xfd, 0x07, 0x96, 0xfd, 0x84, 0x94, 0xf9, 0x81, 0xf1, 0x91, 0x71, 0xb8, 0xd2, 0xc0, 0xb1, 0x01, 0xc0, 0xd1, 0x83, 0xc0, 0xb1, 0xc0, 0xd1, 0xc0, 0xb1, 0xc0, 0xd1, 0x06, 0xc0, 0xb1, 0x87, 0xb9, 0x92, 0x9d, 0xbb, 0x96, 0xfd, 0x9e, 0xdd, 0x96, 0xfd, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x81, 0xa5, 0x5a, 0x9e, 0xdd, 0x01, 0x96, 0xfd, 0x83, 0x9e, 0xfd, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x83, 0xa5, 0x5a, 0x96, 0xfd, 0x9e, 0xfd, 0x96, 0xfd, 0x01, 0x9e, 0xfd, 0x86, 0x96, 0xfd, 0x9e, 0xfd, 0x96, 0xfd, 0x95, 0x39, 0x81, 0xf1, 0x91, 0x71, 0xb0, 0xd1, 0x02, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x01, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x05, 0xc0, 0xb1, 0x83, 0xb8, 0xd1, 0xb9, 0x11, 0xac, 0xfa, 0xb4, 0x58, 0x0a, 0xc9, 0xb3, 0x80, 0xc9, 0xd2, 0x01, 0xc9, 0xd3, 0x81, 0xc9, 0xb3, 0x00, 0x1f, 0x01, 0x00, 0x3f, 0x83, 0x00, 0xbf, 0x31, 0x1c, 0xc0, 0xd1, 0xc8, 0xb1, 0x02, 0xc0, 0xb1, 0x8c, 0x62, 0x78, 0x05, 0x3f, 0x04, 0xff, 0x04, 0xbf, 0x04, 0x9f, 0x06, 0x96, 0x07, 0xf2, 0x07, 0xf7, 0x07, 0xfc, 0x07, 0xff, 0x2e, 0x3c, 0xb0, 0xf1, 0xb0, 0xd1, 0x01, 0xb0, 0xf1, 0x80, 0x89, 0x12, 0x01, 0xb0, 0xf1, 0x83, 0xb0, 0xd1, 0x48, 0xf0, 0x28, 0xf0, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x03, 0x20, 0xae, 0x15, 0x18, 0xad,
+  0x16, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x11, 0x18, 0xad, 0x80, 0x18, 0xae, 0x01, 0x18, 0xad, 0x84, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x18, 0xad, 0x18, 0xae, 0x0b, 0x18, 0xad, 0x01, 0xc9, 0x93, 0x81, 0xc9, 0x92, 0x96, 0xdc, 0x05, 0x96, 0xdd, 0x82, 0x8d, 0x79, 0x81, 0x91, 0x91, 0x51, 0x06, 0xc0, 0xb1, 0x80, 0xab, 0xd7, 0x09, 0x96, 0xdd, 0x82, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x80, 0xab, 0xd7, 0x09, 0x96, 0xdd, 0x82, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x80, 0x9d, 0x5a, 0x02, 0x96, 0xdd, 0x83, 0x95, 0xda, 0x89, 0xf2, 0x89, 0x71, 0xb8, 0xd1, 0x01, 0xc0, 0xb1, 0x80, 0xc8, 0xb1, 0x0e, 0xc0, 0xb1, 0x80, 0xa4, 0x99, 0x04, 0x96, 0xdd, 0x80, 0x96, 0xdc, 0x05, 0x96, 0xdd, 0x82, 0x8c, 0x37, 0x81, 0x91, 0x99, 0x31, 0x0b, 0xc0, 0xb1, 0x80, 0xc8, 0xb1, 0x04, 0xc0, 0xb1, 0x85, 0xa4, 0x99, 0x96, 0xdc, 0x96, 0xdd, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x11, 0x06, 0xc0, 0xb1, 0x80, 0x9d, 0x5a, 0x03, 0x96, 0xdd, 0x82, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x80, 0x9d, 0x5a, 0x06, 0x96, 0xdd, 0x82, 0x8c, 0xd8, 0x81, 0x91, 0x99, 0x51, 0x05, 0xc0, 0xb1, 0x80, 0xc8, 0xb1, 0x02, 0xc0, 0xb1, 0x80, 0xc8, 0xb1, 0x06, 0xc0, 0xb1, 0x84, 0xac, 0x79, 0xac, 0xf9, 0xc9, 0x92, 0xc9, 0x93, 0xc9, 0xb2, 0x01, 0xc9, 0x92, 0x02, 0xc9, 0x93, 0x02, 0xc9, 0x92, 0x02, 0xc9, 0x93, 0x02, 0x00, 0x3f, 0x83, 0x00, 0xbf, 0x01, 0x1f, 0xc0, 0xb1, 0xc8, 0xb1, 0x02, 0xc0, 0xb1, 0x80, 0x79, 0xd6, 0x01, 0x05, 0x1f, 0x89, 0x04, 0xff, 0x04, 0xbf, 0x06, 0x38, 0x07, 0xf1, 0x07, 0xf7, 0x07, 0xfc, 0x07, 0xff, 0x2e, 0x3c, 0xb0, 0xf1, 0xb0, 0xf2, 0x01, 0xb0, 0xf1, 0x80, 0x80, 0xf2, 0x01, 0xb0, 0xf1, 0x86, 0xb0, 0xf2, 0x31, 0x10, 0x30, 0xf0, 0x28, 0xcf, 0x28, 0xef, 0x20, 0xce, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x81, 0x20, 0xad, 0x20, 0xae, 0x16, 0x18, 0xad,
+  0x13, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x0b, 0x18, 0xad, 0x86, 0x20, 0xae, 0x18, 0xad, 0x10, 0xd2, 0x08, 0xf3, 0x10, 0xf3, 0x10, 0xd2, 0x18, 0xcd, 0x10, 0x18, 0xad, 0x02, 0xc9, 0x72, 0x80, 0x8e, 0xbc, 0x01, 0x8e, 0xbd, 0x02, 0x8e, 0xbc, 0x83, 0x8e, 0xbd, 0x8d, 0x7a, 0x81, 0x91, 0x91, 0x51, 0x04, 0xc0, 0xb1, 0x83, 0xc8, 0xb1, 0xc0, 0xb1, 0xab, 0xb7, 0x8e, 0xbd, 0x07, 0x8e, 0xbc, 0x85, 0x8e, 0xbd, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0xc0, 0xb1, 0xc8, 0xb1, 0x02, 0xc0, 0xb1, 0x82, 0xc8, 0xb1, 0xc0, 0xb1, 0xab, 0xb7, 0x02, 0x8e, 0xbc, 0x82, 0x8e, 0xdc, 0x8e, 0xbc, 0x8e, 0xdd, 0x01, 0x8e, 0xbc, 0x84, 0x8e, 0xbd, 0x8e, 0xbc, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x85, 0x9d, 0x39, 0x8e, 0xbd, 0x8e, 0xdd, 0x8d, 0xba, 0x81, 0xf2, 0x91, 0x71, 0x01, 0xc0, 0xb1, 0x87, 0xc8, 0xb1, 0xc0, 0xb1, 0xc0, 0xd1, 0xc0, 0xb1, 0xc8, 0xb1, 0xc8, 0xb2, 0xc0, 0xb1, 0xc8, 0xb2, 0x01, 0xc8, 0xb1, 0x81, 0xc0, 0xd1, 0xc0, 0xb1, 0x01, 0xc0, 0xd1, 0x80, 0xc8, 0xb1, 0x01, 0xc0, 0xb1, 0x86, 0xc8, 0xb1, 0xc0, 0xb1, 0xa4, 0x37, 0x8e, 0xbc, 0x8e, 0xdd, 0x8e, 0xbc, 0x8e, 0xbd, 0x01, 0x8e, 0xbc, 0x81, 0x8e, 0xbd, 0x8e, 0xbc, 0x01, 0x8e, 0xbd, 0x82, 0x8c, 0xd8, 0x81, 0x91, 0xa1, 0x31, 0x01, 0xc0, 0xb1, 0x80, 0xc8, 0xb1, 0x01, 0xc0, 0xb1, 0x83, 0xc8, 0xb2, 0xc8, 0xb1, 0xc0, 0xb1, 0xc8, 0xb1, 0x02, 0xc0, 0xb1, 0x01, 0xc8, 0xb1, 0x02, 0xc0, 0xb1, 0x8a, 0xc8, 0xb1, 0xc0, 0xb1, 0xc8, 0xb1, 0xa4, 0xd9, 0x8e, 0xbc, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0xc0, 0xb1, 0xc8, 0xb1, 0xc0, 0xd1, 0x02, 0xc0, 0xb1, 0x81, 0xc8, 0xb1, 0x9d, 0x3a, 0x03, 0x8e, 0xbc, 0x82, 0x8c, 0x37, 0x81, 0x91, 0xa1, 0x31, 0x06, 0xc0, 0xb1, 0x80, 0x9d, 0x5a, 0x01, 0x8e, 0xbc, 0x80, 0x8e, 0xdc, 0x02, 0x8e, 0xbc, 0x89, 0x8c, 0xd8, 0x81, 0x91, 0x99, 0x51, 0xc8, 0xb1, 0xc0, 0xb1, 0xc8, 0xb1, 0xc8, 0xb2, 0xc8, 0xb1, 0xc0, 0xb1, 0xc8, 0xb1, 0x02, 0xc0, 0xb1, 0x80, 0xc0, 0xd1, 0x04, 0xc0, 0xb1, 0x02, 0xc8, 0xb1, 0x82, 0xc8, 0xd1, 0xa4, 0x78, 0xa4, 0xd9, 0x0c, 0xc9, 0x72, 0x01, 0x00, 0x3f, 0x82, 0x00, 0x1f, 0x00, 0x9f, 0x00, 0xdf, 0x04, 0xc0, 0xb1, 0x8c, 0x91, 0x74, 0x04, 0x9f, 0x05, 0x7f, 0x05, 0x1f, 0x04, 0xff, 0x06, 0x19, 0x07, 0xf1, 0x07, 0xf6, 0x07, 0xfc, 0x07, 0xff, 0x35, 0xbb, 0xb0, 0xf1, 0xb0, 0xd1, 0x01, 0xb0, 0xf1, 0x80, 0x69, 0x12, 0x01, 0xb0, 0xf1, 0x80, 0x98, 0xf1, 0x01, 0x30, 0xf0, 0x82, 0x28, 0xef, 0x28, 0xcf, 0x28, 0xef, 0x03, 0x20, 0xce, 0x81, 0x20, 0xad, 0x20, 0xae, 0x16, 0x18, 0xad,
+  0x19, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0a, 0x18, 0xad, 0x89, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x1a, 0x00, 0xfa, 0x01, 0x1a, 0x01, 0x19, 0x08, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x20, 0xad, 0x01, 0x18, 0xae, 0x81, 0x18, 0xad, 0x18, 0xae, 0x07, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xad, 0x02, 0xc9, 0x52, 0x06, 0x8e, 0xbc, 0x84, 0x8d, 0x59, 0x81, 0x91, 0x91, 0x71, 0xc8, 0xf2, 0xc8, 0xf1, 0x02, 0xc8, 0xf2, 0x82, 0xc8, 0xf1, 0xc8, 0xf2, 0xab, 0xd7, 0x09, 0x8e, 0xbc, 0x84, 0x8c, 0x36, 0x81, 0x91, 0xa9, 0x31, 0xc8, 0xf2, 0xc8, 0xf1, 0x03, 0xc8, 0xf2, 0x81, 0xc0, 0xf2, 0xab, 0xb7, 0x09, 0x8e, 0xbc, 0x82, 0x84, 0x37, 0x81, 0x91, 0xa9, 0x51, 0x01, 0xc8, 0xf1, 0x80, 0xc8, 0xf2, 0x01, 0xc8, 0xf1, 0x87, 0xc8, 0xf2, 0xc8, 0xf1, 0x9d, 0x3a, 0x8e, 0xbc, 0x8e, 0x1b, 0x81, 0xf2, 0x89, 0x71, 0xb9, 0x12, 0x01, 0xc8, 0xf1, 0x80, 0xc8, 0xf2, 0x02, 0xc8, 0xf1, 0x82, 0xc8, 0xf2, 0xc8, 0xd1, 0xc1, 0x12, 0x02, 0xc8, 0xf2, 0x8a, 0xc8, 0xd1, 0xc8, 0xf2, 0xc8, 0xd1, 0xc8, 0xf2, 0xc0, 0xf1, 0xc8, 0xf1, 0xc8, 0xf2, 0xc8, 0xf1, 0xc8, 0xf2, 0xc0, 0xf1, 0xa4, 0x98, 0x07, 0x8e, 0xbc, 0x80, 0x8d, 0xba, 0x01, 0x89, 0x91, 0x8e, 0xc0, 0xf1, 0xc8, 0xf2, 0xc0, 0xf2, 0xc8, 0xf1, 0xc8, 0xf2, 0xc8, 0xf1, 0xc0, 0xf1, 0xc8, 0xf2, 0xc8, 0xf1, 0xc8, 0xf2, 0xc0, 0xf2, 0xc8, 0xf1, 0xc0, 0xf1, 0xc8, 0xf2, 0xc8, 0xf1, 0x02, 0xc8, 0xf2, 0x01, 0xc8, 0xf1, 0x85, 0xc0, 0xf2, 0xc1, 0x32, 0x8e, 0x5c, 0x8c, 0x17, 0x81, 0x91, 0xa9, 0x31, 0x03, 0xc8, 0xf2, 0x80, 0xc8, 0xf1, 0x01, 0xc8, 0xf2, 0x80, 0x9d, 0x59, 0x03, 0x8e, 0xbc, 0x82, 0x8c, 0x17, 0x81, 0x91, 0xa9, 0x51, 0x01, 0xc8, 0xf1, 0x80, 0xc8, 0xf2, 0x01, 0xc8, 0xf1, 0x82, 0xc8, 0xf2, 0xc8, 0xf1, 0x9d, 0x5a, 0x03, 0x8e, 0xbc, 0x84, 0x8e, 0xbd, 0x8d, 0xba, 0x81, 0xf2, 0x89, 0x91, 0xc1, 0x11, 0x02, 0xc8, 0xf1, 0x80, 0xc0, 0xf2, 0x01, 0xc8, 0xf1, 0x83, 0xc0, 0xf2, 0xc8, 0xd2, 0xc8, 0xf1, 0xc8, 0xf2, 0x01, 0xc0, 0xf1, 0x82, 0xc8, 0xf2, 0xc0, 0xf1, 0xc8, 0xf1, 0x01, 0xc8, 0xf2, 0x01, 0xc8, 0xf1, 0x84, 0xc8, 0xf2, 0xc1, 0x52, 0x95, 0xfb, 0xa4, 0xb8, 0xc1, 0x52, 0x02, 0xc9, 0x52, 0x80, 0xc9, 0x72, 0x06, 0xc9, 0x52, 0x02, 0x00, 0x1f, 0x82, 0x00, 0x7f, 0x00, 0xdf, 0x68, 0xb7, 0x03, 0xc0, 0xb1, 0x8c, 0xa8, 0xf3, 0x04, 0x1f, 0x05, 0x7f, 0x05, 0x3f, 0x05, 0x1f, 0x05, 0xf9, 0x07, 0xf0, 0x07, 0xf6, 0x07, 0xfc, 0x07, 0xff, 0x5c, 0x78, 0xb0, 0xf1, 0xb0, 0xd1, 0x01, 0xb0, 0xf1, 0x80, 0x59, 0x12, 0x01, 0xb0, 0xf1, 0x81, 0x90, 0xf1, 0x30, 0xf0, 0x01, 0x30, 0xef, 0x81, 0x28, 0xcf, 0x28, 0xce, 0x01, 0x20, 0xce, 0x83, 0x20, 0xae, 0x20, 0xce, 0x20, 0xad, 0x20, 0xae, 0x16, 0x18, 0xad,
+  0x15, 0x18, 0xad, 0x80, 0x18, 0xae, 0x0e, 0x18, 0xad, 0x80, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x81, 0x01, 0x17, 0x00, 0xf7, 0x01, 0x01, 0x19, 0x81, 0x08, 0xf5, 0x18, 0xae, 0x03, 0x18, 0xad, 0x80, 0x18, 0xae, 0x09, 0x18, 0xad, 0x02, 0xc9, 0x32, 0x06, 0x8e, 0xbc, 0x84, 0x8d, 0x79, 0x81, 0x91, 0x91, 0x71, 0xc1, 0x32, 0xc1, 0x31, 0x01, 0xc9, 0x12, 0x83, 0xc1, 0x32, 0xc9, 0x11, 0xc9, 0x12, 0xab, 0xf7, 0x08, 0x8e, 0xbc, 0x85, 0x96, 0xbc, 0x8c, 0x36, 0x81, 0x91, 0xa9, 0x51, 0xc9, 0x12, 0xc9, 0x11, 0x01, 0xc9, 0x12, 0x80, 0xc1, 0x12, 0x01, 0xc9, 0x12, 0x80, 0xab, 0xf7, 0x09, 0x8e, 0xbc, 0x82, 0x8c, 0x36, 0x81, 0x91, 0xa9, 0x51, 0x02, 0xc9, 0x12, 0x01, 0xc9, 0x11, 0x01, 0xc9, 0x12, 0x86, 0x9d, 0x59, 0x8e, 0xbc, 0x8a, 0xd4, 0x81, 0x91, 0xb1, 0x52, 0xc9, 0x12, 0xc1, 0x31, 0x05, 0xc9, 0x12, 0x80, 0xc9, 0x32, 0x03, 0xc9, 0x12, 0x82, 0xc9, 0x11, 0xc1, 0x12, 0xc9, 0x32, 0x01, 0xc9, 0x12, 0x81, 0xc9, 0x32, 0xc9, 0x11, 0x01, 0xc9, 0x12, 0x93, 0xc9, 0x32, 0xc1, 0x31, 0x9d, 0xba, 0x8e, 0xbc, 0x96, 0xbc, 0x8e, 0xbc, 0x8e, 0xdc, 0x96, 0xbb, 0x8e, 0xbc, 0x8e, 0xdc, 0x82, 0xd4, 0x81, 0x91, 0xb9, 0x32, 0xc9, 0x12, 0xc1, 0x12, 0xc9, 0x12, 0xc1, 0x12, 0xc9, 0x12, 0xc1, 0x12, 0xc9, 0x12, 0x01, 0xc9, 0x11, 0x85, 0xc9, 0x32, 0xc9, 0x11, 0xc1, 0x31, 0xc9, 0x12, 0xc1, 0x32, 0xc1, 0x31, 0x01, 0xc9, 0x12, 0x01, 0xc9, 0x11, 0x80, 0xc1, 0x31, 0x01, 0xc9, 0x12, 0x83, 0xb3, 0x56, 0x8c, 0x36, 0x81, 0x91, 0xa1, 0x51, 0x05, 0xc9, 0x12, 0x83, 0xc1, 0x12, 0x9d, 0x59, 0x8e, 0xbc, 0x96, 0xbc, 0x01, 0x8e, 0xbc, 0x82, 0x8c, 0x37, 0x81, 0x91, 0xa9, 0x51, 0x02, 0xc9, 0x12, 0x01, 0xc9, 0x11, 0x01, 0xc9, 0x12, 0x80, 0x9d, 0x59, 0x02, 0x8e, 0xbc, 0x84, 0x96, 0xbc, 0x8e, 0xbc, 0x82, 0xf4, 0x89, 0x91, 0xb1, 0x51, 0x01, 0xc9, 0x12, 0x80, 0xc9, 0x32, 0x01, 0xc9, 0x12, 0x82, 0xc1, 0x31, 0xc9, 0x32, 0xc9, 0x12, 0x01, 0xc9, 0x11, 0x83, 0xc9, 0x32, 0xc9, 0x11, 0xc9, 0x12, 0xc9, 0x11, 0x01, 0xc9, 0x32, 0x82, 0xc1, 0x12, 0xc9, 0x11, 0xc1, 0x32, 0x01, 0xc9, 0x12, 0x84, 0xc9, 0x32, 0xb3, 0x36, 0x96, 0xbc, 0xa4, 0xf9, 0xc1, 0x92, 0x09, 0xc9, 0x32, 0x02, 0x00, 0x1f, 0x83, 0x00, 0x7f, 0x00, 0xbf, 0x00, 0x9f, 0x90, 0xb5, 0x03, 0xc0, 0xb1, 0x8a, 0x0b, 0x9e, 0x05, 0x3f, 0x05, 0x7f, 0x05, 0x3f, 0x05, 0xda, 0x07, 0xef, 0x07, 0xf5, 0x07, 0xfb, 0x07, 0xff, 0x54, 0x78, 0xb0, 0xd1, 0x01, 0xb0, 0xf1, 0x88, 0x91, 0x11, 0x59, 0x12, 0xa8, 0xf1, 0xb0, 0xf1, 0x70, 0xf1, 0x30, 0xf0, 0x28, 0xef, 0x20, 0xef, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x01, 0x20, 0xae, 0x81, 0x20, 0xad, 0x20, 0xae, 0x16, 0x18, 0xad,
+  0x14, 0x18, 0xad, 0x81, 0x18, 0xae, 0x18, 0xad, 0x01, 0x20, 0xad, 0x0b, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf3, 0x01, 0x18, 0xad, 0x80, 0x08, 0xf3, 0x01, 0x01, 0x19, 0x0f, 0x18, 0xad, 0x02, 0xc9, 0x12, 0x02, 0x9e, 0xdb, 0x80, 0x9e, 0xdc, 0x02, 0x9e, 0xdb, 0x82, 0x95, 0x78, 0x81, 0x91, 0x99, 0x91, 0x06, 0xc9, 0x52, 0x80, 0xb4, 0x17, 0x09, 0x9e, 0xdb, 0x82, 0x94, 0x36, 0x81, 0x91, 0xa9, 0x72, 0x06, 0xc9, 0x52, 0x82, 0xa5, 0x18, 0x9e, 0xdb, 0x96, 0xdb, 0x07, 0x9e, 0xdb, 0x82, 0x94, 0x36, 0x81, 0x91, 0xa1, 0x71, 0x06, 0xc9, 0x52, 0x83, 0xa5, 0x79, 0x94, 0xd8, 0x81, 0x91, 0x99, 0x91, 0x04, 0xc9, 0x52, 0x80, 0xc1, 0x52, 0x04, 0xc9, 0x52, 0x85, 0xc2, 0x53, 0xc2, 0xb4, 0xb9, 0x52, 0xc1, 0x52, 0xc9, 0x52, 0xc1, 0x52, 0x07, 0xc9, 0x52, 0x80, 0xba, 0xb5, 0x05, 0x9e, 0xdb, 0x82, 0x95, 0x99, 0x81, 0x91, 0x91, 0xb1, 0x09, 0xc9, 0x52, 0x83, 0xc1, 0xf3, 0xc2, 0xb5, 0xb9, 0x52, 0xc1, 0x52, 0x04, 0xc9, 0x52, 0x80, 0xc9, 0x72, 0x01, 0xc9, 0x52, 0x84, 0xc9, 0x72, 0xc1, 0xb2, 0x94, 0x36, 0x81, 0x91, 0xa9, 0x72, 0x06, 0xc9, 0x52, 0x80, 0xa5, 0x79, 0x03, 0x9e, 0xdb, 0x82, 0x8c, 0x36, 0x89, 0x91, 0xa1, 0x71, 0x06, 0xc9, 0x52, 0x82, 0xa5, 0x79, 0x9e, 0xdb, 0x9e, 0xdc, 0x01, 0x9e, 0xdb, 0x82, 0x95, 0x98, 0x81, 0x91, 0x91, 0x91, 0x03, 0xc9, 0x52, 0x82, 0xc1, 0x52, 0xc9, 0x52, 0xc1, 0x72, 0x02, 0xc9, 0x52, 0x83, 0xc1, 0xf3, 0xc2, 0xb4, 0xb9, 0x52, 0xc1, 0x52, 0x09, 0xc9, 0x52, 0x84, 0xa6, 0x1a, 0x9e, 0xdc, 0xa5, 0xda, 0xc1, 0x72, 0xc9, 0x12, 0x01, 0xc9, 0x11, 0x01, 0xc9, 0x12, 0x80, 0xc1, 0x11, 0x02, 0xc9, 0x12, 0x02, 0x00, 0x1f, 0x80, 0x00, 0x5f, 0x01, 0x00, 0x7f, 0x82, 0x60, 0x98, 0xc0, 0xb1, 0xb8, 0xb1, 0x01, 0xc0, 0xb1, 0x89, 0x2a, 0xfc, 0x04, 0xff, 0x05, 0xbf, 0x05, 0x5f, 0x05, 0xfb, 0x07, 0xcf, 0x07, 0xf4, 0x07, 0xfc, 0x07, 0xff, 0x5c, 0x79, 0x02, 0xb0, 0xf1, 0x81, 0x81, 0x12, 0x59, 0x12, 0x01, 0xb0, 0xf1, 0x85, 0x68, 0xf1, 0x30, 0xf0, 0x30, 0xef, 0x30, 0xcf, 0x28, 0xcf, 0x20, 0xcf, 0x01, 0x20, 0xce, 0x01, 0x20, 0xae, 0x81, 0x20, 0xad, 0x20, 0xae, 0x16, 0x18, 0xad,
+  0x14, 0x18, 0xad, 0x81, 0x18, 0xce, 0x00, 0xf7, 0x0f, 0x01, 0x19, 0x81, 0x00, 0xf9, 0x18, 0xd0, 0x01, 0x18, 0xad, 0x80, 0x10, 0xd0, 0x01, 0x01, 0x19, 0x0f, 0x18, 0xad, 0x01, 0xc8, 0xf1, 0x81, 0xc8, 0xf2, 0xa6, 0xfb, 0x01, 0xa6, 0xfa, 0x87, 0xa6, 0xfb, 0xa6, 0xfa, 0xa6, 0xda, 0xa6, 0xfa, 0x9d, 0x98, 0x81, 0x91, 0x91, 0x91, 0xc9, 0x72, 0x01, 0xc9, 0x92, 0x80, 0xc9, 0x72, 0x02, 0xc9, 0x92, 0x81, 0xb4, 0x36, 0xa6, 0xfb, 0x08, 0xa6, 0xfa, 0x82, 0x94, 0x36, 0x81, 0x91, 0xa9, 0x92, 0x01, 0xc9, 0x92, 0x02, 0xc9, 0x72, 0x01, 0xc9, 0x92, 0x80, 0xad, 0x98, 0x01, 0xa6, 0xda, 0x07, 0xa6, 0xfa, 0x83, 0x94, 0x36, 0x81, 0x91, 0xa9, 0x92, 0xc9, 0x93, 0x05, 0xc9, 0x92, 0x83, 0xad, 0x99, 0x8a, 0x32, 0x89, 0x91, 0xc1, 0x92, 0x01, 0xc9, 0x92, 0x80, 0xc9, 0x72, 0x01, 0xc9, 0x92, 0x80, 0xc9, 0x73, 0x02, 0xc9, 0x92, 0x81, 0xbc, 0x36, 0xa6, 0x9a, 0x01, 0xa6, 0xfa, 0x84, 0xa6, 0x9a, 0x93, 0x95, 0x89, 0x91, 0xb9, 0x92, 0xc9, 0x93, 0x01, 0xc9, 0x72, 0x01, 0xc9, 0x92, 0x81, 0xc9, 0x72, 0xc9, 0x92, 0x01, 0xc9, 0x72, 0x88, 0xad, 0x98, 0xa6, 0xdb, 0xa6, 0xda, 0xa6, 0xfa, 0xa6, 0xfb, 0xa6, 0xfa, 0x93, 0x95, 0x81, 0x91, 0xb1, 0x92, 0x02, 0xc9, 0x92, 0x80, 0xc9, 0x93, 0x01, 0xc9, 0x72, 0x8a, 0xc9, 0x92, 0xc9, 0x72, 0xc2, 0x33, 0xad, 0x98, 0xa6, 0xfa, 0xa6, 0xfb, 0xa6, 0x39, 0x8a, 0x93, 0x99, 0x92, 0xc1, 0x92, 0xc9, 0x72, 0x02, 0xc9, 0x92, 0x81, 0xc9, 0x72, 0xc9, 0x92, 0x01, 0xc9, 0x72, 0x82, 0x9a, 0x93, 0x81, 0x91, 0xa9, 0x92, 0x06, 0xc9, 0x92, 0x82, 0xad, 0x98, 0xa6, 0xfa, 0xa6, 0xfb, 0x01, 0xa6, 0xfa, 0x83, 0x94, 0x36, 0x81, 0x91, 0xa9, 0x92, 0xc9, 0x93, 0x05, 0xc9, 0x92, 0x80, 0xad, 0x98, 0x01, 0xa6, 0xda, 0x87, 0xa6, 0xfa, 0xa6, 0xda, 0x8b, 0x95, 0x81, 0x91, 0xb1, 0x92, 0xc9, 0x72, 0xc9, 0x92, 0xc9, 0x72, 0x01, 0xc9, 0x92, 0x8c, 0xc9, 0x72, 0xc9, 0x92, 0xc9, 0x72, 0xc2, 0x94, 0xad, 0xf9, 0xa6, 0xfa, 0xa6, 0xda, 0xa6, 0x9a, 0x93, 0x34, 0x91, 0x91, 0xb9, 0x92, 0xc9, 0x92, 0xc9, 0x93, 0x05, 0xc9, 0x92, 0x80, 0xb4, 0x97, 0x01, 0xae, 0xfb, 0x84, 0xb5, 0xd9, 0xc9, 0x52, 0xc8, 0xf1, 0xc8, 0xf2, 0xc0, 0xf1, 0x04, 0xc8, 0xf1, 0x02, 0x00, 0x1f, 0x91, 0x00, 0x3f, 0x00, 0x7f, 0x00, 0x5f, 0x78, 0x97, 0xc0, 0xb1, 0xc0, 0xd1, 0xc0, 0xb1, 0xb8, 0xd1, 0x62, 0x38, 0x04, 0xdf, 0x05, 0xbf, 0x05, 0x9f, 0x05, 0xfa, 0x07, 0xce, 0x07, 0xf4, 0x07, 0xfc, 0x07, 0xff, 0x5c, 0x78, 0x02, 0xb0, 0xf1, 0x86, 0x71, 0x12, 0x59, 0x12, 0xb0, 0xf1, 0xa8, 0xf1, 0x51, 0x10, 0x30, 0xf0, 0x30, 0xcf, 0x02, 0x28, 0xcf, 0x80, 0x20, 0xae, 0x01, 0x20, 0xce, 0x81, 0x20, 0xae, 0x20, 0xad, 0x17, 0x18, 0xad,
+  0x13, 0x18, 0xad, 0x81, 0x18, 0xce, 0x00, 0xf7, 0x04, 0x01, 0x19, 0x80, 0x01, 0x1a, 0x0b, 0x01, 0x19, 0x80, 0x08, 0xf3, 0x01, 0x18, 0xad, 0x80, 0x08, 0xf3, 0x01, 0x01, 0x19, 0x0d, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xad, 0x01, 0xc0, 0xd1, 0x80, 0xc8, 0xd2, 0x02, 0xb7, 0x1a, 0x86, 0xae, 0xfa, 0xb7, 0x1a, 0xaf, 0x1a, 0xae, 0xfa, 0xa5, 0x98, 0x81, 0x91, 0x91, 0x91, 0x01, 0xc9, 0xb3, 0x01, 0xc9, 0xd3, 0x83, 0xc9, 0xb2, 0xc9, 0xb3, 0xc9, 0xd3, 0xbc, 0x76, 0x09, 0xb7, 0x1a, 0x82, 0x9c, 0x55, 0x81, 0x91, 0xa9, 0xb2, 0x01, 0xc9, 0xd3, 0x82, 0xc9, 0xb3, 0xc9, 0xb2, 0xc9, 0xb3, 0x01, 0xc9, 0xd3, 0x84, 0xb5, 0xb8, 0xb7, 0x1a, 0xaf, 0x1a, 0xb7, 0x1a, 0xb6, 0xfa, 0x03, 0xb7, 0x1a, 0x84, 0xb6, 0xfa, 0xaf, 0x1a, 0x9c, 0x56, 0x81, 0x91, 0xa9, 0x92, 0x06, 0xc9, 0xb3, 0x95, 0xa3, 0xb5, 0x81, 0x91, 0x99, 0x92, 0xc9, 0xb2, 0xc9, 0xb3, 0xc9, 0xd2, 0xc9, 0xb2, 0xc9, 0xb3, 0xc9, 0xb2, 0xc9, 0xb3, 0xc9, 0xd3, 0xca, 0x13, 0xbd, 0xb8, 0xae, 0xfa, 0xaf, 0x1a, 0xb7, 0x1a, 0xb6, 0xfa, 0xae, 0xfa, 0xaf, 0x19, 0xa4, 0xf7, 0x89, 0x91, 0xb1, 0xb2, 0x04, 0xc9, 0xb3, 0x80, 0xc9, 0xd2, 0x01, 0xc9, 0xb3, 0x80, 0xc3, 0x14, 0x01, 0xaf, 0x1a, 0x80, 0xae, 0xf9, 0x01, 0xaf, 0x1a, 0x82, 0x89, 0xf1, 0x81, 0x91, 0xc1, 0xb2, 0x02, 0xc9, 0xb3, 0x01, 0xc9, 0xb2, 0x8b, 0xc9, 0xd3, 0xc9, 0xb3, 0xca, 0xb4, 0xb6, 0xb9, 0xaf, 0x1a, 0xb7, 0x1a, 0xae, 0xfa, 0xb7, 0x1a, 0xb6, 0xb9, 0x8a, 0x93, 0x89, 0x91, 0xc1, 0xd2, 0x03, 0xc9, 0xb3, 0x88, 0xc9, 0xb2, 0xc9, 0xd3, 0xc9, 0xb2, 0xa9, 0x92, 0x81, 0x91, 0xa9, 0xb2, 0xc9, 0xd3, 0xc9, 0xb3, 0xc9, 0xd3, 0x02, 0xc9, 0xb2, 0x88, 0xc9, 0xb3, 0xb5, 0xb8, 0xaf, 0x1a, 0xae, 0xfa, 0xaf, 0x1a, 0xb7, 0x1a, 0x9c, 0x56, 0x81, 0x91, 0xa9, 0x92, 0x06, 0xc9, 0xb3, 0x81, 0xb5, 0xb8, 0xb6, 0xfa, 0x01, 0xaf, 0x1a, 0x86, 0xb6, 0xfa, 0x89, 0xf2, 0x81, 0x91, 0xc1, 0xb2, 0xc9, 0xb3, 0xc9, 0xb2, 0xc9, 0xd3, 0x01, 0xc9, 0xb3, 0x84, 0xc9, 0xb2, 0xc9, 0xd3, 0xca, 0xb4, 0xb6, 0xb9, 0xaf, 0x1a, 0x01, 0xb7, 0x1a, 0x85, 0xb6, 0xfa, 0xb7, 0x1a, 0x92, 0xf3, 0x89, 0xb1, 0xc1, 0xb2, 0xc9, 0xd3, 0x01, 0xc9, 0xb3, 0x01, 0xc9, 0xd3, 0x82, 0xc9, 0xb3, 0xc9, 0xd3, 0xc3, 0x15, 0x02, 0xb7, 0x1a, 0x82, 0xbd, 0xd9, 0xc1, 0x32, 0xc0, 0xd1, 0x03, 0xc8, 0xd1, 0x01, 0xc0, 0xd1, 0x02, 0x00, 0x1f, 0x80, 0x00, 0x3f, 0x01, 0x00, 0x7f, 0x86, 0x68, 0x78, 0xb8, 0xb1, 0xc0, 0xb1, 0xc0, 0xd1, 0xb8, 0xd1, 0x99, 0x54, 0x04, 0x7f, 0x01, 0x05, 0xbf, 0x85, 0x06, 0x1a, 0x07, 0xce, 0x07, 0xf2, 0x07, 0xfc, 0x07, 0xff, 0x5c, 0x78, 0x02, 0xb0, 0xf1, 0x81, 0x61, 0x12, 0x59, 0x12, 0x01, 0xa8, 0xf1, 0x82, 0x60, 0xf0, 0x30, 0xf0, 0x28, 0xef, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xce, 0x02, 0x20, 0xce, 0x81, 0x20, 0xae, 0x20, 0xad, 0x17, 0x18, 0xad,
+  0x13, 0x18, 0xad, 0x83, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf7, 0x18, 0xae, 0x0c, 0x18, 0xad, 0x81, 0x20, 0xad, 0x08, 0xf5, 0x01, 0x01, 0x19, 0x01, 0x00, 0xf7, 0x01, 0x01, 0x19, 0x80, 0x08, 0xf4, 0x0e, 0x18, 0xad, 0x83, 0x20, 0xad, 0xc0, 0xb1, 0xc8, 0xb1, 0xc0, 0xb1, 0x06, 0xbf, 0x19, 0x82, 0xa4, 0xb5, 0x81, 0x91, 0xa1, 0xb2, 0x05, 0xc9, 0xf3, 0x81, 0xd1, 0xf3, 0xc4, 0x96, 0x09, 0xbf, 0x19, 0x82, 0xa4, 0x55, 0x81, 0x91, 0xa9, 0xd2, 0x06, 0xc9, 0xf3, 0x80, 0xbd, 0xd8, 0x02, 0xbf, 0x19, 0x80, 0xbf, 0x39, 0x01, 0xbf, 0x19, 0x81, 0xbf, 0x39, 0xbf, 0x19, 0x01, 0xbf, 0x39, 0x82, 0xa4, 0x55, 0x81, 0x91, 0xa9, 0xd2, 0x06, 0xc9, 0xf3, 0x82, 0x99, 0xf2, 0x89, 0x91, 0xb1, 0xd2, 0x06, 0xc9, 0xf3, 0x82, 0xc9, 0xf2, 0xc5, 0x77, 0xbf, 0x19, 0x01, 0xbf, 0x39, 0x04, 0xbf, 0x19, 0x82, 0x9b, 0xf5, 0x81, 0x91, 0xb1, 0xd2, 0x01, 0xc9, 0xf3, 0x80, 0xd1, 0xf3, 0x04, 0xc9, 0xf3, 0x80, 0xbe, 0x78, 0x02, 0xbf, 0x19, 0x82, 0xb6, 0xb9, 0x81, 0x91, 0x89, 0x91, 0x01, 0xc9, 0xf3, 0x80, 0xc9, 0xf2, 0x01, 0xc9, 0xf3, 0x80, 0xc9, 0xd3, 0x01, 0xc9, 0xf3, 0x80, 0xbe, 0xd8, 0x04, 0xbf, 0x19, 0x85, 0xbf, 0x39, 0xad, 0x57, 0x81, 0x91, 0x99, 0xb2, 0xc9, 0xf3, 0xc9, 0xf2, 0x04, 0xc9, 0xf3, 0x82, 0xb9, 0xd3, 0x81, 0x91, 0xa9, 0xb2, 0x06, 0xc9, 0xf3, 0x80, 0xbd, 0xd8, 0x03, 0xbf, 0x19, 0x82, 0x9c, 0x75, 0x81, 0x91, 0xa9, 0xd2, 0x06, 0xc9, 0xf3, 0x80, 0xbd, 0xd8, 0x02, 0xbf, 0x19, 0x80, 0xb6, 0xb8, 0x01, 0x81, 0x91, 0x07, 0xc9, 0xf3, 0x84, 0xbe, 0x78, 0xbf, 0x19, 0xbf, 0x39, 0xbf, 0x19, 0xbf, 0x39, 0x01, 0xbf, 0x19, 0x82, 0xad, 0xb7, 0x81, 0x91, 0x91, 0xb1, 0x02, 0xc9, 0xf3, 0x80, 0xc9, 0xf2, 0x03, 0xc9, 0xf3, 0x87, 0xc7, 0x1a, 0xbf, 0x1a, 0xc7, 0x3a, 0xbf, 0x3a, 0xc6, 0x59, 0xc9, 0xd3, 0xc0, 0xb1, 0xc8, 0xb1, 0x01, 0xc0, 0xb1, 0x81, 0xc8, 0xb1, 0xc0, 0xb1, 0x02, 0x00, 0x1f, 0x85, 0x00, 0x3f, 0x00, 0x5f, 0x00, 0x3f, 0x00, 0x1f, 0x70, 0x76, 0xc0, 0xd1, 0x02, 0xb8, 0xd1, 0x88, 0x0b, 0xff, 0x05, 0xdf, 0x05, 0xbf, 0x06, 0x39, 0x07, 0xcd, 0x07, 0xf2, 0x07, 0xfc, 0x07, 0xff, 0x63, 0xf7, 0x02, 0xb0, 0xf1, 0x88, 0x41, 0x32, 0x41, 0x11, 0xa0, 0xf1, 0xb0, 0xf1, 0x90, 0xf1, 0x30, 0xf0, 0x28, 0xef, 0x28, 0xce, 0x28, 0xcf, 0x03, 0x20, 0xce, 0x81, 0x20, 0xae, 0x20, 0xad, 0x17, 0x18, 0xad,
+  0x11, 0x18, 0xad, 0x84, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf8, 0x10, 0xd0, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x0b, 0x18, 0xad, 0x81, 0x18, 0xce, 0x00, 0xf7, 0x03, 0x01, 0x19, 0x83, 0x00, 0xf7, 0x18, 0xce, 0x18, 0xad, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x81, 0x18, 0xcd, 0x18, 0xae, 0x08, 0x18, 0xad, 0x80, 0x20, 0xae, 0x02, 0xc0, 0xb1, 0x06, 0xc7, 0x38, 0x83, 0xa4, 0x75, 0x89, 0x91, 0xa9, 0xd2, 0xca, 0x13, 0x01, 0xca, 0x33, 0x81, 0xca, 0x34, 0xca, 0x13, 0x01, 0xca, 0x33, 0x80, 0xcc, 0xb6, 0x09, 0xc7, 0x38, 0x82, 0xa4, 0x55, 0x81, 0x91, 0xa9, 0xd2, 0x01, 0xca, 0x33, 0x80, 0xca, 0x13, 0x02, 0xca, 0x33, 0x81, 0xd2, 0x13, 0xc5, 0xf7, 0x03, 0xc7, 0x38, 0x80, 0xc7, 0x39, 0x04, 0xc7, 0x38, 0x83, 0xa4, 0x75, 0x81, 0x91, 0xa9, 0xd2, 0xca, 0x13, 0x03, 0xca, 0x33, 0x84, 0xca, 0x13, 0xca, 0x33, 0x91, 0xb1, 0x81, 0x91, 0xca, 0x13, 0x03, 0xca, 0x33, 0x85, 0xca, 0x13, 0xca, 0x33, 0xca, 0x13, 0xc4, 0x55, 0xc7, 0x38, 0xc7, 0x39, 0x03, 0xc7, 0x38, 0x80, 0xc7, 0x39, 0x02, 0xc7, 0x38, 0x82, 0x8a, 0x52, 0x89, 0x91, 0xc2, 0x13, 0x03, 0xca, 0x13, 0x83, 0xca, 0x33, 0xca, 0x13, 0xca, 0x33, 0xcd, 0x56, 0x01, 0xc7, 0x38, 0x83, 0xc7, 0x39, 0xb5, 0xd7, 0x81, 0x91, 0x91, 0xb1, 0x02, 0xca, 0x13, 0x80, 0xd2, 0x33, 0x02, 0xca, 0x33, 0x81, 0xcb, 0x55, 0xcf, 0x38, 0x04, 0xc7, 0x38, 0x81, 0xc7, 0x39, 0xc7, 0x38, 0x01, 0x81, 0x91, 0x02, 0xca, 0x13, 0x86, 0xca, 0x33, 0xca, 0x13, 0xca, 0x33, 0xd2, 0x33, 0xca, 0x13, 0x81, 0x91, 0xa9, 0xd2, 0x01, 0xca, 0x33, 0x01, 0xca, 0x13, 0x83, 0xca, 0x33, 0xca, 0x13, 0xca, 0x33, 0xcd, 0xf7, 0x02, 0xc7, 0x38, 0x84, 0xc7, 0x39, 0xa4, 0x75, 0x81, 0x91, 0xa9, 0xd2, 0xca, 0x13, 0x03, 0xca, 0x33, 0x82, 0xca, 0x13, 0xca, 0x33, 0xc5, 0xf7, 0x02, 0xc7, 0x38, 0x82, 0xb5, 0xd6, 0x81, 0x91, 0x99, 0xb2, 0x01, 0xca, 0x33, 0x80, 0xd2, 0x13, 0x03, 0xca, 0x33, 0x81, 0xcb, 0x74, 0xc7, 0x39, 0x03, 0xc7, 0x38, 0x80, 0xc7, 0x39, 0x01, 0xc7, 0x38, 0x82, 0x8a, 0xb2, 0x81, 0x91, 0xba, 0x13, 0x01, 0xca, 0x13, 0x81, 0xca, 0x33, 0xca, 0x13, 0x01, 0xca, 0x33, 0x87, 0xca, 0x13, 0xcf, 0x39, 0xc7, 0x39, 0xc7, 0x59, 0xcf, 0x3a, 0xcf, 0x39, 0xce, 0xd9, 0xc9, 0xf3, 0x04, 0xc0, 0xb1, 0x03, 0x00, 0x1f, 0x01, 0x00, 0x3f, 0x01, 0x00, 0x1f, 0x80, 0x98, 0x94, 0x02, 0xb8, 0xd1, 0x8e, 0x42, 0xda, 0x05, 0x9f, 0x05, 0xff, 0x06, 0x78, 0x07, 0xcc, 0x07, 0xf1, 0x07, 0xfc, 0x07, 0xff, 0x82, 0xb5, 0xa8, 0xf1, 0xb0, 0xf1, 0x98, 0xf2, 0x41, 0x32, 0x39, 0x12, 0x70, 0xf1, 0x01, 0xa8, 0xf1, 0x80, 0x50, 0xf0, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xce, 0x03, 0x20, 0xce, 0x01, 0x20, 0xae, 0x17, 0x18, 0xad,
+  0x10, 0x18, 0xad, 0x84, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf8, 0x10, 0xcf, 0x0e, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x83, 0x10, 0xd2, 0x10, 0xd3, 0x08, 0xf3, 0x10, 0xd2, 0x03, 0x18, 0xad, 0x80, 0x20, 0xad, 0x0a, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xad, 0x02, 0xc0, 0xb1, 0x80, 0xcf, 0x57, 0x01, 0xd7, 0x58, 0x89, 0xcf, 0x58, 0xd7, 0x58, 0xcf, 0x58, 0xd7, 0x58, 0xac, 0x74, 0x81, 0x91, 0xa9, 0xf2, 0xca, 0x53, 0xd2, 0x53, 0xca, 0x54, 0x02, 0xca, 0x53, 0x82, 0xca, 0x54, 0xcc, 0xd6, 0xcf, 0x58, 0x07, 0xd7, 0x58, 0x83, 0xcf, 0x58, 0xac, 0x75, 0x81, 0x91, 0xa9, 0xf2, 0x01, 0xca, 0x53, 0x80, 0xd2, 0x53, 0x02, 0xca, 0x53, 0x86, 0xd2, 0x54, 0xce, 0x17, 0xcf, 0x57, 0xd7, 0x58, 0xcf, 0x58, 0xd7, 0x58, 0xcf, 0x58, 0x01, 0xd7, 0x58, 0x88, 0xcf, 0x58, 0xd7, 0x58, 0xcf, 0x58, 0xac, 0x74, 0x81, 0x91, 0xa9, 0xf2, 0xca, 0x53, 0xca, 0x54, 0xd2, 0x53, 0x01, 0xca, 0x53, 0x83, 0xca, 0x54, 0xca, 0x53, 0x99, 0xd2, 0x89, 0xb1, 0x03, 0xca, 0x53, 0x80, 0xd2, 0x53, 0x01, 0xca, 0x53, 0x8e, 0xca, 0x54, 0xd6, 0xb7, 0xd7, 0x58, 0xcf, 0x58, 0xcf, 0x57, 0xcf, 0x58, 0xd7, 0x58, 0xd7, 0x57, 0xd7, 0x58, 0xd7, 0x57, 0xd7, 0x58, 0xcf, 0x58, 0xb5, 0x35, 0x81, 0x91, 0xa1, 0xd2, 0x02, 0xca, 0x53, 0x81, 0xd2, 0x54, 0xca, 0x73, 0x01, 0xca, 0x53, 0x80, 0xcc, 0x95, 0x01, 0xd7, 0x58, 0x83, 0xcf, 0x58, 0xbd, 0xd6, 0x81, 0x91, 0x99, 0xd2, 0x01, 0xca, 0x53, 0x80, 0xca, 0x54, 0x01, 0xca, 0x53, 0x82, 0xd2, 0x54, 0xca, 0x54, 0xd4, 0x35, 0x01, 0xd7, 0x58, 0x80, 0xcf, 0x58, 0x01, 0xd7, 0x58, 0x86, 0xcf, 0x57, 0xd7, 0x38, 0xcf, 0x58, 0x9a, 0xf3, 0x89, 0x91, 0xc2, 0x13, 0xca, 0x54, 0x01, 0xca, 0x53, 0x86, 0xd2, 0x53, 0xca, 0x53, 0xca, 0x54, 0xca, 0x73, 0x81, 0x91, 0xa9, 0xf2, 0xca, 0x53, 0x01, 0xd2, 0x53, 0x85, 0xca, 0x54, 0xd2, 0x53, 0xca, 0x53, 0xca, 0x54, 0xce, 0x17, 0xcf, 0x58, 0x01, 0xd7, 0x58, 0x86, 0xcf, 0x58, 0xac, 0x74, 0x81, 0x91, 0xa9, 0xf2, 0xca, 0x53, 0xca, 0x54, 0xd2, 0x53, 0x01, 0xca, 0x53, 0x83, 0xca, 0x54, 0xca, 0x53, 0xd6, 0x17, 0xd7, 0x58, 0x01, 0xcf, 0x58, 0x84, 0xbd, 0xd6, 0x81, 0x91, 0x91, 0xb2, 0xca, 0x53, 0xd2, 0x54, 0x01, 0xca, 0x53, 0x80, 0xca, 0x54, 0x01, 0xd2, 0x53, 0x80, 0xcc, 0xd6, 0x03, 0xd7, 0x58, 0x8d, 0xcf, 0x57, 0xd7, 0x57, 0xcf, 0x58, 0xd7, 0x58, 0x9a, 0xf3, 0x81, 0x91, 0xba, 0x33, 0xca, 0x54, 0xca, 0x53, 0xd2, 0x53, 0xca, 0x54, 0xca, 0x53, 0xd2, 0x53, 0xca, 0x53, 0x01, 0xd7, 0x58, 0x81, 0xdf, 0x59, 0xd7, 0x79, 0x01, 0xd7, 0x59, 0x81, 0xd6, 0xf9, 0xc1, 0xf2, 0x03, 0xc0, 0xb1, 0x02, 0x00, 0x1f, 0x80, 0x00, 0x3f, 0x03, 0x00, 0x1f, 0x81, 0x18, 0x3e, 0xb0, 0xd2, 0x01, 0xb8, 0xd1, 0x88, 0x99, 0x74, 0x05, 0x9f, 0x06, 0x1f, 0x06, 0x98, 0x07, 0xcc, 0x07, 0xf0, 0x07, 0xfc, 0x07, 0xff, 0x82, 0xb5, 0x01, 0xb0, 0xf1, 0x89, 0x88, 0xf1, 0x41, 0x32, 0x41, 0x11, 0x39, 0x10, 0x98, 0xf1, 0xa8, 0xf2, 0x88, 0xf1, 0x28, 0xef, 0x28, 0xcf, 0x28, 0xce, 0x03, 0x20, 0xce, 0x01, 0x20, 0xae, 0x17, 0x18, 0xad,
+  0x0f, 0x18, 0xad, 0x86, 0x18, 0xae, 0x01, 0x17, 0x01, 0x19, 0x01, 0x18, 0x10, 0xd0, 0x18, 0xad, 0x18, 0xae, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x08, 0x18, 0xad, 0x80, 0x18, 0xae, 0x09, 0x18, 0xad, 0x80, 0x20, 0xad, 0x0b, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xad, 0x02, 0xc0, 0xb1, 0x06, 0xdf, 0x77, 0x84, 0xb4, 0x94, 0x81, 0x91, 0xaa, 0x12, 0xca, 0x94, 0xca, 0x74, 0x03, 0xca, 0x94, 0x81, 0xd2, 0x94, 0xd4, 0xf5, 0x09, 0xdf, 0x77, 0x82, 0xb4, 0x74, 0x81, 0x91, 0xaa, 0x12, 0x01, 0xca, 0x94, 0x85, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0xde, 0x36, 0x01, 0xdf, 0x77, 0x80, 0xdf, 0x57, 0x06, 0xdf, 0x77, 0x83, 0xb4, 0x94, 0x81, 0x91, 0xaa, 0x12, 0xca, 0x94, 0x05, 0xd2, 0x94, 0x86, 0x99, 0xd2, 0x91, 0xd2, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x80, 0xd3, 0xd4, 0x02, 0xdf, 0x77, 0x80, 0xdf, 0x76, 0x04, 0xdf, 0x77, 0x80, 0xdf, 0x57, 0x01, 0xdf, 0x77, 0x81, 0x81, 0x91, 0x89, 0x92, 0x02, 0xca, 0x94, 0x84, 0xd2, 0x94, 0xca, 0x94, 0xca, 0x93, 0xca, 0x94, 0xd3, 0xd5, 0x02, 0xdf, 0x77, 0x82, 0xc5, 0xf5, 0x81, 0x91, 0x99, 0xd2, 0x01, 0xca, 0x94, 0x85, 0xd2, 0x73, 0xca, 0x94, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0xd5, 0x15, 0x07, 0xdf, 0x77, 0x82, 0x9b, 0x12, 0x81, 0x91, 0xba, 0x53, 0x01, 0xca, 0x94, 0x86, 0xd2, 0x94, 0xca, 0x94, 0xca, 0x93, 0xd2, 0x94, 0xca, 0x94, 0x81, 0x91, 0xaa, 0x12, 0x02, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x01, 0xd2, 0x94, 0x80, 0xde, 0x36, 0x01, 0xdf, 0x77, 0x85, 0xdf, 0x57, 0xdf, 0x77, 0xb4, 0x74, 0x81, 0x91, 0xaa, 0x12, 0xca, 0x94, 0x05, 0xd2, 0x94, 0x80, 0xde, 0x36, 0x02, 0xdf, 0x77, 0x83, 0xc5, 0xf5, 0x81, 0x91, 0x99, 0xd2, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x80, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x81, 0xca, 0x93, 0xd4, 0xf5, 0x07, 0xdf, 0x77, 0x83, 0x9b, 0x12, 0x81, 0x91, 0xba, 0x53, 0xd2, 0x94, 0x01, 0xca, 0x94, 0x83, 0xd2, 0x94, 0xca, 0x94, 0xd2, 0x94, 0xca, 0x94, 0x05, 0xdf, 0x78, 0x81, 0xe7, 0x79, 0xdf, 0x19, 0x03, 0xc0, 0xb1, 0x08, 0x00, 0x1f, 0x80, 0x38, 0x5b, 0x02, 0xb8, 0xd1, 0x86, 0x2c, 0x3c, 0x06, 0x1f, 0x06, 0xb7, 0x07, 0xcb, 0x07, 0xf0, 0x07, 0xfb, 0x07, 0xff, 0x01, 0xb0, 0xf1, 0x88, 0xa8, 0xf1, 0x79, 0x12, 0x41, 0x32, 0x41, 0x11, 0x39, 0x11, 0x41, 0x10, 0xa0, 0xf1, 0xa8, 0xf1, 0x48, 0xef, 0x01, 0x28, 0xce, 0x03, 0x20, 0xce, 0x81, 0x20, 0xad, 0x20, 0xae, 0x17, 0x18, 0xad,
+  0x0e, 0x18, 0xad, 0x84, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x01, 0x18, 0x10, 0xcf, 0x12, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x80, 0x20, 0x8e, 0x02, 0x18, 0xad, 0x80, 0x20, 0xad, 0x0e, 0x18, 0xad, 0x01, 0xb8, 0xd1, 0x82, 0xc0, 0xd1, 0xe7, 0x76, 0xe7, 0x96, 0x01, 0xe7, 0x97, 0x02, 0xe7, 0x96, 0x82, 0xb4, 0x94, 0x81, 0x91, 0xaa, 0x33, 0x02, 0xd2, 0xb4, 0x81, 0xca, 0xb4, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x81, 0xdd, 0x35, 0xe7, 0x76, 0x08, 0xe7, 0x96, 0x82, 0xb4, 0x74, 0x81, 0x91, 0xaa, 0x33, 0x02, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x85, 0xca, 0xd4, 0xd2, 0xd4, 0xe6, 0x56, 0xef, 0x96, 0xe7, 0x76, 0xe7, 0x97, 0x01, 0xe7, 0x96, 0x81, 0xe7, 0x76, 0xe7, 0x77, 0x02, 0xe7, 0x96, 0x82, 0xb4, 0x94, 0x81, 0x91, 0xaa, 0x33, 0x06, 0xd2, 0xb4, 0x84, 0x99, 0xd2, 0x99, 0xf2, 0xca, 0xb4, 0xd2, 0xb4, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x85, 0xca, 0xd4, 0xd2, 0xb4, 0xd3, 0xf5, 0xe7, 0x77, 0xe7, 0x97, 0xef, 0x97, 0x01, 0xe7, 0x96, 0x81, 0xe7, 0x76, 0xe7, 0x77, 0x02, 0xe7, 0x96, 0x81, 0xe7, 0x77, 0xef, 0x97, 0x01, 0x81, 0x91, 0x01, 0xd2, 0xb4, 0x01, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x81, 0xca, 0xd4, 0xd3, 0xd5, 0x02, 0xe7, 0x96, 0x85, 0xce, 0x15, 0x81, 0x91, 0x99, 0xf2, 0xca, 0xd4, 0xd2, 0xb4, 0xd2, 0xd4, 0x01, 0xd2, 0xb4, 0x85, 0xca, 0xb4, 0xd2, 0xb4, 0xdd, 0x35, 0xe7, 0x77, 0xef, 0x76, 0xe7, 0x96, 0x01, 0xe7, 0x97, 0x86, 0xe7, 0x76, 0xe7, 0x96, 0xe7, 0x76, 0xc5, 0x34, 0xb4, 0x94, 0xcc, 0x15, 0xd3, 0xf5, 0x01, 0xdb, 0xf4, 0x85, 0xdb, 0xf5, 0xd3, 0xf5, 0xd3, 0xf4, 0xcb, 0x34, 0x81, 0x91, 0xaa, 0x32, 0x03, 0xd2, 0xb4, 0x84, 0xd2, 0xd4, 0xd2, 0xb4, 0xca, 0xb4, 0xe6, 0x56, 0xe7, 0x76, 0x01, 0xe7, 0x96, 0x83, 0xe7, 0x76, 0xb4, 0x94, 0x81, 0x91, 0xaa, 0x33, 0x06, 0xd2, 0xb4, 0x80, 0xde, 0x56, 0x02, 0xe7, 0x96, 0x82, 0xce, 0x15, 0x81, 0x91, 0x99, 0xf2, 0x01, 0xd2, 0xb4, 0x82, 0xd2, 0xd4, 0xd2, 0xb4, 0xd2, 0xd4, 0x01, 0xca, 0xd4, 0x80, 0xdd, 0x15, 0x01, 0xe7, 0x96, 0x82, 0xe7, 0x76, 0xe7, 0x96, 0xef, 0x96, 0x02, 0xe7, 0x96, 0x82, 0x9b, 0x13, 0x81, 0x91, 0xba, 0x73, 0x06, 0xd2, 0xb4, 0x84, 0xe7, 0x97, 0xef, 0x97, 0xef, 0x77, 0xef, 0x97, 0xef, 0x78, 0x02, 0xef, 0x98, 0x83, 0xc9, 0x92, 0xb8, 0xd1, 0xc0, 0xd1, 0xc0, 0xb1, 0x09, 0x00, 0x1f, 0x80, 0x70, 0x96, 0x01, 0xb8, 0xd1, 0x86, 0x8a, 0x35, 0x06, 0x3f, 0x06, 0xd6, 0x07, 0xea, 0x07, 0xf1, 0x07, 0xfc, 0x07, 0xff, 0x02, 0xa8, 0xf1, 0x89, 0x61, 0x32, 0x41, 0x32, 0x41, 0x11, 0x38, 0xf1, 0x31, 0x10, 0x48, 0xf0, 0xa8, 0xf1, 0x98, 0xf1, 0x30, 0xcf, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x82, 0x20, 0xae, 0x20, 0xad, 0x20, 0xae, 0x17, 0x18, 0xad,
+  0x0d, 0x18, 0xad, 0x84, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x01, 0x18, 0x18, 0xd0, 0x11, 0x18, 0xad, 0x84, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x18, 0xad, 0x18, 0xcd, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x0d, 0x18, 0xad, 0x02, 0xb8, 0xd1, 0x82, 0xf7, 0x96, 0xf7, 0xb6, 0xf7, 0x96, 0x01, 0xf7, 0x95, 0x84, 0xf7, 0x96, 0xef, 0xb6, 0xbc, 0x93, 0x81, 0x91, 0xaa, 0x52, 0x02, 0xd2, 0xf4, 0x02, 0xd2, 0xf5, 0x81, 0xd2, 0xf4, 0xdd, 0x55, 0x08, 0xf7, 0xb6, 0x84, 0xef, 0xb6, 0xbc, 0x93, 0x81, 0x91, 0xaa, 0x53, 0xd2, 0xf5, 0x05, 0xd2, 0xf4, 0x82, 0xe6, 0x75, 0xf7, 0x96, 0xf7, 0x95, 0x02, 0xf7, 0x96, 0x80, 0xf7, 0xb6, 0x01, 0xf7, 0xb5, 0x84, 0xef, 0x96, 0xf7, 0x96, 0xbc, 0x93, 0x81, 0x91, 0xaa, 0x33, 0x06, 0xd2, 0xf4, 0x01, 0x99, 0xf2, 0x80, 0xd2, 0xf5, 0x01, 0xd2, 0xf4, 0x81, 0xd2, 0xf5, 0xd2, 0xd4, 0x01, 0xd2, 0xf4, 0x80, 0xdc, 0x75, 0x02, 0xf7, 0x95, 0x81, 0xf7, 0x96, 0xf7, 0xb5, 0x03, 0xf7, 0x96, 0x84, 0xef, 0xb6, 0xf7, 0xb5, 0xf7, 0x96, 0x81, 0x91, 0x89, 0x91, 0x06, 0xd2, 0xf4, 0x80, 0xdc, 0x15, 0x02, 0xf7, 0x96, 0x82, 0xd6, 0x15, 0x81, 0x91, 0x99, 0xf2, 0x03, 0xd2, 0xf4, 0x8d, 0xd2, 0xf5, 0xd2, 0xf4, 0xd2, 0xf5, 0xe5, 0x35, 0xf7, 0xb6, 0xf7, 0xb5, 0xf7, 0x96, 0xef, 0xb6, 0xf7, 0x96, 0xf7, 0x95, 0xf7, 0xb6, 0xf7, 0x96, 0xf7, 0xb6, 0xf7, 0x95, 0x01, 0xf7, 0x96, 0x87, 0xf7, 0x95, 0xf7, 0xb6, 0xf7, 0x95, 0xf7, 0xb6, 0xf7, 0x96, 0xbc, 0x93, 0x81, 0x91, 0xaa, 0x53, 0x06, 0xd2, 0xf4, 0x80, 0xee, 0x75, 0x01, 0xf7, 0x96, 0x84, 0xf7, 0xb5, 0xf7, 0x96, 0xbc, 0x93, 0x81, 0x91, 0xaa, 0x33, 0x06, 0xd2, 0xf4, 0x89, 0xee, 0x75, 0xf7, 0x96, 0xf7, 0xb5, 0xf7, 0x95, 0xd6, 0x34, 0x81, 0x91, 0x99, 0xf2, 0xd2, 0xf4, 0xd2, 0xf5, 0xd2, 0xf4, 0x02, 0xd2, 0xf5, 0x83, 0xd2, 0xd4, 0xe5, 0x55, 0xf7, 0x96, 0xf7, 0xb5, 0x01, 0xf7, 0xb6, 0x86, 0xf7, 0x95, 0xf7, 0xb6, 0xf7, 0x96, 0xf7, 0xb6, 0xa3, 0x11, 0x81, 0x91, 0xba, 0x94, 0x06, 0xd2, 0xf4, 0x01, 0xf7, 0x96, 0x02, 0xf7, 0x97, 0x80, 0xf7, 0xb7, 0x01, 0xf7, 0x98, 0x80, 0xd2, 0x73, 0x02, 0xb8, 0xd1, 0x0a, 0x00, 0x1f, 0x80, 0x98, 0xb4, 0x01, 0xb8, 0xd1, 0x96, 0x3c, 0x9b, 0x06, 0xf5, 0x07, 0xe9, 0x07, 0xf1, 0x07, 0xfd, 0x26, 0xbd, 0xb0, 0xf1, 0xb0, 0xf2, 0xb0, 0xf1, 0x49, 0x32, 0x41, 0x32, 0x41, 0x11, 0x39, 0x11, 0x31, 0x10, 0x30, 0xf0, 0x60, 0xf0, 0xa9, 0x11, 0x70, 0xf0, 0x20, 0xce, 0x20, 0xcf, 0x20, 0xae, 0x20, 0xce, 0x20, 0xae, 0x01, 0x20, 0xad, 0x17, 0x18, 0xad,
+  0x0c, 0x18, 0xad, 0x84, 0x18, 0xae, 0x01, 0x17, 0x01, 0x19, 0x01, 0x18, 0x18, 0xd0, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x04, 0x18, 0xad, 0x80, 0x20, 0xad, 0x09, 0x18, 0xad, 0x80, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x20, 0xad, 0x12, 0x18, 0xad, 0x02, 0xb8, 0xd1, 0x80, 0xff, 0x94, 0x03, 0xff, 0xb5, 0x85, 0xff, 0xb4, 0xff, 0xb5, 0xc4, 0x93, 0x81, 0x91, 0xaa, 0x53, 0xd3, 0x15, 0x02, 0xd3, 0x35, 0x83, 0xd3, 0x34, 0xd3, 0x15, 0xd3, 0x35, 0xe5, 0x75, 0x09, 0xff, 0xb5, 0x82, 0xc4, 0x93, 0x81, 0x91, 0xaa, 0x53, 0x01, 0xd3, 0x35, 0x81, 0xd3, 0x14, 0xd3, 0x15, 0x02, 0xd3, 0x35, 0x82, 0xf6, 0x75, 0xff, 0xb5, 0xff, 0xb4, 0x01, 0xff, 0xb5, 0x02, 0xff, 0xb4, 0x01, 0xff, 0xb5, 0x83, 0xff, 0x95, 0xc4, 0x93, 0x81, 0x91, 0xaa, 0x53, 0x03, 0xd3, 0x35, 0x01, 0xd3, 0x15, 0x80, 0xd3, 0x35, 0x01, 0x99, 0xf2, 0x82, 0xd3, 0x35, 0xd3, 0x14, 0xd3, 0x15, 0x01, 0xd3, 0x35, 0x82, 0xd3, 0x15, 0xd3, 0x35, 0xdc, 0x54, 0x03, 0xff, 0xb5, 0x80, 0xff, 0xb4, 0x04, 0xff, 0xb5, 0x81, 0xff, 0xb4, 0xff, 0xb5, 0x01, 0x81, 0x91, 0x81, 0xd3, 0x34, 0xd3, 0x15, 0x03, 0xd3, 0x35, 0x82, 0xd3, 0x15, 0xdc, 0x34, 0xff, 0xb4, 0x01, 0xff, 0xb5, 0x85, 0xde, 0x34, 0x81, 0x91, 0x99, 0xf2, 0xd3, 0x14, 0xd3, 0x35, 0xd3, 0x15, 0x01, 0xd3, 0x34, 0x01, 0xd3, 0x35, 0x80, 0xe5, 0x74, 0x06, 0xff, 0xb5, 0x01, 0xff, 0xb4, 0x81, 0xff, 0xb5, 0xff, 0xb4, 0x02, 0xff, 0xb5, 0x80, 0xff, 0xb4, 0x01, 0xff, 0xb5, 0x82, 0xc4, 0xb3, 0x81, 0x91, 0xaa, 0x53, 0x01, 0xd3, 0x35, 0x81, 0xd3, 0x14, 0xd3, 0x15, 0x02, 0xd3, 0x35, 0x80, 0xed, 0xf5, 0x03, 0xff, 0xb5, 0x82, 0xc4, 0x93, 0x81, 0x91, 0xaa, 0x53, 0x03, 0xd3, 0x35, 0x01, 0xd3, 0x15, 0x81, 0xd3, 0x35, 0xf6, 0x94, 0x02, 0xff, 0xb5, 0x82, 0xde, 0x14, 0x81, 0x91, 0x99, 0xf2, 0x01, 0xd3, 0x35, 0x85, 0xd3, 0x14, 0xd3, 0x34, 0xd3, 0x14, 0xd3, 0x34, 0xd3, 0x15, 0xe5, 0x55, 0x02, 0xff, 0xb5, 0x80, 0xff, 0xb4, 0x03, 0xff, 0xb5, 0x82, 0xa3, 0x32, 0x81, 0x91, 0xba, 0xb4, 0x02, 0xd3, 0x35, 0x81, 0xd3, 0x15, 0xd3, 0x34, 0x01, 0xd3, 0x35, 0x80, 0xff, 0xb5, 0x04, 0xff, 0xb6, 0x83, 0xff, 0xb7, 0xff, 0xb8, 0xdb, 0xd4, 0xb8, 0xd2, 0x01, 0xb8, 0xd1, 0x09, 0x00, 0x1f, 0x89, 0x00, 0x3f, 0x08, 0x3f, 0x70, 0xf7, 0xb8, 0xd1, 0xa9, 0x52, 0x0e, 0x94, 0x07, 0xc9, 0x07, 0xf2, 0x07, 0xfd, 0x2e, 0x3c, 0x01, 0xa8, 0xf1, 0x80, 0x99, 0x11, 0x01, 0x41, 0x32, 0x81, 0x39, 0x11, 0x39, 0x10, 0x01, 0x30, 0xf0, 0x84, 0x30, 0xef, 0x58, 0xf0, 0xa8, 0xf1, 0x40, 0xcf, 0x20, 0xae, 0x01, 0x20, 0xce, 0x80, 0x20, 0xae, 0x01, 0x20, 0xad, 0x17, 0x18, 0xad,
+  0x0b, 0x18, 0xad, 0x84, 0x18, 0xcd, 0x00, 0xf7, 0x00, 0xf9, 0x01, 0x18, 0x18, 0xcf, 0x07, 0x18, 0xad, 0x80, 0x20, 0xad, 0x23, 0x18, 0xad, 0x02, 0xb8, 0xd1, 0x04, 0xfe, 0x2e, 0x01, 0xfe, 0x4e, 0x82, 0xc3, 0xf0, 0x81, 0x91, 0xaa, 0x73, 0x06, 0xd3, 0x55, 0x80, 0xec, 0xd1, 0x09, 0xfe, 0x2e, 0x82, 0xc3, 0xef, 0x81, 0x91, 0xaa, 0x73, 0x05, 0xd3, 0x55, 0x81, 0xd3, 0x54, 0xf5, 0x90, 0x01, 0xfe, 0x4e, 0x01, 0xfe, 0x2e, 0x80, 0xfe, 0x4e, 0x04, 0xfe, 0x2e, 0x82, 0xc3, 0xef, 0x81, 0x91, 0xaa, 0x73, 0x06, 0xd3, 0x55, 0x83, 0x9a, 0x12, 0x91, 0xf2, 0xd3, 0x55, 0xd3, 0x54, 0x04, 0xd3, 0x55, 0x81, 0xdb, 0xd4, 0xfe, 0x4e, 0x03, 0xfe, 0x2e, 0x82, 0xfe, 0x4e, 0xfe, 0x2e, 0xfe, 0x4e, 0x02, 0xfe, 0x2e, 0x80, 0xfe, 0x4e, 0x01, 0x81, 0x91, 0x06, 0xd3, 0x55, 0x81, 0xdc, 0x13, 0xfe, 0x4e, 0x01, 0xfe, 0x2e, 0x82, 0xe5, 0x0f, 0x81, 0x91, 0x99, 0xf2, 0x05, 0xd3, 0x55, 0x81, 0xd3, 0x54, 0xec, 0xd1, 0x07, 0xfe, 0x2e, 0x80, 0xfe, 0x4e, 0x03, 0xfe, 0x2e, 0x01, 0xfe, 0x4e, 0x01, 0xfe, 0x2e, 0x82, 0xc3, 0xcf, 0x81, 0x91, 0xaa, 0x73, 0x06, 0xd3, 0x55, 0x81, 0xe4, 0xd1, 0xfe, 0x4e, 0x01, 0xfe, 0x2e, 0x83, 0xfe, 0x4e, 0xc3, 0xd0, 0x81, 0x91, 0xaa, 0x73, 0x06, 0xd3, 0x55, 0x81, 0xf5, 0x90, 0xfe, 0x4e, 0x01, 0xfe, 0x2e, 0x82, 0xe5, 0x0f, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x55, 0x83, 0xec, 0xd2, 0xfe, 0x2e, 0xfe, 0x4e, 0xfe, 0x2e, 0x02, 0xfe, 0x4e, 0x84, 0xfe, 0x4d, 0xfe, 0x2f, 0xa2, 0xb0, 0x81, 0x91, 0xc2, 0xf4, 0x06, 0xd3, 0x55, 0x80, 0xfe, 0x2f, 0x02, 0xfe, 0x50, 0x01, 0xfe, 0x51, 0x01, 0xfe, 0x52, 0x81, 0xe3, 0xd2, 0xb8, 0xd2, 0x01, 0xb8, 0xd1, 0x08, 0x00, 0x1f, 0x8d, 0x00, 0x3f, 0x00, 0x1f, 0x00, 0x3f, 0x00, 0xdf, 0x59, 0xf8, 0xb8, 0xd1, 0x82, 0x91, 0x07, 0xc9, 0x07, 0xf2, 0x07, 0xfe, 0x45, 0x5a, 0xb0, 0xf1, 0xa8, 0xf1, 0x81, 0x12, 0x01, 0x41, 0x32, 0x87, 0x39, 0x11, 0x38, 0xf0, 0x30, 0xf0, 0x30, 0xef, 0x28, 0xef, 0x28, 0xcf, 0x50, 0xcf, 0x48, 0xef, 0x01, 0x20, 0xae, 0x81, 0x20, 0xce, 0x20, 0xae, 0x01, 0x20, 0xad, 0x17, 0x18, 0xad,
+  0x0b, 0x18, 0xad, 0x83, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf8, 0x10, 0xcf, 0x0a, 0x18, 0xad, 0x80, 0x18, 0xac, 0x20, 0x18, 0xad, 0x84, 0x20, 0xad, 0xb8, 0xd1, 0xb0, 0xd1, 0xb0, 0xd2, 0xfc, 0x8d, 0x01, 0xfc, 0x6d, 0x80, 0xfc, 0x8d, 0x02, 0xfc, 0x6d, 0x82, 0xc3, 0x0f, 0x81, 0xb1, 0xaa, 0x73, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0xec, 0x11, 0x08, 0xfc, 0x6d, 0x83, 0xfc, 0x8d, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x01, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x83, 0xd3, 0x75, 0xd3, 0x95, 0xd3, 0x96, 0xf4, 0x2f, 0x01, 0xfc, 0x6d, 0x80, 0xfc, 0x8d, 0x01, 0xfc, 0x6d, 0x01, 0xfc, 0x8d, 0x01, 0xfc, 0x6d, 0x83, 0xfc, 0x8d, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x03, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x82, 0xd3, 0x95, 0x9a, 0x12, 0x81, 0x91, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x81, 0xf4, 0x4f, 0xfc, 0x8d, 0x01, 0xfc, 0x6d, 0x80, 0xfc, 0x8d, 0x03, 0xfc, 0x6d, 0x01, 0xfc, 0x8d, 0x80, 0xfc, 0x6d, 0x01, 0x81, 0x91, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x82, 0xd3, 0x96, 0xdb, 0xd3, 0xfc, 0x8d, 0x01, 0xfc, 0x6d, 0x82, 0xe3, 0xce, 0x81, 0x91, 0x9a, 0x12, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x76, 0x02, 0xd3, 0x95, 0x80, 0xec, 0x11, 0x03, 0xfc, 0x6d, 0x01, 0xfc, 0x8d, 0x07, 0xfc, 0x6d, 0x86, 0xfc, 0x8d, 0xfc, 0x6d, 0xfc, 0x8d, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0xd3, 0x75, 0x05, 0xd3, 0x95, 0x87, 0xeb, 0xf1, 0xfc, 0x8d, 0xfc, 0x6d, 0xfc, 0x8d, 0xfc, 0x6d, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x03, 0xd3, 0x95, 0x01, 0xd3, 0x75, 0x81, 0xd3, 0x95, 0xf4, 0x2f, 0x01, 0xfc, 0x6d, 0x83, 0xfc, 0x8d, 0xe3, 0xce, 0x81, 0x91, 0x9a, 0x12, 0x01, 0xd3, 0x95, 0x82, 0xd3, 0x75, 0xd3, 0x95, 0xd3, 0x76, 0x01, 0xd3, 0x95, 0x81, 0xeb, 0xf1, 0xfc, 0x8d, 0x01, 0xfc, 0x6d, 0x80, 0xfc, 0x8d, 0x02, 0xfc, 0x6d, 0x84, 0xfc, 0x8d, 0xa2, 0x50, 0x81, 0x91, 0xc3, 0x14, 0xd3, 0x75, 0x04, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0xfc, 0x8e, 0x02, 0xfc, 0x8f, 0x01, 0xfc, 0xb0, 0x01, 0xfc, 0xb1, 0x83, 0xf3, 0xb2, 0xb8, 0xd1, 0xb0, 0xf1, 0xb8, 0xd1, 0x09, 0x00, 0x1f, 0x01, 0x00, 0x3f, 0x92, 0x00, 0x5f, 0x03, 0x1f, 0x2d, 0x3b, 0x99, 0xb2, 0x45, 0x4b, 0x07, 0xf3, 0x07, 0xfe, 0x54, 0x98, 0xb0, 0xf1, 0xa8, 0xf1, 0x69, 0x12, 0x49, 0x12, 0x41, 0x12, 0x39, 0x11, 0x31, 0x10, 0x30, 0xf0, 0x30, 0xef, 0x30, 0xcf, 0x28, 0xcf, 0x02, 0x20, 0xce, 0x82, 0x20, 0xcd, 0x20, 0xce, 0x20, 0xae, 0x01, 0x20, 0xad, 0x17, 0x18, 0xad,
+  0x09, 0x18, 0xad, 0x84, 0x18, 0xcd, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf8, 0x18, 0xcf, 0x01, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x29, 0x18, 0xad, 0x01, 0xb0, 0xf1, 0x80, 0xb0, 0xd1, 0x06, 0xfc, 0x8d, 0x82, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x11, 0x09, 0xfc, 0x8d, 0x82, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0x4f, 0x09, 0xfc, 0x8d, 0x82, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x82, 0x9a, 0x12, 0x81, 0x91, 0xc3, 0x34, 0x06, 0xd3, 0x95, 0x81, 0xdb, 0xb4, 0xfc, 0x8e, 0x09, 0xfc, 0x8d, 0x01, 0x81, 0x91, 0x05, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0xdb, 0xd3, 0x02, 0xfc, 0x8d, 0x82, 0xe3, 0xce, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x11, 0x10, 0xfc, 0x8d, 0x82, 0xcb, 0x2f, 0x81, 0x91, 0xaa, 0x93, 0x03, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x80, 0xec, 0x11, 0x03, 0xfc, 0x8d, 0x82, 0xc3, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0x4f, 0x02, 0xfc, 0x8d, 0x82, 0xcb, 0x6f, 0x81, 0x91, 0x9a, 0x32, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x11, 0x07, 0xfc, 0x8d, 0x82, 0xa2, 0x50, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x81, 0xfc, 0x8e, 0xfc, 0x8f, 0x01, 0xfc, 0xaf, 0x02, 0xfc, 0xb0, 0x81, 0xfc, 0xb2, 0xf4, 0x51, 0x02, 0xb0, 0xd1, 0x08, 0x00, 0x1f, 0x02, 0x00, 0x3f, 0x87, 0x00, 0x5f, 0x02, 0x5f, 0x06, 0xfd, 0x07, 0x70, 0x0f, 0x88, 0x07, 0xf4, 0x07, 0xff, 0x54, 0x78, 0x01, 0xa8, 0xf1, 0x82, 0x59, 0x32, 0x41, 0x32, 0x41, 0x11, 0x01, 0x39, 0x11, 0x01, 0x30, 0xf0, 0x82, 0x30, 0xef, 0x28, 0xcf, 0x28, 0xce, 0x03, 0x20, 0xce, 0x03, 0x20, 0xad, 0x16, 0x18, 0xad,
+  0x03, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xcd, 0x02, 0x18, 0xad, 0x85, 0x18, 0xae, 0x00, 0xf7, 0x01, 0x19, 0x00, 0xf8, 0x18, 0xcf, 0x18, 0xad, 0x01, 0x20, 0xad, 0x2c, 0x18, 0xad, 0x01, 0xb0, 0xf1, 0x82, 0xb0, 0xd1, 0xfc, 0xad, 0xfc, 0xcd, 0x01, 0xfc, 0xad, 0x02, 0xfc, 0xcd, 0x82, 0xcb, 0x4e, 0x81, 0x91, 0xaa, 0x73, 0x06, 0xd3, 0x95, 0x81, 0xec, 0x31, 0xfc, 0xad, 0x08, 0xfc, 0xcd, 0x82, 0xc3, 0x2f, 0x89, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0x6f, 0x02, 0xfc, 0xcd, 0x80, 0xfc, 0xad, 0x02, 0xfc, 0xcd, 0x02, 0xfc, 0xad, 0x82, 0xc3, 0x2f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x83, 0xbb, 0x11, 0x81, 0x91, 0xaa, 0x73, 0xd3, 0x96, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x02, 0xd3, 0x95, 0x86, 0xdb, 0xb4, 0xfc, 0xae, 0xfc, 0xad, 0xfc, 0xcd, 0xfc, 0xad, 0xfc, 0xcd, 0xfc, 0xad, 0x01, 0xfc, 0xcd, 0x01, 0xfc, 0xad, 0x01, 0x81, 0x91, 0x05, 0xd3, 0x95, 0x82, 0xd3, 0x75, 0xdb, 0xd3, 0xfc, 0xad, 0x01, 0xfc, 0xcd, 0x82, 0xdb, 0xee, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x82, 0xec, 0x31, 0xfc, 0xcd, 0xfc, 0xad, 0x0a, 0xfc, 0xcd, 0x86, 0xfc, 0xad, 0xfc, 0xcd, 0xfc, 0xad, 0xfc, 0xcd, 0xdb, 0xee, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xdb, 0xd3, 0x03, 0xfc, 0xcd, 0x82, 0xc3, 0x2f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x81, 0xf4, 0x6f, 0xfc, 0xad, 0x01, 0xfc, 0xcd, 0x82, 0xc3, 0x2f, 0x89, 0x91, 0xaa, 0x94, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x31, 0x01, 0xfc, 0xcd, 0x81, 0xfc, 0xad, 0xfc, 0xcd, 0x03, 0xfc, 0xad, 0x82, 0xa2, 0x70, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x80, 0xfc, 0xce, 0x01, 0xfc, 0xcf, 0x82, 0xfc, 0xef, 0xfc, 0xd0, 0xfc, 0xf0, 0x01, 0xfc, 0xf1, 0x80, 0xfc, 0xf2, 0x01, 0xb0, 0xf1, 0x80, 0xb0, 0xf2, 0x08, 0x00, 0x1f, 0x01, 0x00, 0x3f, 0x90, 0x00, 0x5f, 0x00, 0x7f, 0x02, 0x1f, 0x06, 0xfc, 0x07, 0x8d, 0x07, 0xe7, 0x07, 0xf6, 0x07, 0xff, 0x82, 0xb5, 0xa8, 0xf1, 0xa1, 0x11, 0x49, 0x32, 0x41, 0x32, 0x41, 0x11, 0x38, 0xf1, 0x38, 0xf0, 0x30, 0xf0, 0x01, 0x30, 0xef, 0x81, 0x28, 0xcf, 0x28, 0xce, 0x03, 0x20, 0xce, 0x03, 0x20, 0xad, 0x16, 0x18, 0xad,
+  0x03, 0x18, 0xad, 0x01, 0x20, 0xad, 0x01, 0x18, 0xad, 0x84, 0x18, 0xae, 0x00, 0xf6, 0x01, 0x19, 0x01, 0x18, 0x18, 0xcf, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x2a, 0x18, 0xad, 0x83, 0xb0, 0xf1, 0xa8, 0xf1, 0xb0, 0xf1, 0xfd, 0x0d, 0x02, 0xfc, 0xed, 0x85, 0xfd, 0x0d, 0xfc, 0xed, 0xfd, 0x0d, 0xe4, 0x2e, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x51, 0x09, 0xfc, 0xed, 0x82, 0xc3, 0x4f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0x8f, 0x09, 0xfc, 0xed, 0x82, 0xc3, 0x2f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x82, 0xec, 0x6f, 0x91, 0xd1, 0x89, 0xd1, 0x05, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x81, 0xdb, 0xb4, 0xec, 0x70, 0x04, 0xfc, 0xed, 0x80, 0xfd, 0x0d, 0x01, 0xfc, 0xed, 0x01, 0x81, 0x91, 0x06, 0xd3, 0x95, 0x80, 0xdb, 0xf3, 0x02, 0xfc, 0xed, 0x82, 0xe4, 0x2e, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x51, 0x0e, 0xfc, 0xed, 0x84, 0xfd, 0x0d, 0xfc, 0xed, 0xec, 0x6e, 0x81, 0x91, 0x91, 0xf2, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x76, 0x01, 0xd3, 0x95, 0x86, 0xf4, 0xaf, 0xfd, 0x0d, 0xfc, 0xed, 0xfd, 0x0d, 0xc3, 0x4f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0x8f, 0x02, 0xfc, 0xed, 0x83, 0xc3, 0x4f, 0x81, 0x91, 0xaa, 0x93, 0xd3, 0x75, 0x05, 0xd3, 0x95, 0x80, 0xec, 0x51, 0x07, 0xfc, 0xed, 0x82, 0xa2, 0x70, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x80, 0xfd, 0x0e, 0x02, 0xfd, 0x0f, 0x01, 0xfd, 0x10, 0x01, 0xfd, 0x31, 0x80, 0xfd, 0x32, 0x02, 0xb0, 0xf1, 0x08, 0x00, 0x1f, 0x80, 0x00, 0x3f, 0x02, 0x00, 0x5f, 0x8a, 0x02, 0x1f, 0x07, 0x3b, 0x07, 0xac, 0x07, 0xe7, 0x07, 0xf7, 0x07, 0xff, 0x82, 0xb5, 0xa8, 0xf1, 0x89, 0x12, 0x49, 0x32, 0x41, 0x12, 0x01, 0x39, 0x11, 0x82, 0x31, 0x10, 0x30, 0xf0, 0x30, 0xef, 0x01, 0x28, 0xcf, 0x80, 0x28, 0xce, 0x02, 0x20, 0xce, 0x80, 0x20, 0xae, 0x03, 0x20, 0xad, 0x16, 0x18, 0xad,
+  0x06, 0x18, 0xad, 0x84, 0x18, 0xae, 0x00, 0xf6, 0x01, 0x19, 0x01, 0x18, 0x10, 0xcf, 0x01, 0x20, 0xad, 0x2f, 0x18, 0xad, 0x82, 0xb0, 0xf1, 0xa8, 0xf1, 0xb0, 0xf1, 0x06, 0xfd, 0x2d, 0x82, 0xe4, 0x4e, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x71, 0x09, 0xfd, 0x2d, 0x82, 0xc3, 0x4f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0xcf, 0x09, 0xfd, 0x2d, 0x82, 0xc3, 0x4f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x83, 0xf4, 0xcf, 0xc3, 0x4f, 0x81, 0x91, 0xb2, 0xd4, 0x09, 0xd3, 0x95, 0x81, 0xdb, 0xd4, 0xe4, 0x31, 0x01, 0xec, 0x71, 0x83, 0xdb, 0xf0, 0xe4, 0x50, 0xf4, 0xcf, 0xfd, 0x0e, 0x01, 0x81, 0x91, 0x06, 0xd3, 0x95, 0x88, 0xdb, 0xd4, 0xf4, 0xaf, 0xf4, 0xcf, 0xf4, 0xaf, 0xdc, 0x10, 0x9a, 0x12, 0xaa, 0x73, 0xd3, 0x95, 0xd3, 0x96, 0x04, 0xd3, 0x95, 0x80, 0xec, 0x71, 0x0f, 0xfd, 0x2d, 0x01, 0xfd, 0x2c, 0x84, 0x92, 0x11, 0x81, 0x91, 0xd3, 0x75, 0xd3, 0x95, 0xd3, 0x96, 0x05, 0xd3, 0x95, 0x85, 0xec, 0x71, 0xfc, 0xee, 0xfd, 0x2d, 0xc3, 0x6f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x86, 0xdc, 0x10, 0xe4, 0x4e, 0xdc, 0x2e, 0xe4, 0x4e, 0xb2, 0xf0, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x71, 0x07, 0xfd, 0x2d, 0x82, 0xa2, 0x70, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x80, 0xfd, 0x2e, 0x01, 0xfd, 0x2f, 0x80, 0xfd, 0x4f, 0x01, 0xfd, 0x50, 0x01, 0xfd, 0x51, 0x83, 0xfd, 0x71, 0xa8, 0xf1, 0xb0, 0xf1, 0xb0, 0xf2, 0x07, 0x00, 0x1f, 0x80, 0x00, 0x3f, 0x01, 0x00, 0x5f, 0x01, 0x00, 0x7f, 0x90, 0x02, 0x3f, 0x07, 0x3b, 0x07, 0xab, 0x07, 0xe8, 0x07, 0xf9, 0x07, 0xff, 0xa1, 0x52, 0xa8, 0xf1, 0x71, 0x32, 0x41, 0x32, 0x41, 0x31, 0x39, 0x11, 0x39, 0x10, 0x38, 0xf0, 0x30, 0xf0, 0x30, 0xef, 0x28, 0xcf, 0x01, 0x28, 0xce, 0x02, 0x20, 0xce, 0x05, 0x20, 0xad, 0x15, 0x18, 0xad,
+  0x05, 0x18, 0xad, 0x84, 0x18, 0xae, 0x00, 0xf6, 0x01, 0x19, 0x01, 0x18, 0x18, 0xcf, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x29, 0x18, 0xad, 0x01, 0xa8, 0xf1, 0x80, 0xa8, 0xf2, 0x03, 0xfd, 0x6d, 0x80, 0xfd, 0x4d, 0x01, 0xfd, 0x6d, 0x82, 0xe4, 0x6e, 0x81, 0x91, 0x92, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0x71, 0x09, 0xfd, 0x6d, 0x82, 0xc3, 0x6f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf4, 0xef, 0x09, 0xfd, 0x6d, 0x82, 0xc3, 0x6f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x88, 0xf4, 0xef, 0xfd, 0x2d, 0x92, 0x11, 0x89, 0xb2, 0xcb, 0x75, 0xd3, 0x96, 0xd3, 0x75, 0xd3, 0x95, 0xd3, 0x96, 0x0b, 0xd3, 0x95, 0x80, 0xec, 0x91, 0x01, 0x81, 0x91, 0x0b, 0xd3, 0x95, 0x80, 0xcb, 0x95, 0x07, 0xd3, 0x95, 0x80, 0xec, 0x71, 0x0c, 0xfd, 0x6d, 0x80, 0xfd, 0x4d, 0x03, 0xfd, 0x6d, 0x82, 0xbb, 0x2f, 0x81, 0x91, 0xb2, 0xd4, 0x0a, 0xd3, 0x95, 0x82, 0xc3, 0x14, 0x81, 0x91, 0xaa, 0x93, 0x09, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x09, 0xd3, 0x95, 0x80, 0xec, 0x71, 0x07, 0xfd, 0x6d, 0x82, 0xa2, 0x90, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x80, 0xfd, 0x6e, 0x01, 0xfd, 0x6f, 0x80, 0xfd, 0x8f, 0x01, 0xfd, 0x90, 0x01, 0xfd, 0x91, 0x80, 0xfd, 0x92, 0x02, 0xa8, 0xf1, 0x06, 0x00, 0x1f, 0x01, 0x00, 0x3f, 0x01, 0x00, 0x5f, 0x87, 0x00, 0x7f, 0x00, 0x9f, 0x02, 0x3f, 0x07, 0x79, 0x07, 0xaa, 0x07, 0xe8, 0x07, 0xfb, 0x07, 0xff, 0x01, 0xa8, 0xf1, 0x85, 0x59, 0x32, 0x49, 0x32, 0x41, 0x31, 0x39, 0x11, 0x39, 0x10, 0x38, 0xf0, 0x01, 0x30, 0xef, 0x80, 0x28, 0xcf, 0x01, 0x28, 0xce, 0x01, 0x20, 0xce, 0x06, 0x20, 0xad, 0x15, 0x18, 0xad,
+  0x03, 0x18, 0xad, 0x85, 0x20, 0xad, 0x18, 0xcd, 0x01, 0x16, 0x01, 0x19, 0x01, 0x18, 0x18, 0xcf, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x20, 0xad, 0x2a, 0x18, 0xad, 0x80, 0x20, 0xad, 0x02, 0xa8, 0xf1, 0x83, 0xec, 0x6f, 0xfd, 0x8d, 0xfd, 0xad, 0xfd, 0x8d, 0x02, 0xfd, 0xad, 0x82, 0xe4, 0x8e, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x81, 0xec, 0x91, 0xfd, 0xad, 0x08, 0xfd, 0x8d, 0x82, 0xc3, 0x8f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x83, 0xf5, 0x2f, 0xfd, 0xad, 0xfd, 0x8d, 0xfd, 0xad, 0x01, 0xfd, 0x8d, 0x80, 0xfd, 0xad, 0x01, 0xfd, 0x8d, 0x01, 0xfd, 0xad, 0x82, 0xc3, 0x8f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x84, 0xf5, 0x2f, 0xfd, 0x8d, 0xe4, 0xae, 0x89, 0x91, 0x9a, 0x32, 0x0f, 0xd3, 0x95, 0x80, 0xe4, 0x91, 0x01, 0x81, 0x91, 0x06, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x0c, 0xd3, 0x95, 0x80, 0xec, 0x91, 0x01, 0xfd, 0xad, 0x07, 0xfd, 0x8d, 0x01, 0xfd, 0xad, 0x01, 0xfd, 0x8d, 0x01, 0xfd, 0xad, 0x84, 0xfd, 0x8d, 0xfd, 0xad, 0xf5, 0x2d, 0x81, 0x91, 0x91, 0xf2, 0x03, 0xd3, 0x95, 0x80, 0xd3, 0x76, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x02, 0xd3, 0x95, 0x82, 0xc3, 0x14, 0x81, 0x91, 0xaa, 0x93, 0x14, 0xd3, 0x95, 0x80, 0xec, 0x91, 0x01, 0xfd, 0x8d, 0x04, 0xfd, 0xad, 0x83, 0xfd, 0x8d, 0xa2, 0x90, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x03, 0xfd, 0xaf, 0x01, 0xfd, 0xb0, 0x83, 0xfd, 0xb1, 0xfd, 0xd1, 0xe4, 0xb2, 0xa9, 0x11, 0x01, 0xa8, 0xf1, 0x06, 0x00, 0x1f, 0x80, 0x00, 0x3f, 0x01, 0x00, 0x5f, 0x01, 0x00, 0x7f, 0x88, 0x00, 0x9f, 0x02, 0xbf, 0x07, 0x78, 0x07, 0xc8, 0x07, 0xe9, 0x07, 0xfd, 0x17, 0x3e, 0xa8, 0xf1, 0x99, 0x12, 0x01, 0x49, 0x32, 0x83, 0x41, 0x31, 0x41, 0x11, 0x39, 0x11, 0x38, 0xf0, 0x01, 0x30, 0xef, 0x80, 0x28, 0xcf, 0x01, 0x28, 0xce, 0x01, 0x20, 0xce, 0x80, 0x20, 0xcd, 0x04, 0x20, 0xad, 0x81, 0x18, 0xad, 0x20, 0xad, 0x14, 0x18, 0xad,
+  0x03, 0x18, 0xad, 0x84, 0x18, 0xcd, 0x00, 0xf7, 0x01, 0x19, 0x01, 0x18, 0x18, 0xcf, 0x02, 0x18, 0xad, 0x80, 0x18, 0xac, 0x04, 0x18, 0xad, 0x80, 0x18, 0xcd, 0x2a, 0x18, 0xad, 0x02, 0xa9, 0x11, 0x80, 0xec, 0x8e, 0x01, 0xfd, 0xed, 0x02, 0xfd, 0xcd, 0x83, 0xfd, 0xed, 0xe4, 0xce, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0xb1, 0x09, 0xfd, 0xcd, 0x82, 0xc3, 0xaf, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf5, 0x4f, 0x01, 0xfd, 0xcd, 0x80, 0xfd, 0xed, 0x04, 0xfd, 0xcd, 0x84, 0xfd, 0xed, 0xfd, 0xcd, 0xc3, 0xaf, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x85, 0xf5, 0x4f, 0xfd, 0xed, 0xfd, 0xcd, 0xd4, 0x4f, 0x81, 0x91, 0xb2, 0xb3, 0x09, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x03, 0xd3, 0x95, 0x82, 0xec, 0xb1, 0x89, 0x91, 0x81, 0x91, 0x0b, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x07, 0xd3, 0x95, 0x80, 0xec, 0xb1, 0x12, 0xfd, 0xcd, 0x82, 0xbb, 0x6f, 0x81, 0x91, 0xba, 0xf4, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x03, 0xd3, 0x95, 0x82, 0xc3, 0x14, 0x81, 0x91, 0xaa, 0x93, 0x14, 0xd3, 0x95, 0x80, 0xec, 0xb1, 0x01, 0xfd, 0xed, 0x01, 0xfd, 0xcd, 0x03, 0xfd, 0xed, 0x82, 0xa2, 0xb0, 0x81, 0x91, 0xc3, 0x14, 0x05, 0xd3, 0x95, 0x81, 0xd3, 0x75, 0xfd, 0xee, 0x01, 0xfd, 0xef, 0x02, 0xfd, 0xf0, 0x01, 0xfd, 0xf1, 0x81, 0xec, 0xb1, 0xa0, 0xf1, 0x01, 0xa9, 0x11, 0x06, 0x00, 0x1f, 0x02, 0x00, 0x5f, 0x80, 0x00, 0x7f, 0x01, 0x00, 0x9f, 0x87, 0x04, 0x1f, 0x07, 0x97, 0x07, 0xc7, 0x07, 0xeb, 0x07, 0xfe, 0x2e, 0x5c, 0xa8, 0xf1, 0x79, 0x32, 0x01, 0x49, 0x32, 0x83, 0x41, 0x11, 0x39, 0x11, 0x39, 0x10, 0x38, 0xf0, 0x01, 0x30, 0xef, 0x02, 0x28, 0xce, 0x01, 0x20, 0xce, 0x80, 0x20, 0xcd, 0x04, 0x20, 0xad, 0x16, 0x18, 0xad,
+  0x03, 0x18, 0xad, 0x83, 0x00, 0xf7, 0x01, 0x18, 0x01, 0x17, 0x18, 0xcf, 0x05, 0x18, 0xad, 0x80, 0x18, 0xac, 0x03, 0x18, 0xad, 0x80, 0x20, 0xac, 0x29, 0x18, 0xad, 0x01, 0xa9, 0x11, 0x81, 0xa1, 0x11, 0xe4, 0x2e, 0x05, 0xfe, 0x0d, 0x82, 0xe4, 0xee, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0xd1, 0x09, 0xfe, 0x0d, 0x82, 0xc3, 0xcf, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf5, 0x6f, 0x09, 0xfe, 0x0d, 0x82, 0xc3, 0xcf, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf5, 0x6f, 0x02, 0xfe, 0x0d, 0x82, 0xd4, 0x4f, 0x81, 0x91, 0xba, 0xd3, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x76, 0x04, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x80, 0xec, 0xd1, 0x01, 0x81, 0x91, 0x0e, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x04, 0xd3, 0x95, 0x80, 0xec, 0xd1, 0x12, 0xfe, 0x0d, 0x83, 0xf5, 0xad, 0x9a, 0x70, 0x89, 0xb1, 0xd3, 0x75, 0x08, 0xd3, 0x95, 0x82, 0xc3, 0x14, 0x81, 0x91, 0xaa, 0x93, 0x0c, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x06, 0xd3, 0x95, 0x80, 0xec, 0xd1, 0x02, 0xfe, 0x0d, 0x81, 0xfe, 0x0e, 0xfe, 0x0d, 0x02, 0xfe, 0x0e, 0x82, 0xa2, 0xb0, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x02, 0xfe, 0x0f, 0x02, 0xfe, 0x30, 0x01, 0xfe, 0x31, 0x83, 0xdc, 0x32, 0xa1, 0x11, 0xa9, 0x11, 0xa1, 0x11, 0x06, 0x00, 0x1f, 0x01, 0x00, 0x5f, 0x01, 0x00, 0x7f, 0x8b, 0x00, 0x9f, 0x00, 0xbf, 0x04, 0x3f, 0x07, 0x94, 0x07, 0xe6, 0x07, 0xec, 0x07, 0xfe, 0x35, 0xdb, 0xa9, 0x11, 0x51, 0x33, 0x49, 0x32, 0x41, 0x32, 0x01, 0x41, 0x11, 0x81, 0x39, 0x10, 0x30, 0xf0, 0x01, 0x30, 0xef, 0x01, 0x28, 0xce, 0x02, 0x20, 0xce, 0x80, 0x20, 0xcd, 0x04, 0x20, 0xad, 0x16, 0x18, 0xad,
+  0x8b, 0x18, 0xac, 0x18, 0xad, 0x18, 0xae, 0x00, 0xf6, 0x01, 0x19, 0x00, 0xf8, 0x18, 0xcf, 0x20, 0xad, 0x18, 0xad, 0x20, 0xad, 0x18, 0xac, 0x20, 0xad, 0x30, 0x18, 0xad, 0x81, 0x18, 0xac, 0x80, 0xf0, 0x01, 0xa1, 0x11, 0x80, 0xc2, 0xb0, 0x05, 0xfe, 0x4d, 0x82, 0xe5, 0x0e, 0x81, 0x91, 0x9a, 0x12, 0x06, 0xd3, 0x95, 0x80, 0xec, 0xf1, 0x09, 0xfe, 0x4d, 0x82, 0xc3, 0xef, 0x89, 0x91, 0xaa, 0x93, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x02, 0xd3, 0x95, 0x80, 0xf5, 0x8f, 0x09, 0xfe, 0x4d, 0x84, 0xc3, 0xef, 0x81, 0x91, 0xaa, 0x93, 0xd3, 0x95, 0xd3, 0x96, 0x04, 0xd3, 0x95, 0x80, 0xf5, 0x8f, 0x03, 0xfe, 0x4d, 0x83, 0xe5, 0x0e, 0x89, 0xd1, 0xa2, 0x53, 0xcb, 0x75, 0x05, 0xd3, 0x95, 0x80, 0xd3, 0x76, 0x04, 0xd3, 0x95, 0x80, 0xec, 0xf1, 0x01, 0x81, 0x91, 0x14, 0xd3, 0x95, 0x80, 0xec, 0xf1, 0x13, 0xfe, 0x4d, 0x83, 0xf6, 0x0e, 0x9a, 0x70, 0x91, 0xf2, 0xcb, 0x75, 0x05, 0xd3, 0x95, 0x86, 0xd3, 0x96, 0xd3, 0x95, 0xc3, 0x14, 0x81, 0x91, 0xaa, 0x93, 0xd3, 0x95, 0xd3, 0x96, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x0f, 0xd3, 0x95, 0x80, 0xec, 0xf2, 0x02, 0xfe, 0x4d, 0x89, 0xfe, 0x4e, 0xfe, 0x4d, 0xfe, 0x4e, 0xfe, 0x4d, 0xfe, 0x4e, 0xa2, 0xd0, 0x81, 0x91, 0xc3, 0x14, 0xd3, 0x95, 0xd3, 0x96, 0x04, 0xd3, 0x95, 0x83, 0xfe, 0x4e, 0xfe, 0x4f, 0xfe, 0x6f, 0xfe, 0x70, 0x01, 0xfe, 0x50, 0x82, 0xfe, 0x71, 0xfe, 0x51, 0xba, 0x52, 0x01, 0xa1, 0x11, 0x80, 0x78, 0xd5, 0x06, 0x00, 0x1f, 0x80, 0x00, 0x5f, 0x01, 0x00, 0x7f, 0x80, 0x00, 0x9f, 0x01, 0x00, 0xbf, 0x8f, 0x04, 0x3f, 0x07, 0xb3, 0x07, 0xc5, 0x07, 0xee, 0x07, 0xff, 0x54, 0x78, 0x6a, 0xd6, 0x49, 0x53, 0x49, 0x32, 0x49, 0x12, 0x41, 0x11, 0x39, 0x11, 0x39, 0x10, 0x30, 0xf0, 0x30, 0xef, 0x28, 0xcf, 0x02, 0x28, 0xce, 0x80, 0x20, 0xce, 0x01, 0x20, 0xcd, 0x04, 0x20, 0xad, 0x16, 0x18, 0xad,
+  0x01, 0x18, 0xad, 0x84, 0x00, 0xf6, 0x01, 0x18, 0x00, 0xf8, 0x18, 0xcf, 0x18, 0xac, 0x01, 0x20, 0xad, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x2f, 0x18, 0xad, 0x82, 0x20, 0xad, 0x18, 0xac, 0x60, 0xef, 0x01, 0xa1, 0x11, 0x81, 0xa1, 0x12, 0xfe, 0x2d, 0x04, 0xfe, 0x8d, 0x82, 0xe5, 0x4e, 0x81, 0x91, 0x9a, 0x12, 0x04, 0xd3, 0x95, 0x82, 0xd3, 0x75, 0xd3, 0x95, 0xed, 0x11, 0x08, 0xfe, 0x6d, 0x85, 0xfe, 0x8d, 0xc4, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0xd3, 0x95, 0xd3, 0x96, 0x03, 0xd3, 0x95, 0x82, 0xd3, 0x75, 0xf5, 0xcf, 0xfe, 0x6d, 0x07, 0xfe, 0x8d, 0x83, 0xfe, 0x6d, 0xc4, 0x0f, 0x81, 0x91, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf5, 0xce, 0x01, 0xfe, 0x6d, 0x86, 0xfe, 0x8d, 0xfe, 0x6c, 0xfe, 0x8d, 0xf6, 0x2d, 0xc4, 0x0f, 0x9a, 0x12, 0xb2, 0xd4, 0x0a, 0xd3, 0x95, 0x80, 0xec, 0xf1, 0x01, 0x81, 0x91, 0x14, 0xd3, 0x95, 0x80, 0xed, 0x11, 0x09, 0xfe, 0x6d, 0x80, 0xfe, 0x8d, 0x06, 0xfe, 0x6d, 0x86, 0xfe, 0x6c, 0xfe, 0x8d, 0xfe, 0x6d, 0xfe, 0x2d, 0xbb, 0xcf, 0x89, 0xb1, 0xba, 0xf4, 0x02, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x01, 0xd3, 0x95, 0x83, 0xd3, 0x96, 0xc3, 0x14, 0x81, 0x91, 0xaa, 0x93, 0x14, 0xd3, 0x95, 0x80, 0xed, 0x12, 0x07, 0xfe, 0x8e, 0x82, 0xa2, 0xd0, 0x81, 0x91, 0xc3, 0x14, 0x06, 0xd3, 0x95, 0x02, 0xfe, 0x8f, 0x02, 0xfe, 0x90, 0x89, 0xfe, 0x91, 0xe4, 0x71, 0xa1, 0x11, 0xa1, 0x12, 0xa1, 0x11, 0x60, 0xd5, 0x00, 0x1f, 0x28, 0x3c, 0x70, 0x97, 0x40, 0x5a, 0x02, 0x00, 0x1f, 0x82, 0x00, 0x3f, 0x00, 0x7f, 0x00, 0x9f, 0x01, 0x00, 0xbf, 0x8a, 0x00, 0xdf, 0x04, 0x5f, 0x07, 0xd2, 0x07, 0xe4, 0x07, 0xef, 0x07, 0xff, 0x2e, 0x3c, 0x2d, 0x1a, 0x51, 0x33, 0x49, 0x32, 0x41, 0x32, 0x01, 0x39, 0x11, 0x83, 0x38, 0xf0, 0x30, 0xf0, 0x30, 0xef, 0x28, 0xcf, 0x01, 0x28, 0xce, 0x01, 0x20, 0xce, 0x01, 0x20, 0xcd, 0x04, 0x20, 0xad, 0x16, 0x18, 0xad,
+  0x84, 0x18, 0xad, 0x00, 0xf6, 0x01, 0x18, 0x00, 0xf7, 0x18, 0xcf, 0x01, 0x18, 0xad, 0x80, 0x20, 0xad, 0x01, 0x18, 0xad, 0x81, 0x20, 0xad, 0x18, 0xac, 0x31, 0x18, 0xad, 0x80, 0x28, 0xcd, 0x02, 0xa1, 0x11, 0x80, 0xcb, 0xcf, 0x04, 0xfe, 0xad, 0x82, 0xf5, 0xed, 0x89, 0xd1, 0x91, 0xd2, 0x04, 0xd3, 0x95, 0x82, 0xd3, 0x96, 0xd3, 0x95, 0xed, 0x11, 0x09, 0xfe, 0xad, 0x82, 0xc4, 0x2f, 0x81, 0xb1, 0xaa, 0x93, 0x06, 0xd3, 0x95, 0x80, 0xf5, 0xef, 0x07, 0xfe, 0xad, 0x84, 0xfe, 0xcc, 0xfe, 0xad, 0xc4, 0x2f, 0x81, 0x91, 0xaa, 0x93, 0x01, 0xd3, 0x95, 0x80, 0xd3, 0x96, 0x03, 0xd3, 0x95, 0x82, 0xf5, 0xef, 0xfe, 0xad, 0xfe, 0xac, 0x01, 0xfe, 0xad, 0x80, 0xfe, 0xac, 0x01, 0xfe, 0xad, 0x86, 0xf6, 0x4d, 0xd4, 0xce, 0xbb, 0xd0, 0xc3, 0xb2, 0xc3, 0x14, 0xd3, 0x95, 0xd3, 0x75, 0x05, 0xd3, 0x95, 0x80, 0xed, 0x12, 0x01, 0x81, 0x91, 0x10, 0xd3, 0x95, 0x80, 0xd3, 0x75, 0x02, 0xd3, 0x95, 0x80, 0xed, 0x31, 0x01, 0xfe, 0xac, 0x14, 0xfe, 0xad, 0x84, 0xee, 0x0d, 0xcc, 0x6f, 0xbb, 0x51, 0xba, 0xd4, 0xcb, 0x55, 0x03, 0xd3, 0x95, 0x82, 0xc3, 0x34, 0x81, 0x91, 0xb2, 0x94, 0x12, 0xd3, 0x95, 0x88, 0xd3, 0x75, 0xd3, 0x95, 0xed, 0x11, 0xfe, 0xae, 0xfe, 0xce, 0xfe, 0xad, 0xfe, 0xae, 0xfe, 0xad, 0xfe, 0xce, 0x01, 0xfe, 0xae, 0x82, 0xa2, 0xf0, 0x81, 0x91, 0xc3, 0x14, 0x05, 0xd3, 0x95, 0x8d, 0xdc, 0x34, 0xfe, 0xaf, 0xfe, 0xd0, 0xfe, 0xaf, 0xfe, 0xd0, 0xfe, 0xb0, 0xfe, 0xd1, 0xe4, 0x91, 0xa9, 0x11, 0xa1, 0x11, 0x99, 0x31, 0xa1, 0x11, 0x58, 0xd6, 0x88, 0xb5, 0x01, 0xb8, 0xd1, 0x80, 0x50, 0x59, 0x03, 0x00, 0x1f, 0x88, 0x00, 0x7f, 0x00, 0x9f, 0x00, 0xbf, 0x00, 0xff, 0x00, 0xdf, 0x04, 0x7f, 0x07, 0xd2, 0x07, 0xe3, 0x07, 0xf1, 0x01, 0x07, 0xff, 0x84, 0x2c, 0xba, 0x49, 0x33, 0x41, 0x32, 0x41, 0x31, 0x41, 0x11, 0x01, 0x38, 0xf0, 0x82, 0x30, 0xf0, 0x30, 0xef, 0x28, 0xef, 0x01, 0x28, 0xce, 0x80, 0x20, 0xce, 0x01, 0x20, 0xcd, 0x05, 0x20, 0xad, 0x16, 0x18, 0xad,
+  0x80, 0x00, 0xf6, 0x01, 0x01, 0x18, 0x81, 0x18, 0xcf, 0x20, 0xad, 0x01, 0x18, 0xac, 0x01, 0x18, 0xad, 0x80, 0x18, 0xac, 0x31, 0x18, 0xad, 0x87, 0x20, 0xac, 0x20, 0xad, 0x18, 0xad, 0x81, 0x10, 0x99, 0x11, 0xa1, 0x11, 0xa1, 0x71, 0xf5, 0xed, 0x05, 0xfe, 0xad, 0x83, 0xfe, 0xac, 0xfe, 0x6d, 0xf5, 0xcf, 0xf5, 0xef, 0x01, 0xf5, 0xcf, 0x82, 0xf5, 0xef, 0xf5, 0xcf, 0xfe, 0x4d, 0x0b, 0xfe, 0xad, 0x80, 0xfe, 0x4e, 0x01, 0xf5, 0xef, 0x81, 0xf5, 0xcf, 0xf5, 0xee, 0x02, 0xf5, 0xef, 0x80, 0xfe, 0x8d, 0x03, 0xfe, 0xac, 0x81, 0xfe, 0xad, 0xfe, 0x8d, 0x02, 0xfe, 0xad, 0x01, 0xfe, 0xac, 0x85, 0xfe, 0xad, 0xf6, 0x4d, 0xf5, 0xef, 0xf5, 0xcf, 0xf5, 0xef, 0xf5, 0xcf, 0x02, 0xf5, 0xef, 0x80, 0xfe, 0x6e, 0x04, 0xfe, 0xad, 0x01, 0xfe, 0xac, 0x03, 0xfe, 0xad, 0x80, 0xfe, 0xac, 0x01, 0xfe, 0xad, 0x82, 0xf6, 0x0e, 0xf5, 0xef, 0xf5, 0xcf, 0x01, 0xf5, 0xef, 0x83, 0xf5, 0xcf, 0xf6, 0x4e, 0xfe, 0xac, 0xfe, 0xad, 0x0f, 0xf5, 0xef, 0x80, 0xf5, 0xcf, 0x02, 0xf5, 0xef, 0x82, 0xf5, 0xcf, 0xfe, 0x4d, 0xfe, 0xac, 0x08, 0xfe, 0xad, 0x80, 0xfe, 0xac, 0x08, 0xfe, 0xad, 0x80, 0xfe, 0xac, 0x06, 0xfe, 0xad, 0x80, 0xfe, 0x6d, 0x01, 0xf5, 0xef, 0x01, 0xf5, 0xcf, 0x85, 0xfe, 0xad, 0xf6, 0x2e, 0xf5, 0xef, 0xf5, 0xd0, 0xf5, 0xef, 0xf5, 0xcf, 0x01, 0xf5, 0xf0, 0x80, 0xf5, 0xef, 0x0b, 0xf5, 0xf0, 0x83, 0xf5, 0xef, 0xf5, 0xf0, 0xfe, 0x4f, 0xfe, 0xce, 0x07, 0xfe, 0xae, 0x82, 0xfe, 0xaf, 0xf6, 0x10, 0xf5, 0xd0, 0x03, 0xf5, 0xf0, 0x80, 0xf6, 0x10, 0x02, 0xfe, 0xaf, 0x85, 0xfe, 0xd0, 0xfe, 0xb0, 0xfe, 0xb1, 0xe4, 0x71, 0xb8, 0xd1, 0xa1, 0x11, 0x01, 0x99, 0x31, 0x82, 0x99, 0x12, 0x69, 0x33, 0xb0, 0xf1, 0x01, 0xb0, 0xd1, 0x80, 0x28, 0x3c, 0x02, 0x00, 0x1f, 0x89, 0x00, 0x3f, 0x00, 0x7f, 0x00, 0xbf, 0x00, 0xdf, 0x00, 0xff, 0x01, 0x1f, 0x04, 0x7f, 0x07, 0xd1, 0x07, 0xe3, 0x07, 0xf3, 0x01, 0x07, 0xff, 0x80, 0x3b, 0x77, 0x01, 0x49, 0x32, 0x81, 0x41, 0x31, 0x41, 0x11, 0x01, 0x38, 0xf0, 0x01, 0x30, 0xef, 0x80, 0x28, 0xef, 0x01, 0x28, 0xce, 0x80, 0x20, 0xce, 0x01, 0x20, 0xcd, 0x03, 0x20, 0xad, 0x03, 0x18, 0xad, 0x80, 0x18, 0xac, 0x13, 0x18, 0xad,
+  0x83, 0x01, 0x18, 0x01, 0x17, 0x18, 0xcf, 0x18, 0xad, 0x01, 0x18, 0xac, 0x84, 0x18, 0xad, 0x18, 0xac, 0x20, 0xad, 0x18, 0xac, 0x20, 0xac, 0x30, 0x18, 0xac, 0x83, 0x18, 0xcd, 0x18, 0xac, 0x20, 0xac, 0x38, 0xce, 0x02, 0x99, 0x31, 0x83, 0xaa, 0x31, 0xfe, 0x2d, 0xfe, 0x8c, 0xfe, 0x8d, 0x02, 0xfe, 0x8c, 0x81, 0xfe, 0xad, 0xfe, 0x8c, 0x01, 0xfe, 0xac, 0x01, 0xfe, 0x8c, 0x83, 0xfe, 0xac, 0xfe, 0xad, 0xfe, 0x8d, 0xfe, 0x8c, 0x07, 0xfe, 0xad, 0x01, 0xfe, 0x8c, 0x01, 0xfe, 0xac, 0x83, 0xfe, 0xad, 0xfe, 0x8c, 0xfe, 0xad, 0xfe, 0x8c, 0x01, 0xfe, 0x8d, 0x81, 0xfe, 0x8c, 0xfe, 0xad, 0x01, 0xfe, 0x8c, 0x01, 0xfe, 0xad, 0x01, 0xfe, 0xac, 0x01, 0xfe, 0x8c, 0x82, 0xfe, 0xac, 0xfe, 0x8c, 0xfe, 0xac, 0x01, 0xfe, 0xad, 0x8b, 0xfe, 0x8d, 0xfe, 0x8c, 0xfe, 0xad, 0xfe, 0x8d, 0xfe, 0x8c, 0xfe, 0x8d, 0xfe, 0x8c, 0xfe, 0x8d, 0xfe, 0xac, 0xfe, 0x8c, 0xfe, 0xac, 0xfe, 0x8d, 0x01, 0xfe, 0xad, 0x81, 0xfe, 0x8c, 0xfe, 0xac, 0x01, 0xfe, 0x8c, 0x84, 0xfe, 0x8d, 0xfe, 0x8c, 0xfe, 0xac, 0xfe, 0x8d, 0xfe, 0x8c, 0x01, 0xfe, 0xad, 0x02, 0xfe, 0x8c, 0x82, 0xfe, 0xad, 0xfe, 0x8c, 0xfe, 0xac, 0x0f, 0xfe, 0xad, 0x83, 0xfe, 0x8c, 0xfe, 0xac, 0xfe, 0x8d, 0xfe, 0xac, 0x01, 0xfe, 0xad, 0x80, 0xfe, 0x8c, 0x10, 0xfe, 0xad, 0x83, 0xfe, 0xac, 0xfe, 0x8c, 0xfe, 0xad, 0xfe, 0x8c, 0x03, 0xfe, 0x8d, 0x02, 0xfe, 0xad, 0x80, 0xfe, 0x8d, 0x03, 0xfe, 0xad, 0x82, 0xfe, 0x8d, 0xfe, 0x8e, 0xfe, 0xad, 0x01, 0xfe, 0xae, 0x80, 0xfe, 0xad, 0x0b, 0xfe, 0xae, 0x01, 0xfe, 0x8e, 0x02, 0xfe, 0xae, 0x80, 0xfe, 0x8e, 0x02, 0xfe, 0xae, 0x01, 0xfe, 0x8e, 0x81, 0xfe, 0xae, 0xfe, 0xaf, 0x01, 0xfe, 0xae, 0x81, 0xfe, 0xaf, 0xfe, 0x8e, 0x04, 0xfe, 0xaf, 0x88, 0xfe, 0x8f, 0xfe, 0xb0, 0xfe, 0xaf, 0xfe, 0xb0, 0xfe, 0x90, 0xe4, 0x71, 0xb8, 0xd2, 0xa1, 0x11, 0x99, 0x11, 0x01, 0x99, 0x31, 0x84, 0x71, 0x32, 0x71, 0x33, 0xb0, 0xf1, 0xb0, 0xd1, 0xb0, 0xd2, 0x04, 0x00, 0x1f, 0x80, 0x00, 0x7f, 0x01, 0x00, 0xdf, 0x01, 0x01, 0x1f, 0x83, 0x04, 0x9f, 0x07, 0xf0, 0x07, 0xe2, 0x07, 0xf4, 0x01, 0x07, 0xff, 0x80, 0x3a, 0xf6, 0x01, 0x49, 0x32, 0x83, 0x41, 0x11, 0x39, 0x11, 0x39, 0x10, 0x38, 0xf0, 0x01, 0x30, 0xef, 0x80, 0x28, 0xee, 0x01, 0x28, 0xce, 0x80, 0x20, 0xce, 0x01, 0x20, 0xcd, 0x02, 0x20, 0xad, 0x81, 0x18, 0xac, 0x20, 0xac, 0x01, 0x18, 0xad, 0x15, 0x18, 0xac,
+  0x81, 0x01, 0x17, 0x18, 0xcf, 0x01, 0x20, 0xac, 0x80, 0x20, 0xad, 0x01, 0x18, 0xac, 0x01, 0x20, 0xac, 0x81, 0x18, 0xac, 0x20, 0xac, 0x32, 0x18, 0xac, 0x83, 0x20, 0xad, 0x20, 0xac, 0x60, 0xef, 0x99, 0x12, 0x01, 0x99, 0x31, 0x81, 0xb2, 0x70, 0xf6, 0x2d, 0x01, 0xfe, 0x8c, 0x02, 0xfe, 0x8d, 0x81, 0xfe, 0x8c, 0xfe, 0x8d, 0x03, 0xfe, 0x8c, 0x02, 0xfe, 0x8d, 0x08, 0xfe, 0x8c, 0x80, 0xfe, 0x8d, 0x01, 0xfe, 0x8c, 0x02, 0xfe, 0x8d, 0x82, 0xfe, 0x8c, 0xfe, 0x8d, 0xfe, 0x8c, 0x03, 0xfe, 0x8d, 0x80, 0xfe, 0x8c, 0x08, 0xfe, 0x8d, 0x81, 0xfe, 0x8c, 0xfe, 0x8d, 0x03, 0xfe, 0x8c, 0x80, 0xfe, 0x8d, 0x02, 0xfe, 0x8c, 0x01, 0xfe, 0x8d, 0x02, 0xfe, 0x8c, 0x01, 0xfe, 0x8d, 0x01, 0xfe, 0x8c, 0x80, 0xfe, 0x8d, 0x03, 0xfe, 0x8c, 0x01, 0xfe, 0x8d, 0x81, 0xfe, 0x8c, 0xfe, 0x8d, 0x02, 0xfe, 0x8c, 0x12, 0xfe, 0x8d, 0x01, 0xfe, 0x8c, 0x83, 0xfe, 0x6d, 0xfe, 0x8d, 0xfe, 0x8c, 0xfe, 0x8d, 0x0a, 0xfe, 0x8c, 0x04, 0xfe, 0x8d, 0x80, 0xfe, 0x8c, 0x09, 0xfe, 0x8d, 0x80, 0xfe, 0x8e, 0x04, 0xfe, 0x8d, 0x10, 0xfe, 0x8e, 0x80, 0xfe, 0x8f, 0x01, 0xfe, 0x8e, 0x01, 0xfe, 0x8f, 0x80, 0xfe, 0x8e, 0x01, 0xfe, 0x8f, 0x82, 0xfe, 0x8e, 0xfe, 0x8f, 0xfe, 0x8e, 0x0a, 0xfe, 0x8f, 0x01, 0xfe, 0x90, 0x01, 0xfe, 0xb0, 0x82, 0xe4, 0x71, 0xb8, 0xd1, 0xa1, 0x11, 0x01, 0x99, 0x31, 0x86, 0x99, 0x12, 0x89, 0x11, 0x51, 0x74, 0x69, 0x53, 0xb0, 0xf1, 0xb0, 0xd1, 0x90, 0xb4, 0x03, 0x00, 0x1f, 0x8f, 0x00, 0x3f, 0x00, 0x9f, 0x00, 0xdf, 0x00, 0xff, 0x01, 0x1f, 0x01, 0x5f, 0x04, 0x9f, 0x07, 0xf1, 0x07, 0xe2, 0x07, 0xf6, 0x07, 0xff, 0x0f, 0x9f, 0x4a, 0x35, 0x49, 0x33, 0x49, 0x32, 0x41, 0x31, 0x01, 0x39, 0x10, 0x80, 0x38, 0xf0, 0x01, 0x30, 0xef, 0x02, 0x28, 0xce, 0x02, 0x20, 0xcd, 0x02, 0x20, 0xad, 0x80, 0x18, 0xac, 0x01, 0x20, 0xac, 0x01, 0x18, 0xac, 0x80, 0x20, 0xac, 0x13, 0x18, 0xac,
+  0x83, 0x18, 0xce, 0x18, 0xac, 0x20, 0xcc, 0x20, 0xac, 0x01, 0x18, 0xac, 0x02, 0x20, 0xac, 0x82, 0x20, 0xad, 0x18, 0xcc, 0x20, 0xad, 0x31, 0x20, 0xac, 0x83, 0x18, 0xac, 0x20, 0xac, 0x28, 0xad, 0x81, 0x10, 0x01, 0x99, 0x31, 0x83, 0x99, 0x11, 0xaa, 0x31, 0xf5, 0xcd, 0xfe, 0x8c, 0x15, 0xfe, 0x6c, 0x80, 0xfe, 0x6d, 0x01, 0xfe, 0x6c, 0x80, 0xfe, 0x6d, 0x0e, 0xfe, 0x6c, 0x80, 0xfe, 0x8c, 0x04, 0xfe, 0x6c, 0x80, 0xfe, 0x6d, 0x01, 0xfe, 0x6c, 0x82, 0xfe, 0x6d, 0xfe, 0x6c, 0xfe, 0x6d, 0x03, 0xfe, 0x6c, 0x80, 0xfe, 0x6d, 0x0a, 0xfe, 0x6c, 0x80, 0xfe, 0x6d, 0x19, 0xfe, 0x6c, 0x80, 0xfe, 0x8c, 0x01, 0xfe, 0x6d, 0x11, 0xfe, 0x6c, 0x83, 0xfe, 0x6d, 0xfe, 0x6c, 0xfe, 0x6d, 0xfe, 0x6c, 0x03, 0xfe, 0x6d, 0x80, 0xfe, 0x6c, 0x02, 0xfe, 0x6d, 0x80, 0xfe, 0x8e, 0x01, 0xfe, 0x8d, 0x81, 0xfe, 0x6e, 0xfe, 0x8d, 0x0a, 0xfe, 0x6e, 0x03, 0xfe, 0x6f, 0x01, 0xfe, 0x8f, 0x02, 0xfe, 0x6f, 0x80, 0xfe, 0x8f, 0x01, 0xfe, 0x6f, 0x01, 0xfe, 0x8f, 0x01, 0xfe, 0x6f, 0x80, 0xfe, 0x8f, 0x01, 0xfe, 0x6f, 0x01, 0xfe, 0x8f, 0x80, 0xfe, 0x6f, 0x01, 0xfe, 0x8f, 0x81, 0xfe, 0x6f, 0xfe, 0x90, 0x01, 0xfe, 0x8f, 0x01, 0xfe, 0x90, 0x82, 0xe4, 0x71, 0xb0, 0xd1, 0xa1, 0x11, 0x02, 0x99, 0x31, 0x83, 0x99, 0x12, 0x59, 0x53, 0x51, 0x53, 0x71, 0x33, 0x01, 0xb0, 0xd1, 0x80, 0x78, 0x96, 0x02, 0x00, 0x1f, 0x82, 0x00, 0x3f, 0x00, 0x5f, 0x00, 0xbf, 0x01, 0x01, 0x1f, 0x8d, 0x01, 0x3f, 0x01, 0x7f, 0x04, 0xbf, 0x07, 0xf2, 0x07, 0xe2, 0x07, 0xf5, 0x07, 0xff, 0x73, 0x36, 0x51, 0x53, 0x49, 0x33, 0x49, 0x32, 0x41, 0x31, 0x41, 0x10, 0x39, 0x10, 0x02, 0x30, 0xef, 0x01, 0x28, 0xce, 0x80, 0x28, 0xcd, 0x02, 0x20, 0xcd, 0x02, 0x20, 0xad, 0x01, 0x20, 0xac, 0x80, 0x20, 0xad, 0x01, 0x18, 0xac, 0x14, 0x20, 0xac,
+  0x01, 0x20, 0xac, 0x01, 0x18, 0xac, 0x80, 0x20, 0xac, 0x05, 0x18, 0xac, 0x30, 0x20, 0xac, 0x01, 0x18, 0xac, 0x01, 0x20, 0xac, 0x82, 0x18, 0xac, 0x28, 0xad, 0x91, 0x11, 0x02, 0x99, 0x31, 0x83, 0xa1, 0x71, 0xcb, 0xcf, 0xf6, 0x0d, 0xfe, 0x4d, 0x08, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x0c, 0xfe, 0x6d, 0x82, 0xfe, 0x6c, 0xfe, 0x6d, 0xfe, 0x4d, 0x04, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x04, 0xfe, 0x6d, 0x82, 0xfe, 0x4d, 0xfe, 0x6d, 0xfe, 0x6c, 0x07, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x02, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x05, 0xfe, 0x6d, 0x82, 0xfe, 0x6c, 0xfe, 0x6d, 0xfe, 0x4d, 0x08, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x2c, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x02, 0xfe, 0x6d, 0x80, 0xfe, 0x4d, 0x01, 0xfe, 0x6e, 0x81, 0xfe, 0x4e, 0xfe, 0x6d, 0x04, 0xfe, 0x6e, 0x80, 0xfe, 0x6f, 0x01, 0xfe, 0x6e, 0x11, 0xfe, 0x6f, 0x01, 0xfe, 0x70, 0x80, 0xfe, 0x6f, 0x08, 0xfe, 0x70, 0x80, 0xfe, 0x90, 0x03, 0xfe, 0x70, 0x02, 0xfe, 0x71, 0x84, 0xe4, 0x71, 0xa8, 0xf1, 0xa1, 0x11, 0x99, 0x31, 0x99, 0x32, 0x01, 0x99, 0x31, 0x83, 0x69, 0x33, 0x51, 0x53, 0x59, 0x53, 0x71, 0x53, 0x01, 0xb0, 0xd1, 0x80, 0x58, 0x78, 0x01, 0x00, 0x1f, 0x83, 0x00, 0x3f, 0x00, 0x7f, 0x00, 0x9f, 0x00, 0xff, 0x01, 0x01, 0x3f, 0x88, 0x01, 0x7f, 0x01, 0x9f, 0x03, 0x3f, 0x07, 0xf3, 0x07, 0xe2, 0x07, 0xf3, 0x07, 0xff, 0xa8, 0xf1, 0x69, 0x32, 0x01, 0x49, 0x32, 0x83, 0x49, 0x31, 0x41, 0x11, 0x39, 0x10, 0x31, 0x10, 0x01, 0x30, 0xef, 0x01, 0x28, 0xce, 0x80, 0x28, 0xcd, 0x02, 0x20, 0xcd, 0x02, 0x20, 0xad, 0x01, 0x20, 0xac, 0x80, 0x20, 0xad, 0x16, 0x20, 0xac,
+  0x80, 0x18, 0xcc, 0x01, 0x18, 0xac, 0x80, 0x20, 0xac, 0x38, 0x18, 0xac, 0x80, 0x20, 0xac, 0x02, 0x18, 0xac, 0x84, 0x20, 0xac, 0x28, 0xcd, 0x81, 0x11, 0x99, 0x31, 0x99, 0x12, 0x01, 0x99, 0x31, 0x88, 0x99, 0x11, 0xba, 0xb0, 0xdc, 0x6f, 0xe5, 0x0f, 0xe5, 0x0e, 0xfe, 0x4e, 0xfe, 0x6e, 0xfe, 0x4e, 0xfe, 0x6d, 0x01, 0xfe, 0x4e, 0x60, 0xfe, 0x4d, 0x01, 0xfe, 0x4e, 0x05, 0xfe, 0x4d, 0x03, 0xfe, 0x4e, 0x01, 0xfe, 0x6e, 0x02, 0xfe, 0x4e, 0x01, 0xfe, 0x6e, 0x82, 0xfe, 0x4e, 0xfe, 0x6f, 0xfe, 0x6e, 0x05, 0xfe, 0x6f, 0x83, 0xfe, 0x4f, 0xfe, 0x6f, 0xfe, 0x70, 0xfe, 0x50, 0x0f, 0xfe, 0x70, 0x0c, 0xfe, 0x71, 0x84, 0xf6, 0x12, 0xe5, 0x31, 0xe5, 0x12, 0xd4, 0x72, 0xb2, 0x71, 0x02, 0x99, 0x31, 0x84, 0x99, 0x11, 0x99, 0x31, 0x99, 0x11, 0x61, 0x53, 0x51, 0x53, 0x01, 0x59, 0x54, 0x80, 0x71, 0x54, 0x01, 0xb0, 0xf1, 0x95, 0x28, 0x5c, 0x00, 0x3f, 0x00, 0x5f, 0x00, 0x7f, 0x00, 0xbf, 0x00, 0xff, 0x01, 0x3f, 0x01, 0x5f, 0x01, 0x7f, 0x01, 0x9f, 0x01, 0xbf, 0x02, 0xff, 0x07, 0xf4, 0x07, 0xe3, 0x07, 0xf1, 0x2e, 0x5c, 0xa9, 0x11, 0x69, 0x32, 0x51, 0x32, 0x49, 0x31, 0x41, 0x32, 0x41, 0x10, 0x01, 0x39, 0x10, 0x81, 0x30, 0xef, 0x30, 0xee, 0x01, 0x28, 0xce, 0x80, 0x28, 0xcd, 0x02, 0x20, 0xcd, 0x80, 0x20, 0xac, 0x01, 0x20, 0xad, 0x02, 0x20, 0xac, 0x01, 0x18, 0xac, 0x80, 0x20, 0xac, 0x13, 0x18, 0xac,
+  0x83, 0x20, 0xac, 0x18, 0xac, 0x20, 0xac, 0x18, 0xac, 0x37, 0x20, 0xac, 0x80, 0x18, 0xac, 0x02, 0x20, 0xac, 0x80, 0x18, 0xac, 0x01, 0x20, 0xac, 0x82, 0x28, 0xcc, 0x61, 0x0f, 0x99, 0x11, 0x07, 0x99, 0x31, 0x80, 0x99, 0x32, 0x75, 0x99, 0x31, 0x80, 0x99, 0x12, 0x03, 0x99, 0x31, 0x82, 0x99, 0x11, 0x99, 0x31, 0x99, 0x11, 0x01, 0x99, 0x31, 0x01, 0x99, 0x11, 0x01, 0x99, 0x31, 0x80, 0x99, 0x11, 0x17, 0x99, 0x31, 0x01, 0x99, 0x11, 0x81, 0x99, 0x31, 0x99, 0x32, 0x01, 0x99, 0x31, 0x80, 0x99, 0x11, 0x01, 0x99, 0x31, 0x80, 0x99, 0x12, 0x03, 0x99, 0x31, 0x83, 0x89, 0x12, 0x51, 0x53, 0x59, 0x53, 0x51, 0x53, 0x01, 0x59, 0x74, 0x88, 0x79, 0x53, 0xb0, 0xf1, 0xb0, 0xd1, 0x08, 0x7f, 0x00, 0x9f, 0x00, 0xbf, 0x00, 0xdf, 0x01, 0x1f, 0x01, 0x5f, 0x02, 0x01, 0x9f, 0x01, 0x01, 0xdf, 0x8b, 0x01, 0xff, 0x07, 0xf7, 0x07, 0xe3, 0x07, 0xef, 0x54, 0x98, 0xa8, 0xf1, 0x71, 0x32, 0x49, 0x52, 0x49, 0x31, 0x41, 0x31, 0x41, 0x10, 0x39, 0x10, 0x01, 0x30, 0xef, 0x80, 0x30, 0xee, 0x01, 0x28, 0xce, 0x80, 0x28, 0xcd, 0x02, 0x20, 0xcd, 0x05, 0x20, 0xac, 0x01, 0x18, 0xac, 0x14, 0x20, 0xac,
+  0x83, 0x20, 0xac, 0x18, 0xac, 0x20, 0xac, 0x18, 0xac, 0x39, 0x20, 0xac, 0x01, 0x18, 0xac, 0x03, 0x20, 0xac, 0x82, 0x18, 0xac, 0x40, 0xce, 0x79, 0x10, 0x01, 0x99, 0x31, 0x80, 0x99, 0x32, 0x02, 0x99, 0x31, 0x80, 0x99, 0x11, 0x78, 0x99, 0x31, 0x80, 0x99, 0x11, 0x01, 0x99, 0x31, 0x81, 0xa1, 0x11, 0x99, 0x11, 0x2b, 0x99, 0x31, 0x81, 0x99, 0x12, 0x71, 0x32, 0x02, 0x51, 0x53, 0x01, 0x59, 0x74, 0x88, 0x61, 0x74, 0x91, 0x13, 0xb0, 0xf1, 0x98, 0xf3, 0x00, 0xdf, 0x00, 0xff, 0x01, 0x1f, 0x01, 0x3f, 0x01, 0x7f, 0x01, 0x01, 0xbf, 0x01, 0x01, 0xdf, 0x01, 0x01, 0xff, 0x8e, 0x02, 0x1f, 0x06, 0xd9, 0x07, 0xe5, 0x07, 0xec, 0x73, 0x55, 0xa8, 0xf1, 0x79, 0x32, 0x49, 0x32, 0x49, 0x31, 0x41, 0x31, 0x41, 0x10, 0x39, 0x10, 0x39, 0x0f, 0x30, 0xef, 0x30, 0xee, 0x01, 0x28, 0xce, 0x01, 0x28, 0xcd, 0x01, 0x20, 0xcd, 0x1c, 0x20, 0xac,
+  0x3c, 0x20, 0xac, 0x80, 0x18, 0xac, 0x07, 0x20, 0xac, 0x83, 0x18, 0xab, 0x30, 0xcc, 0x58, 0xcf, 0x79, 0x10, 0x01, 0x99, 0x31, 0x80, 0x99, 0x12, 0x01, 0x99, 0x31, 0x84, 0x99, 0x11, 0x99, 0x31, 0x99, 0x11, 0x99, 0x32, 0x99, 0x31, 0x5f, 0x99, 0x11, 0x13, 0x99, 0x31, 0x01, 0x99, 0x11, 0x01, 0x99, 0x31, 0x80, 0x99, 0x11, 0x05, 0x99, 0x31, 0x80, 0x99, 0x11, 0x1f, 0x99, 0x31, 0x85, 0xa1, 0x11, 0x99, 0x11, 0x89, 0x32, 0x69, 0x32, 0x51, 0x52, 0x51, 0x53, 0x01, 0x59, 0x53, 0x8f, 0x59, 0x74, 0x61, 0x74, 0x61, 0x75, 0x79, 0x54, 0xa8, 0xf1, 0xb0, 0xf1, 0x80, 0xf5, 0x01, 0x3f, 0x01, 0x7f, 0x01, 0x9f, 0x01, 0xbf, 0x01, 0xdf, 0x01, 0xff, 0x01, 0xdf, 0x01, 0xff, 0x02, 0x1f, 0x02, 0x02, 0x3f, 0x8e, 0x05, 0x7d, 0x07, 0xe8, 0x07, 0xe9, 0x82, 0xd5, 0xa0, 0xf1, 0x81, 0x32, 0x51, 0x32, 0x49, 0x31, 0x41, 0x31, 0x41, 0x10, 0x38, 0xf0, 0x38, 0xef, 0x30, 0xef, 0x30, 0xee, 0x28, 0xce, 0x02, 0x28, 0xcd, 0x01, 0x20, 0xcd, 0x1c, 0x20, 0xac,
+  0x80, 0x18, 0xac, 0x01, 0x20, 0xac, 0x80, 0x18, 0xac, 0x38, 0x20, 0xac, 0x80, 0x18, 0xcc, 0x0d, 0x20, 0xac, 0x80, 0x20, 0xab, 0x70, 0x20, 0xac, 0x81, 0x20, 0xcc, 0x20, 0xad, 0x01, 0x20, 0xcd, 0x04, 0x28, 0xcd, 0x80, 0x28, 0xce, 0x01, 0x28, 0xee, 0x80, 0x30, 0xee, 0x01, 0x30, 0xef, 0x8e, 0x30, 0xee, 0x38, 0xef, 0x51, 0x10, 0x61, 0x10, 0x59, 0x10, 0x69, 0x30, 0x79, 0x31, 0x81, 0x31, 0x81, 0x30, 0x99, 0x31, 0xa9, 0x32, 0xa1, 0x31, 0xb1, 0x31, 0xc9, 0x12, 0xc9, 0x11, 0x02, 0xc8, 0xf2, 0x81, 0xc8, 0xd1, 0xc0, 0xd1, 0x0a, 0xc0, 0xb1, 0x82, 0xc0, 0xd1, 0xb8, 0xb1, 0xc0, 0xd1, 0x06, 0xb8, 0xd1, 0x80, 0xb0, 0xd1, 0x01, 0xb8, 0xd1, 0x01, 0xb0, 0xd1, 0x80, 0xb0, 0xf1, 0x02, 0xb0, 0xd1, 0x02, 0xb0, 0xf1, 0x84, 0x51, 0x58, 0x01, 0xbf, 0x01, 0xdf, 0x01, 0xff, 0x02, 0x1f, 0x01, 0x02, 0x3f, 0x81, 0x02, 0x1f, 0x02, 0x3f, 0x03, 0x02, 0x5f, 0x8c, 0x04, 0x1f, 0x07, 0xed, 0x07, 0xe4, 0x7a, 0xb4, 0xa9, 0x11, 0x91, 0x12, 0x51, 0x32, 0x49, 0x31, 0x41, 0x11, 0x41, 0x10, 0x39, 0x10, 0x38, 0xef, 0x30, 0xef, 0x01, 0x30, 0xee, 0x02, 0x28, 0xcd, 0x81, 0x20, 0xcd, 0x20, 0xcc, 0x1c, 0x20, 0xac,
+  0x82, 0x20, 0xcc, 0x20, 0xac, 0x20, 0xab, 0x3d, 0x20, 0xac, 0x80, 0x18, 0xac, 0x02, 0x20, 0xac, 0x83, 0x18, 0xac, 0x20, 0xac, 0x20, 0xab, 0x18, 0xac, 0x05, 0x20, 0xac, 0x80, 0x20, 0xab, 0x6d, 0x20, 0xac, 0x80, 0x20, 0xcc, 0x01, 0x20, 0xcd, 0x03, 0x28, 0xcd, 0x81, 0x28, 0xad, 0x28, 0xce, 0x01, 0x30, 0xce, 0x84, 0x30, 0xee, 0x81, 0x51, 0xb1, 0x92, 0xc9, 0xb3, 0xc9, 0xb2, 0x02, 0xc9, 0x92, 0x02, 0xc9, 0x72, 0x01, 0xc9, 0x52, 0x02, 0xc9, 0x32, 0x01, 0xc9, 0x12, 0x80, 0xc1, 0x11, 0x01, 0xc8, 0xf1, 0x82, 0xc8, 0xd1, 0xc0, 0xd1, 0xc8, 0xb1, 0x0a, 0xc0, 0xb1, 0x81, 0xc0, 0xd1, 0xb8, 0xb1, 0x06, 0xb8, 0xd1, 0x80, 0xb0, 0xd2, 0x02, 0xb8, 0xd1, 0x80, 0xb0, 0xd1, 0x06, 0xb0, 0xf1, 0x84, 0xa8, 0xf1, 0x39, 0xbb, 0x02, 0x1f, 0x02, 0x3f, 0x02, 0x5f, 0x01, 0x02, 0x7f, 0x01, 0x02, 0x5f, 0x04, 0x02, 0x7f, 0x8c, 0x02, 0x9f, 0x07, 0xf3, 0x07, 0xe2, 0x99, 0x72, 0xa9, 0x11, 0xa1, 0x12, 0x49, 0x52, 0x49, 0x32, 0x41, 0x31, 0x41, 0x10, 0x39, 0x10, 0x38, 0xef, 0x30, 0xef, 0x01, 0x30, 0xee, 0x02, 0x28, 0xcd, 0x81, 0x20, 0xcd, 0x20, 0xcc, 0x1c, 0x20, 0xac,
+  0x01, 0x20, 0xab, 0x3a, 0x20, 0xac, 0x84, 0x18, 0xac, 0x20, 0xac, 0x18, 0xcc, 0x18, 0xac, 0x20, 0xab, 0x01, 0x20, 0xac, 0x80, 0x20, 0xab, 0x01, 0x20, 0xac, 0x80, 0x18, 0xac, 0x01, 0x20, 0xab, 0x01, 0x20, 0xac, 0x01, 0x20, 0xab, 0x01, 0x20, 0xac, 0x01, 0x20, 0xab, 0x81, 0x20, 0xac, 0x20, 0xab, 0x69, 0x20, 0xac, 0x02, 0x20, 0xcc, 0x03, 0x28, 0xcd, 0x84, 0x30, 0xcd, 0x28, 0xee, 0x30, 0xee, 0x49, 0x0e, 0xa9, 0xb2, 0x01, 0xc9, 0xd3, 0x01, 0xc9, 0xb3, 0x01, 0xc9, 0x92, 0x02, 0xc9, 0x72, 0x02, 0xc9, 0x52, 0x01, 0xc9, 0x32, 0x02, 0xc9, 0x12, 0x81, 0xc0, 0xf2, 0xc8, 0xd1, 0x01, 0xc0, 0xd1, 0x80, 0xc8, 0xb1, 0x0a, 0xc0, 0xb1, 0x0a, 0xb8, 0xd1, 0x01, 0xb0, 0xd1, 0x84, 0xb8, 0xd2, 0xb8, 0xd1, 0xb0, 0xf1, 0xb0, 0xd1, 0xb0, 0xf2, 0x02, 0xb0, 0xf1, 0x01, 0xa8, 0xf1, 0x81, 0x12, 0x3e, 0x02, 0x9f, 0x02, 0x02, 0xbf, 0x02, 0x02, 0x9f, 0x02, 0x02, 0xbf, 0x01, 0x02, 0x9f, 0x88, 0x02, 0xdf, 0x06, 0xb9, 0x07, 0xe3, 0xa1, 0x11, 0xa9, 0x11, 0xa1, 0x11, 0x59, 0x32, 0x49, 0x31, 0x49, 0x11, 0x01, 0x41, 0x10, 0x81, 0x39, 0x0f, 0x38, 0xef, 0x01, 0x30, 0xee, 0x02, 0x28, 0xcd, 0x81, 0x20, 0xcd, 0x20, 0xcc, 0x06, 0x20, 0xac, 0x80, 0x20, 0xab, 0x14, 0x20, 0xac,
+  0x82, 0x20, 0xab, 0x20, 0xac, 0x20, 0xab, 0x39, 0x20, 0xac, 0x82, 0x20, 0xab, 0x20, 0xac, 0x20, 0xab, 0x01, 0x20, 0xac, 0x01, 0x20, 0xab, 0x82, 0x18, 0xac, 0x20, 0xac, 0x20, 0xab, 0x02, 0x20, 0xac, 0x80, 0x18, 0xab, 0x01, 0x20, 0xab, 0x80, 0x20, 0xac, 0x05, 0x20, 0xab, 0x69, 0x20, 0xac, 0x81, 0x20, 0xcc, 0x20, 0xcd, 0x05, 0x28, 0xcd, 0x81, 0x30, 0xed, 0x69, 0x2f, 0x01, 0xc9, 0xd3, 0x02, 0xc9, 0xb3, 0x01, 0xc9, 0x92, 0x02, 0xc9, 0x72, 0x01, 0xc9, 0x52, 0x01, 0xc9, 0x32, 0x80, 0xc1, 0x32, 0x01, 0xc9, 0x12, 0x82, 0xc8, 0xf2, 0xc8, 0xf1, 0xc8, 0xd1, 0x01, 0xc0, 0xd1, 0x0a, 0xc0, 0xb1, 0x09, 0xb8, 0xd1, 0x82, 0xb0, 0xd1, 0xb8, 0xd1, 0xb0, 0xf1, 0x01, 0xb0, 0xd1, 0x81, 0xb0, 0xf1, 0xb0, 0xd1, 0x05, 0xb0, 0xf1, 0x81, 0xa8, 0xf1, 0x99, 0x33, 0x01, 0x02, 0xdf, 0x01, 0x02, 0xff, 0x81, 0x02, 0xdf, 0x02, 0xbf, 0x04, 0x02, 0xdf, 0x01, 0x02, 0xbf, 0x83, 0x02, 0xff, 0x05, 0x1e, 0x07, 0xe8, 0xa9, 0x12, 0x01, 0xa1, 0x11, 0x80, 0x69, 0x32, 0x01, 0x49, 0x31, 0x83, 0x41, 0x30, 0x41, 0x0f, 0x39, 0x0f, 0x38, 0xee, 0x01, 0x30, 0xee, 0x02, 0x28, 0xcd, 0x81, 0x20, 0xcd, 0x20, 0xcc, 0x06, 0x20, 0xac, 0x01, 0x20, 0xab, 0x13, 0x20, 0xac,
+  0x7f, 0x20, 0xab, 0x38, 0x20, 0xab, 0x02, 0x20, 0xac, 0x81, 0x28, 0xac, 0x20, 0xcc, 0x02, 0x28, 0xcc, 0x01, 0x28, 0xcd, 0x83, 0x28, 0xed, 0x28, 0xcd, 0x30, 0xcd, 0x91, 0x91, 0x01, 0xc9, 0xd3, 0x01, 0xc9, 0xb3, 0x81, 0xc9, 0x92, 0xc9, 0xb3, 0x01, 0xc9, 0x92, 0x01, 0xc9, 0x72, 0x01, 0xc9, 0x52, 0x01, 0xc9, 0x32, 0x83, 0xc9, 0x12, 0xc9, 0x32, 0xc9, 0x12, 0xc1, 0x12, 0x01, 0xc8, 0xf2, 0x01, 0xc8, 0xd1, 0x01, 0x90, 0x95, 0x82, 0x90, 0x75, 0x88, 0x75, 0x60, 0x78, 0x01, 0x60, 0x59, 0x01, 0x60, 0x58, 0x01, 0x60, 0x78, 0x80, 0x60, 0x59, 0x01, 0x60, 0x78, 0x82, 0x58, 0x78, 0x60, 0x78, 0x88, 0xb4, 0x01, 0x88, 0xb5, 0x03, 0xb8, 0xd1, 0x01, 0xb0, 0xf1, 0x01, 0xb0, 0xd1, 0x05, 0xb0, 0xf1, 0x02, 0xa8, 0xf1, 0x80, 0x69, 0xd6, 0x02, 0x03, 0x3f, 0x80, 0x03, 0x1f, 0x06, 0x02, 0xff, 0x85, 0x02, 0xdf, 0x02, 0xff, 0x03, 0x5f, 0x03, 0xff, 0x07, 0xf0, 0x8a, 0x4f, 0x01, 0xa1, 0x11, 0x80, 0x81, 0x32, 0x01, 0x49, 0x31, 0x82, 0x41, 0x10, 0x41, 0x0f, 0x39, 0x0f, 0x01, 0x30, 0xee, 0x01, 0x30, 0xcd, 0x01, 0x28, 0xcd, 0x01, 0x28, 0xcc, 0x80, 0x20, 0xcc, 0x02, 0x20, 0xac, 0x18, 0x20, 0xab,
+  0x7f, 0x20, 0xab, 0x3a, 0x20, 0xab, 0x81, 0x20, 0xcc, 0x20, 0xac, 0x02, 0x28, 0xcc, 0x80, 0x20, 0xcc, 0x01, 0x28, 0xcc, 0x82, 0x28, 0xcd, 0x40, 0xee, 0xa9, 0xb2, 0x01, 0xc9, 0xd3, 0x82, 0xc9, 0xb3, 0xc9, 0xb2, 0xc9, 0xb3, 0x01, 0xc9, 0x92, 0x01, 0xc9, 0x72, 0x02, 0xc9, 0x52, 0x01, 0xc9, 0x32, 0x86, 0x90, 0xd5, 0x88, 0xd6, 0x60, 0x98, 0x58, 0x79, 0x30, 0x3c, 0x30, 0x5c, 0x08, 0x1e, 0x10, 0x00, 0x1f, 0x8a, 0x00, 0x3f, 0x00, 0x5f, 0x00, 0x7f, 0x00, 0x9f, 0x00, 0xbf, 0x00, 0xdf, 0x29, 0x1c, 0x41, 0x1a, 0x61, 0x18, 0x89, 0x15, 0xb0, 0xd1, 0x06, 0xb0, 0xf1, 0x83, 0xb0, 0xf2, 0xa8, 0xf1, 0xb0, 0xf1, 0x42, 0x9a, 0x01, 0x03, 0x9f, 0x01, 0x03, 0x5f, 0x05, 0x03, 0x3f, 0x02, 0x03, 0x1f, 0x83, 0x03, 0x7f, 0x03, 0xff, 0x06, 0xd7, 0x7a, 0xcf, 0x01, 0xa1, 0x11, 0x89, 0x99, 0x12, 0x51, 0x31, 0x49, 0x31, 0x41, 0x10, 0x41, 0x0f, 0x40, 0xef, 0x38, 0xee, 0x30, 0xee, 0x30, 0xed, 0x30, 0xcd, 0x01, 0x28, 0xcd, 0x01, 0x28, 0xcc, 0x01, 0x20, 0xcc, 0x1a, 0x20, 0xab,
+  0x7f, 0x20, 0xab, 0x3a, 0x20, 0xab, 0x02, 0x20, 0xcb, 0x02, 0x28, 0xcc, 0x83, 0x28, 0xcd, 0x28, 0xcc, 0x49, 0x0e, 0xc1, 0xd3, 0x01, 0xc9, 0xd3, 0x03, 0xc9, 0xb3, 0x01, 0xc9, 0x92, 0x85, 0xc9, 0x72, 0xc9, 0x52, 0x98, 0xf5, 0x60, 0xb8, 0x40, 0x7b, 0x18, 0x3e, 0x16, 0x00, 0x1f, 0x01, 0x00, 0x3f, 0x01, 0x00, 0x7f, 0x8e, 0x00, 0x9f, 0x00, 0xbf, 0x00, 0xff, 0x01, 0x1f, 0x01, 0x3f, 0x01, 0x7f, 0x01, 0x9f, 0x01, 0xdf, 0x02, 0x1f, 0x21, 0xfd, 0x49, 0xd9, 0x79, 0x96, 0xa1, 0x12, 0xa8, 0xf1, 0xb0, 0xf1, 0x03, 0xa8, 0xf1, 0x82, 0x13, 0x9e, 0x03, 0xdf, 0x03, 0xbf, 0x01, 0x03, 0x9f, 0x03, 0x03, 0x7f, 0x01, 0x03, 0x5f, 0x01, 0x03, 0x3f, 0x84, 0x03, 0x5f, 0x03, 0xbf, 0x04, 0x1f, 0x05, 0xde, 0x7a, 0xd1, 0x02, 0xa1, 0x11, 0x81, 0x59, 0x31, 0x49, 0x31, 0x01, 0x41, 0x30, 0x82, 0x40, 0xef, 0x38, 0xee, 0x30, 0xee, 0x01, 0x30, 0xed, 0x03, 0x28, 0xcc, 0x80, 0x20, 0xcb, 0x1b, 0x20, 0xab,
+  0x7f, 0x20, 0xab, 0x3b, 0x20, 0xab, 0x80, 0x20, 0xcb, 0x04, 0x28, 0xcc, 0x81, 0x69, 0x2f, 0xc9, 0xf3, 0x01, 0xc9, 0xd3, 0x87, 0xc9, 0xb2, 0xc9, 0xb3, 0xc9, 0x92, 0xc9, 0xb2, 0xc9, 0x72, 0xb9, 0x73, 0x80, 0xf7, 0x38, 0x7b, 0x19, 0x00, 0x1f, 0x01, 0x00, 0x3f, 0x93, 0x00, 0x5f, 0x00, 0x7f, 0x00, 0x9f, 0x00, 0xbf, 0x00, 0xdf, 0x00, 0xff, 0x01, 0x3f, 0x01, 0x5f, 0x01, 0x9f, 0x01, 0xbf, 0x01, 0xff, 0x02, 0x3f, 0x02, 0x5f, 0x02, 0x9f, 0x02, 0xdf, 0x02, 0xff, 0x03, 0x3f, 0x2a, 0xdc, 0x5a, 0x58, 0x89, 0x94, 0x01, 0xa8, 0xf1, 0x80, 0x81, 0xd4, 0x01, 0x04, 0x1f, 0x81, 0x03, 0xff, 0x03, 0xdf, 0x04, 0x03, 0xbf, 0x89, 0x03, 0x9f, 0x03, 0x7f, 0x03, 0x5f, 0x03, 0x7f, 0x03, 0x9f, 0x03, 0xff, 0x04, 0x7f, 0x04, 0xff, 0x63, 0x75, 0xa1, 0x12, 0x01, 0xa1, 0x11, 0x81, 0x71, 0x11, 0x49, 0x31, 0x01, 0x41, 0x10, 0x82, 0x39, 0x0f, 0x38, 0xee, 0x30, 0xee, 0x01, 0x30, 0xed, 0x03, 0x28, 0xcc, 0x1c, 0x20, 0xab,
+  0x7f, 0x20, 0xab, 0x3b, 0x20, 0xab, 0x81, 0x20, 0xcb, 0x28, 0xac, 0x02, 0x28, 0xcc, 0x83, 0x69, 0x2e, 0xc9, 0xf3, 0xc9, 0xd2, 0xc9, 0xd3, 0x01, 0xc9, 0xb3, 0x83, 0xc9, 0x92, 0xc9, 0x93, 0x80, 0xf7, 0x38, 0x9b, 0x05, 0x00, 0x1f, 0x84, 0x08, 0x3c, 0x08, 0x5b, 0x10, 0x5b, 0x20, 0x78, 0x20, 0x98, 0x04, 0x20, 0x97, 0x83, 0x20, 0x98, 0x18, 0x7a, 0x10, 0x5b, 0x08, 0x5d, 0x08, 0x00, 0x1f, 0x9a, 0x00, 0x3f, 0x00, 0x5f, 0x00, 0x7f, 0x00, 0x9f, 0x00, 0xdf, 0x00, 0xff, 0x01, 0x1f, 0x01, 0x5f, 0x01, 0x7f, 0x01, 0xbf, 0x01, 0xff, 0x02, 0x1f, 0x02, 0x5f, 0x02, 0x9f, 0x02, 0xdf, 0x02, 0xff, 0x03, 0x3f, 0x03, 0x7f, 0x03, 0xbf, 0x03, 0xdf, 0x04, 0x1f, 0x04, 0x3f, 0x0c, 0x3f, 0x2b, 0xbc, 0x0c, 0x3f, 0x04, 0x5f, 0x04, 0x3f, 0x01, 0x04, 0x1f, 0x02, 0x03, 0xff, 0x01, 0x03, 0xdf, 0x88, 0x03, 0xbf, 0x03, 0x9f, 0x03, 0x7f, 0x03, 0x9f, 0x03, 0xdf, 0x04, 0x3f, 0x04, 0xbf, 0x05, 0x3f, 0x53, 0x98, 0x02, 0xa1, 0x11, 0x84, 0x91, 0x11, 0x49, 0x31, 0x49, 0x10, 0x41, 0x10, 0x41, 0x0f, 0x01, 0x38, 0xee, 0x80, 0x30, 0xed, 0x01, 0x30, 0xcd, 0x02, 0x28, 0xcc, 0x80, 0x28, 0xcb, 0x1b, 0x20, 0xab,
+  0x7f, 0x20, 0xaa, 0x31, 0x20, 0xaa, 0x08, 0x20, 0xab, 0x80, 0x20, 0xcb, 0x01, 0x28, 0xcb, 0x8e, 0x28, 0xcc, 0x28, 0xcb, 0x61, 0x4e, 0xd1, 0xf3, 0xc9, 0xf3, 0xc9, 0xd3, 0xc9, 0xb2, 0xc9, 0xb3, 0xb1, 0x73, 0x60, 0xd9, 0x08, 0x1e, 0x00, 0x3d, 0x08, 0x3b, 0x18, 0x78, 0x18, 0x77, 0x01, 0x28, 0xd2, 0x81, 0x40, 0xee, 0x38, 0xee, 0x02, 0x39, 0x0f, 0x80, 0x41, 0x0e, 0x06, 0x41, 0x0f, 0x87, 0x41, 0x10, 0x41, 0x0f, 0x49, 0x10, 0x41, 0x30, 0x38, 0xf3, 0x28, 0xb6, 0x18, 0x9a, 0x00, 0x3e, 0x01, 0x00, 0x1f, 0x80, 0x00, 0x3f, 0x01, 0x00, 0x5f, 0x94, 0x00, 0x7f, 0x00, 0xbf, 0x00, 0xdf, 0x00, 0xff, 0x01, 0x3f, 0x01, 0x5f, 0x01, 0x9f, 0x01, 0xdf, 0x02, 0x1f, 0x02, 0x3f, 0x02, 0x7f, 0x02, 0x9f, 0x02, 0xff, 0x03, 0x3f, 0x03, 0x5f, 0x03, 0x9f, 0x03, 0xdf, 0x04, 0x1f, 0x04, 0x5f, 0x04, 0x7f, 0x04, 0xbf, 0x01, 0x04, 0xdf, 0x01, 0x04, 0xbf, 0x01, 0x04, 0x7f, 0x02, 0x04, 0x3f, 0x01, 0x04, 0x1f, 0x81, 0x03, 0xff, 0x03, 0xdf, 0x01, 0x03, 0xbf, 0x85, 0x03, 0xdf, 0x04, 0x3f, 0x04, 0x7f, 0x04, 0xdf, 0x05, 0x7f, 0x3c, 0x1a, 0x03, 0xa1, 0x11, 0x85, 0x59, 0x31, 0x49, 0x10, 0x41, 0x10, 0x41, 0x0f, 0x39, 0x0e, 0x38, 0xee, 0x01, 0x30, 0xed, 0x80, 0x30, 0xcc, 0x01, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x80, 0x20, 0xcb, 0x06, 0x20, 0xab, 0x13, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x35, 0x20, 0xaa, 0x04, 0x20, 0xab, 0x84, 0x20, 0xcb, 0x28, 0xcb, 0x20, 0xcb, 0x28, 0xab, 0x69, 0x2e, 0x02, 0xc9, 0xd3, 0x87, 0xc9, 0xb3, 0xb1, 0xb2, 0x58, 0xf3, 0x18, 0x95, 0x28, 0xb2, 0x30, 0xed, 0x38, 0xed, 0x30, 0xed, 0x02, 0x38, 0xed, 0x80, 0x38, 0xee, 0x01, 0x39, 0x0e, 0x01, 0x38, 0xee, 0x03, 0x39, 0x0e, 0x81, 0x41, 0x0f, 0x39, 0x0e, 0x05, 0x41, 0x0f, 0x9d, 0x41, 0x10, 0x41, 0x0f, 0x49, 0x2f, 0x49, 0x30, 0x49, 0x10, 0x38, 0xf3, 0x20, 0xb8, 0x08, 0x7d, 0x00, 0x7f, 0x00, 0x9f, 0x00, 0xdf, 0x00, 0xff, 0x01, 0x1f, 0x01, 0x5f, 0x01, 0x7f, 0x01, 0x9f, 0x01, 0xdf, 0x02, 0x1f, 0x02, 0x5f, 0x02, 0xbf, 0x02, 0xdf, 0x03, 0x1f, 0x03, 0x5f, 0x03, 0x9f, 0x03, 0xdf, 0x04, 0x1f, 0x04, 0x5f, 0x04, 0x9f, 0x04, 0xdf, 0x04, 0xff, 0x01, 0x05, 0x1f, 0x84, 0x05, 0x3f, 0x04, 0xff, 0x04, 0xdf, 0x04, 0xbf, 0x04, 0x9f, 0x01, 0x04, 0x7f, 0x01, 0x04, 0x5f, 0x8b, 0x04, 0x3f, 0x04, 0x1f, 0x03, 0xff, 0x03, 0xdf, 0x03, 0xff, 0x04, 0x3f, 0x04, 0x5f, 0x04, 0xbf, 0x05, 0x3f, 0x05, 0xbf, 0x2c, 0xdc, 0xa1, 0x12, 0x02, 0xa1, 0x11, 0x85, 0x71, 0x31, 0x49, 0x30, 0x41, 0x30, 0x41, 0x0f, 0x39, 0x0e, 0x38, 0xee, 0x01, 0x30, 0xed, 0x80, 0x30, 0xcc, 0x01, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x81, 0x28, 0xab, 0x20, 0xcb, 0x02, 0x20, 0xab, 0x16, 0x20, 0xaa,
+  0x7f, 0x20, 0xab, 0x2b, 0x20, 0xab, 0x02, 0x20, 0xaa, 0x0b, 0x20, 0xab, 0x80, 0x28, 0xab, 0x01, 0x28, 0xcb, 0x81, 0x61, 0x2e, 0xc9, 0xf3, 0x01, 0xc9, 0xd3, 0x84, 0xb9, 0x92, 0x69, 0x2e, 0x28, 0xcc, 0x28, 0xec, 0x30, 0xcd, 0x04, 0x30, 0xed, 0x81, 0x38, 0xed, 0x30, 0xed, 0x01, 0x38, 0xed, 0x80, 0x39, 0x0e, 0x02, 0x38, 0xee, 0x81, 0x39, 0x0f, 0x38, 0xee, 0x01, 0x40, 0xee, 0x83, 0x39, 0x0f, 0x39, 0x0e, 0x41, 0x0e, 0x40, 0xef, 0x06, 0x41, 0x0f, 0x80, 0x41, 0x2f, 0x01, 0x49, 0x10, 0x9a, 0x49, 0x30, 0x41, 0x13, 0x28, 0xf8, 0x08, 0xfe, 0x01, 0x3f, 0x01, 0x5f, 0x01, 0x9f, 0x01, 0xdf, 0x02, 0x1f, 0x02, 0x3f, 0x02, 0x9f, 0x02, 0xbf, 0x03, 0x1f, 0x03, 0x5f, 0x03, 0x9f, 0x03, 0xdf, 0x04, 0x1f, 0x04, 0x5f, 0x04, 0x9f, 0x04, 0xdf, 0x05, 0x1f, 0x05, 0x3f, 0x05, 0x7f, 0x05, 0x9f, 0x05, 0x7f, 0x05, 0x5f, 0x05, 0x3f, 0x01, 0x04, 0xff, 0x81, 0x04, 0xdf, 0x04, 0xbf, 0x01, 0x04, 0x9f, 0x82, 0x04, 0x7f, 0x04, 0x5f, 0x04, 0x3f, 0x01, 0x04, 0x1f, 0x86, 0x04, 0x3f, 0x04, 0x5f, 0x04, 0xbf, 0x04, 0xff, 0x05, 0x5f, 0x05, 0xdf, 0x0e, 0x1f, 0x02, 0xa1, 0x11, 0x86, 0xa1, 0x12, 0x89, 0x31, 0x49, 0x30, 0x41, 0x30, 0x41, 0x0f, 0x41, 0x0e, 0x38, 0xee, 0x01, 0x30, 0xed, 0x80, 0x30, 0xcc, 0x02, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x80, 0x20, 0xcb, 0x19, 0x20, 0xab,
+  0x7f, 0x20, 0xaa, 0x31, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x80, 0x20, 0xcb, 0x01, 0x20, 0xab, 0x87, 0x20, 0xcb, 0x28, 0xab, 0x20, 0xcb, 0x61, 0x2e, 0xd1, 0xf3, 0xc9, 0xf3, 0xc1, 0xb2, 0x61, 0x2e, 0x03, 0x28, 0xcc, 0x01, 0x30, 0xcc, 0x80, 0x30, 0xcd, 0x05, 0x30, 0xed, 0x80, 0x38, 0xed, 0x09, 0x38, 0xee, 0x81, 0x39, 0x0e, 0x38, 0xee, 0x02, 0x39, 0x0e, 0x05, 0x41, 0x0f, 0x80, 0x41, 0x30, 0x01, 0x49, 0x30, 0x92, 0x49, 0x31, 0x49, 0x30, 0x41, 0x33, 0x19, 0x7a, 0x01, 0xde, 0x02, 0x1f, 0x02, 0x7f, 0x02, 0xbf, 0x02, 0xff, 0x03, 0x3f, 0x03, 0x7f, 0x03, 0xbf, 0x03, 0xff, 0x04, 0x5f, 0x04, 0x9f, 0x04, 0xdf, 0x05, 0x1f, 0x05, 0x7f, 0x05, 0x9f, 0x02, 0x05, 0xdf, 0x81, 0x05, 0xbf, 0x05, 0x9f, 0x01, 0x05, 0x5f, 0x82, 0x05, 0x3f, 0x05, 0x1f, 0x04, 0xff, 0x01, 0x04, 0xdf, 0x82, 0x04, 0xbf, 0x04, 0x7f, 0x04, 0x5f, 0x01, 0x04, 0x3f, 0x87, 0x04, 0x7f, 0x04, 0xbf, 0x04, 0xff, 0x05, 0x3f, 0x05, 0xbf, 0x06, 0x1f, 0x06, 0x9f, 0x99, 0x72, 0x03, 0xa1, 0x11, 0x87, 0x51, 0x30, 0x49, 0x10, 0x41, 0x0f, 0x39, 0x0f, 0x39, 0x0e, 0x38, 0xed, 0x30, 0xed, 0x30, 0xcd, 0x02, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x80, 0x20, 0xcb, 0x03, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x31, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x87, 0x20, 0xcb, 0x28, 0xab, 0x51, 0x0d, 0xd1, 0xf3, 0xc9, 0xd2, 0x81, 0x6f, 0x30, 0xcc, 0x28, 0xac, 0x04, 0x28, 0xcc, 0x01, 0x30, 0xcc, 0x80, 0x30, 0xcd, 0x01, 0x30, 0xed, 0x80, 0x30, 0xcd, 0x04, 0x30, 0xed, 0x03, 0x38, 0xed, 0x05, 0x38, 0xee, 0x04, 0x39, 0x0e, 0x03, 0x41, 0x0f, 0x82, 0x41, 0x10, 0x41, 0x0f, 0x49, 0x10, 0x02, 0x49, 0x30, 0x8f, 0x49, 0x31, 0x49, 0x32, 0x31, 0xb6, 0x0a, 0x9d, 0x02, 0xff, 0x03, 0x5f, 0x03, 0x9f, 0x03, 0xff, 0x04, 0x3f, 0x04, 0x7f, 0x04, 0xbf, 0x05, 0x1f, 0x05, 0x5f, 0x05, 0xbf, 0x05, 0xdf, 0x06, 0x1f, 0x01, 0x06, 0x3f, 0x82, 0x05, 0xff, 0x05, 0xdf, 0x05, 0xbf, 0x01, 0x05, 0x9f, 0x86, 0x05, 0x7f, 0x05, 0x5f, 0x05, 0x3f, 0x05, 0x1f, 0x04, 0xff, 0x04, 0xdf, 0x04, 0xbf, 0x02, 0x04, 0x7f, 0x87, 0x04, 0x9f, 0x04, 0xdf, 0x05, 0x3f, 0x05, 0x7f, 0x05, 0xff, 0x06, 0x5f, 0x06, 0xdf, 0x7a, 0x95, 0x03, 0xa1, 0x11, 0x81, 0x69, 0x11, 0x49, 0x30, 0x01, 0x41, 0x0f, 0x83, 0x39, 0x0e, 0x38, 0xee, 0x30, 0xed, 0x30, 0xcd, 0x02, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x80, 0x20, 0xcb, 0x03, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x31, 0x20, 0xaa, 0x03, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x01, 0x20, 0xcb, 0x01, 0x20, 0xab, 0x84, 0x40, 0xec, 0xc1, 0xd2, 0xc1, 0xb3, 0x49, 0x0d, 0x28, 0xcb, 0x07, 0x28, 0xcc, 0x01, 0x30, 0xcc, 0x80, 0x30, 0xec, 0x01, 0x30, 0xcd, 0x0a, 0x30, 0xed, 0x03, 0x38, 0xed, 0x05, 0x38, 0xee, 0x01, 0x39, 0x0e, 0x80, 0x39, 0x0f, 0x03, 0x41, 0x0f, 0x01, 0x49, 0x10, 0x81, 0x49, 0x30, 0x49, 0x31, 0x01, 0x49, 0x51, 0x8a, 0x39, 0xd5, 0x13, 0x1c, 0x04, 0x1f, 0x04, 0x7f, 0x04, 0xbf, 0x05, 0x1f, 0x05, 0x5f, 0x05, 0x9f, 0x05, 0xdf, 0x06, 0x1f, 0x06, 0x7f, 0x01, 0x06, 0x9f, 0x82, 0x06, 0x7f, 0x06, 0x5f, 0x06, 0x1f, 0x01, 0x05, 0xff, 0x87, 0x05, 0xbf, 0x05, 0x9f, 0x05, 0x7f, 0x05, 0x5f, 0x05, 0x3f, 0x05, 0x1f, 0x04, 0xff, 0x04, 0xdf, 0x02, 0x04, 0xbf, 0x87, 0x04, 0xdf, 0x05, 0x1f, 0x05, 0x7f, 0x05, 0xbf, 0x06, 0x3f, 0x06, 0x9f, 0x07, 0x1f, 0x54, 0x38, 0x03, 0xa1, 0x11, 0x81, 0x81, 0x11, 0x49, 0x30, 0x01, 0x41, 0x0f, 0x81, 0x39, 0x0e, 0x38, 0xee, 0x01, 0x30, 0xed, 0x80, 0x30, 0xcc, 0x01, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x80, 0x20, 0xcb, 0x03, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x31, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x04, 0x20, 0xab, 0x83, 0x30, 0xcb, 0xa9, 0x92, 0xa9, 0xb1, 0x30, 0xcb, 0x03, 0x28, 0xcb, 0x06, 0x28, 0xcc, 0x03, 0x30, 0xcc, 0x01, 0x30, 0xec, 0x80, 0x30, 0xcd, 0x01, 0x30, 0xed, 0x80, 0x30, 0xcd, 0x08, 0x30, 0xed, 0x03, 0x38, 0xed, 0x02, 0x38, 0xee, 0x02, 0x39, 0x0e, 0x04, 0x41, 0x0f, 0x80, 0x41, 0x2f, 0x01, 0x49, 0x30, 0x8a, 0x51, 0x30, 0x49, 0x31, 0x51, 0x31, 0x3a, 0x15, 0x23, 0x7b, 0x05, 0x3f, 0x05, 0x9f, 0x53, 0x58, 0x34, 0x9b, 0x0e, 0x1f, 0x06, 0xbf, 0x01, 0x06, 0xff, 0x8d, 0x06, 0xdf, 0x06, 0xbf, 0x06, 0x9f, 0x06, 0x5f, 0x06, 0x3f, 0x06, 0x1f, 0x05, 0xff, 0x05, 0xdf, 0x05, 0xbf, 0x05, 0x9f, 0x05, 0x7f, 0x05, 0x5f, 0x05, 0x1f, 0x04, 0xff, 0x01, 0x04, 0xdf, 0x88, 0x04, 0xff, 0x05, 0x1f, 0x05, 0x5f, 0x05, 0x9f, 0x05, 0xff, 0x06, 0x5f, 0x06, 0xdf, 0x07, 0x3f, 0x35, 0x9b, 0x04, 0xa1, 0x11, 0x84, 0x49, 0x30, 0x49, 0x10, 0x41, 0x2f, 0x39, 0x0e, 0x38, 0xee, 0x01, 0x30, 0xed, 0x80, 0x30, 0xcc, 0x01, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x80, 0x20, 0xcb, 0x04, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x31, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x04, 0x20, 0xab, 0x84, 0x69, 0x2f, 0x81, 0x6f, 0x20, 0xab, 0x20, 0xcb, 0x20, 0xab, 0x02, 0x28, 0xcb, 0x81, 0x28, 0xab, 0x28, 0xcb, 0x09, 0x28, 0xcc, 0x02, 0x30, 0xcc, 0x07, 0x30, 0xcd, 0x07, 0x30, 0xed, 0x80, 0x38, 0xed, 0x03, 0x38, 0xee, 0x01, 0x39, 0x0e, 0x03, 0x41, 0x0f, 0x80, 0x41, 0x2f, 0x02, 0x49, 0x30, 0x01, 0x49, 0x31, 0x83, 0x51, 0x31, 0x49, 0xd4, 0x24, 0x3a, 0xa1, 0x32, 0x02, 0xa8, 0xf1, 0x01, 0x82, 0x95, 0x86, 0x54, 0x18, 0x35, 0x1b, 0x06, 0xdf, 0x06, 0x9f, 0x06, 0x7f, 0x06, 0x5f, 0x06, 0x3f, 0x01, 0x05, 0xff, 0x84, 0x05, 0xbf, 0x05, 0x9f, 0x05, 0x7f, 0x05, 0x5f, 0x05, 0x3f, 0x01, 0x05, 0x1f, 0x88, 0x05, 0x3f, 0x05, 0x7f, 0x05, 0x9f, 0x05, 0xdf, 0x06, 0x3f, 0x06, 0x9f, 0x06, 0xff, 0x07, 0x7f, 0x0f, 0x5f, 0x03, 0xa1, 0x11, 0x85, 0x99, 0x31, 0x69, 0x11, 0x49, 0x30, 0x41, 0x0f, 0x39, 0x0e, 0x38, 0xee, 0x01, 0x30, 0xed, 0x82, 0x30, 0xcd, 0x30, 0xcc, 0x28, 0xcc, 0x02, 0x28, 0xcb, 0x80, 0x20, 0xcb, 0x03, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x31, 0x20, 0xaa, 0x03, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x80, 0x20, 0xcb, 0x01, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x83, 0x20, 0xcb, 0x20, 0xab, 0x28, 0xcb, 0x28, 0xab, 0x03, 0x28, 0xcb, 0x0b, 0x28, 0xcc, 0x01, 0x30, 0xcc, 0x03, 0x28, 0xcc, 0x03, 0x30, 0xcc, 0x01, 0x30, 0xcd, 0x05, 0x30, 0xed, 0x80, 0x30, 0xee, 0x01, 0x38, 0xed, 0x02, 0x39, 0x0e, 0x80, 0x41, 0x0e, 0x03, 0x41, 0x0f, 0x80, 0x41, 0x30, 0x02, 0x49, 0x30, 0x01, 0x51, 0x31, 0x84, 0x69, 0x92, 0xa8, 0xf1, 0xa9, 0x11, 0xa8, 0xf1, 0xa9, 0x11, 0x02, 0xa8, 0xf1, 0x8a, 0xa1, 0x72, 0x4c, 0x39, 0x2d, 0x5c, 0x06, 0x9f, 0x06, 0x5f, 0x06, 0x3f, 0x06, 0x1f, 0x05, 0xff, 0x05, 0xdf, 0x05, 0x9f, 0x05, 0x7f, 0x02, 0x05, 0x5f, 0x97, 0x05, 0x7f, 0x05, 0x9f, 0x05, 0xdf, 0x06, 0x1f, 0x06, 0x7f, 0x06, 0xdf, 0x07, 0x3f, 0x07, 0x9f, 0x07, 0xdf, 0x82, 0x54, 0xa1, 0x11, 0xa1, 0x31, 0xa1, 0x11, 0x99, 0x11, 0x81, 0x31, 0x49, 0x10, 0x41, 0x0f, 0x41, 0x0e, 0x38, 0xee, 0x38, 0xed, 0x30, 0xed, 0x30, 0xcd, 0x30, 0xcc, 0x28, 0xcc, 0x02, 0x28, 0xcb, 0x80, 0x20, 0xcb, 0x06, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x31, 0x20, 0xaa, 0x03, 0x20, 0xab, 0x82, 0x20, 0xaa, 0x20, 0xab, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x80, 0x20, 0xcb, 0x02, 0x20, 0xab, 0x01, 0x28, 0xab, 0x01, 0x20, 0xcb, 0x06, 0x28, 0xcb, 0x13, 0x28, 0xcc, 0x80, 0x30, 0xcc, 0x01, 0x30, 0xec, 0x04, 0x30, 0xed, 0x04, 0x38, 0xee, 0x81, 0x39, 0x0e, 0x39, 0x0f, 0x02, 0x41, 0x0f, 0x83, 0x41, 0x2f, 0x49, 0x30, 0x49, 0x10, 0x49, 0x30, 0x01, 0x51, 0x31, 0x81, 0x69, 0x31, 0xa1, 0x11, 0x03, 0xa8, 0xf1, 0x8b, 0xa9, 0x11, 0xa1, 0x11, 0xa9, 0x11, 0xa0, 0xf1, 0x99, 0x72, 0x44, 0x19, 0x06, 0x7f, 0x06, 0x5f, 0x06, 0x1f, 0x05, 0xff, 0x05, 0xdf, 0x05, 0xbf, 0x01, 0x05, 0x9f, 0x01, 0x05, 0xbf, 0x89, 0x05, 0xdf, 0x06, 0x1f, 0x06, 0x5f, 0x06, 0xbf, 0x06, 0xff, 0x07, 0x5f, 0x07, 0xbf, 0x07, 0xff, 0x54, 0x98, 0xa1, 0x31, 0x02, 0xa1, 0x11, 0x81, 0x99, 0x11, 0x49, 0x30, 0x01, 0x41, 0x0f, 0x01, 0x38, 0xee, 0x82, 0x30, 0xed, 0x30, 0xcd, 0x30, 0xcc, 0x01, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x80, 0x20, 0xcb, 0x06, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x31, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x02, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x81, 0x20, 0xca, 0x20, 0xaa, 0x02, 0x20, 0xab, 0x80, 0x20, 0xcb, 0x01, 0x20, 0xab, 0x81, 0x28, 0xcb, 0x20, 0xcb, 0x08, 0x28, 0xcb, 0x12, 0x28, 0xcc, 0x02, 0x30, 0xcc, 0x01, 0x30, 0xec, 0x80, 0x30, 0xcd, 0x02, 0x30, 0xed, 0x81, 0x38, 0xed, 0x38, 0xee, 0x02, 0x39, 0x0e, 0x80, 0x39, 0x0f, 0x01, 0x41, 0x0f, 0x83, 0x49, 0x0f, 0x41, 0x2f, 0x49, 0x10, 0x49, 0x30, 0x01, 0x49, 0x31, 0x81, 0x59, 0x31, 0x91, 0x11, 0x01, 0xa8, 0xf1, 0x80, 0xa9, 0x11, 0x01, 0xa8, 0xf1, 0x02, 0xa9, 0x11, 0x85, 0xa1, 0x11, 0x7a, 0x55, 0x34, 0xbb, 0x06, 0x5f, 0x06, 0x1f, 0x05, 0xff, 0x03, 0x05, 0xdf, 0x8a, 0x05, 0xff, 0x06, 0x3f, 0x06, 0x5f, 0x06, 0x9f, 0x06, 0xdf, 0x07, 0x1f, 0x07, 0x7f, 0x07, 0xbf, 0x07, 0xff, 0x2e, 0x3c, 0x99, 0x11, 0x01, 0xa1, 0x11, 0x01, 0x99, 0x31, 0x80, 0x69, 0x10, 0x01, 0x41, 0x0f, 0x01, 0x38, 0xee, 0x01, 0x30, 0xed, 0x80, 0x30, 0xcc, 0x01, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x01, 0x20, 0xcb, 0x05, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x33, 0x20, 0xaa, 0x02, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x08, 0x20, 0xab, 0x03, 0x20, 0xcb, 0x16, 0x28, 0xcb, 0x07, 0x28, 0xcc, 0x01, 0x30, 0xcc, 0x81, 0x30, 0xec, 0x30, 0xcd, 0x03, 0x30, 0xed, 0x03, 0x38, 0xee, 0x80, 0x39, 0x0e, 0x03, 0x41, 0x0f, 0x86, 0x49, 0x10, 0x49, 0x30, 0x49, 0x31, 0x51, 0x31, 0x79, 0x31, 0xa9, 0x11, 0xa8, 0xf1, 0x03, 0xa9, 0x11, 0x80, 0xa8, 0xf1, 0x03, 0xa1, 0x11, 0x82, 0x91, 0xb3, 0x62, 0xf6, 0x34, 0x7b, 0x01, 0x06, 0x1f, 0x01, 0x06, 0x3f, 0x86, 0x06, 0x5f, 0x06, 0x7f, 0x06, 0xbf, 0x07, 0x1f, 0x07, 0x3f, 0x07, 0x9f, 0x07, 0xdf, 0x01, 0x07, 0xff, 0x8c, 0xa1, 0x11, 0x99, 0x12, 0x99, 0x11, 0x99, 0x31, 0x99, 0x32, 0x81, 0x31, 0x41, 0x30, 0x41, 0x0f, 0x41, 0x0e, 0x38, 0xee, 0x30, 0xee, 0x30, 0xed, 0x30, 0xcd, 0x01, 0x28, 0xcc, 0x02, 0x28, 0xcb, 0x03, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x33, 0x20, 0xaa, 0x07, 0x20, 0xab, 0x01, 0x20, 0xcb, 0x04, 0x20, 0xab, 0x81, 0x20, 0xcb, 0x20, 0xab, 0x05, 0x28, 0xab, 0x14, 0x28, 0xcb, 0x06, 0x28, 0xcc, 0x01, 0x30, 0xcc, 0x80, 0x30, 0xcd, 0x03, 0x30, 0xed, 0x03, 0x38, 0xee, 0x80, 0x39, 0x0f, 0x02, 0x41, 0x0f, 0x80, 0x49, 0x10, 0x02, 0x49, 0x30, 0x80, 0x71, 0x11, 0x03, 0xa9, 0x11, 0x80, 0xa1, 0x11, 0x01, 0xa9, 0x11, 0x05, 0xa1, 0x11, 0x89, 0x91, 0xb3, 0x34, 0x9b, 0x06, 0x5f, 0x06, 0x7f, 0x06, 0x9f, 0x06, 0xbf, 0x06, 0xff, 0x07, 0x3f, 0x07, 0x7f, 0x07, 0xbf, 0x02, 0x07, 0xff, 0x83, 0x7a, 0xd4, 0xa1, 0x11, 0x99, 0x11, 0xa1, 0x11, 0x01, 0x99, 0x31, 0x84, 0x49, 0x30, 0x41, 0x0f, 0x39, 0x0e, 0x38, 0xee, 0x30, 0xee, 0x01, 0x30, 0xed, 0x01, 0x28, 0xcc, 0x02, 0x28, 0xcb, 0x03, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x35, 0x20, 0xaa, 0x07, 0x20, 0xab, 0x80, 0x20, 0xcb, 0x08, 0x20, 0xab, 0x03, 0x28, 0xab, 0x0b, 0x20, 0xcb, 0x01, 0x28, 0xcb, 0x01, 0x20, 0xcb, 0x07, 0x28, 0xcb, 0x04, 0x28, 0xcc, 0x01, 0x30, 0xcc, 0x81, 0x30, 0xec, 0x30, 0xcd, 0x02, 0x30, 0xed, 0x80, 0x38, 0xed, 0x01, 0x38, 0xee, 0x01, 0x39, 0x0e, 0x01, 0x41, 0x0f, 0x80, 0x41, 0x10, 0x01, 0x49, 0x30, 0x83, 0x51, 0x30, 0x81, 0x11, 0xa1, 0x11, 0xa9, 0x11, 0x01, 0xa1, 0x11, 0x86, 0xa9, 0x11, 0xa1, 0x12, 0xa1, 0x11, 0xa9, 0x11, 0xa1, 0x11, 0xa1, 0x12, 0xa0, 0xf1, 0x02, 0xa1, 0x11, 0x87, 0x7a, 0x75, 0x15, 0xfd, 0x06, 0xbf, 0x06, 0xff, 0x07, 0x1f, 0x07, 0x5f, 0x07, 0x9f, 0x07, 0xbf, 0x02, 0x07, 0xff, 0x82, 0x54, 0x99, 0x99, 0x31, 0x99, 0x11, 0x02, 0x99, 0x31, 0x81, 0x69, 0x30, 0x41, 0x0f, 0x01, 0x39, 0x0e, 0x83, 0x38, 0xee, 0x30, 0xed, 0x30, 0xcd, 0x30, 0xcc, 0x01, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x80, 0x20, 0xcb, 0x05, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x35, 0x20, 0xaa, 0x09, 0x20, 0xab, 0x01, 0x20, 0xcb, 0x11, 0x20, 0xab, 0x01, 0x20, 0xcb, 0x81, 0x28, 0xab, 0x20, 0xab, 0x01, 0x28, 0xab, 0x04, 0x20, 0xcb, 0x06, 0x28, 0xcb, 0x05, 0x28, 0xcc, 0x82, 0x30, 0xcc, 0x30, 0xec, 0x30, 0xcd, 0x02, 0x30, 0xed, 0x80, 0x38, 0xed, 0x01, 0x38, 0xee, 0x80, 0x40, 0xee, 0x02, 0x41, 0x0f, 0x80, 0x41, 0x30, 0x01, 0x49, 0x30, 0x83, 0x59, 0x31, 0x90, 0xf1, 0xa9, 0x11, 0xa9, 0x12, 0x02, 0xa1, 0x11, 0x01, 0xa9, 0x11, 0x81, 0xa1, 0x11, 0xa1, 0x12, 0x03, 0xa1, 0x11, 0x86, 0x99, 0x72, 0x35, 0x3b, 0x07, 0x1f, 0x07, 0x3f, 0x07, 0x7f, 0x07, 0xbf, 0x07, 0xdf, 0x02, 0x07, 0xff, 0x81, 0x2e, 0x3c, 0xa1, 0x11, 0x03, 0x99, 0x31, 0x80, 0x89, 0x31, 0x01, 0x41, 0x0f, 0x01, 0x38, 0xee, 0x01, 0x30, 0xed, 0x80, 0x30, 0xcc, 0x01, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x80, 0x20, 0xcb, 0x05, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x36, 0x20, 0xaa, 0x03, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x21, 0x20, 0xab, 0x01, 0x20, 0xcb, 0x80, 0x28, 0xab, 0x02, 0x20, 0xcb, 0x04, 0x28, 0xcb, 0x04, 0x28, 0xcc, 0x80, 0x30, 0xcc, 0x01, 0x30, 0xcd, 0x02, 0x30, 0xed, 0x80, 0x38, 0xee, 0x02, 0x39, 0x0e, 0x01, 0x41, 0x0f, 0x81, 0x41, 0x2f, 0x41, 0x30, 0x01, 0x49, 0x30, 0x81, 0x81, 0x11, 0xa9, 0x11, 0x08, 0xa1, 0x11, 0x01, 0xa1, 0x12, 0x01, 0xa1, 0x11, 0x84, 0x44, 0x99, 0x07, 0x7f, 0x07, 0x9f, 0x07, 0xbf, 0x07, 0xdf, 0x03, 0x07, 0xff, 0x81, 0x99, 0x31, 0xa1, 0x11, 0x03, 0x99, 0x31, 0x86, 0x49, 0x0f, 0x41, 0x0f, 0x38, 0xee, 0x30, 0xee, 0x38, 0xed, 0x30, 0xed, 0x30, 0xcc, 0x01, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x80, 0x20, 0xcb, 0x05, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x37, 0x20, 0xaa, 0x02, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x0d, 0x20, 0xab, 0x01, 0x20, 0xcb, 0x07, 0x20, 0xab, 0x01, 0x20, 0xcb, 0x0b, 0x20, 0xab, 0x01, 0x20, 0xcb, 0x01, 0x28, 0xab, 0x80, 0x20, 0xcb, 0x03, 0x28, 0xcb, 0x03, 0x28, 0xcc, 0x01, 0x30, 0xcc, 0x01, 0x30, 0xcd, 0x01, 0x30, 0xed, 0x82, 0x38, 0xed, 0x31, 0x0e, 0x38, 0xee, 0x01, 0x39, 0x0e, 0x01, 0x41, 0x0f, 0x80, 0x41, 0x2f, 0x01, 0x49, 0x30, 0x80, 0x71, 0x31, 0x01, 0xa1, 0x11, 0x82, 0xa1, 0x12, 0xa1, 0x11, 0xa0, 0xf1, 0x01, 0xa1, 0x11, 0x80, 0xa1, 0x12, 0x04, 0xa1, 0x11, 0x83, 0xa1, 0x31, 0x63, 0x97, 0x07, 0xbf, 0x07, 0xdf, 0x04, 0x07, 0xff, 0x80, 0x7a, 0xd4, 0x03, 0x99, 0x31, 0x82, 0x99, 0x12, 0x71, 0x30, 0x39, 0x0f, 0x01, 0x38, 0xee, 0x82, 0x38, 0xed, 0x30, 0xed, 0x30, 0xcc, 0x01, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x80, 0x28, 0xab, 0x05, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x39, 0x20, 0xaa, 0x1f, 0x20, 0xab, 0x01, 0x20, 0xcb, 0x08, 0x20, 0xab, 0x03, 0x20, 0xcb, 0x03, 0x28, 0xcb, 0x04, 0x28, 0xcc, 0x80, 0x30, 0xcc, 0x01, 0x30, 0xec, 0x86, 0x30, 0xed, 0x38, 0xee, 0x30, 0xed, 0x38, 0xed, 0x39, 0x0e, 0x38, 0xee, 0x41, 0x0e, 0x01, 0x41, 0x0f, 0x01, 0x49, 0x30, 0x80, 0x69, 0x31, 0x01, 0xa1, 0x11, 0x80, 0xa1, 0x12, 0x07, 0xa1, 0x11, 0x83, 0xa1, 0x12, 0x99, 0x31, 0x99, 0x11, 0x63, 0x97, 0x04, 0x07, 0xff, 0x83, 0x07, 0xfe, 0x5c, 0x14, 0x99, 0x31, 0x99, 0x11, 0x02, 0x99, 0x31, 0x81, 0x91, 0x31, 0x41, 0x0f, 0x01, 0x39, 0x0e, 0x01, 0x30, 0xed, 0x80, 0x30, 0xcc, 0x01, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x81, 0x28, 0xab, 0x20, 0xcb, 0x04, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x7f, 0x20, 0xaa, 0x39, 0x20, 0xaa, 0x06, 0x20, 0xab, 0x05, 0x20, 0xaa, 0x1f, 0x20, 0xab, 0x02, 0x20, 0xcb, 0x05, 0x28, 0xcb, 0x03, 0x28, 0xcc, 0x81, 0x30, 0xcc, 0x30, 0xcd, 0x01, 0x30, 0xed, 0x82, 0x38, 0xed, 0x30, 0xee, 0x38, 0xee, 0x01, 0x39, 0x0e, 0x01, 0x41, 0x0f, 0x84, 0x41, 0x30, 0x49, 0x30, 0x59, 0x31, 0x79, 0x11, 0x91, 0x31, 0x08, 0xa1, 0x11, 0x83, 0x99, 0x31, 0xa1, 0x11, 0x99, 0x31, 0x54, 0x98, 0x03, 0x07, 0xff, 0x81, 0x07, 0xfe, 0x35, 0xf5, 0x05, 0x99, 0x31, 0x80, 0x51, 0x0f, 0x01, 0x39, 0x0e, 0x81, 0x38, 0xed, 0x30, 0xed, 0x01, 0x30, 0xcc, 0x80, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x81, 0x28, 0xab, 0x20, 0xcb, 0x04, 0x20, 0xab, 0x11, 0x20, 0xaa,
+  0x81, 0x20, 0xaa, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x03, 0x20, 0xab, 0x10, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x0c, 0x20, 0xaa, 0x04, 0x20, 0xab, 0x07, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x82, 0x20, 0xaa, 0x20, 0xab, 0x20, 0xaa, 0x10, 0x20, 0xab, 0x81, 0x20, 0xaa, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x02, 0x20, 0xaa, 0x04, 0x20, 0xab, 0x81, 0x20, 0xaa, 0x20, 0xab, 0x0f, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x02, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x04, 0x20, 0xaa, 0x02, 0x20, 0xab, 0x09, 0x20, 0xaa, 0x08, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x18, 0x20, 0xaa, 0x82, 0x20, 0xab, 0x20, 0xaa, 0x20, 0xab, 0x02, 0x20, 0xaa, 0x81, 0x20, 0xab, 0x20, 0xaa, 0x03, 0x20, 0xab, 0x03, 0x20, 0xaa, 0x07, 0x20, 0xab, 0x08, 0x20, 0xaa, 0x02, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x08, 0x20, 0xaa, 0x0d, 0x20, 0xab, 0x85, 0x20, 0xcb, 0x28, 0xab, 0x28, 0xcb, 0x20, 0xcb, 0x28, 0xab, 0x28, 0xcb, 0x05, 0x28, 0xcc, 0x81, 0x30, 0xcc, 0x30, 0xcd, 0x01, 0x30, 0xed, 0x80, 0x38, 0xed, 0x01, 0x38, 0xee, 0x80, 0x39, 0x0e, 0x01, 0x41, 0x0f, 0x81, 0x41, 0x2f, 0x41, 0x30, 0x01, 0x49, 0x30, 0x81, 0x61, 0x31, 0x89, 0x31, 0x02, 0xa1, 0x11, 0x80, 0xa1, 0x31, 0x01, 0xa1, 0x11, 0x80, 0x99, 0x31, 0x03, 0xa1, 0x11, 0x80, 0x3d, 0x7a, 0x02, 0x07, 0xff, 0x82, 0x07, 0xfe, 0x07, 0xf6, 0x99, 0x11, 0x04, 0x99, 0x31, 0x86, 0x79, 0x11, 0x39, 0x0e, 0x38, 0xee, 0x30, 0xee, 0x30, 0xed, 0x30, 0xcd, 0x30, 0xcc, 0x01, 0x28, 0xcc, 0x80, 0x28, 0xcb, 0x01, 0x28, 0xab, 0x01, 0x20, 0xab, 0x82, 0x20, 0xca, 0x20, 0xab, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x81, 0x20, 0xaa, 0x20, 0xab, 0x09, 0x20, 0xaa, 0x03, 0x20, 0xab,
+  0x13, 0x20, 0xaa, 0x02, 0x20, 0xab, 0x81, 0x20, 0xaa, 0x20, 0xcb, 0x01, 0x20, 0xaa, 0x08, 0x20, 0xab, 0x0e, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x04, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x12, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x82, 0x20, 0xab, 0x20, 0xaa, 0x20, 0xab, 0x05, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x13, 0x20, 0xaa, 0x82, 0x20, 0xab, 0x20, 0xaa, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x80, 0x20, 0xca, 0x02, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x0f, 0x20, 0xaa, 0x84, 0x20, 0xab, 0x20, 0xaa, 0x18, 0xaa, 0x20, 0xab, 0x20, 0xaa, 0x02, 0x20, 0xab, 0x0f, 0x20, 0xaa, 0x08, 0x20, 0xab, 0x02, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x11, 0x20, 0xaa, 0x08, 0x20, 0xab, 0x81, 0x20, 0xaa, 0x20, 0xca, 0x01, 0x20, 0xaa, 0x81, 0x20, 0xab, 0x20, 0xaa, 0x08, 0x20, 0xab, 0x09, 0x20, 0xaa, 0x05, 0x20, 0xab, 0x81, 0x28, 0xcb, 0x20, 0xab, 0x01, 0x20, 0xcb, 0x01, 0x28, 0xcb, 0x04, 0x28, 0xcc, 0x81, 0x30, 0xcc, 0x30, 0xec, 0x02, 0x30, 0xed, 0x01, 0x38, 0xee, 0x01, 0x39, 0x0e, 0x02, 0x41, 0x0f, 0x01, 0x49, 0x30, 0x82, 0x51, 0x31, 0x61, 0x31, 0x99, 0x11, 0x02, 0xa1, 0x11, 0x80, 0x99, 0x31, 0x01, 0xa1, 0x11, 0x84, 0xa1, 0x12, 0x99, 0x31, 0x99, 0x11, 0x91, 0x92, 0x1e, 0xbd, 0x01, 0x07, 0xff, 0x82, 0x07, 0xfe, 0x07, 0xf6, 0x7a, 0x71, 0x01, 0x99, 0x31, 0x80, 0x99, 0x32, 0x01, 0x99, 0x31, 0x82, 0x91, 0x11, 0x41, 0x0e, 0x38, 0xee, 0x02, 0x30, 0xed, 0x01, 0x28, 0xcc, 0x01, 0x28, 0xcb, 0x81, 0x20, 0xab, 0x28, 0xab, 0x02, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x82, 0x20, 0xab, 0x20, 0xaa, 0x20, 0xab, 0x0b, 0x20, 0xaa,
+  0x80, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x0b, 0x20, 0xaa, 0x04, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x02, 0x20, 0xab, 0x81, 0x20, 0xaa, 0x20, 0xab, 0x14, 0x20, 0xaa, 0x04, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x02, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x0f, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x05, 0x20, 0xaa, 0x82, 0x20, 0xca, 0x20, 0xaa, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x80, 0x20, 0xab, 0x04, 0x20, 0xaa, 0x04, 0x20, 0xab, 0x05, 0x20, 0xaa, 0x84, 0x20, 0xab, 0x20, 0xaa, 0x20, 0xab, 0x20, 0xaa, 0x20, 0xab, 0x01, 0x20, 0xaa, 0x04, 0x20, 0xab, 0x0b, 0x20, 0xaa, 0x07, 0x20, 0xab, 0x80, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x83, 0x20, 0xaa, 0x20, 0xca, 0x20, 0xaa, 0x20, 0xab, 0x18, 0x20, 0xaa, 0x81, 0x20, 0xab, 0x20, 0xaa, 0x01, 0x20, 0xab, 0x80, 0x20, 0xac, 0x1b, 0x20, 0xcd, 0x80, 0x20, 0xcc, 0x1f, 0x20, 0xcd, 0x03, 0x28, 0xcd, 0x80, 0x20, 0xcd, 0x02, 0x28, 0xce, 0x83, 0x28, 0xee, 0x28, 0xce, 0x28, 0xee, 0x30, 0xee, 0x02, 0x30, 0xef, 0x01, 0x39, 0x0f, 0x01, 0x39, 0x10, 0x81, 0x41, 0x10, 0x41, 0x31, 0x01, 0x49, 0x31, 0x83, 0x49, 0x32, 0x49, 0x52, 0x51, 0x52, 0x91, 0x32, 0x02, 0xa1, 0x11, 0x80, 0x99, 0x12, 0x01, 0x99, 0x31, 0x83, 0x99, 0x11, 0x99, 0x31, 0x99, 0x12, 0x82, 0x74, 0x01, 0x07, 0xff, 0x85, 0x07, 0xfd, 0x07, 0xf6, 0x5c, 0x32, 0x99, 0x11, 0x99, 0x31, 0x99, 0x32, 0x02, 0x99, 0x31, 0x81, 0x59, 0x10, 0x39, 0x0f, 0x01, 0x30, 0xef, 0x87, 0x30, 0xee, 0x30, 0xce, 0x28, 0xcd, 0x28, 0xee, 0x28, 0xed, 0x28, 0xcd, 0x20, 0xcd, 0x20, 0xac, 0x01, 0x20, 0xcd, 0x82, 0x20, 0xad, 0x20, 0xcd, 0x20, 0xad, 0x01, 0x20, 0xcc, 0x82, 0x20, 0xad, 0x20, 0xcc, 0x20, 0xac, 0x01, 0x20, 0xcc, 0x01, 0x20, 0xac, 0x07, 0x20, 0xcc,
+  0x82, 0x18, 0xd2, 0x10, 0xf2, 0x18, 0xd2, 0x08, 0x10, 0xf2, 0x01, 0x18, 0xd2, 0x0b, 0x18, 0xf2, 0x80, 0x18, 0xd2, 0x19, 0x18, 0xf2, 0x01, 0x18, 0xf3, 0x81, 0x18, 0xf2, 0x20, 0xf2, 0x01, 0x18, 0xf2, 0x80, 0x20, 0xf2, 0x01, 0x18, 0xf3, 0x0e, 0x20, 0xf3, 0x81, 0x20, 0xf2, 0x18, 0xf3, 0x05, 0x20, 0xf3, 0x80, 0x21, 0x13, 0x01, 0x20, 0xf3, 0x80, 0x21, 0x13, 0x01, 0x20, 0xf3, 0x80, 0x21, 0x13, 0x05, 0x20, 0xf3, 0x01, 0x21, 0x13, 0x08, 0x20, 0xf3, 0x81, 0x21, 0x13, 0x20, 0xf3, 0x02, 0x21, 0x13, 0x01, 0x28, 0xf3, 0x80, 0x21, 0x13, 0x01, 0x28, 0xf3, 0x80, 0x29, 0x13, 0x06, 0x21, 0x13, 0x0f, 0x29, 0x13, 0x83, 0x21, 0x13, 0x29, 0x13, 0x29, 0x14, 0x21, 0x13, 0x1f, 0x29, 0x13, 0x80, 0x29, 0x14, 0x27, 0x29, 0x13, 0x07, 0x21, 0x13, 0x01, 0x29, 0x13, 0x01, 0x28, 0xf3, 0x04, 0x29, 0x13, 0x84, 0x28, 0xf3, 0x29, 0x13, 0x21, 0x13, 0x29, 0x13, 0x29, 0x14, 0x01, 0x29, 0x13, 0x04, 0x29, 0x14, 0x04, 0x31, 0x34, 0x01, 0x39, 0x34, 0x81, 0x39, 0x35, 0x39, 0x55, 0x01, 0x41, 0x55, 0x01, 0x41, 0x76, 0x83, 0x49, 0x76, 0x49, 0x77, 0x51, 0x76, 0x91, 0x32, 0x01, 0xa1, 0x11, 0x82, 0x99, 0x31, 0x99, 0x11, 0xa1, 0x11, 0x01, 0x99, 0x31, 0x87, 0x99, 0x12, 0x99, 0x31, 0x5c, 0x38, 0x07, 0xff, 0x07, 0xfd, 0x07, 0xf6, 0x44, 0xf2, 0x99, 0x11, 0x04, 0x99, 0x31, 0x85, 0x79, 0x33, 0x39, 0x55, 0x31, 0x35, 0x31, 0x34, 0x31, 0x14, 0x21, 0x33, 0x01, 0x21, 0x13, 0x01, 0x20, 0xf3, 0x86, 0x21, 0x13, 0x19, 0x12, 0x18, 0xf2, 0x20, 0xf3, 0x18, 0xf2, 0x18, 0xf3, 0x18, 0xf2, 0x02, 0x18, 0xf3, 0x09, 0x18, 0xf2, 0x03, 0x18, 0xd2,
+  0x80, 0x10, 0xf2, 0x01, 0x18, 0xd2, 0x80, 0x10, 0xd2, 0x07, 0x18, 0xd2, 0x0b, 0x18, 0xf2, 0x80, 0x18, 0xd2, 0x01, 0x18, 0xf2, 0x01, 0x18, 0xd2, 0x13, 0x18, 0xf2, 0x04, 0x18, 0xf3, 0x80, 0x18, 0xf2, 0x01, 0x18, 0xf3, 0x80, 0x20, 0xf2, 0x05, 0x18, 0xf3, 0x12, 0x20, 0xf3, 0x80, 0x21, 0x12, 0x03, 0x20, 0xf3, 0x83, 0x21, 0x13, 0x20, 0xf2, 0x20, 0xf3, 0x20, 0xf2, 0x0f, 0x20, 0xf3, 0x86, 0x21, 0x13, 0x28, 0xf3, 0x21, 0x13, 0x20, 0xf3, 0x21, 0x13, 0x28, 0xf3, 0x20, 0xf3, 0x06, 0x21, 0x13, 0x01, 0x28, 0xf3, 0x02, 0x21, 0x13, 0x0c, 0x29, 0x13, 0x80, 0x21, 0x13, 0x02, 0x29, 0x13, 0x80, 0x29, 0x14, 0x01, 0x29, 0x13, 0x80, 0x28, 0xf3, 0x1c, 0x29, 0x13, 0x80, 0x28, 0xf3, 0x1c, 0x29, 0x13, 0x80, 0x21, 0x13, 0x01, 0x29, 0x13, 0x80, 0x29, 0x14, 0x08, 0x29, 0x13, 0x0b, 0x21, 0x13, 0x80, 0x29, 0x13, 0x01, 0x28, 0xf3, 0x81, 0x29, 0x13, 0x21, 0x13, 0x01, 0x29, 0x13, 0x01, 0x21, 0x13, 0x82, 0x28, 0xf3, 0x29, 0x13, 0x21, 0x13, 0x07, 0x29, 0x14, 0x02, 0x31, 0x34, 0x80, 0x31, 0x35, 0x01, 0x39, 0x35, 0x01, 0x39, 0x55, 0x89, 0x41, 0x55, 0x41, 0x56, 0x41, 0x76, 0x49, 0x76, 0x49, 0x56, 0x51, 0x76, 0x91, 0x32, 0xa1, 0x11, 0xa1, 0x12, 0xa1, 0x11, 0x01, 0x99, 0x31, 0x87, 0x99, 0x11, 0x99, 0x32, 0x99, 0x31, 0x99, 0x11, 0x2e, 0x5c, 0x07, 0xfc, 0x07, 0xf6, 0x2e, 0x53, 0x02, 0x99, 0x31, 0x01, 0x99, 0x11, 0x81, 0x99, 0x31, 0x91, 0x32, 0x02, 0x31, 0x34, 0x82, 0x29, 0x34, 0x29, 0x14, 0x29, 0x13, 0x01, 0x21, 0x13, 0x86, 0x20, 0xf3, 0x21, 0x12, 0x20, 0xf3, 0x20, 0xd3, 0x19, 0x12, 0x18, 0xf2, 0x18, 0xf3, 0x02, 0x18, 0xf2, 0x82, 0x18, 0xd2, 0x18, 0xf2, 0x20, 0xf2, 0x07, 0x18, 0xf2, 0x03, 0x18, 0xd2,
+  0x0b, 0x1d, 0x7c, 0x07, 0x1d, 0x9c, 0x03, 0x1d, 0x9d, 0x84, 0x25, 0x9c, 0x1d, 0xbc, 0x1d, 0x9d, 0x25, 0x9d, 0x1d, 0x9c, 0x04, 0x25, 0x9c, 0x0d, 0x25, 0xbd, 0x01, 0x25, 0xdd, 0x01, 0x25, 0xbd, 0x80, 0x1d, 0xdd, 0x02, 0x25, 0xdd, 0x80, 0x25, 0xbd, 0x08, 0x25, 0xdd, 0x0b, 0x25, 0xfd, 0x80, 0x2d, 0xfd, 0x03, 0x25, 0xfd, 0x04, 0x2d, 0xfd, 0x81, 0x25, 0xfd, 0x2d, 0xfe, 0x01, 0x2d, 0xfd, 0x11, 0x2e, 0x1d, 0x80, 0x2e, 0x3e, 0x03, 0x2e, 0x1d, 0x01, 0x2e, 0x3d, 0x02, 0x2e, 0x3e, 0x13, 0x2e, 0x3d, 0x02, 0x2e, 0x3e, 0x80, 0x2e, 0x3d, 0x0b, 0x2e, 0x3e, 0x0f, 0x2e, 0x5e, 0x80, 0x36, 0x5e, 0x02, 0x2e, 0x5e, 0x80, 0x2e, 0x3e, 0x01, 0x36, 0x5e, 0x80, 0x2e, 0x5d, 0x09, 0x2e, 0x5e, 0x0d, 0x2e, 0x3e, 0x02, 0x2e, 0x3d, 0x84, 0x2e, 0x3e, 0x2e, 0x3d, 0x2e, 0x3e, 0x2e, 0x3d, 0x36, 0x3d, 0x13, 0x2e, 0x3d, 0x10, 0x2e, 0x1d, 0x04, 0x36, 0x1d, 0x04, 0x3e, 0x1d, 0x88, 0x3e, 0x1e, 0x46, 0x1e, 0x46, 0x1d, 0x4d, 0xfe, 0x4d, 0xfd, 0x4e, 0x3e, 0x4d, 0xfe, 0x55, 0xdd, 0x92, 0x14, 0x02, 0x99, 0x31, 0x81, 0x99, 0x32, 0x99, 0x31, 0x01, 0x99, 0x11, 0x82, 0x99, 0x31, 0x7a, 0x74, 0x07, 0xfb, 0x01, 0x07, 0xf6, 0x01, 0x99, 0x31, 0x81, 0x99, 0x11, 0x99, 0x32, 0x02, 0x99, 0x31, 0x81, 0x4c, 0xfb, 0x3d, 0xfe, 0x01, 0x35, 0xdd, 0x03, 0x2d, 0xdd, 0x01, 0x25, 0xdd, 0x01, 0x25, 0xbd, 0x01, 0x25, 0xdd, 0x81, 0x25, 0xbd, 0x25, 0xdc, 0x02, 0x25, 0xbd, 0x81, 0x1d, 0xbd, 0x25, 0xbc, 0x01, 0x1d, 0xbd, 0x05, 0x1d, 0xbc, 0x03, 0x1d, 0x9d,
+  0x02, 0x1c, 0x7c, 0x80, 0x1c, 0x7b, 0x05, 0x1c, 0x7c, 0x0b, 0x1c, 0x9c, 0x85, 0x24, 0x9c, 0x1c, 0x9c, 0x1d, 0x9d, 0x1d, 0x7c, 0x1c, 0xfc, 0x1c, 0x9c, 0x0f, 0x1c, 0xbc, 0x80, 0x24, 0xbc, 0x01, 0x1c, 0xbc, 0x02, 0x24, 0xbc, 0x80, 0x1c, 0xbc, 0x02, 0x24, 0xdc, 0x83, 0x25, 0x3d, 0x25, 0xbd, 0x25, 0x3d, 0x24, 0xdd, 0x01, 0x24, 0xbc, 0x0f, 0x24, 0xdd, 0x80, 0x24, 0xfd, 0x01, 0x24, 0xdc, 0x01, 0x24, 0xfd, 0x85, 0x24, 0xfc, 0x24, 0xdd, 0x24, 0xfd, 0x25, 0x1c, 0x25, 0xfd, 0x25, 0x5d, 0x03, 0x24, 0xfd, 0x80, 0x24, 0xfc, 0x07, 0x24, 0xfd, 0x07, 0x2c, 0xfd, 0x80, 0x25, 0x1d, 0x01, 0x24, 0xfd, 0x83, 0x25, 0x1d, 0x2d, 0x1d, 0x24, 0xfd, 0x2c, 0xfd, 0x01, 0x25, 0xbd, 0x83, 0x25, 0x3c, 0x2c, 0xfc, 0x2d, 0x1d, 0x25, 0x1d, 0x01, 0x2c, 0xfd, 0x14, 0x2d, 0x1d, 0x82, 0x2d, 0x1c, 0x2d, 0x5d, 0x2d, 0xde, 0x08, 0x2d, 0x1d, 0x0f, 0x2d, 0x3d, 0x81, 0x2d, 0x1d, 0x2d, 0x3d, 0x01, 0x2d, 0x1d, 0x80, 0x2e, 0x1d, 0x02, 0x2d, 0x1d, 0x0f, 0x2d, 0x3d, 0x0a, 0x2d, 0x1d, 0x81, 0x2d, 0xdd, 0x2d, 0x5d, 0x12, 0x2d, 0x1d, 0x03, 0x2c, 0xfd, 0x01, 0x2d, 0x1d, 0x02, 0x2c, 0xfd, 0x01, 0x2d, 0xbd, 0x81, 0x2c, 0xfd, 0x2d, 0x1d, 0x01, 0x25, 0x1c, 0x08, 0x2c, 0xfd, 0x04, 0x34, 0xfd, 0x03, 0x3c, 0xfd, 0x80, 0x3d, 0x1d, 0x02, 0x45, 0x1d, 0x01, 0x4d, 0x1d, 0x83, 0x55, 0x3d, 0x91, 0xb3, 0x99, 0x31, 0x99, 0x11, 0x02, 0x99, 0x31, 0x80, 0xa1, 0x12, 0x01, 0x99, 0x31, 0x80, 0x54, 0x96, 0x01, 0x07, 0xf7, 0x81, 0x8a, 0x13, 0xa1, 0x11, 0x01, 0x99, 0x31, 0x83, 0x99, 0x12, 0x99, 0x32, 0x99, 0x11, 0x63, 0x18, 0x01, 0x34, 0xdd, 0x84, 0x2c, 0xdd, 0x2c, 0xdc, 0x2c, 0xdd, 0x2c, 0xbc, 0x24, 0xdc, 0x01, 0x24, 0xbc, 0x82, 0x25, 0x3c, 0x25, 0xbd, 0x25, 0x3c, 0x02, 0x24, 0xbc, 0x81, 0x1c, 0xbc, 0x24, 0xbc, 0x01, 0x1c, 0xbc, 0x80, 0x24, 0xbc, 0x05, 0x1c, 0xbc, 0x05, 0x1c, 0x9c,
+  0x0f, 0x1a, 0xbb, 0x03, 0x1a, 0xdb, 0x83, 0x1b, 0x3b, 0x1c, 0xfc, 0x15, 0x7c, 0x1c, 0x1c, 0x11, 0x1a, 0xdb, 0x01, 0x22, 0xdb, 0x03, 0x1a, 0xdb, 0x01, 0x22, 0xdb, 0x89, 0x22, 0xfb, 0x23, 0x1c, 0x1d, 0x1c, 0x1d, 0x5c, 0x23, 0x5b, 0x22, 0xdc, 0x22, 0xdb, 0x22, 0xdc, 0x22, 0xfb, 0x22, 0xfc, 0x01, 0x22, 0xdc, 0x05, 0x22, 0xfc, 0x03, 0x22, 0xfb, 0x07, 0x22, 0xfc, 0x84, 0x23, 0x1b, 0x22, 0xfc, 0x23, 0x3c, 0x25, 0x3c, 0x1c, 0xfd, 0x01, 0x22, 0xfc, 0x80, 0x22, 0xfb, 0x0f, 0x22, 0xfc, 0x04, 0x23, 0x1c, 0x01, 0x2a, 0xfc, 0x80, 0x23, 0x1c, 0x01, 0x2b, 0x1c, 0x81, 0x25, 0x9c, 0x24, 0x7c, 0x01, 0x23, 0x1c, 0x80, 0x2b, 0x1c, 0x01, 0x23, 0x1c, 0x81, 0x2b, 0x1c, 0x23, 0x1c, 0x15, 0x2b, 0x1c, 0x81, 0x25, 0xbd, 0x2b, 0xbc, 0x19, 0x2b, 0x1c, 0x80, 0x23, 0x1c, 0x01, 0x2b, 0x1c, 0x80, 0x25, 0xdd, 0x1b, 0x2b, 0x1c, 0x83, 0x23, 0x1c, 0x2b, 0x1c, 0x2b, 0x7c, 0x25, 0x9d, 0x01, 0x2b, 0x1c, 0x80, 0x23, 0x1c, 0x07, 0x2b, 0x1c, 0x11, 0x23, 0x1c, 0x86, 0x24, 0x5d, 0x25, 0x9c, 0x22, 0xfc, 0x2a, 0xfc, 0x23, 0x1c, 0x2a, 0xfc, 0x22, 0xfc, 0x01, 0x23, 0x1c, 0x03, 0x2b, 0x1c, 0x80, 0x2a, 0xfc, 0x02, 0x2b, 0x1c, 0x04, 0x33, 0x1c, 0x80, 0x3b, 0x1c, 0x02, 0x3b, 0x3d, 0x87, 0x43, 0x3c, 0x43, 0x3d, 0x4b, 0x3d, 0x43, 0x5d, 0x5a, 0x9a, 0x99, 0x32, 0x99, 0x31, 0x99, 0x11, 0x05, 0x99, 0x31, 0x82, 0x17, 0x37, 0x07, 0xf9, 0x72, 0xd4, 0x05, 0x99, 0x31, 0x86, 0x81, 0x94, 0x33, 0x1c, 0x32, 0xfc, 0x2a, 0xfb, 0x2a, 0xfc, 0x2a, 0xfb, 0x22, 0xfb, 0x01, 0x22, 0xdc, 0x80, 0x22, 0xfb, 0x01, 0x22, 0xdb, 0x83, 0x23, 0x5c, 0x1d, 0x5c, 0x1d, 0x1d, 0x23, 0x1b, 0x02, 0x1a, 0xdb, 0x81, 0x22, 0xdb, 0x1a, 0xbb, 0x05, 0x1a, 0xdb, 0x01, 0x1a, 0xbb, 0x03, 0x1a, 0xdb,
+  0x0a, 0x13, 0x7b, 0x83, 0x1b, 0x7b, 0x13, 0x7b, 0x1b, 0x5b, 0x1b, 0x7b, 0x02, 0x13, 0x7b, 0x89, 0x13, 0x9b, 0x1b, 0xbb, 0x14, 0xfb, 0x15, 0x3c, 0x13, 0xfb, 0x1b, 0x7b, 0x13, 0x9b, 0x1b, 0x7b, 0x1b, 0x7c, 0x1b, 0x9b, 0x01, 0x1b, 0x7b, 0x06, 0x1b, 0x9b, 0x80, 0x1b, 0x9c, 0x02, 0x1b, 0x9b, 0x80, 0x13, 0x9c, 0x06, 0x1b, 0x9b, 0x88, 0x1b, 0x9c, 0x1b, 0x9b, 0x1d, 0x3c, 0x1d, 0x5c, 0x1b, 0xfb, 0x1b, 0x9c, 0x1b, 0xbb, 0x1b, 0x9b, 0x1b, 0xbc, 0x01, 0x1b, 0x9b, 0x07, 0x1b, 0xbb, 0x80, 0x1b, 0xbc, 0x01, 0x1b, 0xbb, 0x82, 0x1b, 0xbc, 0x1b, 0xbb, 0x1b, 0xbc, 0x01, 0x1b, 0xbb, 0x89, 0x1b, 0xbc, 0x1b, 0xbb, 0x1b, 0xbc, 0x1b, 0xbb, 0x1b, 0xbc, 0x1b, 0xbb, 0x1c, 0xdc, 0x1d, 0x7d, 0x23, 0xfc, 0x1b, 0xdc, 0x05, 0x1b, 0xbc, 0x07, 0x23, 0xbc, 0x01, 0x1b, 0xbc, 0x05, 0x23, 0xdc, 0x80, 0x23, 0xbc, 0x03, 0x23, 0xdc, 0x81, 0x24, 0x7c, 0x1d, 0x9c, 0x1c, 0x23, 0xdc, 0x81, 0x24, 0x1c, 0x25, 0x9d, 0x1d, 0x23, 0xdc, 0x80, 0x1d, 0xbd, 0x1e, 0x23, 0xdc, 0x81, 0x1d, 0xbd, 0x24, 0x3c, 0x19, 0x23, 0xdc, 0x80, 0x23, 0xbc, 0x01, 0x23, 0xdc, 0x81, 0x25, 0x9c, 0x24, 0x7c, 0x01, 0x23, 0xbc, 0x81, 0x23, 0xdc, 0x23, 0xbc, 0x01, 0x23, 0xdc, 0x02, 0x23, 0xbc, 0x03, 0x23, 0xdc, 0x04, 0x2b, 0xdc, 0x03, 0x33, 0xdc, 0x80, 0x3b, 0xdc, 0x01, 0x3b, 0xfc, 0x83, 0x3b, 0xdc, 0x43, 0xfc, 0x43, 0xfd, 0x6b, 0x18, 0x03, 0x99, 0x31, 0x86, 0x99, 0x11, 0x99, 0x31, 0x99, 0x32, 0x99, 0x31, 0x6b, 0x53, 0x07, 0xfa, 0x54, 0x37, 0x01, 0x99, 0x31, 0x80, 0x99, 0x11, 0x01, 0x99, 0x31, 0x81, 0x99, 0x12, 0x99, 0x31, 0x02, 0x2b, 0xbc, 0x80, 0x2b, 0xbb, 0x01, 0x23, 0xbb, 0x80, 0x23, 0x9b, 0x04, 0x1b, 0x9b, 0x82, 0x1b, 0xdb, 0x1d, 0x5c, 0x1d, 0x1c, 0x01, 0x1b, 0x9b, 0x82, 0x13, 0x9b, 0x13, 0x9c, 0x1b, 0x9b, 0x01, 0x1b, 0x7b, 0x80, 0x13, 0x9b, 0x01, 0x1b, 0x9b, 0x82, 0x1b, 0x7b, 0x1b, 0x9b, 0x13, 0x9b, 0x01, 0x1b, 0x7b, 0x01, 0x1b, 0x9b,
+  0x09, 0x13, 0x5b, 0x80, 0x13, 0x7b, 0x01, 0x13, 0x5a, 0x86, 0x13, 0x7b, 0x13, 0x5a, 0x13, 0x5b, 0x13, 0x9b, 0x14, 0xbb, 0x14, 0xfb, 0x13, 0xfb, 0x01, 0x13, 0x7b, 0x81, 0x13, 0x5b, 0x13, 0x7b, 0x01, 0x13, 0x7a, 0x0b, 0x13, 0x7b, 0x01, 0x1b, 0x7b, 0x07, 0x13, 0x7b, 0x85, 0x1b, 0xbb, 0x15, 0x3c, 0x15, 0x1c, 0x1b, 0x7b, 0x13, 0x9b, 0x13, 0x7b, 0x01, 0x13, 0x9b, 0x81, 0x1b, 0x9b, 0x13, 0x9b, 0x01, 0x1b, 0x9b, 0x07, 0x13, 0x9b, 0x04, 0x1b, 0x9b, 0x83, 0x13, 0xbb, 0x13, 0x9b, 0x1b, 0x9b, 0x13, 0x9b, 0x01, 0x1b, 0x9b, 0x85, 0x1b, 0x9c, 0x1c, 0x3b, 0x1d, 0x5c, 0x1c, 0x3c, 0x1b, 0x9b, 0x1b, 0xbb, 0x06, 0x1b, 0x9b, 0x07, 0x1b, 0xbb, 0x80, 0x1b, 0x9b, 0x07, 0x1b, 0xbb, 0x80, 0x1b, 0xbc, 0x01, 0x1b, 0xbb, 0x81, 0x1c, 0x9c, 0x1d, 0x1c, 0x19, 0x1b, 0xbb, 0x80, 0x1b, 0xdb, 0x02, 0x1b, 0xbb, 0x83, 0x1c, 0xfc, 0x1c, 0x7c, 0x1b, 0xbb, 0x1b, 0xdb, 0x17, 0x1b, 0xbc, 0x87, 0x1b, 0xbb, 0x1b, 0xdc, 0x23, 0xbc, 0x1b, 0xbb, 0x1d, 0x7c, 0x1b, 0xbb, 0x1b, 0xdc, 0x1b, 0xbb, 0x0f, 0x1b, 0xbc, 0x07, 0x1b, 0xbb, 0x85, 0x1b, 0xbc, 0x1b, 0x9c, 0x1b, 0xdc, 0x1b, 0xbb, 0x1c, 0x5b, 0x1c, 0xfb, 0x11, 0x1b, 0xbb, 0x07, 0x1b, 0xbc, 0x02, 0x1b, 0xbb, 0x82, 0x1b, 0x9b, 0x1d, 0x3c, 0x1c, 0xbc, 0x01, 0x1b, 0xbb, 0x80, 0x1b, 0x9b, 0x01, 0x1b, 0x9c, 0x01, 0x1b, 0x9b, 0x84, 0x1b, 0xbb, 0x1b, 0x9c, 0x1b, 0x9b, 0x1b, 0xbb, 0x23, 0x9b, 0x04, 0x23, 0xbc, 0x03, 0x2b, 0xbc, 0x01, 0x33, 0xbc, 0x80, 0x33, 0xdc, 0x03, 0x3b, 0xdc, 0x80, 0x81, 0x94, 0x02, 0x99, 0x31, 0x80, 0x99, 0x11, 0x01, 0x99, 0x31, 0x83, 0x99, 0x11, 0x99, 0x31, 0x26, 0x59, 0x4c, 0x98, 0x03, 0x99, 0x31, 0x80, 0x99, 0x11, 0x01, 0x99, 0x31, 0x81, 0x4b, 0x19, 0x23, 0xbc, 0x02, 0x23, 0x9b, 0x02, 0x1b, 0x9b, 0x03, 0x1b, 0x7b, 0x02, 0x13, 0x7b, 0x84, 0x14, 0xbb, 0x15, 0x1b, 0x13, 0xdb, 0x13, 0x7b, 0x13, 0x7a, 0x01, 0x13, 0x7b, 0x80, 0x13, 0x7a, 0x02, 0x13, 0x7b, 0x81, 0x13, 0x5b, 0x13, 0x7b, 0x02, 0x13, 0x5b, 0x80, 0x13, 0x7b,
+  0x03, 0x09, 0x99, 0x80, 0x11, 0x99, 0x01, 0x11, 0xba, 0x83, 0x11, 0xb9, 0x09, 0xb9, 0x11, 0xba, 0x11, 0x99, 0x01, 0x11, 0xba, 0x87, 0x11, 0x99, 0x11, 0xda, 0x0b, 0x3a, 0x0c, 0x9b, 0x0b, 0xfb, 0x12, 0x7a, 0x11, 0xba, 0x11, 0x9a, 0x05, 0x11, 0xba, 0x80, 0x11, 0x9a, 0x0c, 0x11, 0xba, 0x80, 0x11, 0x9a, 0x04, 0x11, 0xba, 0x83, 0x12, 0xba, 0x14, 0xbb, 0x13, 0xfb, 0x11, 0xdb, 0x06, 0x11, 0xba, 0x80, 0x11, 0xda, 0x0a, 0x11, 0xba, 0x84, 0x11, 0xbb, 0x11, 0xba, 0x11, 0xda, 0x11, 0xba, 0x11, 0xda, 0x01, 0x11, 0xba, 0x86, 0x11, 0xda, 0x11, 0xba, 0x12, 0x7a, 0x14, 0xdb, 0x13, 0x7b, 0x11, 0xda, 0x19, 0xba, 0x0c, 0x11, 0xda, 0x02, 0x19, 0xda, 0x80, 0x11, 0xda, 0x06, 0x11, 0xdb, 0x87, 0x19, 0xdb, 0x11, 0xda, 0x19, 0xda, 0x1a, 0x3b, 0x14, 0xfb, 0x1a, 0xfb, 0x19, 0xda, 0x11, 0xdb, 0x0f, 0x19, 0xda, 0x07, 0x19, 0xdb, 0x85, 0x19, 0xda, 0x19, 0xdb, 0x19, 0xda, 0x1a, 0x1b, 0x15, 0x3c, 0x1a, 0x3b, 0x01, 0x19, 0xda, 0x07, 0x19, 0xdb, 0x0f, 0x19, 0xda, 0x01, 0x19, 0xdb, 0x85, 0x19, 0xda, 0x19, 0xdb, 0x15, 0x3b, 0x19, 0xdb, 0x19, 0xda, 0x19, 0xdb, 0x17, 0x19, 0xda, 0x86, 0x11, 0xdb, 0x19, 0xdb, 0x19, 0xda, 0x19, 0xdb, 0x19, 0xfb, 0x15, 0x3c, 0x12, 0x3a, 0x01, 0x19, 0xda, 0x04, 0x11, 0xda, 0x81, 0x19, 0xda, 0x11, 0xdb, 0x09, 0x19, 0xdb, 0x05, 0x11, 0xba, 0x86, 0x19, 0xdb, 0x19, 0xba, 0x11, 0xda, 0x11, 0xba, 0x1a, 0xbb, 0x14, 0xfb, 0x1a, 0x5b, 0x01, 0x19, 0xba, 0x01, 0x11, 0xda, 0x01, 0x19, 0xdb, 0x82, 0x19, 0xda, 0x19, 0xdb, 0x19, 0xba, 0x01, 0x19, 0xda, 0x02, 0x19, 0xdb, 0x02, 0x21, 0xdb, 0x01, 0x21, 0xfb, 0x03, 0x29, 0xfb, 0x85, 0x31, 0xfb, 0x32, 0x1b, 0x31, 0xfb, 0x32, 0x1b, 0x41, 0xfa, 0x99, 0x12, 0x05, 0x99, 0x31, 0x84, 0x99, 0x12, 0x72, 0xd4, 0x4c, 0x98, 0x99, 0x31, 0x99, 0x11, 0x02, 0x99, 0x31, 0x84, 0x99, 0x11, 0x99, 0x31, 0x59, 0x96, 0x21, 0xdb, 0x21, 0xda, 0x02, 0x19, 0xda, 0x01, 0x11, 0xda, 0x06, 0x11, 0xba, 0x86, 0x11, 0xd9, 0x13, 0x7a, 0x14, 0x9b, 0x13, 0x1a, 0x11, 0xba, 0x11, 0x9a, 0x11, 0xb9, 0x01, 0x11, 0xba, 0x82, 0x11, 0x9a, 0x11, 0xba, 0x11, 0x9a, 0x04, 0x11, 0xba,
+  0x03, 0x0a, 0xfa, 0x01, 0x0b, 0x1a, 0x01, 0x0a, 0xfa, 0x83, 0x0b, 0x1a, 0x0a, 0xfa, 0x0b, 0x1a, 0x0a, 0xfa, 0x01, 0x0b, 0x1a, 0x83, 0x0c, 0x3a, 0x0c, 0x9a, 0x0b, 0xda, 0x0b, 0x1a, 0x01, 0x0a, 0xfa, 0x12, 0x0b, 0x1a, 0x80, 0x0b, 0x3a, 0x01, 0x0b, 0x1a, 0x80, 0x0b, 0x3a, 0x02, 0x0b, 0x1a, 0x82, 0x0b, 0xdb, 0x14, 0xbb, 0x0b, 0xfa, 0x01, 0x0b, 0x1a, 0x01, 0x0b, 0x3a, 0x01, 0x0b, 0x1a, 0x01, 0x0b, 0x3a, 0x82, 0x13, 0x1a, 0x0b, 0x3a, 0x0b, 0x1a, 0x07, 0x0b, 0x3a, 0x01, 0x13, 0x3b, 0x80, 0x13, 0x3a, 0x04, 0x0b, 0x3a, 0x84, 0x13, 0x3a, 0x0b, 0x3a, 0x13, 0x7a, 0x0c, 0xdb, 0x0c, 0x5b, 0x01, 0x13, 0x3b, 0x80, 0x0b, 0x3a, 0x06, 0x13, 0x3a, 0x0a, 0x13, 0x3b, 0x03, 0x13, 0x5b, 0x01, 0x13, 0x3b, 0x87, 0x13, 0x5a, 0x0b, 0x5b, 0x13, 0x3b, 0x14, 0x3a, 0x14, 0x7b, 0x13, 0x5b, 0x13, 0x5a, 0x13, 0x3b, 0x11, 0x13, 0x5a, 0x07, 0x13, 0x5b, 0x82, 0x13, 0x5a, 0x13, 0xbb, 0x14, 0xdb, 0x1b, 0x13, 0x5b, 0x86, 0x13, 0x5a, 0x13, 0x5b, 0x13, 0x3b, 0x14, 0xfb, 0x13, 0x5a, 0x13, 0x5b, 0x13, 0x5a, 0x0f, 0x13, 0x5b, 0x07, 0x13, 0x5a, 0x82, 0x13, 0x3a, 0x13, 0x5b, 0x13, 0x5a, 0x01, 0x13, 0x5b, 0x82, 0x14, 0x9b, 0x13, 0xfb, 0x13, 0x3a, 0x01, 0x13, 0x5b, 0x02, 0x13, 0x5a, 0x02, 0x13, 0x5b, 0x0f, 0x13, 0x3b, 0x86, 0x13, 0x3a, 0x13, 0x3b, 0x13, 0x3a, 0x13, 0x5a, 0x13, 0x3a, 0x14, 0x3b, 0x14, 0x7b, 0x03, 0x13, 0x3a, 0x80, 0x13, 0x3b, 0x01, 0x13, 0x3a, 0x80, 0x13, 0x3b, 0x02, 0x13, 0x3a, 0x80, 0x13, 0x5b, 0x01, 0x13, 0x3b, 0x80, 0x1b, 0x3b, 0x01, 0x1b, 0x5b, 0x81, 0x1b, 0x3b, 0x1b, 0x5b, 0x03, 0x23, 0x5b, 0x01, 0x2b, 0x5b, 0x01, 0x2b, 0x7b, 0x82, 0x33, 0x5b, 0x72, 0x35, 0x99, 0x11, 0x02, 0x99, 0x31, 0x80, 0x99, 0x11, 0x02, 0x99, 0x31, 0x80, 0x72, 0xd5, 0x01, 0x99, 0x32, 0x04, 0x99, 0x31, 0x80, 0x71, 0xb4, 0x01, 0x1b, 0x3b, 0x82, 0x13, 0x3a, 0x13, 0x3b, 0x13, 0x3a, 0x03, 0x13, 0x1a, 0x02, 0x0b, 0x1a, 0x86, 0x0b, 0x3a, 0x0a, 0xfa, 0x0b, 0x1a, 0x0a, 0xfa, 0x0b, 0xda, 0x0c, 0xbb, 0x0b, 0xda, 0x0b, 0x0b, 0x1a,
+  0x05, 0x02, 0xd9, 0x89, 0x02, 0xf9, 0x02, 0xd9, 0x02, 0xda, 0x0a, 0xda, 0x0a, 0xfa, 0x0b, 0xfa, 0x0c, 0x5b, 0x0b, 0xfa, 0x0a, 0xd9, 0x02, 0xfa, 0x01, 0x02, 0xf9, 0x85, 0x0a, 0xf9, 0x02, 0xf9, 0x0a, 0xf9, 0x02, 0xd9, 0x02, 0xf9, 0x0a, 0xf9, 0x0f, 0x0a, 0xfa, 0x80, 0x0a, 0xf9, 0x02, 0x0a, 0xfa, 0x85, 0x0c, 0x1a, 0x0c, 0x7b, 0x0b, 0x5a, 0x0a, 0xfa, 0x0a, 0xf9, 0x0b, 0x1a, 0x02, 0x0a, 0xfa, 0x80, 0x0b, 0x1a, 0x01, 0x0a, 0xfa, 0x80, 0x0b, 0x1a, 0x07, 0x0a, 0xfa, 0x02, 0x0b, 0x1a, 0x81, 0x03, 0x1a, 0x0a, 0xfa, 0x01, 0x0b, 0x1a, 0x80, 0x0a, 0xfa, 0x02, 0x0b, 0x1a, 0x84, 0x0a, 0xfa, 0x0c, 0x3a, 0x0c, 0x5a, 0x0b, 0x1a, 0x0a, 0xfa, 0x1c, 0x0b, 0x1a, 0x81, 0x0c, 0x5b, 0x0c, 0x1a, 0x1d, 0x0b, 0x1a, 0x83, 0x0b, 0x3a, 0x0c, 0x7b, 0x0b, 0x7a, 0x0b, 0x3a, 0x1d, 0x0b, 0x1a, 0x82, 0x0c, 0xbb, 0x0b, 0x1a, 0x0b, 0x3a, 0x1d, 0x0b, 0x1a, 0x81, 0x0b, 0x7a, 0x0c, 0xbb, 0x1e, 0x0b, 0x1a, 0x81, 0x0b, 0xda, 0x0c, 0x7b, 0x0b, 0x0b, 0x1a, 0x04, 0x13, 0x1a, 0x80, 0x1b, 0x1a, 0x03, 0x1b, 0x3a, 0x01, 0x23, 0x3a, 0x83, 0x23, 0x3b, 0x2b, 0x3b, 0x2b, 0x5b, 0x3a, 0xd9, 0x02, 0x99, 0x31, 0x80, 0x99, 0x12, 0x04, 0x99, 0x31, 0x80, 0x99, 0x11, 0x05, 0x99, 0x31, 0x81, 0x89, 0x93, 0x1b, 0x1a, 0x01, 0x13, 0x1a, 0x80, 0x12, 0xfa, 0x0b, 0x0a, 0xfa, 0x89, 0x02, 0xfa, 0x0a, 0xfa, 0x03, 0x5a, 0x04, 0x5a, 0x0c, 0x3a, 0x0a, 0xfa, 0x02, 0xda, 0x0a, 0xfa, 0x0a, 0xf9, 0x02, 0xf9, 0x02, 0x0a, 0xfa, 0x01, 0x02, 0xd9,
+  0x03, 0x01, 0x58, 0x80, 0x01, 0x38, 0x02, 0x01, 0x58, 0x84, 0x01, 0x38, 0x02, 0x38, 0x03, 0xb9, 0x03, 0xda, 0x02, 0x59, 0x17, 0x01, 0x58, 0x81, 0x01, 0x38, 0x01, 0x78, 0x01, 0x01, 0x58, 0x85, 0x01, 0x59, 0x01, 0xb9, 0x03, 0x7a, 0x0b, 0xda, 0x02, 0x18, 0x09, 0x58, 0x01, 0x01, 0x59, 0x80, 0x09, 0x58, 0x03, 0x01, 0x58, 0x85, 0x09, 0x58, 0x09, 0x59, 0x01, 0x58, 0x01, 0x59, 0x01, 0x79, 0x01, 0x58, 0x03, 0x01, 0x59, 0x03, 0x01, 0x58, 0x8f, 0x09, 0x79, 0x01, 0x79, 0x09, 0x58, 0x09, 0x79, 0x01, 0x59, 0x01, 0x78, 0x01, 0x59, 0x09, 0x58, 0x03, 0x3a, 0x04, 0x1a, 0x01, 0xf9, 0x09, 0x59, 0x01, 0x79, 0x09, 0x58, 0x09, 0x59, 0x01, 0x58, 0x03, 0x01, 0x59, 0x03, 0x09, 0x79, 0x07, 0x01, 0x79, 0x01, 0x09, 0x79, 0x01, 0x09, 0x59, 0x04, 0x09, 0x79, 0x83, 0x0a, 0x79, 0x04, 0x3a, 0x01, 0x99, 0x09, 0x59, 0x01, 0x01, 0x79, 0x10, 0x09, 0x79, 0x07, 0x01, 0x79, 0x85, 0x09, 0x79, 0x01, 0x79, 0x09, 0xb9, 0x0c, 0x3b, 0x01, 0x79, 0x09, 0x79, 0x01, 0x01, 0x79, 0x18, 0x09, 0x79, 0x84, 0x01, 0x79, 0x09, 0x79, 0x01, 0x79, 0x0c, 0x7a, 0x09, 0x79, 0x01, 0x01, 0x79, 0x0f, 0x09, 0x79, 0x09, 0x01, 0x79, 0x03, 0x09, 0x79, 0x81, 0x0b, 0xfa, 0x02, 0x59, 0x04, 0x09, 0x79, 0x80, 0x09, 0x59, 0x11, 0x09, 0x79, 0x8f, 0x01, 0x79, 0x09, 0x58, 0x09, 0x79, 0x01, 0x78, 0x09, 0x58, 0x01, 0x59, 0x09, 0x99, 0x0b, 0xda, 0x02, 0xd9, 0x01, 0x59, 0x09, 0x59, 0x01, 0x59, 0x09, 0x79, 0x09, 0x59, 0x09, 0x79, 0x09, 0x59, 0x07, 0x09, 0x79, 0x04, 0x11, 0x79, 0x01, 0x19, 0x99, 0x87, 0x19, 0x9a, 0x19, 0x99, 0x21, 0x99, 0x21, 0x9a, 0x21, 0xba, 0x71, 0x54, 0x99, 0x31, 0x99, 0x11, 0x02, 0x99, 0x31, 0x80, 0x99, 0x11, 0x03, 0x99, 0x31, 0x80, 0x99, 0x11, 0x04, 0x99, 0x31, 0x02, 0x11, 0x79, 0x01, 0x09, 0x79, 0x03, 0x09, 0x58, 0x02, 0x01, 0x58, 0x80, 0x09, 0x58, 0x03, 0x01, 0x58, 0x82, 0x01, 0x59, 0x01, 0x58, 0x01, 0xd8, 0x01, 0x03, 0x99, 0x80, 0x01, 0xd9, 0x01, 0x01, 0x58, 0x01, 0x01, 0x38, 0x03, 0x01, 0x58,
+  0x04, 0x01, 0x37, 0x85, 0x01, 0x38, 0x01, 0x37, 0x01, 0xd8, 0x03, 0x39, 0x03, 0x99, 0x02, 0x38, 0x01, 0x01, 0x37, 0x01, 0x01, 0x38, 0x01, 0x01, 0x37, 0x04, 0x01, 0x38, 0x01, 0x01, 0x37, 0x01, 0x01, 0x38, 0x80, 0x01, 0x37, 0x0b, 0x01, 0x38, 0x86, 0x01, 0x57, 0x01, 0x38, 0x02, 0x78, 0x03, 0xd9, 0x02, 0xb9, 0x01, 0x78, 0x01, 0x58, 0x01, 0x01, 0x38, 0x81, 0x01, 0x58, 0x01, 0x38, 0x01, 0x01, 0x37, 0x04, 0x01, 0x38, 0x81, 0x01, 0x37, 0x01, 0x58, 0x05, 0x01, 0x38, 0x02, 0x01, 0x58, 0x01, 0x01, 0x38, 0x80, 0x09, 0x38, 0x02, 0x01, 0x58, 0x83, 0x01, 0x78, 0x03, 0x39, 0x03, 0x99, 0x01, 0x78, 0x1d, 0x01, 0x58, 0x82, 0x01, 0xd9, 0x03, 0xf9, 0x01, 0xf9, 0x1e, 0x01, 0x58, 0x81, 0x02, 0xd9, 0x03, 0x19, 0x02, 0x01, 0x58, 0x80, 0x01, 0x59, 0x17, 0x01, 0x58, 0x80, 0x09, 0x59, 0x01, 0x01, 0x58, 0x82, 0x01, 0x59, 0x04, 0x1a, 0x09, 0x59, 0x1f, 0x01, 0x58, 0x81, 0x02, 0xb9, 0x03, 0x19, 0x01, 0x01, 0x58, 0x01, 0x01, 0x38, 0x18, 0x01, 0x58, 0x84, 0x01, 0x38, 0x01, 0x58, 0x01, 0xd8, 0x03, 0xf9, 0x01, 0xf8, 0x01, 0x01, 0x38, 0x07, 0x01, 0x58, 0x04, 0x09, 0x58, 0x02, 0x11, 0x58, 0x81, 0x11, 0x78, 0x11, 0x79, 0x03, 0x19, 0x79, 0x82, 0x19, 0x99, 0x21, 0x79, 0x31, 0x78, 0x04, 0x99, 0x31, 0x82, 0x99, 0x11, 0x99, 0x31, 0x99, 0x11, 0x07, 0x99, 0x31, 0x82, 0x31, 0x57, 0x09, 0x58, 0x11, 0x58, 0x01, 0x09, 0x58, 0x03, 0x09, 0x38, 0x04, 0x01, 0x38, 0x01, 0x01, 0x37, 0x04, 0x01, 0x38, 0x84, 0x02, 0x98, 0x03, 0xf9, 0x02, 0x98, 0x01, 0x37, 0x01, 0x38, 0x04, 0x01, 0x37,
+  0x04, 0x01, 0x17, 0x83, 0x01, 0xd7, 0x03, 0x18, 0x03, 0x79, 0x02, 0x38, 0x0a, 0x01, 0x17, 0x80, 0x01, 0x37, 0x05, 0x01, 0x17, 0x80, 0x01, 0x37, 0x07, 0x01, 0x17, 0x80, 0x01, 0x37, 0x01, 0x01, 0x17, 0x89, 0x01, 0x77, 0x03, 0x18, 0x03, 0x79, 0x01, 0xd7, 0x01, 0x37, 0x01, 0x17, 0x01, 0x37, 0x01, 0x17, 0x01, 0x37, 0x01, 0x36, 0x01, 0x01, 0x17, 0x01, 0x01, 0x37, 0x01, 0x01, 0x17, 0x02, 0x01, 0x37, 0x80, 0x01, 0x17, 0x02, 0x01, 0x37, 0x02, 0x01, 0x17, 0x04, 0x01, 0x37, 0x8b, 0x01, 0x38, 0x01, 0x37, 0x01, 0x17, 0x01, 0x57, 0x03, 0x59, 0x02, 0xf8, 0x01, 0x57, 0x01, 0x17, 0x01, 0x37, 0x01, 0x17, 0x01, 0x37, 0x01, 0x17, 0x02, 0x01, 0x37, 0x0e, 0x01, 0x38, 0x06, 0x01, 0x37, 0x85, 0x01, 0x58, 0x03, 0x59, 0x02, 0x78, 0x01, 0x37, 0x01, 0x38, 0x01, 0x37, 0x01, 0x01, 0x38, 0x80, 0x01, 0x37, 0x17, 0x01, 0x38, 0x84, 0x01, 0x37, 0x01, 0x38, 0x03, 0xb9, 0x01, 0xb8, 0x01, 0x37, 0x01, 0x01, 0x38, 0x80, 0x01, 0x37, 0x17, 0x01, 0x38, 0x02, 0x01, 0x37, 0x84, 0x01, 0x38, 0x03, 0xf9, 0x01, 0x37, 0x01, 0x38, 0x01, 0x37, 0x18, 0x01, 0x38, 0x82, 0x01, 0x37, 0x01, 0x38, 0x01, 0x18, 0x01, 0x01, 0x38, 0x82, 0x01, 0x78, 0x03, 0xf9, 0x01, 0x58, 0x01, 0x01, 0x37, 0x14, 0x01, 0x38, 0x02, 0x01, 0x37, 0x01, 0x01, 0x38, 0x01, 0x01, 0x37, 0x89, 0x01, 0x18, 0x02, 0x38, 0x03, 0xb9, 0x01, 0x77, 0x01, 0x37, 0x01, 0x38, 0x01, 0x37, 0x01, 0x17, 0x01, 0x37, 0x01, 0x38, 0x03, 0x01, 0x37, 0x80, 0x09, 0x37, 0x04, 0x09, 0x38, 0x80, 0x09, 0x58, 0x04, 0x11, 0x58, 0x01, 0x19, 0x58, 0x82, 0x19, 0x59, 0x19, 0x78, 0x69, 0x34, 0x01, 0x99, 0x31, 0x80, 0x99, 0x12, 0x04, 0x99, 0x31, 0x82, 0x99, 0x12, 0x99, 0x31, 0x99, 0x11, 0x02, 0x99, 0x31, 0x83, 0x99, 0x32, 0x41, 0x35, 0x09, 0x38, 0x09, 0x57, 0x03, 0x09, 0x37, 0x08, 0x01, 0x17, 0x01, 0x01, 0x37, 0x03, 0x01, 0x17, 0x83, 0x01, 0x97, 0x03, 0x18, 0x03, 0x38, 0x01, 0xb7, 0x04, 0x01, 0x17,
+  0x01, 0x02, 0xd8, 0x01, 0x02, 0xd7, 0x83, 0x02, 0xf7, 0x03, 0x58, 0x03, 0x78, 0x02, 0xf7, 0x02, 0x02, 0xd8, 0x05, 0x02, 0xd7, 0x0d, 0x02, 0xd8, 0x04, 0x02, 0xf8, 0x80, 0x02, 0xd7, 0x01, 0x02, 0xf8, 0x83, 0x03, 0x98, 0x03, 0x78, 0x02, 0xf8, 0x02, 0xd8, 0x1d, 0x02, 0xf8, 0x81, 0x03, 0x78, 0x03, 0x98, 0x18, 0x02, 0xf8, 0x83, 0x03, 0x18, 0x02, 0xf8, 0x03, 0x18, 0x02, 0xf7, 0x01, 0x02, 0xf8, 0x83, 0x03, 0x18, 0x03, 0x58, 0x03, 0x99, 0x03, 0x18, 0x01, 0x02, 0xf8, 0x01, 0x03, 0x18, 0x81, 0x02, 0xf8, 0x03, 0x18, 0x07, 0x02, 0xf8, 0x10, 0x03, 0x18, 0x81, 0x03, 0x38, 0x03, 0xb8, 0x01, 0x03, 0x18, 0x80, 0x02, 0xf8, 0x1d, 0x03, 0x18, 0x80, 0x03, 0xb8, 0x1c, 0x03, 0x18, 0x80, 0x02, 0xf8, 0x01, 0x03, 0x18, 0x83, 0x02, 0xf8, 0x03, 0x18, 0x03, 0x78, 0x03, 0x38, 0x01, 0x02, 0xf8, 0x82, 0x03, 0x18, 0x02, 0xf8, 0x03, 0x18, 0x11, 0x02, 0xf8, 0x01, 0x03, 0x18, 0x06, 0x02, 0xf8, 0x81, 0x03, 0x78, 0x03, 0x38, 0x0c, 0x02, 0xf8, 0x03, 0x0a, 0xf8, 0x01, 0x0b, 0x18, 0x80, 0x13, 0x18, 0x04, 0x13, 0x19, 0x81, 0x1b, 0x18, 0x2a, 0xf8, 0x03, 0x99, 0x31, 0x80, 0x99, 0x11, 0x01, 0x99, 0x31, 0x84, 0x99, 0x32, 0x99, 0x31, 0x99, 0x11, 0x99, 0x31, 0x99, 0x32, 0x02, 0x99, 0x31, 0x80, 0x52, 0x15, 0x01, 0x0a, 0xf8, 0x03, 0x02, 0xf8, 0x0d, 0x02, 0xd8, 0x80, 0x02, 0xd7, 0x01, 0x02, 0xd8, 0x01, 0x03, 0x78, 0x81, 0x02, 0xd7, 0x02, 0xd8, 0x01, 0x02, 0xd7, 0x80, 0x02, 0xd8,
+  0x86, 0x01, 0x76, 0x01, 0xb6, 0x02, 0xf8, 0x03, 0x17, 0x02, 0x17, 0x01, 0x96, 0x01, 0x76, 0x03, 0x01, 0x96, 0x80, 0x01, 0x76, 0x10, 0x01, 0x96, 0x80, 0x01, 0x76, 0x05, 0x01, 0x96, 0x84, 0x01, 0xf7, 0x03, 0x37, 0x02, 0xd7, 0x01, 0xb6, 0x01, 0x97, 0x01, 0x01, 0x96, 0x80, 0x01, 0x76, 0x11, 0x01, 0x96, 0x80, 0x01, 0x97, 0x07, 0x01, 0x96, 0x82, 0x02, 0x37, 0x03, 0x58, 0x02, 0x17, 0x09, 0x01, 0x96, 0x0f, 0x01, 0x97, 0x01, 0x01, 0x96, 0x01, 0x01, 0x97, 0x01, 0x01, 0x96, 0x83, 0x02, 0x77, 0x03, 0x18, 0x01, 0xb6, 0x01, 0x96, 0x15, 0x01, 0x97, 0x80, 0x01, 0xb7, 0x06, 0x01, 0x97, 0x86, 0x01, 0xb6, 0x02, 0xf7, 0x02, 0x57, 0x01, 0x97, 0x01, 0xb6, 0x01, 0xb7, 0x01, 0xb6, 0x19, 0x01, 0x97, 0x84, 0x01, 0xb7, 0x01, 0xb6, 0x01, 0xb7, 0x03, 0x78, 0x01, 0xb7, 0x1f, 0x01, 0x97, 0x82, 0x01, 0xb6, 0x01, 0xf7, 0x03, 0x58, 0x01, 0x01, 0x96, 0x84, 0x01, 0xb6, 0x01, 0x96, 0x01, 0xb6, 0x01, 0x97, 0x01, 0x96, 0x15, 0x01, 0x97, 0x01, 0x01, 0x96, 0x01, 0x01, 0x97, 0x01, 0x02, 0xf7, 0x03, 0x01, 0x96, 0x82, 0x01, 0x97, 0x01, 0x96, 0x01, 0x97, 0x01, 0x01, 0xb6, 0x02, 0x01, 0x96, 0x02, 0x01, 0x97, 0x81, 0x09, 0xb7, 0x09, 0x97, 0x02, 0x09, 0xb7, 0x01, 0x11, 0xb7, 0x80, 0x11, 0xd7, 0x02, 0x11, 0xb7, 0x82, 0x71, 0x53, 0x99, 0x31, 0x99, 0x11, 0x0b, 0x99, 0x31, 0x83, 0x61, 0x74, 0x09, 0xb6, 0x01, 0x96, 0x01, 0x97, 0x0e, 0x01, 0x96, 0x80, 0x01, 0x76, 0x03, 0x01, 0x96, 0x84, 0x01, 0x77, 0x01, 0x96, 0x02, 0xb7, 0x03, 0x37, 0x02, 0x16, 0x01, 0x01, 0x96,
+  0x83, 0x02, 0x36, 0x03, 0x17, 0x02, 0x56, 0x00, 0xf4, 0x17, 0x00, 0xd5, 0x01, 0x00, 0xf5, 0x81, 0x00, 0xd5, 0x00, 0xf5, 0x01, 0x00, 0xd5, 0x84, 0x00, 0xf5, 0x01, 0xf6, 0x03, 0x17, 0x01, 0xf6, 0x00, 0xf5, 0x03, 0x00, 0xd5, 0x80, 0x00, 0xf5, 0x10, 0x00, 0xd5, 0x01, 0x00, 0xf5, 0x03, 0x00, 0xd5, 0x85, 0x00, 0xf5, 0x00, 0xd5, 0x00, 0xf5, 0x01, 0xb6, 0x03, 0x37, 0x01, 0xb6, 0x1f, 0x00, 0xf5, 0x82, 0x01, 0x55, 0x03, 0x37, 0x01, 0x56, 0x01, 0x00, 0xd5, 0x02, 0x00, 0xf6, 0x80, 0x00, 0xf5, 0x01, 0x00, 0xd6, 0x07, 0x00, 0xf6, 0x07, 0x00, 0xf5, 0x81, 0x00, 0xf6, 0x00, 0xd5, 0x01, 0x00, 0xf6, 0x02, 0x00, 0xf5, 0x88, 0x00, 0xf6, 0x01, 0x15, 0x03, 0x38, 0x01, 0x15, 0x00, 0xf6, 0x00, 0xf5, 0x00, 0xf6, 0x00, 0xf5, 0x00, 0xd6, 0x17, 0x00, 0xf5, 0x85, 0x00, 0xd5, 0x00, 0xf6, 0x00, 0xd5, 0x00, 0xf5, 0x03, 0x57, 0x00, 0xf5, 0x01, 0x00, 0xf6, 0x17, 0x00, 0xf5, 0x81, 0x00, 0xf6, 0x00, 0xf5, 0x01, 0x00, 0xd5, 0x01, 0x00, 0xd6, 0x86, 0x00, 0xd5, 0x00, 0xf5, 0x02, 0xf7, 0x01, 0x76, 0x00, 0xf5, 0x00, 0xd5, 0x00, 0xf5, 0x01, 0x00, 0xf6, 0x17, 0x00, 0xf5, 0x88, 0x00, 0xd5, 0x00, 0xf5, 0x00, 0xd5, 0x01, 0x16, 0x02, 0xf7, 0x01, 0xd6, 0x00, 0xd6, 0x00, 0xd5, 0x00, 0xf5, 0x04, 0x00, 0xd5, 0x80, 0x00, 0xf5, 0x01, 0x00, 0xd5, 0x04, 0x00, 0xf5, 0x03, 0x08, 0xf6, 0x01, 0x09, 0x16, 0x83, 0x10, 0xf6, 0x11, 0x17, 0x11, 0x16, 0x31, 0x35, 0x03, 0x99, 0x31, 0x80, 0x99, 0x11, 0x02, 0x99, 0x31, 0x81, 0x99, 0x11, 0x99, 0x12, 0x03, 0x99, 0x31, 0x82, 0x71, 0x13, 0x08, 0xf5, 0x08, 0xf6, 0x03, 0x00, 0xf5, 0x0f, 0x00, 0xd5, 0x80, 0x00, 0xd4, 0x02, 0x00, 0xd5, 0x83, 0x01, 0xd6, 0x02, 0xf7, 0x02, 0x36, 0x01, 0x14,
+  0x83, 0x01, 0xf4, 0x01, 0x13, 0x00, 0xb3, 0x00, 0xd3, 0x06, 0x00, 0xb3, 0x80, 0x00, 0xd3, 0x08, 0x00, 0xb3, 0x83, 0x00, 0xd3, 0x00, 0xb3, 0x00, 0xd3, 0x00, 0xd4, 0x01, 0x00, 0xb3, 0x80, 0x00, 0xd4, 0x01, 0x00, 0xb3, 0x88, 0x00, 0xd4, 0x00, 0xb3, 0x00, 0xd3, 0x01, 0x33, 0x02, 0x75, 0x02, 0x55, 0x01, 0x34, 0x00, 0xd3, 0x00, 0xb3, 0x01, 0x00, 0xd3, 0x01, 0x00, 0xd4, 0x80, 0x00, 0xb4, 0x11, 0x00, 0xd4, 0x82, 0x00, 0xb4, 0x00, 0xd4, 0x00, 0xb4, 0x01, 0x00, 0xd4, 0x01, 0x00, 0xb4, 0x84, 0x01, 0xd4, 0x02, 0xb5, 0x01, 0x34, 0x00, 0xd4, 0x00, 0xb4, 0x1d, 0x00, 0xd4, 0x82, 0x00, 0xf4, 0x02, 0xb5, 0x01, 0xb5, 0x20, 0x00, 0xd4, 0x83, 0x01, 0xb5, 0x02, 0x55, 0x00, 0xd5, 0x00, 0xb4, 0x1f, 0x00, 0xd4, 0x80, 0x02, 0xf6, 0x22, 0x00, 0xd4, 0x81, 0x01, 0xf5, 0x02, 0x35, 0x16, 0x00, 0xd4, 0x06, 0x00, 0xb4, 0x01, 0x00, 0xd4, 0x84, 0x00, 0xb4, 0x01, 0x54, 0x02, 0xb5, 0x01, 0x34, 0x00, 0xd4, 0x01, 0x00, 0xb4, 0x02, 0x00, 0xd4, 0x80, 0x00, 0xb4, 0x08, 0x00, 0xd4, 0x02, 0x08, 0xd4, 0x02, 0x08, 0xf4, 0x83, 0x08, 0xf5, 0x10, 0xf4, 0x10, 0xd5, 0x79, 0x12, 0x08, 0x99, 0x31, 0x80, 0x99, 0x11, 0x02, 0x99, 0x31, 0x80, 0x81, 0x32, 0x02, 0x00, 0xd4, 0x04, 0x00, 0xd3, 0x81, 0x00, 0xb3, 0x00, 0xd3, 0x0d, 0x00, 0xb3, 0x81, 0x00, 0xb2, 0x00, 0xb3, 0x01, 0x00, 0xd3, 0x81, 0x02, 0x14, 0x02, 0x95,
+  0x80, 0x00, 0xb1, 0x02, 0x00, 0x91, 0x81, 0x00, 0xb1, 0x00, 0x91, 0x01, 0x00, 0xb1, 0x80, 0x00, 0x91, 0x13, 0x00, 0xb1, 0x01, 0x00, 0x91, 0x85, 0x00, 0xd2, 0x01, 0xb2, 0x02, 0x73, 0x01, 0x72, 0x00, 0xb1, 0x00, 0xb2, 0x01, 0x00, 0xb1, 0x80, 0x00, 0xb2, 0x01, 0x00, 0xb1, 0x81, 0x00, 0xb2, 0x00, 0xb1, 0x0f, 0x00, 0xb2, 0x01, 0x00, 0xb1, 0x01, 0x00, 0xb2, 0x80, 0x00, 0xb1, 0x02, 0x00, 0xb2, 0x82, 0x01, 0xd3, 0x02, 0x53, 0x01, 0x12, 0x20, 0x00, 0xb2, 0x82, 0x02, 0x13, 0x01, 0xd3, 0x00, 0x92, 0x20, 0x00, 0xb2, 0x81, 0x02, 0x53, 0x01, 0x53, 0x21, 0x00, 0xb2, 0x80, 0x02, 0x94, 0x22, 0x00, 0xb2, 0x82, 0x00, 0xf2, 0x02, 0x93, 0x00, 0xd2, 0x1e, 0x00, 0xb2, 0x83, 0x00, 0xb1, 0x00, 0xb2, 0x01, 0x72, 0x02, 0x53, 0x01, 0x00, 0xb1, 0x04, 0x00, 0xb2, 0x02, 0x00, 0xb1, 0x06, 0x00, 0xb2, 0x02, 0x08, 0xb2, 0x86, 0x08, 0xd2, 0x08, 0xb2, 0x08, 0xd2, 0x08, 0xd3, 0x10, 0xd3, 0x40, 0xf2, 0x99, 0x11, 0x06, 0x99, 0x31, 0x80, 0x99, 0x11, 0x03, 0x99, 0x31, 0x82, 0x99, 0x11, 0x00, 0xd2, 0x00, 0xb2, 0x10, 0x00, 0xb1, 0x80, 0x00, 0x91, 0x07, 0x00, 0xb1, 0x81, 0x00, 0x91, 0x01, 0x31,
+  0x81, 0x00, 0x90, 0x00, 0x70, 0x1b, 0x00, 0x90, 0x83, 0x01, 0x11, 0x02, 0x12, 0x01, 0xd1, 0x00, 0xd0, 0x1f, 0x00, 0x90, 0x83, 0x00, 0xb0, 0x01, 0xd2, 0x01, 0xf2, 0x00, 0xb0, 0x1e, 0x00, 0x90, 0x01, 0x00, 0xb0, 0x82, 0x01, 0x71, 0x02, 0x12, 0x00, 0xb0, 0x05, 0x00, 0x90, 0x01, 0x00, 0xb0, 0x01, 0x00, 0x90, 0x0f, 0x00, 0xb0, 0x02, 0x00, 0x90, 0x01, 0x00, 0xb0, 0x01, 0x00, 0x90, 0x84, 0x00, 0xf1, 0x02, 0x52, 0x00, 0xb0, 0x00, 0x90, 0x00, 0xb0, 0x01, 0x00, 0x90, 0x01, 0x00, 0xb0, 0x17, 0x00, 0x90, 0x01, 0x00, 0xb0, 0x01, 0x00, 0x90, 0x83, 0x02, 0x72, 0x00, 0xb0, 0x00, 0x90, 0x00, 0xb0, 0x18, 0x00, 0x90, 0x03, 0x00, 0xb0, 0x03, 0x00, 0x90, 0x82, 0x01, 0xd1, 0x01, 0x71, 0x00, 0x91, 0x01, 0x00, 0xb0, 0x1e, 0x00, 0x90, 0x01, 0x01, 0xd1, 0x81, 0x00, 0x90, 0x00, 0xb0, 0x02, 0x00, 0x90, 0x02, 0x00, 0xb0, 0x05, 0x00, 0x90, 0x03, 0x00, 0x91, 0x06, 0x08, 0xb1, 0x80, 0x89, 0x12, 0x04, 0x99, 0x31, 0x80, 0x99, 0x11, 0x02, 0x99, 0x31, 0x01, 0x99, 0x11, 0x82, 0x99, 0x12, 0x99, 0x31, 0x00, 0x91, 0x1c, 0x00, 0x90,
+  0x0a, 0x00, 0x90, 0x80, 0x00, 0x8f, 0x0f, 0x00, 0x90, 0x83, 0x00, 0xb0, 0x01, 0x91, 0x02, 0x32, 0x01, 0x51, 0x09, 0x00, 0x90, 0x80, 0x00, 0xb0, 0x15, 0x00, 0x90, 0x83, 0x00, 0xb0, 0x01, 0xf2, 0x01, 0xd1, 0x00, 0xb0, 0x20, 0x00, 0x90, 0x82, 0x01, 0x10, 0x02, 0x52, 0x00, 0xd0, 0x21, 0x00, 0x90, 0x81, 0x01, 0xb1, 0x01, 0x91, 0x1f, 0x00, 0x90, 0x80, 0x00, 0xb0, 0x01, 0x00, 0x90, 0x80, 0x02, 0x52, 0x23, 0x00, 0x90, 0x81, 0x01, 0x51, 0x02, 0x32, 0x21, 0x00, 0x90, 0x83, 0x00, 0xb0, 0x01, 0xf1, 0x01, 0x71, 0x00, 0xb0, 0x0e, 0x00, 0x90, 0x80, 0x00, 0x91, 0x01, 0x00, 0xb0, 0x82, 0x00, 0xb1, 0x08, 0xb1, 0x08, 0xb0, 0x01, 0x08, 0xb1, 0x80, 0x50, 0xf1, 0x01, 0x99, 0x31, 0x80, 0x99, 0x11, 0x03, 0x99, 0x31, 0x85, 0x99, 0x11, 0x99, 0x31, 0x99, 0x11, 0x99, 0x31, 0x99, 0x11, 0x99, 0x31, 0x1a, 0x00, 0x90, 0x80, 0x00, 0x70, 0x01, 0x00, 0x90,
+  0x02, 0x00, 0x8f, 0x02, 0x00, 0x90, 0x04, 0x00, 0x8f, 0x08, 0x00, 0x90, 0x01, 0x00, 0x8f, 0x80, 0x00, 0x90, 0x03, 0x00, 0x8f, 0x86, 0x00, 0xd0, 0x02, 0x12, 0x01, 0xd2, 0x00, 0xd0, 0x00, 0x90, 0x00, 0x8f, 0x00, 0x90, 0x06, 0x00, 0x8f, 0x80, 0x00, 0x90, 0x01, 0x00, 0x8f, 0x10, 0x00, 0x90, 0x80, 0x00, 0x8f, 0x01, 0x00, 0x90, 0x82, 0x00, 0xf0, 0x02, 0x32, 0x01, 0xb1, 0x03, 0x00, 0x90, 0x01, 0x00, 0x8f, 0x1c, 0x00, 0x90, 0x81, 0x02, 0x32, 0x01, 0x30, 0x21, 0x00, 0x90, 0x82, 0x00, 0xb0, 0x02, 0x32, 0x00, 0xd0, 0x04, 0x00, 0x90, 0x01, 0x00, 0x8f, 0x1b, 0x00, 0x90, 0x80, 0x02, 0x52, 0x24, 0x00, 0x90, 0x83, 0x02, 0x32, 0x00, 0xf0, 0x00, 0x90, 0x00, 0x70, 0x1f, 0x00, 0x90, 0x83, 0x00, 0xf0, 0x02, 0x32, 0x00, 0xf1, 0x00, 0xb0, 0x01, 0x00, 0x8f, 0x81, 0x00, 0x90, 0x00, 0x8f, 0x0c, 0x00, 0x90, 0x01, 0x00, 0xb0, 0x84, 0x08, 0x90, 0x08, 0xb0, 0x08, 0x91, 0x10, 0xb0, 0x99, 0x31, 0x01, 0x99, 0x11, 0x02, 0x99, 0x31, 0x80, 0x99, 0x11, 0x05, 0x99, 0x31, 0x11, 0x00, 0x90, 0x80, 0x00, 0x8f, 0x05, 0x00, 0x90, 0x04, 0x00, 0x8f,
+  0x0f, 0x00, 0x8f, 0x80, 0x00, 0x6f, 0x03, 0x00, 0x8f, 0x80, 0x00, 0x6f, 0x03, 0x00, 0x8f, 0x84, 0x01, 0x71, 0x02, 0x32, 0x01, 0x51, 0x00, 0x8f, 0x00, 0x6f, 0x01, 0x00, 0x8f, 0x80, 0x00, 0x6f, 0x13, 0x00, 0x8f, 0x81, 0x00, 0x70, 0x00, 0x90, 0x03, 0x00, 0x8f, 0x86, 0x00, 0x6f, 0x00, 0x8f, 0x00, 0x6f, 0x00, 0xf0, 0x02, 0x12, 0x01, 0x51, 0x00, 0x6f, 0x10, 0x00, 0x8f, 0x07, 0x00, 0x90, 0x01, 0x00, 0x8f, 0x80, 0x00, 0x90, 0x03, 0x00, 0x8f, 0x84, 0x00, 0x70, 0x00, 0x90, 0x01, 0xf1, 0x01, 0xb1, 0x00, 0x70, 0x01, 0x00, 0x8f, 0x19, 0x00, 0x90, 0x02, 0x00, 0x8f, 0x80, 0x00, 0x90, 0x01, 0x00, 0x8f, 0x81, 0x01, 0x30, 0x01, 0xf1, 0x03, 0x00, 0x90, 0x1f, 0x00, 0x8f, 0x80, 0x02, 0x52, 0x1a, 0x00, 0x8f, 0x08, 0x00, 0x90, 0x83, 0x00, 0x8f, 0x01, 0x91, 0x01, 0xb1, 0x00, 0x90, 0x02, 0x00, 0x8f, 0x17, 0x00, 0x90, 0x80, 0x00, 0x8f, 0x01, 0x00, 0x90, 0x87, 0x00, 0x8f, 0x00, 0x90, 0x00, 0x6f, 0x00, 0x8f, 0x01, 0x31, 0x02, 0x32, 0x00, 0xd0, 0x00, 0x90, 0x02, 0x00, 0x8f, 0x01, 0x00, 0x90, 0x01, 0x00, 0x8f, 0x0e, 0x00, 0x90, 0x80, 0x60, 0xf1, 0x0b, 0x99, 0x31, 0x80, 0x01, 0x50, 0x02, 0x00, 0x90, 0x82, 0x00, 0x6f, 0x00, 0x90, 0x00, 0x6f, 0x01, 0x00, 0x8f, 0x80, 0x00, 0x70, 0x13, 0x00, 0x8f,
+  0x0d, 0x00, 0x8f, 0x05, 0x00, 0x6f, 0x87, 0x00, 0x70, 0x00, 0x8f, 0x00, 0x6f, 0x00, 0x8f, 0x01, 0x10, 0x02, 0x32, 0x01, 0xb1, 0x00, 0xaf, 0x04, 0x00, 0x8f, 0x80, 0x00, 0x6f, 0x12, 0x00, 0x8f, 0x82, 0x00, 0x6f, 0x00, 0x8f, 0x00, 0x6f, 0x04, 0x00, 0x8f, 0x85, 0x00, 0x6f, 0x01, 0x10, 0x02, 0x52, 0x01, 0x30, 0x00, 0x8f, 0x00, 0x6f, 0x1f, 0x00, 0x8f, 0x82, 0x00, 0x6f, 0x01, 0x70, 0x01, 0xf2, 0x20, 0x00, 0x8f, 0x80, 0x00, 0x6f, 0x01, 0x00, 0x8f, 0x81, 0x01, 0xd2, 0x01, 0x30, 0x20, 0x00, 0x8f, 0x80, 0x00, 0x6f, 0x01, 0x00, 0x8f, 0x80, 0x02, 0x52, 0x24, 0x00, 0x8f, 0x82, 0x00, 0xcf, 0x02, 0x32, 0x00, 0xaf, 0x1b, 0x00, 0x8f, 0x80, 0x00, 0x6f, 0x01, 0x00, 0x8f, 0x02, 0x00, 0x6f, 0x83, 0x00, 0x8f, 0x01, 0x91, 0x02, 0x12, 0x00, 0x6f, 0x01, 0x00, 0x8f, 0x01, 0x00, 0x6f, 0x08, 0x00, 0x8f, 0x07, 0x00, 0x90, 0x84, 0x00, 0x8f, 0x18, 0xaf, 0x99, 0x11, 0x99, 0x12, 0x99, 0x11, 0x02, 0x99, 0x31, 0x80, 0x99, 0x11, 0x01, 0x99, 0x31, 0x88, 0xa1, 0x11, 0x99, 0x31, 0xa1, 0x11, 0x29, 0xd2, 0x01, 0xb1, 0x00, 0x8f, 0x00, 0x6f, 0x00, 0x8f, 0x00, 0x6f, 0x01, 0x00, 0x8f, 0x80, 0x00, 0x6f, 0x14, 0x00, 0x8f,
+  0x0b, 0x00, 0x6f, 0x01, 0x00, 0x8f, 0x02, 0x00, 0x6f, 0x80, 0x00, 0x8f, 0x03, 0x00, 0x6f, 0x84, 0x00, 0x8f, 0x01, 0xb1, 0x02, 0x32, 0x01, 0x0f, 0x00, 0x8f, 0x03, 0x00, 0x6f, 0x01, 0x00, 0x8f, 0x13, 0x00, 0x6f, 0x01, 0x00, 0x8f, 0x05, 0x00, 0x6f, 0x82, 0x01, 0x50, 0x02, 0x32, 0x00, 0xcf, 0x01, 0x00, 0x6f, 0x80, 0x00, 0x8e, 0x1d, 0x00, 0x6f, 0x86, 0x00, 0x8f, 0x00, 0x6f, 0x01, 0x0f, 0x02, 0x12, 0x00, 0xaf, 0x00, 0x6f, 0x00, 0x8f, 0x1b, 0x00, 0x6f, 0x01, 0x00, 0x8f, 0x01, 0x00, 0x6f, 0x83, 0x00, 0x8f, 0x00, 0xaf, 0x02, 0x12, 0x00, 0xaf, 0x1f, 0x00, 0x6f, 0x01, 0x00, 0x8f, 0x01, 0x00, 0x6f, 0x82, 0x02, 0x52, 0x00, 0x6f, 0x00, 0x8f, 0x20, 0x00, 0x6f, 0x80, 0x00, 0x8f, 0x01, 0x00, 0x6f, 0x81, 0x01, 0xd1, 0x01, 0x30, 0x01, 0x00, 0x8f, 0x1b, 0x00, 0x6f, 0x80, 0x00, 0x8f, 0x04, 0x00, 0x6f, 0x82, 0x01, 0xf1, 0x01, 0xb1, 0x00, 0x8f, 0x01, 0x00, 0x6f, 0x80, 0x00, 0x8f, 0x05, 0x00, 0x6f, 0x0a, 0x00, 0x8f, 0x82, 0x00, 0x6f, 0x00, 0x90, 0x81, 0x11, 0x06, 0x99, 0x31, 0x81, 0x99, 0x12, 0x99, 0x32, 0x01, 0x99, 0x31, 0x83, 0x28, 0xd0, 0x01, 0xf2, 0x01, 0xd1, 0x00, 0x8f, 0x03, 0x00, 0x6f, 0x81, 0x00, 0x6e, 0x00, 0x8f, 0x13, 0x00, 0x6f,
+  0x13, 0x00, 0x6e, 0x86, 0x00, 0x8e, 0x01, 0x10, 0x02, 0x12, 0x01, 0xb1, 0x00, 0x8f, 0x00, 0x6f, 0x00, 0x6e, 0x01, 0x00, 0x6f, 0x81, 0x00, 0x6e, 0x00, 0x8f, 0x02, 0x00, 0x6e, 0x01, 0x00, 0x6f, 0x0f, 0x00, 0x6e, 0x81, 0x00, 0x6f, 0x00, 0x8f, 0x01, 0x00, 0x6e, 0x01, 0x00, 0x6f, 0x84, 0x00, 0x8e, 0x00, 0x6e, 0x01, 0x91, 0x01, 0xf1, 0x00, 0xcf, 0x01, 0x00, 0x6f, 0x82, 0x00, 0x6e, 0x00, 0x8f, 0x00, 0x6e, 0x18, 0x00, 0x6f, 0x01, 0x00, 0x8f, 0x01, 0x00, 0x6e, 0x89, 0x00, 0x6f, 0x00, 0xcf, 0x02, 0x12, 0x01, 0x10, 0x00, 0x8f, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x8f, 0x00, 0x6f, 0x00, 0x6e, 0x1d, 0x00, 0x6f, 0x81, 0x01, 0x50, 0x01, 0x91, 0x24, 0x00, 0x6f, 0x80, 0x02, 0x32, 0x25, 0x00, 0x6f, 0x83, 0x01, 0x10, 0x01, 0xf1, 0x00, 0x8f, 0x00, 0x6e, 0x21, 0x00, 0x6f, 0x82, 0x00, 0xaf, 0x02, 0x12, 0x01, 0x10, 0x01, 0x00, 0x6f, 0x80, 0x00, 0x8f, 0x08, 0x00, 0x6f, 0x03, 0x00, 0x8f, 0x05, 0x00, 0x6f, 0x80, 0x48, 0xd0, 0x01, 0x99, 0x31, 0x80, 0x99, 0x11, 0x07, 0x99, 0x31, 0x89, 0x00, 0x8e, 0x00, 0x8f, 0x01, 0xb1, 0x01, 0xf2, 0x00, 0xaf, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x8f, 0x00, 0x6e, 0x00, 0x8f, 0x13, 0x00, 0x6e,
+  0x12, 0x00, 0x6e, 0x83, 0x00, 0x8e, 0x01, 0xb1, 0x02, 0x12, 0x00, 0xef, 0x02, 0x00, 0x6e, 0x80, 0x00, 0x6f, 0x1b, 0x00, 0x6e, 0x80, 0x00, 0x6f, 0x01, 0x00, 0x6e, 0x84, 0x00, 0x8e, 0x01, 0xd1, 0x01, 0xf1, 0x00, 0x8f, 0x00, 0x6f, 0x21, 0x00, 0x6e, 0x83, 0x00, 0xae, 0x01, 0xf1, 0x01, 0x70, 0x00, 0x6f, 0x02, 0x00, 0x6e, 0x80, 0x00, 0x6f, 0x01, 0x00, 0x6e, 0x80, 0x00, 0x6f, 0x1c, 0x00, 0x6e, 0x82, 0x02, 0x11, 0x00, 0xcf, 0x00, 0x8f, 0x23, 0x00, 0x6e, 0x80, 0x02, 0x32, 0x25, 0x00, 0x6e, 0x82, 0x00, 0x8f, 0x02, 0x12, 0x00, 0xcf, 0x23, 0x00, 0x6e, 0x82, 0x00, 0xef, 0x02, 0x12, 0x00, 0xcf, 0x0a, 0x00, 0x6e, 0x08, 0x00, 0x6f, 0x82, 0x00, 0x6e, 0x10, 0x8f, 0x99, 0x11, 0x09, 0x99, 0x31, 0x85, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x6e, 0x01, 0x90, 0x02, 0x12, 0x00, 0xcf, 0x17, 0x00, 0x6e,
+  0x11, 0x00, 0x6e, 0x83, 0x01, 0x30, 0x02, 0x12, 0x01, 0x70, 0x00, 0x8e, 0x04, 0x00, 0x6e, 0x80, 0x00, 0x4e, 0x1c, 0x00, 0x6e, 0x83, 0x00, 0xaf, 0x01, 0xd1, 0x01, 0x90, 0x00, 0x8e, 0x23, 0x00, 0x6e, 0x81, 0x01, 0x90, 0x01, 0xf1, 0x24, 0x00, 0x6e, 0x81, 0x00, 0xef, 0x02, 0x11, 0x25, 0x00, 0x6e, 0x80, 0x02, 0x32, 0x26, 0x00, 0x6e, 0x81, 0x01, 0x70, 0x01, 0x90, 0x24, 0x00, 0x6e, 0x82, 0x01, 0x50, 0x01, 0xf1, 0x00, 0x8e, 0x14, 0x00, 0x6e, 0x80, 0x68, 0xf0, 0x01, 0x99, 0x31, 0x80, 0x99, 0x11, 0x02, 0x99, 0x31, 0x80, 0x99, 0x11, 0x02, 0x99, 0x31, 0x03, 0x00, 0x6e, 0x82, 0x01, 0x0f, 0x02, 0x12, 0x00, 0xef, 0x16, 0x00, 0x6e,
+  0x0f, 0x00, 0x6e, 0x83, 0x00, 0x8e, 0x01, 0xb1, 0x01, 0xf2, 0x00, 0xcf, 0x23, 0x00, 0x6e, 0x82, 0x00, 0xaf, 0x02, 0x12, 0x01, 0x91, 0x01, 0x00, 0x6e, 0x80, 0x00, 0x4e, 0x02, 0x00, 0x6e, 0x81, 0x00, 0x4e, 0x00, 0x8e, 0x1c, 0x00, 0x6e, 0x82, 0x01, 0x0f, 0x02, 0x12, 0x00, 0x8e, 0x01, 0x00, 0x6e, 0x80, 0x00, 0x4e, 0x21, 0x00, 0x6e, 0x81, 0x01, 0x90, 0x01, 0x50, 0x25, 0x00, 0x6e, 0x80, 0x02, 0x32, 0x26, 0x00, 0x6e, 0x82, 0x00, 0x8e, 0x02, 0x11, 0x00, 0x8e, 0x24, 0x00, 0x6e, 0x81, 0x01, 0x90, 0x01, 0xb1, 0x14, 0x00, 0x6e, 0x80, 0x38, 0xb0, 0x06, 0x99, 0x31, 0x83, 0x99, 0x11, 0x99, 0x31, 0x99, 0x12, 0x00, 0x4e, 0x01, 0x00, 0x6e, 0x84, 0x00, 0x4e, 0x00, 0x6e, 0x01, 0x0f, 0x02, 0x12, 0x01, 0x0f, 0x15, 0x00, 0x6e,
+  0x0b, 0x00, 0x6e, 0x01, 0x00, 0x4e, 0x83, 0x00, 0x4d, 0x01, 0x30, 0x01, 0xf2, 0x01, 0x50, 0x01, 0x00, 0x6d, 0x04, 0x00, 0x6e, 0x80, 0x00, 0x4e, 0x1b, 0x00, 0x6e, 0x86, 0x00, 0x4e, 0x00, 0xef, 0x02, 0x12, 0x01, 0x0f, 0x00, 0x4e, 0x00, 0x6e, 0x00, 0x4e, 0x04, 0x00, 0x6e, 0x80, 0x00, 0x4e, 0x19, 0x00, 0x6e, 0x01, 0x00, 0x4e, 0x84, 0x00, 0xaf, 0x02, 0x12, 0x00, 0xcf, 0x00, 0x4e, 0x00, 0x6e, 0x01, 0x00, 0x4e, 0x02, 0x00, 0x6e, 0x80, 0x00, 0x4e, 0x1a, 0x00, 0x6e, 0x85, 0x00, 0x4e, 0x00, 0x6e, 0x00, 0x8e, 0x02, 0x32, 0x00, 0x8e, 0x00, 0x4e, 0x24, 0x00, 0x6e, 0x80, 0x02, 0x32, 0x22, 0x00, 0x6e, 0x82, 0x00, 0x4e, 0x00, 0x6e, 0x00, 0x4e, 0x01, 0x00, 0x6e, 0x81, 0x01, 0xd1, 0x01, 0x0f, 0x1d, 0x00, 0x6e, 0x80, 0x00, 0x4e, 0x01, 0x00, 0x6e, 0x87, 0x00, 0x4e, 0x00, 0x6e, 0x00, 0x4e, 0x00, 0x6e, 0x00, 0x8e, 0x01, 0xf1, 0x01, 0x2f, 0x00, 0x4e, 0x0f, 0x00, 0x6e, 0x01, 0x00, 0x4e, 0x82, 0x00, 0x6e, 0x08, 0x6e, 0x99, 0x11, 0x03, 0x99, 0x31, 0x80, 0x99, 0x12, 0x01, 0x99, 0x31, 0x83, 0x99, 0x11, 0x99, 0x31, 0x00, 0x4e, 0x00, 0x6d, 0x03, 0x00, 0x6e, 0x83, 0x00, 0xae, 0x02, 0x11, 0x01, 0x90, 0x00, 0x4e, 0x13, 0x00, 0x6e,
+  0x03, 0x00, 0x4d, 0x81, 0x00, 0x6e, 0x00, 0x6d, 0x01, 0x00, 0x4d, 0x80, 0x00, 0x4e, 0x01, 0x00, 0x4d, 0x01, 0x00, 0x6d, 0x84, 0x00, 0x8e, 0x01, 0xb1, 0x01, 0xd1, 0x00, 0xce, 0x00, 0x6d, 0x01, 0x00, 0x4d, 0x1a, 0x00, 0x6d, 0x82, 0x00, 0x4d, 0x00, 0x6e, 0x00, 0x4d, 0x01, 0x00, 0x6e, 0x85, 0x00, 0x4e, 0x00, 0x6d, 0x01, 0x0f, 0x02, 0x12, 0x00, 0xef, 0x00, 0x6d, 0x01, 0x00, 0x6e, 0x07, 0x00, 0x6d, 0x07, 0x00, 0x4d, 0x09, 0x00, 0x6e, 0x81, 0x00, 0x4d, 0x00, 0x6d, 0x02, 0x00, 0x6e, 0x85, 0x00, 0x4d, 0x00, 0x6e, 0x00, 0x4d, 0x00, 0x6e, 0x01, 0xd1, 0x01, 0x50, 0x24, 0x00, 0x6e, 0x82, 0x00, 0x4e, 0x01, 0x30, 0x01, 0x91, 0x01, 0x00, 0x6e, 0x80, 0x00, 0x4e, 0x22, 0x00, 0x6e, 0x82, 0x00, 0x4e, 0x02, 0x32, 0x00, 0x4e, 0x21, 0x00, 0x6e, 0x81, 0x00, 0x4e, 0x00, 0x6e, 0x01, 0x00, 0x4d, 0x82, 0x00, 0x4e, 0x01, 0x0f, 0x01, 0xd1, 0x03, 0x00, 0x6e, 0x80, 0x00, 0x6d, 0x01, 0x00, 0x4e, 0x80, 0x00, 0x4d, 0x1b, 0x00, 0x6e, 0x01, 0x00, 0x6d, 0x82, 0x00, 0xce, 0x02, 0x12, 0x00, 0xce, 0x03, 0x00, 0x6e, 0x80, 0x00, 0x6d, 0x01, 0x00, 0x4d, 0x80, 0x00, 0x6d, 0x0a, 0x00, 0x6e, 0x82, 0x00, 0x4e, 0x70, 0xf0, 0x99, 0x32, 0x01, 0x99, 0x31, 0x82, 0x99, 0x11, 0x99, 0x31, 0x99, 0x11, 0x01, 0x99, 0x31, 0x80, 0x81, 0x10, 0x01, 0x00, 0x6e, 0x80, 0x00, 0x4d, 0x03, 0x00, 0x6d, 0x82, 0x00, 0x8e, 0x01, 0xd1, 0x01, 0x90, 0x01, 0x00, 0x6d, 0x80, 0x00, 0x4e, 0x01, 0x00, 0x6e, 0x82, 0x00, 0x4d, 0x00, 0x6d, 0x00, 0x6e, 0x01, 0x00, 0x4d, 0x05, 0x00, 0x6d, 0x03, 0x00, 0x4d,
+  0x07, 0x00, 0x4d, 0x80, 0x00, 0x6d, 0x02, 0x00, 0x4d, 0x83, 0x01, 0x50, 0x01, 0xf1, 0x01, 0x50, 0x00, 0x6d, 0x1e, 0x00, 0x4d, 0x82, 0x00, 0x6d, 0x00, 0x4d, 0x00, 0x4e, 0x02, 0x00, 0x4d, 0x83, 0x01, 0x50, 0x01, 0xf1, 0x00, 0xae, 0x00, 0x6d, 0x02, 0x00, 0x4d, 0x18, 0x00, 0x6d, 0x80, 0x00, 0x4d, 0x01, 0x00, 0x6d, 0x82, 0x00, 0x4d, 0x00, 0x6d, 0x00, 0x4d, 0x02, 0x00, 0x6d, 0x81, 0x01, 0x70, 0x01, 0xb1, 0x01, 0x00, 0x6d, 0x80, 0x00, 0x4d, 0x08, 0x00, 0x6d, 0x17, 0x00, 0x6e, 0x84, 0x00, 0x6d, 0x00, 0x4e, 0x00, 0x6e, 0x01, 0xd1, 0x01, 0x0f, 0x01, 0x00, 0x6d, 0x20, 0x00, 0x6e, 0x84, 0x00, 0x4d, 0x00, 0x6d, 0x00, 0x6e, 0x00, 0x4e, 0x02, 0x12, 0x01, 0x00, 0x4d, 0x21, 0x00, 0x6e, 0x80, 0x00, 0x4d, 0x02, 0x00, 0x6d, 0x84, 0x00, 0x6e, 0x01, 0xf1, 0x00, 0x8e, 0x00, 0x6d, 0x00, 0x6e, 0x01, 0x00, 0x4d, 0x01, 0x00, 0x6d, 0x80, 0x00, 0x4e, 0x08, 0x00, 0x6e, 0x12, 0x00, 0x6d, 0x84, 0x00, 0x4d, 0x00, 0x6d, 0x00, 0x4d, 0x01, 0x0f, 0x01, 0xf1, 0x01, 0x00, 0x6d, 0x81, 0x00, 0x4d, 0x00, 0x6e, 0x02, 0x00, 0x6d, 0x80, 0x00, 0x4d, 0x07, 0x00, 0x6d, 0x80, 0x00, 0x4e, 0x01, 0x00, 0x6d, 0x81, 0x00, 0x4d, 0x40, 0xcf, 0x07, 0x99, 0x31, 0x82, 0x70, 0xf0, 0x00, 0x4d, 0x00, 0x6d, 0x01, 0x00, 0x4d, 0x01, 0x00, 0x6d, 0x01, 0x00, 0x4d, 0x85, 0x00, 0x6d, 0x01, 0x91, 0x01, 0xb1, 0x00, 0x6d, 0x00, 0x4d, 0x00, 0x6d, 0x0f, 0x00, 0x4d,
 };
 
 #endif // HAS_GRAPHICAL_TFT
@@ -27,8 +27,8 @@
 extern const uint8_t marlin_logo_112x38x1[];
 extern const uint8_t marlin_logo_228x255x2[];
 extern const uint8_t marlin_logo_228x255x4[];
-extern const uint16_t marlin_logo_195x59x16[];
-extern const uint16_t marlin_logo_320x240x16[];
+extern const uint8_t marlin_logo_195x59x16[];
+extern const uint8_t marlin_logo_320x240x16[];
 extern const uint16_t marlin_logo_480x320x16[];
 extern const uint16_t background_320x30x16[];
 
@@ -102,7 +102,8 @@ enum colorMode_t : uint8_t {
   GREYSCALE1 = 0x01,  // 1 bit per pixel
   GREYSCALE2,         // 2 bits per pixel
   GREYSCALE4,         // 4 bits per pixel
-  HIGHCOLOR           // 16 bits per pixel
+  HIGHCOLOR,          // 16 bits per pixel
+  RLE16               // 16 bits per pixel, run-length encoded
 };
 
 typedef colorMode_t ColorMode;
@@ -28,25 +28,61 @@
 #include "tft.h"
 #include "tft_image.h"
 
+#if ENABLED(TFT_CANVAS_CACHE)
+  #include "../../libs/hash.h"
+#endif
+
 uint8_t TFT_Queue::queue[];
 uint8_t *TFT_Queue::end_of_queue = queue;
 uint8_t *TFT_Queue::current_task = NULL;
 uint8_t *TFT_Queue::last_task = NULL;
 
+#if ENABLED(TFT_CANVAS_CACHE)
+  canvasCache_t TFT_Queue::cache[TFT_CANVAS_CACHE_SIZE];
+  uint8_t TFT_Queue::cache_next; // = 0
+#endif
+
+#if ENABLED(TFT_PIXEL_STATS)
+  uint32_t TFT_Queue::pixels, TFT_Queue::pixel_rate;
+  millis_t TFT_Queue::next_stats_ms;
+#endif
+
 void TFT_Queue::reset() {
   tft.abort();
 
+  #if ENABLED(TFT_CANVAS_CACHE)
+    // An aborted task leaves the screen in an unknown state
+    if (current_task && ((queueTask_t *)current_task)->type != TASK_END_OF_QUEUE)
+      invalidate(0, 0, TFT_WIDTH, TFT_HEIGHT);
+  #endif
+
   end_of_queue = queue;
   current_task = NULL;
   last_task = NULL;
 }
 
 void TFT_Queue::async() {
+  #if ENABLED(TFT_PIXEL_STATS)
+    const millis_t ms = millis();
+    if (ELAPSED(ms, next_stats_ms)) {
+      next_stats_ms = ms + 1000;
+      pixel_rate = pixels;
+      pixels = 0;
+      if (pixel_rate && DEBUGGING(INFO)) SERIAL_ECHO_MSG("TFT pixels/s: ", pixel_rate);
+    }
+  #endif
+
   if (current_task == NULL) return;
   queueTask_t *task = (queueTask_t *)current_task;
 
   // Check IO busy status
-  if (tft.is_busy()) return;
+  if (tft.is_busy()) {
+    #if ENABLED(TFT_DOUBLE_BUFFER)
+      // Render the next canvas stripe while the previous one is sent
+      if (task->type == TASK_CANVAS && task->state == TASK_STATE_IN_PROGRESS) canvas(task);
+    #endif
+    return;
+  }
 
   if (task->state == TASK_STATE_COMPLETED) {
     task = (queueTask_t *)task->nextTask;
@@ -67,6 +103,17 @@ void TFT_Queue::finish_sketch() {
   queueTask_t *task = (queueTask_t *)last_task;
 
   if (task->state == TASK_STATE_SKETCH) {
+    #if ENABLED(TFT_CANVAS_CACHE)
+      // Drop a canvas that would draw exactly what is already on screen.
+      // Its place becomes the end of the queue for the previous task.
+      if (unchanged((parametersCanvas_t *)(last_task + sizeof(queueTask_t)))) {
+        end_of_queue = last_task;
+        *end_of_queue = TASK_END_OF_QUEUE;
+        last_task = NULL;
+        return;
+      }
+    #endif
+
     *end_of_queue = TASK_END_OF_QUEUE;
     task->nextTask = end_of_queue;
     task->state = TASK_STATE_READY;
@@ -82,6 +129,7 @@ void TFT_Queue::fill(queueTask_t *task) {
   if (task->state == TASK_STATE_READY) {
     tft.set_window(task_parameters->x, task_parameters->y, task_parameters->x + task_parameters->width - 1, task_parameters->y + task_parameters->height - 1);
     task->state = TASK_STATE_IN_PROGRESS;
+    TERN_(TFT_PIXEL_STATS, pixels += task_parameters->count);
   }
 
   if (task_parameters->count > 65535) {
@@ -106,64 +154,115 @@ void TFT_Queue::canvas(queueTask_t *task) {
   if (task->state == TASK_STATE_READY) {
     task->state = TASK_STATE_IN_PROGRESS;
     Canvas.New(task_parameters->x, task_parameters->y, task_parameters->width, task_parameters->height);
+    TERN_(TFT_PIXEL_STATS, pixels += uint32_t(task_parameters->width) * task_parameters->height);
   }
-  Canvas.Continue();
-
-  for (i = 0; i < task_parameters->count; i++) {
-    switch (*item) {
-      case CANVAS_SET_BACKGROUND:
-        Canvas.SetBackground(((parametersCanvasBackground_t *)item)->color);
-        item += sizeof(parametersCanvasBackground_t);
-        break;
-      case CANVAS_ADD_TEXT:
-        Canvas.AddText(((parametersCanvasText_t *)item)->x, ((parametersCanvasText_t *)item)->y, ((parametersCanvasText_t *)item)->color, item + sizeof(parametersCanvasText_t), ((parametersCanvasText_t *)item)->maxWidth);
-        item += sizeof(parametersCanvasText_t) + ((parametersCanvasText_t *)item)->stringLength;
-        break;
-
-      case CANVAS_ADD_IMAGE:
-        MarlinImage image;
-        uint16_t *colors;
-        colorMode_t color_mode;
-
-        image = ((parametersCanvasImage_t *)item)->image;
-        colors = (uint16_t *)(item + sizeof(parametersCanvasImage_t));
-        Canvas.AddImage(((parametersCanvasImage_t *)item)->x, ((parametersCanvasImage_t *)item)->y, image, colors);
-
-        item = (uint8_t *)colors;
-        color_mode = Images[image].colorMode;
-
-        switch (color_mode) {
-          case GREYSCALE1:
-            item += sizeof(uint16_t);
-            break;
-          case GREYSCALE2:
-            item += sizeof(uint16_t) * 3;
-            break;
-          case GREYSCALE4:
-            item += sizeof(uint16_t) * 15;
-            break;
-          default:
-            break;
-        }
-        break;
-
-      case CANVAS_ADD_BAR:
-        Canvas.AddBar(((parametersCanvasBar_t *)item)->x, ((parametersCanvasBar_t *)item)->y, ((parametersCanvasBar_t *)item)->width, ((parametersCanvasBar_t *)item)->height, ((parametersCanvasBar_t *)item)->color);
-        item += sizeof(parametersCanvasBar_t);
-        break;
-      case CANVAS_ADD_RECTANGLE:
-        Canvas.AddRectangle(((parametersCanvasRectangle_t *)item)->x, ((parametersCanvasRectangle_t *)item)->y, ((parametersCanvasRectangle_t *)item)->width, ((parametersCanvasRectangle_t *)item)->height, ((parametersCanvasRectangle_t *)item)->color);
-        item += sizeof(parametersCanvasRectangle_t);
-        break;
+
+  if (task->state == TASK_STATE_IN_PROGRESS) {
+    task->state = TASK_STATE_RENDERED;
+    Canvas.Continue();
+
+    for (i = 0; i < task_parameters->count; i++) {
+      switch (*item) {
+        case CANVAS_SET_BACKGROUND:
+          Canvas.SetBackground(((parametersCanvasBackground_t *)item)->color);
+          item += sizeof(parametersCanvasBackground_t);
+          break;
+        case CANVAS_ADD_TEXT:
+          Canvas.AddText(((parametersCanvasText_t *)item)->x, ((parametersCanvasText_t *)item)->y, ((parametersCanvasText_t *)item)->color, item + sizeof(parametersCanvasText_t), ((parametersCanvasText_t *)item)->maxWidth);
+          item += sizeof(parametersCanvasText_t) + ((parametersCanvasText_t *)item)->stringLength;
+          break;
+
+        case CANVAS_ADD_IMAGE:
+          MarlinImage image;
+          uint16_t *colors;
+          colorMode_t color_mode;
+
+          image = ((parametersCanvasImage_t *)item)->image;
+          colors = (uint16_t *)(item + sizeof(parametersCanvasImage_t));
+          Canvas.AddImage(((parametersCanvasImage_t *)item)->x, ((parametersCanvasImage_t *)item)->y, image, colors);
+
+          item = (uint8_t *)colors;
+          color_mode = Images[image].colorMode;
+
+          switch (color_mode) {
+            case GREYSCALE1:
+              item += sizeof(uint16_t);
+              break;
+            case GREYSCALE2:
+              item += sizeof(uint16_t) * 3;
+              break;
+            case GREYSCALE4:
+              item += sizeof(uint16_t) * 15;
+              break;
+            default:
+              break;
+          }
+          break;
+
+        case CANVAS_ADD_BAR:
+          Canvas.AddBar(((parametersCanvasBar_t *)item)->x, ((parametersCanvasBar_t *)item)->y, ((parametersCanvasBar_t *)item)->width, ((parametersCanvasBar_t *)item)->height, ((parametersCanvasBar_t *)item)->color);
+          item += sizeof(parametersCanvasBar_t);
+          break;
+        case CANVAS_ADD_RECTANGLE:
+          Canvas.AddRectangle(((parametersCanvasRectangle_t *)item)->x, ((parametersCanvasRectangle_t *)item)->y, ((parametersCanvasRectangle_t *)item)->width, ((parametersCanvasRectangle_t *)item)->height, ((parametersCanvasRectangle_t *)item)->color);
+          item += sizeof(parametersCanvasRectangle_t);
+          break;
+      }
     }
   }
 
-  if (Canvas.ToScreen()) task->state = TASK_STATE_COMPLETED;
+  // Send the stripe once the previous one is out
+  if (tft.is_busy()) return;
+  task->state = Canvas.ToScreen() ? TASK_STATE_COMPLETED : TASK_STATE_IN_PROGRESS;
 }
 
+#if ENABLED(TFT_CANVAS_CACHE)
+
+  /**
+   * Check a finished canvas against the one last drawn in the same region.
+   * The display list (position, size, and all items) fully determines the
+   * pixels, so an identical hash means the screen already shows this canvas.
+   * Otherwise remember the new canvas and forget any regions it overlaps.
+   */
+  bool TFT_Queue::unchanged(parametersCanvas_t *canvas) {
+    const uint32_t hash = fnv1a(canvas, end_of_queue - (uint8_t *)canvas);
+
+    LOOP_L_N(i, TFT_CANVAS_CACHE_SIZE) {
+      const canvasCache_t &entry = cache[i];
+      if (entry.hash == hash && entry.width == canvas->width && entry.height == canvas->height && entry.x == canvas->x && entry.y == canvas->y)
+        return true;
+    }
+
+    invalidate(canvas->x, canvas->y, canvas->width, canvas->height);
+
+    // Use a free entry, or replace the oldest one
+    canvasCache_t *entry = &cache[cache_next];
+    LOOP_L_N(i, TFT_CANVAS_CACHE_SIZE) if (!cache[i].width) { entry = &cache[i]; break; }
+    if (entry == &cache[cache_next]) cache_next = (cache_next + 1) % (TFT_CANVAS_CACHE_SIZE);
+
+    entry->x = canvas->x;
+    entry->y = canvas->y;
+    entry->width = canvas->width;
+    entry->height = canvas->height;
+    entry->hash = hash;
+    return false;
+  }
+
+  // Forget all remembered regions that overlap the given rectangle
+  void TFT_Queue::invalidate(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+    LOOP_L_N(i, TFT_CANVAS_CACHE_SIZE) {
+      canvasCache_t &entry = cache[i];
+      if (entry.width && x < entry.x + entry.width && entry.x < x + width && y < entry.y + entry.height && entry.y < y + height)
+        entry.width = 0;
+    }
+  }
+
+#endif // TFT_CANVAS_CACHE
+
 
 void TFT_Queue::fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
   finish_sketch();
+  TERN_(TFT_CANVAS_CACHE, invalidate(x, y, width, height));
 
   queueTask_t *task = (queueTask_t *)end_of_queue;
   last_task = (uint8_t *)task;
@@ -231,6 +330,7 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, uint8_t *string
   parameters->x = x;
   parameters->y = y;
   parameters->color = color;
+  parameters->count = 0;
   parameters->stringLength = 0;
   parameters->maxWidth = maxWidth;
 
@@ -257,7 +357,7 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
 
   colorMode_t color_mode = Images[image].colorMode;
 
-  if (color_mode == HIGHCOLOR) return;
+  if (color_mode == HIGHCOLOR || color_mode == RLE16) return;
 
   uint16_t *color = (uint16_t *)end_of_queue;
   uint8_t number_of_color = 0;
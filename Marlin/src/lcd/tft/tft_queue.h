@@ -37,6 +37,7 @@ enum QueueTaskState : uint8_t {
   TASK_STATE_READY = 0x00,
   TASK_STATE_IN_PROGRESS,
   TASK_STATE_COMPLETED,
+  TASK_STATE_RENDERED,      // Canvas stripe rendered, waiting to be sent
   TASK_STATE_SKETCH = 0xFF,
 };
 
@@ -111,6 +112,17 @@ typedef struct __attribute__((__packed__)) {
   uint16_t color;
 } parametersCanvasRectangle_t;
 
+#if ENABLED(TFT_CANVAS_CACHE)
+  // A screen region and a hash of the canvas last drawn there
+  typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;   // 0 = unused
+    uint16_t height;
+    uint32_t hash;
+  } canvasCache_t;
+#endif
+
 class TFT_Queue {
   private:
     static uint8_t queue[QUEUE_SIZE];
@@ -122,11 +134,27 @@ class TFT_Queue {
     static void fill(queueTask_t *task);
     static void canvas(queueTask_t *task);
 
+    #if ENABLED(TFT_CANVAS_CACHE)
+      static canvasCache_t cache[TFT_CANVAS_CACHE_SIZE];
+      static uint8_t cache_next;
+      static bool unchanged(parametersCanvas_t *canvas);
+      static void invalidate(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+    #endif
+
+    #if ENABLED(TFT_PIXEL_STATS)
+      static uint32_t pixels, pixel_rate;
+      static millis_t next_stats_ms;
+    #endif
+
   public:
     static void reset();
     static void async();
     static void sync() { while (current_task != NULL) async(); }
 
+    #if ENABLED(TFT_PIXEL_STATS)
+      static uint32_t pixels_per_second() { return pixel_rate; }
+    #endif
+
     static void fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color);
     static void canvas(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
     static void set_background(uint16_t color);
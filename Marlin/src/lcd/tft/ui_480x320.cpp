@@ -96,6 +96,13 @@ void MarlinUI::clear_lcd() {
   #define BOOTSCREEN_TIMEOUT 5000
 
   void MarlinUI::show_bootscreen() {
+    #if ENABLED(DEFERRED_INIT)
+      // Called again when the bootscreen times out
+      static bool shown; // = false
+      if (shown) return clear_lcd();
+      shown = true;
+    #endif
+
     tft.queue.reset();
 
     tft.canvas(0, 0, TFT_WIDTH, TFT_HEIGHT);
@@ -107,8 +114,10 @@ void MarlinUI::clear_lcd() {
     #endif
 
     tft.queue.sync();
-    safe_delay(BOOTSCREEN_TIMEOUT);
-    clear_lcd();
+    bootscreen_completion(BOOTSCREEN_TIMEOUT);
+    #if DISABLED(DEFERRED_INIT)
+      clear_lcd();
+    #endif
   }
 #endif // SHOW_BOOTSCREEN
 
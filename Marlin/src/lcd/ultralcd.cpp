@@ -169,6 +169,10 @@ millis_t MarlinUI::next_button_update_ms; // = 0
 
 #if HAS_GRAPHICAL_LCD
   bool MarlinUI::drawing_screen, MarlinUI::first_page; // = false
+  #if ENABLED(DOGM_PAGE_BUDGET)
+    uint8_t MarlinUI::page_count; // = 0
+    uint32_t MarlinUI::page_time_us, MarlinUI::max_page_time_us; // = 0
+  #endif
 #endif
 
 // Encoder Handling
@@ -798,6 +802,27 @@ void MarlinUI::quick_feedback(const bool clear_buttons/*=true*/) {
 
 LCDViewAction MarlinUI::lcdDrawUpdate = LCDVIEW_CLEAR_CALL_REDRAW;
 millis_t next_lcd_update_ms;
+
+#if ENABLED(SHOW_BOOTSCREEN)
+
+  #if ENABLED(DEFERRED_INIT)
+
+    millis_t MarlinUI::bootscreen_ms; // = 0
+
+    /**
+     * Keep the bootscreen part up for 'ms' without blocking. When it times out
+     * update() calls show_bootscreen() again to draw the next part. A call that
+     * draws nothing more ends the bootscreen.
+     */
+    void MarlinUI::bootscreen_completion(const millis_t ms) { bootscreen_ms = millis() + ms; }
+
+  #else
+
+    void MarlinUI::bootscreen_completion(const millis_t ms) { safe_delay(ms); }
+
+  #endif
+
+#endif
 #if HAS_LCD_MENU && LCD_TIMEOUT_TO_STATUS
   millis_t MarlinUI::return_to_status_ms = 0;
 #endif
@@ -807,6 +832,17 @@ void MarlinUI::update() {
   static uint16_t max_display_update_time = 0;
   millis_t ms = millis();
 
+  #if BOTH(SHOW_BOOTSCREEN, DEFERRED_INIT)
+    // Leave the bootscreen up until it times out, then draw the next part or the status screen
+    if (bootscreen_ms) {
+      if (PENDING(ms, bootscreen_ms)) return;
+      bootscreen_ms = 0;
+      show_bootscreen();
+      if (bootscreen_ms) return;
+      refresh(LCDVIEW_CLEAR_CALL_REDRAW);
+    }
+  #endif
+
   #if HAS_LCD_MENU && LCD_TIMEOUT_TO_STATUS > 0
     #define RESET_STATUS_TIMEOUT() (return_to_status_ms = ms + LCD_TIMEOUT_TO_STATUS)
   #else
@@ -992,10 +1028,25 @@ void MarlinUI::update() {
       }
     #endif
 
-    // Then we want to use only 50% of the time
-    const uint16_t bbr2 = planner.block_buffer_runtime() >> 1;
+    #if ENABLED(DOGM_PAGE_BUDGET)
+      // Hold back pages while only a few moves are planned, but not for too long
+      static millis_t defer_pages_ms; // = 0
+      auto can_draw = [&]{
+        const uint8_t planned = planner.movesplanned();
+        if (planned && planned < DOGM_PAGE_MIN_PLANNED) {
+          if (!defer_pages_ms) defer_pages_ms = ms + DOGM_PAGE_MAX_DEFER;
+          if (PENDING(ms, defer_pages_ms)) return false;
+        }
+        defer_pages_ms = 0;
+        return true;
+      };
+    #else
+      // Then we want to use only 50% of the time
+      const uint16_t bbr2 = planner.block_buffer_runtime() >> 1;
+      auto can_draw = [&]{ return !bbr2 || bbr2 > max_display_update_time; };
+    #endif
 
-    if ((should_draw() || drawing_screen) && (!bbr2 || bbr2 > max_display_update_time)) {
+    if ((should_draw() || drawing_screen) && can_draw()) {
 
       // Change state of drawing flag between screen updates
       if (!drawing_screen) switch (lcdDrawUpdate) {
@@ -1027,20 +1078,51 @@ void MarlinUI::update() {
           if (!drawing_screen) {                // If not already drawing pages
             u8g.firstPage();                    // Start the first page
             drawing_screen = first_page = true; // Flag as drawing pages
+            TERN_(DOGM_PAGE_BUDGET, page_count = max_page_time_us = 0);
           }
-          set_font(FONT_MENU);                  // Setup font for every page draw
-          u8g.setColorIndex(1);                 // And reset the color
-          run_current_screen();                 // Draw and process the current screen
-          first_page = false;
-
-          // The screen handler can clear drawing_screen for an action that changes the screen.
-          // If still drawing and there's another page, update max-time and return now.
-          // The nextPage will already be set up on the next call.
-          if (drawing_screen && (drawing_screen = u8g.nextPage())) {
-            if (on_status_screen())
-              NOLESS(max_display_update_time, millis() - ms);
-            return;
-          }
+
+          auto draw_page = [&]{
+            set_font(FONT_MENU);                // Setup font for every page draw
+            u8g.setColorIndex(1);               // And reset the color
+            run_current_screen();               // Draw and process the current screen
+            first_page = false;
+
+            // The screen handler can clear drawing_screen for an action that changes the screen.
+            return drawing_screen && (drawing_screen = u8g.nextPage());
+          };
+
+          #if ENABLED(DOGM_PAGE_BUDGET)
+
+            // Draw pages while the next one should still fit in the budget
+            const uint32_t start_us = micros();
+            bool more_pages;
+            do {
+              const uint32_t page_start_us = micros();
+              more_pages = draw_page();
+              page_time_us = micros() - page_start_us;
+              NOLESS(max_page_time_us, page_time_us);
+              page_count++;
+            } while (more_pages && micros() - start_us + page_time_us <= DOGM_PAGE_BUDGET_US);
+
+            // The nextPage will already be set up on the next call.
+            if (more_pages) return;
+
+            if (DEBUGGING(INFO)) {
+              SERIAL_ECHO_START();
+              SERIAL_ECHOLNPAIR("LCD pages: ", int(page_count), " Slowest (us): ", max_page_time_us);
+            }
+
+          #else
+
+            // If still drawing and there's another page, update max-time and return now.
+            // The nextPage will already be set up on the next call.
+            if (draw_page()) {
+              if (on_status_screen())
+                NOLESS(max_display_update_time, millis() - ms);
+              return;
+            }
+
+          #endif
         }
 
       #else
@@ -1348,7 +1430,7 @@ void MarlinUI::update() {
       status_scroll_offset = 0;
     #endif
 
-    TERN_(EXTENSIBLE_UI, ExtUI::onStatusChanged(status_message));
+    TERN_(EXTENSIBLE_UI, ExtUI::postStatusChanged(status_message));
   }
 
   bool MarlinUI::has_status() { return (status_message[0] != '\0'); }
@@ -399,12 +399,22 @@ public:
         static void draw_marlin_bootscreen(const bool line2=false);
         static void show_marlin_bootscreen();
         static void show_bootscreen();
+        static void bootscreen_completion(const millis_t ms);
+        #if ENABLED(DEFERRED_INIT)
+          static millis_t bootscreen_ms;  // When the shown bootscreen part times out, 0 once it's gone
+        #endif
       #endif
 
       #if HAS_GRAPHICAL_LCD
 
         static bool drawing_screen, first_page;
 
+        #if ENABLED(DOGM_PAGE_BUDGET)
+          // Pages drawn for the last screen, and the last and slowest page times
+          static uint8_t page_count;
+          static uint32_t page_time_us, max_page_time_us;
+        #endif
+
         static void set_font(const MarlinFont font_nr);
 
       #else
@@ -0,0 +1,41 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * hash.h - FNV-1a hash
+ *
+ * A small, fast 32-bit hash to recognize data seen before, such as display
+ * content that was already sent. Not meant for detecting transfer errors.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define FNV1A_INIT 2166136261UL
+
+// Hash len bytes, or continue an earlier hash over more bytes
+inline uint32_t fnv1a(const void * const data, const size_t len, uint32_t hash=FNV1A_INIT) {
+  const uint8_t *p = (const uint8_t *)data;
+  for (size_t i = 0; i < len; i++) hash = (hash ^ p[i]) * 16777619UL;
+  return hash;
+}
@@ -0,0 +1,104 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * stats.h - Single-pass sample statistics
+ *
+ * RunningStats keeps the count, mean, variance (Welford's method), minimum
+ * and maximum of a stream of samples without storing them. Results are
+ * valid after every sample, so callers can report them incrementally.
+ *
+ * OutlierFilter<N, TRIM> collects up to N samples in sorted order and
+ * returns the mean after dropping the TRIM samples farthest from the median.
+ * A median-based rejection needs every sample, so N should stay small.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class RunningStats {
+  public:
+    RunningStats() { reset(); }
+
+    void reset() { n = 0; avg = m2 = 0; lo = 99999.9f; hi = -99999.9f; }
+
+    void add(const float &v) {
+      n++;
+      const float d = v - avg;
+      avg += d / n;
+      m2 += d * (v - avg);
+      NOMORE(lo, v);
+      NOLESS(hi, v);
+    }
+
+    uint16_t count()  const { return n; }
+    float mean()      const { return avg; }
+    float lowest()    const { return lo; }
+    float highest()   const { return hi; }
+    float range()     const { return hi - lo; }
+
+    // Population variance and standard deviation
+    float variance()  const { return n ? m2 / n : 0; }
+    float sigma()     const { return SQRT(variance()); }
+
+  private:
+    uint16_t n;
+    float avg, m2, lo, hi;
+};
+
+template<uint8_t N, uint8_t TRIM>
+class OutlierFilter {
+  static_assert(TRIM < N, "OutlierFilter TRIM must be less than N.");
+
+  public:
+    OutlierFilter() : n(0) {}
+
+    uint8_t count() const { return n; }
+
+    // Insert a sample, keeping the set sorted ascending
+    void add(const float &v) {
+      if (n >= N) return;
+      uint8_t i = n++;
+      for (; i && s[i - 1] > v; --i) s[i] = s[i - 1];
+      s[i] = v;
+    }
+
+    float median() const {
+      const uint8_t h = (n - 1) / 2;
+      return (n & 1) ? s[h] : (s[h] + s[h + 1]) * 0.5f;
+    }
+
+    // Mean of the samples left after removing the TRIM farthest from the median
+    float trimmed_mean() const {
+      const float med = median();
+      uint8_t lo = 0, hi = n - 1;
+      for (uint8_t i = _MIN(TRIM, n - 1); i--;)
+        if (ABS(s[hi] - med) > ABS(s[lo] - med)) hi--; else lo++;
+      float sum = 0;
+      LOOP_S_LE_N(i, lo, hi) sum += s[i];
+      return sum / (hi - lo + 1);
+    }
+
+  private:
+    uint8_t n;
+    float s[N];
+};
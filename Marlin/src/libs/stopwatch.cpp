@@ -37,7 +37,7 @@ bool Stopwatch::stop() {
   Stopwatch::debug(PSTR("stop"));
 
   if (isRunning() || isPaused()) {
-    TERN_(EXTENSIBLE_UI, ExtUI::onPrintTimerStopped());
+    TERN_(EXTENSIBLE_UI, ExtUI::postPrintTimerStopped());
     state = STOPPED;
     stopTimestamp = millis();
     return true;
@@ -49,7 +49,7 @@ bool Stopwatch::pause() {
   Stopwatch::debug(PSTR("pause"));
 
   if (isRunning()) {
-    TERN_(EXTENSIBLE_UI, ExtUI::onPrintTimerPaused());
+    TERN_(EXTENSIBLE_UI, ExtUI::postPrintTimerPaused());
     state = PAUSED;
     stopTimestamp = millis();
     return true;
@@ -60,7 +60,7 @@ bool Stopwatch::pause() {
 bool Stopwatch::start() {
   Stopwatch::debug(PSTR("start"));
 
-  TERN_(EXTENSIBLE_UI, ExtUI::onPrintTimerStarted());
+  TERN_(EXTENSIBLE_UI, ExtUI::postPrintTimerStarted());
 
   if (!isRunning()) {
     if (isPaused()) accumulator = duration();
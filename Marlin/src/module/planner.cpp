@@ -766,6 +766,27 @@ block_t* Planner::get_current_block() {
   return nullptr;
 }
 
+#if ENABLED(MPCTEMP)
+
+  float Planner::busy_block_e_rate(const uint8_t hotend) {
+    // The tail block is busy once the Stepper has taken it
+    const uint8_t busy = block_buffer_tail;
+    if (busy == block_buffer_nonbusy) return 0;
+
+    const block_t * const block = &block_buffer[busy];
+    if (TERN0(HAS_MULTI_HOTEND, block->extruder != hotend)
+      || !block->steps.e
+      || TEST(block->direction_bits, E_AXIS)      // Retraction
+      || TEST(block->flag, BLOCK_BIT_SYNC_POSITION)
+      || block->millimeters <= 0
+    ) return 0;
+
+    const float e_mm = block->steps.e * steps_to_mm[E_AXIS_N(block->extruder)];
+    return SQRT(block->nominal_speed_sqr) * e_mm / block->millimeters;
+  }
+
+#endif
+
 /**
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
  * by the provided factors.
@@ -862,6 +862,15 @@ class Planner {
      */
     static block_t* get_current_block();
 
+    #if ENABLED(MPCTEMP)
+      /**
+       * Nominal extrusion rate (mm/s) of the block being executed,
+       * or 0 if that block doesn't extrude through the given hotend.
+       * Used to feed forward the heat taken up by the filament.
+       */
+      static float busy_block_e_rate(const uint8_t hotend);
+    #endif
+
     /**
      * "Release" the current block so its slot can be reused.
      * Called when the current block is no longer needed.
@@ -31,6 +31,7 @@
 #include "probe.h"
 
 #include "../libs/buzzer.h"
+#include "../libs/stats.h"
 #include "motion.h"
 #include "temperature.h"
 #include "endstops.h"
@@ -547,11 +548,12 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
   #endif
 
   #if EXTRA_PROBING > 0
-    float probes[TOTAL_PROBING];
+    OutlierFilter<TOTAL_PROBING, EXTRA_PROBING> probes;
+  #elif TOTAL_PROBING > 2
+    RunningStats probes;
   #endif
 
   #if TOTAL_PROBING > 2
-    float probes_z_sum = 0;
     for (
       #if EXTRA_PROBING > 0
         uint8_t p = 0; p < TOTAL_PROBING; p++
@@ -569,53 +571,31 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 
       const float z = current_position.z;
 
-      #if EXTRA_PROBING > 0
-        // Insert Z measurement into probes[]. Keep it sorted ascending.
-        LOOP_LE_N(i, p) {                            // Iterate the saved Zs to insert the new Z
-          if (i == p || probes[i] > z) {                              // Last index or new Z is smaller than this Z
-            for (int8_t m = p; --m >= i;) probes[m + 1] = probes[m];  // Shift items down after the insertion point
-            probes[i] = z;                                            // Insert the new Z measurement
-            break;                                                    // Only one to insert. Done!
-          }
-        }
-      #elif TOTAL_PROBING > 2
-        probes_z_sum += z;
-      #else
-        UNUSED(z);
-      #endif
-
       #if TOTAL_PROBING > 2
+        probes.add(z);
+
         // Small Z raise after all but the last probe
         if (p
           #if EXTRA_PROBING > 0
             < TOTAL_PROBING - 1
           #endif
         ) do_blocking_move_to_z(z + Z_CLEARANCE_MULTI_PROBE, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+      #else
+        UNUSED(z);
       #endif
     }
 
   #if TOTAL_PROBING > 2
 
     #if EXTRA_PROBING > 0
-      // Take the center value (or average the two middle values) as the median
-      static constexpr int PHALF = (TOTAL_PROBING - 1) / 2;
-      const float middle = probes[PHALF],
-                  median = ((TOTAL_PROBING) & 1) ? middle : (middle + probes[PHALF + 1]) * 0.5f;
-
-      // Remove values farthest from the median
-      uint8_t min_avg_idx = 0, max_avg_idx = TOTAL_PROBING - 1;
-      for (uint8_t i = EXTRA_PROBING; i--;)
-        if (ABS(probes[max_avg_idx] - median) > ABS(probes[min_avg_idx] - median))
-          max_avg_idx--; else min_avg_idx++;
-
-      // Return the average value of all remaining probes.
-      LOOP_S_LE_N(i, min_avg_idx, max_avg_idx)
-        probes_z_sum += probes[i];
-
+      // Average the remaining probes after dropping those farthest from the median
+      const float measured_z = probes.trimmed_mean();
+    #else
+      // Return the average value of all probes
+      const float measured_z = probes.mean();
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("Probe Z Sigma:", probes.sigma(), " Range:", probes.range());
     #endif
 
-    const float measured_z = probes_z_sum * RECIPROCAL(MULTIPLE_PROBING);
-
   #elif TOTAL_PROBING == 2
 
     const float z2 = current_position.z;
@@ -691,8 +671,17 @@ float Probe::probe_at_point(const float &rx, const float &ry, const ProbePtRaise
   if (!deploy()) measured_z = run_z_probe(sanity_check) + offset.z;
   if (!isnan(measured_z)) {
     const bool big_raise = raise_after == PROBE_PT_BIG_RAISE;
-    if (big_raise || raise_after == PROBE_PT_RAISE)
-      do_blocking_move_to_z(current_position.z + (big_raise ? 25 : Z_CLEARANCE_BETWEEN_PROBES), MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    if (big_raise || raise_after == PROBE_PT_RAISE) {
+      const float z_raise = big_raise ? 25 : TERN(PROBE_TRAVEL_SHORT_RAISE, Z_CLEARANCE_MULTI_PROBE, Z_CLEARANCE_BETWEEN_PROBES);
+      #if ENABLED(PROBE_TRAVEL_OVERLAP)
+        // Queue the raise without waiting. The caller processes the result while Z moves
+        // and the next travel move is queued right behind the raise.
+        current_position.z += z_raise;
+        line_to_current_position(MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+      #else
+        do_blocking_move_to_z(current_position.z + z_raise, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+      #endif
+    }
     else if (raise_after == PROBE_PT_STOW)
       if (stow()) measured_z = NAN;   // Error on stow?
 
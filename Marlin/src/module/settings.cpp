@@ -310,6 +310,13 @@ typedef struct SettingsDataStruct {
   //
   PID_t bedPID;                                         // M304 PID / M303 E-1 U
 
+  //
+  // MPCTEMP
+  //
+  #if ENABLED(MPCTEMP)
+    MPC_t mpc_constants[HOTENDS];                       // M306 / M306 T
+  #endif
+
   //
   // User-defined Thermistors
   //
@@ -457,6 +464,11 @@ void MarlinSettings::postprocess() {
 
   TERN_(PIDTEMP, thermalManager.updatePID());
 
+  // Loaded user thermistors need their derived values (and lookup tables) refreshed
+  #if HAS_USER_THERMISTORS
+    LOOP_L_N(i, USER_THERMISTORS) thermalManager.user_thermistor[i].pre_calc = true;
+  #endif
+
   #if DISABLED(NO_VOLUMETRICS)
     planner.calculate_volumetric_multipliers();
   #elif EXTRUDERS
@@ -897,6 +909,16 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(bed_pid);
     }
 
+    //
+    // MPCTEMP
+    //
+    #if ENABLED(MPCTEMP)
+    {
+      _FIELD_TEST(mpc_constants);
+      HOTEND_LOOP() EEPROM_WRITE(thermalManager.temp_hotend[e].constants);
+    }
+    #endif
+
     //
     // User-defined Thermistors
     //
@@ -1776,6 +1798,20 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      //
+      // Hotend Model Predictive Control
+      //
+      #if ENABLED(MPCTEMP)
+      {
+        _FIELD_TEST(mpc_constants);
+        HOTEND_LOOP() {
+          MPC_t mpc;
+          EEPROM_READ(mpc);
+          if (!validating) thermalManager.temp_hotend[e].constants = mpc;
+        }
+      }
+      #endif
+
       //
       // User-defined Thermistors
       //
@@ -2727,6 +2763,34 @@ void MarlinSettings::reset() {
     thermalManager.temp_bed.pid.Kd = scalePID_d(DEFAULT_bedKd);
   #endif
 
+  //
+  // Hotend Model Predictive Control
+  //
+
+  #if ENABLED(MPCTEMP)
+    constexpr float mpc_heater_power[] = MPC_HEATER_POWER,
+                    mpc_block_heat_capacity[] = MPC_BLOCK_HEAT_CAPACITY,
+                    mpc_sensor_responsiveness[] = MPC_SENSOR_RESPONSIVENESS,
+                    mpc_ambient_xfer_coeff[] = MPC_AMBIENT_XFER_COEFF,
+                    mpc_ambient_xfer_coeff_fan255[] = MPC_AMBIENT_XFER_COEFF_FAN255,
+                    filament_heat_capacity_permm[] = FILAMENT_HEAT_CAPACITY_PERMM;
+    static_assert(WITHIN(COUNT(mpc_heater_power), 1, HOTENDS), "MPC_HEATER_POWER must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(mpc_block_heat_capacity), 1, HOTENDS), "MPC_BLOCK_HEAT_CAPACITY must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(mpc_sensor_responsiveness), 1, HOTENDS), "MPC_SENSOR_RESPONSIVENESS must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(mpc_ambient_xfer_coeff), 1, HOTENDS), "MPC_AMBIENT_XFER_COEFF must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(mpc_ambient_xfer_coeff_fan255), 1, HOTENDS), "MPC_AMBIENT_XFER_COEFF_FAN255 must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(filament_heat_capacity_permm), 1, HOTENDS), "FILAMENT_HEAT_CAPACITY_PERMM must have between 1 and HOTENDS items.");
+    HOTEND_LOOP() {
+      MPC_t &constants = thermalManager.temp_hotend[e].constants;
+      constants.heater_power                  = mpc_heater_power[ALIM(e, mpc_heater_power)];
+      constants.block_heat_capacity           = mpc_block_heat_capacity[ALIM(e, mpc_block_heat_capacity)];
+      constants.sensor_responsiveness         = mpc_sensor_responsiveness[ALIM(e, mpc_sensor_responsiveness)];
+      constants.ambient_xfer_coeff_fan0       = mpc_ambient_xfer_coeff[ALIM(e, mpc_ambient_xfer_coeff)];
+      constants.ambient_xfer_coeff_fan255     = mpc_ambient_xfer_coeff_fan255[ALIM(e, mpc_ambient_xfer_coeff_fan255)];
+      constants.filament_heat_capacity_permm  = filament_heat_capacity_permm[ALIM(e, filament_heat_capacity_permm)];
+    }
+  #endif
+
   //
   // User-Defined Thermistors
   //
@@ -3297,6 +3361,21 @@ void MarlinSettings::reset() {
 
     #endif // PIDTEMP || PIDTEMPBED
 
+    #if ENABLED(MPCTEMP)
+      CONFIG_ECHO_HEADING("Model predictive control:");
+      HOTEND_LOOP() {
+        const MPC_t &constants = thermalManager.temp_hotend[e].constants;
+        CONFIG_ECHO_START();
+        SERIAL_ECHOPAIR("  M306 E", e);
+        SERIAL_ECHOPAIR_F(" P", constants.heater_power, 2);
+        SERIAL_ECHOPAIR_F(" C", constants.block_heat_capacity, 2);
+        SERIAL_ECHOPAIR_F(" R", constants.sensor_responsiveness, 4);
+        SERIAL_ECHOPAIR_F(" A", constants.ambient_xfer_coeff_fan0, 4);
+        SERIAL_ECHOPAIR_F(" F", constants.ambient_xfer_coeff_fan255, 4);
+        SERIAL_ECHOLNPAIR_F(" H", constants.filament_heat_capacity_permm, 4);
+      }
+    #endif
+
     #if HAS_USER_THERMISTORS
       CONFIG_ECHO_HEADING("User thermistors:");
       LOOP_L_N(i, USER_THERMISTORS)
@@ -123,6 +123,18 @@
   #endif
 #endif
 
+#if ENABLED(THERMISTOR_LUT)
+  #if HOTEND_USES_THERMISTOR
+    static ThermistorLUT hotend_lut[HOTENDS];
+    #define _HOTEND_LUT_BIT(N) TERN0(HEATER_##N##_USES_THERMISTOR, _BV(N)) |
+    static constexpr uint8_t hotend_lut_mask = REPEAT(HOTENDS, _HOTEND_LUT_BIT) 0;
+  #endif
+  TERN_(HEATER_BED_USES_THERMISTOR, static ThermistorLUT bed_lut);
+  TERN_(HEATER_CHAMBER_USES_THERMISTOR, static ThermistorLUT chamber_lut);
+  TERN_(PROBE_USES_THERMISTOR, static ThermistorLUT probe_lut);
+  static bool thermistor_luts_valid; // = false
+#endif
+
 Temperature thermalManager;
 
 const char str_t_thermal_runaway[] PROGMEM = STR_T_THERMAL_RUNAWAY,
@@ -429,7 +441,7 @@ volatile bool Temperature::raw_temps_ready = false;
 
     if (target > GHV(BED_MAX_TARGET, temp_range[heater].maxtemp - HOTEND_OVERSHOOT)) {
       SERIAL_ECHOLNPGM(STR_PID_TEMP_TOO_HIGH);
-      TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_TEMP_TOO_HIGH));
+      TERN_(EXTENSIBLE_UI, ExtUI::postPidTuning(ExtUI::result_t::PID_TEMP_TOO_HIGH));
       return;
     }
 
@@ -542,7 +554,7 @@ volatile bool Temperature::raw_temps_ready = false;
       #endif
       if (current_temp > target + MAX_OVERSHOOT_PID_AUTOTUNE) {
         SERIAL_ECHOLNPGM(STR_PID_TEMP_TOO_HIGH);
-        TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_TEMP_TOO_HIGH));
+        TERN_(EXTENSIBLE_UI, ExtUI::postPidTuning(ExtUI::result_t::PID_TEMP_TOO_HIGH));
         break;
       }
 
@@ -578,7 +590,7 @@ volatile bool Temperature::raw_temps_ready = false;
       #endif
       if ((ms - _MIN(t1, t2)) > (MAX_CYCLE_TIME_PID_AUTOTUNE * 60L * 1000L)) {
         TERN_(DWIN_CREALITY_LCD, Popup_Window_Temperature(0));
-        TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_TUNING_TIMEOUT));
+        TERN_(EXTENSIBLE_UI, ExtUI::postPidTuning(ExtUI::result_t::PID_TUNING_TIMEOUT));
         SERIAL_ECHOLNPGM(STR_PID_TIMEOUT);
         break;
       }
@@ -626,7 +638,7 @@ volatile bool Temperature::raw_temps_ready = false;
 
         TERN_(PRINTER_EVENT_LEDS, printerEventLEDs.onPidTuningDone(color));
 
-        TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_DONE));
+        TERN_(EXTENSIBLE_UI, ExtUI::postPidTuning(ExtUI::result_t::PID_DONE));
 
         goto EXIT_M303;
       }
@@ -637,7 +649,7 @@ volatile bool Temperature::raw_temps_ready = false;
 
     TERN_(PRINTER_EVENT_LEDS, printerEventLEDs.onPidTuningDone(color));
 
-    TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_DONE));
+    TERN_(EXTENSIBLE_UI, ExtUI::postPidTuning(ExtUI::result_t::PID_DONE));
 
     EXIT_M303:
       TERN_(NO_FAN_SLOWING_IN_PID_TUNING, adaptive_fan_slowing = true);
@@ -646,6 +658,204 @@ volatile bool Temperature::raw_temps_ready = false;
 
 #endif // HAS_PID_HEATING
 
+#if BOTH(MPCTEMP, MPC_AUTOTUNE)
+
+  /**
+   * Identify the hotend model from a single heat-up:
+   *  - Cool to ambient with the fan on full, to measure the ambient temperature.
+   *  - Heat past 200°C at full power. A first-order response fitted to three
+   *    equally spaced samples gives the block heat capacity and sensor lag.
+   *  - Hold at 200°C under MPC and take the average power, with and without
+   *    the fan, as the heat loss to ambient.
+   */
+  void Temperature::MPC_autotune(const uint8_t E_NAME) {
+    const uint8_t ee = HOTEND_INDEX;
+    MPCHeaterInfo &hotend = temp_hotend[ee];
+    MPC_t &constants = hotend.constants;
+
+    #if HAS_FAN
+      const uint8_t fan_index = TERN(HAS_MULTI_HOTEND, _MIN(ee, FAN_COUNT - 1), 0);
+      #define MPC_SET_FAN(S) do{ fan_speed[fan_index] = S; planner.check_axes_activity(); }while(0)
+    #else
+      #define MPC_SET_FAN(S) NOOP
+    #endif
+
+    #ifndef MAX_OVERSHOOT_MPC_AUTOTUNE
+      #define MAX_OVERSHOOT_MPC_AUTOTUNE 30
+    #endif
+    #ifndef MAX_TIME_MPC_AUTOTUNE
+      #define MAX_TIME_MPC_AUTOTUNE 20 // (minutes) Overall limit
+    #endif
+
+    constexpr float tuning_temp = 200;
+    const millis_t start_ms = millis();
+    millis_t next_report_ms = start_ms;
+    float current_temp = 0;
+
+    // Read new samples, report and check limits. Return false to abort.
+    auto housekeeping = [&](const millis_t &ms, bool &sampled) {
+      sampled = raw_temps_ready;
+      if (sampled) {
+        updateTemperaturesFromRawValues();
+        current_temp = hotend.celsius;
+      }
+
+      #if HAS_AUTO_FAN
+        if (ELAPSED(ms, next_auto_fan_check_ms)) {
+          checkExtruderAutoFans();
+          next_auto_fan_check_ms = ms + 2500UL;
+        }
+      #endif
+
+      if (ELAPSED(ms, next_report_ms)) {
+        #if HAS_TEMP_SENSOR
+          print_heater_states(ee);
+          SERIAL_EOL();
+        #endif
+        next_report_ms = ms + 2000UL;
+      }
+
+      TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
+
+      if (current_temp > tuning_temp + MAX_OVERSHOOT_MPC_AUTOTUNE) {
+        SERIAL_ECHOLNPGM(STR_MPC_TEMP_TOO_HIGH);
+        return false;
+      }
+      if (ELAPSED(ms, start_ms + MIN_TO_MS(MAX_TIME_MPC_AUTOTUNE))) {
+        SERIAL_ECHOLNPGM(STR_MPC_TIMEOUT);
+        return false;
+      }
+      if (!wait_for_heatup) {
+        SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_INTERRUPTED);
+        return false;
+      }
+      return true;
+    };
+
+    SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_START);
+
+    disable_all_heaters();
+    TERN_(AUTO_POWER_CONTROL, powerManager.power_on());
+    TERN_(HAS_AUTO_FAN, next_auto_fan_check_ms = start_ms + 2500UL);
+    wait_for_heatup = true; // Can be interrupted with M108
+
+    bool sampled, ok;
+
+    // Cool down with the fan on until the temperature stops falling
+    SERIAL_ECHOLNPGM(STR_MPC_COOLING_TO_AMBIENT);
+    MPC_SET_FAN(255);
+    float ambient_temp = 999;
+    for (millis_t next_test_ms = start_ms + 10000UL; (ok = housekeeping(millis(), sampled));) {
+      if (ELAPSED(millis(), next_test_ms)) {
+        if (current_temp >= ambient_temp) {
+          ambient_temp = (ambient_temp + current_temp) * 0.5f;
+          break;
+        }
+        ambient_temp = current_temp;
+        next_test_ms += 10000UL;
+      }
+    }
+    MPC_SET_FAN(0);
+
+    // Heat at full power, sampling once per interval from 100°C
+    float temp_samples[16], t1_time = 0;
+    uint8_t sample_count = 0;
+    uint16_t sample_distance = 1;
+    const millis_t heat_start_ms = millis();
+    if (ok) {
+      SERIAL_ECHOLNPGM(STR_MPC_HEATING_PAST_200);
+      hotend.target = tuning_temp; // For status reports
+      hotend.soft_pwm_amount = (MPC_MAX) >> 1;
+      for (millis_t next_test_ms = heat_start_ms; (ok = housekeeping(millis(), sampled));) {
+        const millis_t ms = millis();
+        if (!ELAPSED(ms, next_test_ms)) continue;
+        if (current_temp >= 100) {
+          // Out of room? Keep every other sample and double the interval.
+          if (sample_count == COUNT(temp_samples)) {
+            LOOP_L_N(i, COUNT(temp_samples) / 2) temp_samples[i] = temp_samples[i * 2];
+            sample_count /= 2;
+            sample_distance *= 2;
+          }
+          if (sample_count == 0) t1_time = (ms - heat_start_ms) * 0.001f;
+          temp_samples[sample_count++] = current_temp;
+        }
+        if (current_temp >= tuning_temp) break;
+        next_test_ms += SEC_TO_MS(sample_distance);
+      }
+      hotend.soft_pwm_amount = 0;
+      if (ok && sample_count < 3) ok = false;
+    }
+
+    if (ok) {
+      // Fit T(t) = asymp - (asymp - ambient) * exp(-responsiveness * t) through three equally spaced samples
+      sample_count = (sample_count + 1) / 2 * 2 - 1;
+      const float t1 = temp_samples[0],
+                  t2 = temp_samples[(sample_count - 1) >> 1],
+                  t3 = temp_samples[sample_count - 1],
+                  asymp_temp = (t2 * t2 - t1 * t3) / (2 * t2 - t1 - t3),
+                  block_responsiveness = -logf((t2 - asymp_temp) / (t1 - asymp_temp)) / (sample_distance * (sample_count >> 1));
+
+      constants.ambient_xfer_coeff_fan0 = constants.heater_power * (MPC_MAX) / 255 / (asymp_temp - ambient_temp);
+      constants.ambient_xfer_coeff_fan255 = constants.ambient_xfer_coeff_fan0;
+      constants.block_heat_capacity = constants.ambient_xfer_coeff_fan0 / block_responsiveness;
+      constants.sensor_responsiveness = block_responsiveness / (1 - (ambient_temp - asymp_temp) * expf(-block_responsiveness * t1_time) / (t1 - asymp_temp));
+
+      // Start the model where the fit says the block is now
+      hotend.modeled_ambient_temp = ambient_temp;
+      hotend.modeled_block_temp = asymp_temp + (ambient_temp - asymp_temp) * expf(-block_responsiveness * (millis() - heat_start_ms) * 0.001f);
+      hotend.modeled_sensor_temp = current_temp;
+    }
+
+    // Hold the tuning temperature under MPC, settle for 20s,
+    // then take the average heater power for 20s
+    auto measure_ambient_xfer = [&](float &xfer_coeff) {
+      SERIAL_ECHOLNPAIR(STR_MPC_MEASURING_AMBIENT, tuning_temp);
+      const millis_t measure_ms = millis() + 20000UL, end_ms = measure_ms + 20000UL;
+      float total_energy = 0, total_temp = 0;
+      uint16_t samples = 0;
+      while ((ok = housekeeping(millis(), sampled))) {
+        if (!sampled) continue;
+        hotend.soft_pwm_amount = (int)get_pid_output_hotend(ee) >> 1;
+        const millis_t ms = millis();
+        if (ELAPSED(ms, end_ms)) break;
+        if (ELAPSED(ms, measure_ms)) {
+          total_energy += hotend.soft_pwm_amount * constants.heater_power * (1.0f / 127);
+          total_temp += current_temp;
+          samples++;
+        }
+      }
+      hotend.soft_pwm_amount = 0;
+      if (ok && samples) xfer_coeff = (total_energy / samples) / (total_temp / samples - ambient_temp);
+    };
+
+    if (ok) measure_ambient_xfer(constants.ambient_xfer_coeff_fan0);
+
+    #if HAS_FAN
+      if (ok) {
+        MPC_SET_FAN(255);
+        measure_ambient_xfer(constants.ambient_xfer_coeff_fan255);
+        MPC_SET_FAN(0);
+      }
+    #else
+      constants.ambient_xfer_coeff_fan255 = constants.ambient_xfer_coeff_fan0;
+    #endif
+
+    disable_all_heaters();
+
+    if (ok) {
+      SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_FINISHED);
+      SERIAL_ECHOLNPAIR("MPC_BLOCK_HEAT_CAPACITY ", constants.block_heat_capacity);
+      SERIAL_ECHOLNPAIR_F("MPC_SENSOR_RESPONSIVENESS ", constants.sensor_responsiveness, 4);
+      SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF ", constants.ambient_xfer_coeff_fan0, 4);
+      TERN_(HAS_FAN, SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF_FAN255 ", constants.ambient_xfer_coeff_fan255, 4));
+    }
+
+    // Restart the model from the measured temperature
+    hotend.modeled_block_temp = NAN;
+  }
+
+#endif // MPCTEMP && MPC_AUTOTUNE
+
 /**
  * Class and Instance Methods
  */
@@ -923,6 +1133,66 @@ void Temperature::min_temp_error(const heater_ind_t heater) {
         }
       #endif // PID_DEBUG
 
+    #elif ENABLED(MPCTEMP)
+
+      MPCHeaterInfo &hotend = temp_hotend[ee];
+      const MPC_t &constants = hotend.constants;
+
+      // Start the model from the measured temperature
+      if (isnan(hotend.modeled_block_temp)) {
+        hotend.modeled_ambient_temp = _MIN(30.0f, hotend.celsius);
+        hotend.modeled_sensor_temp = hotend.modeled_block_temp = hotend.celsius;
+      }
+
+      // Heat loss to ambient rises with the part cooling fan speed
+      float ambient_xfer_coeff = constants.ambient_xfer_coeff_fan0;
+      #if HAS_FAN
+        const uint8_t fan_index = TERN(HAS_MULTI_HOTEND, _MIN(ee, FAN_COUNT - 1), 0);
+        ambient_xfer_coeff += (constants.ambient_xfer_coeff_fan255 - constants.ambient_xfer_coeff_fan0) * fan_speed[fan_index] * (1.0f / 255);
+      #endif
+
+      // Heat taken up by filament entering at ambient, from the move being executed
+      const float e_speed = planner.busy_block_e_rate(ee),
+                  filament_xfer_coeff = e_speed * constants.filament_heat_capacity_permm;
+
+      // Advance the model by one sample with the power applied over the last period
+      const float blockdT = hotend.modeled_block_temp - hotend.modeled_ambient_temp,
+                  blocktempdelta = (hotend.soft_pwm_amount * constants.heater_power * (1.0f / 127)
+                                    - (ambient_xfer_coeff + filament_xfer_coeff) * blockdT
+                                   ) * (MPC_dT) / constants.block_heat_capacity;
+      hotend.modeled_block_temp += blocktempdelta;
+      hotend.modeled_sensor_temp += (hotend.modeled_block_temp - hotend.modeled_sensor_temp) * (constants.sensor_responsiveness * (MPC_dT));
+
+      // The remaining difference to the measured temperature is slow model error
+      // or fast noise. Correct towards it gradually so the noise averages out.
+      const float delta_to_apply = (hotend.celsius - hotend.modeled_sensor_temp) * (MPC_SMOOTHING_FACTOR);
+      hotend.modeled_block_temp += delta_to_apply;
+      hotend.modeled_sensor_temp += delta_to_apply;
+
+      // Blame the error on the ambient estimate only near steady state
+      if (WITHIN(hotend.soft_pwm_amount, 1, ((MPC_MAX) >> 1) - 1) || ABS(blocktempdelta + delta_to_apply) < (MPC_STEADYSTATE) * (MPC_dT))
+        hotend.modeled_ambient_temp += delta_to_apply > 0 ? _MAX(delta_to_apply, (MPC_MIN_AMBIENT_CHANGE) * (MPC_dT))
+                                                          : _MIN(delta_to_apply, -(MPC_MIN_AMBIENT_CHANGE) * (MPC_dT));
+
+      float power = 0;
+      if (hotend.target != 0 && !TERN0(HEATER_IDLE_HANDLER, hotend_idle[ee].timed_out)) {
+        // Plan the power to reach the target in about 2 seconds,
+        // plus the power to hold it against the present losses
+        power = (hotend.target - hotend.modeled_block_temp) * constants.block_heat_capacity * 0.5f
+              + (hotend.target - hotend.modeled_ambient_temp) * (ambient_xfer_coeff + filament_xfer_coeff);
+      }
+
+      float pid_output = power * 254 / constants.heater_power + 1; // Round to nearest when halved to soft PWM
+      LIMIT(pid_output, 0, MPC_MAX);
+
+      #if ENABLED(PID_DEBUG)
+        if (ee == active_extruder && pid_debug_flag) {
+          SERIAL_ECHO_START();
+          SERIAL_ECHOLNPAIR(STR_PID_DEBUG, ee, STR_PID_DEBUG_INPUT, hotend.celsius, STR_PID_DEBUG_OUTPUT, pid_output,
+            " block ", hotend.modeled_block_temp, " sensor ", hotend.modeled_sensor_temp, " ambient ", hotend.modeled_ambient_temp, " e_speed ", e_speed);
+        }
+      #endif
+
     #else // No PID enabled
 
       const bool is_idling = TERN0(HEATER_IDLE_HANDLER, hotend_idle[ee].timed_out);
@@ -1531,6 +1801,29 @@ void Temperature::manage_heater() {
   }
 #endif // HAS_TEMP_PROBE
 
+#if ENABLED(THERMISTOR_LUT)
+
+  /**
+   * Fill the uniform lookup tables from the exact conversions.
+   * Done once, and again whenever user thermistor parameters change.
+   */
+  void Temperature::refresh_thermistor_luts() {
+    #if HAS_USER_THERMISTORS
+      LOOP_L_N(i, USER_THERMISTORS) if (user_thermistor[i].pre_calc) thermistor_luts_valid = false;
+    #endif
+    if (thermistor_luts_valid) return;
+    #if HOTEND_USES_THERMISTOR
+      HOTEND_LOOP() if (TEST(hotend_lut_mask, e))
+        hotend_lut[e].build([e](const int raw) { return analog_to_celsius_hotend(raw, e); });
+    #endif
+    TERN_(HEATER_BED_USES_THERMISTOR, bed_lut.build(analog_to_celsius_bed));
+    TERN_(HEATER_CHAMBER_USES_THERMISTOR, chamber_lut.build(analog_to_celsius_chamber));
+    TERN_(PROBE_USES_THERMISTOR, probe_lut.build(analog_to_celsius_probe));
+    thermistor_luts_valid = true;
+  }
+
+#endif
+
 /**
  * Get the raw values into the actual temperatures.
  * The raw values are created in interrupt context,
@@ -1544,13 +1837,35 @@ void Temperature::updateTemperaturesFromRawValues() {
   #if ENABLED(HEATER_1_USES_MAX6675)
     temp_hotend[1].raw = READ_MAX6675(1);
   #endif
-  #if HAS_HOTEND
-    HOTEND_LOOP() temp_hotend[e].celsius = analog_to_celsius_hotend(temp_hotend[e].raw, e);
+
+  #if ENABLED(THERMISTOR_LUT)
+
+    refresh_thermistor_luts();
+
+    #if HOTEND_USES_THERMISTOR
+      HOTEND_LOOP() temp_hotend[e].celsius = TEST(hotend_lut_mask, e)
+        ? hotend_lut[e].celsius(temp_hotend[e].raw)
+        : analog_to_celsius_hotend(temp_hotend[e].raw, e);
+    #elif HAS_HOTEND
+      HOTEND_LOOP() temp_hotend[e].celsius = analog_to_celsius_hotend(temp_hotend[e].raw, e);
+    #endif
+
+    TERN_(HAS_HEATED_BED, temp_bed.celsius = TERN(HEATER_BED_USES_THERMISTOR, bed_lut.celsius, analog_to_celsius_bed)(temp_bed.raw));
+    TERN_(HAS_TEMP_CHAMBER, temp_chamber.celsius = TERN(HEATER_CHAMBER_USES_THERMISTOR, chamber_lut.celsius, analog_to_celsius_chamber)(temp_chamber.raw));
+    TERN_(HAS_TEMP_PROBE, temp_probe.celsius = TERN(PROBE_USES_THERMISTOR, probe_lut.celsius, analog_to_celsius_probe)(temp_probe.raw));
+
+  #else
+
+    #if HAS_HOTEND
+      HOTEND_LOOP() temp_hotend[e].celsius = analog_to_celsius_hotend(temp_hotend[e].raw, e);
+    #endif
+
+    TERN_(HAS_HEATED_BED, temp_bed.celsius = analog_to_celsius_bed(temp_bed.raw));
+    TERN_(HAS_TEMP_CHAMBER, temp_chamber.celsius = analog_to_celsius_chamber(temp_chamber.raw));
+    TERN_(HAS_TEMP_PROBE, temp_probe.celsius = analog_to_celsius_probe(temp_probe.raw));
+
   #endif
 
-  TERN_(HAS_HEATED_BED, temp_bed.celsius = analog_to_celsius_bed(temp_bed.raw));
-  TERN_(HAS_TEMP_CHAMBER, temp_chamber.celsius = analog_to_celsius_chamber(temp_chamber.raw));
-  TERN_(HAS_TEMP_PROBE, temp_probe.celsius = analog_to_celsius_probe(temp_probe.raw));
   TERN_(TEMP_SENSOR_1_AS_REDUNDANT, redundant_temperature = analog_to_celsius_hotend(redundant_temperature_raw, 1));
   TERN_(FILAMENT_WIDTH_SENSOR, filwidth.update_measured_mm());
   TERN_(HAS_POWER_MONITOR, power_monitor.capture_values());
@@ -1628,6 +1943,9 @@ void Temperature::init() {
     last_e_position = 0;
   #endif
 
+  // Start the hotend models from the first measured temperature
+  TERN_(MPCTEMP, HOTEND_LOOP() temp_hotend[e].modeled_block_temp = NAN);
+
   #if HAS_HEATER_0
     #ifdef ALFAWISE_UX0
       OUT_WRITE_OD(HEATER_0_PIN, HEATER_0_INVERTING);
@@ -2308,7 +2626,7 @@ void Temperature::readings_ready() {
       if (tdir) {
         const int16_t rawtemp = temp_hotend[e].raw * tdir; // normal direction, +rawtemp, else -rawtemp
         const bool heater_on = (temp_hotend[e].target > 0
-          || TERN0(PIDTEMP, temp_hotend[e].soft_pwm_amount) > 0
+          || (ANY(PIDTEMP, MPCTEMP) && temp_hotend[e].soft_pwm_amount > 0)
         );
         if (rawtemp > temp_range[e].raw_max * tdir) max_temp_error((heater_ind_t)e);
         if (heater_on && rawtemp < temp_range[e].raw_min * tdir && !is_preheating(e)) {
@@ -26,6 +26,9 @@
  */
 
 #include "thermistor/thermistors.h"
+#if ENABLED(THERMISTOR_LUT)
+  #include "thermistor/thermistor_lut.h"
+#endif
 
 #include "../inc/MarlinConfig.h"
 
@@ -69,6 +72,18 @@ hotend_pid_t;
   typedef IF<(LPQ_MAX_LEN > 255), uint16_t, uint8_t>::type lpq_ptr_t;
 #endif
 
+#if ENABLED(MPCTEMP)
+  // Model Predictive Control physical constants
+  typedef struct {
+    float heater_power,                   // (W) Heater cartridge power
+          block_heat_capacity,            // (J/K) Heat capacity of the heater block
+          sensor_responsiveness,          // (1/s) Rate the sensor follows the block temperature
+          ambient_xfer_coeff_fan0,        // (W/K) Heat loss to ambient with the fan off
+          ambient_xfer_coeff_fan255,      // (W/K) Heat loss to ambient with the fan at full speed
+          filament_heat_capacity_permm;   // (J/K/mm) Heat taken up by each mm of filament
+  } MPC_t;
+#endif
+
 #define PID_PARAM(F,H) _PID_##F(TERN(PID_PARAMS_PER_HOTEND, H, 0))
 #define _PID_Kp(H) TERN(PIDTEMP, Temperature::temp_hotend[H].pid.Kp, NAN)
 #define _PID_Ki(H) TERN(PIDTEMP, Temperature::temp_hotend[H].pid.Ki, NAN)
@@ -153,6 +168,10 @@ enum ADCSensorState : char {
 
 #define ACTUAL_ADC_SAMPLES _MAX(int(MIN_ADC_ISR_LOOPS), int(SensorsReady))
 
+#if ENABLED(MPCTEMP)
+  #define MPC_dT ((OVERSAMPLENR * float(ACTUAL_ADC_SAMPLES)) / TEMP_TIMER_FREQUENCY)
+#endif
+
 #if HAS_PID_HEATING
   #define PID_K2 (1-float(PID_K1))
   #define PID_dT ((OVERSAMPLENR * float(ACTUAL_ADC_SAMPLES)) / TEMP_TIMER_FREQUENCY)
@@ -190,8 +209,20 @@ struct PIDHeaterInfo : public HeaterInfo {
   T pid;  // Initialized by settings.load()
 };
 
+// A heater with model predictive control
+#if ENABLED(MPCTEMP)
+  struct MPCHeaterInfo : public HeaterInfo {
+    MPC_t constants;              // Initialized by settings.load()
+    float modeled_ambient_temp,   // Model state, initialized on the first update
+          modeled_block_temp,
+          modeled_sensor_temp;
+  };
+#endif
+
 #if ENABLED(PIDTEMP)
   typedef struct PIDHeaterInfo<hotend_pid_t> hotend_info_t;
+#elif ENABLED(MPCTEMP)
+  typedef struct MPCHeaterInfo hotend_info_t;
 #else
   typedef heater_info_t hotend_info_t;
 #endif
@@ -432,6 +463,7 @@ class Temperature {
         //if (!WITHIN(t_index, 0, USER_THERMISTORS - 1)) return false;
         if (!WITHIN(value, 1, 1000000)) return false;
         user_thermistor[t_index].series_res = value;
+        user_thermistor[t_index].pre_calc = true;
         return true;
       }
       static bool set_res25(int8_t t_index, float value) {
@@ -468,6 +500,10 @@ class Temperature {
       static float analog_to_celsius_chamber(const int raw);
     #endif
 
+    #if ENABLED(THERMISTOR_LUT)
+      static void refresh_thermistor_luts();
+    #endif
+
     #if HAS_FAN
 
       static uint8_t fan_speed[FAN_COUNT];
@@ -736,6 +772,13 @@ class Temperature {
 
     #endif
 
+    /**
+     * Identify the hotend thermal model in response to M306 T
+     */
+    #if BOTH(MPCTEMP, MPC_AUTOTUNE)
+      static void MPC_autotune(const uint8_t E_NAME);
+    #endif
+
     #if ENABLED(PROBING_HEATERS_OFF)
       static void pause(const bool p);
       FORCE_INLINE static bool is_paused() { return paused; }
@@ -0,0 +1,73 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * thermistor_lut.h - Uniform-step thermistor lookup table
+ *
+ * The table holds the temperature at evenly spaced raw ADC values, so a
+ * conversion is an index by shifted raw value and a linear interpolation.
+ * It is filled from the exact conversion (thermistor table scan or user
+ * thermistor formula) and only needs to be rebuilt when that changes.
+ */
+
+#include "thermistors.h"
+
+// One entry per table ADC count puts every table point on the grid, so
+// the lookup matches the table scan exactly (to within 1/16 °C).
+#ifndef THERMISTOR_LUT_BITS
+  #define THERMISTOR_LUT_BITS THERMISTOR_TABLE_ADC_RESOLUTION
+#endif
+
+constexpr uint8_t thermistor_lut_log2(const uint32_t v) { return v > 1 ? 1 + thermistor_lut_log2(v >> 1) : 0; }
+
+class ThermistorLUT {
+  public:
+    static constexpr uint8_t SCALE_BITS = 4,  // Store temperatures as 1/16 °C
+                             SHIFT = thermistor_lut_log2(uint32_t(MAX_RAW_THERMISTOR_VALUE) + 1) - (THERMISTOR_LUT_BITS);
+    static constexpr uint16_t SIZE = _BV(THERMISTOR_LUT_BITS) + 1;
+
+    static_assert(_BV32(thermistor_lut_log2(uint32_t(MAX_RAW_THERMISTOR_VALUE) + 1)) == uint32_t(MAX_RAW_THERMISTOR_VALUE) + 1, "MAX_RAW_THERMISTOR_VALUE + 1 must be a power of 2.");
+    static_assert(thermistor_lut_log2(uint32_t(MAX_RAW_THERMISTOR_VALUE) + 1) >= (THERMISTOR_LUT_BITS), "THERMISTOR_LUT_BITS is too large for the raw ADC range.");
+
+    // Sample the exact conversion at each raw step. Out-of-range (or NaN)
+    // results saturate, so a shorted sensor still reads far above MAXTEMP.
+    template<typename F>
+    void build(F to_celsius) {
+      for (uint16_t i = 0; i < SIZE; i++) {
+        const int raw = _MIN(int32_t(i) << SHIFT, int32_t(MAX_RAW_THERMISTOR_VALUE));
+        const float v = to_celsius(raw) * _BV(SCALE_BITS);
+        c[i] = !(v < INT16_MAX) ? INT16_MAX : v < INT16_MIN ? INT16_MIN : int16_t(LROUND(v));
+      }
+    }
+
+    float celsius(const int raw) const {
+      const uint16_t r = constrain(raw, 0, int(MAX_RAW_THERMISTOR_VALUE)),
+                     i = r >> SHIFT,
+                     f = r & (_BV(SHIFT) - 1);
+      const int32_t c0 = c[i];
+      return (c0 + (((c[i + 1] - c0) * int32_t(f)) >> SHIFT)) * (1.0f / _BV(SCALE_BITS));
+    }
+
+  private:
+    int16_t c[SIZE];
+};
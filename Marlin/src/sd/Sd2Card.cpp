@@ -360,6 +360,31 @@ bool Sd2Card::readBlock(uint32_t blockNumber, uint8_t* dst) {
   #endif
 }
 
+/**
+ * Read several consecutive 512 byte blocks from an SD card.
+ * Uses a single multiple block read (CMD18) so the card only has to
+ * seek once, falling back to single block reads (with retry) on error.
+ *
+ * \param[in] blockNumber Logical block of the first block to be read.
+ * \param[out] dst Pointer to the location that will receive count * 512 bytes.
+ * \param[in] count Number of blocks to read.
+ * \return true for success, false for failure.
+ */
+bool Sd2Card::readBlocks(uint32_t blockNumber, uint8_t* dst, const uint16_t count) {
+  if (count == 1) return readBlock(blockNumber, dst);
+
+  if (readStart(blockNumber)) {
+    uint16_t n = 0;
+    for (; n < count; ++n) if (!readData(dst + n * 512U)) break;
+    if (readStop() && n == count) return true;
+  }
+
+  errorCode_ = 0;
+  for (uint16_t n = 0; n < count; ++n)
+    if (!readBlock(blockNumber + n, dst + n * 512U)) return false;
+  return true;
+}
+
 /**
  * Read one data block in a multiple block read sequence
  *
@@ -566,6 +591,32 @@ bool Sd2Card::writeBlock(uint32_t blockNumber, const uint8_t* src) {
   return success;
 }
 
+/**
+ * Write several consecutive 512 byte blocks to an SD card.
+ * Uses a single pre-erased multiple block write (ACMD23 + CMD25) so the
+ * card can program whole pages, falling back to single block writes on error.
+ *
+ * \param[in] blockNumber Logical block of the first block to be written.
+ * \param[in] src Pointer to count * 512 bytes of data to be written.
+ * \param[in] count Number of blocks to write.
+ * \return true for success, false for failure.
+ */
+bool Sd2Card::writeBlocks(uint32_t blockNumber, const uint8_t* src, const uint16_t count) {
+  if (ENABLED(SDCARD_READONLY)) return false;
+  if (count == 1) return writeBlock(blockNumber, src);
+
+  if (writeStart(blockNumber, count)) {
+    uint16_t n = 0;
+    for (; n < count; ++n) if (!writeData(src + n * 512U)) break;
+    if (writeStop() && n == count) return true;
+  }
+
+  errorCode_ = 0;
+  for (uint16_t n = 0; n < count; ++n)
+    if (!writeBlock(blockNumber + n, src + n * 512U)) return false;
+  return true;
+}
+
 /**
  * Write one data block in a multiple block write sequence
  * \param[in] src Pointer to the location of the data to be written.
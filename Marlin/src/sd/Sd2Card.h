@@ -122,6 +122,7 @@ public:
   bool init(const uint8_t sckRateID, const pin_t chipSelectPin);
 
   bool readBlock(uint32_t block, uint8_t* dst);
+  bool readBlocks(uint32_t block, uint8_t* dst, const uint16_t count);
 
   /**
    * Read a card's CID register. The CID contains card identification
@@ -155,6 +156,7 @@ public:
    */
   int type() const {return type_;}
   bool writeBlock(uint32_t blockNumber, const uint8_t* src);
+  bool writeBlocks(uint32_t blockNumber, const uint8_t* src, const uint16_t count);
   bool writeData(const uint8_t* src);
   bool writeStart(uint32_t blockNumber, const uint32_t eraseCount);
   bool writeStop();
@@ -33,7 +33,15 @@ class Sd2Card {
   public:
     bool init(uint8_t sckRateID = 0, uint8_t chipSelectPin = 0) { return SDIO_Init(); }
     bool readBlock(uint32_t block, uint8_t *dst) { return SDIO_ReadBlock(block, dst); }
+    bool readBlocks(uint32_t block, uint8_t *dst, const uint16_t count) {
+      for (uint16_t n = 0; n < count; ++n) if (!SDIO_ReadBlock(block + n, dst + n * 512U)) return false;
+      return true;
+    }
     bool writeBlock(uint32_t block, const uint8_t *src) { return SDIO_WriteBlock(block, src); }
+    bool writeBlocks(uint32_t block, const uint8_t *src, const uint16_t count) {
+      for (uint16_t n = 0; n < count; ++n) if (!SDIO_WriteBlock(block + n, src + n * 512U)) return false;
+      return true;
+    }
 };
 
 #endif // SDIO_SUPPORT
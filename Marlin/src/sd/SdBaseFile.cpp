@@ -74,14 +74,14 @@ bool SdBaseFile::addDirCluster() {
   block = vol_->clusterStartBlock(curCluster_);
 
   // set cache to first block of cluster
-  vol_->cacheSetBlockNumber(block, true);
+  if (!vol_->cacheSetBlockNumber(block, true)) return false;
 
   // zero first block of cluster
-  memset(vol_->cacheBuffer_.data, 0, 512);
+  memset(vol_->cache()->data, 0, 512);
 
   // zero rest of cluster
   for (uint8_t i = 1; i < vol_->blocksPerCluster_; i++) {
-    if (!vol_->writeBlock(block + i, vol_->cacheBuffer_.data)) return false;
+    if (!vol_->writeBlock(block + i, vol_->cache()->data)) return false;
   }
   // Increase directory file size by cluster size
   fileSize_ += 512UL << vol_->clusterSizeShift_;
@@ -105,9 +105,65 @@ dir_t* SdBaseFile::cacheDirEntry(uint8_t action) {
 bool SdBaseFile::close() {
   bool rtn = sync();
   type_ = FAT_FILE_TYPE_CLOSED;
+  TERN_(SD_FILE_EXTENTS, extents_ = nullptr);
   return rtn;
 }
 
+#if ENABLED(SD_FILE_EXTENTS)
+
+  /**
+   * Walk the cluster chain of an open file once and record it as runs of
+   * consecutive clusters, so that reading and seeking need not visit the FAT.
+   * Files with more runs than the table holds are mapped from the start as
+   * far as the table goes. The map is dropped when the file is written.
+   *
+   * \param[out] table Storage for the runs. Must stay valid while the file is open.
+   * \param[in] size Number of entries in the table.
+   *
+   * \return true if the whole file is mapped, false otherwise.
+   */
+  bool SdBaseFile::mapExtents(sd_extent_t * const table, const uint8_t size) {
+    extents_ = nullptr;
+    if (!isFile() || !firstCluster_ || !size) return false;
+
+    const uint32_t clusters = fileClusters();
+    uint32_t c = firstCluster_, i = 0;
+    uint8_t n = 1;
+    table[0].fileCluster = 0;
+    table[0].cluster = c;
+    while (++i < clusters) {
+      uint32_t next;
+      if (!vol_->fatGet(c, &next)) return false;
+      if (vol_->isEOC(next)) break;         // chain shorter than the file size
+      if (next != c + 1) {
+        if (n == size) break;               // table full, map the start only
+        table[n].fileCluster = i;
+        table[n].cluster = next;
+        n++;
+      }
+      c = next;
+    }
+
+    extents_ = table;
+    extentCount_ = n;
+    extentClusters_ = i;
+    extentHint_ = 0;
+    return i == clusters;
+  }
+
+  // Get the volume cluster for a file cluster index, if mapped
+  bool SdBaseFile::extentCluster(const uint32_t index, uint32_t &cluster) {
+    if (!extents_ || index >= extentClusters_) return false;
+    uint8_t e = extentHint_;
+    if (index < extents_[e].fileCluster) e = 0;
+    while (e + 1 < extentCount_ && index >= extents_[e + 1].fileCluster) e++;
+    extentHint_ = e;
+    cluster = extents_[e].cluster + (index - extents_[e].fileCluster);
+    return true;
+  }
+
+#endif // SD_FILE_EXTENTS
+
 /**
  * Check for contiguous file and return its raw block range.
  *
@@ -180,6 +236,31 @@ bool SdBaseFile::createContiguous(SdBaseFile* dirFile, const char* path, uint32_
   return sync();
 }
 
+/**
+ * Reserve a run of contiguous clusters for an empty file open for write.
+ * Later writes follow the reserved chain without searching the FAT, and
+ * the card sees sequential addresses. truncate() releases unused clusters.
+ *
+ * \param[in] count The number of clusters to reserve.
+ *
+ * \return true for success, false for failure.
+ * Reasons for failure include the file is not empty, not open for write,
+ * or no run of \a count free clusters exists.
+ */
+bool SdBaseFile::preAllocate(const uint32_t count) {
+  if (ENABLED(SDCARD_READONLY)) return false;
+
+  if (!isFile() || !(flags_ & O_WRITE) || firstCluster_ || !count) return false;
+
+  TERN_(SD_FILE_EXTENTS, extents_ = nullptr);
+
+  if (!vol_->allocContiguous(count, &firstCluster_)) return false;
+
+  // insure sync() will update dir entry
+  flags_ |= F_FILE_DIR_DIRTY;
+  return true;
+}
+
 /**
  * Return a file's directory entry.
  *
@@ -765,6 +846,7 @@ bool SdBaseFile::openCachedEntry(uint8_t dirIndex, uint8_t oflag) {
   // set to start of file
   curCluster_ = 0;
   curPosition_ = 0;
+  TERN_(SD_FILE_EXTENTS, extents_ = nullptr);
   if ((oflag & O_TRUNC) && !truncate(0)) return false;
   return oflag & O_AT_END ? seekEnd(0) : true;
 
@@ -851,7 +933,7 @@ bool SdBaseFile::openParent(SdBaseFile* dir) {
   // first block of parent dir
   if (!vol_->cacheRawBlock(lbn, SdVolume::CACHE_FOR_READ)) return false;
 
-  p = &vol_->cacheBuffer_.dir[1];
+  p = &vol_->cache()->dir[1];
   // verify name for '../..'
   if (p->name[0] != '.' || p->name[1] != '.') return false;
   // '..' is pointer to first cluster of parent. open '../..' to find parent
@@ -905,6 +987,7 @@ bool SdBaseFile::openRoot(SdVolume* vol) {
 
   // set to start of file
   curCluster_ = curPosition_ = 0;
+  TERN_(SD_FILE_EXTENTS, extents_ = nullptr);
 
   // root has no directory entry
   dirBlock_ = dirIndex_ = 0;
@@ -1033,6 +1116,10 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
         // start of new cluster
         if (curPosition_ == 0)
           curCluster_ = firstCluster_;                      // use first cluster in file
+        #if ENABLED(SD_FILE_EXTENTS)
+          else if (extentCluster(curPosition_ >> (vol_->clusterSizeShift_ + 9), curCluster_))
+            {}                                              // get next cluster from the extent map
+        #endif
         else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
           return -1;
       }
@@ -1043,9 +1130,19 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
     // amount to be read from current block
     NOMORE(n, 512 - offset);
 
-    // no buffering needed if n == 512
-    if (n == 512 && block != vol_->cacheBlockNumber()) {
-      if (!vol_->readBlock(block, dst)) return -1;
+    // no buffering needed if n == 512 and the block isn't cached
+    uint16_t nb = 0;
+    if (n == 512) {
+      // read all whole blocks left in this cluster with one transfer,
+      // stopping short of any cached block which may be newer than the card
+      nb = toRead >> 9;
+      if (type_ != FAT_FILE_TYPE_ROOT_FIXED)
+        NOMORE(nb, vol_->blocksPerCluster() - vol_->blockOfCluster(curPosition_));
+      nb = vol_->cacheUncachedRun(block, nb);
+    }
+    if (nb) {
+      if (!vol_->readBlocks(block, dst, nb)) return -1;
+      n = nb << 9;
     }
     else {
       // read block to cache and copy data to caller
@@ -1423,6 +1520,19 @@ bool SdBaseFile::seekSet(const uint32_t pos) {
   nCur = (curPosition_ - 1) >> (vol_->clusterSizeShift_ + 9);
   nNew = (pos - 1) >> (vol_->clusterSizeShift_ + 9);
 
+  #if ENABLED(SD_FILE_EXTENTS)
+    // jump to the cluster, or to the last mapped one if that gets closer
+    if (extents_) {
+      const uint32_t nMap = _MIN(nNew, extentClusters_ - 1);
+      if ((curPosition_ == 0 || nNew < nCur || nMap > nCur) && extentCluster(nMap, curCluster_)) {
+        for (nNew -= nMap; nNew--;)
+          if (!vol_->fatGet(curCluster_, &curCluster_)) return false;
+        curPosition_ = pos;
+        return true;
+      }
+    }
+  #endif
+
   if (nNew < nCur || curPosition_ == 0)
     curCluster_ = firstCluster_;      // must follow chain from first cluster
   else
@@ -1609,11 +1719,13 @@ bool SdBaseFile::truncate(uint32_t length) {
   // error if not a normal file or read-only
   if (!isFile() || !(flags_ & O_WRITE)) return false;
 
+  TERN_(SD_FILE_EXTENTS, extents_ = nullptr);
+
   // error if length is greater than current size
   if (length > fileSize_) return false;
 
-  // fileSize and length are zero - nothing to do
-  if (fileSize_ == 0) return true;
+  // fileSize and length are zero and no clusters are reserved - nothing to do
+  if (fileSize_ == 0 && firstCluster_ == 0) return true;
 
   // remember position for seek after truncation
   newPos = curPosition_ > length ? length : curPosition_;
@@ -1679,6 +1791,8 @@ int16_t SdBaseFile::write(const void* buf, uint16_t nbyte) {
   // error if not a normal file or is read-only
   if (!isFile() || !(flags_ & O_WRITE)) goto FAIL;
 
+  TERN_(SD_FILE_EXTENTS, extents_ = nullptr);
+
   // seek to end of file if append flag
   if ((flags_ & O_APPEND) && curPosition_ != fileSize_) {
     if (!seekEnd()) goto FAIL;
@@ -1719,19 +1833,18 @@ int16_t SdBaseFile::write(const void* buf, uint16_t nbyte) {
     // block for data write
     uint32_t block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
     if (n == 512) {
-      // full block - don't need to use cache
-      if (vol_->cacheBlockNumber() == block) {
-        // invalidate cache if block is in cache
-        vol_->cacheSetBlockNumber(0xFFFFFFFF, false);
-      }
-      if (!vol_->writeBlock(block, src)) goto FAIL;
+      // full blocks - don't need to use cache (writeBlocks drops any cached copies)
+      // send all whole blocks left in this cluster as one multiple block write
+      const uint16_t count = _MIN(nToWrite >> 9, vol_->blocksPerCluster() - blockOfCluster);
+      if (!vol_->writeBlocks(block, src, count)) goto FAIL;
+      n = count << 9;
     }
     else {
       if (blockOffset == 0 && curPosition_ >= fileSize_) {
         // start of new block don't need to read into cache
         if (!vol_->cacheFlush()) goto FAIL;
         // set cache dirty and SD address of block
-        vol_->cacheSetBlockNumber(block, true);
+        if (!vol_->cacheSetBlockNumber(block, true)) goto FAIL;
       }
       else {
         // rewrite part of block
@@ -49,6 +49,15 @@ struct filepos_t {
   filepos_t() : position(0), cluster(0) {}
 };
 
+/**
+ * \struct sd_extent_t
+ * \brief A run of consecutive clusters in a file
+ */
+struct sd_extent_t {
+  uint32_t fileCluster;   // index of the first cluster of the run within the file
+  uint32_t cluster;       // volume cluster number of the first cluster of the run
+};
+
 // use the gnu style oflag in open()
 uint8_t const O_READ = 0x01,                    // open() oflag for reading
               O_RDONLY = O_READ,                // open() oflag - same as O_IN
@@ -192,6 +201,10 @@ class SdBaseFile {
 
   bool close();
   bool contiguousRange(uint32_t* bgnBlock, uint32_t* endBlock);
+
+  #if ENABLED(SD_FILE_EXTENTS)
+    bool mapExtents(sd_extent_t * const table, const uint8_t size);
+  #endif
   bool createContiguous(SdBaseFile* dirFile,
                         const char* path, uint32_t size);
   /**
@@ -296,6 +309,7 @@ class SdBaseFile {
   bool openNext(SdBaseFile* dirFile, uint8_t oflag);
   bool openRoot(SdVolume* vol);
   int peek();
+  bool preAllocate(const uint32_t count);
   static void printFatDate(uint16_t fatDate);
   static void printFatTime(uint16_t fatTime);
   bool printName();
@@ -369,6 +383,15 @@ class SdBaseFile {
   uint32_t  firstCluster_;  // first cluster of file
   SdVolume* vol_;           // volume where file is located
 
+  #if ENABLED(SD_FILE_EXTENTS)
+    sd_extent_t *extents_;    // cluster runs mapped by mapExtents(), or null
+    uint32_t  extentClusters_; // number of clusters from the start covered by extents_
+    uint8_t   extentCount_;   // number of runs in extents_
+    uint8_t   extentHint_;    // run holding the last cluster looked up
+    bool extentCluster(const uint32_t index, uint32_t &cluster);
+    uint32_t fileClusters() const { return (fileSize_ + (512UL << vol_->clusterSizeShift()) - 1) >> (vol_->clusterSizeShift() + 9); }
+  #endif
+
   /**
    * EXPERIMENTAL - Don't use!
    */
@@ -37,13 +37,20 @@
 
 #if !USE_MULTIPLE_CARDS
   // raw block cache
-  uint32_t SdVolume::cacheBlockNumber_;  // current block number
-  cache_t  SdVolume::cacheBuffer_;       // 512 byte cache for Sd2Card
-  Sd2Card* SdVolume::sdCard_;            // pointer to SD card object
-  bool     SdVolume::cacheDirty_;        // cacheFlush() will write block if true
-  uint32_t SdVolume::cacheMirrorBlock_;  // mirror  block for second FAT
+  uint32_t SdVolume::cacheBlockNumber_[SD_CACHE_TOTAL_SLOTS];  // block number in each slot
+  cache_t  SdVolume::cacheBuffer_[SD_CACHE_TOTAL_SLOTS];       // 512 byte caches for Sd2Card
+  Sd2Card* SdVolume::sdCard_;                                  // pointer to SD card object
+  bool     SdVolume::cacheDirty_[SD_CACHE_TOTAL_SLOTS];        // cacheFlush() will write block if true
+  uint32_t SdVolume::cacheMirrorBlock_[SD_CACHE_TOTAL_SLOTS];  // mirror  block for second FAT
+  uint16_t SdVolume::cacheUsed_[SD_CACHE_TOTAL_SLOTS];         // LRU stamps
+  uint16_t SdVolume::cacheTick_;
+  uint8_t  SdVolume::cacheCur_;                                // current slot
 #endif  // USE_MULTIPLE_CARDS
 
+#if ENABLED(SD_CACHE_STATS)
+  uint32_t SdVolume::cacheHits_, SdVolume::cacheMisses_, SdVolume::cacheWrites_;
+#endif
+
 // find a contiguous group of clusters
 bool SdVolume::allocContiguous(uint32_t count, uint32_t* curCluster) {
   if (ENABLED(SDCARD_READONLY)) return false;
@@ -118,34 +125,110 @@ bool SdVolume::allocContiguous(uint32_t count, uint32_t* curCluster) {
   return true;
 }
 
-bool SdVolume::cacheFlush() {
+// write one cache slot back to the card if it is dirty
+bool SdVolume::cacheWriteBack(const uint8_t slot) {
   #if DISABLED(SDCARD_READONLY)
-    if (cacheDirty_) {
-      if (!sdCard_->writeBlock(cacheBlockNumber_, cacheBuffer_.data))
+    if (cacheDirty_[slot]) {
+      if (!sdCard_->writeBlock(cacheBlockNumber_[slot], cacheBuffer_[slot].data))
         return false;
 
       // mirror FAT tables
-      if (cacheMirrorBlock_) {
-        if (!sdCard_->writeBlock(cacheMirrorBlock_, cacheBuffer_.data))
+      if (cacheMirrorBlock_[slot]) {
+        if (!sdCard_->writeBlock(cacheMirrorBlock_[slot], cacheBuffer_[slot].data))
           return false;
-        cacheMirrorBlock_ = 0;
+        cacheMirrorBlock_[slot] = 0;
       }
-      cacheDirty_ = 0;
+      cacheDirty_[slot] = 0;
+      TERN_(SD_CACHE_STATS, cacheWrites_++);
     }
+  #else
+    UNUSED(slot);
   #endif
   return true;
 }
 
+bool SdVolume::cacheFlush() {
+  for (uint8_t i = 0; i < SD_CACHE_TOTAL_SLOTS; i++)
+    if (!cacheWriteBack(i)) return false;
+  return true;
+}
+
+// Find the slot holding a block or, failing that, the least recently used
+// slot of the right kind, written back and ready to receive the block.
+// Returns SD_CACHE_TOTAL_SLOTS if the write back fails.
+uint8_t SdVolume::cacheSlotFor(uint32_t blockNumber, const bool load) {
+  for (uint8_t i = 0; i < SD_CACHE_TOTAL_SLOTS; i++)
+    if (cacheBlockNumber_[i] == blockNumber) {
+      TERN_(SD_CACHE_STATS, if (load) cacheHits_++);
+      return i;
+    }
+
+  TERN_(SD_CACHE_STATS, if (load) cacheMisses_++);
+
+  const bool fat = isFatBlock(blockNumber);
+  const uint8_t first = fat ? 0 : SD_FAT_CACHE_SLOTS,
+                last = fat ? SD_FAT_CACHE_SLOTS : SD_CACHE_TOTAL_SLOTS;
+  uint8_t slot = first;
+  for (uint8_t i = first; i < last; i++) {
+    if (cacheBlockNumber_[i] == 0xFFFFFFFF) { slot = i; break; }
+    if (uint16_t(cacheTick_ - cacheUsed_[i]) > uint16_t(cacheTick_ - cacheUsed_[slot])) slot = i;
+  }
+  if (!cacheWriteBack(slot)) return SD_CACHE_TOTAL_SLOTS;
+  cacheBlockNumber_[slot] = 0xFFFFFFFF;
+  return slot;
+}
+
 bool SdVolume::cacheRawBlock(uint32_t blockNumber, bool dirty) {
-  if (cacheBlockNumber_ != blockNumber) {
-    if (!cacheFlush()) return false;
-    if (!sdCard_->readBlock(blockNumber, cacheBuffer_.data)) return false;
-    cacheBlockNumber_ = blockNumber;
+  uint8_t slot = cacheCur_;
+  if (cacheBlockNumber_[slot] != blockNumber) {
+    slot = cacheSlotFor(blockNumber, true);
+    if (slot >= SD_CACHE_TOTAL_SLOTS) return false;
+    if (cacheBlockNumber_[slot] != blockNumber) {
+      if (!sdCard_->readBlock(blockNumber, cacheBuffer_[slot].data)) return false;
+      cacheBlockNumber_[slot] = blockNumber;
+    }
+    cacheCur_ = slot;
   }
-  if (dirty) cacheDirty_ = true;
+  #if ENABLED(SD_CACHE_STATS)
+    else cacheHits_++;
+  #endif
+  cacheUsed_[slot] = ++cacheTick_;
+  if (dirty) cacheDirty_[slot] = true;
+  return true;
+}
+
+// Make the current slot hold a block without reading it from the card.
+// The caller is expected to overwrite its contents.
+bool SdVolume::cacheSetBlockNumber(uint32_t blockNumber, bool dirty) {
+  const uint8_t slot = cacheSlotFor(blockNumber, false);
+  if (slot >= SD_CACHE_TOTAL_SLOTS) return false;
+  cacheCur_ = slot;
+  cacheUsed_[slot] = ++cacheTick_;
+  cacheDirty_[slot] = dirty;
+  cacheBlockNumber_[slot] = blockNumber;
   return true;
 }
 
+// Drop a run of blocks from the cache, e.g., when they are written around the cache
+void SdVolume::cacheInvalidate(uint32_t blockNumber, const uint16_t count/*=1*/) {
+  for (uint8_t i = 0; i < SD_CACHE_TOTAL_SLOTS; i++)
+    if (cacheBlockNumber_[i] - blockNumber < count) {
+      cacheBlockNumber_[i] = 0xFFFFFFFF;
+      cacheDirty_[i] = false;
+      cacheMirrorBlock_[i] = 0;
+    }
+}
+
+// Number of blocks from blockNumber, up to count, that are not in the cache
+// and so may be read directly from the card
+uint16_t SdVolume::cacheUncachedRun(uint32_t blockNumber, uint16_t count) const {
+  for (uint8_t i = 0; i < SD_CACHE_TOTAL_SLOTS; i++) {
+    const uint32_t b = cacheBlockNumber_[i] - blockNumber;
+    if (b < count) count = b;
+  }
+  return count;
+}
+
 // return the size in bytes of a cluster chain
 bool SdVolume::chainSize(uint32_t cluster, uint32_t* size) {
   uint32_t s = 0;
@@ -167,13 +250,13 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t* value) {
     lba = fatStartBlock_ + (index >> 9);
     if (!cacheRawBlock(lba, CACHE_FOR_READ)) return false;
     index &= 0x1FF;
-    uint16_t tmp = cacheBuffer_.data[index];
+    uint16_t tmp = cache()->data[index];
     index++;
     if (index == 512) {
       if (!cacheRawBlock(lba + 1, CACHE_FOR_READ)) return false;
       index = 0;
     }
-    tmp |= cacheBuffer_.data[index] << 8;
+    tmp |= cache()->data[index] << 8;
     *value = cluster & 1 ? tmp >> 4 : tmp & 0xFFF;
     return true;
   }
@@ -185,10 +268,9 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t* value) {
   else
     return false;
 
-  if (lba != cacheBlockNumber_ && !cacheRawBlock(lba, CACHE_FOR_READ))
-    return false;
+  if (!cacheRawBlock(lba, CACHE_FOR_READ)) return false;
 
-  *value = (fatType_ == 16) ? cacheBuffer_.fat16[cluster & 0xFF] : (cacheBuffer_.fat32[cluster & 0x7F] & FAT32MASK);
+  *value = (fatType_ == 16) ? cache()->fat16[cluster & 0xFF] : (cache()->fat32[cluster & 0x7F] & FAT32MASK);
   return true;
 }
 
@@ -209,26 +291,26 @@ bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
     lba = fatStartBlock_ + (index >> 9);
     if (!cacheRawBlock(lba, CACHE_FOR_WRITE)) return false;
     // mirror second FAT
-    if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
+    if (fatCount_ > 1) cacheSetMirror(lba + blocksPerFat_);
     index &= 0x1FF;
     uint8_t tmp = value;
     if (cluster & 1) {
-      tmp = (cacheBuffer_.data[index] & 0xF) | tmp << 4;
+      tmp = (cache()->data[index] & 0xF) | tmp << 4;
     }
-    cacheBuffer_.data[index] = tmp;
+    cache()->data[index] = tmp;
     index++;
     if (index == 512) {
       lba++;
       index = 0;
       if (!cacheRawBlock(lba, CACHE_FOR_WRITE)) return false;
       // mirror second FAT
-      if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
+      if (fatCount_ > 1) cacheSetMirror(lba + blocksPerFat_);
     }
     tmp = value >> 4;
     if (!(cluster & 1)) {
-      tmp = ((cacheBuffer_.data[index] & 0xF0)) | tmp >> 4;
+      tmp = ((cache()->data[index] & 0xF0)) | tmp >> 4;
     }
-    cacheBuffer_.data[index] = tmp;
+    cache()->data[index] = tmp;
     return true;
   }
 
@@ -243,12 +325,12 @@ bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
 
   // store entry
   if (fatType_ == 16)
-    cacheBuffer_.fat16[cluster & 0xFF] = value;
+    cache()->fat16[cluster & 0xFF] = value;
   else
-    cacheBuffer_.fat32[cluster & 0x7F] = value;
+    cache()->fat32[cluster & 0x7F] = value;
 
   // mirror second FAT
-  if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
+  if (fatCount_ > 1) cacheSetMirror(lba + blocksPerFat_);
   return true;
 }
 
@@ -291,11 +373,11 @@ int32_t SdVolume::freeClusterCount() {
     NOMORE(n, todo);
     if (fatType_ == 16) {
       for (uint16_t i = 0; i < n; i++)
-        if (cacheBuffer_.fat16[i] == 0) free++;
+        if (cache()->fat16[i] == 0) free++;
     }
     else {
       for (uint16_t i = 0; i < n; i++)
-        if (cacheBuffer_.fat32[i] == 0) free++;
+        if (cache()->fat32[i] == 0) free++;
     }
     #ifdef ESP32
       // Needed to reset the idle task watchdog timer on ESP32 as reading the complete FAT may easily
@@ -331,22 +413,27 @@ bool SdVolume::init(Sd2Card* dev, uint8_t part) {
   sdCard_ = dev;
   fatType_ = 0;
   allocSearchStart_ = 2;
-  cacheDirty_ = 0;  // cacheFlush() will write block if true
-  cacheMirrorBlock_ = 0;
-  cacheBlockNumber_ = 0xFFFFFFFF;
+  blocksPerFat_ = 0;  // No FAT blocks until the volume is known
+  cacheCur_ = 0;
+  for (uint8_t i = 0; i < SD_CACHE_TOTAL_SLOTS; i++) {
+    cacheDirty_[i] = 0;  // cacheFlush() will write block if true
+    cacheMirrorBlock_[i] = 0;
+    cacheBlockNumber_[i] = 0xFFFFFFFF;
+  }
+  TERN_(SD_CACHE_STATS, cacheHits_ = cacheMisses_ = cacheWrites_ = 0);
 
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
   if (part) {
     if (part > 4) return false;
     if (!cacheRawBlock(volumeStartBlock, CACHE_FOR_READ)) return false;
-    part_t* p = &cacheBuffer_.mbr.part[part - 1];
+    part_t* p = &cache()->mbr.part[part - 1];
     if ((p->boot & 0x7F) != 0  || p->totalSectors < 100 || p->firstSector == 0)
       return false; // not a valid partition
     volumeStartBlock = p->firstSector;
   }
   if (!cacheRawBlock(volumeStartBlock, CACHE_FOR_READ)) return false;
-  fbs = &cacheBuffer_.fbs32;
+  fbs = &cache()->fbs32;
   if (fbs->bytesPerSector != 512 ||
       fbs->fatCount == 0 ||
       fbs->reservedSectorCount == 0 ||
@@ -48,6 +48,15 @@
 #include "SdFatConfig.h"
 #include "SdFatStructs.h"
 
+// Block cache slots. A single shared slot unless SD_BLOCK_CACHE is enabled.
+#ifndef SD_CACHE_SLOTS
+  #define SD_CACHE_SLOTS 1
+#endif
+#ifndef SD_FAT_CACHE_SLOTS
+  #define SD_FAT_CACHE_SLOTS 0
+#endif
+#define SD_CACHE_TOTAL_SLOTS (SD_CACHE_SLOTS + SD_FAT_CACHE_SLOTS)
+
 //==============================================================================
 // SdVolume class
 /**
@@ -79,8 +88,8 @@ class SdVolume {
    */
   cache_t* cacheClear() {
     if (!cacheFlush()) return 0;
-    cacheBlockNumber_ = 0xFFFFFFFF;
-    return &cacheBuffer_;
+    cacheBlockNumber_[cacheCur_] = 0xFFFFFFFF;
+    return cache();
   }
 
   /**
@@ -129,6 +138,13 @@ class SdVolume {
    */
   bool dbgFat(uint32_t n, uint32_t* v) { return fatGet(n, v); }
 
+  #if ENABLED(SD_CACHE_STATS)
+    // Block cache counters since the volume was mounted
+    static uint32_t cacheHits() { return cacheHits_; }
+    static uint32_t cacheMisses() { return cacheMisses_; }
+    static uint32_t cacheWrites() { return cacheWrites_; }
+  #endif
+
  private:
   // Allow SdBaseFile access to SdVolume private data.
   friend class SdBaseFile;
@@ -138,18 +154,30 @@ class SdVolume {
   // value for dirty argument in cacheRawBlock to indicate write to cache
   static bool const CACHE_FOR_WRITE = true;
 
+  // Slots [0, SD_FAT_CACHE_SLOTS) hold FAT blocks, the rest hold everything else.
+  // The current slot is the one most recently returned by cacheRawBlock.
   #if USE_MULTIPLE_CARDS
-    cache_t cacheBuffer_;        // 512 byte cache for device blocks
-    uint32_t cacheBlockNumber_;  // Logical number of block in the cache
-    Sd2Card* sdCard_;            // Sd2Card object for cache
-    bool cacheDirty_;            // cacheFlush() will write block if true
-    uint32_t cacheMirrorBlock_;  // block number for mirror FAT
+    cache_t cacheBuffer_[SD_CACHE_TOTAL_SLOTS];        // 512 byte caches for device blocks
+    uint32_t cacheBlockNumber_[SD_CACHE_TOTAL_SLOTS];  // Logical number of block in each slot
+    Sd2Card* sdCard_;                                  // Sd2Card object for cache
+    bool cacheDirty_[SD_CACHE_TOTAL_SLOTS];            // cacheFlush() will write block if true
+    uint32_t cacheMirrorBlock_[SD_CACHE_TOTAL_SLOTS];  // block number for mirror FAT
+    uint16_t cacheUsed_[SD_CACHE_TOTAL_SLOTS];         // cacheTick_ at last use, for LRU
+    uint16_t cacheTick_;
+    uint8_t cacheCur_;                                 // Current slot
   #else
-    static cache_t cacheBuffer_;        // 512 byte cache for device blocks
-    static uint32_t cacheBlockNumber_;  // Logical number of block in the cache
-    static Sd2Card* sdCard_;            // Sd2Card object for cache
-    static bool cacheDirty_;            // cacheFlush() will write block if true
-    static uint32_t cacheMirrorBlock_;  // block number for mirror FAT
+    static cache_t cacheBuffer_[SD_CACHE_TOTAL_SLOTS];        // 512 byte caches for device blocks
+    static uint32_t cacheBlockNumber_[SD_CACHE_TOTAL_SLOTS];  // Logical number of block in each slot
+    static Sd2Card* sdCard_;                                  // Sd2Card object for cache
+    static bool cacheDirty_[SD_CACHE_TOTAL_SLOTS];            // cacheFlush() will write block if true
+    static uint32_t cacheMirrorBlock_[SD_CACHE_TOTAL_SLOTS];  // block number for mirror FAT
+    static uint16_t cacheUsed_[SD_CACHE_TOTAL_SLOTS];         // cacheTick_ at last use, for LRU
+    static uint16_t cacheTick_;
+    static uint8_t cacheCur_;                                 // Current slot
+  #endif
+
+  #if ENABLED(SD_CACHE_STATS)
+    static uint32_t cacheHits_, cacheMisses_, cacheWrites_;
   #endif
 
   uint32_t allocSearchStart_;   // start cluster for alloc search
@@ -169,23 +197,22 @@ class SdVolume {
   uint32_t clusterStartBlock(uint32_t cluster) const { return dataStartBlock_ + ((cluster - 2) << clusterSizeShift_); }
   uint32_t blockNumber(uint32_t cluster, uint32_t position) const { return clusterStartBlock(cluster) + blockOfCluster(position); }
 
-  cache_t* cache() { return &cacheBuffer_; }
-  uint32_t cacheBlockNumber() const { return cacheBlockNumber_; }
-
-  #if USE_MULTIPLE_CARDS
-    bool cacheFlush();
-    bool cacheRawBlock(uint32_t blockNumber, bool dirty);
-  #else
-    static bool cacheFlush();
-    static bool cacheRawBlock(uint32_t blockNumber, bool dirty);
-  #endif
-
-  // used by SdBaseFile write to assign cache to SD location
-  void cacheSetBlockNumber(uint32_t blockNumber, bool dirty) {
-    cacheDirty_ = dirty;
-    cacheBlockNumber_  = blockNumber;
+  cache_t* cache() { return &cacheBuffer_[cacheCur_]; }
+  uint32_t cacheBlockNumber() const { return cacheBlockNumber_[cacheCur_]; }
+
+  bool cacheFlush();
+  bool cacheRawBlock(uint32_t blockNumber, bool dirty);
+  bool cacheSetBlockNumber(uint32_t blockNumber, bool dirty);  // Used by SdBaseFile write to assign cache to SD location
+  void cacheInvalidate(uint32_t blockNumber, const uint16_t count=1);
+  uint16_t cacheUncachedRun(uint32_t blockNumber, uint16_t count) const;
+  bool cacheWriteBack(const uint8_t slot);
+  uint8_t cacheSlotFor(uint32_t blockNumber, const bool load);
+  bool isFatBlock(uint32_t blockNumber) const {
+    return SD_FAT_CACHE_SLOTS && blockNumber - fatStartBlock_ < blocksPerFat_ * fatCount_;
   }
-  void cacheSetDirty() { cacheDirty_ |= CACHE_FOR_WRITE; }
+
+  void cacheSetDirty() { cacheDirty_[cacheCur_] |= CACHE_FOR_WRITE; }
+  void cacheSetMirror(uint32_t blockNumber) { cacheMirrorBlock_[cacheCur_] = blockNumber; }
   bool chainSize(uint32_t beginCluster, uint32_t* size);
   bool fatGet(uint32_t cluster, uint32_t* value);
   bool fatPut(uint32_t cluster, uint32_t value);
@@ -197,5 +224,7 @@ class SdVolume {
     return  cluster >= FAT32EOC_MIN;
   }
   bool readBlock(uint32_t block, uint8_t* dst) { return sdCard_->readBlock(block, dst); }
-  bool writeBlock(uint32_t block, const uint8_t* dst) { return sdCard_->writeBlock(block, dst); }
+  bool readBlocks(uint32_t block, uint8_t* dst, const uint16_t count) { return sdCard_->readBlocks(block, dst, count); }
+  bool writeBlock(uint32_t block, const uint8_t* dst) { cacheInvalidate(block); return sdCard_->writeBlock(block, dst); }
+  bool writeBlocks(uint32_t block, const uint8_t* dst, const uint16_t count) { cacheInvalidate(block, count); return sdCard_->writeBlocks(block, dst, count); }
 };
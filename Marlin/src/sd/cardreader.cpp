@@ -36,6 +36,7 @@
 #include "../module/planner.h"        // for synchronize
 #include "../module/printcounter.h"
 #include "../gcode/queue.h"
+#include "../gcode/gcode.h"
 #include "../module/settings.h"
 #include "../module/stepper/indirection.h"
 
@@ -51,6 +52,10 @@
   #include "../feature/pause.h"
 #endif
 
+#if ENABLED(M20_TIMESTAMP_SUPPORT)
+  #include "../libs/hex_print.h"
+#endif
+
 // public:
 
 card_flags_t CardReader::flag;
@@ -66,6 +71,12 @@ int8_t CardReader::autostart_index;
 SdFile CardReader::root, CardReader::workDir, CardReader::workDirParents[MAX_DIR_DEPTH];
 uint8_t CardReader::workDirDepth;
 
+#if ENABLED(SD_DIR_INDEX)
+  uint16_t CardReader::dir_index[SD_DIR_INDEX_LIMIT];
+  uint16_t CardReader::dir_item_count;
+  uint32_t CardReader::dir_index_pos;
+#endif
+
 #if ENABLED(SDCARD_SORT_ALPHA)
 
   uint16_t CardReader::sort_count;
@@ -118,6 +129,21 @@ char CardReader::proc_filenames[SD_PROCEDURE_DEPTH][MAXPATHNAMELENGTH];
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_FILE_EXTENTS)
+  sd_extent_t CardReader::extents[SD_FILE_EXTENTS_MAX];
+#endif
+
+#if ENABLED(SD_READAHEAD)
+  uint8_t CardReader::readahead[SD_READAHEAD_BLOCKS * 512];
+  uint32_t CardReader::readahead_pos;
+  uint16_t CardReader::readahead_len; // = 0
+#endif
+
+#if ENABLED(SD_WRITE_BEHIND)
+  uint8_t CardReader::writebehind[SD_WRITE_BEHIND_BLOCKS * 512];
+  uint16_t CardReader::writebehind_len; // = 0
+#endif
+
 CardReader::CardReader() {
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
@@ -200,9 +226,9 @@ int CardReader::countItems(SdFile dir) {
 //
 // Get file/folder info for an item by index
 //
-void CardReader::selectByIndex(SdFile dir, const uint8_t index) {
+void CardReader::selectByIndex(SdFile dir, const uint16_t index) {
   dir_t p;
-  for (uint8_t cnt = 0; dir.readDir(&p, longFilename) > 0;) {
+  for (uint16_t cnt = 0; dir.readDir(&p, longFilename) > 0;) {
     if (is_dir_or_gcode(p)) {
       if (cnt == index) {
         createFilename(filename, p);
@@ -227,59 +253,118 @@ void CardReader::selectByName(SdFile dir, const char * const match) {
 }
 
 //
-// Recursive method to list all files within a folder
+// List all files on the SD card, one entry at a time.
+//
+// Folders are walked with an explicit stack instead of recursion and idle()
+// runs after every entry, so a large card doesn't starve the heaters, LCD,
+// and watchdog. Serial output provides flow control and keeps the host alive.
 //
-void CardReader::printListing(SdFile parent, const char * const prepend/*=nullptr*/) {
+// Output per file: "<dospath> <size>[ 0x<timestamp>][ <longpath>]"
+//
+// The walk state is static to keep it off the stack under idle().
+// M20 is never re-entered, so one copy is enough.
+//
+void CardReader::ls(const uint8_t lsflags/*=0*/) {
+  #if NONE(LONG_FILENAME_HOST_SUPPORT, M20_TIMESTAMP_SUPPORT)
+    UNUSED(lsflags);
+  #endif
+
+  static SdFile dirs[MAX_DIR_DEPTH + 1];                 // Open folders, root first
+  static char path[1 + MAX_DIR_DEPTH * FILENAME_LENGTH]; // DOS path of the innermost folder, e.g., "/DIR1/DIR2/"
+  static uint8_t pathlen[MAX_DIR_DEPTH + 1];             // Length of 'path' at each depth
+
+  #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
+    static char longpath[1 + MAX_DIR_DEPTH * LONG_FILENAME_LENGTH];
+    static uint16_t longlen[MAX_DIR_DEPTH + 1];
+    longpath[0] = '\0'; longlen[0] = 0;
+  #endif
+
+  // Entries are sent between idle() calls, which mustn't report "busy" mid-list
+  KEEPALIVE_STATE(NOT_BUSY);
+
+  dirs[0] = root;
+  dirs[0].rewind();
+  path[0] = '\0'; pathlen[0] = 0;
+
   dir_t p;
-  while (parent.readDir(&p, longFilename) > 0) {
+  for (int8_t depth = 0; depth >= 0;) {
+
+    // Stop if the media was released by idle()
+    if (!isMounted()) {
+      while (depth > 0) dirs[depth--].close();
+      break;
+    }
+
+    if (dirs[depth].readDir(&p, longFilename) <= 0) {
+      if (depth) dirs[depth].close();
+      depth--;
+      continue;
+    }
+
     if (DIR_IS_SUBDIR(&p)) {
+      if (depth >= MAX_DIR_DEPTH) continue;
 
       // Get the short name for the item, which we know is a folder
       char dosFilename[FILENAME_LENGTH];
       createFilename(dosFilename, p);
 
-      // Allocate enough stack space for the full path to a folder, trailing slash, and nul
-      const bool prepend_is_empty = (!prepend || prepend[0] == '\0');
-      const int len = (prepend_is_empty ? 1 : strlen(prepend)) + strlen(dosFilename) + 1 + 1;
-      char path[len];
-
-      // Append the FOLDERNAME12/ to the passed string.
-      // It contains the full path to the "parent" argument.
-      // We now have the full path to the item in this folder.
-      strcpy(path, prepend_is_empty ? "/" : prepend); // root slash if prepend is empty
-      strcat(path, dosFilename);                      // FILENAME_LENGTH characters maximum
-      strcat(path, "/");                              // 1 character
-
-      // Serial.print(path);
-
-      // Get a new directory object using the full path
-      // and dive recursively into it.
-      SdFile child;
-      if (!child.open(&parent, dosFilename, O_READ)) {
+      // Open the folder one level down
+      if (!dirs[depth + 1].open(&dirs[depth], dosFilename, O_READ)) {
         SERIAL_ECHO_START();
         SERIAL_ECHOLNPAIR(STR_SD_CANT_OPEN_SUBDIR, dosFilename);
+        continue;
       }
-      printListing(child, path);
-      // close() is done automatically by destructor of SdFile
+
+      // Append "FOLDERNAME/" to the current path, with a root slash
+      uint8_t len = pathlen[depth];
+      if (!len) path[len++] = '/';
+      strcpy(&path[len], dosFilename);
+      len += strlen(dosFilename);
+      path[len++] = '/';
+      path[len] = '\0';
+
+      #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
+        // Append "/Long Folder Name" to the long path
+        uint16_t llen = longlen[depth];
+        longpath[llen++] = '/';
+        const char * const lname = longFilename[0] ? longFilename : dosFilename;
+        strcpy(&longpath[llen], lname);
+        longlen[depth + 1] = llen + strlen(lname);
+      #endif
+
+      depth++;
+      pathlen[depth] = len;
     }
     else if (is_dir_or_gcode(p)) {
+      path[pathlen[depth]] = '\0';
       createFilename(filename, p);
-      if (prepend) SERIAL_ECHO(prepend);
+      SERIAL_ECHO(path);
       SERIAL_ECHO(filename);
       SERIAL_CHAR(' ');
-      SERIAL_ECHOLN(p.fileSize);
+      SERIAL_ECHO(p.fileSize);
+      #if ENABLED(M20_TIMESTAMP_SUPPORT)
+        if (lsflags & LS_TIMESTAMP) {
+          SERIAL_ECHOPGM(" 0x");
+          print_hex_word(p.lastWriteDate);
+          print_hex_word(p.lastWriteTime);
+        }
+      #endif
+      #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
+        if (lsflags & LS_LONG_FILENAME) {
+          longpath[longlen[depth]] = '\0';
+          SERIAL_CHAR(' ');
+          SERIAL_ECHO(longpath);
+          SERIAL_CHAR('/');
+          SERIAL_ECHO(longFilename[0] ? longFilename : filename);
+        }
+      #endif
+      SERIAL_EOL();
+
+      idle();
     }
   }
 }
 
-//
-// List all files on the SD card
-//
-void CardReader::ls() {
-  root.rewind();
-  printListing(root);
-}
-
 #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
 
   //
@@ -440,6 +525,7 @@ void CardReader::release() {
   endFilePrint();
   flag.mounted = false;
   flag.workDirIsRoot = true;
+  TERN_(SD_DIR_INDEX, reset_dir_index());
   #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
     nrFiles = 0;
   #endif
@@ -465,6 +551,12 @@ void CardReader::endFilePrint(TERN_(SD_RESORT, const bool re_sort/*=false*/)) {
   TERN_(ADVANCED_PAUSE_FEATURE, did_pause_print = 0);
   TERN_(DWIN_CREALITY_LCD, HMI_flag.print_finish = flag.sdprinting);
   flag.sdprinting = flag.abort_sd_printing = false;
+  #if ENABLED(SD_WRITE_BEHIND)
+    if (flag.saving) {
+      finishWrite();
+      flag.saving = flag.logging = false; // Don't finish the closed file again in closefile()
+    }
+  #endif
   if (isFileOpen()) file.close();
   TERN_(SD_RESORT, if (re_sort) presort());
 }
@@ -565,6 +657,8 @@ void CardReader::openFileRead(char * const path, const uint8_t subcall_type/*=0*
   if (file.open(curDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    TERN_(SD_READAHEAD, readahead_len = 0);
+    TERN_(SD_FILE_EXTENTS, file.mapExtents(extents, SD_FILE_EXTENTS_MAX));
 
     PORT_REDIRECT(SERIAL_BOTH);
     SERIAL_ECHOLNPAIR(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
@@ -602,6 +696,10 @@ void CardReader::openFileWrite(char * const path) {
   #else
     if (file.open(curDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
       flag.saving = true;
+      #ifdef SD_WRITE_PREALLOCATE
+        file.preAllocate(SD_WRITE_PREALLOCATE); // Best effort. Writes extend the chain as usual.
+      #endif
+      TERN_(SD_DIR_INDEX, reset_dir_index());
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
       echo_write_to_file(fname);
@@ -630,6 +728,7 @@ void CardReader::removeFile(const char * const name) {
     if (file.remove(curDir, fname)) {
       SERIAL_ECHOLNPAIR("File deleted:", fname);
       sdpos = 0;
+      TERN_(SD_DIR_INDEX, reset_dir_index());
       TERN_(SDCARD_SORT_ALPHA, presort());
     }
     else
@@ -648,6 +747,14 @@ void CardReader::report_status() {
     SERIAL_ECHOLNPGM(STR_SD_NOT_PRINTING);
 }
 
+#if ENABLED(SD_CACHE_STATS)
+
+  void CardReader::report_cache_stats() {
+    SERIAL_ECHOLNPAIR("SD cache hits:", volume.cacheHits(), " misses:", volume.cacheMisses(), " writes:", volume.cacheWrites());
+  }
+
+#endif
+
 void CardReader::write_command(char * const buf) {
   char* begin = buf;
   char* npos = nullptr;
@@ -661,7 +768,7 @@ void CardReader::write_command(char * const buf) {
   end[1] = '\r';
   end[2] = '\n';
   end[3] = '\0';
-  file.write(begin);
+  TERN(SD_WRITE_BEHIND, writeBehind(begin, end + 3 - begin), file.write(begin));
 
   if (file.writeError) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
 }
@@ -703,11 +810,47 @@ void CardReader::beginautostart() {
   cdroot();
 }
 
+#if ENABLED(SD_WRITE_BEHIND)
+
+  // Append to the write-behind buffer, writing it out each time it fills
+  void CardReader::writeBehind(const char *src, uint16_t len) {
+    while (len) {
+      const uint16_t n = _MIN(len, sizeof(writebehind) - writebehind_len);
+      memcpy(&writebehind[writebehind_len], src, n);
+      writebehind_len += n;
+      src += n;
+      len -= n;
+      if (writebehind_len == sizeof(writebehind)) flushWriteBehind();
+    }
+  }
+
+  // The file is written from the start, so every full buffer lands on a block boundary
+  bool CardReader::flushWriteBehind() {
+    const bool ok = !writebehind_len || file.write(writebehind, writebehind_len) >= 0;
+    writebehind_len = 0;
+    return ok;
+  }
+
+  // Write out what is still buffered and release any unused reserved clusters
+  bool CardReader::finishWrite() {
+    bool ok = flushWriteBehind();
+    #ifdef SD_WRITE_PREALLOCATE
+      ok = file.truncate(file.fileSize()) && ok;
+    #endif
+    return ok;
+  }
+
+#endif
+
 void CardReader::closefile(const bool store_location) {
+  #if ENABLED(SD_WRITE_BEHIND)
+    if (flag.saving && !finishWrite()) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
+  #endif
   file.sync();
   file.close();
   flag.saving = flag.logging = false;
   sdpos = 0;
+  TERN_(SD_READAHEAD, readahead_len = 0);
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
   if (store_location) {
@@ -728,6 +871,17 @@ void CardReader::selectFileByIndex(const uint16_t nr) {
       return;
     }
   #endif
+  #if ENABLED(SD_DIR_INDEX)
+    if (nr >= dir_item_count && !flag.dirIndexed) index_workdir();
+    if (nr < _MIN(dir_item_count, uint16_t(SD_DIR_INDEX_LIMIT))) {
+      dir_t p;
+      if (workDir.seekSet(uint32_t(dir_index[nr]) << 5) && workDir.readDir(&p, longFilename) > 0) {
+        is_dir_or_gcode(p);           // Set filenameIsDir
+        createFilename(filename, p);
+        return;
+      }
+    }
+  #endif
   workDir.rewind();
   selectByIndex(workDir, nr);
 }
@@ -750,10 +904,57 @@ void CardReader::selectFileByName(const char * const match) {
 }
 
 uint16_t CardReader::countFilesInWorkDir() {
-  workDir.rewind();
-  return countItems(workDir);
+  #if ENABLED(SD_DIR_INDEX)
+    if (!flag.dirIndexed) index_workdir();
+    return dir_item_count;
+  #else
+    workDir.rewind();
+    return countItems(workDir);
+  #endif
 }
 
+#if ENABLED(SD_DIR_INDEX)
+
+  /**
+   * Count the items in the working directory and note the directory entry
+   * where each one starts (its first long name entry, if any) so they can be
+   * read back directly by selectFileByIndex.
+   *
+   * idle() passes a budget of items to read per call, so a large directory
+   * doesn't hold up the main loop. Callers that need the full count now pass
+   * no budget and finish the index from wherever it left off.
+   */
+  void CardReader::index_workdir(const uint16_t budget/*=0*/) {
+    const bool was_dir = flag.filenameIsDir;  // Changed by is_dir_or_gcode
+    bool done = !workDir.seekSet(dir_index_pos);
+    dir_t p;
+    uint16_t c = dir_item_count;
+    for (uint16_t n = budget; !done;) {
+      const uint32_t pos = workDir.curPosition();
+      if (workDir.readDir(&p, nullptr) <= 0)  // Long names aren't needed, so leave longFilename alone
+        done = true;
+      else {
+        if (is_dir_or_gcode(p)) {
+          if (c < SD_DIR_INDEX_LIMIT) dir_index[c] = pos >> 5;
+          c++;
+        }
+        if (budget && !--n) break;
+      }
+    }
+    flag.filenameIsDir = was_dir;
+    dir_item_count = c;
+    dir_index_pos = workDir.curPosition();
+    if (!done) return;
+
+    #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
+      nrFiles = c;
+    #endif
+
+    flag.dirIndexed = true;
+  }
+
+#endif
+
 /**
  * Dive to the given DOS 8.3 file path, with optional echo of the dive paths.
  *
@@ -782,7 +983,7 @@ const char* CardReader::diveToFile(const bool update_cwd, SdFile*& curDir, const
   startDir = curDir;
   while (item_name_adr) {
     // Find next subdirectory delimiter
-    char * const name_end = strchr(item_name_adr, '/');
+    const char * const name_end = strchr(item_name_adr, '/');
 
     // Last atom in the path? Item found.
     if (name_end <= item_name_adr) break;
@@ -811,6 +1012,7 @@ const char* CardReader::diveToFile(const bool update_cwd, SdFile*& curDir, const
     if (update_cwd) {
       if (workDirDepth < MAX_DIR_DEPTH) workDirParents[workDirDepth++] = *curDir;
       workDir = *curDir;
+      TERN_(SD_DIR_INDEX, reset_dir_index());
     }
 
     // Point sub at the other scratch object
@@ -829,6 +1031,7 @@ void CardReader::cd(const char * relpath) {
   if (newDir.open(parent, relpath, O_READ)) {
     workDir = newDir;
     flag.workDirIsRoot = false;
+    TERN_(SD_DIR_INDEX, reset_dir_index());
     if (workDirDepth < MAX_DIR_DEPTH)
       workDirParents[workDirDepth++] = workDir;
     TERN_(SDCARD_SORT_ALPHA, presort());
@@ -842,6 +1045,7 @@ void CardReader::cd(const char * relpath) {
 int8_t CardReader::cdup() {
   if (workDirDepth > 0) {                                               // At least 1 dir has been saved
     workDir = --workDirDepth ? workDirParents[workDirDepth - 1] : root; // Use parent, or root if none
+    TERN_(SD_DIR_INDEX, reset_dir_index());
     TERN_(SDCARD_SORT_ALPHA, presort());
   }
   if (!workDirDepth) flag.workDirIsRoot = true;
@@ -851,6 +1055,7 @@ int8_t CardReader::cdup() {
 void CardReader::cdroot() {
   workDir = root;
   flag.workDirIsRoot = true;
+  TERN_(SD_DIR_INDEX, reset_dir_index());
   TERN_(SDCARD_SORT_ALPHA, presort());
 }
 
@@ -973,72 +1178,51 @@ void CardReader::cdroot() {
           #endif
         }
 
-        // Bubble Sort
-        for (uint16_t i = fileCnt; --i;) {
-          bool didSwap = false;
-          uint8_t o1 = sort_order[0];
-          #if DISABLED(SDSORT_USES_RAM)
-            selectFileByIndex(o1);              // Pre-fetch the first entry and save it
-            strcpy(name1, longest_filename());  // so the loop only needs one fetch
-            TERN_(HAS_FOLDER_SORTING, bool dir1 = flag.filenameIsDir);
+        // Compare two items by name, and by kind if folders are sorted apart.
+        // True if item 1 belongs after item 2.
+        #define _SORT_NAME_GT(N1, N2) (strcasecmp(N1, N2) > 0)
+        #if HAS_FOLDER_SORTING
+          #define _SORT_DIR_GT(N1, D1, N2, D2, FS) ((D1) == (D2) ? _SORT_NAME_GT(N1, N2) : ((FS) > 0 ? (D1) : (D2)))
+          #if ENABLED(SDSORT_GCODE)
+            #define _SORT_GT(N1, D1, N2, D2) (sort_folders ? _SORT_DIR_GT(N1, D1, N2, D2, sort_folders) : _SORT_NAME_GT(N1, N2))
+          #else
+            #define _SORT_GT(N1, D1, N2, D2) _SORT_DIR_GT(N1, D1, N2, D2, FOLDER_SORTING)
           #endif
+        #else
+          #define _SORT_GT(N1, D1, N2, D2) _SORT_NAME_GT(N1, N2)
+        #endif
 
-          for (uint16_t j = 0; j < i; ++j) {
-            const uint16_t o2 = sort_order[j + 1];
+        // Binary insertion sort. Stable, and needs only O(n log n) comparisons,
+        // which matters when names are re-read from SD for every compare.
+        for (uint16_t i = 1; i < fileCnt; ++i) {
+          const uint8_t o1 = sort_order[i];
+          #if DISABLED(SDSORT_USES_RAM)
+            selectFileByIndex(o1);              // Fetch the item to place and save it
+            strcpy(name1, longest_filename());  // so each probe only needs one fetch
+            TERN_(HAS_FOLDER_SORTING, const bool dir1 = flag.filenameIsDir);
+          #endif
 
-            // Compare names from the array or just the two buffered names
+          // Find the first sorted item that belongs after the new one
+          uint16_t lo = 0, hi = i;
+          while (lo < hi) {
+            const uint16_t mid = (lo + hi) >> 1;
+            const uint8_t o2 = sort_order[mid];
             #if ENABLED(SDSORT_USES_RAM)
-              #define _SORT_CMP_NODIR() (strcasecmp(sortnames[o1], sortnames[o2]) > 0)
+              const bool after = _SORT_GT(sortnames[o2], IS_DIR(o2), sortnames[o1], IS_DIR(o1));
             #else
-              #define _SORT_CMP_NODIR() (strcasecmp(name1, name2) > 0)
-            #endif
-
-            #if HAS_FOLDER_SORTING
-              #if ENABLED(SDSORT_USES_RAM)
-                // Folder sorting needs an index and bit to test for folder-ness.
-                #define _SORT_CMP_DIR(fs) (IS_DIR(o1) == IS_DIR(o2) ? _SORT_CMP_NODIR() : IS_DIR(fs > 0 ? o1 : o2))
-              #else
-                #define _SORT_CMP_DIR(fs) ((dir1 == flag.filenameIsDir) ? _SORT_CMP_NODIR() : (fs > 0 ? dir1 : !dir1))
-              #endif
+              selectFileByIndex(o2);
+              const bool after = _SORT_GT(longest_filename(), flag.filenameIsDir, name1, dir1);
             #endif
+            if (after) hi = mid; else lo = mid + 1;
+          }
 
-            // The most economical method reads names as-needed
-            // throughout the loop. Slow if there are many.
-            #if DISABLED(SDSORT_USES_RAM)
-              selectFileByIndex(o2);
-              const bool dir2 = flag.filenameIsDir;
-              char * const name2 = longest_filename(); // use the string in-place
-            #endif // !SDSORT_USES_RAM
-
-            // Sort the current pair according to settings.
-            if (
-              #if HAS_FOLDER_SORTING
-                #if ENABLED(SDSORT_GCODE)
-                  sort_folders ? _SORT_CMP_DIR(sort_folders) : _SORT_CMP_NODIR()
-                #else
-                  _SORT_CMP_DIR(FOLDER_SORTING)
-                #endif
-              #else
-                _SORT_CMP_NODIR()
-              #endif
-            ) {
-              // Reorder the index, indicate that sorting happened
-              // Note that the next o1 will be the current o1. No new fetch needed.
-              sort_order[j] = o2;
-              sort_order[j + 1] = o1;
-              didSwap = true;
-            }
-            else {
-              // The next o1 is the current o2. No new fetch needed.
-              o1 = o2;
-              #if DISABLED(SDSORT_USES_RAM)
-                TERN_(HAS_FOLDER_SORTING, dir1 = dir2);
-                strcpy(name1, name2);
-              #endif
-            }
+          // Insert it there
+          if (lo < i) {
+            memmove(&sort_order[lo + 1], &sort_order[lo], (i - lo) * sizeof(sort_order[0]));
+            sort_order[lo] = o1;
           }
-          if (!didSwap) break;
         }
+
         // Using RAM but not keeping names around
         #if ENABLED(SDSORT_USES_RAM) && DISABLED(SDSORT_CACHE_NAMES)
           #if ENABLED(SDSORT_DYNAMIC_RAM)
@@ -1099,6 +1283,30 @@ uint16_t CardReader::get_num_Files() {
 //
 // Return from procedure or close out the Print Job
 //
+#if ENABLED(SD_READAHEAD)
+
+  /**
+   * Refill the read-ahead buffer from the block holding the current index.
+   * Whole blocks are read straight into the buffer (multi-block where the
+   * card supports it) so the shared volume cache stays free for the FAT.
+   */
+  uint16_t CardReader::peekBuffer(const char* &buf) {
+    if (eof()) return 0;
+    if (sdpos < readahead_pos || sdpos >= readahead_pos + readahead_len) {
+      readahead_pos = sdpos & ~0x1FFUL;
+      readahead_len = 0;
+      if (!file.seekSet(readahead_pos)) return 0;
+      const int16_t n = file.read(readahead, sizeof(readahead));
+      if (n <= 0) return 0;
+      readahead_len = n;
+      if (sdpos >= readahead_pos + readahead_len) return 0;
+    }
+    buf = (const char*)&readahead[sdpos - readahead_pos];
+    return readahead_pos + readahead_len - sdpos;
+  }
+
+#endif
+
 void CardReader::fileHasFinished() {
   planner.synchronize();
   file.close();
@@ -1143,7 +1351,8 @@ void CardReader::fileHasFinished() {
   void CardReader::openJobRecoveryFile(const bool read) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
-    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
+    // The journal rewrites the file in place and is flushed when it's closed
+    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | TERN(POWER_LOSS_JOURNAL, 0, O_TRUNC | O_SYNC)))
       SERIAL_ECHOLNPAIR(STR_SD_OPEN_FILE_FAIL, recovery.filename, ".");
     else if (!read)
       echo_write_to_file(recovery.filename);
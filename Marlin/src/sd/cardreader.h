@@ -43,6 +43,9 @@
 
 #include "SdFile.h"
 
+// Options for the M20 file listing
+enum LsFlags : uint8_t { LS_LONG_FILENAME = _BV(0), LS_TIMESTAMP = _BV(1) };
+
 typedef struct {
   bool saving:1,
        logging:1,
@@ -54,6 +57,9 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1
        #endif
+       #if ENABLED(SD_DIR_INDEX)
+         , dirIndexed:1
+       #endif
     ;
 } card_flags_t;
 
@@ -81,11 +87,16 @@ public:
   static void mount();
   static void release();
   static inline bool isMounted() { return flag.mounted; }
-  static void ls();
+  static void ls(const uint8_t lsflags=0);
 
   // Handle media insert/remove
   static void manage_media();
 
+  #if ENABLED(SD_DIR_INDEX)
+    // Index the working directory a few items at a time, from idle(). Not while writing a file.
+    static inline void index_task() { if (isMounted() && !flag.dirIndexed && !flag.saving) index_workdir(SD_DIR_INDEX_BATCH); }
+  #endif
+
   // SD Card Logging
   static void openLogFile(char * const path);
   static void write_command(char * const buf);
@@ -125,6 +136,9 @@ public:
   static void startFileprint();
   static void endFilePrint(TERN_(SD_RESORT, const bool re_sort=false));
   static void report_status();
+  #if ENABLED(SD_CACHE_STATS)
+    static void report_cache_stats();
+  #endif
   static inline void pauseSDPrint() { flag.sdprinting = false; }
   static inline bool isPaused() { return isFileOpen() && !flag.sdprinting; }
   static inline bool isPrinting() { return flag.sdprinting; }
@@ -160,8 +174,16 @@ public:
   static inline bool eof() { return sdpos >= filesize; }
   static inline void setIndex(const uint32_t index) { sdpos = index; file.seekSet(index); }
   static inline char* getWorkDirName() { workDir.getDosName(filename); return filename; }
-  static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
-  static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  static inline int16_t get() { TERN_(SD_READAHEAD, syncReadAhead()); sdpos = file.curPosition(); return (int16_t)file.read(); }
+  static inline int16_t read(void* buf, uint16_t nbyte) { TERN_(SD_READAHEAD, syncReadAhead()); return file.isOpen() ? file.read(buf, nbyte) : -1; }
+
+  #if ENABLED(SD_READAHEAD)
+    // Buffered access to the file being printed. peekBuffer() points 'buf' at the
+    // data from the current index on and returns the number of bytes available
+    // there, or 0 on end of file or error. consume() advances the index.
+    static uint16_t peekBuffer(const char* &buf);
+    static inline void consume(const uint16_t n) { sdpos += n; }
+  #endif
   static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
 
   static Sd2Card& getSd2Card() { return sd2card; }
@@ -183,6 +205,17 @@ private:
   static SdFile root, workDir, workDirParents[MAX_DIR_DEPTH];
   static uint8_t workDirDepth;
 
+  //
+  // Index of the listed items in the working directory
+  //
+  #if ENABLED(SD_DIR_INDEX)
+    static uint16_t dir_index[SD_DIR_INDEX_LIMIT];  // Directory entry number where each item starts
+    static uint16_t dir_item_count;                 // Count of items indexed so far
+    static uint32_t dir_index_pos;                  // Directory position where indexing resumes
+    static void index_workdir(const uint16_t budget=0);
+    static inline void reset_dir_index() { flag.dirIndexed = false; dir_item_count = 0; dir_index_pos = 0; }
+  #endif
+
   //
   // Alphabetical file and folder sorting
   //
@@ -245,6 +278,27 @@ private:
 
   static uint32_t filesize, sdpos;
 
+  #if ENABLED(SD_FILE_EXTENTS)
+    static sd_extent_t extents[SD_FILE_EXTENTS_MAX];  // Cluster runs of the open file
+  #endif
+
+  #if ENABLED(SD_READAHEAD)
+    static uint8_t readahead[SD_READAHEAD_BLOCKS * 512];
+    static uint32_t readahead_pos;                    // File position of readahead[0]
+    static uint16_t readahead_len;                    // Valid bytes in readahead[]
+    static inline void syncReadAhead() {              // Put the file position back where get() expects it
+      if (readahead_len) { readahead_len = 0; file.seekSet(sdpos); }
+    }
+  #endif
+
+  #if ENABLED(SD_WRITE_BEHIND)
+    static uint8_t writebehind[SD_WRITE_BEHIND_BLOCKS * 512];
+    static uint16_t writebehind_len;                  // Bytes waiting in writebehind[]
+    static void writeBehind(const char *src, uint16_t len);
+    static bool flushWriteBehind();
+    static bool finishWrite();
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -271,9 +325,8 @@ private:
   //
   static bool is_dir_or_gcode(const dir_t &p);
   static int countItems(SdFile dir);
-  static void selectByIndex(SdFile dir, const uint8_t index);
+  static void selectByIndex(SdFile dir, const uint16_t index);
   static void selectByName(SdFile dir, const char * const match);
-  static void printListing(SdFile parent, const char * const prepend=nullptr);
 
   #if ENABLED(SDCARD_SORT_ALPHA)
     static void flush_presort();
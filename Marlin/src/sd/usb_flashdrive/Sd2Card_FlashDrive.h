@@ -66,7 +66,15 @@ class Sd2Card {
     inline bool writeStop() const                                { return true; }
 
     bool readBlock(uint32_t block, uint8_t* dst);
+    bool readBlocks(uint32_t block, uint8_t* dst, const uint16_t count) {
+      for (uint16_t n = 0; n < count; ++n) if (!readBlock(block + n, dst + n * 512U)) return false;
+      return true;
+    }
     bool writeBlock(uint32_t blockNumber, const uint8_t* src);
+    bool writeBlocks(uint32_t block, const uint8_t* src, const uint16_t count) {
+      for (uint16_t n = 0; n < count; ++n) if (!writeBlock(block + n, src + n * 512U)) return false;
+      return true;
+    }
 
     uint32_t cardSize();
     static bool isInserted();
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+#
+# rle16_compress_cpp_image_data.py
+#
+# Convert Color UI images from HIGHCOLOR to RLE16 in place.
+#
+# Each input file holds a single image as 16-bit RGB565 pixels:
+#
+#    extern const uint16_t <name>_<width>x<height>x16[<width * height>] = { 0x..., ... };
+#
+# The array is replaced by the RLE16 byte stream that CANVAS::AddImageRLE16
+# (Marlin/src/lcd/tft/canvas.cpp) decodes. Every image line is encoded on its own.
+# A count byte 0x80 | (n - 1) is followed by n colors, and a count byte (n - 1)
+# is followed by one color repeated n times (1 <= n <= 128). Colors are stored
+# high byte first. Remember to set RLE16 for the image in tft_image.cpp.
+#
+# Invocation:
+#-------------
+#   python3 rle16_compress_cpp_image_data.py Marlin/src/lcd/tft/images/bootscreen_320x240x16.cpp
+#
+
+import re, sys
+
+def rle_line(pixels):
+  out, literals = [], []
+
+  def flush_literals():
+    while literals:
+      chunk = literals[:128]
+      del literals[:128]
+      out.append(0x80 | (len(chunk) - 1))
+      for c in chunk: out.extend([c >> 8, c & 0xFF])
+
+  i, n = 0, len(pixels)
+  while i < n:
+    j = i
+    while j < n and pixels[j] == pixels[i] and j - i < 128: j += 1
+    if j - i >= 2:
+      flush_literals()
+      out.extend([j - i - 1, pixels[i] >> 8, pixels[i] & 0xFF])
+      i = j
+    else:
+      literals.append(pixels[i])
+      i += 1
+
+  flush_literals()
+  return out
+
+def convert(path):
+  with open(path) as f: text = f.read()
+
+  start = re.search(r'extern const uint16_t (\w+_(\d+)x(\d+)x16)\[(\d+)\] = \{\n', text)
+  if not start:
+    print(path + ": no HIGHCOLOR image found")
+    return False
+
+  name, width, height, count = start.group(1), int(start.group(2)), int(start.group(3)), int(start.group(4))
+  end = text.index('\n};', start.end())
+  pixels = [int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]+', text[start.end():end])]
+  if not (len(pixels) == count == width * height):
+    print(path + ": image size doesn't match its name")
+    return False
+
+  lines = [rle_line(pixels[y * width:(y + 1) * width]) for y in range(height)]
+  size = sum(map(len, lines))
+  body = '\n'.join('  ' + ', '.join('0x%02x' % b for b in line) + ',' for line in lines)
+
+  with open(path, 'w') as f:
+    f.write(text[:start.start()] + 'extern const uint8_t %s[%d] = {\n' % (name, size) + body + text[end:])
+
+  print("%s: %d -> %d bytes" % (path, count * 2, size))
+  return True
+
+if len(sys.argv) < 2:
+  print("Usage: %s image.cpp ..." % sys.argv[0])
+  sys.exit(1)
+
+ok = True
+for path in sys.argv[1:]: ok = convert(path) and ok
+sys.exit(0 if ok else 1)